@@ -4,9 +4,19 @@
 // subscribe table, format: topic, expect payload type, callback, user param
 static const bc_radio_sub_t subs[] = {
     // MQTT subscribe topic which will trigger pump
-    { "task/pump/start/5", BC_RADIO_SUB_PT_INT, exec_tasks, NULL }
+    { "task/pump/start/5", BC_RADIO_SUB_PT_INT, exec_tasks, NULL },
+    // MQTT subscribe topics which will tune watering controller
+    { "watering/threshold/low/set", BC_RADIO_SUB_PT_INT, watering_set_threshold, &watering.threshold_low },
+    { "watering/threshold/high/set", BC_RADIO_SUB_PT_INT, watering_set_threshold, &watering.threshold_high },
+    { "watering/dose/set", BC_RADIO_SUB_PT_INT, watering_set_dose, NULL },
+    { "watering/soak/set", BC_RADIO_SUB_PT_INT, watering_set_soak, NULL }
 };
 
+// outputs of watering zones
+static const bc_gpio_channel_t zone_outputs[ZONE_COUNT] = ZONE_OUTPUTS;
+// zone watered according to a probe
+static const int probe_zones[WATERING_PROBE_COUNT] = PROBE_ZONES;
+
 // core module LED instance
 bc_led_t led;
 // core module button instance
@@ -28,6 +38,11 @@ bc_tmp112_t tmp112;
     bc_tick_t sensor_moisture_tick_report[MAX_SOIL_SENSORS];
     // last sensor moisture value used for change comparison
     int sensor_last_published_moisture[MAX_SOIL_SENSORS];
+#else
+    // time of next moisture report of analog soil probe
+    bc_tick_t moisture_tick_report;
+    // last moisture value used for change comparison
+    int last_published_moisture;
 #endif
 
 void application_init(void)
@@ -35,6 +50,17 @@ void application_init(void)
     // initialize logging
     bc_log_init(BC_LOG_LEVEL_DUMP, BC_LOG_TIMESTAMP_ABS);
 
+    // initialize energy accounting - it should be first to count all subsystems
+    bc_energy_init();
+    bc_energy_set_current(ZONE_SCHEDULER_ENERGY_SUBSYSTEM, ENERGY_PUMP_CURRENT);
+    bc_energy_set_event_handler(energy_event_handler, NULL);
+    bc_energy_set_update_interval(ENERGY_PUB_INTERVAL);
+
+#if I2C_TRACE
+    // record I2C transactions of all drivers
+    bc_i2c_set_trace_handler(i2c_trace_handler, NULL);
+#endif
+
     // initialize a LED
     bc_led_init(&led, BC_GPIO_LED, false, false);
     bc_led_set_mode(&led, BC_LED_MODE_OFF);
@@ -49,6 +75,17 @@ void application_init(void)
     // subscribe to MQTT topic
     bc_radio_set_subs((bc_radio_sub_t *) subs, sizeof(subs)/sizeof(bc_radio_sub_t));
     bc_radio_set_rx_timeout_for_sleeping_node(RADIO_RX_TIMEOUT);
+    bc_radio_set_event_handler(radio_event_handler, NULL);
+
+    // initialize log of measurements which could not be published
+    measurement_log_init();
+
+    // initialize store of settings which can be changed by client
+    if (bc_kv_init(SETTINGS_EEPROM_ADDRESS, SETTINGS_EEPROM_SIZE)) {
+        watering_settings_load();
+    } else {
+        bc_log_error("Settings store init failed");
+    }
 
     // initialize a battery module
     bc_module_battery_init();
@@ -61,11 +98,13 @@ void application_init(void)
     // set measure inteval
     bc_tmp112_set_update_interval(&tmp112, SENSOR_UPDATE_SERVICE_INTERVAL);
 
-    // initialize port for a transistor/switch to turn on a water pump
-    bc_gpio_init(WATER_PUMP_POWER_ID);
-    bc_gpio_set_mode(WATER_PUMP_POWER_ID, BC_GPIO_MODE_OUTPUT);
-    // create tasks - stop water pump
-    tasks._stop_water_pump_task_id = bc_scheduler_register(_stop_water_pump, NULL, 100);
+    // initialize ports for transistors/switches to turn on water pumps of zones
+    zone_scheduler_init(zone_outputs, ZONE_COUNT, ZONE_MAX_ACTIVE);
+    zone_scheduler_set_event_handler(zone_event_handler, NULL);
+    // create tasks for watering controller - planned after each dose
+    for (int i = 0; i < ZONE_COUNT; i++) {
+        watering.zones[i].soak_task_id = bc_scheduler_register(_watering_soak_task, &watering.zones[i], BC_TICK_INFINITY);
+    }
 
     // initialize ports for water floats
     bc_gpio_init(water_float_ports.low);
@@ -77,6 +116,9 @@ void application_init(void)
     bc_gpio_set_pull(water_float_ports.high, BC_GPIO_PULL_UP);
     // create task for reading sensor value + execute task
     tasks._measure_water_level_task_id = bc_scheduler_register(_measure_water_level, NULL, 1000);
+    // check water floats on any change of their state
+    bc_exti_register(WATER_FLOAT_LOW_EXTI_LINE, BC_EXTI_EDGE_RISING_AND_FALLING, _water_float_exti_handler, NULL);
+    bc_exti_register(WATER_FLOAT_HIGH_EXTI_LINE, BC_EXTI_EDGE_RISING_AND_FALLING, _water_float_exti_handler, NULL);
 
 #if MODULE_SENSOR
     // initialize BigClown soil sensor
@@ -86,17 +128,13 @@ void application_init(void)
     // switch BC soil sensor to normal mode
     bc_scheduler_register(switch_to_normal_mode_bc_soil_sensor_task, NULL, SERVICE_MODE_INTERVAL);
 #else
-    // initialize power for a soil sensor
-    bc_gpio_init(SOIL_MOISTURE_POWER_ID);
-    bc_gpio_set_mode(SOIL_MOISTURE_POWER_ID, BC_GPIO_MODE_OUTPUT);
-    // initialization of analog port for reading values from a soil moisture sensor
-    bc_adc_init();
+    // initialize a soil moisture probe on analog port, it's powered only while measured
+    soil_probe_init(SOIL_MOISTURE_PORT_ID, SOIL_MOISTURE_POWER_ID, SOIL_MOISTURE_POWER_ON_INTERVAL);
+    soil_probe_set_event_handler(soil_probe_event_handler, NULL);
     // set a first moisture value
     values.moisture = 0;
     // create task for regular measurements of moisture
     tasks._measure_moisture_id = bc_scheduler_register(_measure_moisture_task, NULL, 1000);
-    // create task to stop moisture measurement
-    tasks._stop_measuring_moisture_task_id = bc_scheduler_register(_stop_measuring_moisture, NULL, 1000);
 #endif
     // switch to normal mode for temperature sensor on core module
     bc_scheduler_register(switch_to_normal_mode_task, NULL, SERVICE_MODE_INTERVAL);
@@ -124,6 +162,57 @@ void button_event_handler(bc_button_t *self, bc_button_event_t event, void *even
     }
 }
 
+// event handler for a radio
+// it tracks whether published messages are acknowledged by a gateway
+void radio_event_handler(bc_radio_event_t event, void *event_param)
+{
+    (void) event_param;
+
+    measurement_log_radio_event(event);
+}
+
+// trace handler of I2C transactions
+// every transaction is logged as one line which can be replayed on host
+void i2c_trace_handler(const bc_i2c_trace_t *trace, void *trace_param)
+{
+    (void) trace_param;
+
+    char line[128];
+
+    bc_i2c_trace_format(trace, line, sizeof(line));
+    bc_log_debug("%s", line);
+}
+
+// event handler for energy accounting
+// it publishes average current and projected battery life, so firmware builds can be compared
+void energy_event_handler(bc_energy_event_t event, void *event_param)
+{
+    (void) event_param;
+
+    if (event != BC_ENERGY_EVENT_UPDATE) {
+        return;
+    }
+    float current = bc_energy_get_average_current();
+    // days to months
+    float months = bc_energy_get_battery_life(ENERGY_BATTERY_CAPACITY) / 30.4f;
+    for (bc_energy_subsystem_t i = 0; i < BC_ENERGY_SUBSYSTEM_COUNT; i++) {
+        bc_log_debug("Energy subsystem %d: on-time %f s, charge %f mAh", i,
+            bc_energy_get_on_time(i), bc_energy_get_charge(i));
+    }
+    bc_log_debug("Energy average current: %f mA, battery life: %f months", current, months);
+    bc_i2c_profile_t profile;
+    if (bc_i2c_get_profile(BC_I2C_I2C0, 0x49, &profile)) {
+        bc_log_debug("I2C TMP112: %d transactions, %d nacks, %d errors, bus time %d us", (int) profile.transactions,
+            (int) profile.nacks, (int) profile.errors, (int) profile.bus_time_us);
+    }
+    if (measurement_log_is_link_up()) {
+        bc_radio_pub_float("energy/average-current", &current);
+        if (isfinite(months)) {
+            bc_radio_pub_float("energy/battery-life/months", &months);
+        }
+    }
+}
+
 // event handler for a battery module
 void battery_event_handler(bc_module_battery_event_t event, void *event_param)
 {
@@ -192,25 +281,70 @@ void tmp112_event_handler(bc_tmp112_t *self, bc_tmp112_event_t event, void *even
     }
 }
 
-// start a water pump
-void _start_water_pump(int pump_runtime) {
-    bc_led_pulse(&led, LED_LIGHT_DUR);
-    bc_gpio_set_output(WATER_PUMP_POWER_ID, 1);
-    bc_scheduler_plan_relative(tasks._stop_water_pump_task_id, pump_runtime);
+// queue a dose of water for a zone
+// pump is not started when a reservoir is empty
+bool _start_water_pump(int zone, int pump_runtime) {
+    if (water_float_states.low == WATER_FLOAT_LOW_EMPTY_STATE) {
+        bc_log_debug("Reservoir is empty - water pump will not start");
+        return false;
+    }
+    if (!zone_scheduler_request(zone, pump_runtime)) {
+        bc_log_debug("Water pump of zone %d is already queued or running", zone);
+        return false;
+    }
+    return true;
+}
+
+// stop water pumps of all zones and reset their watering controllers
+void _stop_water_pumps() {
+    zone_scheduler_stop_all();
+    for (int i = 0; i < ZONE_COUNT; i++) {
+        if (watering.zones[i].state != WATERING_STATE_IDLE) {
+            bc_scheduler_plan_absolute(watering.zones[i].soak_task_id, BC_TICK_INFINITY);
+            watering.zones[i].state = WATERING_STATE_IDLE;
+        }
+    }
+}
+
+// event handler for zone scheduler
+// soaking of a zone is timed from the end of its dose
+void zone_event_handler(int zone, zone_scheduler_event_t event, void *event_param)
+{
+    (void) event_param;
+
+    if (event == ZONE_SCHEDULER_EVENT_START) {
+        bc_log_debug("Water pump of zone %d started", zone);
+        bc_led_pulse(&led, LED_LIGHT_DUR);
+    } else if (event == ZONE_SCHEDULER_EVENT_DONE) {
+        bc_log_debug("Water pump of zone %d stopped", zone);
+        if (watering.zones[zone].state == WATERING_STATE_SOAKING) {
+            bc_scheduler_plan_from_now(watering.zones[zone].soak_task_id, watering.soak);
+        }
+        // measure water level after watering
+        bc_scheduler_plan_now(tasks._measure_water_level_task_id);
+    }
 }
 
-// stop a water pump
-void _stop_water_pump() {
-    bc_gpio_set_output(WATER_PUMP_POWER_ID, 0);
+// it is executed from an interrupt on any edge of water float sensors
+// the state is read once it's stable for a debounce time
+void _water_float_exti_handler(bc_exti_line_t line, void *param)
+{
+    (void) line;
+    (void) param;
+
+    bc_scheduler_plan_from_now(tasks._measure_water_level_task_id, WATER_FLOAT_DEBOUNCE_TIME);
 }
 
 // measure level of water with float sensors and published their states
-// in case of a change
+// in case of a change, water pump is stopped when a reservoir gets empty
 void _measure_water_level() {
     int low = bc_gpio_get_input(water_float_ports.low);
     int high = bc_gpio_get_input(water_float_ports.high);
     bc_log_debug("Float state input for sensor IDs: %i (low) - %i, %i (high) - %i",
         water_float_ports.low, low, water_float_ports.high, high);
+    if (low == WATER_FLOAT_LOW_EMPTY_STATE) {
+        _stop_water_pumps();
+    }
     if (low != water_float_states.low) {
         bc_radio_pub_int("water/level/state/low", &low);
     }
@@ -219,7 +353,6 @@ void _measure_water_level() {
     }
     water_float_states.low = low;
     water_float_states.high = high;
-    bc_scheduler_plan_relative(tasks._measure_water_level_task_id, WATER_FLOAT_DELAY);
 }
 
 // it is executed based on a request from MQTT
@@ -238,10 +371,205 @@ void exec_tasks(uint64_t *id, const char *topic, void *value, void *param)
     }
     bc_log_debug("Pump runtime: %i", pump_runtime);
     bc_log_debug("starting a water pump");
-    _start_water_pump(pump_runtime);
-    bc_log_debug("watering finished");
-    // measure water level after watering
-    bc_scheduler_plan_now(tasks._measure_water_level_task_id);
+    _start_water_pump(0, pump_runtime);
+}
+
+// feed a moisture value of a probe to watering controller
+// values measured while water soaks into soil of probe's zone are ignored
+void _watering_update(int index, int moisture)
+{
+    if (index < 0 || index >= WATERING_PROBE_COUNT ||
+            watering.zones[probe_zones[index]].state == WATERING_STATE_SOAKING) {
+        return;
+    }
+    if (!watering.filtered_valid[index]) {
+        watering.filtered[index] = moisture;
+        watering.filtered_valid[index] = true;
+    } else {
+        watering.filtered[index] += (moisture - watering.filtered[index]) / WATERING_FILTER_WEIGHT;
+    }
+}
+
+// decide whether a dose of water is needed for each zone
+// watering starts below low threshold and goes on dose by dose until
+// high threshold is reached (or max number of doses was given)
+void _watering_evaluate()
+{
+    for (int zone = 0; zone < ZONE_COUNT; zone++) {
+        watering_zone_t *z = &watering.zones[zone];
+        int sum = 0;
+        int count = 0;
+
+        if (z->state == WATERING_STATE_SOAKING) {
+            continue;
+        }
+        for (int i = 0; i < WATERING_PROBE_COUNT; i++) {
+            if (probe_zones[i] == zone && watering.filtered_valid[i]) {
+                sum += watering.filtered[i];
+                count++;
+            }
+        }
+        if (count == 0) {
+            continue;
+        }
+        int moisture = sum / count;
+        bc_log_debug("Watering controller of zone %d state: %d, filtered moisture: %d", zone, z->state, moisture);
+
+        if (z->state == WATERING_STATE_IDLE) {
+            if (moisture >= watering.threshold_low) {
+                continue;
+            }
+            z->doses = 0;
+        } else if (moisture >= watering.threshold_high || z->doses >= WATERING_MAX_DOSES) {
+            static char topic[32];
+            snprintf(topic, sizeof(topic), "watering/%d/doses", zone);
+            bc_log_debug("Watering of zone %d finished after %d doses", zone, z->doses);
+            bc_radio_pub_int(topic, &z->doses);
+            z->state = WATERING_STATE_IDLE;
+            continue;
+        }
+        bc_log_debug("Watering of zone %d dose %d: %i ms", zone, z->doses + 1, watering.dose);
+        if (!_start_water_pump(zone, watering.dose)) {
+            z->state = WATERING_STATE_IDLE;
+            continue;
+        }
+        z->doses++;
+        // soak task is planned when the dose is over
+        z->state = WATERING_STATE_SOAKING;
+    }
+}
+
+// water soaked into soil of a zone - request a fresh measurement
+void _watering_soak_task(void *param)
+{
+    watering_zone_t *z = (watering_zone_t *) param;
+
+    z->state = WATERING_STATE_CHECKING;
+#if MODULE_SENSOR
+    bc_soil_sensor_measure(&soil_sensor);
+#else
+    bc_scheduler_plan_now(tasks._measure_moisture_id);
+#endif
+}
+
+// check watering thresholds, low must be below high for hysteresis
+// and both must be within range of moisture
+bool watering_thresholds_valid(int low, int high)
+{
+    return low >= 0 && high <= WATERING_THRESHOLD_MAX && low < high;
+}
+
+// set a watering threshold requested by client
+// param points to the threshold which should be changed
+void watering_set_threshold(uint64_t *id, const char *topic, void *value, void *param)
+{
+    (void) id;
+
+    if (value == NULL) {
+        return;
+    }
+    int threshold = *((int*) value);
+    int low = param == &watering.threshold_low ? threshold : watering.threshold_low;
+    int high = param == &watering.threshold_high ? threshold : watering.threshold_high;
+    if (!watering_thresholds_valid(low, high)) {
+        bc_log_debug("Requested watering threshold is invalid (low must be below high, "
+            "range 0 - %i): %i", WATERING_THRESHOLD_MAX, threshold);
+        return;
+    }
+    *((int*) param) = threshold;
+    bc_log_debug("Watering threshold %s: %i", topic, threshold);
+    watering_settings_save();
+}
+
+// check watering dose (ms)
+bool watering_dose_valid(int dose)
+{
+    return dose >= 1 && dose <= PUMP_RUNTIME * 10;
+}
+
+// set a watering dose (ms) requested by client
+void watering_set_dose(uint64_t *id, const char *topic, void *value, void *param)
+{
+    (void) id;
+    (void) topic;
+    (void) param;
+
+    if (value == NULL) {
+        return;
+    }
+    int dose = *((int*) value);
+    if (!watering_dose_valid(dose)) {
+        bc_log_debug("Requested watering dose is too low (<1) or too high "
+            "(> default_value * 10): %i", dose);
+        return;
+    }
+    watering.dose = dose;
+    bc_log_debug("Watering dose: %i", dose);
+    watering_settings_save();
+}
+
+// check soak interval (ms)
+bool watering_soak_valid(int soak)
+{
+    return soak >= 0;
+}
+
+// set a soak interval (ms) requested by client
+void watering_set_soak(uint64_t *id, const char *topic, void *value, void *param)
+{
+    (void) id;
+    (void) topic;
+    (void) param;
+
+    if (value == NULL) {
+        return;
+    }
+    int soak = *((int*) value);
+    if (!watering_soak_valid(soak)) {
+        bc_log_debug("Requested soak interval is invalid: %i", soak);
+        return;
+    }
+    watering.soak = soak;
+    bc_log_debug("Watering soak interval: %i", soak);
+    watering_settings_save();
+}
+
+// load watering settings saved by client, defaults are kept if nothing is saved
+// saved values are checked like requests of client, invalid ones keep defaults
+void watering_settings_load()
+{
+    int settings[4];
+
+    if (!bc_kv_get(SETTINGS_KEY_WATERING, settings, sizeof(settings))) {
+        return;
+    }
+    if (watering_thresholds_valid(settings[0], settings[1])) {
+        watering.threshold_low = settings[0];
+        watering.threshold_high = settings[1];
+    } else {
+        bc_log_error("Saved watering thresholds are invalid: %i %i", settings[0], settings[1]);
+    }
+    if (watering_dose_valid(settings[2])) {
+        watering.dose = settings[2];
+    } else {
+        bc_log_error("Saved watering dose is invalid: %i", settings[2]);
+    }
+    if (watering_soak_valid(settings[3])) {
+        watering.soak = settings[3];
+    } else {
+        bc_log_error("Saved soak interval is invalid: %i", settings[3]);
+    }
+    bc_log_debug("Watering settings loaded: %i %i %i %i", settings[0], settings[1], settings[2], settings[3]);
+}
+
+// save watering settings, a change appends one short record to EEPROM
+void watering_settings_save()
+{
+    int settings[4] = { watering.threshold_low, watering.threshold_high, watering.dose, watering.soak };
+
+    if (!bc_kv_set(SETTINGS_KEY_WATERING, settings, sizeof(settings))) {
+        bc_log_error("Watering settings save failed");
+    }
 }
 
 #if MODULE_SENSOR
@@ -283,7 +611,7 @@ void exec_tasks(uint64_t *id, const char *topic, void *value, void *param)
                     publish = true;
                 }
 
-                if (publish)
+                if (publish && measurement_log_is_link_up())
                 {
                     snprintf(topic, sizeof(topic), "soil-sensor/%llx/temperature", device_address);
                     // Publish temperature message on radio
@@ -322,12 +650,22 @@ void exec_tasks(uint64_t *id, const char *topic, void *value, void *param)
                     publish = true;
                 }
 
-                if (publish)
+                // radio link is down or publishing failed - keep measurement in a log
+                // it will be uploaded once a gateway acknowledges messages again
+                if (!measurement_log_is_link_up())
+                {
+                    _log_measurement(self, device_address, index, raw_cap_u16);
+                }
+                else if (publish)
                 {
                     snprintf(topic, sizeof(topic), "soil-sensor/%llx/moisture", device_address);
 
                     // Publish sensor moisture message on radio
-                    bc_radio_pub_int(topic, &raw_cap);
+                    if (!bc_radio_pub_int(topic, &raw_cap))
+                    {
+                        measurement_log_set_link(false);
+                        _log_measurement(self, device_address, index, raw_cap_u16);
+                    }
 
                     // Schedule next moisture report
                     sensor_moisture_tick_report[index] = bc_tick_get() + MEASURE_MOISTURE_INTERVAL;
@@ -335,6 +673,14 @@ void exec_tasks(uint64_t *id, const char *topic, void *value, void *param)
                     // Remember last published value
                     sensor_last_published_moisture[index] = raw_cap;
                 }
+
+                _watering_update(index, raw_cap);
+            }
+
+            // all sensors were updated - let watering controller decide
+            if (index + 1 == bc_soil_sensor_get_sensor_found(self))
+            {
+                _watering_evaluate();
             }
         }
         else if (event == BC_SOIL_SENSOR_EVENT_ERROR)
@@ -344,6 +690,16 @@ void exec_tasks(uint64_t *id, const char *topic, void *value, void *param)
         }
     }
 
+    // store a measurement of BC soil moisture sensor to a log
+    void _log_measurement(bc_soil_sensor_t *self, uint64_t device_address, int index, uint16_t raw_cap)
+    {
+        int16_t temperature_raw = 0;
+
+        bc_soil_sensor_get_temperature_raw(self, device_address, &temperature_raw);
+        measurement_log_append(index, raw_cap, temperature_raw);
+        bc_log_debug("Soil sensor ID %llx measurement logged, pending batches: %d", device_address, measurement_log_get_pending());
+    }
+
     // switch from service mode to normal mode for BC soil moisture sensor
     void switch_to_normal_mode_bc_soil_sensor_task(void *param)
     {
@@ -352,26 +708,43 @@ void exec_tasks(uint64_t *id, const char *topic, void *value, void *param)
     }
 #else
     // Functions related to non BigClown moisture sensor
-    // measure moisture and schedule jobs:
-    // - to stop a measurement
-    // - run next a measurement
-    void _measure_moisture() {
-        bc_gpio_set_output(SOIL_MOISTURE_POWER_ID, 1);
-        bc_scheduler_plan_relative(tasks._stop_measuring_moisture_task_id, SOIL_MOISTURE_POWER_ON_INTERVAL);
-        bc_scheduler_plan_relative(tasks._measure_moisture_id, MEASURE_MOISTURE_INTERVAL);
+    // start a measurement of moisture and schedule the next one
+    void _measure_moisture_task(void *param) {
+        (void) param;
+
+        soil_probe_measure();
+        bc_scheduler_plan_current_relative(MEASURE_MOISTURE_INTERVAL);
     }
 
-    // get mositure, publish moisture to MQTT, stop moisture measurement
-    void _stop_measuring_moisture() {
-        static char topic[64];
-        snprintf(topic, sizeof(topic), "soil-sensor/%d/moisture", SOIL_MOISTURE_PORT_ID);
-        bc_log_debug("Publish topic: %s", topic);
-        bc_adc_get_value(SOIL_MOISTURE_PORT_ID, &values.moisture);
+    // event handler for analog soil moisture probe
+    // it feeds watering controller with every value, but publishes moisture
+    // only when it changed significantly or when it's time to report it
+    void soil_probe_event_handler(soil_probe_event_t event, void *event_param) {
+        (void) event_param;
+
+        if (event == SOIL_PROBE_EVENT_ERROR) {
+            int error = 1;
+            static char topic[64];
+            bc_log_error("Soil moisture measurement failed");
+            snprintf(topic, sizeof(topic), "soil-sensor/%d/error", SOIL_MOISTURE_PORT_ID);
+            bc_radio_pub_int(topic, &error);
+            return;
+        }
+        values.moisture = soil_probe_get_value();
         int moisture = values.moisture;
-        // always publish moisture as it's never the same value
-        bc_radio_pub_int(topic, &moisture);
-        // power off port for a soil sensor
-        bc_gpio_set_output(SOIL_MOISTURE_POWER_ID, 0);
-        bc_log_debug("Soil moisture for sensor ID %d: %d", SOIL_MOISTURE_PORT_ID, values.moisture);
+        bc_log_debug("Soil moisture for sensor ID %d: %d, settled in %d us", SOIL_MOISTURE_PORT_ID, moisture,
+            (int) soil_probe_get_settling_time());
+        _watering_update(0, moisture);
+        _watering_evaluate();
+
+        if (bc_tick_get() >= moisture_tick_report ||
+                abs(moisture - last_published_moisture) >= SOIL_MOISTURE_PUB_DIFFERENCE) {
+            static char topic[64];
+            snprintf(topic, sizeof(topic), "soil-sensor/%d/moisture", SOIL_MOISTURE_PORT_ID);
+            bc_log_debug("Publish topic: %s", topic);
+            bc_radio_pub_int(topic, &moisture);
+            moisture_tick_report = bc_tick_get() + SOIL_MOISTURE_PUB_INTERVAL;
+            last_published_moisture = moisture;
+        }
     }
 #endif
\ No newline at end of file
@@ -10,6 +10,9 @@
 #endif
 
 #include <bcl.h>
+#include <measurement_log.h>
+#include <zone_scheduler.h>
+#include <soil_probe.h>
 
 // set to true when you will use sensor module&BigClown soil moisture sensor
 #define MODULE_SENSOR                           true
@@ -21,8 +24,16 @@
 #define BATTERY_UPDATE_INTERVAL                 (60 * 60 * 1000)
 // how often will be moisture measured (ms)
 #define MEASURE_MOISTURE_INTERVAL               (15 * 60 * 1000)
-// how often will be water float checked (ms)
-#define WATER_FLOAT_DELAY                       (15 * 60 * 1000)
+// how long must be water float state stable after an edge to be accepted (ms)
+#define WATER_FLOAT_DEBOUNCE_TIME               100
+// how often will be energy accounting published (ms)
+#define ENERGY_PUB_INTERVAL                     (60 * 60 * 1000)
+// capacity of batteries used for battery life estimate (mAh)
+#define ENERGY_BATTERY_CAPACITY                 1200
+// log every I2C transaction, the log can be replayed on host by sdk/tools/i2c-replay
+#define I2C_TRACE                               false
+// current drawn by one running water pump (uA)
+#define ENERGY_PUMP_CURRENT                     300000
 // how long will led lighting
 #define LED_LIGHT_DUR                           200
 // define default time how long (in miliseconds) pump should run
@@ -39,9 +50,42 @@
 #define SENSOR_UPDATE_NORMAL_INTERVAL           (10 * 60 * 1000)
 // Set variable for water pump GPIO pin
 #define WATER_PUMP_POWER_ID                     BC_GPIO_P17
+// outputs (pumps or valves) of watering zones, zone 0 is the first one
+#define ZONE_OUTPUTS                            { WATER_PUMP_POWER_ID }
+#define ZONE_COUNT                              1
+// how many outputs can run at once - limited by current a supply can give
+#define ZONE_MAX_ACTIVE                         1
 // Set variables for water float sensors for low/high water level
 #define WATER_FLOAT_LOW_POWER_ID                BC_GPIO_P8
 #define WATER_FLOAT_HIGH_POWER_ID               BC_GPIO_P9
+// external interrupt lines of water float sensors
+#define WATER_FLOAT_LOW_EXTI_LINE               BC_EXTI_LINE_P8
+#define WATER_FLOAT_HIGH_EXTI_LINE              BC_EXTI_LINE_P9
+// state of low water float which means the reservoir is empty
+// a water pump will not run in this state
+#define WATER_FLOAT_LOW_EMPTY_STATE             1
+// on-node watering controller, thresholds are in the same units as published
+// moisture (raw capacitance for BigClown soil sensor, ADC value otherwise)
+// thresholds can be overriden by client
+// start watering when filtered moisture drops below this value
+#define WATERING_THRESHOLD_LOW                  2000
+// stop watering when filtered moisture reaches this value
+#define WATERING_THRESHOLD_HIGH                 2400
+// highest threshold accepted from client, moisture is 16-bit in both units
+#define WATERING_THRESHOLD_MAX                  UINT16_MAX
+// how long will pump run for one dose (ms)
+#define WATERING_DOSE                           PUMP_RUNTIME
+// how long to let water soak into soil before moisture is measured again (ms)
+#define WATERING_SOAK_INTERVAL                  (5 * 60 * 1000)
+// max number of doses in one watering cycle - protects plants when a probe fails
+#define WATERING_MAX_DOSES                      5
+// weight of moisture filter - a new value contributes by 1/N
+#define WATERING_FILTER_WEIGHT                  2
+// EEPROM area of settings store, it follows the measurement log
+#define SETTINGS_EEPROM_ADDRESS                 (MEASUREMENT_LOG_EEPROM_ADDRESS + MEASUREMENT_LOG_BATCH_COUNT * MEASUREMENT_LOG_BATCH_WORDS * 4)
+#define SETTINGS_EEPROM_SIZE                    1024
+// key of watering settings in settings store
+#define SETTINGS_KEY_WATERING                   0
 #if MODULE_SENSOR
     // BigClown soil sensor macros
     #define MAX_SOIL_SENSORS                    5
@@ -49,28 +93,74 @@
     // threshold which define difference in moisture
     // if is threshold exceeded moisture will be published
     #define SENSOR_MOISTURE_PUB_DIFFERENCE      1
+    // number of probes used by watering controller
+    #define WATERING_PROBE_COUNT                MAX_SOIL_SENSORS
+    // zone watered according to each probe (index by order of sensors)
+    #define PROBE_ZONES                         { 0, 0, 0, 0, 0 }
     // function definition for BigClown soil sensor
     void soil_sensor_event_handler(bc_soil_sensor_t *self, uint64_t device_address, bc_soil_sensor_event_t event, void *event_param);
     void switch_to_normal_mode_bc_soil_sensor_task(void *param);
+    void _log_measurement(bc_soil_sensor_t *self, uint64_t device_address, int index, uint16_t raw_cap);
 #else
     // set ports for power&analog connections to a soil moisture sensor
     #define SOIL_MOISTURE_PORT_ID               BC_ADC_CHANNEL_A5
     #define SOIL_MOISTURE_POWER_ID              BC_GPIO_P6
+    // longest time the probe is powered before it's measured (ms),
+    // the probe is measured as soon as its output settles
     #define SOIL_MOISTURE_POWER_ON_INTERVAL     25
+    // threshold which define difference in moisture (ADC value)
+    // if is threshold exceeded moisture will be published
+    #define SOIL_MOISTURE_PUB_DIFFERENCE        256
+    // how often will be moisture published when it doesn't change (ms)
+    #define SOIL_MOISTURE_PUB_INTERVAL          (60 * 60 * 1000)
+    // number of probes used by watering controller
+    #define WATERING_PROBE_COUNT                1
+    // zone watered according to the probe
+    #define PROBE_ZONES                         { 0 }
     // function definition
-    void _measure_moisture();
-    void _stop_measuring_moisture();
+    void _measure_moisture_task(void *param);
+    void soil_probe_event_handler(soil_probe_event_t event, void *event_param);
 #endif
 
 // structre for all tasks
 struct {
     bc_scheduler_task_id_t _measure_moisture_id;
-    bc_scheduler_task_id_t _stop_measuring_moisture_task_id;
-    bc_scheduler_task_id_t _start_water_pump_task_id;
-    bc_scheduler_task_id_t _stop_water_pump_task_id;
     bc_scheduler_task_id_t _measure_water_level_task_id;
 } tasks;
 
+// states of watering controller
+typedef enum {
+    // moisture is watched, pump is off
+    WATERING_STATE_IDLE = 0,
+    // dose was given, waiting for water to soak in
+    WATERING_STATE_SOAKING = 1,
+    // soaking is over, waiting for a fresh measurement
+    WATERING_STATE_CHECKING = 2
+} watering_state_t;
+
+// structure for watering controller of a zone
+typedef struct {
+    watering_state_t state;
+    int doses;
+    bc_scheduler_task_id_t soak_task_id;
+} watering_zone_t;
+
+// structure for watering controller
+struct {
+    int threshold_low;
+    int threshold_high;
+    int dose;
+    int soak;
+    bool filtered_valid[WATERING_PROBE_COUNT];
+    int filtered[WATERING_PROBE_COUNT];
+    watering_zone_t zones[ZONE_COUNT];
+} watering = {
+    .threshold_low = WATERING_THRESHOLD_LOW,
+    .threshold_high = WATERING_THRESHOLD_HIGH,
+    .dose = WATERING_DOSE,
+    .soak = WATERING_SOAK_INTERVAL
+};
+
 // structure for water float ports
 struct {
     int low;
@@ -92,8 +182,24 @@ struct {
 
 // function definition
 void _measure_water_level();
-void _start_water_pump();
-void _stop_water_pump();
+void _water_float_exti_handler(bc_exti_line_t line, void *param);
+bool _start_water_pump(int zone, int pump_runtime);
+void _stop_water_pumps();
+void zone_event_handler(int zone, zone_scheduler_event_t event, void *event_param);
+void _watering_update(int index, int moisture);
+void _watering_evaluate();
+void _watering_soak_task(void *param);
+bool watering_thresholds_valid(int low, int high);
+bool watering_dose_valid(int dose);
+bool watering_soak_valid(int soak);
+void watering_set_threshold(uint64_t *id, const char *topic, void *value, void *param);
+void watering_set_dose(uint64_t *id, const char *topic, void *value, void *param);
+void watering_set_soak(uint64_t *id, const char *topic, void *value, void *param);
+void watering_settings_load();
+void watering_settings_save();
+void radio_event_handler(bc_radio_event_t event, void *event_param);
+void energy_event_handler(bc_energy_event_t event, void *event_param);
+void i2c_trace_handler(const bc_i2c_trace_t *trace, void *trace_param);
 void battery_event_handler(bc_module_battery_event_t event, void *event_param);
 void button_event_handler(bc_button_t *self, bc_button_event_t event, void *event_param);
 void exec_tasks(uint64_t *id, const char *topic, void *value, void *param);
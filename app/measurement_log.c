@@ -0,0 +1,317 @@
+#include <measurement_log.h>
+
+#define _MEASUREMENT_LOG_BATCH_SIZE             (MEASUREMENT_LOG_BATCH_WORDS * sizeof(uint32_t))
+#define _MEASUREMENT_LOG_UPLOADED               0x80000000UL
+#define _MEASUREMENT_LOG_TYPE_ABSOLUTE          0x40000000UL
+#define _MEASUREMENT_LOG_TYPE_DELTA             0x80000000UL
+#define _MEASUREMENT_LOG_TYPE_TIME              0xc0000000UL
+#define _MEASUREMENT_LOG_SEQUENCE_MASK          0x3fffffffUL
+// how often will be upload of the log retried while link is down (ms)
+#define _MEASUREMENT_LOG_RETRY_INTERVAL         (5 * 60 * 1000)
+
+static struct
+{
+    // RAM batch which is being filled
+    uint32_t batch[MEASUREMENT_LOG_BATCH_WORDS];
+    int length;
+    uint32_t time;
+    bool reference[MEASUREMENT_LOG_PROBE_COUNT];
+    uint16_t capacitance[MEASUREMENT_LOG_PROBE_COUNT];
+    int16_t temperature[MEASUREMENT_LOG_PROBE_COUNT];
+
+    // EEPROM ring, pending batches are from tail to head
+    int head;
+    int tail;
+    uint32_t sequence;
+
+    bool link;
+    bool in_flight;
+    bool in_flight_failed;
+    bc_scheduler_task_id_t upload_task_id;
+
+} _measurement_log;
+
+static void _measurement_log_upload_task(void *param);
+static uint32_t _measurement_log_address(int batch);
+static uint32_t _measurement_log_read_header(int batch);
+static uint32_t _measurement_log_read_sequence(int batch);
+static void _measurement_log_start_batch(uint32_t timestamp);
+
+void measurement_log_init(void)
+{
+    uint32_t newest_sequence = 0;
+    int newest = -1;
+
+    memset(&_measurement_log, 0, sizeof(_measurement_log));
+
+    _measurement_log.link = true;
+    _measurement_log.sequence = 1;
+
+    // the newest batch is the one with the highest sequence number, timestamps
+    // are not used as RTC may be reset
+    for (int i = 0; i < MEASUREMENT_LOG_BATCH_COUNT; i++)
+    {
+        uint32_t sequence = _measurement_log_read_sequence(i);
+
+        if (sequence != 0 && sequence >= newest_sequence)
+        {
+            newest_sequence = sequence;
+            newest = i;
+        }
+    }
+
+    if (newest >= 0)
+    {
+        // continue behind the newest batch, so cells are worn evenly
+        _measurement_log.head = (newest + 1) % MEASUREMENT_LOG_BATCH_COUNT;
+        _measurement_log.tail = _measurement_log.head;
+        _measurement_log.sequence = newest_sequence < _MEASUREMENT_LOG_SEQUENCE_MASK ? newest_sequence + 1 : 1;
+
+        // pending batches precede the newest one, each one has sequence number lower by one
+        for (int i = 0; i < MEASUREMENT_LOG_BATCH_COUNT - 1; i++)
+        {
+            int batch = (_measurement_log.tail + MEASUREMENT_LOG_BATCH_COUNT - 1) % MEASUREMENT_LOG_BATCH_COUNT;
+            uint32_t header = _measurement_log_read_header(batch);
+            uint32_t sequence = _measurement_log_read_sequence(batch);
+
+            if (sequence == 0 || sequence != newest_sequence - i || (header & _MEASUREMENT_LOG_UPLOADED) != 0)
+            {
+                break;
+            }
+
+            _measurement_log.tail = batch;
+        }
+    }
+
+    _measurement_log.upload_task_id = bc_scheduler_register(_measurement_log_upload_task, NULL, BC_TICK_INFINITY);
+
+    if (measurement_log_get_pending() > 0)
+    {
+        bc_scheduler_plan_now(_measurement_log.upload_task_id);
+    }
+}
+
+void measurement_log_append(int probe, uint16_t capacitance, int16_t temperature)
+{
+    bc_rtc_t rtc;
+
+    if (probe < 0 || probe >= MEASUREMENT_LOG_PROBE_COUNT)
+    {
+        return;
+    }
+
+    bc_rtc_get_date_time(&rtc);
+
+    if (_measurement_log.length == 0)
+    {
+        _measurement_log_start_batch(rtc.timestamp);
+    }
+
+    uint32_t dt = rtc.timestamp - _measurement_log.time;
+    int dcap = (int) capacitance - _measurement_log.capacitance[probe];
+    int dtemp = (int) temperature - _measurement_log.temperature[probe];
+
+    if (_measurement_log.reference[probe] && dt < 0x800 && dcap >= -256 && dcap <= 255 && dtemp >= -64 && dtemp <= 63)
+    {
+        if (_measurement_log.length == MEASUREMENT_LOG_BATCH_WORDS)
+        {
+            measurement_log_flush();
+
+            measurement_log_append(probe, capacitance, temperature);
+
+            return;
+        }
+
+        _measurement_log.batch[_measurement_log.length++] = _MEASUREMENT_LOG_TYPE_DELTA | (uint32_t) probe << 27 |
+                dt << 16 | ((uint32_t) dcap & 0x1ff) << 7 | ((uint32_t) dtemp & 0x7f);
+    }
+    else
+    {
+        uint32_t offset = rtc.timestamp - _measurement_log.batch[0];
+        int words = offset != 0 ? 2 : 1;
+
+        if (_measurement_log.length + words > MEASUREMENT_LOG_BATCH_WORDS || offset > 0x3fffffff)
+        {
+            measurement_log_flush();
+
+            measurement_log_append(probe, capacitance, temperature);
+
+            return;
+        }
+
+        if (offset != 0)
+        {
+            _measurement_log.batch[_measurement_log.length++] = _MEASUREMENT_LOG_TYPE_TIME | (offset & 0x3fffffff);
+        }
+
+        _measurement_log.batch[_measurement_log.length++] = _MEASUREMENT_LOG_TYPE_ABSOLUTE | (uint32_t) probe << 27 |
+                ((uint32_t) capacitance & 0x3fff) << 13 | ((uint32_t) temperature & 0xfff);
+    }
+
+    _measurement_log.time = rtc.timestamp;
+    _measurement_log.reference[probe] = true;
+    _measurement_log.capacitance[probe] = capacitance;
+    _measurement_log.temperature[probe] = temperature;
+
+    if (_measurement_log.length == MEASUREMENT_LOG_BATCH_WORDS)
+    {
+        measurement_log_flush();
+    }
+}
+
+void measurement_log_flush(void)
+{
+    if (_measurement_log.length == 0)
+    {
+        return;
+    }
+
+    // whole batch is written at once, so EEPROM is programmed by words
+    if (!bc_eeprom_write(_measurement_log_address(_measurement_log.head), _measurement_log.batch, _MEASUREMENT_LOG_BATCH_SIZE))
+    {
+        bc_log_error("Measurement log write failed");
+    }
+
+    _measurement_log.head = (_measurement_log.head + 1) % MEASUREMENT_LOG_BATCH_COUNT;
+
+    // 0 is never used, it marks a blank batch
+    _measurement_log.sequence = _measurement_log.sequence < _MEASUREMENT_LOG_SEQUENCE_MASK ? _measurement_log.sequence + 1 : 1;
+
+    // ring is full - the oldest batch is dropped
+    if (_measurement_log.head == _measurement_log.tail)
+    {
+        if (_measurement_log.in_flight)
+        {
+            _measurement_log.in_flight_failed = true;
+        }
+
+        _measurement_log.tail = (_measurement_log.tail + 1) % MEASUREMENT_LOG_BATCH_COUNT;
+    }
+
+    _measurement_log.length = 0;
+
+    bc_scheduler_plan_now(_measurement_log.upload_task_id);
+}
+
+int measurement_log_get_pending(void)
+{
+    return (_measurement_log.head + MEASUREMENT_LOG_BATCH_COUNT - _measurement_log.tail) % MEASUREMENT_LOG_BATCH_COUNT;
+}
+
+void measurement_log_set_link(bool up)
+{
+    if (up && !_measurement_log.link)
+    {
+        measurement_log_flush();
+
+        bc_scheduler_plan_now(_measurement_log.upload_task_id);
+    }
+
+    _measurement_log.link = up;
+}
+
+bool measurement_log_is_link_up(void)
+{
+    return _measurement_log.link;
+}
+
+void measurement_log_radio_event(bc_radio_event_t event)
+{
+    if (event == BC_RADIO_EVENT_TX_DONE)
+    {
+        measurement_log_set_link(true);
+    }
+    else if (event == BC_RADIO_EVENT_TX_ERROR)
+    {
+        measurement_log_set_link(false);
+
+        _measurement_log.in_flight_failed = true;
+    }
+    else
+    {
+        return;
+    }
+
+    // frame is confirmed once the queue is empty and nothing failed meanwhile
+    if (_measurement_log.in_flight && bc_radio_is_pub_queue_empty())
+    {
+        _measurement_log.in_flight = false;
+
+        if (!_measurement_log.in_flight_failed)
+        {
+            uint32_t header = _measurement_log_read_header(_measurement_log.tail) | _MEASUREMENT_LOG_UPLOADED;
+
+            bc_eeprom_write(_measurement_log_address(_measurement_log.tail), &header, sizeof(header));
+
+            _measurement_log.tail = (_measurement_log.tail + 1) % MEASUREMENT_LOG_BATCH_COUNT;
+
+            bc_scheduler_plan_now(_measurement_log.upload_task_id);
+        }
+        else
+        {
+            bc_scheduler_plan_from_now(_measurement_log.upload_task_id, _MEASUREMENT_LOG_RETRY_INTERVAL);
+        }
+    }
+}
+
+static void _measurement_log_upload_task(void *param)
+{
+    (void) param;
+
+    uint8_t frame[1 + _MEASUREMENT_LOG_BATCH_SIZE];
+
+    if (_measurement_log.in_flight || measurement_log_get_pending() == 0)
+    {
+        return;
+    }
+
+    frame[0] = MEASUREMENT_LOG_FRAME_VERSION;
+
+    bc_eeprom_read(_measurement_log_address(_measurement_log.tail), frame + 1, _MEASUREMENT_LOG_BATCH_SIZE);
+
+    // a frame is sent even when link is down - it works as a probe of the link
+    if (!bc_radio_pub_buffer(frame, sizeof(frame)))
+    {
+        bc_scheduler_plan_current_relative(_MEASUREMENT_LOG_RETRY_INTERVAL);
+
+        return;
+    }
+
+    _measurement_log.in_flight = true;
+    _measurement_log.in_flight_failed = false;
+}
+
+static uint32_t _measurement_log_address(int batch)
+{
+    return MEASUREMENT_LOG_EEPROM_ADDRESS + batch * _MEASUREMENT_LOG_BATCH_SIZE;
+}
+
+static uint32_t _measurement_log_read_header(int batch)
+{
+    uint32_t header;
+
+    bc_eeprom_read(_measurement_log_address(batch), &header, sizeof(header));
+
+    return header;
+}
+
+// get sequence number of batch, 0 if batch is blank or its format is unknown
+static uint32_t _measurement_log_read_sequence(int batch)
+{
+    uint32_t sequence;
+
+    bc_eeprom_read(_measurement_log_address(batch) + sizeof(uint32_t), &sequence, sizeof(sequence));
+
+    return (sequence & ~_MEASUREMENT_LOG_SEQUENCE_MASK) == 0 ? sequence : 0;
+}
+
+static void _measurement_log_start_batch(uint32_t timestamp)
+{
+    memset(_measurement_log.batch, 0, sizeof(_measurement_log.batch));
+    memset(_measurement_log.reference, 0, sizeof(_measurement_log.reference));
+
+    _measurement_log.batch[0] = timestamp & ~_MEASUREMENT_LOG_UPLOADED;
+    _measurement_log.batch[1] = _measurement_log.sequence;
+    _measurement_log.length = 2;
+    _measurement_log.time = timestamp;
+}
@@ -0,0 +1,66 @@
+#ifndef _MEASUREMENT_LOG_H
+#define _MEASUREMENT_LOG_H
+
+#include <bcl.h>
+
+// Store-and-forward log of soil measurements kept in MCU EEPROM
+//
+// Readings are collected into a batch in RAM and the batch is written to
+// a ring in EEPROM at once (whole words only) when it is full or when
+// the link comes back. Every batch is self-contained and it's uploaded
+// as one radio frame, so a gateway receives several readings per frame.
+//
+// Batch layout (MEASUREMENT_LOG_BATCH_WORDS 32-bit little endian words):
+// - word 0: RTC timestamp of the first record (bit 31 is set once uploaded)
+// - word 1: sequence number of the batch (29..0, bits 31..30 are 0), it's
+//   increased by every batch, so the newest batch is found after power up
+//   even when RTC was reset meanwhile
+// - words 2..: records, an unused word is 0
+//
+// Records:
+// - absolute (bits 31..30 = 01): probe (29..27), capacitance (26..13),
+//   temperature in 1/16 deg C (11..0, signed)
+// - delta (bits 31..30 = 10): probe (29..27), seconds from previous record
+//   (26..16), capacitance delta (15..7, signed), temperature delta (6..0, signed)
+// - time (bits 31..30 = 11): seconds from batch timestamp (29..0) for
+//   the following absolute record
+
+// start address of the log in EEPROM
+#ifndef MEASUREMENT_LOG_EEPROM_ADDRESS
+#define MEASUREMENT_LOG_EEPROM_ADDRESS          0
+#endif
+// number of batches in EEPROM ring
+#ifndef MEASUREMENT_LOG_BATCH_COUNT
+#define MEASUREMENT_LOG_BATCH_COUNT             64
+#endif
+// number of words in a batch, a batch must fit into one radio frame
+#define MEASUREMENT_LOG_BATCH_WORDS             8
+// number of probes which can be logged
+#define MEASUREMENT_LOG_PROBE_COUNT             8
+// first byte of an uploaded frame, identifies format of the log
+#define MEASUREMENT_LOG_FRAME_VERSION           0x02
+
+// initialize the log and find pending batches in EEPROM
+void measurement_log_init(void);
+
+// append a reading of a probe to the log
+// temperature is in 1/16 deg C
+void measurement_log_append(int probe, uint16_t capacitance, int16_t temperature);
+
+// write a partially filled batch to EEPROM
+void measurement_log_flush(void);
+
+// get number of batches waiting for upload
+int measurement_log_get_pending(void);
+
+// tell the log whether radio link works, the log is uploaded frame by frame
+// while the link is up
+void measurement_log_set_link(bool up);
+
+// check whether radio link is up
+bool measurement_log_is_link_up(void);
+
+// it should be called on BC_RADIO_EVENT_TX_DONE and BC_RADIO_EVENT_TX_ERROR
+void measurement_log_radio_event(bc_radio_event_t event);
+
+#endif // _MEASUREMENT_LOG_H
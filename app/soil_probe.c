@@ -0,0 +1,214 @@
+#include <soil_probe.h>
+
+// interval of retry when ADC is busy with another conversion (ms)
+#define _SOIL_PROBE_RETRY_INTERVAL              10
+// limit of power_on_max, the settling is timed by 16-bit microsecond timer (ms)
+#define _SOIL_PROBE_POWER_ON_LIMIT              60
+
+static struct
+{
+    bc_adc_channel_t channel;
+    bc_gpio_channel_t power;
+    bc_tick_t power_on_max;
+
+    bool measuring;
+    bc_tick_t tick_power_on;
+
+    uint16_t value;
+    uint32_t settling_time;
+    uint32_t settling_estimate;
+
+    bc_scheduler_task_id_t task_id;
+    void (*event_handler)(soil_probe_event_t, void *);
+    void *event_param;
+
+} _soil_probe;
+
+static void _soil_probe_task(void *param);
+static bool _soil_probe_burst(void);
+static void _soil_probe_done(soil_probe_event_t event);
+
+void soil_probe_init(bc_adc_channel_t channel, bc_gpio_channel_t power, bc_tick_t power_on_max)
+{
+    memset(&_soil_probe, 0, sizeof(_soil_probe));
+
+    _soil_probe.channel = channel;
+    _soil_probe.power = power;
+    _soil_probe.power_on_max = power_on_max < _SOIL_PROBE_POWER_ON_LIMIT ? power_on_max : _SOIL_PROBE_POWER_ON_LIMIT;
+    _soil_probe.settling_estimate = _soil_probe.power_on_max * 1000;
+
+    bc_gpio_init(power);
+    bc_gpio_set_output(power, 0);
+    bc_gpio_set_mode(power, BC_GPIO_MODE_OUTPUT);
+
+    bc_adc_init();
+
+    bc_timer_init();
+
+    _soil_probe.task_id = bc_scheduler_register(_soil_probe_task, NULL, BC_TICK_INFINITY);
+}
+
+void soil_probe_set_event_handler(void (*event_handler)(soil_probe_event_t, void *), void *event_param)
+{
+    _soil_probe.event_handler = event_handler;
+    _soil_probe.event_param = event_param;
+}
+
+bool soil_probe_measure(void)
+{
+    if (_soil_probe.measuring)
+    {
+        return false;
+    }
+
+    _soil_probe.measuring = true;
+    _soil_probe.tick_power_on = bc_tick_get();
+
+    bc_gpio_set_output(_soil_probe.power, 1);
+
+    // sleep until the probe is close to settled, tick is at most one step
+    // behind real power on, so the task doesn't run later than this
+    bc_tick_t wait = 0;
+
+    if (_soil_probe.settling_estimate > SOIL_PROBE_SETTLE_MARGIN)
+    {
+        wait = (_soil_probe.settling_estimate - SOIL_PROBE_SETTLE_MARGIN) / 1000;
+    }
+
+    bc_scheduler_plan_absolute(_soil_probe.task_id, _soil_probe.tick_power_on + wait);
+
+    return true;
+}
+
+uint16_t soil_probe_get_value(void)
+{
+    return _soil_probe.value;
+}
+
+uint32_t soil_probe_get_settling_time(void)
+{
+    return _soil_probe.settling_time;
+}
+
+static void _soil_probe_task(void *param)
+{
+    (void) param;
+
+    uint16_t sample;
+    bc_tick_t elapsed = bc_tick_get() - _soil_probe.tick_power_on;
+
+    // ADC is busy with another conversion, try again
+    if (!bc_adc_get_value(_soil_probe.channel, &sample))
+    {
+        if (elapsed >= 2 * _soil_probe.power_on_max)
+        {
+            _soil_probe_done(SOIL_PROBE_EVENT_ERROR);
+
+            return;
+        }
+
+        bc_scheduler_plan_current_from_now(_SOIL_PROBE_RETRY_INTERVAL);
+
+        return;
+    }
+
+    // time the probe may still settle, the probe waited for a busy ADC meanwhile
+    uint16_t limit = elapsed < _soil_probe.power_on_max ? (_soil_probe.power_on_max - elapsed) * 1000 : 0;
+    uint16_t previous;
+    int stable = 0;
+
+    // timer counts microseconds from HSI16 (MSI would make it about 1.4 us per count)
+    bc_system_hsi16_enable();
+
+    bc_timer_start();
+
+    while (stable < SOIL_PROBE_SETTLE_COUNT && bc_timer_get_microseconds() < limit)
+    {
+        previous = sample;
+
+        bc_timer_delay(SOIL_PROBE_SETTLE_INTERVAL);
+
+        if (!bc_adc_get_value(_soil_probe.channel, &sample))
+        {
+            bc_timer_stop();
+
+            bc_system_hsi16_disable();
+
+            _soil_probe_done(SOIL_PROBE_EVENT_ERROR);
+
+            return;
+        }
+
+        if (abs(sample - previous) <= SOIL_PROBE_SETTLE_TOLERANCE)
+        {
+            stable++;
+        }
+        else
+        {
+            stable = 0;
+        }
+    }
+
+    _soil_probe.settling_time = elapsed * 1000 + bc_timer_get_microseconds();
+    _soil_probe.settling_estimate = _soil_probe.settling_time;
+
+    bc_timer_stop();
+
+    bc_system_hsi16_disable();
+
+    _soil_probe_done(_soil_probe_burst() ? SOIL_PROBE_EVENT_UPDATE : SOIL_PROBE_EVENT_ERROR);
+}
+
+// convert burst of samples and compute their trimmed mean
+static bool _soil_probe_burst(void)
+{
+    uint16_t samples[SOIL_PROBE_BURST];
+
+    for (int i = 0; i < SOIL_PROBE_BURST; i++)
+    {
+        if (!bc_adc_get_value(_soil_probe.channel, &samples[i]))
+        {
+            return false;
+        }
+    }
+
+    // insertion sort, the burst is short
+    for (int i = 1; i < SOIL_PROBE_BURST; i++)
+    {
+        uint16_t sample = samples[i];
+        int j = i;
+
+        for (; j > 0 && samples[j - 1] > sample; j--)
+        {
+            samples[j] = samples[j - 1];
+        }
+
+        samples[j] = sample;
+    }
+
+    uint32_t sum = 0;
+
+    for (int i = SOIL_PROBE_TRIM; i < SOIL_PROBE_BURST - SOIL_PROBE_TRIM; i++)
+    {
+        sum += samples[i];
+    }
+
+    // rounded to nearest
+    int count = SOIL_PROBE_BURST - 2 * SOIL_PROBE_TRIM;
+
+    _soil_probe.value = (sum + count / 2) / count;
+
+    return true;
+}
+
+static void _soil_probe_done(soil_probe_event_t event)
+{
+    bc_gpio_set_output(_soil_probe.power, 0);
+
+    _soil_probe.measuring = false;
+
+    if (_soil_probe.event_handler != NULL)
+    {
+        _soil_probe.event_handler(event, _soil_probe.event_param);
+    }
+}
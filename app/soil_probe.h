@@ -0,0 +1,68 @@
+#ifndef _SOIL_PROBE_H
+#define _SOIL_PROBE_H
+
+#include <bcl.h>
+
+// Analog soil moisture probe
+//
+// The probe is powered from a GPIO only while it's measured. After power
+// on its output is converted every SOIL_PROBE_SETTLE_INTERVAL until
+// consecutive samples stop moving (or the longest power-on interval is
+// over), so the probe is powered just as long as it really needs to
+// settle. bc_tick advances in 10 ms steps, which is too coarse for this,
+// so the settling is polled by bc_timer (microseconds) in one task run
+// and the CPU doesn't sleep meanwhile. To keep that short, the settling
+// time of the last measurement is the estimate for the next one: the task
+// is planned by the scheduler (the CPU sleeps) until SOIL_PROBE_SETTLE_MARGIN
+// before the estimate and only the rest is polled. The first measurement
+// takes power_on_max as the estimate. The probe settles at least one
+// interval after polling starts, so an estimate which is too long gets
+// shorter with every measurement by about the margin. Then a burst of
+// samples is converted at once and the probe is switched off. Samples are
+// sorted and the ones at both ends are dropped before averaging, so spikes
+// don't get into the result (SOIL_PROBE_TRIM of (SOIL_PROBE_BURST - 1) / 2
+// gives median).
+//
+// The probe is ratiometric (powered from the same supply as ADC), so raw
+// ADC values are used and VDDA correction is not needed.
+
+// number of samples of one measurement
+#define SOIL_PROBE_BURST                        16
+// number of samples dropped at each end of sorted burst
+#define SOIL_PROBE_TRIM                         4
+// probe is settled when consecutive samples differ by this value at most
+// (ADC value, 16 is one step of 12-bit conversion)
+#define SOIL_PROBE_SETTLE_TOLERANCE             32
+// number of consecutive samples within tolerance which mean settled probe
+#define SOIL_PROBE_SETTLE_COUNT                 2
+// interval between samples while the probe settles (us)
+#define SOIL_PROBE_SETTLE_INTERVAL              1000
+// settling is polled from this time before the estimate (us)
+#define SOIL_PROBE_SETTLE_MARGIN                5000
+
+// events of soil probe
+typedef enum {
+    // measurement is done, value can be read
+    SOIL_PROBE_EVENT_UPDATE = 0,
+    // ADC was not available, probe was switched off without a value
+    SOIL_PROBE_EVENT_ERROR = 1
+} soil_probe_event_t;
+
+// initialize probe on ADC channel powered by GPIO, power_on_max is the
+// longest time (ms) the probe may take to settle, 60 ms at most
+void soil_probe_init(bc_adc_channel_t channel, bc_gpio_channel_t power, bc_tick_t power_on_max);
+
+// set callback function, it is called from a scheduler task
+void soil_probe_set_event_handler(void (*event_handler)(soil_probe_event_t, void *), void *event_param);
+
+// power the probe and start a measurement
+// returns false when a measurement is in progress
+bool soil_probe_measure(void);
+
+// get result of the last measurement (ADC value)
+uint16_t soil_probe_get_value(void);
+
+// get time (us) the probe took to settle in the last measurement
+uint32_t soil_probe_get_settling_time(void);
+
+#endif // _SOIL_PROBE_H
@@ -0,0 +1,271 @@
+#include <zone_scheduler.h>
+
+// alarm closer than this is handled right away (LPTIM1 ticks)
+#define _ZONE_SCHEDULER_MIN_REMAINING           2
+
+typedef enum {
+    _ZONE_SCHEDULER_STATE_IDLE = 0,
+    _ZONE_SCHEDULER_STATE_QUEUED = 1,
+    _ZONE_SCHEDULER_STATE_RUNNING = 2,
+    _ZONE_SCHEDULER_STATE_DONE = 3
+} _zone_scheduler_state_t;
+
+static struct
+{
+    struct
+    {
+        bc_gpio_channel_t output;
+        volatile _zone_scheduler_state_t state;
+        uint16_t start;
+        uint16_t duration;
+
+    } zone[ZONE_SCHEDULER_MAX_ZONES];
+
+    int count;
+    int max_active;
+    volatile int active;
+
+    // queued zones in order of requests
+    int queue[ZONE_SCHEDULER_MAX_ZONES];
+    int queue_length;
+
+    bc_tick_t tick_next_start;
+    bc_scheduler_task_id_t task_id;
+    void (*event_handler)(int, zone_scheduler_event_t, void *);
+    void *event_param;
+
+} _zone_scheduler;
+
+static void _zone_scheduler_task(void *param);
+static void _zone_scheduler_alarm(void *param);
+static void _zone_scheduler_plan_alarm(void);
+
+void zone_scheduler_init(const bc_gpio_channel_t *outputs, int count, int max_active)
+{
+    memset(&_zone_scheduler, 0, sizeof(_zone_scheduler));
+
+    if (count > ZONE_SCHEDULER_MAX_ZONES)
+    {
+        count = ZONE_SCHEDULER_MAX_ZONES;
+    }
+
+    _zone_scheduler.count = count;
+    _zone_scheduler.max_active = max_active < 1 ? 1 : max_active;
+
+    for (int i = 0; i < count; i++)
+    {
+        _zone_scheduler.zone[i].output = outputs[i];
+
+        bc_gpio_init(outputs[i]);
+        bc_gpio_set_output(outputs[i], 0);
+        bc_gpio_set_mode(outputs[i], BC_GPIO_MODE_OUTPUT);
+    }
+
+    bc_lptim_init();
+
+    _zone_scheduler.task_id = bc_scheduler_register(_zone_scheduler_task, NULL, BC_TICK_INFINITY);
+}
+
+void zone_scheduler_set_event_handler(void (*event_handler)(int, zone_scheduler_event_t, void *), void *event_param)
+{
+    _zone_scheduler.event_handler = event_handler;
+    _zone_scheduler.event_param = event_param;
+}
+
+bool zone_scheduler_request(int zone, int duration)
+{
+    if (zone < 0 || zone >= _zone_scheduler.count || zone_scheduler_is_busy(zone))
+    {
+        return false;
+    }
+
+    if (duration > ZONE_SCHEDULER_MAX_DURATION)
+    {
+        duration = ZONE_SCHEDULER_MAX_DURATION;
+    }
+
+    _zone_scheduler.zone[zone].duration = bc_lptim_ms_to_ticks(duration);
+    _zone_scheduler.zone[zone].state = _ZONE_SCHEDULER_STATE_QUEUED;
+
+    _zone_scheduler.queue[_zone_scheduler.queue_length++] = zone;
+
+    bc_scheduler_plan_now(_zone_scheduler.task_id);
+
+    return true;
+}
+
+void zone_scheduler_stop_all(void)
+{
+    bc_irq_disable();
+
+    bc_lptim_clear_alarm();
+
+    for (int i = 0; i < _zone_scheduler.count; i++)
+    {
+        bc_gpio_set_output(_zone_scheduler.zone[i].output, 0);
+
+        if (_zone_scheduler.zone[i].state == _ZONE_SCHEDULER_STATE_RUNNING)
+        {
+            _zone_scheduler.zone[i].state = _ZONE_SCHEDULER_STATE_DONE;
+        }
+        else if (_zone_scheduler.zone[i].state == _ZONE_SCHEDULER_STATE_QUEUED)
+        {
+            _zone_scheduler.zone[i].state = _ZONE_SCHEDULER_STATE_IDLE;
+        }
+    }
+
+    _zone_scheduler.active = 0;
+    _zone_scheduler.queue_length = 0;
+
+    bc_energy_set_count(ZONE_SCHEDULER_ENERGY_SUBSYSTEM, 0);
+
+    bc_irq_enable();
+
+    bc_scheduler_plan_now(_zone_scheduler.task_id);
+}
+
+bool zone_scheduler_is_busy(int zone)
+{
+    if (zone < 0 || zone >= _zone_scheduler.count)
+    {
+        return false;
+    }
+
+    return _zone_scheduler.zone[zone].state != _ZONE_SCHEDULER_STATE_IDLE;
+}
+
+int zone_scheduler_get_active(void)
+{
+    return _zone_scheduler.active;
+}
+
+static void _zone_scheduler_task(void *param)
+{
+    (void) param;
+
+    // report finished doses
+    for (int i = 0; i < _zone_scheduler.count; i++)
+    {
+        if (_zone_scheduler.zone[i].state == _ZONE_SCHEDULER_STATE_DONE)
+        {
+            _zone_scheduler.zone[i].state = _ZONE_SCHEDULER_STATE_IDLE;
+
+            if (_zone_scheduler.event_handler != NULL)
+            {
+                _zone_scheduler.event_handler(i, ZONE_SCHEDULER_EVENT_DONE, _zone_scheduler.event_param);
+            }
+        }
+    }
+
+    if (_zone_scheduler.queue_length == 0 || _zone_scheduler.active >= _zone_scheduler.max_active)
+    {
+        return;
+    }
+
+    // space out starts of outputs
+    if (bc_tick_get() < _zone_scheduler.tick_next_start)
+    {
+        bc_scheduler_plan_current_absolute(_zone_scheduler.tick_next_start);
+
+        return;
+    }
+
+    // inrush current of output would drop supply voltage of transmitting radio
+    if (bc_spirit1_is_tx())
+    {
+        bc_scheduler_plan_current_from_now(ZONE_SCHEDULER_RADIO_INTERVAL);
+
+        return;
+    }
+
+    int zone = _zone_scheduler.queue[0];
+
+    _zone_scheduler.queue_length--;
+
+    memmove(_zone_scheduler.queue, _zone_scheduler.queue + 1, _zone_scheduler.queue_length * sizeof(_zone_scheduler.queue[0]));
+
+    bc_irq_disable();
+
+    _zone_scheduler.zone[zone].start = bc_lptim_get_counter();
+    _zone_scheduler.zone[zone].state = _ZONE_SCHEDULER_STATE_RUNNING;
+    _zone_scheduler.active++;
+
+    bc_gpio_set_output(_zone_scheduler.zone[zone].output, 1);
+
+    bc_energy_set_count(ZONE_SCHEDULER_ENERGY_SUBSYSTEM, _zone_scheduler.active);
+
+    _zone_scheduler_plan_alarm();
+
+    bc_irq_enable();
+
+    _zone_scheduler.tick_next_start = bc_tick_get() + ZONE_SCHEDULER_START_INTERVAL;
+
+    if (_zone_scheduler.event_handler != NULL)
+    {
+        _zone_scheduler.event_handler(zone, ZONE_SCHEDULER_EVENT_START, _zone_scheduler.event_param);
+    }
+
+    if (_zone_scheduler.queue_length != 0)
+    {
+        bc_scheduler_plan_current_absolute(_zone_scheduler.tick_next_start);
+    }
+}
+
+static void _zone_scheduler_alarm(void *param)
+{
+    (void) param;
+
+    _zone_scheduler_plan_alarm();
+
+    bc_scheduler_plan_now(_zone_scheduler.task_id);
+}
+
+// switch off outputs with finished dose and plan alarm to the nearest end of dose
+// it must be called with interrupts disabled or from interrupt
+static void _zone_scheduler_plan_alarm(void)
+{
+    uint16_t now = bc_lptim_get_counter();
+    uint16_t nearest = 0xffff;
+    bool running = false;
+
+    for (int i = 0; i < _zone_scheduler.count; i++)
+    {
+        if (_zone_scheduler.zone[i].state != _ZONE_SCHEDULER_STATE_RUNNING)
+        {
+            continue;
+        }
+
+        uint16_t elapsed = now - _zone_scheduler.zone[i].start;
+
+        if (elapsed + _ZONE_SCHEDULER_MIN_REMAINING >= _zone_scheduler.zone[i].duration)
+        {
+            bc_gpio_set_output(_zone_scheduler.zone[i].output, 0);
+
+            _zone_scheduler.zone[i].state = _ZONE_SCHEDULER_STATE_DONE;
+
+            _zone_scheduler.active--;
+
+            bc_energy_set_count(ZONE_SCHEDULER_ENERGY_SUBSYSTEM, _zone_scheduler.active);
+
+            continue;
+        }
+
+        uint16_t remaining = _zone_scheduler.zone[i].duration - elapsed;
+
+        if (remaining < nearest)
+        {
+            nearest = remaining;
+        }
+
+        running = true;
+    }
+
+    if (running)
+    {
+        bc_lptim_set_alarm(now + nearest, _zone_scheduler_alarm, NULL);
+    }
+    else
+    {
+        bc_lptim_clear_alarm();
+    }
+}
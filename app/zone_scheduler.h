@@ -0,0 +1,57 @@
+#ifndef _ZONE_SCHEDULER_H
+#define _ZONE_SCHEDULER_H
+
+#include <bcl.h>
+
+// Scheduler of watering zones
+//
+// Every zone has one output (pump or valve). Requests for watering are
+// queued and started in order while the number of running outputs is
+// below a limit given by battery or supply current. Starts are spaced out,
+// so inrush currents of outputs do not add up, and they wait while the
+// radio transmits, so inrush doesn't brown out the transmitter. A radio
+// transmission which begins during inrush of an output is not held back.
+// A dose is timed by LPTIM1 which keeps running in stop mode, an output is
+// switched off right from its interrupt.
+
+// maximal number of zones
+#define ZONE_SCHEDULER_MAX_ZONES                8
+// maximal duration of one dose (ms) - limited by 16-bit LPTIM1 counter
+#define ZONE_SCHEDULER_MAX_DURATION             (60 * 1000)
+// minimal time between starts of two outputs (ms)
+#define ZONE_SCHEDULER_START_INTERVAL           200
+// how often a start waiting for end of radio transmission is retried (ms)
+#define ZONE_SCHEDULER_RADIO_INTERVAL           10
+// subsystem of energy accounting which counts running outputs
+#ifndef ZONE_SCHEDULER_ENERGY_SUBSYSTEM
+#define ZONE_SCHEDULER_ENERGY_SUBSYSTEM         BC_ENERGY_SUBSYSTEM_USER_0
+#endif
+
+// events of zone scheduler
+typedef enum {
+    // output of a zone was switched on
+    ZONE_SCHEDULER_EVENT_START = 0,
+    // dose of a zone is over, output was switched off
+    ZONE_SCHEDULER_EVENT_DONE = 1
+} zone_scheduler_event_t;
+
+// initialize zones with their outputs and limit of running outputs
+void zone_scheduler_init(const bc_gpio_channel_t *outputs, int count, int max_active);
+
+// set callback function, it is called from a scheduler task
+void zone_scheduler_set_event_handler(void (*event_handler)(int, zone_scheduler_event_t, void *), void *event_param);
+
+// queue a dose of water (ms) for a zone
+// returns false when zone is unknown or it's already queued or running
+bool zone_scheduler_request(int zone, int duration);
+
+// switch off all outputs and drop queued requests
+void zone_scheduler_stop_all(void);
+
+// check whether a zone is queued or running
+bool zone_scheduler_is_busy(int zone);
+
+// get number of running outputs
+int zone_scheduler_get_active(void);
+
+#endif // _ZONE_SCHEDULER_H
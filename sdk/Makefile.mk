@@ -120,6 +120,12 @@ CFLAGS_RELEASE += -D'RELEASE'
 BAND ?= 868
 CFLAGS += -D'BAND=$(BAND)'
 
+# Tokenized log, it is decoded by sdk/tools/log-decode (make clean is needed after change)
+LOG_TOKENIZED ?= 0
+ifeq ("$(LOG_TOKENIZED)","1")
+CFLAGS += -D'BC_LOG_TOKENIZED'
+endif
+
 ################################################################################
 # Compiler flags for "s" files                                                 #
 ################################################################################
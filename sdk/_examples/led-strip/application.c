@@ -8,13 +8,13 @@ bc_led_strip_t led_strip;
 uint32_t color;
 int effect = -1;
 
-static uint32_t _dma_buffer[COUNT * 4 * 2]; // count * type * 2
+static uint32_t _buffer[COUNT * 4 / 4]; // count * type bytes
 
 const bc_led_strip_buffer_t _led_strip_buffer =
 {
     .type = BC_LED_STRIP_TYPE_RGBW,
     .count = COUNT,
-    .buffer = _dma_buffer
+    .buffer = _buffer
 };
 
 void application_init(void)
@@ -0,0 +1,42 @@
+#ifndef _BC_CRC_H
+#define _BC_CRC_H
+
+#include <bc_common.h>
+
+//! @addtogroup bc_crc bc_crc
+//! @brief Table driven CRC calculation used by 1-Wire and sensor drivers
+//! @details Size of lookup tables is selected by BC_CRC_TABLE_SIZE, 16 entry tables (default) process a byte
+//!          in two steps and take 64 B of flash, 256 entry tables process a byte in one step and take 1 kB.
+//! @{
+
+#ifndef BC_CRC_TABLE_SIZE
+#define BC_CRC_TABLE_SIZE 16
+#endif
+
+//! @brief Calculate CRC-8/MAXIM (1-Wire ROM and scratchpad), polynomial 0x31 reflected
+//! @param[in] buffer Pointer to data
+//! @param[in] length Number of bytes
+//! @param[in] crc Starting value (0 for 1-Wire)
+//! @return Calculated CRC
+
+uint8_t bc_crc8_maxim(const void *buffer, size_t length, uint8_t crc);
+
+//! @brief Calculate Sensirion CRC-8, polynomial 0x31 MSB first
+//! @param[in] buffer Pointer to data
+//! @param[in] length Number of bytes
+//! @param[in] crc Starting value (0xff for Sensirion sensors)
+//! @return Calculated CRC
+
+uint8_t bc_crc8_sensirion(const void *buffer, size_t length, uint8_t crc);
+
+//! @brief Calculate CRC-16/IBM, polynomial 0x8005 reflected
+//! @param[in] buffer Pointer to data
+//! @param[in] length Number of bytes
+//! @param[in] crc Starting value (0 for 1-Wire, 0xffff for Modbus)
+//! @return Calculated CRC
+
+uint16_t bc_crc16_ibm(const void *buffer, size_t length, uint16_t crc);
+
+//! @}
+
+#endif // _BC_CRC_H
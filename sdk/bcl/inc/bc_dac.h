@@ -133,7 +133,7 @@ bool bc_dac_async_config(bc_dac_channel_t channel, bc_dac_config_t *config);
 //! @brief Start asynchronous DAC channel operation
 //! @param[in] channel DAC channel
 //! @return true On success
-//! @return false On failure
+//! @return false On failure (if DAC channel operation is in progress or its DMA channel is used by UART)
 
 bool bc_dac_async_run(bc_dac_channel_t channel);
 
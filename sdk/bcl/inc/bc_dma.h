@@ -20,7 +20,7 @@ typedef enum
     //! @brief DMA channel 3
     BC_DMA_CHANNEL_3 = 2,
 
-    //! @brief DMA channel 4
+    //! @brief DMA channel 4, shared by UART2 transmission and DAC channel 2
     BC_DMA_CHANNEL_4 = 3,
 
     //! @brief DMA channel 5, used for SPI
@@ -29,7 +29,7 @@ typedef enum
     //! @brief DMA channel 6
     BC_DMA_CHANNEL_6 = 5,
 
-    //! @brief DMA channel 7
+    //! @brief DMA channel 7, shared by UART transmission and 1-Wire async transfers
     BC_DMA_CHANNEL_7 = 6
 
 } bc_dma_channel_t;
@@ -210,6 +210,16 @@ void bc_dma_channel_config(bc_dma_channel_t channel, bc_dma_channel_config_t *co
 
 void bc_dma_set_event_handler(bc_dma_channel_t channel, void (*event_handler)(bc_dma_channel_t, bc_dma_event_t, void *), void *event_param);
 
+//! @brief Set callback function called from interrupt
+//! @param[in] channel DMA channel
+//! @param[in] event_handler Function address
+//! @param[in] event_param Optional event parameter (can be NULL)
+//! @details Events are passed to handler directly from DMA interrupt instead of scheduler task, so a circular transfer
+//!          can be refilled in time. Handler has to be short. It replaces handler set by bc_dma_set_event_handler and
+//!          vice versa.
+
+void bc_dma_set_irq_event_handler(bc_dma_channel_t channel, void (*event_handler)(bc_dma_channel_t, bc_dma_event_t, void *), void *event_param);
+
 //! @brief Start DMA channel
 //! @param[in] channel DMA channel
 
@@ -222,6 +232,21 @@ void bc_dma_channel_stop(bc_dma_channel_t channel);
 
 size_t bc_dma_channel_get_length(bc_dma_channel_t channel);
 
+//! @brief Claim DMA channel shared by several drivers
+//! @param[in] channel DMA channel
+//! @param[in] owner Instance of driver which claims channel
+//! @return true If channel was free or it is claimed by the same owner already
+//! @return false If channel is claimed by other owner
+//! @details Driver which shares a channel claims it before configuration and releases it when transfer is done.
+
+bool bc_dma_channel_claim(bc_dma_channel_t channel, const void *owner);
+
+//! @brief Release DMA channel claimed by bc_dma_channel_claim, it does nothing if channel is claimed by other owner
+//! @param[in] channel DMA channel
+//! @param[in] owner Instance of driver which claimed channel
+
+void bc_dma_channel_release(bc_dma_channel_t channel, const void *owner);
+
 
 //! @}
 
@@ -9,6 +9,57 @@
 //! @brief Driver for DS28E17 (1-wire-to-I2C Master Bridge)
 //! @{
 
+//! @brief Asynchronous transfer events
+
+typedef enum
+{
+    //! @brief Transfer is done
+    BC_DS28E17_EVENT_DONE = 0,
+
+    //! @brief Transfer failed
+    BC_DS28E17_EVENT_ERROR = 1
+
+} bc_ds28e17_event_t;
+
+//! @brief Type of I2C operation in list
+
+typedef enum
+{
+    //! @brief Write to I2C
+    BC_DS28E17_OPERATION_WRITE = 0,
+
+    //! @brief Read from I2C
+    BC_DS28E17_OPERATION_READ = 1,
+
+    //! @brief Memory write to I2C
+    BC_DS28E17_OPERATION_MEMORY_WRITE = 2,
+
+    //! @brief Memory read from I2C (address is written and data are read by one bridge command)
+    BC_DS28E17_OPERATION_MEMORY_READ = 3
+
+} bc_ds28e17_operation_type_t;
+
+//! @brief I2C operation in list
+
+typedef struct
+{
+    //! @brief Type of operation
+    bc_ds28e17_operation_type_t type;
+
+    //! @brief 7-bit I2C device address
+    uint8_t device_address;
+
+    //! @brief Memory address of memory operations (it can be OR-ed with BC_I2C_MEMORY_ADDRESS_16_BIT)
+    uint32_t memory_address;
+
+    //! @brief Pointer to buffer which is being written or read
+    void *buffer;
+
+    //! @brief Length of buffer which is being written or read
+    size_t length;
+
+} bc_ds28e17_operation_t;
+
 //! @brief DS28E17 instance
 
 typedef struct
@@ -78,6 +129,75 @@ bool bc_ds28e17_memory_write(bc_ds28e17_t *self, const bc_i2c_memory_transfer_t
 
 bool bc_ds28e17_memory_read(bc_ds28e17_t *self, const bc_i2c_memory_transfer_t *transfer);
 
+//! @brief Execute list of I2C operations in one 1-Wire transaction
+//! @details Bridge is woken up and addressed by device number once, following operations select it by Resume ROM.
+//!          Execution stops at the first failed operation.
+//! @param[in] self Instance
+//! @param[in] operation Array of operations
+//! @param[in] count Number of operations
+//! @return Number of successfully executed operations (count on success)
+
+int bc_ds28e17_execute(bc_ds28e17_t *self, const bc_ds28e17_operation_t *operation, int count);
+
+//! @brief Start asynchronous execution of list of I2C operations in one 1-Wire transaction
+//! @details Bridge is woken up and addressed by device number once, following operations select it by Resume ROM.
+//!          Execution stops at the first failed operation, see bc_ds28e17_async_get_done.
+//! @param[in] self Instance
+//! @param[in] operation Array of operations (it and its buffers must be valid until callback)
+//! @param[in] count Number of operations
+//! @param[in] callback Function called from scheduler task when execution finishes
+//! @param[in] param Optional parameter of callback
+//! @return true On success
+//! @return false When execution can not be started (see bc_onewire_async_reset)
+
+bool bc_ds28e17_async_execute(bc_ds28e17_t *self, const bc_ds28e17_operation_t *operation, int count, void (*callback)(bc_ds28e17_t *, bc_ds28e17_event_t, void *), void *param);
+
+//! @brief Get number of successfully executed operations of the last asynchronous execution
+//! @param[in] self Instance
+//! @return Number of operations (count of bc_ds28e17_async_execute on success)
+
+int bc_ds28e17_async_get_done(bc_ds28e17_t *self);
+
+//! @brief Start asynchronous write to I2C
+//! @param[in] self Instance
+//! @param[in] transfer Pointer to I2C transfer parameters instance (buffer must be valid until callback)
+//! @param[in] callback Function called from scheduler task when transfer finishes
+//! @param[in] param Optional parameter of callback
+//! @return true On success
+//! @return false When transfer can not be started (see bc_onewire_async_reset)
+
+bool bc_ds28e17_async_write(bc_ds28e17_t *self, const bc_i2c_transfer_t *transfer, void (*callback)(bc_ds28e17_t *, bc_ds28e17_event_t, void *), void *param);
+
+//! @brief Start asynchronous read from I2C
+//! @param[in] self Instance
+//! @param[in] transfer Pointer to I2C transfer parameters instance (buffer must be valid until callback)
+//! @param[in] callback Function called from scheduler task when transfer finishes
+//! @param[in] param Optional parameter of callback
+//! @return true On success
+//! @return false When transfer can not be started (see bc_onewire_async_reset)
+
+bool bc_ds28e17_async_read(bc_ds28e17_t *self, const bc_i2c_transfer_t *transfer, void (*callback)(bc_ds28e17_t *, bc_ds28e17_event_t, void *), void *param);
+
+//! @brief Start asynchronous memory write to I2C
+//! @param[in] self Instance
+//! @param[in] transfer Pointer to I2C memory transfer parameters instance (buffer must be valid until callback)
+//! @param[in] callback Function called from scheduler task when transfer finishes
+//! @param[in] param Optional parameter of callback
+//! @return true On success
+//! @return false When transfer can not be started (see bc_onewire_async_reset)
+
+bool bc_ds28e17_async_memory_write(bc_ds28e17_t *self, const bc_i2c_memory_transfer_t *transfer, void (*callback)(bc_ds28e17_t *, bc_ds28e17_event_t, void *), void *param);
+
+//! @brief Start asynchronous memory read from I2C
+//! @param[in] self Instance
+//! @param[in] transfer Pointer to I2C memory transfer parameters instance (buffer must be valid until callback)
+//! @param[in] callback Function called from scheduler task when transfer finishes
+//! @param[in] param Optional parameter of callback
+//! @return true On success
+//! @return false When transfer can not be started (see bc_onewire_async_reset)
+
+bool bc_ds28e17_async_memory_read(bc_ds28e17_t *self, const bc_i2c_memory_transfer_t *transfer, void (*callback)(bc_ds28e17_t *, bc_ds28e17_event_t, void *), void *param);
+
 //! @}
 
 #endif // _BC_DS28E17_H
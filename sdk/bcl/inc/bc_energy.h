@@ -0,0 +1,122 @@
+#ifndef _BC_ENERGY_H
+#define _BC_ENERGY_H
+
+#include <bc_tick.h>
+
+//! @addtogroup bc_energy bc_energy
+//! @brief Energy accounting, on-time of subsystems is integrated into estimated charge
+//! @details Drivers report when a subsystem is switched on or off. On-time is measured by LPTIM1,
+//!          so time spent in stop mode is counted too. Charge of a subsystem is its on-time
+//!          multiplied by its current from a current table, currents of all subsystems which are on add up.
+//! @{
+
+//! @brief Subsystems
+
+typedef enum
+{
+    //! @brief Whole node in stop mode, it is always on
+    BC_ENERGY_SUBSYSTEM_BASE = 0,
+
+    //! @brief MCU core is running (on top of base)
+    BC_ENERGY_SUBSYSTEM_MCU_RUN = 1,
+
+    //! @brief PLL clock is enabled (on top of MCU run)
+    BC_ENERGY_SUBSYSTEM_PLL = 2,
+
+    //! @brief Radio transmits
+    BC_ENERGY_SUBSYSTEM_RADIO_TX = 3,
+
+    //! @brief Radio receives
+    BC_ENERGY_SUBSYSTEM_RADIO_RX = 4,
+
+    //! @brief 1-Wire bus on sensor module is powered
+    BC_ENERGY_SUBSYSTEM_ONEWIRE = 5,
+
+    //! @brief Subsystem defined by application
+    BC_ENERGY_SUBSYSTEM_USER_0 = 6,
+
+    //! @brief Subsystem defined by application
+    BC_ENERGY_SUBSYSTEM_USER_1 = 7,
+
+    //! @brief Number of subsystems
+    BC_ENERGY_SUBSYSTEM_COUNT = 8
+
+} bc_energy_subsystem_t;
+
+//! @brief Callback events
+
+typedef enum
+{
+    //! @brief Update event
+    BC_ENERGY_EVENT_UPDATE = 0
+
+} bc_energy_event_t;
+
+//! @brief Initialize energy accounting, until then all reports of subsystems are ignored
+
+void bc_energy_init(void);
+
+//! @brief Set callback function
+//! @param[in] event_handler Function address
+//! @param[in] event_param Optional event parameter (can be NULL)
+
+void bc_energy_set_event_handler(void (*event_handler)(bc_energy_event_t, void *), void *event_param);
+
+//! @brief Set update interval
+//! @param[in] interval Update interval
+
+void bc_energy_set_update_interval(bc_tick_t interval);
+
+//! @brief Set current of a subsystem
+//! @param[in] subsystem Subsystem
+//! @param[in] current Current in microamperes
+
+void bc_energy_set_current(bc_energy_subsystem_t subsystem, uint32_t current);
+
+//! @brief Report that a subsystem was switched on or off, it can be called from interrupt
+//! @param[in] subsystem Subsystem
+//! @param[in] on State of subsystem
+
+void bc_energy_set_state(bc_energy_subsystem_t subsystem, bool on);
+
+//! @brief Report number of identical loads of a subsystem which are on, it can be called from interrupt
+//! @param[in] subsystem Subsystem
+//! @param[in] count Number of loads which are on
+
+void bc_energy_set_count(bc_energy_subsystem_t subsystem, int count);
+
+//! @brief Reset on-time of all subsystems
+
+void bc_energy_reset(void);
+
+//! @brief Get on-time of a subsystem since initialization or reset
+//! @param[in] subsystem Subsystem
+//! @return On-time in seconds
+
+float bc_energy_get_on_time(bc_energy_subsystem_t subsystem);
+
+//! @brief Get charge consumed by a subsystem since initialization or reset
+//! @param[in] subsystem Subsystem
+//! @return Charge in milliampere hours
+
+float bc_energy_get_charge(bc_energy_subsystem_t subsystem);
+
+//! @brief Get charge consumed by all subsystems since initialization or reset
+//! @return Charge in milliampere hours
+
+float bc_energy_get_total_charge(void);
+
+//! @brief Get average current since initialization or reset
+//! @return Current in milliamperes
+
+float bc_energy_get_average_current(void);
+
+//! @brief Estimate battery life with average current
+//! @param[in] capacity Battery capacity in milliampere hours
+//! @return Battery life in days (INFINITY if nothing was measured yet)
+
+float bc_energy_get_battery_life(float capacity);
+
+//! @}
+
+#endif // _BC_ENERGY_H
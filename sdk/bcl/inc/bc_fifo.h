@@ -76,6 +76,12 @@ size_t bc_fifo_irq_read(bc_fifo_t *fifo, void *buffer, size_t length);
 
 bool bc_fifo_is_empty(bc_fifo_t *fifo);
 
+//! @brief Get free space
+//! @param[in] fifo FIFO instance
+//! @return Number of bytes which can be written
+
+size_t bc_fifo_get_free_space(bc_fifo_t *fifo);
+
 //! @}
 
 #endif // _BC_FIFO_H
@@ -17,9 +17,32 @@ typedef struct  {
     const bc_font_image_t *image;
 } bc_font_char_t;
 
+// Direct-index lookup table covers character codes BC_FONT_INDEX_FIRST .. 0xff,
+// it holds position in chars array or BC_FONT_INDEX_NONE, it is generated by sdk/tools/font/bc-font-index.py
+#define BC_FONT_INDEX_FIRST 0x20
+#define BC_FONT_INDEX_LENGTH (0x100 - BC_FONT_INDEX_FIRST)
+#define BC_FONT_INDEX_NONE 0xff
+
+// Compressed glyph, it starts at offset in rle_data of font, glyphs are generated by sdk/tools/font/bc-font-rle.py
+typedef struct  {
+    uint16_t code;
+    uint8_t width;
+    uint16_t offset;
+} bc_font_rle_char_t;
+
+#define BC_FONT_RLE_WIDTH_MAX 64
+
+// Stack buffer of glyph rows decoded by bc_gfx, it holds at least 8 rows of the widest glyph
+#define BC_FONT_RLE_BUFFER_SIZE 64
+
+// Font has either chars array of glyph images or rle_chars array of compressed glyphs (chars is NULL then)
 typedef struct  {
     uint16_t length;
     const bc_font_char_t *chars;
+    const uint8_t *index;
+    uint8_t rle_height;
+    const bc_font_rle_char_t *rle_chars;
+    const uint8_t *rle_data;
 } bc_font_t;
 
 //
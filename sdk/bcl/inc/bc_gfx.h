@@ -3,6 +3,7 @@
 
 #include <bc_common.h>
 #include <bc_font_common.h>
+#include <bc_image.h>
 
 //! @addtogroup bc_gfx bc_gfx
 //! @brief Graphics library
@@ -39,6 +40,22 @@ typedef struct
     //! @brief Callback for get capabilities
     bc_gfx_caps_t (*get_caps)(void *self);
 
+    //! @brief Optional callback for draw monochrome image in display coordinates (can be NULL)
+    //! @details Image rows are (width + 7) / 8 bytes long with MSB first, pixels of cleared bits are drawn (format
+    //!          of font glyphs). Image has to fit into display.
+    void (*blit_mono)(void *self, int left, int top, const uint8_t *image, int width, int height, uint32_t color);
+
+    //! @brief Optional callback for draw horizontal span in display coordinates (can be NULL)
+    void (*draw_hspan)(void *self, int left, int top, int width, uint32_t color);
+
+    //! @brief Optional callback for fill rectangle in display coordinates (can be NULL)
+    void (*fill_rect)(void *self, int left, int top, int width, int height, uint32_t color);
+
+    //! @brief Optional callback for draw image in display coordinates (can be NULL)
+    //! @details Image rows are (width + 7) / 8 bytes long with LSB first, pixels of set bits get color 1 and pixels of
+    //!          cleared bits color 0 (format of bc_image_t). Image has to fit into display.
+    void (*blit)(void *self, int left, int top, const uint8_t *image, int width, int height);
+
 } bc_gfx_driver_t;
 
 //! @brief Rotation
@@ -179,6 +196,14 @@ int bc_gfx_calc_string_width(bc_gfx_t *self,  char *str);
 
 int bc_gfx_printf(bc_gfx_t *self, int left, int top, uint32_t color, char *format, ...);
 
+//! @brief Display draw image
+//! @param[in] self Instance
+//! @param[in] left Pixels from left edge
+//! @param[in] top Pixels from top edge
+//! @param[in] image Image
+
+void bc_gfx_draw_image(bc_gfx_t *self, int left, int top, const bc_image_t *image);
+
 //! @brief Display draw line
 //! @param[in] self Instance
 //! @param[in] x0 Pixels from left edge
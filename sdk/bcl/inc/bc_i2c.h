@@ -70,6 +70,139 @@ typedef struct
 
 } bc_i2c_memory_transfer_t;
 
+//! @brief I2C transaction event
+
+typedef enum
+{
+    //! @brief Transaction has been finished successfully
+    BC_I2C_EVENT_DONE = 0,
+
+    //! @brief Transaction has failed (NACK, bus error or timeout)
+    BC_I2C_EVENT_ERROR = 1
+
+} bc_i2c_event_t;
+
+//! @brief I2C transaction status
+
+typedef enum
+{
+    //! @brief Transaction has been finished successfully
+    BC_I2C_STATUS_OK = 0,
+
+    //! @brief Device has not acknowledged address or data
+    BC_I2C_STATUS_NACK = 1,
+
+    //! @brief Bus error or arbitration lost
+    BC_I2C_STATUS_BUS_ERROR = 2,
+
+    //! @brief Transaction has not been finished in time
+    BC_I2C_STATUS_TIMEOUT = 3
+
+} bc_i2c_status_t;
+
+//! @brief I2C transaction type
+
+typedef enum
+{
+    //! @brief Write buffer to device
+    BC_I2C_TRANSACTION_WRITE = 0,
+
+    //! @brief Read buffer from device
+    BC_I2C_TRANSACTION_READ = 1,
+
+    //! @brief Write buffer to device memory
+    BC_I2C_TRANSACTION_MEMORY_WRITE = 2,
+
+    //! @brief Read buffer from device memory
+    BC_I2C_TRANSACTION_MEMORY_READ = 3
+
+} bc_i2c_transaction_type_t;
+
+//! @brief I2C transaction instance
+
+typedef struct bc_i2c_transaction_t bc_i2c_transaction_t;
+
+//! @cond
+
+struct bc_i2c_transaction_t
+{
+    bc_i2c_transaction_type_t type;
+    uint8_t device_address;
+    uint32_t memory_address;
+    void *buffer;
+    size_t length;
+
+    bc_i2c_transaction_t *_next;
+    void (*_callback)(bc_i2c_transaction_t *, bc_i2c_event_t, void *);
+    void *_param;
+    uint32_t _timeout;
+    volatile int _state;
+    size_t _bytes;
+    int _starts;
+};
+
+//! @endcond
+
+//! @brief Maximum number of devices which are profiled
+
+#ifndef BC_I2C_PROFILE_DEVICE_COUNT
+#define BC_I2C_PROFILE_DEVICE_COUNT 8
+#endif
+
+//! @brief I2C transaction record passed to trace handler
+
+typedef struct
+{
+    //! @brief I2C channel
+    bc_i2c_channel_t channel;
+
+    //! @brief Transaction type
+    bc_i2c_transaction_type_t type;
+
+    //! @brief 7-bit I2C device address
+    uint8_t device_address;
+
+    //! @brief Memory address (memory transactions only)
+    uint32_t memory_address;
+
+    //! @brief Data which have been written or read
+    const void *buffer;
+
+    //! @brief Length of data
+    size_t length;
+
+    //! @brief Transaction status
+    bc_i2c_status_t status;
+
+    //! @brief Bus time occupied by transaction in microseconds
+    uint32_t bus_time_us;
+
+} bc_i2c_trace_t;
+
+//! @brief I2C bus usage of a device
+
+typedef struct
+{
+    //! @brief Number of transactions
+    uint32_t transactions;
+
+    //! @brief Number of data bytes (without addresses)
+    uint32_t bytes;
+
+    //! @brief Number of transactions which have not been acknowledged
+    uint32_t nacks;
+
+    //! @brief Number of transactions which have failed on bus error or timeout
+    uint32_t errors;
+
+    //! @brief Number of bus recoveries after failed reads
+    uint32_t recoveries;
+
+    //! @brief Bus time in microseconds
+    uint32_t bus_time_us;
+
+} bc_i2c_profile_t;
+
 //! @brief Initialize I2C channel
 //! @param[in] channel I2C channel
 //! @param[in] speed I2C communication speed
@@ -125,6 +258,62 @@ bool bc_i2c_memory_write(bc_i2c_channel_t channel, const bc_i2c_memory_transfer_
 
 bool bc_i2c_memory_read(bc_i2c_channel_t channel, const bc_i2c_memory_transfer_t *transfer);
 
+//! @brief Submit transaction to I2C channel queue
+//! @param[in] channel I2C channel
+//! @param[in] transaction Pointer to transaction instance (type, device_address, memory_address, buffer and length have to be set)
+//! @param[in] callback Function which is called from scheduler task when transaction is finished
+//! @param[in] param Optional parameter passed to callback
+//! @return true On success
+//! @return false On failure
+//!
+//! Transactions are processed one after another in interrupts and MCU sleeps meanwhile.
+//! Transaction instance and its buffer must stay valid until callback is called.
+//! Transactions of BC_I2C_I2C_1W are processed in scheduler tasks, synchronous functions fail on this channel
+//! while its queue is not empty.
+
+bool bc_i2c_submit(bc_i2c_channel_t channel, bc_i2c_transaction_t *transaction, void (*callback)(bc_i2c_transaction_t *, bc_i2c_event_t, void *), void *param);
+
+//! @brief Get bus usage of a device since start or profile reset
+//! @param[in] channel I2C channel
+//! @param[in] device_address 7-bit I2C device address
+//! @param[out] profile Bus usage of the device
+//! @return true On success
+//! @return false If device has not been accessed or it doesn't fit into profile table
+
+bool bc_i2c_get_profile(bc_i2c_channel_t channel, uint8_t device_address, bc_i2c_profile_t *profile);
+
+//! @brief Reset bus usage of all devices
+
+void bc_i2c_reset_profile(void);
+
+//! @brief Set trace handler which is called from task context after every transaction
+//! @param[in] trace_handler Function address (can be NULL)
+//! @param[in] trace_param Optional trace parameter (can be NULL)
+
+void bc_i2c_set_trace_handler(void (*trace_handler)(const bc_i2c_trace_t *, void *), void *trace_param);
+
+//! @brief Format transaction record to a text line which can be replayed on host by sdk/tools/i2c-replay
+//! @param[in] trace Transaction record
+//! @param[out] buffer Output buffer
+//! @param[in] size Size of output buffer
+//! @return Length of formatted line (it is truncated if it doesn't fit)
+
+size_t bc_i2c_trace_format(const bc_i2c_trace_t *trace, char *buffer, size_t size);
+
+//! @brief Get bus time of a transfer, clock stretching is not counted
+//! @param[in] speed I2C communication speed
+//! @param[in] bytes Number of bytes on bus including address bytes
+//! @param[in] starts Number of start conditions
+//! @return Bus time in microseconds
+
+static inline uint32_t bc_i2c_get_bus_time_us(bc_i2c_speed_t speed, size_t bytes, int starts)
+{
+    // Every byte takes 9 clocks with ACK, start and stop take about 1 clock each
+    uint32_t clocks = bytes * 9 + starts + 1;
+
+    return speed == BC_I2C_SPEED_400_KHZ ? (clocks * 5 + 1) / 2 : clocks * 10;
+}
+
 //! @brief Memory write 1 byte to I2C channel
 //! @param[in] channel I2C channel
 //! @param[in] device_address 7-bit I2C device address
@@ -0,0 +1,72 @@
+#ifndef _BC_KV_H
+#define _BC_KV_H
+
+#include <bc_common.h>
+
+//! @addtogroup bc_kv bc_kv
+//! @brief Wear-leveled key-value store in EEPROM
+//! @details Store area is split into two sectors and values are appended to the active sector as CRC protected
+//!          records, so saving a value programs only a few new words instead of rewriting the same cells. Offsets
+//!          of the latest records are kept in RAM index. When the active sector runs out of space, live records
+//!          are copied to the other sector in background by async EEPROM writes and the sectors are swapped.
+//! @{
+
+//! @brief Number of keys (keys are 0 .. BC_KV_KEY_COUNT - 1)
+
+#ifndef BC_KV_KEY_COUNT
+#define BC_KV_KEY_COUNT 32
+#endif
+
+//! @brief Maximum length of value in bytes (up to 255)
+
+#ifndef BC_KV_MAX_LENGTH
+#define BC_KV_MAX_LENGTH 64
+#endif
+
+//! @brief Initialize key-value store and build index from EEPROM
+//! @param[in] address EEPROM start address of store area (aligned to 4 bytes)
+//! @param[in] size Size of store area in bytes (both sectors)
+//! @return true On success
+//! @return false On failure (area is too small or EEPROM cannot be written)
+
+bool bc_kv_init(uint32_t address, size_t size);
+
+//! @brief Get value of key
+//! @param[in] key Key
+//! @param[out] buffer Pointer to destination buffer
+//! @param[in] length Length of value, it has to match length of stored value
+//! @return true On success
+//! @return false If key is not stored or its value has different length
+
+bool bc_kv_get(uint8_t key, void *buffer, size_t length);
+
+//! @brief Get length of value of key
+//! @param[in] key Key
+//! @return Length of value (0 if key is not stored)
+
+size_t bc_kv_get_length(uint8_t key);
+
+//! @brief Set value of key, nothing is written if value has not changed
+//! @param[in] key Key
+//! @param[in] buffer Pointer to source buffer
+//! @param[in] length Length of value (1 .. BC_KV_MAX_LENGTH)
+//! @return true On success
+//! @return false On failure
+
+bool bc_kv_set(uint8_t key, const void *buffer, size_t length);
+
+//! @brief Delete key
+//! @param[in] key Key
+//! @return true On success
+//! @return false On failure
+
+bool bc_kv_delete(uint8_t key);
+
+//! @brief Get free space of active sector
+//! @return Number of bytes which can be appended before compaction
+
+size_t bc_kv_get_free(void);
+
+//! @}
+
+#endif // _BC_KV_H
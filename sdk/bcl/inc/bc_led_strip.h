@@ -14,6 +14,7 @@ typedef struct
 {
     bc_led_strip_type_t type;
     int count;
+    // Pixel data of driver, count * type bytes (bc_ws2812b)
     uint32_t *buffer;
 
 } bc_led_strip_buffer_t;
@@ -43,11 +44,13 @@ struct bc_led_strip_t
 
     struct
     {
-        int led;
-        int round;
+        bc_tick_t tick;
         bc_tick_t wait;
+        bool (*render)(bc_led_strip_t *);
         uint32_t color;
         bc_scheduler_task_id_t task_id;
+        int16_t led;
+        uint16_t round;
 
     } _effect;
     uint8_t _brightness;
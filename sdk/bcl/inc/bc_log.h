@@ -6,6 +6,14 @@
 
 //! @addtogroup bc_log bc_log
 //! @brief Logging facility (output on TXD2, format 115200 / 8N1)
+//! @details Messages are formatted to a ring buffer and transmitted by UART interrupts, so logging doesn't wait
+//!          for transmission. A message which doesn't fit into the buffer is dropped and counted.
+//!
+//!          With BC_LOG_TOKENIZED defined (make LOG_TOKENIZED=1) messages are not formatted on MCU. Format strings
+//!          are placed to .bc_log_tokens section which is not loaded to flash and a compact binary record with
+//!          address of format string, time delta and varint encoded arguments is transmitted instead. The log is
+//!          decoded back to text by sdk/tools/log-decode with help of the ELF file. Up to 8 arguments are
+//!          supported, pointers other than strings are logged as integers.
 //! @{
 
 #ifndef BC_LOG_UART
@@ -14,6 +22,12 @@
 
 #define BC_LOG_DUMP_WIDTH 8
 
+//! @brief Size of buffer for messages waiting for transmission
+
+#ifndef BC_LOG_BUFFER_SIZE
+#define BC_LOG_BUFFER_SIZE 1024
+#endif
+
 //! @brief Log level
 
 typedef enum
@@ -93,6 +107,101 @@ void bc_log_warning(const char *format, ...);
 
 void bc_log_error(const char *format, ...);
 
+//! @brief Get number of messages dropped on full buffer
+//! @return Number of dropped messages since initialization
+
+uint32_t bc_log_get_dropped(void);
+
+//! @brief Transmit waiting messages by polling and write following messages synchronously
+//!
+//! It is meant for fault handling, when interrupts and scheduler can't be relied on.
+
+void bc_log_flush_on_fault(void);
+
+#ifdef BC_LOG_TOKENIZED
+
+//! @cond
+
+#define _BC_LOG_ARG_INT 1U
+#define _BC_LOG_ARG_UINT 2U
+#define _BC_LOG_ARG_INT64 3U
+#define _BC_LOG_ARG_UINT64 4U
+#define _BC_LOG_ARG_DOUBLE 5U
+#define _BC_LOG_ARG_STRING 6U
+#define _BC_LOG_ARG_POINTER 7U
+
+#define _BC_LOG_ARG(x) _Generic((x), \
+    float: _BC_LOG_ARG_DOUBLE, double: _BC_LOG_ARG_DOUBLE, \
+    char *: _BC_LOG_ARG_STRING, const char *: _BC_LOG_ARG_STRING, \
+    void *: _BC_LOG_ARG_POINTER, const void *: _BC_LOG_ARG_POINTER, \
+    long long: _BC_LOG_ARG_INT64, unsigned long long: _BC_LOG_ARG_UINT64, \
+    long: (sizeof(long) > 4 ? _BC_LOG_ARG_INT64 : _BC_LOG_ARG_INT), \
+    unsigned long: (sizeof(long) > 4 ? _BC_LOG_ARG_UINT64 : _BC_LOG_ARG_UINT), \
+    unsigned int: _BC_LOG_ARG_UINT, \
+    default: _BC_LOG_ARG_INT)
+
+#define _BC_LOG_CAT(a, b) _BC_LOG_CAT_(a, b)
+#define _BC_LOG_CAT_(a, b) a##b
+
+#define _BC_LOG_NARGS(...) _BC_LOG_NARGS_(__VA_ARGS__, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define _BC_LOG_NARGS_(_1, _2, _3, _4, _5, _6, _7, _8, _9, n, ...) n
+
+#define _BC_LOG_FORMAT(...) _BC_LOG_FORMAT_(__VA_ARGS__, 0)
+#define _BC_LOG_FORMAT_(format, ...) format
+
+// Argument types packed by 4 bits, the first argument is in the lowest bits
+#define _BC_LOG_TYPES(...) _BC_LOG_CAT(_BC_LOG_TYPES_, _BC_LOG_NARGS(__VA_ARGS__))(__VA_ARGS__)
+#define _BC_LOG_TYPES_1(f) 0U
+#define _BC_LOG_TYPES_2(f, a) _BC_LOG_ARG(a)
+#define _BC_LOG_TYPES_3(f, a, ...) (_BC_LOG_ARG(a) | _BC_LOG_TYPES_2(f, __VA_ARGS__) << 4)
+#define _BC_LOG_TYPES_4(f, a, ...) (_BC_LOG_ARG(a) | _BC_LOG_TYPES_3(f, __VA_ARGS__) << 4)
+#define _BC_LOG_TYPES_5(f, a, ...) (_BC_LOG_ARG(a) | _BC_LOG_TYPES_4(f, __VA_ARGS__) << 4)
+#define _BC_LOG_TYPES_6(f, a, ...) (_BC_LOG_ARG(a) | _BC_LOG_TYPES_5(f, __VA_ARGS__) << 4)
+#define _BC_LOG_TYPES_7(f, a, ...) (_BC_LOG_ARG(a) | _BC_LOG_TYPES_6(f, __VA_ARGS__) << 4)
+#define _BC_LOG_TYPES_8(f, a, ...) (_BC_LOG_ARG(a) | _BC_LOG_TYPES_7(f, __VA_ARGS__) << 4)
+#define _BC_LOG_TYPES_9(f, a, ...) (_BC_LOG_ARG(a) | _BC_LOG_TYPES_8(f, __VA_ARGS__) << 4)
+
+// Arguments without format string
+#define _BC_LOG_ARGS(...) _BC_LOG_CAT(_BC_LOG_ARGS_, _BC_LOG_NARGS(__VA_ARGS__))(__VA_ARGS__)
+#define _BC_LOG_ARGS_1(f)
+#define _BC_LOG_ARGS_2(f, ...) , __VA_ARGS__
+#define _BC_LOG_ARGS_3(f, ...) , __VA_ARGS__
+#define _BC_LOG_ARGS_4(f, ...) , __VA_ARGS__
+#define _BC_LOG_ARGS_5(f, ...) , __VA_ARGS__
+#define _BC_LOG_ARGS_6(f, ...) , __VA_ARGS__
+#define _BC_LOG_ARGS_7(f, ...) , __VA_ARGS__
+#define _BC_LOG_ARGS_8(f, ...) , __VA_ARGS__
+#define _BC_LOG_ARGS_9(f, ...) , __VA_ARGS__
+
+// Format string is kept only in ELF file, its address is the token
+#define _BC_LOG_TOKENIZED(call, format) \
+    do \
+    { \
+        static const char _bc_log_format[] __attribute__((section(".bc_log_tokens"), used)) = format; \
+        call; \
+    } while (0)
+
+#define _BC_LOG_TOKEN ((uint32_t) (uintptr_t) _bc_log_format)
+
+#define _BC_LOG_MESSAGE(level, ...) \
+    _BC_LOG_TOKENIZED(_bc_log_tokenized(level, _BC_LOG_TOKEN, _BC_LOG_TYPES(__VA_ARGS__) _BC_LOG_ARGS(__VA_ARGS__)), _BC_LOG_FORMAT(__VA_ARGS__))
+
+#define bc_log_dump(buffer, length, ...) \
+    _BC_LOG_TOKENIZED(_bc_log_tokenized_dump(buffer, length, _BC_LOG_TOKEN, _BC_LOG_TYPES(__VA_ARGS__) _BC_LOG_ARGS(__VA_ARGS__)), _BC_LOG_FORMAT(__VA_ARGS__))
+
+#define bc_log_debug(...) _BC_LOG_MESSAGE(BC_LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define bc_log_info(...) _BC_LOG_MESSAGE(BC_LOG_LEVEL_INFO, __VA_ARGS__)
+#define bc_log_warning(...) _BC_LOG_MESSAGE(BC_LOG_LEVEL_WARNING, __VA_ARGS__)
+#define bc_log_error(...) _BC_LOG_MESSAGE(BC_LOG_LEVEL_ERROR, __VA_ARGS__)
+
+void _bc_log_tokenized(bc_log_level_t level, uint32_t token, uint32_t types, ...);
+
+void _bc_log_tokenized_dump(const void *buffer, size_t length, uint32_t token, uint32_t types, ...);
+
+//! @endcond
+
+#endif
+
 #else
 
 #define bc_log_init(...)
@@ -101,6 +210,8 @@ void bc_log_error(const char *format, ...);
 #define bc_log_info(...)
 #define bc_log_warning(...)
 #define bc_log_error(...)
+#define bc_log_get_dropped(...) 0
+#define bc_log_flush_on_fault(...)
 
 #endif
 
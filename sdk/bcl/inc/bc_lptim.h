@@ -0,0 +1,45 @@
+#ifndef _BC_LPTIM_H
+#define _BC_LPTIM_H
+
+#include <bc_common.h>
+
+//! @addtogroup bc_lptim bc_lptim
+//! @brief Driver for low-power timer LPTIM1 clocked from LSE, it keeps running in stop mode
+//! @{
+
+//! @brief Number of timer ticks per second
+#define BC_LPTIM_TICKS_PER_SECOND 1024
+
+//! @brief Initialize timer and start free running counter
+
+void bc_lptim_init(void);
+
+//! @brief Get actual state of free running counter
+//! @return Counter value (1/BC_LPTIM_TICKS_PER_SECOND s)
+
+uint16_t bc_lptim_get_counter(void);
+
+//! @brief Plan alarm, there is only one alarm and it replaces the previous one
+//! @note Counter should be at least two ticks ahead, otherwise the alarm fires after counter overflow
+//! @param[in] counter Counter value when alarm fires
+//! @param[in] callback Function called from interrupt
+//! @param[in] param Optional callback parameter (can be NULL)
+
+void bc_lptim_set_alarm(uint16_t counter, void (*callback)(void *), void *param);
+
+//! @brief Cancel planned alarm
+
+void bc_lptim_clear_alarm(void);
+
+//! @brief Convert milliseconds to timer ticks
+//! @param[in] milliseconds Time in milliseconds
+//! @return Number of timer ticks
+
+static inline uint32_t bc_lptim_ms_to_ticks(uint32_t milliseconds)
+{
+    return (milliseconds * BC_LPTIM_TICKS_PER_SECOND + 500) / 1000;
+}
+
+//! @}
+
+#endif // _BC_LPTIM_H
@@ -25,6 +25,11 @@ typedef struct
     uint8_t _vcom;
     bc_scheduler_task_id_t _task_id;
     bool (*_pin_cs_set)(bool state);
+    uint32_t _dirty[BC_LS013B7DH03_HEIGHT / 32];
+    bool _update_in_progress;
+    uint8_t _update_line;
+    size_t _update_trailer;
+    uint8_t _update_trailer_value;
 
 } bc_ls013b7dh03_t;
 
@@ -66,8 +71,51 @@ void bc_ls013b7dh03_draw_pixel(bc_ls013b7dh03_t *self, int x, int y, uint32_t co
 
 uint32_t bc_ls013b7dh03_get_pixel(bc_ls013b7dh03_t *self, int x, int y);
 
-//! @brief Lcd update, send data
+//! @brief Lcd draw monochrome image, rows are copied to framebuffer byte-wise
 //! @param[in] self Instance
+//! @param[in] left Pixels from left edge
+//! @param[in] top Pixels from top edge
+//! @param[in] image Image rows of (width + 7) / 8 bytes, MSB first, pixels of cleared bits are drawn
+//! @param[in] width Image width, image has to fit into display
+//! @param[in] height Image height
+//! @param[in] color Pixels state
+
+void bc_ls013b7dh03_blit_mono(bc_ls013b7dh03_t *self, int left, int top, const uint8_t *image, int width, int height, uint32_t color);
+
+//! @brief Lcd draw horizontal span, whole framebuffer bytes are written at once
+//! @param[in] self Instance
+//! @param[in] left Pixels from left edge
+//! @param[in] top Pixels from top edge
+//! @param[in] width Span width, span has to fit into display
+//! @param[in] color Pixels state
+
+void bc_ls013b7dh03_draw_hspan(bc_ls013b7dh03_t *self, int left, int top, int width, uint32_t color);
+
+//! @brief Lcd fill rectangle
+//! @param[in] self Instance
+//! @param[in] left Pixels from left edge
+//! @param[in] top Pixels from top edge
+//! @param[in] width Rectangle width, rectangle has to fit into display
+//! @param[in] height Rectangle height
+//! @param[in] color Pixels state
+
+void bc_ls013b7dh03_fill_rect(bc_ls013b7dh03_t *self, int left, int top, int width, int height, uint32_t color);
+
+//! @brief Lcd draw image, rows are copied to framebuffer byte-wise
+//! @param[in] self Instance
+//! @param[in] left Pixels from left edge
+//! @param[in] top Pixels from top edge
+//! @param[in] image Image rows of (width + 7) / 8 bytes, LSB first, pixels of set bits get color 1 (bc_image_t format)
+//! @param[in] width Image width, image has to fit into display
+//! @param[in] height Image height
+
+void bc_ls013b7dh03_blit(bc_ls013b7dh03_t *self, int left, int top, const uint8_t *image, int width, int height);
+
+//! @brief Lcd update, send modified lines
+//! @param[in] self Instance
+//!
+//! Only lines which have been modified since the last update are sent, a full frame is sent when most of lines
+//! have been modified.
 //! @return true On success
 //! @return false On failure
 
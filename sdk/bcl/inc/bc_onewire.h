@@ -9,6 +9,30 @@
 
 #define BC_ONEWIRE_DEVICE_NUMBER_SKIP_ROM 0
 
+//! @brief 1-Wire speed
+
+typedef enum
+{
+    //! @brief Standard speed (about 15 kbps)
+    BC_ONEWIRE_SPEED_STANDARD = 0,
+
+    //! @brief Overdrive speed (about 110 kbps)
+    BC_ONEWIRE_SPEED_OVERDRIVE = 1
+
+} bc_onewire_speed_t;
+
+//! @brief Callback events of asynchronous transfer
+
+typedef enum
+{
+    //! @brief Transfer is done (presence of device was detected for reset)
+    BC_ONEWIRE_ASYNC_EVENT_DONE = 0,
+
+    //! @brief Transfer failed (no presence for reset, bus stuck or timeout)
+    BC_ONEWIRE_ASYNC_EVENT_ERROR = 1
+
+} bc_onewire_async_event_t;
+
 //! @brief Initialize 1-Wire
 //! @param channel GPIO channel
 
@@ -41,11 +65,39 @@ bool bc_onewire_reset(bc_gpio_channel_t channel);
 
 void bc_onewire_select(bc_gpio_channel_t channel, uint64_t *device_number);
 
+//! @brief Resume ROM, select the device which was selected by the previous Match ROM again
+//! @param channel GPIO channel
+
+void bc_onewire_resume(bc_gpio_channel_t channel);
+
 //! @brief Skip ROM
 //! @param channel GPIO channel
 
 void bc_onewire_skip_rom(bc_gpio_channel_t channel);
 
+//! @brief Switch devices to overdrive speed, it uses Overdrive Skip ROM or Overdrive Match ROM
+//! @details Bus is reset at standard speed and devices are selected by overdrive command,
+//!          then presence of devices is checked by overdrive reset. Speed stays standard when it fails.
+//!          Devices fall back to standard speed on standard reset (e.g. after bc_onewire_set_speed with standard speed).
+//! @param channel GPIO channel
+//! @param[in] device_number Device number (for 0 all devices - Overdrive Skip ROM)
+//! @return true On success
+//! @return false On failure
+
+bool bc_onewire_overdrive_select(bc_gpio_channel_t channel, uint64_t *device_number);
+
+//! @brief Set speed of following communication on channel, other channels keep their speed
+//! @param[in] channel GPIO channel
+//! @param[in] speed Speed
+
+void bc_onewire_set_speed(bc_gpio_channel_t channel, bc_onewire_speed_t speed);
+
+//! @brief Get speed of communication on channel
+//! @param[in] channel GPIO channel
+//! @return Speed
+
+bc_onewire_speed_t bc_onewire_get_speed(bc_gpio_channel_t channel);
+
 //! @brief Select device
 //! @param channel GPIO channel
 //! @param[in] data Input data to be written
@@ -113,12 +165,72 @@ void bc_onewire_search_start(uint8_t family_code);
 
 bool bc_onewire_search_next(bc_gpio_channel_t channel, uint64_t *device_number);
 
+//! @brief Reset the 1-Wire bus asynchronously
+//! @details Asynchronous transfers are generated by hardware: time slots by TIM2 channel 1 and DMA channel 2,
+//!          bus is sampled by TIM2 channel 2 input capture and DMA channel 7. CPU can sleep meanwhile.
+//!          They are available only for channels P0 and P5 and they can't be used together with bc_pwm on TIM2
+//!          and bc_ws2812b. Only one asynchronous transfer can run at a time. Write and read fail while async write
+//!          to UART0 or UART1 holds DMA channel 7.
+//!          Callback is called from scheduler task.
+//! @param[in] channel GPIO channel
+//! @param[in] callback Function called when transfer is over
+//! @param[in] param Optional callback parameter (can be NULL)
+//! @return true On success
+//! @return false When channel is not supported or hardware is busy
+
+bool bc_onewire_async_reset(bc_gpio_channel_t channel, void (*callback)(bc_onewire_async_event_t, void *), void *param);
+
+//! @brief Write bytes asynchronously, see bc_onewire_async_reset
+//! @param[in] channel GPIO channel
+//! @param[in] buffer Data to be written, it must be valid until callback is called
+//! @param[in] length Number of bytes to be written
+//! @param[in] callback Function called when transfer is over
+//! @param[in] param Optional callback parameter (can be NULL)
+//! @return true On success
+//! @return false When channel is not supported or hardware is busy
+
+bool bc_onewire_async_write(bc_gpio_channel_t channel, const void *buffer, size_t length, void (*callback)(bc_onewire_async_event_t, void *), void *param);
+
+//! @brief Read bytes asynchronously, see bc_onewire_async_reset
+//! @param[in] channel GPIO channel
+//! @param[out] buffer Destination of data, it must be valid until callback is called
+//! @param[in] length Number of bytes to be read
+//! @param[in] callback Function called when transfer is over
+//! @param[in] param Optional callback parameter (can be NULL)
+//! @return true On success
+//! @return false When channel is not supported or hardware is busy
+
+bool bc_onewire_async_read(bc_gpio_channel_t channel, void *buffer, size_t length, void (*callback)(bc_onewire_async_event_t, void *), void *param);
+
+//! @brief Read one bit asynchronously, see bc_onewire_async_reset
+//! @param[in] channel GPIO channel
+//! @param[out] bit Destination of bit (0 or 1), it must be valid until callback is called
+//! @param[in] callback Function called when transfer is over
+//! @param[in] param Optional callback parameter (can be NULL)
+//! @return true On success
+//! @return false When channel is not supported or hardware is busy
+
+bool bc_onewire_async_read_bit(bc_gpio_channel_t channel, uint8_t *bit, void (*callback)(bc_onewire_async_event_t, void *), void *param);
+
+//! @brief Poll busy device and read bytes asynchronously, see bc_onewire_async_reset
+//! @details Read slots are generated by bytes until device releases bus in zero bit, the following slots are data.
+//!          Transfer fails when device is busy longer than 50 ms.
+//! @param[in] channel GPIO channel
+//! @param[out] buffer Destination of data, it must be valid until callback is called
+//! @param[in] length Number of bytes to be read
+//! @param[in] callback Function called when transfer is over
+//! @param[in] param Optional callback parameter (can be NULL)
+//! @return true On success
+//! @return false When channel is not supported or hardware is busy
+
+bool bc_onewire_async_poll_read(bc_gpio_channel_t channel, void *buffer, size_t length, void (*callback)(bc_onewire_async_event_t, void *), void *param);
+
 //! @brief Enable call sleep mode for all ds28e17 after transaction
 //! @param[in] on
 
 void bc_onewire_auto_ds28e17_sleep_mode(bool on);
 
-//! @brief Calculate 8-bit CRC
+//! @brief Calculate 8-bit CRC, same as bc_crc8_maxim
 //! @param[in] buffer
 //! @param[in] length Number of bytes
 //! @param[in] The crc starting value
@@ -126,7 +238,7 @@ void bc_onewire_auto_ds28e17_sleep_mode(bool on);
 
 uint8_t bc_onewire_crc8(const void *buffer, size_t length, uint8_t crc);
 
-//! @brief Calculate 16-bit CRC, polynomial 0x8005
+//! @brief Calculate 16-bit CRC, polynomial 0x8005, same as bc_crc16_ibm
 //! @param[in] buffer
 //! @param[in] length Number of bytes
 //! @param[in] The crc starting value
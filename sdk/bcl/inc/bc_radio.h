@@ -60,6 +60,8 @@ typedef enum
     BC_RADIO_EVENT_SCAN_FIND_DEVICE = 5,
     BC_RADIO_EVENT_PAIRED = 6,
     BC_RADIO_EVENT_UNPAIRED = 7,
+    BC_RADIO_EVENT_TX_DONE = 8,
+    BC_RADIO_EVENT_TX_ERROR = 9,
 
 } bc_radio_event_t;
 
@@ -162,6 +164,8 @@ uint64_t bc_radio_get_event_id(void);
 
 bool bc_radio_is_peer_device(uint64_t id);
 
+bool bc_radio_is_pub_queue_empty(void);
+
 bool bc_radio_pub_queue_put(const void *buffer, size_t length);
 
 void bc_radio_set_subs(bc_radio_sub_t *subs, int length);
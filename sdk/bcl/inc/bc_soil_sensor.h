@@ -76,6 +76,14 @@ typedef enum
 
 //! @brief Soil sensor instance
 
+//! @brief Address of enumeration cache which disables the cache
+
+#define BC_SOIL_SENSOR_CACHE_DISABLED 0xffffffff
+
+//! @brief Moisture value of sensor without valid measurement in bc_soil_sensor_get_moisture_all
+
+#define BC_SOIL_SENSOR_MOISTURE_INVALID INT16_MIN
+
 typedef struct bc_soil_sensor_t bc_soil_sensor_t;
 
 typedef struct bc_soil_sensor_sensor_t bc_soil_sensor_sensor_t;
@@ -123,7 +131,8 @@ typedef enum
     BC_SOIL_SENSOR_STATE_READY = 2,
     BC_SOIL_SENSOR_STATE_MEASURE = 3,
     BC_SOIL_SENSOR_STATE_READ = 4,
-    BC_SOIL_SENSOR_STATE_UPDATE = 5
+    BC_SOIL_SENSOR_STATE_UPDATE = 5,
+    BC_SOIL_SENSOR_STATE_READ_ASYNC = 6
 
 } bc_soil_sensor_state_t;
 
@@ -142,6 +151,12 @@ struct bc_soil_sensor_t
     int _sensor_count;
     int _sensor_found;
     bc_soil_sensor_error_t _error;
+    bool _overdrive;
+    uint32_t _cache_address;
+    bool _cache_valid;
+    int _fetch_index;
+    uint8_t _fetch_buffer[5];
+    bc_ds28e17_operation_t _fetch_operation[3];
 };
 
 struct bc_soil_sensor_sensor_t
@@ -152,6 +167,8 @@ struct bc_soil_sensor_sensor_t
     bool _cap_valid;
     uint16_t _cap_raw;
     bc_soil_sensor_eeprom_t _eeprom;
+    uint32_t _calibration_slope[10];
+    int16_t _temperature_coefficient;
 };
 
 //! @endcond
@@ -181,6 +198,22 @@ void bc_soil_sensor_set_event_handler(bc_soil_sensor_t *self, void (*event_handl
 
 void bc_soil_sensor_set_update_interval(bc_soil_sensor_t *self, bc_tick_t interval);
 
+//! @brief Enable or disable 1-Wire overdrive speed, it is enabled by default
+//! @details Sensors are switched to overdrive speed after enumeration. It should be disabled for long cables.
+//! @param[in] self Instance
+//! @param[in] on Enable overdrive
+
+void bc_soil_sensor_set_overdrive(bc_soil_sensor_t *self, bool on);
+
+//! @brief Set address of enumeration cache in MCU EEPROM
+//! @details Device numbers and calibration of found sensors are kept in cache, so initialization after boot or error
+//!          only verifies cached sensors instead of search and EEPROM reading. The cache is dropped and full search is done
+//!          when verification fails or when a sensor not in cache is found on the bus while free slots are left. The cache is below peer devices of bc_radio at the end of EEPROM by default and it takes 8 + 50 bytes per sensor.
+//! @param[in] self Instance
+//! @param[in] address Address in MCU EEPROM or BC_SOIL_SENSOR_CACHE_DISABLED
+
+void bc_soil_sensor_set_cache_address(bc_soil_sensor_t *self, uint32_t address);
+
 //! @brief Get sensors found
 //! @param[in] self Instance
 //! @return Number od found sensors
@@ -248,6 +281,24 @@ bool bc_soil_sensor_get_cap_raw(bc_soil_sensor_t *self, uint64_t device_address,
 
 bool bc_soil_sensor_get_moisture(bc_soil_sensor_t *self, uint64_t device_address, int *moisture);
 
+//! @brief Get measured moisture of all found sensors in tenths of percent
+//! @param[in] self Instance
+//! @param[out] moisture Array indexed by sensor index, BC_SOIL_SENSOR_MOISTURE_INVALID is stored for invalid value
+//! @param[in] count Size of array
+//! @return Number of stored values
+
+int bc_soil_sensor_get_moisture_all(bc_soil_sensor_t *self, int16_t *moisture, int count);
+
+//! @brief Set temperature coefficient of capacitance by device address
+//! @details Raw capacitance is corrected to 25 °C by temperature measured by the sensor before it is converted to moisture.
+//! @param[in] self Instance
+//! @param[in] device_address 64b device address
+//! @param[in] coefficient Change of raw capacitance per °C in 1/256 units
+//! @return true On success
+//! @return false When unknown device_address
+
+bool bc_soil_sensor_set_temperature_coefficient(bc_soil_sensor_t *self, uint64_t device_address, int16_t coefficient);
+
 //! @brief Get device index by its device address
 //! @param[in] self Instance
 //! @param[in] device_address 64b device address
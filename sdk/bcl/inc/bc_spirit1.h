@@ -88,6 +88,12 @@ void bc_spirit1_rx(void);
 
 void bc_spirit1_sleep(void);
 
+//! @brief Check whether transceiver transmits
+//! @return true If transmission is in progress or it has been requested
+//! @return false Otherwise
+
+bool bc_spirit1_is_tx(void);
+
 //! @}
 
 #endif // _BC_SPIRIT1_H
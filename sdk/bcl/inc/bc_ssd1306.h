@@ -84,6 +84,35 @@ void bc_ssd1306_draw_pixel(bc_ssd1306_t *self, int x, int y, uint32_t color);
 
 uint32_t bc_ssd1306_get_pixel(bc_ssd1306_t *self, int x, int y);
 
+//! @brief Lcd draw horizontal span
+//! @param[in] self Instance
+//! @param[in] left Pixels from left edge
+//! @param[in] top Pixels from top edge
+//! @param[in] width Span width, span has to fit into display
+//! @param[in] color Pixels state
+
+void bc_ssd1306_draw_hspan(bc_ssd1306_t *self, int left, int top, int width, uint32_t color);
+
+//! @brief Lcd fill rectangle, rows of page are written at once by byte mask
+//! @param[in] self Instance
+//! @param[in] left Pixels from left edge
+//! @param[in] top Pixels from top edge
+//! @param[in] width Rectangle width, rectangle has to fit into display
+//! @param[in] height Rectangle height
+//! @param[in] color Pixels state
+
+void bc_ssd1306_fill_rect(bc_ssd1306_t *self, int left, int top, int width, int height, uint32_t color);
+
+//! @brief Lcd draw image
+//! @param[in] self Instance
+//! @param[in] left Pixels from left edge
+//! @param[in] top Pixels from top edge
+//! @param[in] image Image rows of (width + 7) / 8 bytes, LSB first, pixels of set bits get color 1 (bc_image_t format)
+//! @param[in] width Image width, image has to fit into display
+//! @param[in] height Image height
+
+void bc_ssd1306_blit(bc_ssd1306_t *self, int left, int top, const uint8_t *image, int width, int height);
+
 //! @brief Lcd update, send data
 //! @param[in] self Instance
 //! @return true On success
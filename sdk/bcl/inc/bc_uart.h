@@ -6,6 +6,12 @@
 
 //! @addtogroup bc_uart bc_uart
 //! @brief Driver for UART (universal asynchronous receiver/transmitter)
+//! @details Async write is transmitted from FIFO by DMA and async read is received to FIFO by circular DMA, received
+//!          data are picked up on half transfer, transfer complete and idle line events. DMA channels used:
+//!          UART0 TX 7 and RX 6, UART1 TX 7 and RX 6, UART2 TX 4 and RX 3. UART0 and UART1 share DMA channels, the one
+//!          which starts transfer later uses interrupts, as does UART1 reception at 9600 bps (LPUART1). Write to UART0
+//!          or UART1 uses interrupts also while 1-Wire async transfer holds DMA channel 7 for capture of bit slots.
+//!          Write to UART2 uses interrupts while DAC channel 2 holds DMA channel 4.
 //! @{
 
 //! @brief UART channels
@@ -148,7 +154,7 @@ void bc_uart_init(bc_uart_channel_t channel, bc_uart_baudrate_t baudrate, bc_uar
 
 void bc_uart_deinit(bc_uart_channel_t channel);
 
-//! @brief Write data to UART channel (blocking call)
+//! @brief Write data to UART channel (blocking call), data waiting for async transmission are written first
 //! @param[in] channel UART channel
 //! @param[in] buffer Pointer to source buffer
 //! @param[in] length Number of bytes to be written
@@ -187,6 +193,14 @@ void bc_uart_set_async_fifo(bc_uart_channel_t channel, bc_fifo_t *write_fifo, bc
 
 size_t bc_uart_async_write(bc_uart_channel_t channel, const void *buffer, size_t length);
 
+//! @brief Transmit data waiting in async write FIFO by polling and finish async write
+//! @param[in] channel UART channel
+//!
+//! It does not rely on interrupts or scheduler, so it can be used from fault handlers. Interrupts are disabled
+//! until the whole FIFO is transmitted, so it is not meant for regular use.
+
+void bc_uart_async_write_flush(bc_uart_channel_t channel);
+
 //! @brief Start async reading
 //! @param[in] channel UART channel
 //! @param[in] timeout Maximum timeout in ms
@@ -5,6 +5,9 @@
 
 //! @addtogroup bc_ws2812b bc_ws2812b
 //! @brief Driver for led strip ws2812b
+//! @details Pixels are kept in buffer of bc_led_strip_buffer_t as count * type color bytes. They are encoded into
+//!          timer compare values on the fly, DMA channel 2 sends a circular window of 128 values and every half of
+//!          it is refilled from DMA interrupt after it has been sent.
 //! @{
 
 //! @cond
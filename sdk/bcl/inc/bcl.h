@@ -20,6 +20,7 @@
 #include <bc_gpio.h>
 #include <bc_i2c.h>
 #include <bc_led.h>
+#include <bc_lptim.h>
 #include <bc_rtc.h>
 #include <bc_uart.h>
 #include <bc_spi.h>
@@ -73,6 +74,7 @@
 #include <bc_font_common.h>
 #include <bc_image.h>
 #include <bc_system.h>
+#include <bc_energy.h>
 #include <bc_switch.h>
 #include <bc_timer.h>
 #include <bc_error.h>
@@ -80,6 +82,8 @@
 #include <bc_gfx.h>
 #include <bc_atci.h>
 #include <bc_base64.h>
+#include <bc_crc.h>
+#include <bc_kv.h>
 
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 
@@ -36,6 +36,7 @@ static struct
     bool initialized;
     bc_adc_channel_t channel_in_progress;
     uint16_t vrefint;
+    uint16_t vrefint_value;
     float real_vdda_voltage;
     bc_adc_state_t state;
     bc_scheduler_task_id_t task_id;
@@ -300,8 +301,8 @@ void ADC1_COMP_IRQHandler(void)
     // Get real VDDA and begin analog channel measurement
     if (_bc_adc.state == BC_ADC_STATE_CALIBRATION_BY_INTERNAL_REFERENCE_END)
     {
-        // Compute actual VDDA
-        _bc_adc.real_vdda_voltage = 3.f * ((float) _bc_adc.vrefint / (float) ADC1->DR);
+        // Store internal reference, VDDA is computed in task
+        _bc_adc.vrefint_value = ADC1->DR;
 
         _bc_adc_configure_oversampling(_bc_adc.channel_table[_bc_adc.channel_in_progress].oversampling);
         _bc_adc_configure_resolution(_bc_adc.channel_table[_bc_adc.channel_in_progress].resolution);
@@ -392,6 +393,9 @@ static void _bc_adc_task(void *param)
     bc_adc_channel_t pending_result_channel;
     bc_adc_channel_t next;
 
+    // Compute actual VDDA
+    _bc_adc.real_vdda_voltage = 3.f * ((float) _bc_adc.vrefint / (float) _bc_adc.vrefint_value);
+
     // Update pending channel result
     pending_result_channel = _bc_adc.channel_in_progress;
 
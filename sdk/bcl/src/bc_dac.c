@@ -197,6 +197,12 @@ bool bc_dac_async_run(bc_dac_channel_t channel)
         return false;
     }
 
+    // DMA channel of DAC channel 2 is shared with UART2 transmission
+    if (!bc_dma_channel_claim(dac_channel_setup->dma_channel, dac_channel_setup))
+    {
+        return false;
+    }
+
     bc_system_pll_enable();
 
     if (channel == BC_DAC_DAC0)
@@ -275,6 +281,8 @@ void bc_dac_async_stop(bc_dac_channel_t channel)
 
     bc_dma_channel_stop(dac_channel_setup->dma_channel);
 
+    bc_dma_channel_release(dac_channel_setup->dma_channel, dac_channel_setup);
+
     if (channel == BC_DAC_DAC0)
     {
         DAC->CR &= ~(DAC_CR_DMAEN1_Msk | DAC_CR_TEN1_Msk | DAC_CR_TSEL1_Msk);
@@ -10,6 +10,7 @@
         if ((DMA1->ISR & DMA_ISR_TEIF##__CHANNEL) != 0) \
         { \
             _bc_dma_irq_handler(BC_DMA_CHANNEL_##__CHANNEL, BC_DMA_EVENT_ERROR); \
+            DMA1->IFCR |= DMA_IFCR_CTEIF##__CHANNEL; \
         } \
         else if ((DMA1->ISR & DMA_ISR_HTIF##__CHANNEL) != 0) \
         { \
@@ -41,6 +42,8 @@ static struct
         DMA_Channel_TypeDef *instance;
         void (*event_handler)(bc_dma_channel_t, bc_dma_event_t, void *);
         void *event_param;
+        bool irq_context;
+        const void *owner;
 
     } channel[7];
 
@@ -172,8 +175,24 @@ void bc_dma_channel_config(bc_dma_channel_t channel, bc_dma_channel_config_t *co
 
 void bc_dma_set_event_handler(bc_dma_channel_t channel, void (*event_handler)(bc_dma_channel_t, bc_dma_event_t, void *), void *event_param)
 {
+    bc_irq_disable();
+
     _bc_dma.channel[channel].event_handler = event_handler;
     _bc_dma.channel[channel].event_param = event_param;
+    _bc_dma.channel[channel].irq_context = false;
+
+    bc_irq_enable();
+}
+
+void bc_dma_set_irq_event_handler(bc_dma_channel_t channel, void (*event_handler)(bc_dma_channel_t, bc_dma_event_t, void *), void *event_param)
+{
+    bc_irq_disable();
+
+    _bc_dma.channel[channel].event_handler = event_handler;
+    _bc_dma.channel[channel].event_param = event_param;
+    _bc_dma.channel[channel].irq_context = true;
+
+    bc_irq_enable();
 }
 
 void bc_dma_channel_run(bc_dma_channel_t channel)
@@ -191,6 +210,36 @@ size_t bc_dma_channel_get_length(bc_dma_channel_t channel)
     return (size_t) _bc_dma.channel[channel].instance->CNDTR;
 }
 
+bool bc_dma_channel_claim(bc_dma_channel_t channel, const void *owner)
+{
+    bc_irq_disable();
+
+    if (_bc_dma.channel[channel].owner != NULL && _bc_dma.channel[channel].owner != owner)
+    {
+        bc_irq_enable();
+
+        return false;
+    }
+
+    _bc_dma.channel[channel].owner = owner;
+
+    bc_irq_enable();
+
+    return true;
+}
+
+void bc_dma_channel_release(bc_dma_channel_t channel, const void *owner)
+{
+    bc_irq_disable();
+
+    if (_bc_dma.channel[channel].owner == owner)
+    {
+        _bc_dma.channel[channel].owner = NULL;
+    }
+
+    bc_irq_enable();
+}
+
 void _bc_dma_task(void *param)
 {
     (void) param;
@@ -213,6 +262,17 @@ void _bc_dma_irq_handler(bc_dma_channel_t channel, bc_dma_event_t event)
         bc_dma_channel_stop(channel);
     }
 
+    // Handler which refills circular transfer can't wait for scheduler
+    if (_bc_dma.channel[channel].irq_context)
+    {
+        if (_bc_dma.channel[channel].event_handler != NULL)
+        {
+            _bc_dma.channel[channel].event_handler(channel, event, _bc_dma.channel[channel].event_param);
+        }
+
+        return;
+    }
+
     bc_dma_pending_event_t pending_event = { channel, event };
 
     bc_fifo_irq_write(&_bc_dma.fifo_pending, &pending_event, sizeof(bc_dma_pending_event_t));
@@ -1,6 +1,7 @@
 #include <bc_ds28e17.h>
 #include <bc_tick.h>
 #include <bc_log.h>
+#include <bc_crc.h>
 
 static const bc_gpio_channel_t _bc_ds28e17_set_speed_lut[2] =
 {
@@ -8,8 +9,57 @@ static const bc_gpio_channel_t _bc_ds28e17_set_speed_lut[2] =
         [BC_I2C_SPEED_400_KHZ] = 0x01
 };
 
-static bool _bc_ds28e17_write(bc_ds28e17_t *self, uint8_t *head, size_t head_length, void *buffer, size_t length);
-static bool _bc_ds28e17_read(bc_ds28e17_t *self, uint8_t *head, size_t head_length, void *buffer, size_t length);
+typedef enum
+{
+    _BC_DS28E17_ASYNC_STATE_WAKE_UP = 0,
+    _BC_DS28E17_ASYNC_STATE_RESET = 1,
+    _BC_DS28E17_ASYNC_STATE_COMMAND = 2,
+    _BC_DS28E17_ASYNC_STATE_DATA = 3,
+    _BC_DS28E17_ASYNC_STATE_CRC = 4,
+    _BC_DS28E17_ASYNC_STATE_STATUS = 5,
+    _BC_DS28E17_ASYNC_STATE_READ = 6
+
+} _bc_ds28e17_async_state_t;
+
+static struct
+{
+    bool busy;
+    bc_ds28e17_t *self;
+    _bc_ds28e17_async_state_t state;
+    bool write;
+
+    // Match ROM, device number and head of I2C command
+    uint8_t command[1 + 8 + 6];
+    size_t command_length;
+    void *buffer;
+    size_t length;
+    uint16_t crc16;
+    uint8_t status[2];
+    bool write_status;
+
+    // Operations are executed in one 1-Wire transaction, the following ones select bridge by Resume ROM
+    const bc_ds28e17_operation_t *operation;
+    int count;
+    int done;
+
+    // Operation of single transfer functions
+    bc_ds28e17_operation_t single;
+
+    void (*callback)(bc_ds28e17_t *, bc_ds28e17_event_t, void *);
+    void *param;
+
+} _bc_ds28e17_async;
+
+static bool _bc_ds28e17_transfer(bc_ds28e17_t *self, uint8_t *head, size_t head_length, void *buffer, size_t length);
+static bool _bc_ds28e17_command(bc_ds28e17_t *self, bool resume, uint8_t *head, size_t head_length, void *buffer, size_t length);
+static size_t _bc_ds28e17_memory_write_head(uint8_t *head, const bc_i2c_memory_transfer_t *transfer);
+static size_t _bc_ds28e17_memory_read_head(uint8_t *head, const bc_i2c_memory_transfer_t *transfer);
+static size_t _bc_ds28e17_operation_head(uint8_t *head, const bc_ds28e17_operation_t *operation);
+static bool _bc_ds28e17_async_start(bc_ds28e17_t *self, const bc_ds28e17_operation_t *operation, int count, void (*callback)(bc_ds28e17_t *, bc_ds28e17_event_t, void *), void *param);
+static bool _bc_ds28e17_async_prepare(bool resume);
+static void _bc_ds28e17_async_continue(void);
+static void _bc_ds28e17_async_handler(bc_onewire_async_event_t event, void *param);
+static void _bc_ds28e17_async_finish(bc_ds28e17_event_t event);
 
 void bc_ds28e17_init(bc_ds28e17_t *self, bc_gpio_channel_t channel, uint64_t device_number)
 {
@@ -36,7 +86,10 @@ uint64_t bc_ds28e17_get_device_number(bc_ds28e17_t *self)
 
 bool bc_ds28e17_set_speed(bc_ds28e17_t *self, bc_i2c_speed_t speed)
 {
-    bc_onewire_transaction_start(self->_channel);
+    if (!bc_onewire_transaction_start(self->_channel))
+    {
+        return false;
+    }
 
     if (!bc_onewire_reset(self->_channel))
     {
@@ -67,7 +120,7 @@ bool bc_ds28e17_write(bc_ds28e17_t *self, const bc_i2c_transfer_t *transfer)
     head[1] = transfer->device_address << 1;
     head[2] = (uint8_t) transfer->length;
 
-    return _bc_ds28e17_write(self, head, sizeof(head), transfer->buffer, transfer->length);
+    return _bc_ds28e17_transfer(self, head, sizeof(head), transfer->buffer, transfer->length);
 }
 
 bool bc_ds28e17_read(bc_ds28e17_t *self, const bc_i2c_transfer_t *transfer)
@@ -78,83 +131,268 @@ bool bc_ds28e17_read(bc_ds28e17_t *self, const bc_i2c_transfer_t *transfer)
     head[1] = (transfer->device_address << 1) | 0x01;
     head[2] = (uint8_t) transfer->length;
 
-    return _bc_ds28e17_read(self, head, sizeof(head), transfer->buffer, transfer->length);
+    return _bc_ds28e17_transfer(self, head, sizeof(head), transfer->buffer, transfer->length);
 }
 
 bool bc_ds28e17_memory_write(bc_ds28e17_t *self, const bc_i2c_memory_transfer_t *transfer)
 {
-    size_t head_length;
     uint8_t head[5];
 
+    size_t head_length = _bc_ds28e17_memory_write_head(head, transfer);
+
+    return _bc_ds28e17_transfer(self, head, head_length, transfer->buffer, transfer->length);
+}
+
+bool bc_ds28e17_memory_read(bc_ds28e17_t *self, const bc_i2c_memory_transfer_t *transfer)
+{
+    uint8_t head[6];
+
+    size_t head_length = _bc_ds28e17_memory_read_head(head, transfer);
+
+    return _bc_ds28e17_transfer(self, head, head_length, transfer->buffer, transfer->length);
+}
+
+int bc_ds28e17_execute(bc_ds28e17_t *self, const bc_ds28e17_operation_t *operation, int count)
+{
+    uint8_t head[6];
+    size_t head_length;
+    int done;
+
+    if (!bc_onewire_transaction_start(self->_channel))
+    {
+        return 0;
+    }
+
+    for (done = 0; done < count; done++, operation++)
+    {
+        head_length = _bc_ds28e17_operation_head(head, operation);
+
+        if ((head_length == 0) || !_bc_ds28e17_command(self, done != 0, head, head_length, operation->buffer, operation->length))
+        {
+            break;
+        }
+    }
+
+    bc_onewire_transaction_stop(self->_channel);
+
+    return done;
+}
+
+bool bc_ds28e17_async_execute(bc_ds28e17_t *self, const bc_ds28e17_operation_t *operation, int count, void (*callback)(bc_ds28e17_t *, bc_ds28e17_event_t, void *), void *param)
+{
+    if (_bc_ds28e17_async.busy || (count <= 0))
+    {
+        return false;
+    }
+
+    return _bc_ds28e17_async_start(self, operation, count, callback, param);
+}
+
+int bc_ds28e17_async_get_done(bc_ds28e17_t *self)
+{
+    (void) self;
+
+    return _bc_ds28e17_async.done;
+}
+
+bool bc_ds28e17_async_write(bc_ds28e17_t *self, const bc_i2c_transfer_t *transfer, void (*callback)(bc_ds28e17_t *, bc_ds28e17_event_t, void *), void *param)
+{
+    if (_bc_ds28e17_async.busy)
+    {
+        return false;
+    }
+
+    _bc_ds28e17_async.single.type = BC_DS28E17_OPERATION_WRITE;
+    _bc_ds28e17_async.single.device_address = transfer->device_address;
+    _bc_ds28e17_async.single.buffer = transfer->buffer;
+    _bc_ds28e17_async.single.length = transfer->length;
+
+    return _bc_ds28e17_async_start(self, &_bc_ds28e17_async.single, 1, callback, param);
+}
+
+bool bc_ds28e17_async_read(bc_ds28e17_t *self, const bc_i2c_transfer_t *transfer, void (*callback)(bc_ds28e17_t *, bc_ds28e17_event_t, void *), void *param)
+{
+    if (_bc_ds28e17_async.busy)
+    {
+        return false;
+    }
+
+    _bc_ds28e17_async.single.type = BC_DS28E17_OPERATION_READ;
+    _bc_ds28e17_async.single.device_address = transfer->device_address;
+    _bc_ds28e17_async.single.buffer = transfer->buffer;
+    _bc_ds28e17_async.single.length = transfer->length;
+
+    return _bc_ds28e17_async_start(self, &_bc_ds28e17_async.single, 1, callback, param);
+}
+
+bool bc_ds28e17_async_memory_write(bc_ds28e17_t *self, const bc_i2c_memory_transfer_t *transfer, void (*callback)(bc_ds28e17_t *, bc_ds28e17_event_t, void *), void *param)
+{
+    if (_bc_ds28e17_async.busy)
+    {
+        return false;
+    }
+
+    _bc_ds28e17_async.single.type = BC_DS28E17_OPERATION_MEMORY_WRITE;
+    _bc_ds28e17_async.single.device_address = transfer->device_address;
+    _bc_ds28e17_async.single.memory_address = transfer->memory_address;
+    _bc_ds28e17_async.single.buffer = transfer->buffer;
+    _bc_ds28e17_async.single.length = transfer->length;
+
+    return _bc_ds28e17_async_start(self, &_bc_ds28e17_async.single, 1, callback, param);
+}
+
+bool bc_ds28e17_async_memory_read(bc_ds28e17_t *self, const bc_i2c_memory_transfer_t *transfer, void (*callback)(bc_ds28e17_t *, bc_ds28e17_event_t, void *), void *param)
+{
+    if (_bc_ds28e17_async.busy)
+    {
+        return false;
+    }
+
+    _bc_ds28e17_async.single.type = BC_DS28E17_OPERATION_MEMORY_READ;
+    _bc_ds28e17_async.single.device_address = transfer->device_address;
+    _bc_ds28e17_async.single.memory_address = transfer->memory_address;
+    _bc_ds28e17_async.single.buffer = transfer->buffer;
+    _bc_ds28e17_async.single.length = transfer->length;
+
+    return _bc_ds28e17_async_start(self, &_bc_ds28e17_async.single, 1, callback, param);
+}
+
+static size_t _bc_ds28e17_memory_write_head(uint8_t *head, const bc_i2c_memory_transfer_t *transfer)
+{
     head[0] = 0x4B;
     head[1] = transfer->device_address << 1;
 
     if ((transfer->memory_address & BC_I2C_MEMORY_ADDRESS_16_BIT) != 0)
     {
-        head_length = 5;
         head[2] = (uint8_t) transfer->length + 2;
         head[3] = transfer->memory_address >> 8;
         head[4] = transfer->memory_address;
-    }
-    else
-    {
-        head_length = 4;
-        head[2] = (uint8_t) transfer->length + 1;
-        head[3] = (uint8_t) transfer->memory_address;
+
+        return 5;
     }
 
-    return _bc_ds28e17_write(self, head, head_length, transfer->buffer, transfer->length);
+    head[2] = (uint8_t) transfer->length + 1;
+    head[3] = (uint8_t) transfer->memory_address;
+
+    return 4;
 }
 
-bool bc_ds28e17_memory_read(bc_ds28e17_t *self, const bc_i2c_memory_transfer_t *transfer)
+static size_t _bc_ds28e17_memory_read_head(uint8_t *head, const bc_i2c_memory_transfer_t *transfer)
 {
-    size_t head_length;
-    uint8_t head[6];
-
     head[0] = 0x2D;
     head[1] = transfer->device_address << 1;
 
     if ((transfer->memory_address & BC_I2C_MEMORY_ADDRESS_16_BIT) != 0)
     {
-        head_length = 6;
         head[2] = 2;
         head[3] = transfer->memory_address >> 8;
         head[4] = transfer->memory_address;
         head[5] = transfer->length;
+
+        return 6;
     }
-    else
+
+    head[2] = 1;
+    head[3] = transfer->memory_address;
+    head[4] = transfer->length;
+
+    return 5;
+}
+
+static size_t _bc_ds28e17_operation_head(uint8_t *head, const bc_ds28e17_operation_t *operation)
+{
+    bc_i2c_memory_transfer_t transfer = {
+        .device_address = operation->device_address,
+        .memory_address = operation->memory_address,
+        .buffer = operation->buffer,
+        .length = operation->length
+    };
+
+    switch (operation->type)
+    {
+        case BC_DS28E17_OPERATION_WRITE:
+        {
+            head[0] = 0x4B;
+            head[1] = transfer.device_address << 1;
+            head[2] = (uint8_t) transfer.length;
+
+            return 3;
+        }
+        case BC_DS28E17_OPERATION_READ:
+        {
+            head[0] = 0x87;
+            head[1] = (transfer.device_address << 1) | 0x01;
+            head[2] = (uint8_t) transfer.length;
+
+            return 3;
+        }
+        case BC_DS28E17_OPERATION_MEMORY_WRITE:
+        {
+            return _bc_ds28e17_memory_write_head(head, &transfer);
+        }
+        case BC_DS28E17_OPERATION_MEMORY_READ:
+        {
+            return _bc_ds28e17_memory_read_head(head, &transfer);
+        }
+        default:
+        {
+            return 0;
+        }
+    }
+}
+
+static bool _bc_ds28e17_transfer(bc_ds28e17_t *self, uint8_t *head, size_t head_length, void *buffer, size_t length)
+{
+    if (!bc_onewire_transaction_start(self->_channel))
     {
-        head_length = 5;
-        head[2] = 1;
-        head[3] = transfer->memory_address;
-        head[4] = transfer->length;
+        return false;
     }
 
-    return _bc_ds28e17_read(self, head, head_length, transfer->buffer, transfer->length);
+    bool success = _bc_ds28e17_command(self, false, head, head_length, buffer, length);
+
+    bc_onewire_transaction_stop(self->_channel);
+
+    return success;
 }
 
-static bool _bc_ds28e17_write(bc_ds28e17_t *self, uint8_t *head, size_t head_length, void *buffer, size_t length)
+static bool _bc_ds28e17_command(bc_ds28e17_t *self, bool resume, uint8_t *head, size_t head_length, void *buffer, size_t length)
 {
-    bc_onewire_transaction_start(self->_channel);
+    bool write = head[0] == 0x4B;
 
-    bc_onewire_reset(self->_channel);
+    // The first reset wakes up the bridge, it stays awake until the end of transaction
+    if (!resume)
+    {
+        bc_onewire_reset(self->_channel);
+    }
 
     if (!bc_onewire_reset(self->_channel))
     {
-        bc_onewire_transaction_stop(self->_channel);
-
         return false;
     }
 
-    uint16_t crc16 = bc_onewire_crc16(head, head_length, 0x00);
+    uint16_t crc16 = bc_crc16_ibm(head, head_length, 0x00);
 
-    crc16 = bc_onewire_crc16(buffer, length, crc16);
+    if (write)
+    {
+        crc16 = bc_crc16_ibm(buffer, length, crc16);
+    }
 
-    bc_onewire_select(self->_channel, &self->_device_number);
+    // Bridge selected by the previous command is selected again without its device number
+    if (resume)
+    {
+        bc_onewire_resume(self->_channel);
+    }
+    else
+    {
+        bc_onewire_select(self->_channel, &self->_device_number);
+    }
 
     bc_onewire_write(self->_channel, head, head_length);
 
-    bc_onewire_write(self->_channel, buffer, length);
+    if (write)
+    {
+        bc_onewire_write(self->_channel, buffer, length);
+    }
 
     crc16 = ~crc16;
 
@@ -166,8 +404,6 @@ static bool _bc_ds28e17_write(bc_ds28e17_t *self, uint8_t *head, size_t head_len
     {
         if (timeout < bc_tick_get())
         {
-            bc_onewire_transaction_stop(self->_channel);
-
             return false;
         }
 
@@ -176,64 +412,230 @@ static bool _bc_ds28e17_write(bc_ds28e17_t *self, uint8_t *head, size_t head_len
 
     uint8_t status = bc_onewire_read_8b(self->_channel);
 
-    uint8_t write_status = bc_onewire_read_8b(self->_channel);
+    uint8_t write_status = head[0] == 0x87 ? 0 : bc_onewire_read_8b(self->_channel);
 
-    bc_onewire_transaction_stop(self->_channel);
+    if ((status != 0x00) || (write_status != 0x00))
+    {
+        return false;
+    }
+
+    if (!write)
+    {
+        bc_onewire_read(self->_channel, buffer, length);
+    }
 
-    return (status == 0x00) && (write_status == 0x00);
+    return true;
 }
 
-static bool _bc_ds28e17_read(bc_ds28e17_t *self, uint8_t *head, size_t head_length, void *buffer, size_t length)
+static bool _bc_ds28e17_async_start(bc_ds28e17_t *self, const bc_ds28e17_operation_t *operation, int count, void (*callback)(bc_ds28e17_t *, bc_ds28e17_event_t, void *), void *param)
 {
-    bc_onewire_transaction_start(self->_channel);
+    _bc_ds28e17_async.self = self;
+    _bc_ds28e17_async.operation = operation;
+    _bc_ds28e17_async.count = count;
+    _bc_ds28e17_async.done = 0;
+    _bc_ds28e17_async.callback = callback;
+    _bc_ds28e17_async.param = param;
+
+    if (!_bc_ds28e17_async_prepare(false))
+    {
+        return false;
+    }
 
-    bc_onewire_reset(self->_channel);
+    if (!bc_onewire_async_reset(self->_channel, _bc_ds28e17_async_handler, NULL))
+    {
+        return false;
+    }
 
-    if (!bc_onewire_reset(self->_channel))
+    _bc_ds28e17_async.busy = true;
+
+    return true;
+}
+
+static bool _bc_ds28e17_async_prepare(bool resume)
+{
+    const bc_ds28e17_operation_t *operation = &_bc_ds28e17_async.operation[_bc_ds28e17_async.done];
+
+    uint8_t *command = _bc_ds28e17_async.command;
+
+    size_t select_length;
+
+    // Bridge selected by the previous command is selected again without its device number
+    if (resume)
     {
-        bc_onewire_transaction_stop(self->_channel);
+        command[0] = 0xA5;
+
+        select_length = 1;
+    }
+    else
+    {
+        command[0] = 0x55;
+
+        memcpy(&command[1], &_bc_ds28e17_async.self->_device_number, 8);
+
+        select_length = 9;
+    }
+
+    uint8_t *head = &command[select_length];
+
+    size_t head_length = _bc_ds28e17_operation_head(head, operation);
 
+    if (head_length == 0)
+    {
         return false;
     }
 
-    uint16_t crc16 = bc_onewire_crc16(head, head_length, 0x00);
+    _bc_ds28e17_async.command_length = select_length + head_length;
+    _bc_ds28e17_async.write = head[0] == 0x4B;
+    _bc_ds28e17_async.buffer = operation->buffer;
+    _bc_ds28e17_async.length = operation->length;
 
-    bc_onewire_select(self->_channel, &self->_device_number);
+    // Read only command has no write status
+    _bc_ds28e17_async.write_status = head[0] != 0x87;
 
-    bc_onewire_write(self->_channel, head, head_length);
+    uint16_t crc16 = bc_crc16_ibm(head, head_length, 0x00);
 
-    crc16 = ~crc16;
+    if (_bc_ds28e17_async.write)
+    {
+        crc16 = bc_crc16_ibm(operation->buffer, operation->length, crc16);
+    }
 
-    bc_onewire_write(self->_channel, &crc16, sizeof(crc16));
+    _bc_ds28e17_async.crc16 = ~crc16;
 
-    bc_tick_t timeout = bc_tick_get() + 50;
+    // The first reset wakes up the bridge and its result is not checked, bridge stays awake for following operations
+    _bc_ds28e17_async.state = resume ? _BC_DS28E17_ASYNC_STATE_RESET : _BC_DS28E17_ASYNC_STATE_WAKE_UP;
 
-    while (bc_onewire_read_bit(self->_channel) != 0)
+    return true;
+}
+
+static void _bc_ds28e17_async_continue(void)
+{
+    if (++_bc_ds28e17_async.done == _bc_ds28e17_async.count)
     {
-        if (timeout < bc_tick_get())
-        {
-            bc_onewire_transaction_stop(self->_channel);
+        _bc_ds28e17_async_finish(BC_DS28E17_EVENT_DONE);
 
-            return false;
-        }
+        return;
+    }
 
-        continue;
+    if (!_bc_ds28e17_async_prepare(true) || !bc_onewire_async_reset(_bc_ds28e17_async.self->_channel, _bc_ds28e17_async_handler, NULL))
+    {
+        _bc_ds28e17_async_finish(BC_DS28E17_EVENT_ERROR);
     }
+}
 
-    uint8_t status = bc_onewire_read_8b(self->_channel);
+static void _bc_ds28e17_async_handler(bc_onewire_async_event_t event, void *param)
+{
+    (void) param;
 
-    uint8_t write_status = head[0] == 0x87 ? 0 : bc_onewire_read_8b(self->_channel);
+    bc_gpio_channel_t channel = _bc_ds28e17_async.self->_channel;
 
-    if ((status != 0x00) || (write_status != 0x00))
+    bool started;
+
+    if ((event == BC_ONEWIRE_ASYNC_EVENT_ERROR) && (_bc_ds28e17_async.state != _BC_DS28E17_ASYNC_STATE_WAKE_UP))
     {
-        bc_onewire_transaction_stop(self->_channel);
+        _bc_ds28e17_async_finish(BC_DS28E17_EVENT_ERROR);
 
-        return false;
+        return;
     }
 
-    bc_onewire_read(self->_channel, buffer, length);
+    switch (_bc_ds28e17_async.state)
+    {
+        case _BC_DS28E17_ASYNC_STATE_WAKE_UP:
+        {
+            _bc_ds28e17_async.state = _BC_DS28E17_ASYNC_STATE_RESET;
+
+            started = bc_onewire_async_reset(channel, _bc_ds28e17_async_handler, NULL);
 
-    bc_onewire_transaction_stop(self->_channel);
+            break;
+        }
+        case _BC_DS28E17_ASYNC_STATE_RESET:
+        {
+            _bc_ds28e17_async.state = _BC_DS28E17_ASYNC_STATE_COMMAND;
 
-    return true;
+            started = bc_onewire_async_write(channel, _bc_ds28e17_async.command, _bc_ds28e17_async.command_length, _bc_ds28e17_async_handler, NULL);
+
+            break;
+        }
+        case _BC_DS28E17_ASYNC_STATE_COMMAND:
+        {
+            if (_bc_ds28e17_async.write && (_bc_ds28e17_async.length != 0))
+            {
+                _bc_ds28e17_async.state = _BC_DS28E17_ASYNC_STATE_DATA;
+
+                started = bc_onewire_async_write(channel, _bc_ds28e17_async.buffer, _bc_ds28e17_async.length, _bc_ds28e17_async_handler, NULL);
+
+                break;
+            }
+        }
+        // Falls through, there is no data to write
+        case _BC_DS28E17_ASYNC_STATE_DATA:
+        {
+            _bc_ds28e17_async.state = _BC_DS28E17_ASYNC_STATE_CRC;
+
+            started = bc_onewire_async_write(channel, &_bc_ds28e17_async.crc16, sizeof(_bc_ds28e17_async.crc16), _bc_ds28e17_async_handler, NULL);
+
+            break;
+        }
+        case _BC_DS28E17_ASYNC_STATE_CRC:
+        {
+            _bc_ds28e17_async.status[1] = 0;
+
+            _bc_ds28e17_async.state = _BC_DS28E17_ASYNC_STATE_STATUS;
+
+            size_t length = _bc_ds28e17_async.write_status ? 2 : 1;
+
+            // Bridge holds bus in ones while I2C transfer is running, status follows
+            started = bc_onewire_async_poll_read(channel, _bc_ds28e17_async.status, length, _bc_ds28e17_async_handler, NULL);
+
+            break;
+        }
+        case _BC_DS28E17_ASYNC_STATE_STATUS:
+        {
+            if ((_bc_ds28e17_async.status[0] != 0x00) || (_bc_ds28e17_async.status[1] != 0x00))
+            {
+                _bc_ds28e17_async_finish(BC_DS28E17_EVENT_ERROR);
+
+                return;
+            }
+
+            if (_bc_ds28e17_async.write || (_bc_ds28e17_async.length == 0))
+            {
+                _bc_ds28e17_async_continue();
+
+                return;
+            }
+
+            _bc_ds28e17_async.state = _BC_DS28E17_ASYNC_STATE_READ;
+
+            started = bc_onewire_async_read(channel, _bc_ds28e17_async.buffer, _bc_ds28e17_async.length, _bc_ds28e17_async_handler, NULL);
+
+            break;
+        }
+        case _BC_DS28E17_ASYNC_STATE_READ:
+        {
+            _bc_ds28e17_async_continue();
+
+            return;
+        }
+        default:
+        {
+            started = false;
+
+            break;
+        }
+    }
+
+    if (!started)
+    {
+        _bc_ds28e17_async_finish(BC_DS28E17_EVENT_ERROR);
+    }
+}
+
+static void _bc_ds28e17_async_finish(bc_ds28e17_event_t event)
+{
+    _bc_ds28e17_async.busy = false;
+
+    if (_bc_ds28e17_async.callback != NULL)
+    {
+        _bc_ds28e17_async.callback(_bc_ds28e17_async.self, event, _bc_ds28e17_async.param);
+    }
 }
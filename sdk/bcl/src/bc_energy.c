@@ -0,0 +1,243 @@
+#include <bc_energy.h>
+#include <bc_lptim.h>
+#include <bc_scheduler.h>
+#include <bc_irq.h>
+
+// Default currents (uA) of a core module with battery module
+#ifndef BC_ENERGY_CURRENT_BASE
+#define BC_ENERGY_CURRENT_BASE 8
+#endif
+
+#ifndef BC_ENERGY_CURRENT_MCU_RUN
+#define BC_ENERGY_CURRENT_MCU_RUN 350
+#endif
+
+#ifndef BC_ENERGY_CURRENT_PLL
+#define BC_ENERGY_CURRENT_PLL 6500
+#endif
+
+#ifndef BC_ENERGY_CURRENT_RADIO_TX
+#define BC_ENERGY_CURRENT_RADIO_TX 21000
+#endif
+
+#ifndef BC_ENERGY_CURRENT_RADIO_RX
+#define BC_ENERGY_CURRENT_RADIO_RX 9000
+#endif
+
+#ifndef BC_ENERGY_CURRENT_ONEWIRE
+#define BC_ENERGY_CURRENT_ONEWIRE 1500
+#endif
+
+// Counter of LPTIM1 overflows after 64 s, accounting must be updated more often
+#define _BC_ENERGY_MAX_UPDATE_INTERVAL (30 * 1000)
+
+static struct
+{
+    bool initialized;
+    uint16_t counter;
+    uint8_t count[BC_ENERGY_SUBSYSTEM_COUNT];
+    uint32_t current[BC_ENERGY_SUBSYSTEM_COUNT];
+    uint64_t on_time[BC_ENERGY_SUBSYSTEM_COUNT];
+    void (*event_handler)(bc_energy_event_t, void *);
+    void *event_param;
+    bc_tick_t update_interval;
+    bc_tick_t tick_update;
+    bc_scheduler_task_id_t task_id;
+
+} _bc_energy;
+
+static void _bc_energy_task(void *param);
+static void _bc_energy_integrate(void);
+
+void bc_energy_init(void)
+{
+    memset(&_bc_energy, 0, sizeof(_bc_energy));
+
+    _bc_energy.current[BC_ENERGY_SUBSYSTEM_BASE] = BC_ENERGY_CURRENT_BASE;
+    _bc_energy.current[BC_ENERGY_SUBSYSTEM_MCU_RUN] = BC_ENERGY_CURRENT_MCU_RUN;
+    _bc_energy.current[BC_ENERGY_SUBSYSTEM_PLL] = BC_ENERGY_CURRENT_PLL;
+    _bc_energy.current[BC_ENERGY_SUBSYSTEM_RADIO_TX] = BC_ENERGY_CURRENT_RADIO_TX;
+    _bc_energy.current[BC_ENERGY_SUBSYSTEM_RADIO_RX] = BC_ENERGY_CURRENT_RADIO_RX;
+    _bc_energy.current[BC_ENERGY_SUBSYSTEM_ONEWIRE] = BC_ENERGY_CURRENT_ONEWIRE;
+
+    _bc_energy.count[BC_ENERGY_SUBSYSTEM_BASE] = 1;
+    _bc_energy.count[BC_ENERGY_SUBSYSTEM_MCU_RUN] = 1;
+
+    _bc_energy.update_interval = BC_TICK_INFINITY;
+    _bc_energy.tick_update = BC_TICK_INFINITY;
+
+    bc_lptim_init();
+
+    _bc_energy.counter = bc_lptim_get_counter();
+
+    _bc_energy.task_id = bc_scheduler_register(_bc_energy_task, NULL, _BC_ENERGY_MAX_UPDATE_INTERVAL);
+
+    _bc_energy.initialized = true;
+}
+
+void bc_energy_set_event_handler(void (*event_handler)(bc_energy_event_t, void *), void *event_param)
+{
+    _bc_energy.event_handler = event_handler;
+    _bc_energy.event_param = event_param;
+}
+
+void bc_energy_set_update_interval(bc_tick_t interval)
+{
+    _bc_energy.update_interval = interval;
+
+    if (interval == BC_TICK_INFINITY)
+    {
+        _bc_energy.tick_update = BC_TICK_INFINITY;
+    }
+    else
+    {
+        _bc_energy.tick_update = bc_tick_get() + interval;
+
+        bc_scheduler_plan_now(_bc_energy.task_id);
+    }
+}
+
+void bc_energy_set_current(bc_energy_subsystem_t subsystem, uint32_t current)
+{
+    bc_irq_disable();
+
+    _bc_energy_integrate();
+
+    _bc_energy.current[subsystem] = current;
+
+    bc_irq_enable();
+}
+
+void bc_energy_set_state(bc_energy_subsystem_t subsystem, bool on)
+{
+    bc_energy_set_count(subsystem, on ? 1 : 0);
+}
+
+void bc_energy_set_count(bc_energy_subsystem_t subsystem, int count)
+{
+    if (!_bc_energy.initialized || _bc_energy.count[subsystem] == count)
+    {
+        return;
+    }
+
+    bc_irq_disable();
+
+    _bc_energy_integrate();
+
+    _bc_energy.count[subsystem] = count;
+
+    bc_irq_enable();
+}
+
+void bc_energy_reset(void)
+{
+    bc_irq_disable();
+
+    _bc_energy_integrate();
+
+    memset(_bc_energy.on_time, 0, sizeof(_bc_energy.on_time));
+
+    bc_irq_enable();
+}
+
+float bc_energy_get_on_time(bc_energy_subsystem_t subsystem)
+{
+    uint64_t on_time;
+
+    bc_irq_disable();
+
+    _bc_energy_integrate();
+
+    on_time = _bc_energy.on_time[subsystem];
+
+    bc_irq_enable();
+
+    return (float) on_time / BC_LPTIM_TICKS_PER_SECOND;
+}
+
+float bc_energy_get_charge(bc_energy_subsystem_t subsystem)
+{
+    // uA * s -> mAh
+    return bc_energy_get_on_time(subsystem) * _bc_energy.current[subsystem] / (3600.f * 1000.f);
+}
+
+float bc_energy_get_total_charge(void)
+{
+    float charge = 0.f;
+
+    for (bc_energy_subsystem_t i = 0; i < BC_ENERGY_SUBSYSTEM_COUNT; i++)
+    {
+        charge += bc_energy_get_charge(i);
+    }
+
+    return charge;
+}
+
+float bc_energy_get_average_current(void)
+{
+    float time = bc_energy_get_on_time(BC_ENERGY_SUBSYSTEM_BASE);
+
+    if (time == 0.f)
+    {
+        return 0.f;
+    }
+
+    return bc_energy_get_total_charge() * 3600.f / time;
+}
+
+float bc_energy_get_battery_life(float capacity)
+{
+    float current = bc_energy_get_average_current();
+
+    if (current == 0.f)
+    {
+        return INFINITY;
+    }
+
+    return capacity / current / 24.f;
+}
+
+static void _bc_energy_task(void *param)
+{
+    (void) param;
+
+    bc_irq_disable();
+
+    _bc_energy_integrate();
+
+    bc_irq_enable();
+
+    if (bc_tick_get() >= _bc_energy.tick_update)
+    {
+        _bc_energy.tick_update = bc_tick_get() + _bc_energy.update_interval;
+
+        if (_bc_energy.event_handler != NULL)
+        {
+            _bc_energy.event_handler(BC_ENERGY_EVENT_UPDATE, _bc_energy.event_param);
+        }
+    }
+
+    if (_bc_energy.tick_update < bc_tick_get() + _BC_ENERGY_MAX_UPDATE_INTERVAL)
+    {
+        bc_scheduler_plan_current_absolute(_bc_energy.tick_update);
+    }
+    else
+    {
+        bc_scheduler_plan_current_relative(_BC_ENERGY_MAX_UPDATE_INTERVAL);
+    }
+}
+
+// It must be called with interrupts disabled
+static void _bc_energy_integrate(void)
+{
+    uint16_t counter = bc_lptim_get_counter();
+
+    uint16_t delta = counter - _bc_energy.counter;
+
+    _bc_energy.counter = counter;
+
+    for (int i = 0; i < BC_ENERGY_SUBSYSTEM_COUNT; i++)
+    {
+        _bc_energy.on_time[i] += (uint32_t) delta * _bc_energy.count[i];
+    }
+}
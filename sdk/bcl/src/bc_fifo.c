@@ -168,3 +168,15 @@ bool bc_fifo_is_empty(bc_fifo_t *fifo)
 
 	return result;
 }
+
+size_t bc_fifo_get_free_space(bc_fifo_t *fifo)
+{
+    bc_irq_disable();
+
+    // One byte is always left unused to distinguish full FIFO from empty one
+    size_t free_space = (fifo->tail + fifo->size - fifo->head - 1) % fifo->size;
+
+    bc_irq_enable();
+
+    return free_space;
+}
@@ -27,2873 +27,359 @@
 
 #include <bc_font_common.h>
 
-
-
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x20[11] = {
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x20 = { image_data_bc_font_ubuntu_11_0x20,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x21[11] = {
-    0xc0, 
-    0xc0, 
-    0x80, 
-    0x80, 
-    0x80, 
-    0x80, 
-    0xc0, 
-    0x80, 
-    0xc0, 
-    0xc0, 
-    0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x21 = { image_data_bc_font_ubuntu_11_0x21,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x22[11] = {
-    0xe0, 
-    0xe0, 
-    0x80, 
-    0x80, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x22 = { image_data_bc_font_ubuntu_11_0x22,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x23[11] = {
-    0xf8, 
-    0xf8, 
-    0xb0, 
-    0x00, 
-    0xb0, 
-    0x68, 
-    0x00, 
-    0x68, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x23 = { image_data_bc_font_ubuntu_11_0x23,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x24[11] = {
-    0xf8, 
-    0xf8, 
-    0xe8, 
-    0xc0, 
-    0xb8, 
-    0xc8, 
-    0xf0, 
-    0x88, 
-    0xe8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x24 = { image_data_bc_font_ubuntu_11_0x24,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x25[11] = {
-    0xfe, 
-    0xfe, 
-    0xda, 
-    0xa6, 
-    0xd6, 
-    0xea, 
-    0xe4, 
-    0xda, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x25 = { image_data_bc_font_ubuntu_11_0x25,
-    7, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x26[11] = {
-    0xf8, 
-    0xf8, 
-    0xd8, 
-    0xa8, 
-    0x98, 
-    0x90, 
-    0xa0, 
-    0xc0, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x26 = { image_data_bc_font_ubuntu_11_0x26,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x27[11] = {
-    0xc0, 
-    0xc0, 
-    0x80, 
-    0x80, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x27 = { image_data_bc_font_ubuntu_11_0x27,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x28[11] = {
-    0xe0, 
-    0xe0, 
-    0xc0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xc0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x28 = { image_data_bc_font_ubuntu_11_0x28,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x29[11] = {
-    0xe0, 
-    0xe0, 
-    0x60, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0x60, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x29 = { image_data_bc_font_ubuntu_11_0x29,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x2a[11] = {
-    0xf0, 
-    0xf0, 
-    0xd0, 
-    0x80, 
-    0xa0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x2a = { image_data_bc_font_ubuntu_11_0x2a,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x2b[11] = {
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xd8, 
-    0xd8, 
-    0x00, 
-    0xd8, 
-    0xd8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x2b = { image_data_bc_font_ubuntu_11_0x2b,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x2c[11] = {
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0x80, 
-    0x40, 
-    0xc0, 
-    0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x2c = { image_data_bc_font_ubuntu_11_0x2c,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x2d[11] = {
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0x80, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x2d = { image_data_bc_font_ubuntu_11_0x2d,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x2e[11] = {
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0x80, 
-    0xc0, 
-    0xc0, 
-    0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x2e = { image_data_bc_font_ubuntu_11_0x2e,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x2f[11] = {
-    0xe0, 
-    0xe0, 
-    0xc0, 
-    0xc0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0x60, 
-    0x60, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x2f = { image_data_bc_font_ubuntu_11_0x2f,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x30[11] = {
-    0xf8, 
-    0xf8, 
-    0xc8, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xc8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x30 = { image_data_bc_font_ubuntu_11_0x30,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x31[11] = {
-    0xf8, 
-    0xf8, 
-    0xe8, 
-    0xc8, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x31 = { image_data_bc_font_ubuntu_11_0x31,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x32[11] = {
-    0xf8, 
-    0xf8, 
-    0xc8, 
-    0xb0, 
-    0xf0, 
-    0xe8, 
-    0xd8, 
-    0x80, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x32 = { image_data_bc_font_ubuntu_11_0x32,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x33[11] = {
-    0xf8, 
-    0xf8, 
-    0x88, 
-    0xf0, 
-    0xc8, 
-    0xf0, 
-    0xf0, 
-    0x88, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x33 = { image_data_bc_font_ubuntu_11_0x33,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x34[11] = {
-    0xf8, 
-    0xf8, 
-    0xe8, 
-    0xc8, 
-    0xa8, 
-    0x80, 
-    0xe8, 
-    0xe8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x34 = { image_data_bc_font_ubuntu_11_0x34,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x35[11] = {
-    0xf8, 
-    0xf8, 
-    0xc0, 
-    0xd8, 
-    0xc8, 
-    0xf0, 
-    0xf0, 
-    0x88, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x35 = { image_data_bc_font_ubuntu_11_0x35,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x36[11] = {
-    0xf8, 
-    0xf8, 
-    0xe0, 
-    0xd8, 
-    0x88, 
-    0xb0, 
-    0xb0, 
-    0xc8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x36 = { image_data_bc_font_ubuntu_11_0x36,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x37[11] = {
-    0xf8, 
-    0xf8, 
-    0x88, 
-    0xe8, 
-    0xe8, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x37 = { image_data_bc_font_ubuntu_11_0x37,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x38[11] = {
-    0xf8, 
-    0xf8, 
-    0xc8, 
-    0xb0, 
-    0xc8, 
-    0xb0, 
-    0xb0, 
-    0xc8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x38 = { image_data_bc_font_ubuntu_11_0x38,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x39[11] = {
-    0xf8, 
-    0xf8, 
-    0xc8, 
-    0xb0, 
-    0xb0, 
-    0xc0, 
-    0xe8, 
-    0x98, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x39 = { image_data_bc_font_ubuntu_11_0x39,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x3a[11] = {
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0x80, 
-    0xc0, 
-    0xc0, 
-    0x80, 
-    0xc0, 
-    0xc0, 
-    0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x3a = { image_data_bc_font_ubuntu_11_0x3a,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x3b[11] = {
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0x80, 
-    0xc0, 
-    0xc0, 
-    0x80, 
-    0x40, 
-    0xc0, 
-    0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x3b = { image_data_bc_font_ubuntu_11_0x3b,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x3c[11] = {
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0x88, 
-    0x78, 
-    0x88, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x3c = { image_data_bc_font_ubuntu_11_0x3c,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x3d[11] = {
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0x80, 
-    0xf8, 
-    0x80, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x3d = { image_data_bc_font_ubuntu_11_0x3d,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x3e[11] = {
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0x98, 
-    0xe8, 
-    0x98, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x3e = { image_data_bc_font_ubuntu_11_0x3e,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x3f[11] = {
-    0xe0, 
-    0xe0, 
-    0x80, 
-    0xc0, 
-    0xc0, 
-    0xa0, 
-    0xe0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x3f = { image_data_bc_font_ubuntu_11_0x3f,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x40[11] = {
-    0xff, 
-    0xff, 
-    0xe3, 
-    0xdd, 
-    0xb2, 
-    0xaa, 
-    0xaa, 
-    0xa5, 
-    0xdf, 
-    0xe3, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x40 = { image_data_bc_font_ubuntu_11_0x40,
-    8, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x41[11] = {
-    0xfc, 
-    0xfc, 
-    0xec, 
-    0xd4, 
-    0xd4, 
-    0xd4, 
-    0x80, 
-    0xb8, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x41 = { image_data_bc_font_ubuntu_11_0x41,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x42[11] = {
-    0xf8, 
-    0xf8, 
-    0x88, 
-    0xb0, 
-    0x88, 
-    0xb0, 
-    0xb0, 
-    0x88, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x42 = { image_data_bc_font_ubuntu_11_0x42,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x43[11] = {
-    0xf8, 
-    0xf8, 
-    0xc0, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xc0, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x43 = { image_data_bc_font_ubuntu_11_0x43,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x44[11] = {
-    0xfc, 
-    0xfc, 
-    0x84, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0x84, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x44 = { image_data_bc_font_ubuntu_11_0x44,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x45[11] = {
-    0xf8, 
-    0xf8, 
-    0x80, 
-    0xb8, 
-    0x88, 
-    0xb8, 
-    0xb8, 
-    0x80, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x45 = { image_data_bc_font_ubuntu_11_0x45,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x46[11] = {
-    0xf0, 
-    0xf0, 
-    0x80, 
-    0xb0, 
-    0x90, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x46 = { image_data_bc_font_ubuntu_11_0x46,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x47[11] = {
-    0xf8, 
-    0xf8, 
-    0xc0, 
-    0xb8, 
-    0xb8, 
-    0xb0, 
-    0xb0, 
-    0xc0, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x47 = { image_data_bc_font_ubuntu_11_0x47,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x48[11] = {
-    0xfc, 
-    0xfc, 
-    0xb8, 
-    0xb8, 
-    0x80, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x48 = { image_data_bc_font_ubuntu_11_0x48,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x49[11] = {
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x49 = { image_data_bc_font_ubuntu_11_0x49,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x4a[11] = {
-    0xf0, 
-    0xf0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0x90, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x4a = { image_data_bc_font_ubuntu_11_0x4a,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x4b[11] = {
-    0xf8, 
-    0xf8, 
-    0xb0, 
-    0xa8, 
-    0x98, 
-    0x98, 
-    0xa8, 
-    0xb0, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x4b = { image_data_bc_font_ubuntu_11_0x4b,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x4c[11] = {
-    0xf0, 
-    0xf0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0x80, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x4c = { image_data_bc_font_ubuntu_11_0x4c,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x4d[11] = {
-    0xfc, 
-    0xfc, 
-    0xb8, 
-    0x90, 
-    0x90, 
-    0xa8, 
-    0xa8, 
-    0xb8, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x4d = { image_data_bc_font_ubuntu_11_0x4d,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x4e[11] = {
-    0xf8, 
-    0xf8, 
-    0x88, 
-    0x88, 
-    0x88, 
-    0x88, 
-    0x88, 
-    0xa8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x4e = { image_data_bc_font_ubuntu_11_0x4e,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x4f[11] = {
-    0xfc, 
-    0xfc, 
-    0xc4, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xc4, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x4f = { image_data_bc_font_ubuntu_11_0x4f,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x50[11] = {
-    0xf8, 
-    0xf8, 
-    0x88, 
-    0xb0, 
-    0xb0, 
-    0x88, 
-    0xb8, 
-    0xb8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x50 = { image_data_bc_font_ubuntu_11_0x50,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x51[11] = {
-    0xfc, 
-    0xfc, 
-    0xc4, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xc4, 
-    0xec, 
-    0xf4, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x51 = { image_data_bc_font_ubuntu_11_0x51,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x52[11] = {
-    0xf8, 
-    0xf8, 
-    0x88, 
-    0xb0, 
-    0xb0, 
-    0x88, 
-    0xa8, 
-    0xb0, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x52 = { image_data_bc_font_ubuntu_11_0x52,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x53[11] = {
-    0xf0, 
-    0xf0, 
-    0xc0, 
-    0xb0, 
-    0xb0, 
-    0xc0, 
-    0xe0, 
-    0x90, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x53 = { image_data_bc_font_ubuntu_11_0x53,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x54[11] = {
-    0xf0, 
-    0xf0, 
-    0x80, 
-    0xd0, 
-    0xd0, 
-    0xd0, 
-    0xd0, 
-    0xd0, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x54 = { image_data_bc_font_ubuntu_11_0x54,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x55[11] = {
-    0xfc, 
-    0xfc, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xc4, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x55 = { image_data_bc_font_ubuntu_11_0x55,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x56[11] = {
-    0xfc, 
-    0xfc, 
-    0xb8, 
-    0xb8, 
-    0xd4, 
-    0xd4, 
-    0xd4, 
-    0xec, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x56 = { image_data_bc_font_ubuntu_11_0x56,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x57[11] = {
-    0xff, 
-    0xff, 
-    0xbe, 
-    0xb6, 
-    0xaa, 
-    0xaa, 
-    0xaa, 
-    0xdd, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x57 = { image_data_bc_font_ubuntu_11_0x57,
-    8, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x58[11] = {
-    0xfc, 
-    0xfc, 
-    0xb8, 
-    0xd4, 
-    0xec, 
-    0xec, 
-    0xd4, 
-    0xb8, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x58 = { image_data_bc_font_ubuntu_11_0x58,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x59[11] = {
-    0xfc, 
-    0xfc, 
-    0xb8, 
-    0xd4, 
-    0xd4, 
-    0xec, 
-    0xec, 
-    0xec, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x59 = { image_data_bc_font_ubuntu_11_0x59,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x5a[11] = {
-    0xf8, 
-    0xf8, 
-    0x80, 
-    0xf0, 
-    0xe8, 
-    0xd8, 
-    0xb8, 
-    0x80, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x5a = { image_data_bc_font_ubuntu_11_0x5a,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x5b[11] = {
-    0xe0, 
-    0xe0, 
-    0x80, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0x80, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x5b = { image_data_bc_font_ubuntu_11_0x5b,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x5c[11] = {
-    0xe0, 
-    0xe0, 
-    0x60, 
-    0x60, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xc0, 
-    0xc0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x5c = { image_data_bc_font_ubuntu_11_0x5c,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x5d[11] = {
-    0xe0, 
-    0xe0, 
-    0x20, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0x20, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x5d = { image_data_bc_font_ubuntu_11_0x5d,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x5e[11] = {
-    0xf8, 
-    0xf8, 
-    0xd8, 
-    0xa8, 
-    0xa8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x5e = { image_data_bc_font_ubuntu_11_0x5e,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x5f[11] = {
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0x00, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x5f = { image_data_bc_font_ubuntu_11_0x5f,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x60[11] = {
-    0xe0, 
-    0xa0, 
-    0xc0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x60 = { image_data_bc_font_ubuntu_11_0x60,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x61[11] = {
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0x90, 
-    0xe0, 
-    0xc0, 
-    0x80, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x61 = { image_data_bc_font_ubuntu_11_0x61,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x62[11] = {
-    0xf8, 
-    0xf8, 
-    0xb8, 
-    0xb8, 
-    0x88, 
-    0xb0, 
-    0xb0, 
-    0x88, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x62 = { image_data_bc_font_ubuntu_11_0x62,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x63[11] = {
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xc0, 
-    0xb0, 
-    0xb0, 
-    0xc0, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x63 = { image_data_bc_font_ubuntu_11_0x63,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x64[11] = {
-    0xf8, 
-    0xf8, 
-    0xf0, 
-    0xf0, 
-    0xc0, 
-    0xb0, 
-    0xb0, 
-    0xc0, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x64 = { image_data_bc_font_ubuntu_11_0x64,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x65[11] = {
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0x80, 
-    0x80, 
-    0xb0, 
-    0xc0, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x65 = { image_data_bc_font_ubuntu_11_0x65,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x66[11] = {
-    0xe0, 
-    0xe0, 
-    0xc0, 
-    0xa0, 
-    0x80, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x66 = { image_data_bc_font_ubuntu_11_0x66,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x67[11] = {
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xc0, 
-    0xb0, 
-    0xc0, 
-    0xf0, 
-    0x88, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x67 = { image_data_bc_font_ubuntu_11_0x67,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x68[11] = {
-    0xf8, 
-    0xf8, 
-    0xb8, 
-    0xb8, 
-    0x88, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x68 = { image_data_bc_font_ubuntu_11_0x68,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x69[11] = {
-    0xc0, 
-    0xc0, 
-    0x80, 
-    0xc0, 
-    0x80, 
-    0x80, 
-    0x80, 
-    0x80, 
-    0xc0, 
-    0xc0, 
-    0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x69 = { image_data_bc_font_ubuntu_11_0x69,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x6a[11] = {
-    0xc0, 
-    0xc0, 
-    0x80, 
-    0xc0, 
-    0x80, 
-    0x80, 
-    0x80, 
-    0x80, 
-    0x40, 
-    0xc0, 
-    0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x6a = { image_data_bc_font_ubuntu_11_0x6a,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x6b[11] = {
-    0xf0, 
-    0xf0, 
-    0xb0, 
-    0xb0, 
-    0xa0, 
-    0x90, 
-    0x90, 
-    0xa0, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x6b = { image_data_bc_font_ubuntu_11_0x6b,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x6c[11] = {
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xc0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x6c = { image_data_bc_font_ubuntu_11_0x6c,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x6d[22] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0x89, 0x80, 
-    0xb6, 0x80, 
-    0xb6, 0x80, 
-    0xb6, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x6d = { image_data_bc_font_ubuntu_11_0x6d,
-    9, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x6e[11] = {
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0x88, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x6e = { image_data_bc_font_ubuntu_11_0x6e,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x6f[11] = {
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xc8, 
-    0xb0, 
-    0xb0, 
-    0xc8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x6f = { image_data_bc_font_ubuntu_11_0x6f,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x70[11] = {
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0x88, 
-    0xb0, 
-    0xb0, 
-    0x88, 
-    0xb8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x70 = { image_data_bc_font_ubuntu_11_0x70,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x71[11] = {
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xc0, 
-    0xb0, 
-    0xb0, 
-    0xc0, 
-    0xf0, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x71 = { image_data_bc_font_ubuntu_11_0x71,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x72[11] = {
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0x80, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x72 = { image_data_bc_font_ubuntu_11_0x72,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x73[11] = {
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xc0, 
-    0xb0, 
-    0xc0, 
-    0x90, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x73 = { image_data_bc_font_ubuntu_11_0x73,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x74[11] = {
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0x80, 
-    0xa0, 
-    0xa0, 
-    0xc0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x74 = { image_data_bc_font_ubuntu_11_0x74,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x75[11] = {
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xc0, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x75 = { image_data_bc_font_ubuntu_11_0x75,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x76[11] = {
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xa0, 
-    0xa0, 
-    0xd0, 
-    0xd0, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x76 = { image_data_bc_font_ubuntu_11_0x76,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x77[11] = {
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xa8, 
-    0xa8, 
-    0xa8, 
-    0xd4, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x77 = { image_data_bc_font_ubuntu_11_0x77,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x78[11] = {
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xa0, 
-    0xd0, 
-    0xd0, 
-    0xa0, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x78 = { image_data_bc_font_ubuntu_11_0x78,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x79[11] = {
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xa0, 
-    0xa0, 
-    0xd0, 
-    0xd0, 
-    0xb0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x79 = { image_data_bc_font_ubuntu_11_0x79,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x7a[11] = {
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0x80, 
-    0xc0, 
-    0xa0, 
-    0x80, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x7a = { image_data_bc_font_ubuntu_11_0x7a,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x7b[11] = {
-    0xe0, 
-    0xe0, 
-    0xc0, 
-    0xa0, 
-    0xa0, 
-    0x60, 
-    0xa0, 
-    0xa0, 
-    0xc0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x7b = { image_data_bc_font_ubuntu_11_0x7b,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x7c[11] = {
-    0xc0, 
-    0xc0, 
-    0x80, 
-    0x80, 
-    0x80, 
-    0x80, 
-    0x80, 
-    0x80, 
-    0x80, 
-    0xc0, 
-    0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x7c = { image_data_bc_font_ubuntu_11_0x7c,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x7d[11] = {
-    0xe0, 
-    0xe0, 
-    0x60, 
-    0xa0, 
-    0xa0, 
-    0xc0, 
-    0xa0, 
-    0xa0, 
-    0x60, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x7d = { image_data_bc_font_ubuntu_11_0x7d,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0x7e[11] = {
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xa8, 
-    0x58, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0x7e = { image_data_bc_font_ubuntu_11_0x7e,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0xb0[11] = {
-    0xe0, 
-    0x80, 
-    0x80, 
-    0x80, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0xb0 = { image_data_bc_font_ubuntu_11_0xb0,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0xb9[11] = {
-    0xf0, 
-    0xa0, 
-    0xd0, 
-    0xf0, 
-    0xc0, 
-    0xb0, 
-    0xc0, 
-    0x90, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0xb9 = { image_data_bc_font_ubuntu_11_0xb9,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0xbb[11] = {
-    0xf0, 
-    0xe0, 
-    0xe0, 
-    0xb0, 
-    0x90, 
-    0xb0, 
-    0xb0, 
-    0xd0, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0xbb = { image_data_bc_font_ubuntu_11_0xbb,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0xbe[11] = {
-    0xe0, 
-    0x40, 
-    0xa0, 
-    0xe0, 
-    0x80, 
-    0xc0, 
-    0xa0, 
-    0x80, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0xbe = { image_data_bc_font_ubuntu_11_0xbe,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0xe1[11] = {
-    0xf0, 
-    0xe0, 
-    0xd0, 
-    0xf0, 
-    0x90, 
-    0xe0, 
-    0xc0, 
-    0x80, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0xe1 = { image_data_bc_font_ubuntu_11_0xe1,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0xe8[11] = {
-    0xf0, 
-    0xa0, 
-    0xd0, 
-    0xf0, 
-    0xc0, 
-    0xb0, 
-    0xb0, 
-    0xc0, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0xe8 = { image_data_bc_font_ubuntu_11_0xe8,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0xe9[11] = {
-    0xf0, 
-    0xe0, 
-    0xd0, 
-    0xf0, 
-    0x80, 
-    0x80, 
-    0xb0, 
-    0xc0, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0xe9 = { image_data_bc_font_ubuntu_11_0xe9,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0xec[11] = {
-    0xa0, 
-    0xd0, 
-    0xf0, 
-    0xf0, 
-    0x80, 
-    0x80, 
-    0xb0, 
-    0xc0, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0xec = { image_data_bc_font_ubuntu_11_0xec,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0xed[11] = {
-    0xe0, 
-    0xc0, 
-    0xa0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0xed = { image_data_bc_font_ubuntu_11_0xed,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0xef[11] = {
-    0xfe, 
-    0xfe, 
-    0xf4, 
-    0xf4, 
-    0xc6, 
-    0xb6, 
-    0xb6, 
-    0xc6, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_11_0xef = { image_data_bc_font_ubuntu_11_0xef,
-    7, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0xf2[11] = {
-    0xf8, 
-    0xd0, 
-    0xe8, 
-    0xf8, 
-    0x88, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0xf2 = { image_data_bc_font_ubuntu_11_0xf2,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0xf8[11] = {
-    0xf0, 
-    0xa0, 
-    0xd0, 
-    0xf0, 
-    0x90, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0xf8 = { image_data_bc_font_ubuntu_11_0xf8,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0xf9[11] = {
-    0xe8, 
-    0xd0, 
-    0xe8, 
-    0xf8, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xc0, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0xf9 = { image_data_bc_font_ubuntu_11_0xf9,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0xfa[11] = {
-    0xf8, 
-    0xe8, 
-    0xd8, 
-    0xf8, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xc0, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_11_0xfa = { image_data_bc_font_ubuntu_11_0xfa,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_11_0xfd[11] = {
-    0xf0, 
-    0xe0, 
-    0xd0, 
-    0xf0, 
-    0xa0, 
-    0xa0, 
-    0xd0, 
-    0xd0, 
-    0xb0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_11_0xfd = { image_data_bc_font_ubuntu_11_0xfd,
-    4, 11/*, 8*/};
-#endif
-
-
-static const bc_font_char_t bc_font_ubuntu_11_array[] = {
-
-#if (0x0 == 0x0)
-  // character: ' '
-  {0x20, &bc_font_ubuntu_11_0x20},
-#else
-  // character: ' ' == ''
-  {0x20, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '!'
-  {0x21, &bc_font_ubuntu_11_0x21},
-#else
-  // character: '!' == ''
-  {0x21, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '"'
-  {0x22, &bc_font_ubuntu_11_0x22},
-#else
-  // character: '"' == ''
-  {0x22, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '#'
-  {0x23, &bc_font_ubuntu_11_0x23},
-#else
-  // character: '#' == ''
-  {0x23, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '$'
-  {0x24, &bc_font_ubuntu_11_0x24},
-#else
-  // character: '$' == ''
-  {0x24, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '%'
-  {0x25, &bc_font_ubuntu_11_0x25},
-#else
-  // character: '%' == ''
-  {0x25, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '&'
-  {0x26, &bc_font_ubuntu_11_0x26},
-#else
-  // character: '&' == ''
-  {0x26, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '''
-  {0x27, &bc_font_ubuntu_11_0x27},
-#else
-  // character: ''' == ''
-  {0x27, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '('
-  {0x28, &bc_font_ubuntu_11_0x28},
-#else
-  // character: '(' == ''
-  {0x28, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ')'
-  {0x29, &bc_font_ubuntu_11_0x29},
-#else
-  // character: ')' == ''
-  {0x29, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '*'
-  {0x2a, &bc_font_ubuntu_11_0x2a},
-#else
-  // character: '*' == ''
-  {0x2a, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '+'
-  {0x2b, &bc_font_ubuntu_11_0x2b},
-#else
-  // character: '+' == ''
-  {0x2b, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ','
-  {0x2c, &bc_font_ubuntu_11_0x2c},
-#else
-  // character: ',' == ''
-  {0x2c, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '-'
-  {0x2d, &bc_font_ubuntu_11_0x2d},
-#else
-  // character: '-' == ''
-  {0x2d, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '.'
-  {0x2e, &bc_font_ubuntu_11_0x2e},
-#else
-  // character: '.' == ''
-  {0x2e, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '/'
-  {0x2f, &bc_font_ubuntu_11_0x2f},
-#else
-  // character: '/' == ''
-  {0x2f, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '0'
-  {0x30, &bc_font_ubuntu_11_0x30},
-#else
-  // character: '0' == ''
-  {0x30, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '1'
-  {0x31, &bc_font_ubuntu_11_0x31},
-#else
-  // character: '1' == ''
-  {0x31, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '2'
-  {0x32, &bc_font_ubuntu_11_0x32},
-#else
-  // character: '2' == ''
-  {0x32, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '3'
-  {0x33, &bc_font_ubuntu_11_0x33},
-#else
-  // character: '3' == ''
-  {0x33, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '4'
-  {0x34, &bc_font_ubuntu_11_0x34},
-#else
-  // character: '4' == ''
-  {0x34, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '5'
-  {0x35, &bc_font_ubuntu_11_0x35},
-#else
-  // character: '5' == ''
-  {0x35, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '6'
-  {0x36, &bc_font_ubuntu_11_0x36},
-#else
-  // character: '6' == ''
-  {0x36, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '7'
-  {0x37, &bc_font_ubuntu_11_0x37},
-#else
-  // character: '7' == ''
-  {0x37, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '8'
-  {0x38, &bc_font_ubuntu_11_0x38},
-#else
-  // character: '8' == ''
-  {0x38, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '9'
-  {0x39, &bc_font_ubuntu_11_0x39},
-#else
-  // character: '9' == ''
-  {0x39, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ':'
-  {0x3a, &bc_font_ubuntu_11_0x3a},
-#else
-  // character: ':' == ''
-  {0x3a, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ';'
-  {0x3b, &bc_font_ubuntu_11_0x3b},
-#else
-  // character: ';' == ''
-  {0x3b, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '<'
-  {0x3c, &bc_font_ubuntu_11_0x3c},
-#else
-  // character: '<' == ''
-  {0x3c, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '='
-  {0x3d, &bc_font_ubuntu_11_0x3d},
-#else
-  // character: '=' == ''
-  {0x3d, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '>'
-  {0x3e, &bc_font_ubuntu_11_0x3e},
-#else
-  // character: '>' == ''
-  {0x3e, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '?'
-  {0x3f, &bc_font_ubuntu_11_0x3f},
-#else
-  // character: '?' == ''
-  {0x3f, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\x0040'
-  {0x40, &bc_font_ubuntu_11_0x40},
-#else
-  // character: '\x0040' == ''
-  {0x40, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'A'
-  {0x41, &bc_font_ubuntu_11_0x41},
-#else
-  // character: 'A' == ''
-  {0x41, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'B'
-  {0x42, &bc_font_ubuntu_11_0x42},
-#else
-  // character: 'B' == ''
-  {0x42, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'C'
-  {0x43, &bc_font_ubuntu_11_0x43},
-#else
-  // character: 'C' == ''
-  {0x43, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'D'
-  {0x44, &bc_font_ubuntu_11_0x44},
-#else
-  // character: 'D' == ''
-  {0x44, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'E'
-  {0x45, &bc_font_ubuntu_11_0x45},
-#else
-  // character: 'E' == ''
-  {0x45, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'F'
-  {0x46, &bc_font_ubuntu_11_0x46},
-#else
-  // character: 'F' == ''
-  {0x46, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'G'
-  {0x47, &bc_font_ubuntu_11_0x47},
-#else
-  // character: 'G' == ''
-  {0x47, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'H'
-  {0x48, &bc_font_ubuntu_11_0x48},
-#else
-  // character: 'H' == ''
-  {0x48, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'I'
-  {0x49, &bc_font_ubuntu_11_0x49},
-#else
-  // character: 'I' == ''
-  {0x49, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'J'
-  {0x4a, &bc_font_ubuntu_11_0x4a},
-#else
-  // character: 'J' == ''
-  {0x4a, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'K'
-  {0x4b, &bc_font_ubuntu_11_0x4b},
-#else
-  // character: 'K' == ''
-  {0x4b, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'L'
-  {0x4c, &bc_font_ubuntu_11_0x4c},
-#else
-  // character: 'L' == ''
-  {0x4c, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'M'
-  {0x4d, &bc_font_ubuntu_11_0x4d},
-#else
-  // character: 'M' == ''
-  {0x4d, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'N'
-  {0x4e, &bc_font_ubuntu_11_0x4e},
-#else
-  // character: 'N' == ''
-  {0x4e, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'O'
-  {0x4f, &bc_font_ubuntu_11_0x4f},
-#else
-  // character: 'O' == ''
-  {0x4f, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'P'
-  {0x50, &bc_font_ubuntu_11_0x50},
-#else
-  // character: 'P' == ''
-  {0x50, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Q'
-  {0x51, &bc_font_ubuntu_11_0x51},
-#else
-  // character: 'Q' == ''
-  {0x51, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'R'
-  {0x52, &bc_font_ubuntu_11_0x52},
-#else
-  // character: 'R' == ''
-  {0x52, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'S'
-  {0x53, &bc_font_ubuntu_11_0x53},
-#else
-  // character: 'S' == ''
-  {0x53, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'T'
-  {0x54, &bc_font_ubuntu_11_0x54},
-#else
-  // character: 'T' == ''
-  {0x54, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'U'
-  {0x55, &bc_font_ubuntu_11_0x55},
-#else
-  // character: 'U' == ''
-  {0x55, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'V'
-  {0x56, &bc_font_ubuntu_11_0x56},
-#else
-  // character: 'V' == ''
-  {0x56, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'W'
-  {0x57, &bc_font_ubuntu_11_0x57},
-#else
-  // character: 'W' == ''
-  {0x57, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'X'
-  {0x58, &bc_font_ubuntu_11_0x58},
-#else
-  // character: 'X' == ''
-  {0x58, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Y'
-  {0x59, &bc_font_ubuntu_11_0x59},
-#else
-  // character: 'Y' == ''
-  {0x59, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Z'
-  {0x5a, &bc_font_ubuntu_11_0x5a},
-#else
-  // character: 'Z' == ''
-  {0x5a, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '['
-  {0x5b, &bc_font_ubuntu_11_0x5b},
-#else
-  // character: '[' == ''
-  {0x5b, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\'
-  {0x5c, &bc_font_ubuntu_11_0x5c},
-#else
-  // character: '\' == ''
-  {0x5c, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ']'
-  {0x5d, &bc_font_ubuntu_11_0x5d},
-#else
-  // character: ']' == ''
-  {0x5d, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '^'
-  {0x5e, &bc_font_ubuntu_11_0x5e},
-#else
-  // character: '^' == ''
-  {0x5e, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '_'
-  {0x5f, &bc_font_ubuntu_11_0x5f},
-#else
-  // character: '_' == ''
-  {0x5f, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '`'
-  {0x60, &bc_font_ubuntu_11_0x60},
-#else
-  // character: '`' == ''
-  {0x60, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'a'
-  {0x61, &bc_font_ubuntu_11_0x61},
-#else
-  // character: 'a' == ''
-  {0x61, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'b'
-  {0x62, &bc_font_ubuntu_11_0x62},
-#else
-  // character: 'b' == ''
-  {0x62, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'c'
-  {0x63, &bc_font_ubuntu_11_0x63},
-#else
-  // character: 'c' == ''
-  {0x63, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'd'
-  {0x64, &bc_font_ubuntu_11_0x64},
-#else
-  // character: 'd' == ''
-  {0x64, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'e'
-  {0x65, &bc_font_ubuntu_11_0x65},
-#else
-  // character: 'e' == ''
-  {0x65, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'f'
-  {0x66, &bc_font_ubuntu_11_0x66},
-#else
-  // character: 'f' == ''
-  {0x66, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'g'
-  {0x67, &bc_font_ubuntu_11_0x67},
-#else
-  // character: 'g' == ''
-  {0x67, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'h'
-  {0x68, &bc_font_ubuntu_11_0x68},
-#else
-  // character: 'h' == ''
-  {0x68, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'i'
-  {0x69, &bc_font_ubuntu_11_0x69},
-#else
-  // character: 'i' == ''
-  {0x69, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'j'
-  {0x6a, &bc_font_ubuntu_11_0x6a},
-#else
-  // character: 'j' == ''
-  {0x6a, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'k'
-  {0x6b, &bc_font_ubuntu_11_0x6b},
-#else
-  // character: 'k' == ''
-  {0x6b, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'l'
-  {0x6c, &bc_font_ubuntu_11_0x6c},
-#else
-  // character: 'l' == ''
-  {0x6c, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'm'
-  {0x6d, &bc_font_ubuntu_11_0x6d},
-#else
-  // character: 'm' == ''
-  {0x6d, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'n'
-  {0x6e, &bc_font_ubuntu_11_0x6e},
-#else
-  // character: 'n' == ''
-  {0x6e, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'o'
-  {0x6f, &bc_font_ubuntu_11_0x6f},
-#else
-  // character: 'o' == ''
-  {0x6f, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'p'
-  {0x70, &bc_font_ubuntu_11_0x70},
-#else
-  // character: 'p' == ''
-  {0x70, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'q'
-  {0x71, &bc_font_ubuntu_11_0x71},
-#else
-  // character: 'q' == ''
-  {0x71, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'r'
-  {0x72, &bc_font_ubuntu_11_0x72},
-#else
-  // character: 'r' == ''
-  {0x72, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 's'
-  {0x73, &bc_font_ubuntu_11_0x73},
-#else
-  // character: 's' == ''
-  {0x73, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 't'
-  {0x74, &bc_font_ubuntu_11_0x74},
-#else
-  // character: 't' == ''
-  {0x74, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'u'
-  {0x75, &bc_font_ubuntu_11_0x75},
-#else
-  // character: 'u' == ''
-  {0x75, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'v'
-  {0x76, &bc_font_ubuntu_11_0x76},
-#else
-  // character: 'v' == ''
-  {0x76, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'w'
-  {0x77, &bc_font_ubuntu_11_0x77},
-#else
-  // character: 'w' == ''
-  {0x77, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'x'
-  {0x78, &bc_font_ubuntu_11_0x78},
-#else
-  // character: 'x' == ''
-  {0x78, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'y'
-  {0x79, &bc_font_ubuntu_11_0x79},
-#else
-  // character: 'y' == ''
-  {0x79, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'z'
-  {0x7a, &bc_font_ubuntu_11_0x7a},
-#else
-  // character: 'z' == ''
-  {0x7a, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '{'
-  {0x7b, &bc_font_ubuntu_11_0x7b},
-#else
-  // character: '{' == ''
-  {0x7b, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '|'
-  {0x7c, &bc_font_ubuntu_11_0x7c},
-#else
-  // character: '|' == ''
-  {0x7c, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '}'
-  {0x7d, &bc_font_ubuntu_11_0x7d},
-#else
-  // character: '}' == ''
-  {0x7d, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '~'
-  {0x7e, &bc_font_ubuntu_11_0x7e},
-#else
-  // character: '~' == ''
-  {0x7e, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '°'
-  {0xb0, &bc_font_ubuntu_11_0xb0},
-#else
-  // character: '°' == ''
-  {0xb0, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'š'
-  {0xb9, &bc_font_ubuntu_11_0xb9},
-#else
-  // character: 'š' == ''
-  {0xb9, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ť'
-  {0xbb, &bc_font_ubuntu_11_0xbb},
-#else
-  // character: 'ť' == ''
-  {0xbb, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ž'
-  {0xbe, &bc_font_ubuntu_11_0xbe},
-#else
-  // character: 'ž' == ''
-  {0xbe, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'á'
-  {0xe1, &bc_font_ubuntu_11_0xe1},
-#else
-  // character: 'á' == ''
-  {0xe1, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'č'
-  {0xe8, &bc_font_ubuntu_11_0xe8},
-#else
-  // character: 'č' == ''
-  {0xe8, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'é'
-  {0xe9, &bc_font_ubuntu_11_0xe9},
-#else
-  // character: 'é' == ''
-  {0xe9, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ě'
-  {0xec, &bc_font_ubuntu_11_0xec},
-#else
-  // character: 'ě' == ''
-  {0xec, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'í'
-  {0xed, &bc_font_ubuntu_11_0xed},
-#else
-  // character: 'í' == ''
-  {0xed, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ď'
-  {0xef, &bc_font_ubuntu_11_0xef},
-#else
-  // character: 'ď' == ''
-  {0xef, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ň'
-  {0xf2, &bc_font_ubuntu_11_0xf2},
-#else
-  // character: 'ň' == ''
-  {0xf2, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ř'
-  {0xf8, &bc_font_ubuntu_11_0xf8},
-#else
-  // character: 'ř' == ''
-  {0xf8, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ů'
-  {0xf9, &bc_font_ubuntu_11_0xf9},
-#else
-  // character: 'ů' == ''
-  {0xf9, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ú'
-  {0xfa, &bc_font_ubuntu_11_0xfa},
-#else
-  // character: 'ú' == ''
-  {0xfa, &bc_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ý'
-  {0xfd, &bc_font_ubuntu_11_0xfd}
-#else
-  // character: 'ý' == ''
-  {0xfd, &bc_font_ubuntu_11_0x}
-#endif
-
-};
-
-
-const bc_font_t bc_font_ubuntu_11 = { 110, bc_font_ubuntu_11_array };
+// Glyphs are compressed by sdk/tools/font/bc-font-rle.py
+
+static const uint8_t bc_font_ubuntu_11_rle_data[706] = {
+    // ' '
+    0xf7,
+    // '!'
+    0x51, 0x71, 0x11, 0x11, 0x40,
+    // '"'
+    0x72, 0x42, 0xf3,
+    // '#'
+    0xb1, 0x22, 0x12, 0x11, 0x12, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x21, 0xb0,
+    // '$'
+    0xd1, 0x31, 0x11, 0x14, 0x13, 0x33, 0x14, 0x12, 0x51, 0x60,
+    // '%'
+    0xf1, 0x12, 0x12, 0x52, 0x35, 0x45, 0x32, 0x52, 0x12, 0x1f, 0x00,
+    // '&'
+    0xc1, 0x33, 0x32, 0x51, 0x22, 0x22, 0x43, 0xa0,
+    // "'"
+    0x51, 0x31, 0xc0,
+    // '('
+    0x81, 0x12, 0xd2, 0x21, 0x30,
+    // ')'
+    0x61, 0x22, 0xd2, 0x11, 0x50,
+    // '*'
+    0xa1, 0x21, 0x11, 0x21, 0x21, 0x11, 0xf5,
+    // '+'
+    0xf2, 0x17, 0x21, 0x41, 0x27, 0x1c,
+    // ','
+    0xf0, 0x43,
+    // '-'
+    0xf1, 0x21, 0x2c,
+    // '.'
+    0xf0, 0x11, 0x14,
+    // '/'
+    0x81, 0x42, 0x62, 0x41, 0x50,
+    // '0'
+    0xc2, 0x24, 0xf1, 0x42, 0x2b,
+    // '1'
+    0xd1, 0x31, 0x41, 0xf5, 0x1b,
+    // '2'
+    0xc2, 0x24, 0x11, 0x62, 0x22, 0x21, 0x12, 0x14, 0xa0,
+    // '3'
+    0xb3, 0x24, 0x23, 0x23, 0x64, 0x13, 0xb0,
+    // '4'
+    0xd1, 0x31, 0x32, 0x41, 0x11, 0x12, 0x11, 0x81, 0xb0,
+    // '5'
+    0xc3, 0x32, 0x31, 0x33, 0x64, 0x13, 0xb0,
+    // '6'
+    0xd2, 0x23, 0x11, 0x11, 0x33, 0x64, 0x22, 0xb0,
+    // '7'
+    0xb3, 0x22, 0x92, 0xd1, 0xc0,
+    // '8'
+    0xc2, 0x24, 0x14, 0x14, 0x64, 0x22, 0xb0,
+    // '9'
+    0xc2, 0x24, 0x63, 0x31, 0x11, 0x13, 0x22, 0xc0,
+    // ':'
+    0x91, 0x11, 0x31, 0x11, 0x40,
+    // ';'
+    0x91, 0x11, 0x34, 0x30,
+    // '<'
+    0xf6, 0x31, 0x41, 0x42, 0x3f, 0x10,
+    // '='
+    0xf6, 0x41, 0x41, 0x41, 0x4f, 0x00,
+    // '>'
+    0xf6, 0x23, 0x32, 0x32, 0x2f, 0x20,
+    // '?'
+    0x72, 0x11, 0x52, 0x11, 0x21, 0x21, 0x70,
+    // '@'
+    0xf4, 0x34, 0x52, 0x21, 0x43, 0x2f, 0x04, 0x14, 0x11, 0x34, 0x53, 0x20,
+    // 'A'
+    0xf0, 0x14, 0x3e, 0x11, 0x11, 0x12, 0x32, 0x13, 0x1c,
+    // 'B'
+    0xb3, 0x33, 0x23, 0x23, 0x73, 0x13, 0xb0,
+    // 'C'
+    0xc3, 0x14, 0xf1, 0x42, 0x3a,
+    // 'D'
+    0xd4, 0x34, 0xf5, 0x41, 0x4d,
+    // 'E'
+    0xb4, 0x23, 0x22, 0x32, 0x83, 0x14, 0xa0,
+    // 'F'
+    0x93, 0x22, 0x21, 0x31, 0xa1, 0xa0,
+    // 'G'
+    0xc3, 0x14, 0x91, 0x63, 0x33, 0xa0,
+    // 'H'
+    0xd1, 0x31, 0x83, 0x33, 0xe1, 0x31, 0xc0,
+    // 'I'
+    0x71, 0xf2, 0x17,
+    // 'J'
+    0xb1, 0xf2, 0x31, 0x29,
+    // 'K'
+    0xb1, 0x21, 0x32, 0x22, 0x82, 0x42, 0x11, 0x21, 0xa0,
+    // 'L'
+    0x91, 0xf5, 0x21, 0x38,
+    // 'M'
+    0xd1, 0x31, 0x21, 0x11, 0x93, 0xa1, 0x31, 0x31, 0xc0,
+    // 'N'
+    0xb3, 0xf8, 0x13, 0x11, 0x1b,
+    // 'O'
+    0xe3, 0x25, 0xf4, 0x52, 0x3d,
+    // 'P'
+    0xb3, 0x33, 0x73, 0x22, 0x71, 0xd0,
+    // 'Q'
+    0xe3, 0x25, 0xf4, 0x52, 0x11, 0x14, 0x25, 0x11,
+    // 'R'
+    0xb3, 0x33, 0x73, 0x21, 0x52, 0x11, 0x21, 0xa0,
+    // 'S'
+    0xa2, 0x13, 0x53, 0x21, 0x23, 0x12, 0x90,
+    // 'T'
+    0x93, 0x11, 0x11, 0xf3, 0x19,
+    // 'U'
+    0xd1, 0x31, 0xfa, 0x52, 0x3d,
+    // 'V'
+    0xd1, 0x31, 0x72, 0x12, 0xe3, 0x41, 0xe0,
+    // 'W'
+    0xf2, 0x15, 0x14, 0x16, 0x3f, 0x43, 0x13, 0x21, 0x31, 0xf2,
+    // 'X'
+    0xd1, 0x31, 0x12, 0x12, 0x23, 0x93, 0x22, 0x12, 0x11, 0x31, 0xc0,
+    // 'Y'
+    0xd1, 0x31, 0x12, 0x12, 0x83, 0xf1, 0x1e,
+    // 'Z'
+    0xb4, 0x13, 0x42, 0x22, 0x22, 0x43, 0x14, 0xa0,
+    // '['
+    0x72, 0x21, 0xe1, 0x12, 0x30,
+    // '\\'
+    0x61, 0x52, 0x82, 0x51, 0x30,
+    // ']'
+    0x62, 0x11, 0xe1, 0x22, 0x40,
+    // '^'
+    0xc1, 0x33, 0x71, 0x11, 0xfb,
+    // '_'
+    0xff, 0x28, 0x40,
+    // '`'
+    0x41, 0x22, 0x21, 0xf6,
+    // 'a'
+    0xf2, 0x22, 0x32, 0x12, 0x13, 0x38,
+    // 'b'
+    0xb1, 0xa2, 0x33, 0x73, 0x13, 0xb0,
+    // 'c'
+    0xf3, 0x21, 0x35, 0x32, 0x28,
+    // 'd'
+    0xe1, 0x72, 0x23, 0x73, 0x33, 0xa0,
+    // 'e'
+    0xf2, 0x36, 0x21, 0x32, 0x28,
+    // 'f'
+    0x81, 0x12, 0x21, 0x21, 0x71, 0x70,
+    // 'g'
+    0xf7, 0x31, 0x32, 0x33, 0x22, 0x41, 0x36,
+    // 'h'
+    0xb1, 0xa2, 0x33, 0xb1, 0x21, 0xa0,
+    // 'i'
+    0x51, 0x11, 0x11, 0x71, 0x40,
+    // 'j'
+    0x51, 0x11, 0x11, 0x63, 0x30,
+    // 'k'
+    0x91, 0x91, 0x22, 0x62, 0x11, 0x11, 0x80,
+    // 'l'
+    0x71, 0xe2, 0x21, 0x60,
+    // 'm'
+    0xff, 0x73, 0x12, 0x46, 0xf5, 0x12, 0x12, 0x1f, 0x40,
+    // 'n'
+    0xf6, 0x33, 0x3b, 0x12, 0x1a,
+    // 'o'
+    0xf7, 0x22, 0x46, 0x42, 0x2b,
+    // 'p'
+    0xf6, 0x33, 0x37, 0x32, 0x22, 0x18,
+    // 'q'
+    0xf7, 0x31, 0x37, 0x33, 0x25, 0x15,
+    // 'r'
+    0xd2, 0x21, 0x71, 0x70,
+    // 's'
+    0xf3, 0x21, 0x31, 0x31, 0x11, 0x11, 0x29,
+    // 't'
+    0xa1, 0x31, 0x21, 0x42, 0x21, 0x60,
+    // 'u'
+    0xf6, 0x12, 0x1b, 0x33, 0x3a,
+    // 'v'
+    0xf2, 0x11, 0x15, 0x36, 0x19,
+    // 'w'
+    0xfa, 0x11, 0x11, 0x1d, 0x52, 0x11, 0x1d,
+    // 'x'
+    0xf2, 0x11, 0x11, 0x35, 0x31, 0x11, 0x18,
+    // 'y'
+    0xf2, 0x11, 0x15, 0x35, 0x22, 0x16,
+    // 'z'
+    0xd2, 0x11, 0x22, 0x21, 0x12, 0x60,
+    // '{'
+    0x81, 0x12, 0x32, 0x12, 0x52, 0x21, 0x30,
+    // '|'
+    0x51, 0xd1, 0x20,
+    // '}'
+    0x61, 0x22, 0x52, 0x12, 0x32, 0x11, 0x50,
+    // '~'
+    0xfb, 0x11, 0x11, 0x41, 0x11, 0x1f, 0x20,
+    // '°'
+    0x42, 0x72, 0xf3,
+    // 'š'
+    0x51, 0x11, 0x13, 0x21, 0x32, 0x13, 0x13, 0x11, 0x11, 0x12, 0x90,
+    // 'ť'
+    0x71, 0x51, 0x11, 0x21, 0x31, 0x62, 0x31, 0x90,
+    // 'ž'
+    0x31, 0x14, 0x11, 0x22, 0x11, 0x22, 0x21, 0x12, 0x60,
+    // 'á'
+    0x71, 0x22, 0x21, 0x22, 0x23, 0x21, 0x21, 0x33, 0x80,
+    // 'č'
+    0x51, 0x11, 0x13, 0x21, 0x32, 0x13, 0x53, 0x22, 0x80,
+    // 'é'
+    0x71, 0x22, 0x21, 0x23, 0x62, 0x13, 0x22, 0x80,
+    // 'ě'
+    0x11, 0x11, 0x13, 0x21, 0x63, 0x62, 0x13, 0x22, 0x80,
+    // 'í'
+    0x51, 0x12, 0x11, 0x21, 0xb1, 0x70,
+    // 'ď'
+    0xf3, 0x11, 0x19, 0x22, 0x11, 0x3b, 0x35, 0x3f, 0x10,
+    // 'ň'
+    0x71, 0x11, 0x23, 0x31, 0x23, 0x33, 0xb1, 0x21, 0xa0,
+    // 'ř'
+    0x51, 0x11, 0x13, 0x21, 0x22, 0x31, 0xa1, 0xa0,
+    // 'ů'
+    0x31, 0x33, 0x23, 0x31, 0x21, 0x21, 0xb3, 0x33, 0xa0,
+    // 'ú'
+    0x81, 0x32, 0x31, 0x31, 0x21, 0xb3, 0x33, 0xa0,
+    // 'ý'
+    0x71, 0x22, 0x21, 0x21, 0x11, 0x53, 0x52, 0x21, 0x60,
+};
+
+static const bc_font_rle_char_t bc_font_ubuntu_11_rle_chars[110] = {
+    { 0x20, 2, 0 },
+    { 0x21, 2, 1 },
+    { 0x22, 3, 6 },
+    { 0x23, 5, 9 },
+    { 0x24, 5, 22 },
+    { 0x25, 7, 32 },
+    { 0x26, 5, 43 },
+    { 0x27, 2, 51 },
+    { 0x28, 3, 54 },
+    { 0x29, 3, 59 },
+    { 0x2a, 4, 64 },
+    { 0x2b, 5, 71 },
+    { 0x2c, 2, 77 },
+    { 0x2d, 3, 79 },
+    { 0x2e, 2, 82 },
+    { 0x2f, 3, 85 },
+    { 0x30, 5, 90 },
+    { 0x31, 5, 95 },
+    { 0x32, 5, 100 },
+    { 0x33, 5, 109 },
+    { 0x34, 5, 116 },
+    { 0x35, 5, 125 },
+    { 0x36, 5, 132 },
+    { 0x37, 5, 140 },
+    { 0x38, 5, 145 },
+    { 0x39, 5, 152 },
+    { 0x3a, 2, 160 },
+    { 0x3b, 2, 165 },
+    { 0x3c, 5, 169 },
+    { 0x3d, 5, 175 },
+    { 0x3e, 5, 181 },
+    { 0x3f, 3, 187 },
+    { 0x40, 8, 194 },
+    { 0x41, 6, 206 },
+    { 0x42, 5, 215 },
+    { 0x43, 5, 222 },
+    { 0x44, 6, 227 },
+    { 0x45, 5, 232 },
+    { 0x46, 4, 239 },
+    { 0x47, 5, 245 },
+    { 0x48, 6, 251 },
+    { 0x49, 3, 258 },
+    { 0x4a, 4, 261 },
+    { 0x4b, 5, 265 },
+    { 0x4c, 4, 274 },
+    { 0x4d, 6, 278 },
+    { 0x4e, 5, 287 },
+    { 0x4f, 6, 292 },
+    { 0x50, 5, 297 },
+    { 0x51, 6, 303 },
+    { 0x52, 5, 311 },
+    { 0x53, 4, 319 },
+    { 0x54, 4, 326 },
+    { 0x55, 6, 331 },
+    { 0x56, 6, 336 },
+    { 0x57, 8, 343 },
+    { 0x58, 6, 353 },
+    { 0x59, 6, 364 },
+    { 0x5a, 5, 371 },
+    { 0x5b, 3, 379 },
+    { 0x5c, 3, 384 },
+    { 0x5d, 3, 389 },
+    { 0x5e, 5, 394 },
+    { 0x5f, 4, 399 },
+    { 0x60, 3, 402 },
+    { 0x61, 4, 406 },
+    { 0x62, 5, 412 },
+    { 0x63, 4, 418 },
+    { 0x64, 5, 423 },
+    { 0x65, 4, 429 },
+    { 0x66, 3, 434 },
+    { 0x67, 5, 440 },
+    { 0x68, 5, 447 },
+    { 0x69, 2, 453 },
+    { 0x6a, 2, 458 },
+    { 0x6b, 4, 463 },
+    { 0x6c, 3, 470 },
+    { 0x6d, 9, 474 },
+    { 0x6e, 5, 483 },
+    { 0x6f, 5, 488 },
+    { 0x70, 5, 493 },
+    { 0x71, 5, 499 },
+    { 0x72, 3, 505 },
+    { 0x73, 4, 509 },
+    { 0x74, 3, 516 },
+    { 0x75, 5, 522 },
+    { 0x76, 4, 527 },
+    { 0x77, 6, 532 },
+    { 0x78, 4, 539 },
+    { 0x79, 4, 546 },
+    { 0x7a, 3, 552 },
+    { 0x7b, 3, 558 },
+    { 0x7c, 2, 565 },
+    { 0x7d, 3, 568 },
+    { 0x7e, 5, 575 },
+    { 0xb0, 3, 582 },
+    { 0xb9, 4, 585 },
+    { 0xbb, 4, 596 },
+    { 0xbe, 3, 604 },
+    { 0xe1, 4, 613 },
+    { 0xe8, 4, 622 },
+    { 0xe9, 4, 631 },
+    { 0xec, 4, 639 },
+    { 0xed, 3, 648 },
+    { 0xef, 7, 654 },
+    { 0xf2, 5, 663 },
+    { 0xf8, 4, 672 },
+    { 0xf9, 5, 680 },
+    { 0xfa, 5, 689 },
+    { 0xfd, 4, 697 },
+};
+
+static const uint8_t bc_font_ubuntu_11_index[BC_FONT_INDEX_LENGTH] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xff, 0x61, 0xff, 0xff, 0x62, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x65, 0xff, 0xff, 0x66, 0x67, 0xff, 0x68,
+    0xff, 0xff, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x6b, 0x6c, 0xff, 0xff, 0x6d, 0xff, 0xff,
+};
+
+const bc_font_t bc_font_ubuntu_11 = { 110, NULL, bc_font_ubuntu_11_index, 11, bc_font_ubuntu_11_rle_chars, bc_font_ubuntu_11_rle_data };
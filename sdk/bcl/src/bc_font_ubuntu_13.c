@@ -27,3093 +27,359 @@
 
 #include <bc_font_common.h>
 
-
-
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x20[13] = {
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x20 = { image_data_bc_font_ubuntu_13_0x20,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x21[13] = {
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x21 = { image_data_bc_font_ubuntu_13_0x21,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x22[13] = {
-    0xf8, 
-    0xa8, 
-    0xa8, 
-    0xa8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x22 = { image_data_bc_font_ubuntu_13_0x22,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x23[13] = {
-    0xff, 
-    0xff, 
-    0xeb, 
-    0xeb, 
-    0x81, 
-    0xeb, 
-    0xd7, 
-    0x81, 
-    0xd7, 
-    0xd7, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x23 = { image_data_bc_font_ubuntu_13_0x23,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x24[13] = {
-    0xee, 
-    0xee, 
-    0xc2, 
-    0xbe, 
-    0xbe, 
-    0xce, 
-    0xf6, 
-    0xfa, 
-    0xfa, 
-    0x86, 
-    0xee, 
-    0xee, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x24 = { image_data_bc_font_ubuntu_13_0x24,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x25[26] = {
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xce, 0xc0, 
-    0xb5, 0xc0, 
-    0xb3, 0xc0, 
-    0xcb, 0xc0, 
-    0xf4, 0xc0, 
-    0xf3, 0x40, 
-    0xeb, 0x40, 
-    0xdc, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x25 = { image_data_bc_font_ubuntu_13_0x25,
-    10, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x26[13] = {
-    0xff, 
-    0xff, 
-    0xe7, 
-    0xdb, 
-    0xdb, 
-    0xe7, 
-    0xd5, 
-    0xb9, 
-    0xb9, 
-    0xc5, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x26 = { image_data_bc_font_ubuntu_13_0x26,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x27[13] = {
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x27 = { image_data_bc_font_ubuntu_13_0x27,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x28[13] = {
-    0xf0, 
-    0xe0, 
-    0xd0, 
-    0xd0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xd0, 
-    0xd0, 
-    0xe0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x28 = { image_data_bc_font_ubuntu_13_0x28,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x29[13] = {
-    0xf0, 
-    0x70, 
-    0xb0, 
-    0xb0, 
-    0xd0, 
-    0xd0, 
-    0xd0, 
-    0xd0, 
-    0xd0, 
-    0xb0, 
-    0xb0, 
-    0x70, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x29 = { image_data_bc_font_ubuntu_13_0x29,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x2a[13] = {
-    0xfc, 
-    0xfc, 
-    0xec, 
-    0xa8, 
-    0xc4, 
-    0xd4, 
-    0xd4, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x2a = { image_data_bc_font_ubuntu_13_0x2a,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x2b[13] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xee, 
-    0xee, 
-    0x82, 
-    0xee, 
-    0xee, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x2b = { image_data_bc_font_ubuntu_13_0x2b,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x2c[13] = {
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0x60, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x2c = { image_data_bc_font_ubuntu_13_0x2c,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x2d[13] = {
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0x88, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x2d = { image_data_bc_font_ubuntu_13_0x2d,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x2e[13] = {
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x2e = { image_data_bc_font_ubuntu_13_0x2e,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x2f[13] = {
-    0xf8, 
-    0xf0, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0x78, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x2f = { image_data_bc_font_ubuntu_13_0x2f,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x30[13] = {
-    0xfe, 
-    0xfe, 
-    0xc6, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xc6, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x30 = { image_data_bc_font_ubuntu_13_0x30,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x31[13] = {
-    0xfe, 
-    0xfe, 
-    0xee, 
-    0xce, 
-    0xae, 
-    0xee, 
-    0xee, 
-    0xee, 
-    0xee, 
-    0xee, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x31 = { image_data_bc_font_ubuntu_13_0x31,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x32[13] = {
-    0xfe, 
-    0xfe, 
-    0xc6, 
-    0xba, 
-    0xfa, 
-    0xf6, 
-    0xee, 
-    0xde, 
-    0xbe, 
-    0x82, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x32 = { image_data_bc_font_ubuntu_13_0x32,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x33[13] = {
-    0xfe, 
-    0xfe, 
-    0x86, 
-    0xfa, 
-    0xfa, 
-    0xc6, 
-    0xfa, 
-    0xfa, 
-    0xfa, 
-    0x86, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x33 = { image_data_bc_font_ubuntu_13_0x33,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x34[13] = {
-    0xfe, 
-    0xfe, 
-    0xf6, 
-    0xe6, 
-    0xd6, 
-    0xd6, 
-    0xb6, 
-    0x82, 
-    0xf6, 
-    0xf6, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x34 = { image_data_bc_font_ubuntu_13_0x34,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x35[13] = {
-    0xfe, 
-    0xfe, 
-    0xc2, 
-    0xde, 
-    0xde, 
-    0xc6, 
-    0xfa, 
-    0xfa, 
-    0xfa, 
-    0x86, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x35 = { image_data_bc_font_ubuntu_13_0x35,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x36[13] = {
-    0xfe, 
-    0xfe, 
-    0xe6, 
-    0xde, 
-    0xbe, 
-    0x86, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xc6, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x36 = { image_data_bc_font_ubuntu_13_0x36,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x37[13] = {
-    0xfe, 
-    0xfe, 
-    0x82, 
-    0xfa, 
-    0xf6, 
-    0xee, 
-    0xee, 
-    0xee, 
-    0xde, 
-    0xde, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x37 = { image_data_bc_font_ubuntu_13_0x37,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x38[13] = {
-    0xfe, 
-    0xfe, 
-    0xc6, 
-    0xba, 
-    0xba, 
-    0xc6, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xc6, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x38 = { image_data_bc_font_ubuntu_13_0x38,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x39[13] = {
-    0xfe, 
-    0xfe, 
-    0xc6, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xc2, 
-    0xfa, 
-    0xf6, 
-    0xce, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x39 = { image_data_bc_font_ubuntu_13_0x39,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x3a[13] = {
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x3a = { image_data_bc_font_ubuntu_13_0x3a,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x3b[13] = {
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0x60, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x3b = { image_data_bc_font_ubuntu_13_0x3b,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x3c[13] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfa, 
-    0xc6, 
-    0xbe, 
-    0xc6, 
-    0xfa, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x3c = { image_data_bc_font_ubuntu_13_0x3c,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x3d[13] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0x82, 
-    0xfe, 
-    0x82, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x3d = { image_data_bc_font_ubuntu_13_0x3d,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x3e[13] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xbe, 
-    0xc6, 
-    0xfa, 
-    0xc6, 
-    0xbe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x3e = { image_data_bc_font_ubuntu_13_0x3e,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x3f[13] = {
-    0xf8, 
-    0xf8, 
-    0x88, 
-    0xf0, 
-    0xf0, 
-    0xe8, 
-    0xd8, 
-    0xf8, 
-    0xd8, 
-    0xd8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x3f = { image_data_bc_font_ubuntu_13_0x3f,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x40[26] = {
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xe0, 0xe0, 
-    0xdf, 0x60, 
-    0xb1, 0xa0, 
-    0xad, 0xa0, 
-    0xad, 0xa0, 
-    0xad, 0xa0, 
-    0xb2, 0x60, 
-    0xdf, 0xe0, 
-    0xe1, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x40 = { image_data_bc_font_ubuntu_13_0x40,
-    11, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x41[13] = {
-    0xfe, 
-    0xfe, 
-    0xee, 
-    0xd6, 
-    0xd6, 
-    0xd6, 
-    0xba, 
-    0x82, 
-    0xba, 
-    0x7c, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x41 = { image_data_bc_font_ubuntu_13_0x41,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x42[13] = {
-    0xff, 
-    0xff, 
-    0x83, 
-    0xbd, 
-    0xbd, 
-    0x83, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0x83, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x42 = { image_data_bc_font_ubuntu_13_0x42,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x43[13] = {
-    0xff, 
-    0xff, 
-    0xe1, 
-    0xdf, 
-    0xbf, 
-    0xbf, 
-    0xbf, 
-    0xbf, 
-    0xdf, 
-    0xe1, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x43 = { image_data_bc_font_ubuntu_13_0x43,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x44[26] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0x83, 0x80, 
-    0xbd, 0x80, 
-    0xbe, 0x80, 
-    0xbe, 0x80, 
-    0xbe, 0x80, 
-    0xbe, 0x80, 
-    0xbd, 0x80, 
-    0x83, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x44 = { image_data_bc_font_ubuntu_13_0x44,
-    9, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x45[13] = {
-    0xfe, 
-    0xfe, 
-    0x82, 
-    0xbe, 
-    0xbe, 
-    0x86, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0x82, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x45 = { image_data_bc_font_ubuntu_13_0x45,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x46[13] = {
-    0xfc, 
-    0xfc, 
-    0x80, 
-    0xbc, 
-    0xbc, 
-    0x84, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x46 = { image_data_bc_font_ubuntu_13_0x46,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x47[13] = {
-    0xff, 
-    0xff, 
-    0xe1, 
-    0xdf, 
-    0xbf, 
-    0xbf, 
-    0xbd, 
-    0xbd, 
-    0xdd, 
-    0xe1, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x47 = { image_data_bc_font_ubuntu_13_0x47,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x48[13] = {
-    0xff, 
-    0xff, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0x81, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x48 = { image_data_bc_font_ubuntu_13_0x48,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x49[13] = {
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x49 = { image_data_bc_font_ubuntu_13_0x49,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x4a[13] = {
-    0xfc, 
-    0xfc, 
-    0xf4, 
-    0xf4, 
-    0xf4, 
-    0xf4, 
-    0xf4, 
-    0xf4, 
-    0x74, 
-    0x8c, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x4a = { image_data_bc_font_ubuntu_13_0x4a,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x4b[13] = {
-    0xff, 
-    0xff, 
-    0xbd, 
-    0xbb, 
-    0xb7, 
-    0xaf, 
-    0x9f, 
-    0xa7, 
-    0xbb, 
-    0xbd, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x4b = { image_data_bc_font_ubuntu_13_0x4b,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x4c[13] = {
-    0xfc, 
-    0xfc, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0x80, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x4c = { image_data_bc_font_ubuntu_13_0x4c,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x4d[26] = {
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xbf, 0xa0, 
-    0x9f, 0x20, 
-    0xae, 0xa0, 
-    0xae, 0xa0, 
-    0xb5, 0xa0, 
-    0xb5, 0xa0, 
-    0xbb, 0xa0, 
-    0xbf, 0xa0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x4d = { image_data_bc_font_ubuntu_13_0x4d,
-    11, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x4e[26] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xbe, 0x80, 
-    0x9e, 0x80, 
-    0xae, 0x80, 
-    0xb6, 0x80, 
-    0xba, 0x80, 
-    0xba, 0x80, 
-    0xbc, 0x80, 
-    0xbe, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x4e = { image_data_bc_font_ubuntu_13_0x4e,
-    9, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x4f[26] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xe3, 0x80, 
-    0xdd, 0x80, 
-    0xbe, 0x80, 
-    0xbe, 0x80, 
-    0xbe, 0x80, 
-    0xbe, 0x80, 
-    0xdd, 0x80, 
-    0xe3, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x4f = { image_data_bc_font_ubuntu_13_0x4f,
-    9, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x50[13] = {
-    0xfe, 
-    0xfe, 
-    0x82, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0x82, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x50 = { image_data_bc_font_ubuntu_13_0x50,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x51[26] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xe3, 0x80, 
-    0xdd, 0x80, 
-    0xbe, 0x80, 
-    0xbe, 0x80, 
-    0xbe, 0x80, 
-    0xbe, 0x80, 
-    0xdd, 0x80, 
-    0xe3, 0x80, 
-    0xf7, 0x80, 
-    0xf9, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x51 = { image_data_bc_font_ubuntu_13_0x51,
-    9, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x52[13] = {
-    0xff, 
-    0xff, 
-    0x83, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0x83, 
-    0xbb, 
-    0xbd, 
-    0xbe, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x52 = { image_data_bc_font_ubuntu_13_0x52,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x53[13] = {
-    0xfc, 
-    0xfc, 
-    0xc4, 
-    0xbc, 
-    0xbc, 
-    0xcc, 
-    0xf4, 
-    0xf4, 
-    0xf4, 
-    0x8c, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x53 = { image_data_bc_font_ubuntu_13_0x53,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x54[13] = {
-    0xfe, 
-    0xfe, 
-    0x00, 
-    0xee, 
-    0xee, 
-    0xee, 
-    0xee, 
-    0xee, 
-    0xee, 
-    0xee, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x54 = { image_data_bc_font_ubuntu_13_0x54,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x55[13] = {
-    0xff, 
-    0xff, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xc3, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x55 = { image_data_bc_font_ubuntu_13_0x55,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x56[13] = {
-    0xfe, 
-    0xfe, 
-    0x7c, 
-    0x7c, 
-    0xba, 
-    0xba, 
-    0xd6, 
-    0xd6, 
-    0xd6, 
-    0xee, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x56 = { image_data_bc_font_ubuntu_13_0x56,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x57[26] = {
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0x7f, 0xc0, 
-    0x7b, 0xc0, 
-    0x7b, 0xc0, 
-    0xb5, 0xa0, 
-    0xb5, 0xa0, 
-    0xae, 0xa0, 
-    0xae, 0xa0, 
-    0xdf, 0x60, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x57 = { image_data_bc_font_ubuntu_13_0x57,
-    11, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x58[13] = {
-    0xfe, 
-    0xfe, 
-    0x7c, 
-    0xba, 
-    0xd6, 
-    0xee, 
-    0xee, 
-    0xd6, 
-    0xba, 
-    0x7c, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x58 = { image_data_bc_font_ubuntu_13_0x58,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x59[13] = {
-    0xfe, 
-    0xfe, 
-    0x7c, 
-    0xba, 
-    0xba, 
-    0xd6, 
-    0xee, 
-    0xee, 
-    0xee, 
-    0xee, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x59 = { image_data_bc_font_ubuntu_13_0x59,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x5a[13] = {
-    0xfe, 
-    0xfe, 
-    0x82, 
-    0xfa, 
-    0xf6, 
-    0xee, 
-    0xde, 
-    0xde, 
-    0xbe, 
-    0x82, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x5a = { image_data_bc_font_ubuntu_13_0x5a,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x5b[13] = {
-    0xf0, 
-    0x80, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0x80, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x5b = { image_data_bc_font_ubuntu_13_0x5b,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x5c[13] = {
-    0xf8, 
-    0x78, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0xf0, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x5c = { image_data_bc_font_ubuntu_13_0x5c,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x5d[13] = {
-    0xf0, 
-    0x10, 
-    0xd0, 
-    0xd0, 
-    0xd0, 
-    0xd0, 
-    0xd0, 
-    0xd0, 
-    0xd0, 
-    0xd0, 
-    0xd0, 
-    0x10, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x5d = { image_data_bc_font_ubuntu_13_0x5d,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x5e[13] = {
-    0xfe, 
-    0xfe, 
-    0xee, 
-    0xd6, 
-    0xd6, 
-    0xd6, 
-    0xba, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x5e = { image_data_bc_font_ubuntu_13_0x5e,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x5f[13] = {
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0x00, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x5f = { image_data_bc_font_ubuntu_13_0x5f,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x60[13] = {
-    0xf8, 
-    0xb8, 
-    0xd8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x60 = { image_data_bc_font_ubuntu_13_0x60,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x61[13] = {
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0x8c, 
-    0xf4, 
-    0xc4, 
-    0xb4, 
-    0xb4, 
-    0xc4, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x61 = { image_data_bc_font_ubuntu_13_0x61,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x62[13] = {
-    0xfe, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0x86, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0x86, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x62 = { image_data_bc_font_ubuntu_13_0x62,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x63[13] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xc2, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0xc2, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x63 = { image_data_bc_font_ubuntu_13_0x63,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x64[13] = {
-    0xfe, 
-    0xfa, 
-    0xfa, 
-    0xfa, 
-    0xc2, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xc2, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x64 = { image_data_bc_font_ubuntu_13_0x64,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x65[13] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xc6, 
-    0xba, 
-    0x82, 
-    0xbe, 
-    0xbe, 
-    0xc2, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x65 = { image_data_bc_font_ubuntu_13_0x65,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x66[13] = {
-    0xf8, 
-    0xc0, 
-    0xb8, 
-    0xb8, 
-    0x80, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x66 = { image_data_bc_font_ubuntu_13_0x66,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x67[13] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xc2, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xc2, 
-    0xfa, 
-    0x86, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x67 = { image_data_bc_font_ubuntu_13_0x67,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x68[13] = {
-    0xfe, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0x86, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x68 = { image_data_bc_font_ubuntu_13_0x68,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x69[13] = {
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x69 = { image_data_bc_font_ubuntu_13_0x69,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x6a[13] = {
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0x60, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x6a = { image_data_bc_font_ubuntu_13_0x6a,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x6b[13] = {
-    0xfc, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xb4, 
-    0xac, 
-    0x9c, 
-    0xac, 
-    0xb4, 
-    0xb8, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x6b = { image_data_bc_font_ubuntu_13_0x6b,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x6c[13] = {
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xc0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x6c = { image_data_bc_font_ubuntu_13_0x6c,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x6d[26] = {
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0x84, 0x60, 
-    0xbb, 0xa0, 
-    0xbb, 0xa0, 
-    0xbb, 0xa0, 
-    0xbb, 0xa0, 
-    0xbb, 0xa0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x6d = { image_data_bc_font_ubuntu_13_0x6d,
-    11, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x6e[13] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0x86, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x6e = { image_data_bc_font_ubuntu_13_0x6e,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x6f[13] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xc6, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xc6, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x6f = { image_data_bc_font_ubuntu_13_0x6f,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x70[13] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0x86, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0x86, 
-    0xbe, 
-    0xbe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x70 = { image_data_bc_font_ubuntu_13_0x70,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x71[13] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xc2, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xc2, 
-    0xfa, 
-    0xfa, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x71 = { image_data_bc_font_ubuntu_13_0x71,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x72[13] = {
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0x80, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x72 = { image_data_bc_font_ubuntu_13_0x72,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x73[13] = {
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xc4, 
-    0xbc, 
-    0x9c, 
-    0xe4, 
-    0xf4, 
-    0x8c, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x73 = { image_data_bc_font_ubuntu_13_0x73,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x74[13] = {
-    0xfc, 
-    0xfc, 
-    0xbc, 
-    0xbc, 
-    0x84, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xc4, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x74 = { image_data_bc_font_ubuntu_13_0x74,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x75[13] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xc2, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x75 = { image_data_bc_font_ubuntu_13_0x75,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x76[13] = {
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0x70, 
-    0x70, 
-    0xa8, 
-    0xa8, 
-    0xa8, 
-    0xd8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x76 = { image_data_bc_font_ubuntu_13_0x76,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x77[26] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0x77, 0x00, 
-    0x77, 0x00, 
-    0xaa, 0x80, 
-    0xaa, 0x80, 
-    0xaa, 0x80, 
-    0xdd, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x77 = { image_data_bc_font_ubuntu_13_0x77,
-    9, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x78[13] = {
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0x78, 
-    0xb4, 
-    0xcc, 
-    0xcc, 
-    0xb4, 
-    0x78, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x78 = { image_data_bc_font_ubuntu_13_0x78,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x79[13] = {
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0x70, 
-    0x70, 
-    0xa8, 
-    0xa8, 
-    0xa8, 
-    0xd8, 
-    0xd8, 
-    0x38, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x79 = { image_data_bc_font_ubuntu_13_0x79,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x7a[13] = {
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0x84, 
-    0xf4, 
-    0xec, 
-    0xdc, 
-    0xbc, 
-    0x84, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x7a = { image_data_bc_font_ubuntu_13_0x7a,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x7b[13] = {
-    0xf0, 
-    0xe0, 
-    0xd0, 
-    0xd0, 
-    0xd0, 
-    0xd0, 
-    0xb0, 
-    0xd0, 
-    0xd0, 
-    0xd0, 
-    0xd0, 
-    0xe0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x7b = { image_data_bc_font_ubuntu_13_0x7b,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x7c[13] = {
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x7c = { image_data_bc_font_ubuntu_13_0x7c,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x7d[13] = {
-    0xf0, 
-    0x70, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xd0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0x70, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x7d = { image_data_bc_font_ubuntu_13_0x7d,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0x7e[13] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xcc, 
-    0xb2, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0x7e = { image_data_bc_font_ubuntu_13_0x7e,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0xb0[13] = {
-    0xd0, 
-    0xa0, 
-    0xa0, 
-    0xd0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0xb0 = { image_data_bc_font_ubuntu_13_0xb0,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0xb9[13] = {
-    0xfc, 
-    0xd4, 
-    0xec, 
-    0xfc, 
-    0xc4, 
-    0xbc, 
-    0x9c, 
-    0xe4, 
-    0xf4, 
-    0x8c, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_13_0xb9 = { image_data_bc_font_ubuntu_13_0xb9,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0xbb[13] = {
-    0xfc, 
-    0xec, 
-    0xac, 
-    0xbc, 
-    0x84, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xc4, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_13_0xbb = { image_data_bc_font_ubuntu_13_0xbb,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0xbe[13] = {
-    0xfc, 
-    0xac, 
-    0xdc, 
-    0xfc, 
-    0x84, 
-    0xf4, 
-    0xec, 
-    0xdc, 
-    0xbc, 
-    0x84, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_13_0xbe = { image_data_bc_font_ubuntu_13_0xbe,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0xe1[13] = {
-    0xfc, 
-    0xf4, 
-    0xec, 
-    0xfc, 
-    0x8c, 
-    0xf4, 
-    0xc4, 
-    0xb4, 
-    0xb4, 
-    0xc4, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_13_0xe1 = { image_data_bc_font_ubuntu_13_0xe1,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0xe8[13] = {
-    0xfe, 
-    0xd6, 
-    0xee, 
-    0xfe, 
-    0xc2, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0xc2, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0xe8 = { image_data_bc_font_ubuntu_13_0xe8,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0xe9[13] = {
-    0xfe, 
-    0xf6, 
-    0xee, 
-    0xfe, 
-    0xc6, 
-    0xba, 
-    0x82, 
-    0xbe, 
-    0xbe, 
-    0xc2, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0xe9 = { image_data_bc_font_ubuntu_13_0xe9,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0xec[13] = {
-    0xd6, 
-    0xee, 
-    0xfe, 
-    0xfe, 
-    0xc6, 
-    0xba, 
-    0x82, 
-    0xbe, 
-    0xbe, 
-    0xc2, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0xec = { image_data_bc_font_ubuntu_13_0xec,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0xed[13] = {
-    0xe0, 
-    0xc0, 
-    0xa0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_13_0xed = { image_data_bc_font_ubuntu_13_0xed,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0xef[13] = {
-    0xff, 
-    0xfa, 
-    0xfa, 
-    0xfa, 
-    0xc3, 
-    0xbb, 
-    0xbb, 
-    0xbb, 
-    0xbb, 
-    0xc3, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_13_0xef = { image_data_bc_font_ubuntu_13_0xef,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0xf2[13] = {
-    0xfe, 
-    0xd6, 
-    0xee, 
-    0xfe, 
-    0x86, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0xf2 = { image_data_bc_font_ubuntu_13_0xf2,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0xf8[13] = {
-    0xf8, 
-    0xd0, 
-    0xe8, 
-    0xf8, 
-    0x80, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_13_0xf8 = { image_data_bc_font_ubuntu_13_0xf8,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0xf9[13] = {
-    0xee, 
-    0xd6, 
-    0xee, 
-    0xfe, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xc2, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0xf9 = { image_data_bc_font_ubuntu_13_0xf9,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0xfa[13] = {
-    0xfe, 
-    0xf6, 
-    0xee, 
-    0xfe, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xc2, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_13_0xfa = { image_data_bc_font_ubuntu_13_0xfa,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_13_0xfd[13] = {
-    0xf8, 
-    0xe8, 
-    0xd8, 
-    0xf8, 
-    0x70, 
-    0x70, 
-    0xa8, 
-    0xa8, 
-    0xa8, 
-    0xd8, 
-    0xd8, 
-    0x38, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_13_0xfd = { image_data_bc_font_ubuntu_13_0xfd,
-    5, 13/*, 8*/};
-#endif
-
-
-static const bc_font_char_t bc_font_ubuntu_13_array[] = {
-
-#if (0x0 == 0x0)
-  // character: ' '
-  {0x20, &bc_font_ubuntu_13_0x20},
-#else
-  // character: ' ' == ''
-  {0x20, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '!'
-  {0x21, &bc_font_ubuntu_13_0x21},
-#else
-  // character: '!' == ''
-  {0x21, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '"'
-  {0x22, &bc_font_ubuntu_13_0x22},
-#else
-  // character: '"' == ''
-  {0x22, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '#'
-  {0x23, &bc_font_ubuntu_13_0x23},
-#else
-  // character: '#' == ''
-  {0x23, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '$'
-  {0x24, &bc_font_ubuntu_13_0x24},
-#else
-  // character: '$' == ''
-  {0x24, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '%'
-  {0x25, &bc_font_ubuntu_13_0x25},
-#else
-  // character: '%' == ''
-  {0x25, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '&'
-  {0x26, &bc_font_ubuntu_13_0x26},
-#else
-  // character: '&' == ''
-  {0x26, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '''
-  {0x27, &bc_font_ubuntu_13_0x27},
-#else
-  // character: ''' == ''
-  {0x27, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '('
-  {0x28, &bc_font_ubuntu_13_0x28},
-#else
-  // character: '(' == ''
-  {0x28, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ')'
-  {0x29, &bc_font_ubuntu_13_0x29},
-#else
-  // character: ')' == ''
-  {0x29, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '*'
-  {0x2a, &bc_font_ubuntu_13_0x2a},
-#else
-  // character: '*' == ''
-  {0x2a, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '+'
-  {0x2b, &bc_font_ubuntu_13_0x2b},
-#else
-  // character: '+' == ''
-  {0x2b, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ','
-  {0x2c, &bc_font_ubuntu_13_0x2c},
-#else
-  // character: ',' == ''
-  {0x2c, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '-'
-  {0x2d, &bc_font_ubuntu_13_0x2d},
-#else
-  // character: '-' == ''
-  {0x2d, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '.'
-  {0x2e, &bc_font_ubuntu_13_0x2e},
-#else
-  // character: '.' == ''
-  {0x2e, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '/'
-  {0x2f, &bc_font_ubuntu_13_0x2f},
-#else
-  // character: '/' == ''
-  {0x2f, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '0'
-  {0x30, &bc_font_ubuntu_13_0x30},
-#else
-  // character: '0' == ''
-  {0x30, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '1'
-  {0x31, &bc_font_ubuntu_13_0x31},
-#else
-  // character: '1' == ''
-  {0x31, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '2'
-  {0x32, &bc_font_ubuntu_13_0x32},
-#else
-  // character: '2' == ''
-  {0x32, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '3'
-  {0x33, &bc_font_ubuntu_13_0x33},
-#else
-  // character: '3' == ''
-  {0x33, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '4'
-  {0x34, &bc_font_ubuntu_13_0x34},
-#else
-  // character: '4' == ''
-  {0x34, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '5'
-  {0x35, &bc_font_ubuntu_13_0x35},
-#else
-  // character: '5' == ''
-  {0x35, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '6'
-  {0x36, &bc_font_ubuntu_13_0x36},
-#else
-  // character: '6' == ''
-  {0x36, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '7'
-  {0x37, &bc_font_ubuntu_13_0x37},
-#else
-  // character: '7' == ''
-  {0x37, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '8'
-  {0x38, &bc_font_ubuntu_13_0x38},
-#else
-  // character: '8' == ''
-  {0x38, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '9'
-  {0x39, &bc_font_ubuntu_13_0x39},
-#else
-  // character: '9' == ''
-  {0x39, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ':'
-  {0x3a, &bc_font_ubuntu_13_0x3a},
-#else
-  // character: ':' == ''
-  {0x3a, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ';'
-  {0x3b, &bc_font_ubuntu_13_0x3b},
-#else
-  // character: ';' == ''
-  {0x3b, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '<'
-  {0x3c, &bc_font_ubuntu_13_0x3c},
-#else
-  // character: '<' == ''
-  {0x3c, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '='
-  {0x3d, &bc_font_ubuntu_13_0x3d},
-#else
-  // character: '=' == ''
-  {0x3d, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '>'
-  {0x3e, &bc_font_ubuntu_13_0x3e},
-#else
-  // character: '>' == ''
-  {0x3e, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '?'
-  {0x3f, &bc_font_ubuntu_13_0x3f},
-#else
-  // character: '?' == ''
-  {0x3f, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\x0040'
-  {0x40, &bc_font_ubuntu_13_0x40},
-#else
-  // character: '\x0040' == ''
-  {0x40, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'A'
-  {0x41, &bc_font_ubuntu_13_0x41},
-#else
-  // character: 'A' == ''
-  {0x41, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'B'
-  {0x42, &bc_font_ubuntu_13_0x42},
-#else
-  // character: 'B' == ''
-  {0x42, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'C'
-  {0x43, &bc_font_ubuntu_13_0x43},
-#else
-  // character: 'C' == ''
-  {0x43, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'D'
-  {0x44, &bc_font_ubuntu_13_0x44},
-#else
-  // character: 'D' == ''
-  {0x44, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'E'
-  {0x45, &bc_font_ubuntu_13_0x45},
-#else
-  // character: 'E' == ''
-  {0x45, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'F'
-  {0x46, &bc_font_ubuntu_13_0x46},
-#else
-  // character: 'F' == ''
-  {0x46, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'G'
-  {0x47, &bc_font_ubuntu_13_0x47},
-#else
-  // character: 'G' == ''
-  {0x47, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'H'
-  {0x48, &bc_font_ubuntu_13_0x48},
-#else
-  // character: 'H' == ''
-  {0x48, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'I'
-  {0x49, &bc_font_ubuntu_13_0x49},
-#else
-  // character: 'I' == ''
-  {0x49, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'J'
-  {0x4a, &bc_font_ubuntu_13_0x4a},
-#else
-  // character: 'J' == ''
-  {0x4a, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'K'
-  {0x4b, &bc_font_ubuntu_13_0x4b},
-#else
-  // character: 'K' == ''
-  {0x4b, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'L'
-  {0x4c, &bc_font_ubuntu_13_0x4c},
-#else
-  // character: 'L' == ''
-  {0x4c, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'M'
-  {0x4d, &bc_font_ubuntu_13_0x4d},
-#else
-  // character: 'M' == ''
-  {0x4d, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'N'
-  {0x4e, &bc_font_ubuntu_13_0x4e},
-#else
-  // character: 'N' == ''
-  {0x4e, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'O'
-  {0x4f, &bc_font_ubuntu_13_0x4f},
-#else
-  // character: 'O' == ''
-  {0x4f, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'P'
-  {0x50, &bc_font_ubuntu_13_0x50},
-#else
-  // character: 'P' == ''
-  {0x50, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Q'
-  {0x51, &bc_font_ubuntu_13_0x51},
-#else
-  // character: 'Q' == ''
-  {0x51, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'R'
-  {0x52, &bc_font_ubuntu_13_0x52},
-#else
-  // character: 'R' == ''
-  {0x52, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'S'
-  {0x53, &bc_font_ubuntu_13_0x53},
-#else
-  // character: 'S' == ''
-  {0x53, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'T'
-  {0x54, &bc_font_ubuntu_13_0x54},
-#else
-  // character: 'T' == ''
-  {0x54, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'U'
-  {0x55, &bc_font_ubuntu_13_0x55},
-#else
-  // character: 'U' == ''
-  {0x55, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'V'
-  {0x56, &bc_font_ubuntu_13_0x56},
-#else
-  // character: 'V' == ''
-  {0x56, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'W'
-  {0x57, &bc_font_ubuntu_13_0x57},
-#else
-  // character: 'W' == ''
-  {0x57, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'X'
-  {0x58, &bc_font_ubuntu_13_0x58},
-#else
-  // character: 'X' == ''
-  {0x58, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Y'
-  {0x59, &bc_font_ubuntu_13_0x59},
-#else
-  // character: 'Y' == ''
-  {0x59, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Z'
-  {0x5a, &bc_font_ubuntu_13_0x5a},
-#else
-  // character: 'Z' == ''
-  {0x5a, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '['
-  {0x5b, &bc_font_ubuntu_13_0x5b},
-#else
-  // character: '[' == ''
-  {0x5b, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\'
-  {0x5c, &bc_font_ubuntu_13_0x5c},
-#else
-  // character: '\' == ''
-  {0x5c, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ']'
-  {0x5d, &bc_font_ubuntu_13_0x5d},
-#else
-  // character: ']' == ''
-  {0x5d, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '^'
-  {0x5e, &bc_font_ubuntu_13_0x5e},
-#else
-  // character: '^' == ''
-  {0x5e, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '_'
-  {0x5f, &bc_font_ubuntu_13_0x5f},
-#else
-  // character: '_' == ''
-  {0x5f, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '`'
-  {0x60, &bc_font_ubuntu_13_0x60},
-#else
-  // character: '`' == ''
-  {0x60, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'a'
-  {0x61, &bc_font_ubuntu_13_0x61},
-#else
-  // character: 'a' == ''
-  {0x61, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'b'
-  {0x62, &bc_font_ubuntu_13_0x62},
-#else
-  // character: 'b' == ''
-  {0x62, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'c'
-  {0x63, &bc_font_ubuntu_13_0x63},
-#else
-  // character: 'c' == ''
-  {0x63, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'd'
-  {0x64, &bc_font_ubuntu_13_0x64},
-#else
-  // character: 'd' == ''
-  {0x64, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'e'
-  {0x65, &bc_font_ubuntu_13_0x65},
-#else
-  // character: 'e' == ''
-  {0x65, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'f'
-  {0x66, &bc_font_ubuntu_13_0x66},
-#else
-  // character: 'f' == ''
-  {0x66, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'g'
-  {0x67, &bc_font_ubuntu_13_0x67},
-#else
-  // character: 'g' == ''
-  {0x67, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'h'
-  {0x68, &bc_font_ubuntu_13_0x68},
-#else
-  // character: 'h' == ''
-  {0x68, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'i'
-  {0x69, &bc_font_ubuntu_13_0x69},
-#else
-  // character: 'i' == ''
-  {0x69, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'j'
-  {0x6a, &bc_font_ubuntu_13_0x6a},
-#else
-  // character: 'j' == ''
-  {0x6a, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'k'
-  {0x6b, &bc_font_ubuntu_13_0x6b},
-#else
-  // character: 'k' == ''
-  {0x6b, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'l'
-  {0x6c, &bc_font_ubuntu_13_0x6c},
-#else
-  // character: 'l' == ''
-  {0x6c, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'm'
-  {0x6d, &bc_font_ubuntu_13_0x6d},
-#else
-  // character: 'm' == ''
-  {0x6d, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'n'
-  {0x6e, &bc_font_ubuntu_13_0x6e},
-#else
-  // character: 'n' == ''
-  {0x6e, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'o'
-  {0x6f, &bc_font_ubuntu_13_0x6f},
-#else
-  // character: 'o' == ''
-  {0x6f, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'p'
-  {0x70, &bc_font_ubuntu_13_0x70},
-#else
-  // character: 'p' == ''
-  {0x70, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'q'
-  {0x71, &bc_font_ubuntu_13_0x71},
-#else
-  // character: 'q' == ''
-  {0x71, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'r'
-  {0x72, &bc_font_ubuntu_13_0x72},
-#else
-  // character: 'r' == ''
-  {0x72, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 's'
-  {0x73, &bc_font_ubuntu_13_0x73},
-#else
-  // character: 's' == ''
-  {0x73, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 't'
-  {0x74, &bc_font_ubuntu_13_0x74},
-#else
-  // character: 't' == ''
-  {0x74, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'u'
-  {0x75, &bc_font_ubuntu_13_0x75},
-#else
-  // character: 'u' == ''
-  {0x75, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'v'
-  {0x76, &bc_font_ubuntu_13_0x76},
-#else
-  // character: 'v' == ''
-  {0x76, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'w'
-  {0x77, &bc_font_ubuntu_13_0x77},
-#else
-  // character: 'w' == ''
-  {0x77, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'x'
-  {0x78, &bc_font_ubuntu_13_0x78},
-#else
-  // character: 'x' == ''
-  {0x78, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'y'
-  {0x79, &bc_font_ubuntu_13_0x79},
-#else
-  // character: 'y' == ''
-  {0x79, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'z'
-  {0x7a, &bc_font_ubuntu_13_0x7a},
-#else
-  // character: 'z' == ''
-  {0x7a, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '{'
-  {0x7b, &bc_font_ubuntu_13_0x7b},
-#else
-  // character: '{' == ''
-  {0x7b, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '|'
-  {0x7c, &bc_font_ubuntu_13_0x7c},
-#else
-  // character: '|' == ''
-  {0x7c, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '}'
-  {0x7d, &bc_font_ubuntu_13_0x7d},
-#else
-  // character: '}' == ''
-  {0x7d, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '~'
-  {0x7e, &bc_font_ubuntu_13_0x7e},
-#else
-  // character: '~' == ''
-  {0x7e, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '°'
-  {0xb0, &bc_font_ubuntu_13_0xb0},
-#else
-  // character: '°' == ''
-  {0xb0, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'š'
-  {0xb9, &bc_font_ubuntu_13_0xb9},
-#else
-  // character: 'š' == ''
-  {0xb9, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ť'
-  {0xbb, &bc_font_ubuntu_13_0xbb},
-#else
-  // character: 'ť' == ''
-  {0xbb, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ž'
-  {0xbe, &bc_font_ubuntu_13_0xbe},
-#else
-  // character: 'ž' == ''
-  {0xbe, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'á'
-  {0xe1, &bc_font_ubuntu_13_0xe1},
-#else
-  // character: 'á' == ''
-  {0xe1, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'č'
-  {0xe8, &bc_font_ubuntu_13_0xe8},
-#else
-  // character: 'č' == ''
-  {0xe8, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'é'
-  {0xe9, &bc_font_ubuntu_13_0xe9},
-#else
-  // character: 'é' == ''
-  {0xe9, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ě'
-  {0xec, &bc_font_ubuntu_13_0xec},
-#else
-  // character: 'ě' == ''
-  {0xec, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'í'
-  {0xed, &bc_font_ubuntu_13_0xed},
-#else
-  // character: 'í' == ''
-  {0xed, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ď'
-  {0xef, &bc_font_ubuntu_13_0xef},
-#else
-  // character: 'ď' == ''
-  {0xef, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ň'
-  {0xf2, &bc_font_ubuntu_13_0xf2},
-#else
-  // character: 'ň' == ''
-  {0xf2, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ř'
-  {0xf8, &bc_font_ubuntu_13_0xf8},
-#else
-  // character: 'ř' == ''
-  {0xf8, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ů'
-  {0xf9, &bc_font_ubuntu_13_0xf9},
-#else
-  // character: 'ů' == ''
-  {0xf9, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ú'
-  {0xfa, &bc_font_ubuntu_13_0xfa},
-#else
-  // character: 'ú' == ''
-  {0xfa, &bc_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ý'
-  {0xfd, &bc_font_ubuntu_13_0xfd}
-#else
-  // character: 'ý' == ''
-  {0xfd, &bc_font_ubuntu_13_0x}
-#endif
-
-};
-
-
-const bc_font_t bc_font_ubuntu_13 = { 110, bc_font_ubuntu_13_array };
+// Glyphs are compressed by sdk/tools/font/bc-font-rle.py
+
+static const uint8_t bc_font_ubuntu_13_rle_data[903] = {
+    // ' '
+    0xff, 0x90,
+    // '!'
+    0x71, 0xe1, 0x21, 0x51, 0x70,
+    // '"'
+    0x61, 0x11, 0xc1, 0x11, 0xff, 0xb0,
+    // '#'
+    0xf4, 0x11, 0x1b, 0x21, 0x11, 0x12, 0x21, 0x11, 0x13, 0x43, 0x11, 0x11, 0x22, 0x11, 0x11, 0x2b, 0x11, 0x1f, 0x40,
+    // '$'
+    0x31, 0xc1, 0x12, 0x25, 0x93, 0x53, 0x62, 0x95, 0x22, 0x11, 0xc1, 0x30,
+    // '%'
+    0xf7, 0x23, 0x13, 0x41, 0x27, 0x24, 0x47, 0x67, 0x44, 0x27, 0x21, 0x43, 0x13, 0x2f, 0x70,
+    // '&'
+    0xf4, 0x25, 0x4c, 0x44, 0x22, 0x12, 0x21, 0x2b, 0x54, 0x31, 0x1f, 0x20,
+    // "'"
+    0x41, 0x81, 0xfa,
+    // '('
+    0x71, 0x22, 0x52, 0xf3, 0x27, 0x23, 0x10,
+    // ')'
+    0x41, 0x32, 0x72, 0xf3, 0x25, 0x22, 0x13,
+    // '*'
+    0xf0, 0x13, 0x13, 0x11, 0x21, 0x23, 0x1a, 0x11, 0x1f, 0xf1,
+    // '+'
+    0xff, 0x11, 0xb2, 0x12, 0x22, 0x12, 0xb1, 0xf9,
+    // ','
+    0xfa, 0x17, 0x21, 0x12,
+    // '-'
+    0xff, 0x13, 0x23, 0xfb,
+    // '.'
+    0xfa, 0x15, 0x17,
+    // '/'
+    0x91, 0x32, 0xc2, 0xc2, 0xc2, 0x31, 0x40,
+    // '0'
+    0xf1, 0x33, 0x5f, 0xf7, 0x53, 0x3f, 0x10,
+    // '1'
+    0xf2, 0x15, 0x15, 0x25, 0x1f, 0xf6, 0x1f, 0x20,
+    // '2'
+    0xf1, 0x33, 0x52, 0x19, 0x24, 0x24, 0x24, 0x26, 0x42, 0x5f, 0x00,
+    // '3'
+    0xf0, 0x43, 0x5a, 0x43, 0x4f, 0x15, 0x24, 0xf1,
+    // '4'
+    0xf3, 0x15, 0x15, 0x2b, 0x26, 0x21, 0x12, 0x31, 0x1c, 0x1f, 0x10,
+    // '5'
+    0xf1, 0x44, 0x3b, 0x24, 0x4f, 0x15, 0x24, 0xf1,
+    // '6'
+    0xf2, 0x24, 0x33, 0x26, 0x34, 0x4f, 0x15, 0x33, 0xf1,
+    // '7'
+    0xf0, 0x52, 0x46, 0x24, 0x2f, 0x32, 0xc1, 0xf3,
+    // '8'
+    0xf1, 0x33, 0x59, 0x52, 0x5f, 0x15, 0x33, 0xf1,
+    // '9'
+    0xf1, 0x33, 0x5f, 0x14, 0x43, 0x62, 0x33, 0x42, 0xf2,
+    // ':'
+    0xa1, 0x51, 0x81, 0x51, 0x70,
+    // ';'
+    0xa1, 0x51, 0x81, 0x72, 0x11, 0x20,
+    // '<'
+    0xff, 0x31, 0x34, 0x24, 0x34, 0x44, 0x61, 0xf7,
+    // '='
+    0xff, 0xd5, 0x25, 0x25, 0x25, 0xf7,
+    // '>'
+    0xfe, 0x16, 0x44, 0x43, 0x42, 0x43, 0x1f, 0xb0,
+    // '?'
+    0xb3, 0x24, 0x82, 0x22, 0x31, 0x41, 0x91, 0xc0,
+    // '@'
+    0xfa, 0x55, 0x73, 0x21, 0x31, 0x24, 0x3f, 0xf0, 0x72, 0x21, 0x21, 0x24, 0x57, 0x4f, 0x00,
+    // 'A'
+    0xf2, 0x15, 0x3f, 0x22, 0x12, 0x33, 0x43, 0x22, 0x33, 0x51, 0xe0,
+    // 'B'
+    0xf2, 0x54, 0x5b, 0x53, 0x5f, 0x45, 0x25, 0xf3,
+    // 'C'
+    0xf4, 0x43, 0x52, 0x2f, 0xf0, 0x27, 0x54, 0x4f, 0x20,
+    // 'D'
+    0xf4, 0x55, 0x58, 0x2f, 0xf4, 0x23, 0x53, 0x5f, 0x60,
+    // 'E'
+    0xf0, 0x53, 0x4a, 0x34, 0x3f, 0x34, 0x25, 0xf0,
+    // 'F'
+    0xd5, 0x24, 0x83, 0x33, 0xf5, 0x1f, 0x10,
+    // 'G'
+    0xf4, 0x43, 0x52, 0x2f, 0x41, 0xa2, 0x74, 0x54, 0xf2,
+    // 'H'
+    0xf2, 0x14, 0x1f, 0x44, 0x44, 0xfc, 0x14, 0x1f, 0x20,
+    // 'I'
+    0x71, 0xf8, 0x17,
+    // 'J'
+    0xf1, 0x1f, 0xf1, 0x15, 0x52, 0x3e,
+    // 'K'
+    0xf2, 0x14, 0x16, 0x25, 0x25, 0x25, 0x26, 0x36, 0x37, 0x22, 0x14, 0x1f, 0x20,
+    // 'L'
+    0xd1, 0xff, 0xc4, 0x15, 0xc0,
+    // 'M'
+    0xf8, 0x17, 0x13, 0x15, 0x14, 0x23, 0x2f, 0x12, 0x12, 0xf3, 0x39, 0x16, 0x17, 0x1f, 0x80,
+    // 'N'
+    0xf4, 0x15, 0x13, 0x18, 0x28, 0x28, 0x2f, 0x22, 0x81, 0x31, 0x51, 0xf4,
+    // 'O'
+    0xf6, 0x35, 0x53, 0x23, 0x2f, 0xe2, 0x32, 0x35, 0x53, 0xf6,
+    // 'P'
+    0xf0, 0x53, 0x5f, 0x15, 0x24, 0xf1, 0x1f, 0x40,
+    // 'Q'
+    0xf6, 0x35, 0x53, 0x23, 0x2f, 0xe2, 0x32, 0x35, 0x51, 0x11, 0x73, 0x72, 0x20,
+    // 'R'
+    0xf2, 0x54, 0x5f, 0x45, 0x33, 0x82, 0x72, 0x11, 0x51, 0xf1,
+    // 'S'
+    0xe3, 0x24, 0x83, 0x43, 0xe4, 0x23, 0xe0,
+    // 'T'
+    0xea, 0x13, 0xff, 0xf0, 0x1f, 0x20,
+    // 'U'
+    0xf2, 0x14, 0x1f, 0xff, 0x56, 0x34, 0xf3,
+    // 'V'
+    0xe1, 0x51, 0x72, 0x32, 0x82, 0x12, 0xf2, 0x35, 0x1f, 0x20,
+    // 'W'
+    0xf7, 0x19, 0x15, 0x1f, 0x12, 0x23, 0x22, 0xe2, 0x12, 0xf0, 0x33, 0x33, 0x15, 0x1f, 0x90,
+    // 'X'
+    0xe1, 0x53, 0x32, 0x12, 0x12, 0x33, 0xb3, 0x32, 0x12, 0x12, 0x33, 0x51, 0xe0,
+    // 'Y'
+    0xe1, 0x53, 0x32, 0x82, 0x12, 0x33, 0xfb, 0x1f, 0x20,
+    // 'Z'
+    0xf0, 0x52, 0x46, 0x24, 0x24, 0x2b, 0x26, 0x42, 0x5f, 0x00,
+    // '['
+    0x53, 0x22, 0xff, 0x42, 0x13,
+    // '\\'
+    0x51, 0x42, 0xe2, 0xe2, 0xe2, 0x41,
+    // ']'
+    0x43, 0x12, 0xff, 0x42, 0x23, 0x10,
+    // '^'
+    0xf2, 0x15, 0x3f, 0x22, 0x12, 0x21, 0x31, 0xff, 0x60,
+    // '_'
+    0xff, 0xff, 0x6c,
+    // '`'
+    0x61, 0x42, 0x41, 0xff, 0xf2,
+    // 'a'
+    0xfa, 0x33, 0x43, 0x23, 0x39, 0x34, 0x3d,
+    // 'b'
+    0x81, 0xf6, 0x34, 0x4f, 0x94, 0x24, 0xf1,
+    // 'c'
+    0xff, 0x04, 0x25, 0xf8, 0x53, 0x4f, 0x00,
+    // 'd'
+    0xc1, 0xf2, 0x33, 0x4f, 0x94, 0x44, 0xf0,
+    // 'e'
+    0xff, 0x03, 0x35, 0x33, 0x44, 0x95, 0x34, 0xf0,
+    // 'f'
+    0x73, 0x14, 0x73, 0x23, 0xf6, 0x1d,
+    // 'g'
+    0xff, 0x04, 0x24, 0xf9, 0x44, 0x33, 0x52, 0x42,
+    // 'h'
+    0x81, 0xf6, 0x34, 0x4f, 0xf0, 0x13, 0x1f, 0x00,
+    // 'i'
+    0x41, 0x51, 0x21, 0xf2, 0x17,
+    // 'j'
+    0x41, 0x51, 0x21, 0xf4, 0x21, 0x12,
+    // 'k'
+    0x71, 0xf5, 0x14, 0x23, 0x24, 0x25, 0x25, 0x21, 0x13, 0x1c,
+    // 'l'
+    0x41, 0xf8, 0x22, 0x16,
+    // 'm'
+    0xff, 0xf0, 0x41, 0x34, 0x8f, 0xff, 0x11, 0x31, 0x31, 0xf8,
+    // 'n'
+    0xfe, 0x44, 0x4f, 0xf0, 0x13, 0x1f, 0x00,
+    // 'o'
+    0xff, 0x03, 0x35, 0xf8, 0x53, 0x3f, 0x10,
+    // 'p'
+    0xfe, 0x44, 0x4f, 0x94, 0x33, 0xa1, 0x50,
+    // 'q'
+    0xff, 0x04, 0x24, 0xf9, 0x44, 0x3e, 0x11,
+    // 'r'
+    0xf6, 0x42, 0x3f, 0x61, 0xd0,
+    // 's'
+    0xfb, 0x32, 0x43, 0x14, 0x44, 0x13, 0x42, 0x3e,
+    // 't'
+    0xd1, 0xc3, 0x33, 0xf5, 0x43, 0x3d,
+    // 'u'
+    0xfe, 0x13, 0x1f, 0xf0, 0x44, 0x4f, 0x00,
+    // 'v'
+    0xf5, 0x13, 0x15, 0x21, 0x2b, 0x33, 0x1c,
+    // 'w'
+    0xff, 0x61, 0x31, 0x31, 0x92, 0x13, 0x12, 0xf4, 0x31, 0x33, 0x13, 0x1f, 0x50,
+    // 'x'
+    0xf9, 0x14, 0x32, 0x21, 0x48, 0x41, 0x22, 0x34, 0x1c,
+    // 'y'
+    0xf5, 0x13, 0x15, 0x21, 0x2b, 0x36, 0x32, 0x23,
+    // 'z'
+    0xfa, 0x42, 0x35, 0x23, 0x23, 0x25, 0x32, 0x4d,
+    // '{'
+    0x71, 0x22, 0xd2, 0x22, 0xf0, 0x23, 0x10,
+    // '|'
+    0x41, 0xff, 0x21, 0x10,
+    // '}'
+    0x41, 0x32, 0xf0, 0x22, 0x2d, 0x22, 0x13,
+    // '~'
+    0xff, 0x72, 0x21, 0x16, 0x11, 0x22, 0xff, 0x60,
+    // '°'
+    0x21, 0x23, 0x53, 0x21, 0xff, 0x30,
+    // 'š'
+    0x81, 0x11, 0x33, 0x41, 0x43, 0x24, 0x31, 0x44, 0x41, 0x34, 0x23, 0xe0,
+    // 'ť'
+    0x91, 0x31, 0x71, 0x43, 0x33, 0xf5, 0x43, 0x3d,
+    // 'ž'
+    0x71, 0x11, 0x33, 0x41, 0x44, 0x23, 0x52, 0x32, 0x32, 0x53, 0x24, 0xd0,
+    // 'á'
+    0xa1, 0x42, 0x41, 0x33, 0x34, 0x32, 0x33, 0x93, 0x43, 0xd0,
+    // 'č'
+    0x91, 0x11, 0x43, 0x51, 0x54, 0x25, 0xf8, 0x53, 0x4f, 0x00,
+    // 'é'
+    0xb1, 0x52, 0x51, 0x53, 0x35, 0x33, 0x44, 0x95, 0x34, 0xf0,
+    // 'ě'
+    0x21, 0x11, 0x43, 0x51, 0xc3, 0x35, 0x33, 0x44, 0x95, 0x34, 0xf0,
+    // 'í'
+    0x51, 0x12, 0x11, 0x21, 0xf2, 0x17,
+    // 'ď'
+    0xd1, 0x11, 0xf3, 0x32, 0x11, 0x4f, 0xd4, 0x54, 0xf3,
+    // 'ň'
+    0x91, 0x11, 0x43, 0x51, 0x44, 0x44, 0xff, 0x01, 0x31, 0xf0,
+    // 'ř'
+    0x71, 0x11, 0x23, 0x31, 0x24, 0x23, 0xf6, 0x1d,
+    // 'ů'
+    0x31, 0x53, 0x43, 0x51, 0x41, 0x31, 0xff, 0x04, 0x44, 0xf0,
+    // 'ú'
+    0xb1, 0x52, 0x51, 0x41, 0x31, 0xff, 0x04, 0x44, 0xf0,
+    // 'ý'
+    0x81, 0x32, 0x31, 0x21, 0x31, 0x52, 0x12, 0xb3, 0x63, 0x22, 0x30,
+};
+
+static const bc_font_rle_char_t bc_font_ubuntu_13_rle_chars[110] = {
+    { 0x20, 3, 0 },
+    { 0x21, 3, 2 },
+    { 0x22, 5, 7 },
+    { 0x23, 8, 13 },
+    { 0x24, 7, 32 },
+    { 0x25, 10, 44 },
+    { 0x26, 8, 59 },
+    { 0x27, 3, 71 },
+    { 0x28, 4, 74 },
+    { 0x29, 4, 81 },
+    { 0x2a, 6, 88 },
+    { 0x2b, 7, 98 },
+    { 0x2c, 3, 106 },
+    { 0x2d, 5, 110 },
+    { 0x2e, 3, 114 },
+    { 0x2f, 5, 117 },
+    { 0x30, 7, 124 },
+    { 0x31, 7, 131 },
+    { 0x32, 7, 139 },
+    { 0x33, 7, 150 },
+    { 0x34, 7, 158 },
+    { 0x35, 7, 169 },
+    { 0x36, 7, 177 },
+    { 0x37, 7, 186 },
+    { 0x38, 7, 194 },
+    { 0x39, 7, 202 },
+    { 0x3a, 3, 211 },
+    { 0x3b, 3, 216 },
+    { 0x3c, 7, 222 },
+    { 0x3d, 7, 230 },
+    { 0x3e, 7, 236 },
+    { 0x3f, 5, 244 },
+    { 0x40, 11, 252 },
+    { 0x41, 7, 267 },
+    { 0x42, 8, 278 },
+    { 0x43, 8, 286 },
+    { 0x44, 9, 295 },
+    { 0x45, 7, 304 },
+    { 0x46, 6, 312 },
+    { 0x47, 8, 319 },
+    { 0x48, 8, 328 },
+    { 0x49, 3, 337 },
+    { 0x4a, 6, 340 },
+    { 0x4b, 8, 346 },
+    { 0x4c, 6, 359 },
+    { 0x4d, 11, 364 },
+    { 0x4e, 9, 379 },
+    { 0x4f, 9, 391 },
+    { 0x50, 7, 401 },
+    { 0x51, 9, 409 },
+    { 0x52, 8, 422 },
+    { 0x53, 6, 432 },
+    { 0x54, 7, 439 },
+    { 0x55, 8, 445 },
+    { 0x56, 7, 452 },
+    { 0x57, 11, 462 },
+    { 0x58, 7, 477 },
+    { 0x59, 7, 490 },
+    { 0x5a, 7, 499 },
+    { 0x5b, 4, 509 },
+    { 0x5c, 5, 514 },
+    { 0x5d, 4, 520 },
+    { 0x5e, 7, 526 },
+    { 0x5f, 6, 535 },
+    { 0x60, 5, 538 },
+    { 0x61, 6, 543 },
+    { 0x62, 7, 550 },
+    { 0x63, 7, 557 },
+    { 0x64, 7, 564 },
+    { 0x65, 7, 571 },
+    { 0x66, 5, 579 },
+    { 0x67, 7, 585 },
+    { 0x68, 7, 593 },
+    { 0x69, 3, 601 },
+    { 0x6a, 3, 606 },
+    { 0x6b, 6, 612 },
+    { 0x6c, 3, 622 },
+    { 0x6d, 11, 626 },
+    { 0x6e, 7, 636 },
+    { 0x6f, 7, 643 },
+    { 0x70, 7, 650 },
+    { 0x71, 7, 657 },
+    { 0x72, 5, 664 },
+    { 0x73, 6, 669 },
+    { 0x74, 6, 677 },
+    { 0x75, 7, 683 },
+    { 0x76, 5, 690 },
+    { 0x77, 9, 697 },
+    { 0x78, 6, 710 },
+    { 0x79, 5, 719 },
+    { 0x7a, 6, 727 },
+    { 0x7b, 4, 735 },
+    { 0x7c, 3, 742 },
+    { 0x7d, 4, 746 },
+    { 0x7e, 7, 753 },
+    { 0xb0, 4, 761 },
+    { 0xb9, 6, 767 },
+    { 0xbb, 6, 779 },
+    { 0xbe, 6, 787 },
+    { 0xe1, 6, 799 },
+    { 0xe8, 7, 809 },
+    { 0xe9, 7, 819 },
+    { 0xec, 7, 829 },
+    { 0xed, 3, 840 },
+    { 0xef, 8, 846 },
+    { 0xf2, 7, 855 },
+    { 0xf8, 5, 865 },
+    { 0xf9, 7, 873 },
+    { 0xfa, 7, 883 },
+    { 0xfd, 5, 892 },
+};
+
+static const uint8_t bc_font_ubuntu_13_index[BC_FONT_INDEX_LENGTH] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xff, 0x61, 0xff, 0xff, 0x62, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x65, 0xff, 0xff, 0x66, 0x67, 0xff, 0x68,
+    0xff, 0xff, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x6b, 0x6c, 0xff, 0xff, 0x6d, 0xff, 0xff,
+};
+
+const bc_font_t bc_font_ubuntu_13 = { 110, NULL, bc_font_ubuntu_13_index, 13, bc_font_ubuntu_13_rle_chars, bc_font_ubuntu_13_rle_data };
@@ -27,3313 +27,359 @@
 
 #include <bc_font_common.h>
 
-
-
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x20[15] = {
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x20 = { image_data_bc_font_ubuntu_15_0x20,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x21[15] = {
-    0xf0, 
-    0xf0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xf0, 
-    0xb0, 
-    0xb0, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x21 = { image_data_bc_font_ubuntu_15_0x21,
-    4, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x22[15] = {
-    0xfc, 
-    0xac, 
-    0xac, 
-    0xac, 
-    0xac, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x22 = { image_data_bc_font_ubuntu_15_0x22,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x23[30] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xf5, 0x80, 
-    0xf5, 0x80, 
-    0xed, 0x80, 
-    0x80, 0x80, 
-    0xeb, 0x80, 
-    0xeb, 0x80, 
-    0x80, 0x80, 
-    0xdb, 0x80, 
-    0xd7, 0x80, 
-    0xd7, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x23 = { image_data_bc_font_ubuntu_15_0x23,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x24[15] = {
-    0xff, 
-    0xef, 
-    0xef, 
-    0xc3, 
-    0xbf, 
-    0xbf, 
-    0xdf, 
-    0xe7, 
-    0xfb, 
-    0xfd, 
-    0xfd, 
-    0x83, 
-    0xef, 
-    0xef, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x24 = { image_data_bc_font_ubuntu_15_0x24,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x25[30] = {
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xcf, 0x70, 
-    0xb6, 0xf0, 
-    0xb6, 0xf0, 
-    0xb5, 0xf0, 
-    0xcd, 0xf0, 
-    0xfb, 0x30, 
-    0xfa, 0xd0, 
-    0xf6, 0xd0, 
-    0xf6, 0xd0, 
-    0xef, 0x30, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x25 = { image_data_bc_font_ubuntu_15_0x25,
-    12, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x26[30] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xe7, 0x80, 
-    0xdb, 0x80, 
-    0xdb, 0x80, 
-    0xd7, 0x80, 
-    0xef, 0x80, 
-    0xd6, 0x80, 
-    0xba, 0x80, 
-    0xbd, 0x80, 
-    0xba, 0x80, 
-    0xc7, 0x00, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x26 = { image_data_bc_font_ubuntu_15_0x26,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x27[15] = {
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x27 = { image_data_bc_font_ubuntu_15_0x27,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x28[15] = {
-    0xf8, 
-    0xe8, 
-    0xd8, 
-    0xd8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xd8, 
-    0xd8, 
-    0xe8
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x28 = { image_data_bc_font_ubuntu_15_0x28,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x29[15] = {
-    0xf8, 
-    0xb8, 
-    0xd8, 
-    0xd8, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0xd8, 
-    0xd8, 
-    0xb8
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x29 = { image_data_bc_font_ubuntu_15_0x29,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x2a[15] = {
-    0xfe, 
-    0xfe, 
-    0xee, 
-    0xaa, 
-    0xc6, 
-    0xd6, 
-    0xba, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x2a = { image_data_bc_font_ubuntu_15_0x2a,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x2b[15] = {
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xef, 
-    0xef, 
-    0xef, 
-    0x01, 
-    0xef, 
-    0xef, 
-    0xef, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x2b = { image_data_bc_font_ubuntu_15_0x2b,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x2c[15] = {
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0x60, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x2c = { image_data_bc_font_ubuntu_15_0x2c,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x2d[15] = {
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0x88, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x2d = { image_data_bc_font_ubuntu_15_0x2d,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x2e[15] = {
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x2e = { image_data_bc_font_ubuntu_15_0x2e,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x2f[15] = {
-    0xfc, 
-    0xf8, 
-    0xf4, 
-    0xf4, 
-    0xf4, 
-    0xec, 
-    0xec, 
-    0xec, 
-    0xdc, 
-    0xdc, 
-    0xdc, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0x7c
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x2f = { image_data_bc_font_ubuntu_15_0x2f,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x30[15] = {
-    0xff, 
-    0xff, 
-    0xc3, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xc3, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x30 = { image_data_bc_font_ubuntu_15_0x30,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x31[15] = {
-    0xff, 
-    0xff, 
-    0xf7, 
-    0xe7, 
-    0xd7, 
-    0xb7, 
-    0xf7, 
-    0xf7, 
-    0xf7, 
-    0xf7, 
-    0xf7, 
-    0xf7, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x31 = { image_data_bc_font_ubuntu_15_0x31,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x32[15] = {
-    0xff, 
-    0xff, 
-    0xc3, 
-    0xbd, 
-    0xfd, 
-    0xfd, 
-    0xfb, 
-    0xf7, 
-    0xef, 
-    0xdf, 
-    0xbf, 
-    0x81, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x32 = { image_data_bc_font_ubuntu_15_0x32,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x33[15] = {
-    0xff, 
-    0xff, 
-    0x83, 
-    0xfd, 
-    0xfd, 
-    0xfd, 
-    0xe3, 
-    0xfd, 
-    0xfd, 
-    0xfd, 
-    0xfd, 
-    0x83, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x33 = { image_data_bc_font_ubuntu_15_0x33,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x34[15] = {
-    0xff, 
-    0xff, 
-    0xfb, 
-    0xf3, 
-    0xeb, 
-    0xdb, 
-    0xdb, 
-    0xbb, 
-    0x81, 
-    0xfb, 
-    0xfb, 
-    0xfb, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x34 = { image_data_bc_font_ubuntu_15_0x34,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x35[15] = {
-    0xff, 
-    0xff, 
-    0xc1, 
-    0xdf, 
-    0xdf, 
-    0xdf, 
-    0xc3, 
-    0xfd, 
-    0xfd, 
-    0xfd, 
-    0xfd, 
-    0x83, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x35 = { image_data_bc_font_ubuntu_15_0x35,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x36[15] = {
-    0xff, 
-    0xff, 
-    0xf3, 
-    0xef, 
-    0xdf, 
-    0xbf, 
-    0x83, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xc3, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x36 = { image_data_bc_font_ubuntu_15_0x36,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x37[15] = {
-    0xff, 
-    0xff, 
-    0x81, 
-    0xfd, 
-    0xfb, 
-    0xf7, 
-    0xf7, 
-    0xef, 
-    0xef, 
-    0xdf, 
-    0xdf, 
-    0xdf, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x37 = { image_data_bc_font_ubuntu_15_0x37,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x38[15] = {
-    0xff, 
-    0xff, 
-    0xc3, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xc3, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xc3, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x38 = { image_data_bc_font_ubuntu_15_0x38,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x39[15] = {
-    0xff, 
-    0xff, 
-    0xc3, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xc1, 
-    0xfd, 
-    0xfb, 
-    0xf7, 
-    0xcf, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x39 = { image_data_bc_font_ubuntu_15_0x39,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x3a[15] = {
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x3a = { image_data_bc_font_ubuntu_15_0x3a,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x3b[15] = {
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0x60, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x3b = { image_data_bc_font_ubuntu_15_0x3b,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x3c[15] = {
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xfd, 
-    0xf3, 
-    0xcf, 
-    0xbf, 
-    0xcf, 
-    0xf3, 
-    0xfd, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x3c = { image_data_bc_font_ubuntu_15_0x3c,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x3d[15] = {
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0x81, 
-    0xff, 
-    0xff, 
-    0x81, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x3d = { image_data_bc_font_ubuntu_15_0x3d,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x3e[15] = {
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xbf, 
-    0xcf, 
-    0xf3, 
-    0xfd, 
-    0xf3, 
-    0xcf, 
-    0xbf, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x3e = { image_data_bc_font_ubuntu_15_0x3e,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x3f[15] = {
-    0xfc, 
-    0xfc, 
-    0x84, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xe4, 
-    0xdc, 
-    0xdc, 
-    0xfc, 
-    0xdc, 
-    0xdc, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x3f = { image_data_bc_font_ubuntu_15_0x3f,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x40[30] = {
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xf0, 0x78, 
-    0xef, 0xb8, 
-    0xdf, 0xd8, 
-    0xb8, 0x68, 
-    0xb7, 0x68, 
-    0xb7, 0x68, 
-    0xb7, 0x68, 
-    0xb7, 0x68, 
-    0xb8, 0x98, 
-    0xdf, 0xf8, 
-    0xef, 0xf8, 
-    0xf0, 0x78, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x40 = { image_data_bc_font_ubuntu_15_0x40,
-    13, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x41[30] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xf7, 0x80, 
-    0xeb, 0x80, 
-    0xeb, 0x80, 
-    0xeb, 0x80, 
-    0xdd, 0x80, 
-    0xdd, 0x80, 
-    0x80, 0x80, 
-    0xbe, 0x80, 
-    0xbe, 0x80, 
-    0x7f, 0x00, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x41 = { image_data_bc_font_ubuntu_15_0x41,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x42[30] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0x83, 0x80, 
-    0xbd, 0x80, 
-    0xbe, 0x80, 
-    0xbd, 0x80, 
-    0x83, 0x80, 
-    0xbd, 0x80, 
-    0xbe, 0x80, 
-    0xbe, 0x80, 
-    0xbd, 0x80, 
-    0x83, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x42 = { image_data_bc_font_ubuntu_15_0x42,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x43[30] = {
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xe0, 0xc0, 
-    0xdf, 0x40, 
-    0xbf, 0xc0, 
-    0xbf, 0xc0, 
-    0xbf, 0xc0, 
-    0xbf, 0xc0, 
-    0xbf, 0xc0, 
-    0xbf, 0xc0, 
-    0xdf, 0x40, 
-    0xe0, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x43 = { image_data_bc_font_ubuntu_15_0x43,
-    10, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x44[30] = {
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0x83, 0xc0, 
-    0xbd, 0xc0, 
-    0xbe, 0xc0, 
-    0xbf, 0x40, 
-    0xbf, 0x40, 
-    0xbf, 0x40, 
-    0xbf, 0x40, 
-    0xbe, 0xc0, 
-    0xbd, 0xc0, 
-    0x83, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x44 = { image_data_bc_font_ubuntu_15_0x44,
-    10, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x45[15] = {
-    0xff, 
-    0xff, 
-    0x81, 
-    0xbf, 
-    0xbf, 
-    0xbf, 
-    0x83, 
-    0xbf, 
-    0xbf, 
-    0xbf, 
-    0xbf, 
-    0x81, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x45 = { image_data_bc_font_ubuntu_15_0x45,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x46[15] = {
-    0xff, 
-    0xff, 
-    0x80, 
-    0xbf, 
-    0xbf, 
-    0xbf, 
-    0x81, 
-    0xbf, 
-    0xbf, 
-    0xbf, 
-    0xbf, 
-    0xbf, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x46 = { image_data_bc_font_ubuntu_15_0x46,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x47[30] = {
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xe0, 0xc0, 
-    0xdf, 0x40, 
-    0xbf, 0xc0, 
-    0xbf, 0xc0, 
-    0xbf, 0xc0, 
-    0xbf, 0x40, 
-    0xbf, 0x40, 
-    0xbf, 0x40, 
-    0xdf, 0x40, 
-    0xe0, 0x40, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x47 = { image_data_bc_font_ubuntu_15_0x47,
-    10, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x48[30] = {
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xbf, 0x40, 
-    0xbf, 0x40, 
-    0xbf, 0x40, 
-    0xbf, 0x40, 
-    0x80, 0x40, 
-    0xbf, 0x40, 
-    0xbf, 0x40, 
-    0xbf, 0x40, 
-    0xbf, 0x40, 
-    0xbf, 0x40, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x48 = { image_data_bc_font_ubuntu_15_0x48,
-    10, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x49[15] = {
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x49 = { image_data_bc_font_ubuntu_15_0x49,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x4a[15] = {
-    0xfe, 
-    0xfe, 
-    0xfa, 
-    0xfa, 
-    0xfa, 
-    0xfa, 
-    0xfa, 
-    0xfa, 
-    0xfa, 
-    0xfa, 
-    0x7a, 
-    0x86, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x4a = { image_data_bc_font_ubuntu_15_0x4a,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x4b[30] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xbd, 0x80, 
-    0xbb, 0x80, 
-    0xb7, 0x80, 
-    0xaf, 0x80, 
-    0x9f, 0x80, 
-    0xaf, 0x80, 
-    0xb7, 0x80, 
-    0xbb, 0x80, 
-    0xbd, 0x80, 
-    0xbe, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x4b = { image_data_bc_font_ubuntu_15_0x4b,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x4c[15] = {
-    0xfe, 
-    0xfe, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0x80, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x4c = { image_data_bc_font_ubuntu_15_0x4c,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x4d[30] = {
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xdf, 0xd8, 
-    0xcf, 0x98, 
-    0xcf, 0x98, 
-    0xd7, 0x58, 
-    0xd7, 0x58, 
-    0xba, 0xe8, 
-    0xba, 0xe8, 
-    0xba, 0xe8, 
-    0xbd, 0xe8, 
-    0xbf, 0xe8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x4d = { image_data_bc_font_ubuntu_15_0x4d,
-    13, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x4e[30] = {
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xbf, 0x40, 
-    0x9f, 0x40, 
-    0xaf, 0x40, 
-    0xb7, 0x40, 
-    0xb7, 0x40, 
-    0xbb, 0x40, 
-    0xbd, 0x40, 
-    0xbd, 0x40, 
-    0xbe, 0x40, 
-    0xbf, 0x40, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x4e = { image_data_bc_font_ubuntu_15_0x4e,
-    10, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x4f[30] = {
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xe0, 0xe0, 
-    0xdf, 0x60, 
-    0xbf, 0xa0, 
-    0xbf, 0xa0, 
-    0xbf, 0xa0, 
-    0xbf, 0xa0, 
-    0xbf, 0xa0, 
-    0xbf, 0xa0, 
-    0xdf, 0x60, 
-    0xe0, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x4f = { image_data_bc_font_ubuntu_15_0x4f,
-    11, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x50[30] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0x81, 0x80, 
-    0xbe, 0x80, 
-    0xbf, 0x00, 
-    0xbf, 0x00, 
-    0xbe, 0x80, 
-    0x81, 0x80, 
-    0xbf, 0x80, 
-    0xbf, 0x80, 
-    0xbf, 0x80, 
-    0xbf, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x50 = { image_data_bc_font_ubuntu_15_0x50,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x51[30] = {
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xe0, 0xe0, 
-    0xdf, 0x60, 
-    0xbf, 0xa0, 
-    0xbf, 0xa0, 
-    0xbf, 0xa0, 
-    0xbf, 0xa0, 
-    0xbf, 0xa0, 
-    0xbf, 0xa0, 
-    0xdf, 0x60, 
-    0xe0, 0xe0, 
-    0xfb, 0xe0, 
-    0xfd, 0xe0, 
-    0xfe, 0x60
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x51 = { image_data_bc_font_ubuntu_15_0x51,
-    11, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x52[30] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0x83, 0x80, 
-    0xbd, 0x80, 
-    0xbe, 0x80, 
-    0xbe, 0x80, 
-    0xbd, 0x80, 
-    0x83, 0x80, 
-    0xbb, 0x80, 
-    0xbd, 0x80, 
-    0xbe, 0x80, 
-    0xbf, 0x00, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x52 = { image_data_bc_font_ubuntu_15_0x52,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x53[15] = {
-    0xfe, 
-    0xfe, 
-    0xc2, 
-    0xba, 
-    0xbe, 
-    0xbe, 
-    0xde, 
-    0xe6, 
-    0xfa, 
-    0xfa, 
-    0xba, 
-    0x86, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x53 = { image_data_bc_font_ubuntu_15_0x53,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x54[15] = {
-    0xfe, 
-    0xfe, 
-    0x00, 
-    0xee, 
-    0xee, 
-    0xee, 
-    0xee, 
-    0xee, 
-    0xee, 
-    0xee, 
-    0xee, 
-    0xee, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x54 = { image_data_bc_font_ubuntu_15_0x54,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x55[30] = {
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xbf, 0x40, 
-    0xbf, 0x40, 
-    0xbf, 0x40, 
-    0xbf, 0x40, 
-    0xbf, 0x40, 
-    0xbf, 0x40, 
-    0xbf, 0x40, 
-    0xbf, 0x40, 
-    0xde, 0xc0, 
-    0xe1, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x55 = { image_data_bc_font_ubuntu_15_0x55,
-    10, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x56[30] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0x7f, 0x00, 
-    0xbe, 0x80, 
-    0xbe, 0x80, 
-    0xbe, 0x80, 
-    0xdd, 0x80, 
-    0xdd, 0x80, 
-    0xdd, 0x80, 
-    0xeb, 0x80, 
-    0xeb, 0x80, 
-    0xf7, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x56 = { image_data_bc_font_ubuntu_15_0x56,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x57[30] = {
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0x7f, 0xf0, 
-    0x7d, 0xf0, 
-    0xbd, 0xe8, 
-    0xba, 0xe8, 
-    0xba, 0xe8, 
-    0xba, 0xe8, 
-    0xd7, 0x58, 
-    0xd7, 0x58, 
-    0xd7, 0x58, 
-    0xef, 0xb8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x57 = { image_data_bc_font_ubuntu_15_0x57,
-    13, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x58[15] = {
-    0xff, 
-    0xff, 
-    0x7e, 
-    0xbd, 
-    0xdb, 
-    0xdb, 
-    0xe7, 
-    0xe7, 
-    0xdb, 
-    0xdb, 
-    0xbd, 
-    0x7e, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x58 = { image_data_bc_font_ubuntu_15_0x58,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x59[30] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0x7f, 0x00, 
-    0xbe, 0x80, 
-    0xdd, 0x80, 
-    0xdd, 0x80, 
-    0xeb, 0x80, 
-    0xf7, 0x80, 
-    0xf7, 0x80, 
-    0xf7, 0x80, 
-    0xf7, 0x80, 
-    0xf7, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x59 = { image_data_bc_font_ubuntu_15_0x59,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x5a[15] = {
-    0xff, 
-    0xff, 
-    0x81, 
-    0xfd, 
-    0xfb, 
-    0xf7, 
-    0xf7, 
-    0xef, 
-    0xdf, 
-    0xdf, 
-    0xbf, 
-    0x81, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x5a = { image_data_bc_font_ubuntu_15_0x5a,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x5b[15] = {
-    0xf8, 
-    0x80, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0x80
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x5b = { image_data_bc_font_ubuntu_15_0x5b,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x5c[15] = {
-    0xfc, 
-    0x7c, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xdc, 
-    0xdc, 
-    0xdc, 
-    0xec, 
-    0xec, 
-    0xec, 
-    0xf4, 
-    0xf4, 
-    0xf4, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x5c = { image_data_bc_font_ubuntu_15_0x5c,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x5d[15] = {
-    0xf8, 
-    0x08, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0xe8, 
-    0x08
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x5d = { image_data_bc_font_ubuntu_15_0x5d,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x5e[15] = {
-    0xff, 
-    0xff, 
-    0xef, 
-    0xd7, 
-    0xbb, 
-    0xbb, 
-    0x7d, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x5e = { image_data_bc_font_ubuntu_15_0x5e,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x5f[15] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0x00
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x5f = { image_data_bc_font_ubuntu_15_0x5f,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x60[15] = {
-    0xf8, 
-    0xb8, 
-    0xd8, 
-    0xe8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x60 = { image_data_bc_font_ubuntu_15_0x60,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x61[15] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xc6, 
-    0xfa, 
-    0xfa, 
-    0xc2, 
-    0xba, 
-    0xba, 
-    0xc2, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x61 = { image_data_bc_font_ubuntu_15_0x61,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x62[15] = {
-    0xff, 
-    0xbf, 
-    0xbf, 
-    0xbf, 
-    0xbf, 
-    0x83, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0x83, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x62 = { image_data_bc_font_ubuntu_15_0x62,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x63[15] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xc2, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0xc2, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x63 = { image_data_bc_font_ubuntu_15_0x63,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x64[15] = {
-    0xff, 
-    0xfd, 
-    0xfd, 
-    0xfd, 
-    0xfd, 
-    0xc1, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xc1, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x64 = { image_data_bc_font_ubuntu_15_0x64,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x65[15] = {
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xc3, 
-    0xbd, 
-    0xbd, 
-    0x81, 
-    0xbf, 
-    0xbf, 
-    0xc1, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x65 = { image_data_bc_font_ubuntu_15_0x65,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x66[15] = {
-    0xf8, 
-    0xc0, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0x80, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x66 = { image_data_bc_font_ubuntu_15_0x66,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x67[15] = {
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xc1, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xc1, 
-    0xfd, 
-    0xfd, 
-    0x83
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x67 = { image_data_bc_font_ubuntu_15_0x67,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x68[15] = {
-    0xff, 
-    0xbf, 
-    0xbf, 
-    0xbf, 
-    0xbf, 
-    0x83, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x68 = { image_data_bc_font_ubuntu_15_0x68,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x69[15] = {
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x69 = { image_data_bc_font_ubuntu_15_0x69,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x6a[15] = {
-    0xe0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0x60
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x6a = { image_data_bc_font_ubuntu_15_0x6a,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x6b[15] = {
-    0xfe, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0xba, 
-    0xb6, 
-    0xae, 
-    0x9e, 
-    0xae, 
-    0xb6, 
-    0xba, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x6b = { image_data_bc_font_ubuntu_15_0x6b,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x6c[15] = {
-    0xf0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xc0, 
-    0xf0, 
-    0xf0, 
-    0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x6c = { image_data_bc_font_ubuntu_15_0x6c,
-    4, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x6d[30] = {
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0x82, 0x18, 
-    0xbd, 0xe8, 
-    0xbd, 0xe8, 
-    0xbd, 0xe8, 
-    0xbd, 0xe8, 
-    0xbd, 0xe8, 
-    0xbd, 0xe8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x6d = { image_data_bc_font_ubuntu_15_0x6d,
-    13, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x6e[15] = {
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0x83, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x6e = { image_data_bc_font_ubuntu_15_0x6e,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x6f[15] = {
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xc3, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xc3, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x6f = { image_data_bc_font_ubuntu_15_0x6f,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x70[15] = {
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0x83, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0x83, 
-    0xbf, 
-    0xbf, 
-    0xbf
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x70 = { image_data_bc_font_ubuntu_15_0x70,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x71[15] = {
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xc1, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xc1, 
-    0xfd, 
-    0xfd, 
-    0xfd
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x71 = { image_data_bc_font_ubuntu_15_0x71,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x72[15] = {
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0x80, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xb8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x72 = { image_data_bc_font_ubuntu_15_0x72,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x73[15] = {
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xc4, 
-    0xbc, 
-    0xbc, 
-    0xcc, 
-    0xf4, 
-    0xf4, 
-    0x8c, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x73 = { image_data_bc_font_ubuntu_15_0x73,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x74[15] = {
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xbc, 
-    0xbc, 
-    0x84, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xc4, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x74 = { image_data_bc_font_ubuntu_15_0x74,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x75[15] = {
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xc1, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x75 = { image_data_bc_font_ubuntu_15_0x75,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x76[15] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0x7c, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xd6, 
-    0xd6, 
-    0xee, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x76 = { image_data_bc_font_ubuntu_15_0x76,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x77[30] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0x77, 0x00, 
-    0x77, 0x00, 
-    0xaa, 0x80, 
-    0xaa, 0x80, 
-    0xaa, 0x80, 
-    0xdd, 0x80, 
-    0xdd, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x77 = { image_data_bc_font_ubuntu_15_0x77,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x78[15] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0x7c, 
-    0xba, 
-    0xd6, 
-    0xee, 
-    0xd6, 
-    0xba, 
-    0x7c, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x78 = { image_data_bc_font_ubuntu_15_0x78,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x79[15] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0x7c, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xd6, 
-    0xd6, 
-    0xee, 
-    0xee, 
-    0xde, 
-    0x3e
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x79 = { image_data_bc_font_ubuntu_15_0x79,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x7a[15] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0x82, 
-    0xfa, 
-    0xf6, 
-    0xee, 
-    0xde, 
-    0xbe, 
-    0x82, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x7a = { image_data_bc_font_ubuntu_15_0x7a,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x7b[15] = {
-    0xf8, 
-    0xe8, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xb8, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xe8
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x7b = { image_data_bc_font_ubuntu_15_0x7b,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x7c[15] = {
-    0xf0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0, 
-    0xb0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x7c = { image_data_bc_font_ubuntu_15_0x7c,
-    4, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x7d[15] = {
-    0xf8, 
-    0xb8, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xe8, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xb8
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x7d = { image_data_bc_font_ubuntu_15_0x7d,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0x7e[15] = {
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xcd, 
-    0xb3, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0x7e = { image_data_bc_font_ubuntu_15_0x7e,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0xb0[15] = {
-    0xf8, 
-    0xc8, 
-    0xb0, 
-    0xb0, 
-    0xc8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8, 
-    0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_15_0xb0 = { image_data_bc_font_ubuntu_15_0xb0,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0xb9[15] = {
-    0xfc, 
-    0xb8, 
-    0xd4, 
-    0xec, 
-    0xfc, 
-    0xc4, 
-    0xbc, 
-    0xbc, 
-    0xcc, 
-    0xf4, 
-    0xf4, 
-    0x8c, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_15_0xb9 = { image_data_bc_font_ubuntu_15_0xb9,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0xbb[15] = {
-    0xfc, 
-    0xec, 
-    0xec, 
-    0xac, 
-    0xbc, 
-    0x84, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xc4, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_15_0xbb = { image_data_bc_font_ubuntu_15_0xbb,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0xbe[15] = {
-    0xfe, 
-    0xba, 
-    0xd6, 
-    0xee, 
-    0xfe, 
-    0x82, 
-    0xfa, 
-    0xf6, 
-    0xee, 
-    0xde, 
-    0xbe, 
-    0x82, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_15_0xbe = { image_data_bc_font_ubuntu_15_0xbe,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0xe1[15] = {
-    0xfe, 
-    0xfa, 
-    0xf6, 
-    0xee, 
-    0xfe, 
-    0xc6, 
-    0xfa, 
-    0xfa, 
-    0xc2, 
-    0xba, 
-    0xba, 
-    0xc2, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_15_0xe1 = { image_data_bc_font_ubuntu_15_0xe1,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0xe8[15] = {
-    0xfe, 
-    0xba, 
-    0xd6, 
-    0xee, 
-    0xfe, 
-    0xc2, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0xbe, 
-    0xc2, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_15_0xe8 = { image_data_bc_font_ubuntu_15_0xe8,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0xe9[15] = {
-    0xff, 
-    0xfb, 
-    0xf7, 
-    0xef, 
-    0xff, 
-    0xc3, 
-    0xbd, 
-    0xbd, 
-    0x81, 
-    0xbf, 
-    0xbf, 
-    0xc1, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0xe9 = { image_data_bc_font_ubuntu_15_0xe9,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0xec[15] = {
-    0xdd, 
-    0xeb, 
-    0xf7, 
-    0xff, 
-    0xff, 
-    0xc3, 
-    0xbd, 
-    0xbd, 
-    0x81, 
-    0xbf, 
-    0xbf, 
-    0xc1, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0xec = { image_data_bc_font_ubuntu_15_0xec,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0xed[15] = {
-    0xe0, 
-    0xc0, 
-    0xa0, 
-    0x60, 
-    0xe0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xa0, 
-    0xe0, 
-    0xe0, 
-    0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_15_0xed = { image_data_bc_font_ubuntu_15_0xed,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0xef[30] = {
-    0xff, 0x80, 
-    0xfd, 0x00, 
-    0xfd, 0x00, 
-    0xfd, 0x00, 
-    0xfd, 0x80, 
-    0xc1, 0x80, 
-    0xbd, 0x80, 
-    0xbd, 0x80, 
-    0xbd, 0x80, 
-    0xbd, 0x80, 
-    0xbd, 0x80, 
-    0xc1, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_15_0xef = { image_data_bc_font_ubuntu_15_0xef,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0xf2[15] = {
-    0xff, 
-    0xdd, 
-    0xeb, 
-    0xf7, 
-    0xff, 
-    0x83, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0xf2 = { image_data_bc_font_ubuntu_15_0xf2,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0xf8[15] = {
-    0xfc, 
-    0xb8, 
-    0xd4, 
-    0xec, 
-    0xfc, 
-    0x84, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xbc, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_15_0xf8 = { image_data_bc_font_ubuntu_15_0xf8,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0xf9[15] = {
-    0xff, 
-    0xf7, 
-    0xeb, 
-    0xf7, 
-    0xff, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xc1, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0xf9 = { image_data_bc_font_ubuntu_15_0xf9,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0xfa[15] = {
-    0xff, 
-    0xfb, 
-    0xf7, 
-    0xef, 
-    0xff, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xbd, 
-    0xc1, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_15_0xfa = { image_data_bc_font_ubuntu_15_0xfa,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_15_0xfd[15] = {
-    0xfe, 
-    0xfa, 
-    0xf6, 
-    0xee, 
-    0xfe, 
-    0x7c, 
-    0xba, 
-    0xba, 
-    0xba, 
-    0xd6, 
-    0xd6, 
-    0xee, 
-    0xee, 
-    0xde, 
-    0x3e
-};
-static const bc_font_image_t bc_font_ubuntu_15_0xfd = { image_data_bc_font_ubuntu_15_0xfd,
-    7, 15/*, 8*/};
-#endif
-
-
-static const bc_font_char_t bc_font_ubuntu_15_array[] = {
-
-#if (0x0 == 0x0)
-  // character: ' '
-  {0x20, &bc_font_ubuntu_15_0x20},
-#else
-  // character: ' ' == ''
-  {0x20, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '!'
-  {0x21, &bc_font_ubuntu_15_0x21},
-#else
-  // character: '!' == ''
-  {0x21, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '"'
-  {0x22, &bc_font_ubuntu_15_0x22},
-#else
-  // character: '"' == ''
-  {0x22, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '#'
-  {0x23, &bc_font_ubuntu_15_0x23},
-#else
-  // character: '#' == ''
-  {0x23, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '$'
-  {0x24, &bc_font_ubuntu_15_0x24},
-#else
-  // character: '$' == ''
-  {0x24, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '%'
-  {0x25, &bc_font_ubuntu_15_0x25},
-#else
-  // character: '%' == ''
-  {0x25, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '&'
-  {0x26, &bc_font_ubuntu_15_0x26},
-#else
-  // character: '&' == ''
-  {0x26, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '''
-  {0x27, &bc_font_ubuntu_15_0x27},
-#else
-  // character: ''' == ''
-  {0x27, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '('
-  {0x28, &bc_font_ubuntu_15_0x28},
-#else
-  // character: '(' == ''
-  {0x28, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ')'
-  {0x29, &bc_font_ubuntu_15_0x29},
-#else
-  // character: ')' == ''
-  {0x29, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '*'
-  {0x2a, &bc_font_ubuntu_15_0x2a},
-#else
-  // character: '*' == ''
-  {0x2a, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '+'
-  {0x2b, &bc_font_ubuntu_15_0x2b},
-#else
-  // character: '+' == ''
-  {0x2b, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ','
-  {0x2c, &bc_font_ubuntu_15_0x2c},
-#else
-  // character: ',' == ''
-  {0x2c, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '-'
-  {0x2d, &bc_font_ubuntu_15_0x2d},
-#else
-  // character: '-' == ''
-  {0x2d, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '.'
-  {0x2e, &bc_font_ubuntu_15_0x2e},
-#else
-  // character: '.' == ''
-  {0x2e, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '/'
-  {0x2f, &bc_font_ubuntu_15_0x2f},
-#else
-  // character: '/' == ''
-  {0x2f, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '0'
-  {0x30, &bc_font_ubuntu_15_0x30},
-#else
-  // character: '0' == ''
-  {0x30, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '1'
-  {0x31, &bc_font_ubuntu_15_0x31},
-#else
-  // character: '1' == ''
-  {0x31, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '2'
-  {0x32, &bc_font_ubuntu_15_0x32},
-#else
-  // character: '2' == ''
-  {0x32, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '3'
-  {0x33, &bc_font_ubuntu_15_0x33},
-#else
-  // character: '3' == ''
-  {0x33, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '4'
-  {0x34, &bc_font_ubuntu_15_0x34},
-#else
-  // character: '4' == ''
-  {0x34, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '5'
-  {0x35, &bc_font_ubuntu_15_0x35},
-#else
-  // character: '5' == ''
-  {0x35, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '6'
-  {0x36, &bc_font_ubuntu_15_0x36},
-#else
-  // character: '6' == ''
-  {0x36, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '7'
-  {0x37, &bc_font_ubuntu_15_0x37},
-#else
-  // character: '7' == ''
-  {0x37, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '8'
-  {0x38, &bc_font_ubuntu_15_0x38},
-#else
-  // character: '8' == ''
-  {0x38, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '9'
-  {0x39, &bc_font_ubuntu_15_0x39},
-#else
-  // character: '9' == ''
-  {0x39, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ':'
-  {0x3a, &bc_font_ubuntu_15_0x3a},
-#else
-  // character: ':' == ''
-  {0x3a, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ';'
-  {0x3b, &bc_font_ubuntu_15_0x3b},
-#else
-  // character: ';' == ''
-  {0x3b, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '<'
-  {0x3c, &bc_font_ubuntu_15_0x3c},
-#else
-  // character: '<' == ''
-  {0x3c, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '='
-  {0x3d, &bc_font_ubuntu_15_0x3d},
-#else
-  // character: '=' == ''
-  {0x3d, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '>'
-  {0x3e, &bc_font_ubuntu_15_0x3e},
-#else
-  // character: '>' == ''
-  {0x3e, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '?'
-  {0x3f, &bc_font_ubuntu_15_0x3f},
-#else
-  // character: '?' == ''
-  {0x3f, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\x0040'
-  {0x40, &bc_font_ubuntu_15_0x40},
-#else
-  // character: '\x0040' == ''
-  {0x40, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'A'
-  {0x41, &bc_font_ubuntu_15_0x41},
-#else
-  // character: 'A' == ''
-  {0x41, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'B'
-  {0x42, &bc_font_ubuntu_15_0x42},
-#else
-  // character: 'B' == ''
-  {0x42, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'C'
-  {0x43, &bc_font_ubuntu_15_0x43},
-#else
-  // character: 'C' == ''
-  {0x43, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'D'
-  {0x44, &bc_font_ubuntu_15_0x44},
-#else
-  // character: 'D' == ''
-  {0x44, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'E'
-  {0x45, &bc_font_ubuntu_15_0x45},
-#else
-  // character: 'E' == ''
-  {0x45, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'F'
-  {0x46, &bc_font_ubuntu_15_0x46},
-#else
-  // character: 'F' == ''
-  {0x46, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'G'
-  {0x47, &bc_font_ubuntu_15_0x47},
-#else
-  // character: 'G' == ''
-  {0x47, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'H'
-  {0x48, &bc_font_ubuntu_15_0x48},
-#else
-  // character: 'H' == ''
-  {0x48, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'I'
-  {0x49, &bc_font_ubuntu_15_0x49},
-#else
-  // character: 'I' == ''
-  {0x49, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'J'
-  {0x4a, &bc_font_ubuntu_15_0x4a},
-#else
-  // character: 'J' == ''
-  {0x4a, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'K'
-  {0x4b, &bc_font_ubuntu_15_0x4b},
-#else
-  // character: 'K' == ''
-  {0x4b, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'L'
-  {0x4c, &bc_font_ubuntu_15_0x4c},
-#else
-  // character: 'L' == ''
-  {0x4c, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'M'
-  {0x4d, &bc_font_ubuntu_15_0x4d},
-#else
-  // character: 'M' == ''
-  {0x4d, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'N'
-  {0x4e, &bc_font_ubuntu_15_0x4e},
-#else
-  // character: 'N' == ''
-  {0x4e, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'O'
-  {0x4f, &bc_font_ubuntu_15_0x4f},
-#else
-  // character: 'O' == ''
-  {0x4f, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'P'
-  {0x50, &bc_font_ubuntu_15_0x50},
-#else
-  // character: 'P' == ''
-  {0x50, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Q'
-  {0x51, &bc_font_ubuntu_15_0x51},
-#else
-  // character: 'Q' == ''
-  {0x51, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'R'
-  {0x52, &bc_font_ubuntu_15_0x52},
-#else
-  // character: 'R' == ''
-  {0x52, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'S'
-  {0x53, &bc_font_ubuntu_15_0x53},
-#else
-  // character: 'S' == ''
-  {0x53, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'T'
-  {0x54, &bc_font_ubuntu_15_0x54},
-#else
-  // character: 'T' == ''
-  {0x54, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'U'
-  {0x55, &bc_font_ubuntu_15_0x55},
-#else
-  // character: 'U' == ''
-  {0x55, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'V'
-  {0x56, &bc_font_ubuntu_15_0x56},
-#else
-  // character: 'V' == ''
-  {0x56, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'W'
-  {0x57, &bc_font_ubuntu_15_0x57},
-#else
-  // character: 'W' == ''
-  {0x57, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'X'
-  {0x58, &bc_font_ubuntu_15_0x58},
-#else
-  // character: 'X' == ''
-  {0x58, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Y'
-  {0x59, &bc_font_ubuntu_15_0x59},
-#else
-  // character: 'Y' == ''
-  {0x59, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Z'
-  {0x5a, &bc_font_ubuntu_15_0x5a},
-#else
-  // character: 'Z' == ''
-  {0x5a, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '['
-  {0x5b, &bc_font_ubuntu_15_0x5b},
-#else
-  // character: '[' == ''
-  {0x5b, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\'
-  {0x5c, &bc_font_ubuntu_15_0x5c},
-#else
-  // character: '\' == ''
-  {0x5c, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ']'
-  {0x5d, &bc_font_ubuntu_15_0x5d},
-#else
-  // character: ']' == ''
-  {0x5d, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '^'
-  {0x5e, &bc_font_ubuntu_15_0x5e},
-#else
-  // character: '^' == ''
-  {0x5e, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '_'
-  {0x5f, &bc_font_ubuntu_15_0x5f},
-#else
-  // character: '_' == ''
-  {0x5f, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '`'
-  {0x60, &bc_font_ubuntu_15_0x60},
-#else
-  // character: '`' == ''
-  {0x60, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'a'
-  {0x61, &bc_font_ubuntu_15_0x61},
-#else
-  // character: 'a' == ''
-  {0x61, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'b'
-  {0x62, &bc_font_ubuntu_15_0x62},
-#else
-  // character: 'b' == ''
-  {0x62, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'c'
-  {0x63, &bc_font_ubuntu_15_0x63},
-#else
-  // character: 'c' == ''
-  {0x63, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'd'
-  {0x64, &bc_font_ubuntu_15_0x64},
-#else
-  // character: 'd' == ''
-  {0x64, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'e'
-  {0x65, &bc_font_ubuntu_15_0x65},
-#else
-  // character: 'e' == ''
-  {0x65, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'f'
-  {0x66, &bc_font_ubuntu_15_0x66},
-#else
-  // character: 'f' == ''
-  {0x66, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'g'
-  {0x67, &bc_font_ubuntu_15_0x67},
-#else
-  // character: 'g' == ''
-  {0x67, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'h'
-  {0x68, &bc_font_ubuntu_15_0x68},
-#else
-  // character: 'h' == ''
-  {0x68, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'i'
-  {0x69, &bc_font_ubuntu_15_0x69},
-#else
-  // character: 'i' == ''
-  {0x69, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'j'
-  {0x6a, &bc_font_ubuntu_15_0x6a},
-#else
-  // character: 'j' == ''
-  {0x6a, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'k'
-  {0x6b, &bc_font_ubuntu_15_0x6b},
-#else
-  // character: 'k' == ''
-  {0x6b, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'l'
-  {0x6c, &bc_font_ubuntu_15_0x6c},
-#else
-  // character: 'l' == ''
-  {0x6c, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'm'
-  {0x6d, &bc_font_ubuntu_15_0x6d},
-#else
-  // character: 'm' == ''
-  {0x6d, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'n'
-  {0x6e, &bc_font_ubuntu_15_0x6e},
-#else
-  // character: 'n' == ''
-  {0x6e, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'o'
-  {0x6f, &bc_font_ubuntu_15_0x6f},
-#else
-  // character: 'o' == ''
-  {0x6f, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'p'
-  {0x70, &bc_font_ubuntu_15_0x70},
-#else
-  // character: 'p' == ''
-  {0x70, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'q'
-  {0x71, &bc_font_ubuntu_15_0x71},
-#else
-  // character: 'q' == ''
-  {0x71, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'r'
-  {0x72, &bc_font_ubuntu_15_0x72},
-#else
-  // character: 'r' == ''
-  {0x72, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 's'
-  {0x73, &bc_font_ubuntu_15_0x73},
-#else
-  // character: 's' == ''
-  {0x73, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 't'
-  {0x74, &bc_font_ubuntu_15_0x74},
-#else
-  // character: 't' == ''
-  {0x74, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'u'
-  {0x75, &bc_font_ubuntu_15_0x75},
-#else
-  // character: 'u' == ''
-  {0x75, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'v'
-  {0x76, &bc_font_ubuntu_15_0x76},
-#else
-  // character: 'v' == ''
-  {0x76, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'w'
-  {0x77, &bc_font_ubuntu_15_0x77},
-#else
-  // character: 'w' == ''
-  {0x77, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'x'
-  {0x78, &bc_font_ubuntu_15_0x78},
-#else
-  // character: 'x' == ''
-  {0x78, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'y'
-  {0x79, &bc_font_ubuntu_15_0x79},
-#else
-  // character: 'y' == ''
-  {0x79, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'z'
-  {0x7a, &bc_font_ubuntu_15_0x7a},
-#else
-  // character: 'z' == ''
-  {0x7a, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '{'
-  {0x7b, &bc_font_ubuntu_15_0x7b},
-#else
-  // character: '{' == ''
-  {0x7b, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '|'
-  {0x7c, &bc_font_ubuntu_15_0x7c},
-#else
-  // character: '|' == ''
-  {0x7c, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '}'
-  {0x7d, &bc_font_ubuntu_15_0x7d},
-#else
-  // character: '}' == ''
-  {0x7d, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '~'
-  {0x7e, &bc_font_ubuntu_15_0x7e},
-#else
-  // character: '~' == ''
-  {0x7e, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '°'
-  {0xb0, &bc_font_ubuntu_15_0xb0},
-#else
-  // character: '°' == ''
-  {0xb0, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'š'
-  {0xb9, &bc_font_ubuntu_15_0xb9},
-#else
-  // character: 'š' == ''
-  {0xb9, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ť'
-  {0xbb, &bc_font_ubuntu_15_0xbb},
-#else
-  // character: 'ť' == ''
-  {0xbb, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ž'
-  {0xbe, &bc_font_ubuntu_15_0xbe},
-#else
-  // character: 'ž' == ''
-  {0xbe, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'á'
-  {0xe1, &bc_font_ubuntu_15_0xe1},
-#else
-  // character: 'á' == ''
-  {0xe1, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'č'
-  {0xe8, &bc_font_ubuntu_15_0xe8},
-#else
-  // character: 'č' == ''
-  {0xe8, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'é'
-  {0xe9, &bc_font_ubuntu_15_0xe9},
-#else
-  // character: 'é' == ''
-  {0xe9, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ě'
-  {0xec, &bc_font_ubuntu_15_0xec},
-#else
-  // character: 'ě' == ''
-  {0xec, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'í'
-  {0xed, &bc_font_ubuntu_15_0xed},
-#else
-  // character: 'í' == ''
-  {0xed, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ď'
-  {0xef, &bc_font_ubuntu_15_0xef},
-#else
-  // character: 'ď' == ''
-  {0xef, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ň'
-  {0xf2, &bc_font_ubuntu_15_0xf2},
-#else
-  // character: 'ň' == ''
-  {0xf2, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ř'
-  {0xf8, &bc_font_ubuntu_15_0xf8},
-#else
-  // character: 'ř' == ''
-  {0xf8, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ů'
-  {0xf9, &bc_font_ubuntu_15_0xf9},
-#else
-  // character: 'ů' == ''
-  {0xf9, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ú'
-  {0xfa, &bc_font_ubuntu_15_0xfa},
-#else
-  // character: 'ú' == ''
-  {0xfa, &bc_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ý'
-  {0xfd, &bc_font_ubuntu_15_0xfd}
-#else
-  // character: 'ý' == ''
-  {0xfd, &bc_font_ubuntu_15_0x}
-#endif
-
-};
-
-
-const bc_font_t bc_font_ubuntu_15 = { 110, bc_font_ubuntu_15_array };
+// Glyphs are compressed by sdk/tools/font/bc-font-rle.py
+
+static const uint8_t bc_font_ubuntu_15_rle_data[1030] = {
+    // ' '
+    0xff, 0xf0,
+    // '!'
+    0x91, 0xfc, 0x13, 0x17, 0x1a,
+    // '"'
+    0x71, 0x11, 0xf6, 0x11, 0x1f, 0xff, 0xb0,
+    // '#'
+    0xf7, 0x11, 0x1e, 0x25, 0x21, 0x21, 0x12, 0x21, 0x11, 0x2b, 0x21, 0x11, 0x22, 0x11, 0x21, 0x25, 0x2e, 0x11, 0x1f, 0x70,
+    // '$'
+    0xb1, 0xe1, 0x12, 0x35, 0xb2, 0x73, 0x63, 0x72, 0xa6, 0x22, 0x12, 0xd1, 0x40,
+    // '%'
+    0xfb, 0x24, 0x14, 0x42, 0x2f, 0x62, 0x54, 0x92, 0x12, 0x12, 0x94, 0x52, 0xf6, 0x22, 0x44, 0x14, 0x2f, 0xb0,
+    // '&'
+    0xf6, 0x26, 0x4f, 0x12, 0x53, 0x63, 0x21, 0x22, 0x12, 0x83, 0x63, 0x25, 0x12, 0x23, 0x31, 0xf3,
+    // "'"
+    0x41, 0xb1, 0xfd,
+    // '('
+    0x81, 0x32, 0x72, 0xff, 0x82, 0x92, 0x10,
+    // ')'
+    0x61, 0x42, 0x92, 0xff, 0x82, 0x72, 0x20,
+    // '*'
+    0xf2, 0x14, 0x13, 0x12, 0x21, 0x24, 0x14, 0x21, 0x22, 0x13, 0x1f, 0xff, 0x50,
+    // '+'
+    0xff, 0xd1, 0xf5, 0x31, 0x31, 0x31, 0x3f, 0x51, 0xf5,
+    // ','
+    0xff, 0x11, 0x72, 0x11, 0x20,
+    // '-'
+    0xff, 0x63, 0x23, 0xff, 0x10,
+    // '.'
+    0xff, 0x11, 0x51, 0x70,
+    // '/'
+    0xb1, 0x42, 0xf0, 0x2f, 0x02, 0xf0, 0x2f, 0x02, 0x40,
+    // '0'
+    0xf3, 0x43, 0x6f, 0xff, 0xd6, 0x34, 0xf3,
+    // '1'
+    0xf5, 0x16, 0x16, 0x25, 0x26, 0x1f, 0xff, 0x51, 0xf4,
+    // '2'
+    0xf3, 0x43, 0x62, 0x1f, 0x42, 0x52, 0x52, 0x52, 0x52, 0x75, 0x26, 0xf2,
+    // '3'
+    0xf2, 0x53, 0x6f, 0x54, 0x44, 0xfb, 0x62, 0x5f, 0x30,
+    // '4'
+    0xf6, 0x16, 0x16, 0x25, 0x2d, 0x27, 0x31, 0x12, 0x41, 0x1f, 0x71, 0xf3,
+    // '5'
+    0xf3, 0x54, 0x4f, 0x53, 0x45, 0xfb, 0x62, 0x5f, 0x30,
+    // '6'
+    0xf5, 0x25, 0x34, 0x25, 0x27, 0x44, 0x5f, 0xb6, 0x34, 0xf3,
+    // '7'
+    0xf2, 0x62, 0x57, 0x25, 0x2d, 0x2d, 0x2f, 0x71, 0xf6,
+    // '8'
+    0xf3, 0x43, 0x6f, 0x36, 0x26, 0xfb, 0x63, 0x4f, 0x30,
+    // '9'
+    0xf3, 0x43, 0x6f, 0xb5, 0x44, 0x72, 0x52, 0x43, 0x52, 0xf5,
+    // ':'
+    0xd1, 0x51, 0xb1, 0x51, 0x70,
+    // ';'
+    0xd1, 0x51, 0xb1, 0x72, 0x11, 0x20,
+    // '<'
+    0xff, 0xf1, 0x15, 0x33, 0x43, 0x35, 0x36, 0x46, 0x37, 0x1f, 0x20,
+    // '='
+    0xff, 0xf4, 0x62, 0x6a, 0x62, 0x6f, 0xf3,
+    // '>'
+    0xff, 0xb1, 0x73, 0x64, 0x63, 0x53, 0x34, 0x33, 0x51, 0xf7,
+    // '?'
+    0xd4, 0x25, 0xf0, 0x32, 0x39, 0x15, 0x1b, 0x1f, 0x00,
+    // '@'
+    0xff, 0x05, 0x77, 0x52, 0x52, 0x32, 0x24, 0x12, 0x54, 0xff, 0xf3, 0x82, 0x22, 0x31, 0x24, 0x2c, 0x68, 0x54,
+    // 'A'
+    0xf7, 0x17, 0x3f, 0x82, 0x12, 0xc1, 0x13, 0x11, 0x35, 0xb2, 0x53, 0x71, 0xf3,
+    // 'B'
+    0xf4, 0x55, 0x58, 0x27, 0x23, 0x54, 0x58, 0x2f, 0x12, 0x35, 0x35, 0xf6,
+    // 'C'
+    0xf8, 0x54, 0x72, 0x25, 0x1f, 0xff, 0x72, 0x51, 0x37, 0x45, 0xf7,
+    // 'D'
+    0xf6, 0x56, 0x59, 0x29, 0x2f, 0xf8, 0x27, 0x24, 0x54, 0x5f, 0x90,
+    // 'E'
+    0xf2, 0x63, 0x5f, 0x44, 0x44, 0xfd, 0x52, 0x6f, 0x20,
+    // 'F'
+    0xf2, 0x72, 0x6f, 0x35, 0x35, 0xff, 0x41, 0xf7,
+    // 'G'
+    0xf8, 0x54, 0x72, 0x25, 0x1f, 0xe1, 0xf7, 0x29, 0x65, 0x6f, 0x60,
+    // 'H'
+    0xf6, 0x16, 0x1f, 0xf3, 0x64, 0x6f, 0xfd, 0x16, 0x1f, 0x60,
+    // 'I'
+    0x71, 0xfe, 0x17,
+    // 'J'
+    0xf4, 0x1f, 0xff, 0x51, 0x66, 0x24, 0xf1,
+    // 'K'
+    0xf4, 0x14, 0x17, 0x26, 0x26, 0x26, 0x27, 0x28, 0x28, 0x28, 0x28, 0x22, 0x15, 0x1f, 0x40,
+    // 'L'
+    0xf0, 0x1f, 0xff, 0xf3, 0x51, 0x6e,
+    // 'M'
+    0xfd, 0x17, 0x15, 0x15, 0x1f, 0x42, 0x32, 0xf2, 0x21, 0x21, 0x21, 0x2f, 0xf2, 0x3b, 0x17, 0x19, 0x1f, 0xc0,
+    // 'N'
+    0xf6, 0x16, 0x13, 0x19, 0x29, 0x2f, 0x42, 0x92, 0xf4, 0x29, 0x13, 0x16, 0x1f, 0x60,
+    // 'O'
+    0xfa, 0x55, 0x73, 0x25, 0x2f, 0xff, 0xc2, 0x52, 0x37, 0x55, 0xfa,
+    // 'P'
+    0xf4, 0x64, 0x68, 0x2f, 0x12, 0x26, 0x35, 0xff, 0x01, 0xfa,
+    // 'Q'
+    0xfa, 0x55, 0x73, 0x25, 0x2f, 0xff, 0xc2, 0x52, 0x37, 0x52, 0x12, 0x82, 0xa3, 0x20,
+    // 'R'
+    0xf4, 0x55, 0x58, 0x2f, 0x12, 0x35, 0x43, 0x92, 0x82, 0x82, 0x11, 0x61, 0xf3,
+    // 'S'
+    0xf1, 0x42, 0x47, 0x19, 0x26, 0x35, 0x39, 0x17, 0x42, 0x4f, 0x10,
+    // 'T'
+    0xea, 0x13, 0xff, 0xfe, 0x1f, 0x20,
+    // 'U'
+    0xf6, 0x16, 0x1f, 0xff, 0xfc, 0x24, 0x23, 0x65, 0x4f, 0x80,
+    // 'V'
+    0xf3, 0x17, 0x35, 0x2f, 0x42, 0x32, 0xf6, 0x21, 0x2e, 0x37, 0x1f, 0x70,
+    // 'W'
+    0xfb, 0x1b, 0x16, 0x16, 0x29, 0x25, 0x3f, 0xf2, 0x21, 0x21, 0x21, 0x2f, 0xe3, 0x33, 0x51, 0x51, 0xfe,
+    // 'X'
+    0xf1, 0x16, 0x34, 0x21, 0x22, 0x2b, 0x4c, 0x4b, 0x22, 0x21, 0x24, 0x36, 0x1f, 0x10,
+    // 'Y'
+    0xf3, 0x17, 0x35, 0x21, 0x23, 0x2c, 0x21, 0x25, 0x3f, 0xfd, 0x1f, 0x70,
+    // 'Z'
+    0xf2, 0x62, 0x57, 0x25, 0x2d, 0x25, 0x2d, 0x27, 0x52, 0x6f, 0x20,
+    // '['
+    0x64, 0x23, 0xff, 0xfc, 0x30,
+    // '\\'
+    0x61, 0x52, 0xf2, 0x2f, 0x22, 0xf2, 0x2f, 0x22,
+    // ']'
+    0x54, 0x13, 0xff, 0xfc, 0x32,
+    // '^'
+    0xf4, 0x16, 0x34, 0x21, 0x2a, 0x23, 0x21, 0x15, 0x1f, 0xff, 0xc0,
+    // '_'
+    0xff, 0xff, 0xff, 0x87,
+    // '`'
+    0x61, 0x42, 0x42, 0x41, 0xff, 0xf6,
+    // 'a'
+    0xff, 0x73, 0x44, 0xa3, 0x34, 0xa4, 0x44, 0xf0,
+    // 'b'
+    0x91, 0xff, 0x24, 0x45, 0xff, 0x55, 0x25, 0xf3,
+    // 'c'
+    0xff, 0x74, 0x25, 0xff, 0x05, 0x34, 0xf0,
+    // 'd'
+    0xe1, 0xfc, 0x43, 0x5f, 0xf5, 0x54, 0x5f, 0x20,
+    // 'e'
+    0xff, 0xc4, 0x36, 0xb4, 0x45, 0xa6, 0x35, 0xf2,
+    // 'f'
+    0x73, 0x14, 0xc3, 0x23, 0xfb, 0x1d,
+    // 'g'
+    0xff, 0xc5, 0x25, 0xff, 0x55, 0x44, 0xb6, 0x10,
+    // 'h'
+    0x91, 0xff, 0x24, 0x45, 0xff, 0xc1, 0x41, 0xf2,
+    // 'i'
+    0x71, 0x51, 0x21, 0xf5, 0x17,
+    // 'j'
+    0x71, 0x51, 0x21, 0xfa, 0x21,
+    // 'k'
+    0x81, 0xff, 0x11, 0x52, 0x42, 0x42, 0x52, 0x62, 0x62, 0x21, 0x31, 0xf0,
+    // 'l'
+    0x51, 0xff, 0x93, 0x22, 0x80,
+    // 'm'
+    0xff, 0xff, 0x65, 0x14, 0x4a, 0xff, 0xff, 0x71, 0x41, 0x41, 0xfc,
+    // 'n'
+    0xff, 0xb5, 0x45, 0xff, 0xc1, 0x41, 0xf2,
+    // 'o'
+    0xff, 0xc4, 0x36, 0xff, 0x46, 0x34, 0xf3,
+    // 'p'
+    0xff, 0xb5, 0x45, 0xff, 0x55, 0x34, 0xf3,
+    // 'q'
+    0xff, 0xc5, 0x25, 0xff, 0x55, 0x44, 0xf3,
+    // 'r'
+    0xfb, 0x42, 0x3f, 0xb1, 0xd0,
+    // 's'
+    0xff, 0x23, 0x24, 0x83, 0x43, 0x84, 0x23, 0xe0,
+    // 't'
+    0xf4, 0x1c, 0x33, 0x3f, 0xb4, 0x33, 0xd0,
+    // 'u'
+    0xff, 0xb1, 0x41, 0xff, 0xc5, 0x45, 0xf2,
+    // 'v'
+    0xff, 0x51, 0x53, 0x32, 0xf0, 0x21, 0x2a, 0x35, 0x1f, 0x20,
+    // 'w'
+    0xff, 0xf0, 0x13, 0x13, 0x19, 0x21, 0x31, 0x2f, 0x43, 0x13, 0xc1, 0x31, 0xf5,
+    // 'x'
+    0xff, 0x51, 0x53, 0x32, 0x12, 0x12, 0x33, 0x43, 0x32, 0x12, 0x12, 0x33, 0x51, 0xe0,
+    // 'y'
+    0xff, 0x51, 0x53, 0x32, 0xf0, 0x21, 0x2a, 0x3b, 0x23, 0x34,
+    // 'z'
+    0xff, 0x65, 0x24, 0x62, 0x42, 0x42, 0x42, 0x64, 0x25, 0xf0,
+    // '{'
+    0x81, 0x32, 0xf7, 0x23, 0x2f, 0xe2, 0x10,
+    // '|'
+    0x51, 0xff, 0xf9,
+    // '}'
+    0x61, 0x42, 0xf9, 0x23, 0x2f, 0xc2, 0x20,
+    // '~'
+    0xff, 0xfd, 0x22, 0x12, 0x62, 0x12, 0x2f, 0xfc,
+    // '°'
+    0x72, 0x24, 0x64, 0x22, 0xff, 0xf1,
+    // 'š'
+    0x71, 0x31, 0x12, 0x12, 0x23, 0x41, 0x43, 0x24, 0x83, 0x43, 0x84, 0x23, 0xe0,
+    // 'ť'
+    0x91, 0x91, 0x71, 0x43, 0x33, 0xfb, 0x43, 0x3d,
+    // 'ž'
+    0x81, 0x31, 0x22, 0x12, 0x33, 0x51, 0x45, 0x24, 0x62, 0x42, 0x42, 0x42, 0x64, 0x25, 0xf0,
+    // 'á'
+    0xc1, 0x52, 0x42, 0x51, 0x53, 0x44, 0xa3, 0x34, 0xa4, 0x44, 0xf0,
+    // 'č'
+    0x81, 0x31, 0x22, 0x12, 0x33, 0x51, 0x54, 0x25, 0xff, 0x05, 0x34, 0xf0,
+    // 'é'
+    0xd1, 0x62, 0x52, 0x61, 0x64, 0x36, 0xb4, 0x45, 0xa6, 0x35, 0xf2,
+    // 'ě'
+    0x21, 0x31, 0x32, 0x12, 0x43, 0x61, 0xd4, 0x36, 0xb4, 0x45, 0xa6, 0x35, 0xf2,
+    // 'í'
+    0x51, 0x14, 0x11, 0x31, 0xf5, 0x17,
+    // 'ď'
+    0xf0, 0x11, 0x1f, 0xb1, 0x24, 0x45, 0xff, 0xa5, 0x55, 0xf5,
+    // 'ň'
+    0xa1, 0x31, 0x32, 0x12, 0x43, 0x61, 0x45, 0x45, 0xff, 0xc1, 0x41, 0xf2,
+    // 'ř'
+    0x71, 0x31, 0x12, 0x12, 0x23, 0x41, 0x34, 0x33, 0xff, 0x21, 0xf1,
+    // 'ů'
+    0xc1, 0x63, 0x53, 0x61, 0x41, 0x41, 0xff, 0xc5, 0x45, 0xf2,
+    // 'ú'
+    0xd1, 0x62, 0x52, 0x61, 0x51, 0x41, 0xff, 0xc5, 0x45, 0xf2,
+    // 'ý'
+    0xc1, 0x52, 0x42, 0x51, 0x31, 0x53, 0x32, 0xf0, 0x21, 0x2a, 0x3b, 0x23, 0x34,
+};
+
+static const bc_font_rle_char_t bc_font_ubuntu_15_rle_chars[110] = {
+    { 0x20, 3, 0 },
+    { 0x21, 4, 2 },
+    { 0x22, 6, 7 },
+    { 0x23, 9, 14 },
+    { 0x24, 8, 34 },
+    { 0x25, 12, 47 },
+    { 0x26, 9, 65 },
+    { 0x27, 3, 81 },
+    { 0x28, 5, 84 },
+    { 0x29, 5, 91 },
+    { 0x2a, 7, 98 },
+    { 0x2b, 8, 111 },
+    { 0x2c, 3, 120 },
+    { 0x2d, 5, 125 },
+    { 0x2e, 3, 130 },
+    { 0x2f, 6, 134 },
+    { 0x30, 8, 143 },
+    { 0x31, 8, 150 },
+    { 0x32, 8, 159 },
+    { 0x33, 8, 171 },
+    { 0x34, 8, 180 },
+    { 0x35, 8, 192 },
+    { 0x36, 8, 201 },
+    { 0x37, 8, 211 },
+    { 0x38, 8, 220 },
+    { 0x39, 8, 229 },
+    { 0x3a, 3, 239 },
+    { 0x3b, 3, 244 },
+    { 0x3c, 8, 250 },
+    { 0x3d, 8, 261 },
+    { 0x3e, 8, 268 },
+    { 0x3f, 6, 278 },
+    { 0x40, 13, 287 },
+    { 0x41, 9, 305 },
+    { 0x42, 9, 318 },
+    { 0x43, 10, 330 },
+    { 0x44, 10, 341 },
+    { 0x45, 8, 352 },
+    { 0x46, 8, 361 },
+    { 0x47, 10, 369 },
+    { 0x48, 10, 380 },
+    { 0x49, 3, 390 },
+    { 0x4a, 7, 393 },
+    { 0x4b, 9, 400 },
+    { 0x4c, 7, 415 },
+    { 0x4d, 13, 421 },
+    { 0x4e, 10, 439 },
+    { 0x4f, 11, 453 },
+    { 0x50, 9, 464 },
+    { 0x51, 11, 474 },
+    { 0x52, 9, 488 },
+    { 0x53, 7, 501 },
+    { 0x54, 7, 512 },
+    { 0x55, 10, 518 },
+    { 0x56, 9, 528 },
+    { 0x57, 13, 540 },
+    { 0x58, 8, 557 },
+    { 0x59, 9, 571 },
+    { 0x5a, 8, 583 },
+    { 0x5b, 5, 594 },
+    { 0x5c, 6, 599 },
+    { 0x5d, 5, 607 },
+    { 0x5e, 8, 612 },
+    { 0x5f, 7, 623 },
+    { 0x60, 5, 627 },
+    { 0x61, 7, 633 },
+    { 0x62, 8, 641 },
+    { 0x63, 7, 649 },
+    { 0x64, 8, 656 },
+    { 0x65, 8, 664 },
+    { 0x66, 5, 672 },
+    { 0x67, 8, 678 },
+    { 0x68, 8, 686 },
+    { 0x69, 3, 694 },
+    { 0x6a, 3, 699 },
+    { 0x6b, 7, 704 },
+    { 0x6c, 4, 716 },
+    { 0x6d, 13, 721 },
+    { 0x6e, 8, 732 },
+    { 0x6f, 8, 739 },
+    { 0x70, 8, 746 },
+    { 0x71, 8, 753 },
+    { 0x72, 5, 760 },
+    { 0x73, 6, 765 },
+    { 0x74, 6, 773 },
+    { 0x75, 8, 780 },
+    { 0x76, 7, 787 },
+    { 0x77, 9, 797 },
+    { 0x78, 7, 810 },
+    { 0x79, 7, 824 },
+    { 0x7a, 7, 834 },
+    { 0x7b, 5, 844 },
+    { 0x7c, 4, 851 },
+    { 0x7d, 5, 854 },
+    { 0x7e, 8, 861 },
+    { 0xb0, 5, 869 },
+    { 0xb9, 6, 875 },
+    { 0xbb, 6, 888 },
+    { 0xbe, 7, 896 },
+    { 0xe1, 7, 911 },
+    { 0xe8, 7, 922 },
+    { 0xe9, 8, 934 },
+    { 0xec, 8, 945 },
+    { 0xed, 3, 958 },
+    { 0xef, 9, 964 },
+    { 0xf2, 8, 974 },
+    { 0xf8, 6, 986 },
+    { 0xf9, 8, 997 },
+    { 0xfa, 8, 1007 },
+    { 0xfd, 7, 1017 },
+};
+
+static const uint8_t bc_font_ubuntu_15_index[BC_FONT_INDEX_LENGTH] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xff, 0x61, 0xff, 0xff, 0x62, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x65, 0xff, 0xff, 0x66, 0x67, 0xff, 0x68,
+    0xff, 0xff, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x6b, 0x6c, 0xff, 0xff, 0x6d, 0xff, 0xff,
+};
+
+const bc_font_t bc_font_ubuntu_15 = { 110, NULL, bc_font_ubuntu_15_index, 15, bc_font_ubuntu_15_rle_chars, bc_font_ubuntu_15_rle_data };
@@ -27,4303 +27,359 @@
 
 #include <bc_font_common.h>
 
-
-
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x20[24] = {
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x20 = { image_data_bc_font_ubuntu_24_0x20,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x21[24] = {
-    0xfe, 
-    0xfe, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xfe, 
-    0xfe, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x21 = { image_data_bc_font_ubuntu_24_0x21,
-    7, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x22[48] = {
-    0xcc, 0xc0, 
-    0xcc, 0xc0, 
-    0xcc, 0xc0, 
-    0xcc, 0xc0, 
-    0xcc, 0xc0, 
-    0xcc, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x22 = { image_data_bc_font_ubuntu_24_0x22,
-    10, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x23[48] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xf9, 0xf3, 
-    0xf9, 0xf3, 
-    0xf9, 0xf3, 
-    0xf3, 0xe7, 
-    0x80, 0x01, 
-    0x80, 0x01, 
-    0xf3, 0xe7, 
-    0xf3, 0xe7, 
-    0xe3, 0xc7, 
-    0xe7, 0xcf, 
-    0xe7, 0xcf, 
-    0x80, 0x01, 
-    0x80, 0x01, 
-    0xe7, 0xcf, 
-    0xcf, 0x9f, 
-    0xcf, 0x9f, 
-    0xcf, 0x9f, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x23 = { image_data_bc_font_ubuntu_24_0x23,
-    16, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x24[48] = {
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xf0, 0x1c, 
-    0xc0, 0x1c, 
-    0x8f, 0xdc, 
-    0x9f, 0xfc, 
-    0x9f, 0xfc, 
-    0x8f, 0xfc, 
-    0xc3, 0xfc, 
-    0xf0, 0xfc, 
-    0xfc, 0x3c, 
-    0xff, 0x1c, 
-    0xff, 0x8c, 
-    0xff, 0xcc, 
-    0xff, 0xcc, 
-    0x9f, 0x8c, 
-    0x80, 0x1c, 
-    0xc0, 0x3c, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x24 = { image_data_bc_font_ubuntu_24_0x24,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x25[72] = {
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xe1, 0xfe, 0x78, 
-    0xc0, 0xfc, 0xf8, 
-    0x8c, 0x79, 0xf8, 
-    0x9e, 0x79, 0xf8, 
-    0x9e, 0x73, 0xf8, 
-    0x9e, 0x67, 0xf8, 
-    0x9e, 0x67, 0xf8, 
-    0x8c, 0x4c, 0x38, 
-    0xc0, 0x88, 0x18, 
-    0xe1, 0x91, 0x88, 
-    0xff, 0x33, 0xc8, 
-    0xff, 0x33, 0xc8, 
-    0xfe, 0x73, 0xc8, 
-    0xfc, 0xf3, 0xc8, 
-    0xfc, 0xf1, 0x88, 
-    0xf9, 0xf8, 0x18, 
-    0xf3, 0xfc, 0x38, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x25 = { image_data_bc_font_ubuntu_24_0x25,
-    21, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x26[48] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xf8, 0x7f, 
-    0xf0, 0x3f, 
-    0xe3, 0x1f, 
-    0xe7, 0x9f, 
-    0xe7, 0x9f, 
-    0xe7, 0x9f, 
-    0xf3, 0x3f, 
-    0xf0, 0x7f, 
-    0xf0, 0xff, 
-    0xc0, 0x79, 
-    0xce, 0x39, 
-    0x9f, 0x33, 
-    0x9f, 0x97, 
-    0x9f, 0xc7, 
-    0x8f, 0xc7, 
-    0xc0, 0x13, 
-    0xf0, 0x39, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x26 = { image_data_bc_font_ubuntu_24_0x26,
-    16, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x27[24] = {
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x27 = { image_data_bc_font_ubuntu_24_0x27,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x28[24] = {
-    0xfd, 
-    0xf9, 
-    0xf3, 
-    0xf3, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xf3, 
-    0xf3, 
-    0xf9, 
-    0xfd, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x28 = { image_data_bc_font_ubuntu_24_0x28,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x29[24] = {
-    0xbf, 
-    0x9f, 
-    0xcf, 
-    0xcf, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xcf, 
-    0xcf, 
-    0x9f, 
-    0xbf, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x29 = { image_data_bc_font_ubuntu_24_0x29,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x2a[48] = {
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xf8, 0xf0, 
-    0xf8, 0xf0, 
-    0xc8, 0x90, 
-    0xc4, 0x10, 
-    0xf0, 0x70, 
-    0xfa, 0xf0, 
-    0xf2, 0x70, 
-    0xe2, 0x30, 
-    0xf7, 0x70, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x2a = { image_data_bc_font_ubuntu_24_0x2a,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x2b[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0x80, 0x04, 
-    0x80, 0x04, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x2b = { image_data_bc_font_ubuntu_24_0x2b,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x2c[24] = {
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xdc, 
-    0x9c, 
-    0x9c, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x2c = { image_data_bc_font_ubuntu_24_0x2c,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x2d[24] = {
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0x81, 
-    0x81, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x2d = { image_data_bc_font_ubuntu_24_0x2d,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x2e[24] = {
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0x8c, 
-    0x8c, 
-    0x8c, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x2e = { image_data_bc_font_ubuntu_24_0x2e,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x2f[48] = {
-    0xff, 0x00, 
-    0xfe, 0x40, 
-    0xfe, 0x40, 
-    0xfe, 0x40, 
-    0xfc, 0xc0, 
-    0xfc, 0xc0, 
-    0xf9, 0xc0, 
-    0xf9, 0xc0, 
-    0xf9, 0xc0, 
-    0xf3, 0xc0, 
-    0xf3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe7, 0xc0, 
-    0xe7, 0xc0, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0x9f, 0xc0, 
-    0x9f, 0xc0, 
-    0x3f, 0xc0, 
-    0x3f, 0xc0, 
-    0x3f, 0xc0, 
-    0x7f, 0xc0, 
-    0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x2f = { image_data_bc_font_ubuntu_24_0x2f,
-    10, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x30[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xf8, 0x7c, 
-    0xe0, 0x1c, 
-    0xc7, 0x8c, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0x9f, 0xe4, 
-    0x9f, 0xe4, 
-    0x9f, 0xe4, 
-    0x9f, 0xe4, 
-    0x9f, 0xe4, 
-    0x9f, 0xe4, 
-    0x9f, 0xe4, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xc7, 0x8c, 
-    0xe0, 0x1c, 
-    0xf8, 0x7c, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x30 = { image_data_bc_font_ubuntu_24_0x30,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x31[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xfe, 0x7c, 
-    0xfc, 0x7c, 
-    0xf0, 0x7c, 
-    0xe2, 0x7c, 
-    0xe6, 0x7c, 
-    0xfe, 0x7c, 
-    0xfe, 0x7c, 
-    0xfe, 0x7c, 
-    0xfe, 0x7c, 
-    0xfe, 0x7c, 
-    0xfe, 0x7c, 
-    0xfe, 0x7c, 
-    0xfe, 0x7c, 
-    0xfe, 0x7c, 
-    0xfe, 0x7c, 
-    0xfe, 0x7c, 
-    0xfe, 0x7c, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x31 = { image_data_bc_font_ubuntu_24_0x31,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x32[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xf0, 0x3c, 
-    0xe0, 0x1c, 
-    0xc7, 0x8c, 
-    0xff, 0xcc, 
-    0xff, 0xcc, 
-    0xff, 0xcc, 
-    0xff, 0x9c, 
-    0xff, 0x1c, 
-    0xfe, 0x3c, 
-    0xfc, 0x7c, 
-    0xf8, 0xfc, 
-    0xf1, 0xfc, 
-    0xf3, 0xfc, 
-    0xe7, 0xfc, 
-    0xcf, 0xfc, 
-    0xc0, 0x04, 
-    0xc0, 0x04, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x32 = { image_data_bc_font_ubuntu_24_0x32,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x33[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xe0, 0xfc, 
-    0x80, 0x3c, 
-    0xdf, 0x1c, 
-    0xff, 0x9c, 
-    0xff, 0x9c, 
-    0xff, 0x9c, 
-    0xff, 0x3c, 
-    0xf0, 0x3c, 
-    0xf0, 0x3c, 
-    0xff, 0x1c, 
-    0xff, 0x8c, 
-    0xff, 0xcc, 
-    0xff, 0xcc, 
-    0xff, 0xcc, 
-    0xbf, 0x1c, 
-    0x80, 0x1c, 
-    0xc0, 0x7c, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x33 = { image_data_bc_font_ubuntu_24_0x33,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x34[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0x1c, 
-    0xff, 0x1c, 
-    0xfe, 0x1c, 
-    0xfc, 0x1c, 
-    0xf8, 0x9c, 
-    0xf1, 0x9c, 
-    0xf3, 0x9c, 
-    0xe7, 0x9c, 
-    0xc7, 0x9c, 
-    0xcf, 0x9c, 
-    0x9f, 0x9c, 
-    0x80, 0x04, 
-    0x80, 0x04, 
-    0xff, 0x9c, 
-    0xff, 0x9c, 
-    0xff, 0x9c, 
-    0xff, 0x9c, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x34 = { image_data_bc_font_ubuntu_24_0x34,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x35[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xf0, 0x1c, 
-    0xf0, 0x1c, 
-    0xf3, 0xfc, 
-    0xf3, 0xfc, 
-    0xf3, 0xfc, 
-    0xf3, 0xfc, 
-    0xe0, 0xfc, 
-    0xe0, 0x3c, 
-    0xfe, 0x1c, 
-    0xff, 0x8c, 
-    0xff, 0xcc, 
-    0xff, 0xcc, 
-    0xff, 0xcc, 
-    0xff, 0xcc, 
-    0xdf, 0x9c, 
-    0xc0, 0x1c, 
-    0xe0, 0x7c, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x35 = { image_data_bc_font_ubuntu_24_0x35,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x36[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0x0c, 
-    0xfc, 0x0c, 
-    0xf8, 0xfc, 
-    0xf3, 0xfc, 
-    0xe7, 0xfc, 
-    0xe7, 0xfc, 
-    0xc8, 0x3c, 
-    0xc0, 0x0c, 
-    0xcf, 0xcc, 
-    0xcf, 0xe4, 
-    0xcf, 0xe4, 
-    0xcf, 0xe4, 
-    0xcf, 0xe4, 
-    0xe7, 0xc4, 
-    0xe3, 0x8c, 
-    0xf0, 0x1c, 
-    0xf8, 0x3c, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x36 = { image_data_bc_font_ubuntu_24_0x36,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x37[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0x80, 0x0c, 
-    0x80, 0x0c, 
-    0xff, 0xcc, 
-    0xff, 0x9c, 
-    0xff, 0x3c, 
-    0xff, 0x3c, 
-    0xfe, 0x7c, 
-    0xfe, 0x7c, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xf9, 0xfc, 
-    0xf9, 0xfc, 
-    0xf9, 0xfc, 
-    0xf9, 0xfc, 
-    0xf3, 0xfc, 
-    0xf3, 0xfc, 
-    0xf3, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x37 = { image_data_bc_font_ubuntu_24_0x37,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x38[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xf0, 0x3c, 
-    0xc0, 0x0c, 
-    0xcf, 0xcc, 
-    0x9f, 0xe4, 
-    0x9f, 0xe4, 
-    0x9f, 0xe4, 
-    0xc7, 0xcc, 
-    0xc1, 0x1c, 
-    0xf0, 0x3c, 
-    0xe6, 0x0c, 
-    0xcf, 0x8c, 
-    0x9f, 0xe4, 
-    0x9f, 0xe4, 
-    0x9f, 0xe4, 
-    0x8f, 0xc4, 
-    0xc0, 0x0c, 
-    0xf0, 0x3c, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x38 = { image_data_bc_font_ubuntu_24_0x38,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x39[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xf0, 0x7c, 
-    0xc0, 0x3c, 
-    0xcf, 0x1c, 
-    0x9f, 0x9c, 
-    0x9f, 0xcc, 
-    0x9f, 0xcc, 
-    0x9f, 0xcc, 
-    0xcf, 0xcc, 
-    0xc0, 0x0c, 
-    0xf0, 0x4c, 
-    0xff, 0x8c, 
-    0xff, 0x9c, 
-    0xff, 0x1c, 
-    0xfe, 0x3c, 
-    0xfc, 0x7c, 
-    0xc0, 0xfc, 
-    0xc3, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x39 = { image_data_bc_font_ubuntu_24_0x39,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x3a[24] = {
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0x8c, 
-    0x8c, 
-    0x8c, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0x8c, 
-    0x8c, 
-    0x8c, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x3a = { image_data_bc_font_ubuntu_24_0x3a,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x3b[24] = {
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0x8c, 
-    0x8c, 
-    0x8c, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xdc, 
-    0x9c, 
-    0x9c, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x3b = { image_data_bc_font_ubuntu_24_0x3b,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x3c[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xec, 
-    0xff, 0x84, 
-    0xfc, 0x1c, 
-    0xf0, 0x7c, 
-    0xc3, 0xfc, 
-    0xcf, 0xfc, 
-    0xc3, 0xfc, 
-    0xf0, 0x7c, 
-    0xfc, 0x1c, 
-    0xff, 0x84, 
-    0xff, 0xec, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x3c = { image_data_bc_font_ubuntu_24_0x3c,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x3d[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xc0, 0x04, 
-    0xc0, 0x04, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xc0, 0x04, 
-    0xc0, 0x04, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x3d = { image_data_bc_font_ubuntu_24_0x3d,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x3e[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xdf, 0xfc, 
-    0x87, 0xfc, 
-    0xe0, 0xfc, 
-    0xf8, 0x3c, 
-    0xff, 0x0c, 
-    0xff, 0xcc, 
-    0xff, 0x0c, 
-    0xf8, 0x3c, 
-    0xe0, 0xfc, 
-    0x87, 0xfc, 
-    0xdf, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x3e = { image_data_bc_font_ubuntu_24_0x3e,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x3f[48] = {
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xc1, 0xc0, 
-    0x80, 0xc0, 
-    0xfc, 0x40, 
-    0xfe, 0x40, 
-    0xfe, 0x40, 
-    0xfe, 0x40, 
-    0xfc, 0xc0, 
-    0xf9, 0xc0, 
-    0xf3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe7, 0xc0, 
-    0xe7, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xe7, 0xc0, 
-    0xe7, 0xc0, 
-    0xe7, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x3f = { image_data_bc_font_ubuntu_24_0x3f,
-    10, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x40[72] = {
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0x01, 0xfe, 
-    0xfc, 0x00, 0x7e, 
-    0xf8, 0x7e, 0x3e, 
-    0xf1, 0xff, 0x1e, 
-    0xe3, 0xff, 0x8e, 
-    0xe7, 0xc0, 0xce, 
-    0xe7, 0x00, 0xe6, 
-    0xcf, 0x3c, 0xe6, 
-    0xce, 0x3c, 0xe6, 
-    0xce, 0x7c, 0xe6, 
-    0xce, 0x7c, 0xe6, 
-    0xce, 0x7c, 0xe6, 
-    0xce, 0x7c, 0xc6, 
-    0xcf, 0x3c, 0xce, 
-    0xe7, 0x00, 0x0e, 
-    0xe7, 0xc2, 0x1e, 
-    0xe3, 0xff, 0xfe, 
-    0xf1, 0xff, 0xfe, 
-    0xf8, 0x7f, 0xfe, 
-    0xfc, 0x00, 0xfe, 
-    0xff, 0x80, 0xfe, 
-    0xff, 0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x40 = { image_data_bc_font_ubuntu_24_0x40,
-    23, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x41[48] = {
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xf9, 0x3e, 
-    0xf9, 0x3e, 
-    0xf1, 0x1e, 
-    0xf3, 0x9e, 
-    0xf3, 0x9e, 
-    0xe7, 0xce, 
-    0xe7, 0xce, 
-    0xc7, 0xce, 
-    0xc0, 0x06, 
-    0xc0, 0x06, 
-    0x9f, 0xf2, 
-    0x9f, 0xf2, 
-    0x9f, 0xf2, 
-    0x3f, 0xf8, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x41 = { image_data_bc_font_ubuntu_24_0x41,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x42[48] = {
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xc0, 0x3e, 
-    0xc0, 0x0e, 
-    0xcf, 0xc6, 
-    0xcf, 0xe6, 
-    0xcf, 0xe6, 
-    0xcf, 0xe6, 
-    0xcf, 0xce, 
-    0xc0, 0x1e, 
-    0xc0, 0x0e, 
-    0xcf, 0xc6, 
-    0xcf, 0xf2, 
-    0xcf, 0xf2, 
-    0xcf, 0xf2, 
-    0xcf, 0xf2, 
-    0xcf, 0xc6, 
-    0xc0, 0x0e, 
-    0xc0, 0x1e, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x42 = { image_data_bc_font_ubuntu_24_0x42,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x43[48] = {
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xfc, 0x06, 
-    0xf0, 0x02, 
-    0xe3, 0xf2, 
-    0xc7, 0xfe, 
-    0xcf, 0xfe, 
-    0x8f, 0xfe, 
-    0x9f, 0xfe, 
-    0x9f, 0xfe, 
-    0x9f, 0xfe, 
-    0x9f, 0xfe, 
-    0x9f, 0xfe, 
-    0x9f, 0xfe, 
-    0xcf, 0xfe, 
-    0xc7, 0xfe, 
-    0xe3, 0xf2, 
-    0xf0, 0x02, 
-    0xfc, 0x06, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x43 = { image_data_bc_font_ubuntu_24_0x43,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x44[72] = {
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xc0, 0x3f, 0x80, 
-    0xc0, 0x07, 0x80, 
-    0xcf, 0xc3, 0x80, 
-    0xcf, 0xf1, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf8, 0x80, 
-    0xcf, 0xfc, 0x80, 
-    0xcf, 0xfc, 0x80, 
-    0xcf, 0xfc, 0x80, 
-    0xcf, 0xfc, 0x80, 
-    0xcf, 0xfc, 0x80, 
-    0xcf, 0xf8, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf1, 0x80, 
-    0xcf, 0xc3, 0x80, 
-    0xc0, 0x07, 0x80, 
-    0xc0, 0x3f, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x44 = { image_data_bc_font_ubuntu_24_0x44,
-    17, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x45[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xc0, 0x0c, 
-    0xc0, 0x0c, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xc0, 0x0c, 
-    0xc0, 0x0c, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xc0, 0x04, 
-    0xc0, 0x04, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x45 = { image_data_bc_font_ubuntu_24_0x45,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x46[48] = {
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xc0, 0x08, 
-    0xc0, 0x08, 
-    0xcf, 0xf8, 
-    0xcf, 0xf8, 
-    0xcf, 0xf8, 
-    0xcf, 0xf8, 
-    0xcf, 0xf8, 
-    0xc0, 0x18, 
-    0xc0, 0x18, 
-    0xcf, 0xf8, 
-    0xcf, 0xf8, 
-    0xcf, 0xf8, 
-    0xcf, 0xf8, 
-    0xcf, 0xf8, 
-    0xcf, 0xf8, 
-    0xcf, 0xf8, 
-    0xcf, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x46 = { image_data_bc_font_ubuntu_24_0x46,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x47[48] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xfc, 0x07, 
-    0xf0, 0x03, 
-    0xe3, 0xf7, 
-    0xc7, 0xff, 
-    0xcf, 0xff, 
-    0x8f, 0xff, 
-    0x9f, 0xff, 
-    0x9f, 0xff, 
-    0x9f, 0xff, 
-    0x9f, 0xf3, 
-    0x9f, 0xf3, 
-    0x9f, 0xf3, 
-    0xcf, 0xf3, 
-    0xc7, 0xf3, 
-    0xe3, 0xf3, 
-    0xf0, 0x03, 
-    0xfc, 0x07, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x47 = { image_data_bc_font_ubuntu_24_0x47,
-    16, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x48[72] = {
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xc0, 0x01, 0x80, 
-    0xc0, 0x01, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x48 = { image_data_bc_font_ubuntu_24_0x48,
-    17, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x49[24] = {
-    0xfc, 
-    0xfc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x49 = { image_data_bc_font_ubuntu_24_0x49,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x4a[48] = {
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0x30, 
-    0xff, 0x30, 
-    0xff, 0x30, 
-    0xff, 0x30, 
-    0xff, 0x30, 
-    0xff, 0x30, 
-    0xff, 0x30, 
-    0xff, 0x30, 
-    0xff, 0x30, 
-    0xff, 0x30, 
-    0xff, 0x30, 
-    0xff, 0x30, 
-    0xff, 0x30, 
-    0xff, 0x30, 
-    0xbe, 0x70, 
-    0x00, 0x70, 
-    0xc1, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x4a = { image_data_bc_font_ubuntu_24_0x4a,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x4b[48] = {
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xcf, 0xe6, 
-    0xcf, 0xce, 
-    0xcf, 0x9e, 
-    0xcf, 0x3e, 
-    0xce, 0x7e, 
-    0xcc, 0xfe, 
-    0xc9, 0xfe, 
-    0xc3, 0xfe, 
-    0xc1, 0xfe, 
-    0xc8, 0x7e, 
-    0xcc, 0x3e, 
-    0xce, 0x1e, 
-    0xcf, 0x0e, 
-    0xcf, 0x86, 
-    0xcf, 0xc6, 
-    0xcf, 0xe2, 
-    0xcf, 0xf0, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x4b = { image_data_bc_font_ubuntu_24_0x4b,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x4c[48] = {
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xcf, 0xf0, 
-    0xcf, 0xf0, 
-    0xcf, 0xf0, 
-    0xcf, 0xf0, 
-    0xcf, 0xf0, 
-    0xcf, 0xf0, 
-    0xcf, 0xf0, 
-    0xcf, 0xf0, 
-    0xcf, 0xf0, 
-    0xcf, 0xf0, 
-    0xcf, 0xf0, 
-    0xcf, 0xf0, 
-    0xcf, 0xf0, 
-    0xcf, 0xf0, 
-    0xcf, 0xf0, 
-    0xc0, 0x00, 
-    0xc0, 0x00, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x4c = { image_data_bc_font_ubuntu_24_0x4c,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x4d[72] = {
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xcf, 0xff, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc3, 0xfc, 0x30, 
-    0xcb, 0xfd, 0x30, 
-    0xc9, 0xf9, 0x30, 
-    0xcd, 0xfb, 0x30, 
-    0x9c, 0xf3, 0x90, 
-    0x9e, 0xf7, 0x90, 
-    0x9e, 0x67, 0x90, 
-    0x9e, 0x67, 0x90, 
-    0x9f, 0x6f, 0x90, 
-    0x9f, 0x0f, 0x90, 
-    0x9f, 0x0f, 0x90, 
-    0x9f, 0x9f, 0x90, 
-    0x9f, 0xff, 0x90, 
-    0x9f, 0xff, 0x90, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x4d = { image_data_bc_font_ubuntu_24_0x4d,
-    20, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x4e[72] = {
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xc7, 0xf9, 0x80, 
-    0xc3, 0xf9, 0x80, 
-    0xc1, 0xf9, 0x80, 
-    0xc9, 0xf9, 0x80, 
-    0xcc, 0xf9, 0x80, 
-    0xcc, 0x79, 0x80, 
-    0xce, 0x39, 0x80, 
-    0xcf, 0x39, 0x80, 
-    0xcf, 0x99, 0x80, 
-    0xcf, 0x89, 0x80, 
-    0xcf, 0xc9, 0x80, 
-    0xcf, 0xe1, 0x80, 
-    0xcf, 0xf1, 0x80, 
-    0xcf, 0xf1, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xfd, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x4e = { image_data_bc_font_ubuntu_24_0x4e,
-    17, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x4f[72] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xfc, 0x0f, 0xc0, 
-    0xf0, 0x03, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xcf, 0xfc, 0xc0, 
-    0x8f, 0xfc, 0x40, 
-    0x9f, 0xfe, 0x40, 
-    0x9f, 0xfe, 0x40, 
-    0x9f, 0xfe, 0x40, 
-    0x9f, 0xfe, 0x40, 
-    0x9f, 0xfe, 0x40, 
-    0x8f, 0xfc, 0x40, 
-    0xcf, 0xfc, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xf0, 0x03, 0xc0, 
-    0xfc, 0x0f, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x4f = { image_data_bc_font_ubuntu_24_0x4f,
-    18, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x50[48] = {
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xc0, 0x3e, 
-    0xc0, 0x0e, 
-    0xcf, 0xc6, 
-    0xcf, 0xe2, 
-    0xcf, 0xf2, 
-    0xcf, 0xf2, 
-    0xcf, 0xf2, 
-    0xcf, 0xe2, 
-    0xcf, 0xc6, 
-    0xc0, 0x0e, 
-    0xc0, 0x3e, 
-    0xcf, 0xfe, 
-    0xcf, 0xfe, 
-    0xcf, 0xfe, 
-    0xcf, 0xfe, 
-    0xcf, 0xfe, 
-    0xcf, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x50 = { image_data_bc_font_ubuntu_24_0x50,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x51[72] = {
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xfc, 0x07, 0xe0, 
-    0xf0, 0x01, 0xe0, 
-    0xe1, 0xf0, 0xe0, 
-    0xc7, 0xfc, 0x60, 
-    0xcf, 0xfe, 0x60, 
-    0x8f, 0xfe, 0x20, 
-    0x9f, 0xff, 0x20, 
-    0x9f, 0xff, 0x20, 
-    0x9f, 0xff, 0x20, 
-    0x9f, 0xff, 0x20, 
-    0x9f, 0xff, 0x20, 
-    0x8f, 0xfe, 0x20, 
-    0xcf, 0xfe, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xe1, 0xf0, 0xe0, 
-    0xf0, 0x03, 0xe0, 
-    0xfc, 0x0f, 0xe0, 
-    0xff, 0x9f, 0xe0, 
-    0xff, 0xc7, 0xe0, 
-    0xff, 0xe0, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x51 = { image_data_bc_font_ubuntu_24_0x51,
-    19, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x52[48] = {
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xc0, 0x3e, 
-    0xc0, 0x0e, 
-    0xcf, 0xc6, 
-    0xcf, 0xf2, 
-    0xcf, 0xf2, 
-    0xcf, 0xf2, 
-    0xcf, 0xf2, 
-    0xcf, 0xc6, 
-    0xc0, 0x0e, 
-    0xc0, 0x1e, 
-    0xcf, 0x9e, 
-    0xcf, 0xce, 
-    0xcf, 0xc6, 
-    0xcf, 0xe6, 
-    0xcf, 0xf2, 
-    0xcf, 0xf0, 
-    0xcf, 0xf8, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x52 = { image_data_bc_font_ubuntu_24_0x52,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x53[48] = {
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xf0, 0x38, 
-    0xc0, 0x18, 
-    0x8f, 0xb8, 
-    0x9f, 0xf8, 
-    0x9f, 0xf8, 
-    0x8f, 0xf8, 
-    0xc3, 0xf8, 
-    0xe1, 0xf8, 
-    0xf8, 0x78, 
-    0xfe, 0x18, 
-    0xff, 0x88, 
-    0xff, 0xc8, 
-    0xff, 0xc8, 
-    0xff, 0xc8, 
-    0x9f, 0x88, 
-    0x80, 0x18, 
-    0xe0, 0x78, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x53 = { image_data_bc_font_ubuntu_24_0x53,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x54[48] = {
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0x00, 0x00, 
-    0x00, 0x00, 
-    0xf9, 0xf0, 
-    0xf9, 0xf0, 
-    0xf9, 0xf0, 
-    0xf9, 0xf0, 
-    0xf9, 0xf0, 
-    0xf9, 0xf0, 
-    0xf9, 0xf0, 
-    0xf9, 0xf0, 
-    0xf9, 0xf0, 
-    0xf9, 0xf0, 
-    0xf9, 0xf0, 
-    0xf9, 0xf0, 
-    0xf9, 0xf0, 
-    0xf9, 0xf0, 
-    0xf9, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x54 = { image_data_bc_font_ubuntu_24_0x54,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x55[72] = {
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xcf, 0xf9, 0x80, 
-    0xe7, 0xf3, 0x80, 
-    0xe3, 0xe3, 0x80, 
-    0xf0, 0x07, 0x80, 
-    0xfc, 0x1f, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x55 = { image_data_bc_font_ubuntu_24_0x55,
-    17, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x56[48] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0x3f, 0xfc, 
-    0x9f, 0xf9, 
-    0x9f, 0xf9, 
-    0x9f, 0xf9, 
-    0xcf, 0xf3, 
-    0xcf, 0xf3, 
-    0xc7, 0xe3, 
-    0xe7, 0xe7, 
-    0xe7, 0xe7, 
-    0xf3, 0xcf, 
-    0xf3, 0xcf, 
-    0xf9, 0x9f, 
-    0xf9, 0x9f, 
-    0xf8, 0x1f, 
-    0xfc, 0x3f, 
-    0xfc, 0x3f, 
-    0xfe, 0x7f, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x56 = { image_data_bc_font_ubuntu_24_0x56,
-    16, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x57[72] = {
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0x9f, 0xff, 0xf2, 
-    0x9f, 0xff, 0xf2, 
-    0x8f, 0xe7, 0xe2, 
-    0xcf, 0xc7, 0xe6, 
-    0xcf, 0xc7, 0xe6, 
-    0xcf, 0xd7, 0xe6, 
-    0xcf, 0x93, 0xe6, 
-    0xe7, 0x93, 0xce, 
-    0xe7, 0x91, 0xce, 
-    0xe7, 0x39, 0xce, 
-    0xe7, 0x39, 0xce, 
-    0xe2, 0x38, 0x8e, 
-    0xf2, 0x7c, 0x9e, 
-    0xf2, 0x7c, 0x9e, 
-    0xf0, 0xfc, 0x1e, 
-    0xf8, 0xfe, 0x3e, 
-    0xf8, 0xfe, 0x3e, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x57 = { image_data_bc_font_ubuntu_24_0x57,
-    23, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x58[48] = {
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0x8f, 0xf0, 
-    0xcf, 0xf2, 
-    0xe7, 0xe6, 
-    0xe3, 0xc6, 
-    0xf3, 0xce, 
-    0xf9, 0x9e, 
-    0xfc, 0x1e, 
-    0xfc, 0x3e, 
-    0xfe, 0x7e, 
-    0xfc, 0x3e, 
-    0xf8, 0x1e, 
-    0xf9, 0x9e, 
-    0xf3, 0xce, 
-    0xe3, 0xc6, 
-    0xe7, 0xe6, 
-    0xcf, 0xf2, 
-    0x8f, 0xf0, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x58 = { image_data_bc_font_ubuntu_24_0x58,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x59[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0x3f, 0xf0, 
-    0x9f, 0xe4, 
-    0x8f, 0xc4, 
-    0xcf, 0xcc, 
-    0xe7, 0x9c, 
-    0xe7, 0x9c, 
-    0xf3, 0x3c, 
-    0xf0, 0x3c, 
-    0xf8, 0x7c, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x59 = { image_data_bc_font_ubuntu_24_0x59,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x5a[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0x80, 0x04, 
-    0x80, 0x04, 
-    0xff, 0xc4, 
-    0xff, 0xcc, 
-    0xff, 0x9c, 
-    0xff, 0x3c, 
-    0xfe, 0x7c, 
-    0xfc, 0xfc, 
-    0xfc, 0xfc, 
-    0xf9, 0xfc, 
-    0xf3, 0xfc, 
-    0xe3, 0xfc, 
-    0xe7, 0xfc, 
-    0xcf, 0xfc, 
-    0x8f, 0xfc, 
-    0x80, 0x04, 
-    0x80, 0x04, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x5a = { image_data_bc_font_ubuntu_24_0x5a,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x5b[24] = {
-    0xc0, 
-    0xc0, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xcf, 
-    0xc0, 
-    0xc0, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x5b = { image_data_bc_font_ubuntu_24_0x5b,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x5c[48] = {
-    0x7f, 0xc0, 
-    0x3f, 0xc0, 
-    0x3f, 0xc0, 
-    0x3f, 0xc0, 
-    0x9f, 0xc0, 
-    0x9f, 0xc0, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xe7, 0xc0, 
-    0xe7, 0xc0, 
-    0xe3, 0xc0, 
-    0xf3, 0xc0, 
-    0xf3, 0xc0, 
-    0xf9, 0xc0, 
-    0xf9, 0xc0, 
-    0xf9, 0xc0, 
-    0xfc, 0xc0, 
-    0xfc, 0xc0, 
-    0xfe, 0x40, 
-    0xfe, 0x40, 
-    0xfe, 0x40, 
-    0xff, 0x00, 
-    0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x5c = { image_data_bc_font_ubuntu_24_0x5c,
-    10, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x5d[24] = {
-    0x03, 
-    0x03, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0xf3, 
-    0x03, 
-    0x03, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x5d = { image_data_bc_font_ubuntu_24_0x5d,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x5e[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xfd, 0xfc, 
-    0xf8, 0xfc, 
-    0xf2, 0x7c, 
-    0xf2, 0x7c, 
-    0xe7, 0x3c, 
-    0xe7, 0x3c, 
-    0xcf, 0x9c, 
-    0x8f, 0x8c, 
-    0xdf, 0xdc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x5e = { image_data_bc_font_ubuntu_24_0x5e,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x5f[48] = {
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0x00, 0x00, 
-    0x00, 0x00, 
-    0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x5f = { image_data_bc_font_ubuntu_24_0x5f,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x60[48] = {
-    0xdf, 0x80, 
-    0x8f, 0x80, 
-    0xc7, 0x80, 
-    0xe3, 0x80, 
-    0xf7, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x60 = { image_data_bc_font_ubuntu_24_0x60,
-    9, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x61[48] = {
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xc0, 0x78, 
-    0xc0, 0x38, 
-    0xff, 0x18, 
-    0xff, 0x98, 
-    0xff, 0x98, 
-    0xe0, 0x18, 
-    0xc0, 0x18, 
-    0x8f, 0x98, 
-    0x9f, 0x98, 
-    0x9f, 0x98, 
-    0x8f, 0x98, 
-    0xc0, 0x18, 
-    0xe0, 0x18, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x61 = { image_data_bc_font_ubuntu_24_0x61,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x62[48] = {
-    0xff, 0xfc, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xc8, 0x3c, 
-    0xc0, 0x1c, 
-    0xc7, 0x8c, 
-    0xcf, 0xcc, 
-    0xcf, 0xe4, 
-    0xcf, 0xe4, 
-    0xcf, 0xe4, 
-    0xcf, 0xe4, 
-    0xcf, 0xe4, 
-    0xcf, 0xcc, 
-    0xcf, 0x8c, 
-    0xc0, 0x1c, 
-    0xe0, 0x7c, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x62 = { image_data_bc_font_ubuntu_24_0x62,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x63[48] = {
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xf8, 0x00, 
-    0xe0, 0x00, 
-    0xc7, 0xe0, 
-    0xcf, 0xe0, 
-    0x9f, 0xe0, 
-    0x9f, 0xe0, 
-    0x9f, 0xe0, 
-    0x9f, 0xe0, 
-    0x9f, 0xe0, 
-    0xcf, 0xe0, 
-    0xc7, 0xe0, 
-    0xe0, 0x00, 
-    0xf8, 0x00, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x63 = { image_data_bc_font_ubuntu_24_0x63,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x64[48] = {
-    0xff, 0xfc, 
-    0xff, 0xcc, 
-    0xff, 0xcc, 
-    0xff, 0xcc, 
-    0xff, 0xcc, 
-    0xff, 0xcc, 
-    0xf0, 0x4c, 
-    0xe0, 0x0c, 
-    0xc7, 0x8c, 
-    0xcf, 0xcc, 
-    0x9f, 0xcc, 
-    0x9f, 0xcc, 
-    0x9f, 0xcc, 
-    0x9f, 0xcc, 
-    0x9f, 0xcc, 
-    0xcf, 0xcc, 
-    0xc7, 0xcc, 
-    0xe0, 0x0c, 
-    0xf8, 0x1c, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x64 = { image_data_bc_font_ubuntu_24_0x64,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x65[48] = {
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xf0, 0x78, 
-    0xe0, 0x18, 
-    0xc7, 0x98, 
-    0xcf, 0xc8, 
-    0x9f, 0xc8, 
-    0x80, 0x08, 
-    0x80, 0x08, 
-    0x9f, 0xf8, 
-    0x9f, 0xf8, 
-    0xcf, 0xf8, 
-    0xc7, 0xd8, 
-    0xe0, 0x18, 
-    0xf0, 0x18, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x65 = { image_data_bc_font_ubuntu_24_0x65,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x66[48] = {
-    0xff, 0x80, 
-    0xf0, 0x00, 
-    0xe0, 0x00, 
-    0xc7, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xc0, 0x80, 
-    0xc0, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x66 = { image_data_bc_font_ubuntu_24_0x66,
-    9, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x67[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xf8, 0x1c, 
-    0xe0, 0x0c, 
-    0xc7, 0xcc, 
-    0xcf, 0xcc, 
-    0x9f, 0xcc, 
-    0x9f, 0xcc, 
-    0x9f, 0xcc, 
-    0x9f, 0xcc, 
-    0x9f, 0xcc, 
-    0x8f, 0xcc, 
-    0xc7, 0x8c, 
-    0xe0, 0x0c, 
-    0xf0, 0x4c, 
-    0xff, 0xcc, 
-    0xdf, 0x9c, 
-    0xc0, 0x1c, 
-    0xc0, 0x7c, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x67 = { image_data_bc_font_ubuntu_24_0x67,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x68[48] = {
-    0xff, 0xfc, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xc0, 0x7c, 
-    0xc0, 0x1c, 
-    0xcf, 0x9c, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x68 = { image_data_bc_font_ubuntu_24_0x68,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x69[24] = {
-    0xfc, 
-    0xcc, 
-    0xcc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x69 = { image_data_bc_font_ubuntu_24_0x69,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x6a[24] = {
-    0xfc, 
-    0xcc, 
-    0xcc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0x8c, 
-    0x1c, 
-    0x3c, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x6a = { image_data_bc_font_ubuntu_24_0x6a,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x6b[48] = {
-    0xff, 0xf8, 
-    0xcf, 0xf8, 
-    0xcf, 0xf8, 
-    0xcf, 0xf8, 
-    0xcf, 0xf8, 
-    0xcf, 0xf8, 
-    0xcf, 0xc8, 
-    0xcf, 0x98, 
-    0xce, 0x38, 
-    0xcc, 0x78, 
-    0xc9, 0xf8, 
-    0xc3, 0xf8, 
-    0xc1, 0xf8, 
-    0xc8, 0x78, 
-    0xce, 0x78, 
-    0xcf, 0x38, 
-    0xcf, 0x98, 
-    0xcf, 0xc8, 
-    0xcf, 0xe0, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x6b = { image_data_bc_font_ubuntu_24_0x6b,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x6c[24] = {
-    0xfe, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xc2, 
-    0xe2, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x6c = { image_data_bc_font_ubuntu_24_0x6c,
-    7, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x6d[72] = {
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xe0, 0x30, 0x3c, 
-    0xc0, 0x00, 0x1c, 
-    0xcf, 0x8f, 0x8c, 
-    0xcf, 0xcf, 0xcc, 
-    0xcf, 0xcf, 0xcc, 
-    0xcf, 0xcf, 0xcc, 
-    0xcf, 0xcf, 0xcc, 
-    0xcf, 0xcf, 0xcc, 
-    0xcf, 0xcf, 0xcc, 
-    0xcf, 0xcf, 0xcc, 
-    0xcf, 0xcf, 0xcc, 
-    0xcf, 0xcf, 0xcc, 
-    0xcf, 0xcf, 0xcc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x6d = { image_data_bc_font_ubuntu_24_0x6d,
-    22, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x6e[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xe0, 0x3c, 
-    0xc0, 0x1c, 
-    0xcf, 0x9c, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x6e = { image_data_bc_font_ubuntu_24_0x6e,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x6f[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xf0, 0x3c, 
-    0xe0, 0x1c, 
-    0xc7, 0x8c, 
-    0xcf, 0xcc, 
-    0x9f, 0xe4, 
-    0x9f, 0xe4, 
-    0x9f, 0xe4, 
-    0x9f, 0xe4, 
-    0x9f, 0xe4, 
-    0xcf, 0xcc, 
-    0xc7, 0x8c, 
-    0xe0, 0x1c, 
-    0xf8, 0x7c, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x6f = { image_data_bc_font_ubuntu_24_0x6f,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x70[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xe0, 0x7c, 
-    0xc0, 0x1c, 
-    0xcf, 0x8c, 
-    0xcf, 0xcc, 
-    0xcf, 0xe4, 
-    0xcf, 0xe4, 
-    0xcf, 0xe4, 
-    0xcf, 0xe4, 
-    0xcf, 0xe4, 
-    0xcf, 0xcc, 
-    0xc7, 0x8c, 
-    0xc0, 0x1c, 
-    0xc8, 0x3c, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xcf, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x70 = { image_data_bc_font_ubuntu_24_0x70,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x71[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xf8, 0x1c, 
-    0xe0, 0x0c, 
-    0xc7, 0xcc, 
-    0xcf, 0xcc, 
-    0x9f, 0xcc, 
-    0x9f, 0xcc, 
-    0x9f, 0xcc, 
-    0x9f, 0xcc, 
-    0x9f, 0xcc, 
-    0xcf, 0xcc, 
-    0xc7, 0x8c, 
-    0xe0, 0x0c, 
-    0xf0, 0x4c, 
-    0xff, 0xcc, 
-    0xff, 0xcc, 
-    0xff, 0xcc, 
-    0xff, 0xcc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x71 = { image_data_bc_font_ubuntu_24_0x71,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x72[48] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xe0, 0x00, 
-    0xc0, 0x00, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x72 = { image_data_bc_font_ubuntu_24_0x72,
-    9, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x73[48] = {
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xe0, 0x60, 
-    0xc0, 0x60, 
-    0x9f, 0x60, 
-    0x9f, 0xe0, 
-    0x8f, 0xe0, 
-    0xc3, 0xe0, 
-    0xe0, 0xe0, 
-    0xf8, 0x20, 
-    0xff, 0x20, 
-    0xff, 0x20, 
-    0xbf, 0x20, 
-    0x80, 0x60, 
-    0xc0, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x73 = { image_data_bc_font_ubuntu_24_0x73,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x74[48] = {
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xc0, 0x40, 
-    0xc0, 0x40, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xc7, 0x40, 
-    0xe0, 0x40, 
-    0xf0, 0x40, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x74 = { image_data_bc_font_ubuntu_24_0x74,
-    10, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x75[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xe7, 0xcc, 
-    0xe0, 0x0c, 
-    0xf8, 0x1c, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x75 = { image_data_bc_font_ubuntu_24_0x75,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x76[48] = {
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0x3f, 0xc0, 
-    0x1f, 0x80, 
-    0x9f, 0x90, 
-    0x9f, 0x90, 
-    0x8f, 0x10, 
-    0xcf, 0x30, 
-    0xcf, 0x30, 
-    0xe6, 0x70, 
-    0xe6, 0x70, 
-    0xe0, 0x70, 
-    0xf0, 0xf0, 
-    0xf0, 0xf0, 
-    0xf9, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x76 = { image_data_bc_font_ubuntu_24_0x76,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x77[72] = {
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0x3f, 0xbf, 0x80, 
-    0x3f, 0x1f, 0x80, 
-    0x9f, 0x1f, 0x20, 
-    0x9f, 0x1f, 0x20, 
-    0x9e, 0x4f, 0x20, 
-    0xce, 0x4e, 0x60, 
-    0xce, 0x4e, 0x60, 
-    0xce, 0x46, 0x60, 
-    0xe4, 0xe4, 0xe0, 
-    0xe4, 0xe4, 0xe0, 
-    0xe0, 0xe0, 0xe0, 
-    0xf1, 0xf1, 0xe0, 
-    0xf1, 0xf1, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x77 = { image_data_bc_font_ubuntu_24_0x77,
-    19, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x78[48] = {
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0x1f, 0x80, 
-    0x9f, 0x90, 
-    0xcf, 0x30, 
-    0xe6, 0x70, 
-    0xe0, 0x70, 
-    0xf0, 0xf0, 
-    0xf9, 0xf0, 
-    0xf0, 0xf0, 
-    0xe0, 0x70, 
-    0xc6, 0x30, 
-    0xcf, 0x30, 
-    0x9f, 0x90, 
-    0x1f, 0x80, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x78 = { image_data_bc_font_ubuntu_24_0x78,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x79[48] = {
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0x3f, 0x80, 
-    0x1f, 0x20, 
-    0x9f, 0x20, 
-    0x9f, 0x20, 
-    0xce, 0x60, 
-    0xce, 0x60, 
-    0xce, 0x60, 
-    0xe4, 0xe0, 
-    0xe4, 0xe0, 
-    0xe4, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf3, 0xe0, 
-    0xe3, 0xe0, 
-    0x07, 0xe0, 
-    0x0f, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x79 = { image_data_bc_font_ubuntu_24_0x79,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x7a[48] = {
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0x80, 0x20, 
-    0x80, 0x20, 
-    0xfe, 0x20, 
-    0xfc, 0x60, 
-    0xfc, 0xe0, 
-    0xf9, 0xe0, 
-    0xf3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe7, 0xe0, 
-    0xcf, 0xe0, 
-    0x8f, 0xe0, 
-    0x80, 0x20, 
-    0x80, 0x20, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x7a = { image_data_bc_font_ubuntu_24_0x7a,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x7b[24] = {
-    0xf8, 
-    0xf0, 
-    0xe3, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xcf, 
-    0x9f, 
-    0x8f, 
-    0xc7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe3, 
-    0xf0, 
-    0xf8, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x7b = { image_data_bc_font_ubuntu_24_0x7b,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x7c[24] = {
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xce, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x7c = { image_data_bc_font_ubuntu_24_0x7c,
-    7, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x7d[24] = {
-    0x1f, 
-    0x0f, 
-    0xc7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xf3, 
-    0xf9, 
-    0xf1, 
-    0xe3, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xc7, 
-    0x0f, 
-    0x1f, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x7d = { image_data_bc_font_ubuntu_24_0x7d,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0x7e[48] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xe3, 0xcc, 
-    0xc1, 0x8c, 
-    0x8c, 0x1c, 
-    0x9e, 0x3c, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0x7e = { image_data_bc_font_ubuntu_24_0x7e,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0xb0[24] = {
-    0xe3, 
-    0xc1, 
-    0x9c, 
-    0x9c, 
-    0x9c, 
-    0xc1, 
-    0xe3, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_24_0xb0 = { image_data_bc_font_ubuntu_24_0xb0,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0xb9[48] = {
-    0xff, 0xe0, 
-    0xce, 0x60, 
-    0xe4, 0xe0, 
-    0xf1, 0xe0, 
-    0xfb, 0xe0, 
-    0xff, 0xe0, 
-    0xe0, 0x60, 
-    0xc0, 0x60, 
-    0x9f, 0x60, 
-    0x9f, 0xe0, 
-    0x8f, 0xe0, 
-    0xc3, 0xe0, 
-    0xe0, 0xe0, 
-    0xf8, 0x20, 
-    0xff, 0x20, 
-    0xff, 0x20, 
-    0xbf, 0x20, 
-    0x80, 0x60, 
-    0xc0, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0xb9 = { image_data_bc_font_ubuntu_24_0xb9,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0xbb[48] = {
-    0xf9, 0xc0, 
-    0xf9, 0xc0, 
-    0xc9, 0xc0, 
-    0xc9, 0xc0, 
-    0xcb, 0xc0, 
-    0xcf, 0xc0, 
-    0xc0, 0x40, 
-    0xc0, 0x40, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xcf, 0xc0, 
-    0xc7, 0x40, 
-    0xe0, 0x40, 
-    0xf0, 0x40, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0xbb = { image_data_bc_font_ubuntu_24_0xbb,
-    10, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0xbe[48] = {
-    0xff, 0xe0, 
-    0xce, 0x60, 
-    0xe4, 0xe0, 
-    0xf1, 0xe0, 
-    0xfb, 0xe0, 
-    0xff, 0xe0, 
-    0x80, 0x20, 
-    0x80, 0x20, 
-    0xfe, 0x20, 
-    0xfc, 0x60, 
-    0xfc, 0xe0, 
-    0xf9, 0xe0, 
-    0xf3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe7, 0xe0, 
-    0xcf, 0xe0, 
-    0x8f, 0xe0, 
-    0x80, 0x20, 
-    0x80, 0x20, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0xbe = { image_data_bc_font_ubuntu_24_0xbe,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0xe1[48] = {
-    0xff, 0x78, 
-    0xfe, 0x38, 
-    0xfc, 0x78, 
-    0xf8, 0xf8, 
-    0xfd, 0xf8, 
-    0xff, 0xf8, 
-    0xc0, 0x78, 
-    0xc0, 0x38, 
-    0xff, 0x18, 
-    0xff, 0x98, 
-    0xff, 0x98, 
-    0xe0, 0x18, 
-    0xc0, 0x18, 
-    0x8f, 0x98, 
-    0x9f, 0x98, 
-    0x9f, 0x98, 
-    0x8f, 0x98, 
-    0xc0, 0x18, 
-    0xe0, 0x18, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_24_0xe1 = { image_data_bc_font_ubuntu_24_0xe1,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0xe8[48] = {
-    0xff, 0xe0, 
-    0xe7, 0x20, 
-    0xf2, 0x60, 
-    0xf8, 0xe0, 
-    0xfd, 0xe0, 
-    0xff, 0xe0, 
-    0xf8, 0x00, 
-    0xe0, 0x00, 
-    0xc7, 0xe0, 
-    0xcf, 0xe0, 
-    0x9f, 0xe0, 
-    0x9f, 0xe0, 
-    0x9f, 0xe0, 
-    0x9f, 0xe0, 
-    0x9f, 0xe0, 
-    0xcf, 0xe0, 
-    0xc7, 0xe0, 
-    0xe0, 0x00, 
-    0xf8, 0x00, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0xe8 = { image_data_bc_font_ubuntu_24_0xe8,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0xe9[48] = {
-    0xff, 0x78, 
-    0xfe, 0x38, 
-    0xfc, 0x78, 
-    0xf8, 0xf8, 
-    0xfd, 0xf8, 
-    0xff, 0xf8, 
-    0xf0, 0x78, 
-    0xe0, 0x18, 
-    0xc7, 0x98, 
-    0xcf, 0xc8, 
-    0x9f, 0xc8, 
-    0x80, 0x08, 
-    0x80, 0x08, 
-    0x9f, 0xf8, 
-    0x9f, 0xf8, 
-    0xcf, 0xf8, 
-    0xc7, 0xd8, 
-    0xe0, 0x18, 
-    0xf0, 0x18, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_24_0xe9 = { image_data_bc_font_ubuntu_24_0xe9,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0xec[48] = {
-    0xe7, 0x38, 
-    0xf2, 0x78, 
-    0xf8, 0xf8, 
-    0xfd, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xf0, 0x78, 
-    0xe0, 0x18, 
-    0xc7, 0x98, 
-    0xcf, 0xc8, 
-    0x9f, 0xc8, 
-    0x80, 0x08, 
-    0x80, 0x08, 
-    0x9f, 0xf8, 
-    0x9f, 0xf8, 
-    0xcf, 0xf8, 
-    0xc7, 0xd8, 
-    0xe0, 0x18, 
-    0xf0, 0x18, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_24_0xec = { image_data_bc_font_ubuntu_24_0xec,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0xed[24] = {
-    0xf4, 
-    0xe0, 
-    0xc4, 
-    0x8c, 
-    0xdc, 
-    0xfc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0xed = { image_data_bc_font_ubuntu_24_0xed,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0xef[48] = {
-    0xff, 0xff, 
-    0xff, 0xcc, 
-    0xff, 0xcc, 
-    0xff, 0xcc, 
-    0xff, 0xcc, 
-    0xff, 0xcd, 
-    0xf0, 0x4f, 
-    0xe0, 0x0f, 
-    0xc7, 0x8f, 
-    0xcf, 0xcf, 
-    0x9f, 0xcf, 
-    0x9f, 0xcf, 
-    0x9f, 0xcf, 
-    0x9f, 0xcf, 
-    0x9f, 0xcf, 
-    0xcf, 0xcf, 
-    0xc7, 0xcf, 
-    0xe0, 0x0f, 
-    0xf8, 0x1f, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_24_0xef = { image_data_bc_font_ubuntu_24_0xef,
-    16, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0xf2[48] = {
-    0xff, 0xfc, 
-    0xf3, 0x9c, 
-    0xf9, 0x3c, 
-    0xfc, 0x7c, 
-    0xfe, 0xfc, 
-    0xff, 0xfc, 
-    0xe0, 0x3c, 
-    0xc0, 0x1c, 
-    0xcf, 0x9c, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0xf2 = { image_data_bc_font_ubuntu_24_0xf2,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0xf8[48] = {
-    0xff, 0x80, 
-    0xce, 0x00, 
-    0xe4, 0x80, 
-    0xf1, 0x80, 
-    0xfb, 0x80, 
-    0xff, 0x80, 
-    0xe0, 0x00, 
-    0xc0, 0x00, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xcf, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_24_0xf8 = { image_data_bc_font_ubuntu_24_0xf8,
-    9, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0xf9[48] = {
-    0xf8, 0x7c, 
-    0xf3, 0x3c, 
-    0xf3, 0x3c, 
-    0xf3, 0x3c, 
-    0xf8, 0x7c, 
-    0xff, 0xfc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xe7, 0xcc, 
-    0xe0, 0x0c, 
-    0xf8, 0x1c, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0xf9 = { image_data_bc_font_ubuntu_24_0xf9,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0xfa[48] = {
-    0xff, 0x7c, 
-    0xfe, 0x3c, 
-    0xfc, 0x7c, 
-    0xf8, 0xfc, 
-    0xfd, 0xfc, 
-    0xff, 0xfc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xcf, 0xcc, 
-    0xe7, 0xcc, 
-    0xe0, 0x0c, 
-    0xf8, 0x1c, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_24_0xfa = { image_data_bc_font_ubuntu_24_0xfa,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_24_0xfd[48] = {
-    0xfe, 0xe0, 
-    0xfc, 0x60, 
-    0xf8, 0xe0, 
-    0xf1, 0xe0, 
-    0xfb, 0xe0, 
-    0xff, 0xe0, 
-    0x3f, 0x80, 
-    0x1f, 0x20, 
-    0x9f, 0x20, 
-    0x9f, 0x20, 
-    0xce, 0x60, 
-    0xce, 0x60, 
-    0xce, 0x60, 
-    0xe4, 0xe0, 
-    0xe4, 0xe0, 
-    0xe4, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf3, 0xe0, 
-    0xe3, 0xe0, 
-    0x07, 0xe0, 
-    0x0f, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_24_0xfd = { image_data_bc_font_ubuntu_24_0xfd,
-    11, 24/*, 8*/};
-#endif
-
-
-static const bc_font_char_t bc_font_ubuntu_24_array[] = {
-
-#if (0x0 == 0x0)
-  // character: ' '
-  {0x20, &bc_font_ubuntu_24_0x20},
-#else
-  // character: ' ' == ''
-  {0x20, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '!'
-  {0x21, &bc_font_ubuntu_24_0x21},
-#else
-  // character: '!' == ''
-  {0x21, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '"'
-  {0x22, &bc_font_ubuntu_24_0x22},
-#else
-  // character: '"' == ''
-  {0x22, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '#'
-  {0x23, &bc_font_ubuntu_24_0x23},
-#else
-  // character: '#' == ''
-  {0x23, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '$'
-  {0x24, &bc_font_ubuntu_24_0x24},
-#else
-  // character: '$' == ''
-  {0x24, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '%'
-  {0x25, &bc_font_ubuntu_24_0x25},
-#else
-  // character: '%' == ''
-  {0x25, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '&'
-  {0x26, &bc_font_ubuntu_24_0x26},
-#else
-  // character: '&' == ''
-  {0x26, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '''
-  {0x27, &bc_font_ubuntu_24_0x27},
-#else
-  // character: ''' == ''
-  {0x27, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '('
-  {0x28, &bc_font_ubuntu_24_0x28},
-#else
-  // character: '(' == ''
-  {0x28, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ')'
-  {0x29, &bc_font_ubuntu_24_0x29},
-#else
-  // character: ')' == ''
-  {0x29, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '*'
-  {0x2a, &bc_font_ubuntu_24_0x2a},
-#else
-  // character: '*' == ''
-  {0x2a, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '+'
-  {0x2b, &bc_font_ubuntu_24_0x2b},
-#else
-  // character: '+' == ''
-  {0x2b, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ','
-  {0x2c, &bc_font_ubuntu_24_0x2c},
-#else
-  // character: ',' == ''
-  {0x2c, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '-'
-  {0x2d, &bc_font_ubuntu_24_0x2d},
-#else
-  // character: '-' == ''
-  {0x2d, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '.'
-  {0x2e, &bc_font_ubuntu_24_0x2e},
-#else
-  // character: '.' == ''
-  {0x2e, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '/'
-  {0x2f, &bc_font_ubuntu_24_0x2f},
-#else
-  // character: '/' == ''
-  {0x2f, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '0'
-  {0x30, &bc_font_ubuntu_24_0x30},
-#else
-  // character: '0' == ''
-  {0x30, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '1'
-  {0x31, &bc_font_ubuntu_24_0x31},
-#else
-  // character: '1' == ''
-  {0x31, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '2'
-  {0x32, &bc_font_ubuntu_24_0x32},
-#else
-  // character: '2' == ''
-  {0x32, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '3'
-  {0x33, &bc_font_ubuntu_24_0x33},
-#else
-  // character: '3' == ''
-  {0x33, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '4'
-  {0x34, &bc_font_ubuntu_24_0x34},
-#else
-  // character: '4' == ''
-  {0x34, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '5'
-  {0x35, &bc_font_ubuntu_24_0x35},
-#else
-  // character: '5' == ''
-  {0x35, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '6'
-  {0x36, &bc_font_ubuntu_24_0x36},
-#else
-  // character: '6' == ''
-  {0x36, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '7'
-  {0x37, &bc_font_ubuntu_24_0x37},
-#else
-  // character: '7' == ''
-  {0x37, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '8'
-  {0x38, &bc_font_ubuntu_24_0x38},
-#else
-  // character: '8' == ''
-  {0x38, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '9'
-  {0x39, &bc_font_ubuntu_24_0x39},
-#else
-  // character: '9' == ''
-  {0x39, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ':'
-  {0x3a, &bc_font_ubuntu_24_0x3a},
-#else
-  // character: ':' == ''
-  {0x3a, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ';'
-  {0x3b, &bc_font_ubuntu_24_0x3b},
-#else
-  // character: ';' == ''
-  {0x3b, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '<'
-  {0x3c, &bc_font_ubuntu_24_0x3c},
-#else
-  // character: '<' == ''
-  {0x3c, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '='
-  {0x3d, &bc_font_ubuntu_24_0x3d},
-#else
-  // character: '=' == ''
-  {0x3d, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '>'
-  {0x3e, &bc_font_ubuntu_24_0x3e},
-#else
-  // character: '>' == ''
-  {0x3e, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '?'
-  {0x3f, &bc_font_ubuntu_24_0x3f},
-#else
-  // character: '?' == ''
-  {0x3f, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\x0040'
-  {0x40, &bc_font_ubuntu_24_0x40},
-#else
-  // character: '\x0040' == ''
-  {0x40, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'A'
-  {0x41, &bc_font_ubuntu_24_0x41},
-#else
-  // character: 'A' == ''
-  {0x41, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'B'
-  {0x42, &bc_font_ubuntu_24_0x42},
-#else
-  // character: 'B' == ''
-  {0x42, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'C'
-  {0x43, &bc_font_ubuntu_24_0x43},
-#else
-  // character: 'C' == ''
-  {0x43, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'D'
-  {0x44, &bc_font_ubuntu_24_0x44},
-#else
-  // character: 'D' == ''
-  {0x44, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'E'
-  {0x45, &bc_font_ubuntu_24_0x45},
-#else
-  // character: 'E' == ''
-  {0x45, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'F'
-  {0x46, &bc_font_ubuntu_24_0x46},
-#else
-  // character: 'F' == ''
-  {0x46, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'G'
-  {0x47, &bc_font_ubuntu_24_0x47},
-#else
-  // character: 'G' == ''
-  {0x47, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'H'
-  {0x48, &bc_font_ubuntu_24_0x48},
-#else
-  // character: 'H' == ''
-  {0x48, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'I'
-  {0x49, &bc_font_ubuntu_24_0x49},
-#else
-  // character: 'I' == ''
-  {0x49, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'J'
-  {0x4a, &bc_font_ubuntu_24_0x4a},
-#else
-  // character: 'J' == ''
-  {0x4a, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'K'
-  {0x4b, &bc_font_ubuntu_24_0x4b},
-#else
-  // character: 'K' == ''
-  {0x4b, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'L'
-  {0x4c, &bc_font_ubuntu_24_0x4c},
-#else
-  // character: 'L' == ''
-  {0x4c, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'M'
-  {0x4d, &bc_font_ubuntu_24_0x4d},
-#else
-  // character: 'M' == ''
-  {0x4d, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'N'
-  {0x4e, &bc_font_ubuntu_24_0x4e},
-#else
-  // character: 'N' == ''
-  {0x4e, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'O'
-  {0x4f, &bc_font_ubuntu_24_0x4f},
-#else
-  // character: 'O' == ''
-  {0x4f, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'P'
-  {0x50, &bc_font_ubuntu_24_0x50},
-#else
-  // character: 'P' == ''
-  {0x50, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Q'
-  {0x51, &bc_font_ubuntu_24_0x51},
-#else
-  // character: 'Q' == ''
-  {0x51, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'R'
-  {0x52, &bc_font_ubuntu_24_0x52},
-#else
-  // character: 'R' == ''
-  {0x52, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'S'
-  {0x53, &bc_font_ubuntu_24_0x53},
-#else
-  // character: 'S' == ''
-  {0x53, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'T'
-  {0x54, &bc_font_ubuntu_24_0x54},
-#else
-  // character: 'T' == ''
-  {0x54, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'U'
-  {0x55, &bc_font_ubuntu_24_0x55},
-#else
-  // character: 'U' == ''
-  {0x55, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'V'
-  {0x56, &bc_font_ubuntu_24_0x56},
-#else
-  // character: 'V' == ''
-  {0x56, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'W'
-  {0x57, &bc_font_ubuntu_24_0x57},
-#else
-  // character: 'W' == ''
-  {0x57, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'X'
-  {0x58, &bc_font_ubuntu_24_0x58},
-#else
-  // character: 'X' == ''
-  {0x58, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Y'
-  {0x59, &bc_font_ubuntu_24_0x59},
-#else
-  // character: 'Y' == ''
-  {0x59, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Z'
-  {0x5a, &bc_font_ubuntu_24_0x5a},
-#else
-  // character: 'Z' == ''
-  {0x5a, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '['
-  {0x5b, &bc_font_ubuntu_24_0x5b},
-#else
-  // character: '[' == ''
-  {0x5b, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\'
-  {0x5c, &bc_font_ubuntu_24_0x5c},
-#else
-  // character: '\' == ''
-  {0x5c, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ']'
-  {0x5d, &bc_font_ubuntu_24_0x5d},
-#else
-  // character: ']' == ''
-  {0x5d, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '^'
-  {0x5e, &bc_font_ubuntu_24_0x5e},
-#else
-  // character: '^' == ''
-  {0x5e, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '_'
-  {0x5f, &bc_font_ubuntu_24_0x5f},
-#else
-  // character: '_' == ''
-  {0x5f, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '`'
-  {0x60, &bc_font_ubuntu_24_0x60},
-#else
-  // character: '`' == ''
-  {0x60, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'a'
-  {0x61, &bc_font_ubuntu_24_0x61},
-#else
-  // character: 'a' == ''
-  {0x61, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'b'
-  {0x62, &bc_font_ubuntu_24_0x62},
-#else
-  // character: 'b' == ''
-  {0x62, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'c'
-  {0x63, &bc_font_ubuntu_24_0x63},
-#else
-  // character: 'c' == ''
-  {0x63, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'd'
-  {0x64, &bc_font_ubuntu_24_0x64},
-#else
-  // character: 'd' == ''
-  {0x64, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'e'
-  {0x65, &bc_font_ubuntu_24_0x65},
-#else
-  // character: 'e' == ''
-  {0x65, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'f'
-  {0x66, &bc_font_ubuntu_24_0x66},
-#else
-  // character: 'f' == ''
-  {0x66, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'g'
-  {0x67, &bc_font_ubuntu_24_0x67},
-#else
-  // character: 'g' == ''
-  {0x67, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'h'
-  {0x68, &bc_font_ubuntu_24_0x68},
-#else
-  // character: 'h' == ''
-  {0x68, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'i'
-  {0x69, &bc_font_ubuntu_24_0x69},
-#else
-  // character: 'i' == ''
-  {0x69, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'j'
-  {0x6a, &bc_font_ubuntu_24_0x6a},
-#else
-  // character: 'j' == ''
-  {0x6a, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'k'
-  {0x6b, &bc_font_ubuntu_24_0x6b},
-#else
-  // character: 'k' == ''
-  {0x6b, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'l'
-  {0x6c, &bc_font_ubuntu_24_0x6c},
-#else
-  // character: 'l' == ''
-  {0x6c, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'm'
-  {0x6d, &bc_font_ubuntu_24_0x6d},
-#else
-  // character: 'm' == ''
-  {0x6d, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'n'
-  {0x6e, &bc_font_ubuntu_24_0x6e},
-#else
-  // character: 'n' == ''
-  {0x6e, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'o'
-  {0x6f, &bc_font_ubuntu_24_0x6f},
-#else
-  // character: 'o' == ''
-  {0x6f, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'p'
-  {0x70, &bc_font_ubuntu_24_0x70},
-#else
-  // character: 'p' == ''
-  {0x70, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'q'
-  {0x71, &bc_font_ubuntu_24_0x71},
-#else
-  // character: 'q' == ''
-  {0x71, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'r'
-  {0x72, &bc_font_ubuntu_24_0x72},
-#else
-  // character: 'r' == ''
-  {0x72, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 's'
-  {0x73, &bc_font_ubuntu_24_0x73},
-#else
-  // character: 's' == ''
-  {0x73, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 't'
-  {0x74, &bc_font_ubuntu_24_0x74},
-#else
-  // character: 't' == ''
-  {0x74, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'u'
-  {0x75, &bc_font_ubuntu_24_0x75},
-#else
-  // character: 'u' == ''
-  {0x75, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'v'
-  {0x76, &bc_font_ubuntu_24_0x76},
-#else
-  // character: 'v' == ''
-  {0x76, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'w'
-  {0x77, &bc_font_ubuntu_24_0x77},
-#else
-  // character: 'w' == ''
-  {0x77, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'x'
-  {0x78, &bc_font_ubuntu_24_0x78},
-#else
-  // character: 'x' == ''
-  {0x78, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'y'
-  {0x79, &bc_font_ubuntu_24_0x79},
-#else
-  // character: 'y' == ''
-  {0x79, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'z'
-  {0x7a, &bc_font_ubuntu_24_0x7a},
-#else
-  // character: 'z' == ''
-  {0x7a, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '{'
-  {0x7b, &bc_font_ubuntu_24_0x7b},
-#else
-  // character: '{' == ''
-  {0x7b, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '|'
-  {0x7c, &bc_font_ubuntu_24_0x7c},
-#else
-  // character: '|' == ''
-  {0x7c, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '}'
-  {0x7d, &bc_font_ubuntu_24_0x7d},
-#else
-  // character: '}' == ''
-  {0x7d, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '~'
-  {0x7e, &bc_font_ubuntu_24_0x7e},
-#else
-  // character: '~' == ''
-  {0x7e, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '°'
-  {0xb0, &bc_font_ubuntu_24_0xb0},
-#else
-  // character: '°' == ''
-  {0xb0, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'š'
-  {0xb9, &bc_font_ubuntu_24_0xb9},
-#else
-  // character: 'š' == ''
-  {0xb9, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ť'
-  {0xbb, &bc_font_ubuntu_24_0xbb},
-#else
-  // character: 'ť' == ''
-  {0xbb, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ž'
-  {0xbe, &bc_font_ubuntu_24_0xbe},
-#else
-  // character: 'ž' == ''
-  {0xbe, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'á'
-  {0xe1, &bc_font_ubuntu_24_0xe1},
-#else
-  // character: 'á' == ''
-  {0xe1, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'č'
-  {0xe8, &bc_font_ubuntu_24_0xe8},
-#else
-  // character: 'č' == ''
-  {0xe8, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'é'
-  {0xe9, &bc_font_ubuntu_24_0xe9},
-#else
-  // character: 'é' == ''
-  {0xe9, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ě'
-  {0xec, &bc_font_ubuntu_24_0xec},
-#else
-  // character: 'ě' == ''
-  {0xec, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'í'
-  {0xed, &bc_font_ubuntu_24_0xed},
-#else
-  // character: 'í' == ''
-  {0xed, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ď'
-  {0xef, &bc_font_ubuntu_24_0xef},
-#else
-  // character: 'ď' == ''
-  {0xef, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ň'
-  {0xf2, &bc_font_ubuntu_24_0xf2},
-#else
-  // character: 'ň' == ''
-  {0xf2, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ř'
-  {0xf8, &bc_font_ubuntu_24_0xf8},
-#else
-  // character: 'ř' == ''
-  {0xf8, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ů'
-  {0xf9, &bc_font_ubuntu_24_0xf9},
-#else
-  // character: 'ů' == ''
-  {0xf9, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ú'
-  {0xfa, &bc_font_ubuntu_24_0xfa},
-#else
-  // character: 'ú' == ''
-  {0xfa, &bc_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ý'
-  {0xfd, &bc_font_ubuntu_24_0xfd}
-#else
-  // character: 'ý' == ''
-  {0xfd, &bc_font_ubuntu_24_0x}
-#endif
-
-};
-
-
-const bc_font_t bc_font_ubuntu_24 = { 110, bc_font_ubuntu_24_array };
+// Glyphs are compressed by sdk/tools/font/bc-font-rle.py
+
+static const uint8_t bc_font_ubuntu_24_rle_data[2659] = {
+    // ' '
+    0xff, 0xff, 0xff, 0xff, 0xf9,
+    // '!'
+    0xf1, 0x2f, 0xff, 0xff, 0x72, 0xc2, 0xf4, 0x2f, 0xf1,
+    // '"'
+    0x22, 0x22, 0xff, 0xf9, 0x22, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    // '#'
+    0xff, 0x72, 0x52, 0xff, 0x81, 0x11, 0x41, 0x11, 0x33, 0x25, 0x22, 0xf3, 0x32, 0x52, 0x2f, 0x51, 0x61, 0xa1, 0x61, 0xf5, 0x22, 0x52, 0x3f, 0x32, 0x25, 0x23, 0x31, 0x11, 0x41, 0x11, 0xff, 0x82, 0x52, 0xff, 0xff, 0x90,
+    // '$'
+    0x62, 0xff, 0x82, 0x23, 0x52, 0xb1, 0x26, 0x71, 0x61, 0xf5, 0x1b, 0x12, 0x2a, 0x22, 0x2a, 0x22, 0x2a, 0x22, 0x1b, 0x12, 0x1b, 0x1f, 0x42, 0x61, 0x76, 0x21, 0x31, 0x81, 0x54, 0x22, 0xff, 0x82, 0xf5,
+    // '%'
+    0xff, 0xf0, 0x48, 0x26, 0x14, 0x16, 0x11, 0x15, 0x12, 0x22, 0x14, 0x11, 0x18, 0x12, 0x1f, 0xb1, 0x11, 0xf2, 0x11, 0x1f, 0xf1, 0x12, 0x13, 0x11, 0x11, 0x44, 0x12, 0x22, 0x23, 0x14, 0x14, 0x14, 0x13, 0x22, 0x22, 0x14, 0x41, 0x11, 0x13, 0x12, 0x1f, 0xf1, 0x11, 0x1f, 0x21, 0x11, 0xfb, 0x12, 0x18, 0x11, 0x14, 0x12, 0x22, 0x15, 0x11, 0x16, 0x14, 0x16, 0x28, 0x4f, 0xff, 0xff, 0xc0,
+    // '&'
+    0xff, 0x74, 0xb1, 0x41, 0x91, 0x22, 0x21, 0xa1, 0x21, 0xff, 0xc1, 0x11, 0x21, 0x11, 0xb2, 0x11, 0xe1, 0x92, 0x41, 0x42, 0x53, 0x21, 0x71, 0x11, 0x31, 0x41, 0x11, 0x91, 0x11, 0x21, 0xb1, 0x11, 0x71, 0xd1, 0x26, 0x11, 0x11, 0x42, 0x61, 0x11, 0x11, 0x56, 0x32, 0xff, 0xff, 0x50,
+    // "'"
+    0x22, 0xff, 0x42, 0xff, 0xff, 0xff, 0xe0,
+    // '('
+    0x61, 0x61, 0x61, 0x11, 0xc1, 0x11, 0xf5, 0x11, 0x1f, 0xff, 0xf9, 0x11, 0x1f, 0x71, 0x11, 0xe1, 0x11, 0x61, 0x81, 0x10,
+    // ')'
+    0x11, 0x81, 0x61, 0x11, 0xe1, 0x11, 0xf7, 0x11, 0x1f, 0xff, 0xf9, 0x11, 0x1f, 0x51, 0x11, 0xc1, 0x11, 0x61, 0x61, 0x60,
+    // '*'
+    0xfe, 0x3f, 0x32, 0x52, 0x52, 0x21, 0x52, 0x11, 0x32, 0x51, 0x11, 0x11, 0x71, 0x31, 0x61, 0x51, 0x51, 0x11, 0x11, 0x11, 0x61, 0x31, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    // '+'
+    0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0x35, 0x25, 0xf1, 0x52, 0x5f, 0xff, 0xf3, 0x2f, 0xff, 0xff, 0x10,
+    // ','
+    0xff, 0xff, 0xff, 0x82, 0xf8, 0x13, 0x1b, 0x23,
+    // '-'
+    0xff, 0xff, 0xfe, 0x6a, 0x6f, 0xff, 0xff, 0x60,
+    // '.'
+    0xff, 0xff, 0xff, 0x73, 0xf0, 0x3f, 0xb0,
+    // '/'
+    0x82, 0x71, 0x11, 0xfb, 0x11, 0x1f, 0x11, 0x11, 0xfb, 0x11, 0x1f, 0x11, 0xb1, 0xf1, 0x11, 0x1f, 0xb1, 0x11, 0xf1, 0x11, 0x1f, 0xd1, 0x81, 0x90,
+    // '0'
+    0xff, 0x34, 0x82, 0x42, 0x51, 0x24, 0x21, 0x61, 0x41, 0xf4, 0x11, 0x16, 0x11, 0x1f, 0xff, 0xff, 0xb1, 0x11, 0x61, 0x11, 0xf4, 0x14, 0x16, 0x12, 0x42, 0x15, 0x24, 0x28, 0x4f, 0xff, 0xf1,
+    // '1'
+    0xff, 0x52, 0xb1, 0xb2, 0xb1, 0x21, 0xc1, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x2f, 0xff, 0xf1,
+    // '2'
+    0xff, 0x26, 0x71, 0x61, 0x51, 0x24, 0x21, 0x43, 0x41, 0xff, 0xb1, 0x11, 0xa1, 0xc1, 0x21, 0x91, 0x21, 0x91, 0x21, 0x91, 0x21, 0xc1, 0xa1, 0x11, 0xa1, 0x11, 0xd9, 0xf2, 0xbf, 0xff, 0xc0,
+    // '3'
+    0xff, 0x15, 0x72, 0x52, 0x51, 0x15, 0x21, 0x51, 0x51, 0xff, 0xb1, 0x11, 0x74, 0xf9, 0x42, 0x1b, 0x12, 0x1b, 0x1f, 0xf3, 0x16, 0x21, 0x14, 0x67, 0x17, 0x25, 0x7f, 0xff, 0xf1,
+    // '4'
+    0xff, 0x63, 0xf9, 0x1c, 0x1c, 0x12, 0x19, 0x12, 0x1c, 0x1a, 0x11, 0x1a, 0x1f, 0x01, 0xa1, 0x11, 0xd6, 0x22, 0xf1, 0x82, 0x2f, 0xff, 0x72, 0xff, 0xfe,
+    // '5'
+    0xff, 0x27, 0xf8, 0x5f, 0xff, 0x31, 0x22, 0xe2, 0x74, 0x31, 0xa2, 0x21, 0xb1, 0xff, 0xf3, 0x16, 0x11, 0x15, 0x67, 0x16, 0x26, 0x6f, 0xff, 0xf1,
+    // '6'
+    0xff, 0x64, 0x82, 0xb1, 0x24, 0x61, 0x12, 0x91, 0x11, 0xf9, 0x11, 0x68, 0x15, 0x26, 0x6e, 0x11, 0x1f, 0xff, 0x01, 0x11, 0x51, 0x81, 0x31, 0x21, 0x41, 0x23, 0x21, 0x61, 0x51, 0x85, 0xff, 0xff, 0x00,
+    // '7'
+    0xfe, 0xbf, 0x29, 0xd1, 0x11, 0xa1, 0x11, 0xf9, 0x11, 0x1f, 0x91, 0x11, 0xf9, 0x11, 0x1f, 0xff, 0x71, 0x11, 0xff, 0x92, 0xff, 0xff, 0x40,
+    // '8'
+    0xff, 0x26, 0x62, 0x62, 0x66, 0x51, 0x11, 0x61, 0x11, 0xff, 0x01, 0x12, 0x51, 0x11, 0x62, 0x12, 0x11, 0x42, 0x31, 0x21, 0x61, 0x12, 0x32, 0x41, 0x11, 0x22, 0x61, 0x11, 0x52, 0x11, 0xff, 0x21, 0x61, 0x41, 0x26, 0x21, 0x32, 0x62, 0x66, 0xff, 0xff, 0x00,
+    // '9'
+    0xff, 0x25, 0x72, 0x51, 0x84, 0x21, 0x41, 0x11, 0x41, 0xe1, 0x11, 0xff, 0x11, 0x11, 0xe6, 0x62, 0x51, 0x86, 0xf0, 0x1a, 0x1c, 0x12, 0x19, 0x12, 0x16, 0x42, 0x1b, 0x28, 0x4f, 0xff, 0xf4,
+    // ':'
+    0xff, 0x73, 0xf0, 0x3f, 0xf9, 0x3f, 0x03, 0xfb,
+    // ';'
+    0xff, 0x73, 0xf0, 0x3f, 0xfa, 0x2f, 0x81, 0x31, 0xb2, 0x30,
+    // '<'
+    0xff, 0xff, 0xff, 0x51, 0xb2, 0x11, 0x73, 0x22, 0x52, 0x32, 0x52, 0x23, 0x92, 0xc2, 0xa2, 0x23, 0x92, 0x32, 0x93, 0x22, 0xa2, 0x11, 0xc1, 0xff, 0xff, 0xfb,
+    // '='
+    0xff, 0xff, 0xff, 0xf9, 0xbf, 0x2b, 0xff, 0x1b, 0xf2, 0xbf, 0xff, 0xff, 0xff, 0x80,
+    // '>'
+    0xff, 0xff, 0xfb, 0x1c, 0x11, 0x2a, 0x22, 0x39, 0x23, 0x29, 0x32, 0x2a, 0x2c, 0x29, 0x32, 0x25, 0x23, 0x25, 0x22, 0x37, 0x11, 0x2b, 0x1f, 0xff, 0xff, 0xf5,
+    // '?'
+    0xf7, 0x54, 0x15, 0x13, 0x52, 0x17, 0x1f, 0xe1, 0x11, 0x61, 0x11, 0x61, 0x11, 0x61, 0xb1, 0xf2, 0x2f, 0x32, 0xfd, 0x2f, 0xff, 0x00,
+    // '@'
+    0xff, 0xf9, 0x7e, 0x27, 0x2b, 0x13, 0x62, 0x19, 0x12, 0x26, 0x12, 0x17, 0x12, 0x19, 0x12, 0x18, 0x14, 0x61, 0x1d, 0x28, 0x11, 0x14, 0x11, 0x15, 0x4f, 0x11, 0xf9, 0x1f, 0xff, 0xff, 0x21, 0xb1, 0x11, 0xa1, 0x41, 0x11, 0x54, 0x22, 0xd2, 0x41, 0x41, 0x81, 0x44, 0x14, 0x71, 0x21, 0xf5, 0x12, 0x2f, 0x41, 0x37, 0xd3, 0xf8, 0x77,
+    // 'A'
+    0xff, 0x63, 0xff, 0xb1, 0x11, 0x11, 0xf9, 0x15, 0x1a, 0x11, 0x1f, 0x91, 0x11, 0x31, 0x11, 0xf5, 0x1f, 0x25, 0x21, 0xf3, 0x11, 0x91, 0x1f, 0xf1, 0x11, 0x19, 0x11, 0x3b, 0x2f, 0xff, 0xf0,
+    // 'B'
+    0xff, 0x28, 0xf0, 0x27, 0x62, 0x1c, 0x1f, 0xfe, 0x11, 0x16, 0x61, 0x1e, 0x17, 0x62, 0x1c, 0x21, 0x1f, 0xff, 0xb2, 0x11, 0x56, 0x21, 0xd1, 0x59, 0xff, 0xff, 0x40,
+    // 'C'
+    0xff, 0x67, 0x62, 0x71, 0x41, 0x26, 0x51, 0x21, 0x62, 0x51, 0xb1, 0xf1, 0x1f, 0xff, 0xff, 0xc1, 0x11, 0xf0, 0x1c, 0x12, 0x16, 0x24, 0x12, 0x67, 0x27, 0x17, 0x7f, 0xff, 0xf2,
+    // 'D'
+    0xff, 0x68, 0xf2, 0x38, 0x63, 0x1d, 0x22, 0x1e, 0x1f, 0x41, 0xe1, 0xff, 0xff, 0xf9, 0x1f, 0x31, 0xd1, 0xe2, 0x21, 0x66, 0x31, 0xd3, 0x68, 0xff, 0xff, 0xf0,
+    // 'E'
+    0xff, 0x0a, 0xf5, 0x8f, 0xff, 0xf2, 0x8f, 0x58, 0xff, 0xff, 0xf1, 0x9f, 0x2b, 0xff, 0xfc,
+    // 'F'
+    0xfd, 0xaf, 0x38, 0xff, 0xfc, 0x7f, 0x47, 0xff, 0xff, 0xff, 0x52, 0xff, 0xff, 0x10,
+    // 'G'
+    0xff, 0x87, 0x72, 0x71, 0x51, 0x26, 0x11, 0x41, 0x21, 0x61, 0x71, 0xc1, 0xf2, 0x1f, 0xff, 0xb2, 0xff, 0x51, 0x11, 0xf1, 0x1d, 0x12, 0x1d, 0x12, 0x68, 0x27, 0x18, 0x7f, 0xff, 0xf7,
+    // 'H'
+    0xff, 0x62, 0x92, 0xff, 0xff, 0xff, 0xf3, 0x9f, 0xa9, 0xff, 0xff, 0xff, 0xff, 0x52, 0x92, 0xff, 0xff, 0xa0,
+    // 'I'
+    0xe2, 0xff, 0xff, 0xff, 0xa2, 0xfb,
+    // 'J'
+    0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x51, 0x11, 0x21, 0x15, 0x52, 0x52, 0x55, 0xff, 0xf8,
+    // 'K'
+    0xff, 0x22, 0x72, 0xc1, 0x11, 0xb1, 0x11, 0xb1, 0x11, 0xb1, 0x11, 0xb1, 0x11, 0xb1, 0x11, 0xb1, 0x11, 0xe1, 0xc1, 0x22, 0xb1, 0x31, 0xb1, 0x31, 0xb1, 0x31, 0xb1, 0x31, 0xb1, 0xf0, 0x12, 0x1c, 0x12, 0x12, 0x28, 0x3f, 0xff, 0xf0,
+    // 'L'
+    0xfb, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x8e, 0xaf, 0xff, 0x30,
+    // 'M'
+    0xff, 0xc2, 0xc2, 0x61, 0xa1, 0xfe, 0x18, 0x19, 0x1a, 0x1a, 0x16, 0x1b, 0x18, 0x16, 0x11, 0x13, 0x14, 0x13, 0x11, 0x17, 0x16, 0x1e, 0x12, 0x1f, 0xf5, 0x14, 0x1f, 0x12, 0xff, 0x71, 0x21, 0xf2, 0x2f, 0xf0, 0x2e, 0x2f, 0xff, 0xff, 0x60,
+    // 'N'
+    0xff, 0x62, 0x92, 0x61, 0xf2, 0x1f, 0x21, 0xe1, 0xf2, 0x11, 0x1f, 0x21, 0xe1, 0x21, 0xe1, 0xf2, 0x11, 0x1f, 0x21, 0xe1, 0xf2, 0x11, 0x1f, 0x01, 0xff, 0x41, 0xf2, 0x15, 0x2a, 0x1f, 0xff, 0xfa,
+    // 'O'
+    0xff, 0xc6, 0xa2, 0x62, 0x71, 0x26, 0x21, 0x51, 0x21, 0x61, 0x21, 0x61, 0x81, 0x51, 0xe1, 0x41, 0xa1, 0xff, 0xff, 0xf3, 0x1a, 0x14, 0x1e, 0x15, 0x18, 0x16, 0x12, 0x16, 0x12, 0x15, 0x12, 0x62, 0x17, 0x26, 0x2a, 0x6f, 0xff, 0xff, 0x30,
+    // 'P'
+    0xff, 0x28, 0xf0, 0x27, 0x62, 0x1c, 0x12, 0x1c, 0x1f, 0xfe, 0x1d, 0x12, 0x15, 0x62, 0x1c, 0x27, 0x6f, 0xff, 0xff, 0x72, 0xff, 0xff, 0xb0,
+    // 'Q'
+    0xff, 0xe7, 0xa2, 0x72, 0x71, 0x35, 0x31, 0x51, 0x22, 0x52, 0x21, 0x61, 0x91, 0x51, 0xf0, 0x14, 0x1b, 0x1f, 0xff, 0xff, 0x71, 0xb1, 0x41, 0xf0, 0x15, 0x19, 0x16, 0x12, 0x25, 0x22, 0x15, 0x13, 0x52, 0x27, 0x26, 0x2b, 0x32, 0x1f, 0x11, 0x12, 0xf1, 0x12, 0x3e, 0x2f, 0x43, 0x30,
+    // 'R'
+    0xff, 0x28, 0xf0, 0x27, 0x62, 0x1c, 0x21, 0x1f, 0xff, 0xb2, 0x11, 0x56, 0x21, 0xd1, 0x75, 0xf0, 0x11, 0x1f, 0x01, 0xc1, 0xf0, 0x11, 0x1f, 0x01, 0xc1, 0x42, 0x92, 0xff, 0xff, 0x00,
+    // 'S'
+    0xff, 0x06, 0x52, 0x61, 0x31, 0x25, 0x11, 0x51, 0x51, 0xf4, 0x1a, 0x12, 0x29, 0x13, 0x19, 0x22, 0x29, 0x22, 0x29, 0x22, 0x1a, 0x1f, 0xf0, 0x26, 0x16, 0x62, 0x12, 0x26, 0x25, 0x6f, 0xff, 0xb0,
+    // 'T'
+    0xf9, 0xcc, 0x52, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0xff, 0xf8,
+    // 'U'
+    0xff, 0x62, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x11, 0x17, 0x11, 0x17, 0x15, 0x18, 0x12, 0x52, 0x17, 0x25, 0x2a, 0x5f, 0xff, 0xfe,
+    // 'V'
+    0xff, 0x22, 0xc3, 0x11, 0xa1, 0x11, 0xff, 0x31, 0x11, 0x81, 0x11, 0xf6, 0x16, 0x16, 0x1a, 0x1f, 0x61, 0x11, 0x41, 0x11, 0xf8, 0x11, 0x12, 0x11, 0x1f, 0xc2, 0xc1, 0x41, 0xfc, 0x12, 0x1d, 0x2f, 0xff, 0xfb,
+    // 'W'
+    0xff, 0xf2, 0x2f, 0x22, 0xfc, 0x17, 0x26, 0x14, 0x18, 0x1a, 0x1f, 0xf5, 0x1f, 0x51, 0x31, 0xb1, 0x11, 0xd1, 0x11, 0xf1, 0x1f, 0x11, 0x11, 0x11, 0xff, 0x81, 0x11, 0x71, 0x11, 0x81, 0x51, 0x31, 0x51, 0xff, 0x21, 0x11, 0x71, 0xa1, 0x91, 0x31, 0xff, 0x23, 0x73, 0xff, 0xff, 0xff, 0x70,
+    // 'X'
+    0xff, 0x13, 0x83, 0x11, 0xc1, 0x21, 0x11, 0x61, 0x11, 0x61, 0x41, 0x71, 0x81, 0x61, 0x11, 0x21, 0x11, 0x81, 0x12, 0xf1, 0x1a, 0x12, 0x1b, 0x12, 0x1a, 0x14, 0x1b, 0x2a, 0x11, 0x12, 0x11, 0x16, 0x18, 0x17, 0x14, 0x16, 0x11, 0x16, 0x11, 0x12, 0x1c, 0x11, 0x38, 0x3f, 0xff, 0xf0,
+    // 'Y'
+    0xfd, 0x2a, 0x31, 0x18, 0x11, 0x13, 0x16, 0x14, 0x1a, 0x13, 0x11, 0x14, 0x11, 0x1f, 0x41, 0x11, 0x21, 0x11, 0x92, 0xa1, 0x41, 0x91, 0x21, 0xff, 0xff, 0xff, 0xf4, 0x2f, 0xff, 0xf2,
+    // 'Z'
+    0xfe, 0xcf, 0x19, 0xf1, 0x1a, 0x11, 0x1a, 0x11, 0x1a, 0x11, 0x1a, 0x11, 0x1f, 0x91, 0x11, 0xa1, 0x11, 0xa1, 0xf0, 0x1a, 0x11, 0x1a, 0x1f, 0x19, 0xf1, 0xcf, 0xff, 0xc0,
+    // '['
+    0x26, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x4a, 0x60,
+    // '\\'
+    0x01, 0xa1, 0xfd, 0x11, 0x1f, 0x31, 0x11, 0xfd, 0x11, 0x1f, 0x51, 0x71, 0xf5, 0x11, 0x1f, 0xd1, 0x11, 0xf3, 0x11, 0x1f, 0xd1, 0x11, 0x82,
+    // ']'
+    0x06, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x4c, 0x62,
+    // '^'
+    0xff, 0x41, 0xc1, 0x11, 0xa1, 0x11, 0x11, 0xf7, 0x11, 0x11, 0x11, 0x1f, 0x51, 0x11, 0x31, 0x11, 0x41, 0x91, 0x31, 0x11, 0x51, 0x11, 0x41, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    // '_'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xcc,
+    // '`'
+    0x21, 0x71, 0x11, 0x61, 0x21, 0x61, 0x21, 0x61, 0x11, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    // 'a'
+    0xff, 0xff, 0xf5, 0x7d, 0x15, 0x62, 0x1a, 0x1f, 0x56, 0x61, 0xb1, 0x25, 0x71, 0xfa, 0x1a, 0x12, 0x56, 0x1d, 0x8f, 0xff, 0x90,
+    // 'b'
+    0xf1, 0x2f, 0xff, 0xfb, 0x58, 0x15, 0x18, 0x42, 0x16, 0x14, 0x1e, 0x11, 0x1f, 0xff, 0xf7, 0x11, 0x1a, 0x18, 0x52, 0x14, 0x16, 0x26, 0x6f, 0xff, 0xf1,
+    // 'c'
+    0xff, 0xff, 0xb6, 0x32, 0x81, 0x26, 0x41, 0x71, 0x11, 0xff, 0xf7, 0x11, 0x1b, 0x18, 0x12, 0x63, 0x2b, 0x6f, 0xfe,
+    // 'd'
+    0xf9, 0x2f, 0xff, 0xf2, 0x58, 0x15, 0x16, 0x12, 0x49, 0x14, 0x15, 0x11, 0x1f, 0xff, 0xf7, 0x11, 0x1e, 0x1b, 0x12, 0x57, 0x26, 0x17, 0x6f, 0xff, 0xe0,
+    // 'e'
+    0xff, 0xff, 0xf7, 0x57, 0x15, 0x24, 0x12, 0x48, 0x14, 0x11, 0x12, 0x11, 0x1c, 0x7f, 0x49, 0xf0, 0x11, 0x1d, 0x15, 0x14, 0x12, 0x56, 0x1d, 0x7f, 0xff, 0x90,
+    // 'f'
+    0xd5, 0x31, 0x71, 0x24, 0x41, 0xf2, 0x4e, 0x4f, 0xff, 0xff, 0xf3, 0x2f, 0xfb,
+    // 'g'
+    0xff, 0xff, 0xfe, 0x66, 0x26, 0x14, 0x12, 0x58, 0x1a, 0x11, 0x1f, 0xff, 0xf9, 0x1b, 0x12, 0x14, 0x16, 0x12, 0x48, 0x15, 0x18, 0x57, 0x16, 0x11, 0x15, 0x6e, 0x25, 0x75,
+    // 'h'
+    0xf1, 0x2f, 0xff, 0xfa, 0x5e, 0x27, 0x5e, 0x11, 0x1f, 0xff, 0xff, 0xff, 0xfa, 0x26, 0x2f, 0xff, 0xd0,
+    // 'i'
+    0x82, 0xa2, 0xf1, 0x2f, 0xff, 0xff, 0x12, 0xfb,
+    // 'j'
+    0x82, 0xa2, 0xf1, 0x2f, 0xff, 0xff, 0x61, 0x41, 0x21, 0x41, 0x32, 0x40,
+    // 'k'
+    0xf0, 0x2f, 0xff, 0xfb, 0x2a, 0x11, 0x18, 0x21, 0x18, 0x12, 0x18, 0x11, 0x28, 0x11, 0x1c, 0x1a, 0x12, 0x29, 0x2d, 0x11, 0x1b, 0x11, 0x1b, 0x11, 0x1b, 0x11, 0x12, 0x27, 0x2f, 0xff, 0x70,
+    // 'l'
+    0x92, 0xff, 0xff, 0xff, 0xf7, 0x23, 0x17, 0x3f, 0xe0,
+    // 'm'
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x72, 0x66, 0x17, 0x26, 0x17, 0x53, 0x52, 0x1b, 0x17, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x62, 0x62, 0xff, 0xff, 0xff, 0x00,
+    // 'n'
+    0xff, 0xff, 0xfc, 0x76, 0x17, 0x17, 0x5e, 0x11, 0x1f, 0xff, 0xff, 0xff, 0xfa, 0x26, 0x2f, 0xff, 0xd0,
+    // 'o'
+    0xff, 0xff, 0xfd, 0x67, 0x16, 0x15, 0x12, 0x42, 0x16, 0x14, 0x15, 0x11, 0x16, 0x11, 0x1f, 0xff, 0xd1, 0x11, 0x61, 0x11, 0x51, 0x41, 0x61, 0x24, 0x21, 0x52, 0x42, 0x84, 0xff, 0xff, 0x10,
+    // 'p'
+    0xff, 0xff, 0xfc, 0x67, 0x16, 0x27, 0x52, 0x1b, 0x1e, 0x11, 0x1f, 0xff, 0xf7, 0x11, 0x15, 0x14, 0x19, 0x42, 0x16, 0x15, 0x18, 0x5f, 0xff, 0x32, 0xa0,
+    // 'q'
+    0xff, 0xff, 0xfe, 0x66, 0x26, 0x14, 0x12, 0x58, 0x1a, 0x11, 0x1f, 0xff, 0xf7, 0x11, 0x1e, 0x14, 0x16, 0x12, 0x48, 0x15, 0x18, 0x5f, 0xff, 0xc2, 0x20,
+    // 'r'
+    0xff, 0xfc, 0x62, 0x1a, 0x5f, 0xff, 0xff, 0xf2, 0x2f, 0xfb,
+    // 's'
+    0xff, 0xff, 0x96, 0x41, 0x91, 0x15, 0xb1, 0x51, 0x81, 0x22, 0x71, 0x32, 0x62, 0x32, 0x63, 0xf0, 0x1b, 0x61, 0x12, 0x16, 0x14, 0x6f, 0xff, 0x20,
+    // 't'
+    0xf7, 0x2f, 0xfa, 0x5f, 0x05, 0xff, 0xff, 0xf0, 0x13, 0x13, 0x12, 0x35, 0x1a, 0x5f, 0xfb,
+    // 'u'
+    0xff, 0xff, 0xfb, 0x26, 0x2f, 0xff, 0xff, 0xff, 0xfa, 0x11, 0x1e, 0x57, 0x26, 0x17, 0x6f, 0xff, 0xe0,
+    // 'v'
+    0xff, 0xff, 0xc2, 0x82, 0x21, 0x61, 0x21, 0xa1, 0xf0, 0x14, 0x14, 0x18, 0x1f, 0x01, 0x11, 0x21, 0x11, 0xf4, 0x28, 0x14, 0x1f, 0x41, 0x21, 0x92, 0xff, 0xf8,
+    // 'w'
+    0xff, 0xff, 0xff, 0xf9, 0x27, 0x17, 0x28, 0x11, 0x18, 0x11, 0x1d, 0x11, 0x1f, 0xb1, 0x11, 0x11, 0x81, 0x11, 0xb1, 0x11, 0xff, 0x21, 0x81, 0x11, 0x11, 0x11, 0x11, 0x31, 0x11, 0xfb, 0x17, 0x18, 0x13, 0x13, 0x13, 0x1f, 0xb3, 0x53, 0xff, 0xff, 0xf5,
+    // 'x'
+    0xff, 0xff, 0xc3, 0x64, 0xa1, 0x11, 0x11, 0x41, 0x11, 0x31, 0x11, 0x21, 0x11, 0x72, 0x81, 0x41, 0x71, 0x21, 0x81, 0x21, 0x71, 0x41, 0x51, 0x22, 0x21, 0x61, 0x21, 0x51, 0x11, 0x41, 0x11, 0x11, 0xa4, 0x63, 0xff, 0xf3,
+    // 'y'
+    0xff, 0xff, 0x62, 0x72, 0x21, 0x51, 0x12, 0xf7, 0x11, 0x13, 0x11, 0x1f, 0xa1, 0x11, 0x11, 0x11, 0xfc, 0x11, 0x11, 0x1f, 0xf1, 0x17, 0x17, 0x32, 0x19, 0x16, 0x47,
+    // 'z'
+    0xff, 0xff, 0x79, 0xd6, 0xa1, 0x21, 0x91, 0x71, 0x11, 0x71, 0x11, 0x71, 0xc1, 0x71, 0x11, 0x71, 0xd6, 0xd9, 0xff, 0xf0,
+    // '{'
+    0x53, 0x41, 0x61, 0x22, 0x51, 0xff, 0xf7, 0x11, 0x14, 0x11, 0x17, 0x15, 0x12, 0x15, 0x1f, 0xff, 0x51, 0x51, 0x22, 0x41, 0x83,
+    // '|'
+    0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x30,
+    // '}'
+    0x03, 0x81, 0x42, 0x21, 0x51, 0xff, 0xfb, 0x11, 0x16, 0x11, 0x15, 0x16, 0x12, 0x16, 0x1f, 0xfe, 0x15, 0x22, 0x16, 0x14, 0x35,
+    // '~'
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x34, 0x24, 0x13, 0x12, 0x15, 0x12, 0x21, 0x22, 0x15, 0x12, 0x13, 0x14, 0x24, 0x3f, 0xff, 0xff, 0xff, 0xfa,
+    // '°'
+    0x33, 0x41, 0x31, 0x21, 0x13, 0x11, 0xf2, 0x11, 0x31, 0x12, 0x13, 0x14, 0x3f, 0xff, 0xff, 0xff, 0xfa,
+    // 'š'
+    0xd2, 0x32, 0x41, 0x11, 0x11, 0x11, 0x51, 0x11, 0x11, 0x71, 0x11, 0x91, 0x86, 0x41, 0x91, 0x15, 0xb1, 0x51, 0x81, 0x22, 0x71, 0x32, 0x62, 0x32, 0x63, 0xf0, 0x1b, 0x61, 0x12, 0x16, 0x14, 0x6f, 0xff, 0x20,
+    // 'ť'
+    0x52, 0xf0, 0x2f, 0x71, 0x81, 0x85, 0xf0, 0x5f, 0xff, 0xff, 0x01, 0x31, 0x31, 0x23, 0x51, 0xa5, 0xff, 0xb0,
+    // 'ž'
+    0xd2, 0x32, 0x41, 0x11, 0x11, 0x11, 0x51, 0x11, 0x11, 0x71, 0x11, 0x91, 0x69, 0xd6, 0xa1, 0x21, 0x91, 0x71, 0x11, 0x71, 0x11, 0x71, 0xc1, 0x71, 0x11, 0x71, 0xd6, 0xd9, 0xff, 0xf0,
+    // 'á'
+    0x81, 0xb1, 0x11, 0x91, 0x21, 0x81, 0x21, 0x91, 0x11, 0xb1, 0x87, 0xd1, 0x56, 0x21, 0xa1, 0xf5, 0x66, 0x1b, 0x12, 0x57, 0x1f, 0xa1, 0xa1, 0x25, 0x61, 0xd8, 0xff, 0xf9,
+    // 'č'
+    0xe2, 0x32, 0x41, 0x11, 0x11, 0x11, 0x51, 0x11, 0x11, 0x71, 0x11, 0x91, 0x96, 0x32, 0x81, 0x26, 0x41, 0x71, 0x11, 0xff, 0xf7, 0x11, 0x1b, 0x18, 0x12, 0x63, 0x2b, 0x6f, 0xfe,
+    // 'é'
+    0x81, 0xb1, 0x11, 0x91, 0x21, 0x81, 0x21, 0x91, 0x11, 0xb1, 0xa5, 0x71, 0x52, 0x41, 0x24, 0x81, 0x41, 0x11, 0x21, 0x11, 0xc7, 0xf4, 0x9f, 0x01, 0x11, 0xd1, 0x51, 0x41, 0x25, 0x61, 0xd7, 0xff, 0xf9,
+    // 'ě'
+    0x32, 0x32, 0x61, 0x11, 0x11, 0x11, 0x71, 0x11, 0x11, 0x91, 0x11, 0xb1, 0xf8, 0x57, 0x15, 0x24, 0x12, 0x48, 0x14, 0x11, 0x12, 0x11, 0x1c, 0x7f, 0x49, 0xf0, 0x11, 0x1d, 0x15, 0x14, 0x12, 0x56, 0x1d, 0x7f, 0xff, 0x90,
+    // 'í'
+    0x41, 0x41, 0x11, 0x21, 0x21, 0x11, 0x21, 0x21, 0x11, 0x41, 0x52, 0xff, 0xff, 0xf1, 0x2f, 0xb0,
+    // 'ď'
+    0xfb, 0x22, 0x2f, 0xff, 0xf3, 0x14, 0x55, 0x14, 0x15, 0x18, 0x12, 0x4b, 0x14, 0x17, 0x11, 0x1f, 0xff, 0xff, 0x21, 0x11, 0xf1, 0x1d, 0x12, 0x59, 0x26, 0x19, 0x6f, 0xff, 0xf9,
+    // 'ň'
+    0xf3, 0x23, 0x27, 0x11, 0x11, 0x11, 0x18, 0x11, 0x11, 0x1a, 0x11, 0x1c, 0x19, 0x76, 0x17, 0x17, 0x5e, 0x11, 0x1f, 0xff, 0xff, 0xff, 0xfa, 0x26, 0x2f, 0xff, 0xd0,
+    // 'ř'
+    0xb2, 0x32, 0x21, 0x11, 0x11, 0x11, 0x31, 0x11, 0x11, 0x51, 0x11, 0x71, 0x66, 0x21, 0xa5, 0xff, 0xff, 0xff, 0x22, 0xff, 0xb0,
+    // 'ů'
+    0x54, 0x91, 0x12, 0x11, 0xff, 0x61, 0x12, 0x11, 0x94, 0x72, 0x62, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x11, 0xe5, 0x72, 0x61, 0x76, 0xff, 0xfe,
+    // 'ú'
+    0x81, 0xc1, 0x11, 0xa1, 0x21, 0x91, 0x21, 0xa1, 0x11, 0xc1, 0x92, 0x62, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x11, 0xe5, 0x72, 0x61, 0x76, 0xff, 0xfe,
+    // 'ý'
+    0x71, 0x91, 0x11, 0x71, 0x21, 0x61, 0x21, 0x71, 0x11, 0x91, 0x52, 0x72, 0x21, 0x51, 0x12, 0xf7, 0x11, 0x13, 0x11, 0x1f, 0xa1, 0x11, 0x11, 0x11, 0xfc, 0x11, 0x11, 0x1f, 0xf1, 0x17, 0x17, 0x32, 0x19, 0x16, 0x47,
+};
+
+static const bc_font_rle_char_t bc_font_ubuntu_24_rle_chars[110] = {
+    { 0x20, 6, 0 },
+    { 0x21, 7, 5 },
+    { 0x22, 10, 14 },
+    { 0x23, 16, 26 },
+    { 0x24, 14, 62 },
+    { 0x25, 21, 95 },
+    { 0x26, 16, 158 },
+    { 0x27, 6, 204 },
+    { 0x28, 8, 211 },
+    { 0x29, 8, 231 },
+    { 0x2a, 12, 251 },
+    { 0x2b, 14, 278 },
+    { 0x2c, 6, 295 },
+    { 0x2d, 8, 303 },
+    { 0x2e, 6, 311 },
+    { 0x2f, 10, 318 },
+    { 0x30, 14, 342 },
+    { 0x31, 14, 373 },
+    { 0x32, 14, 390 },
+    { 0x33, 14, 421 },
+    { 0x34, 14, 450 },
+    { 0x35, 14, 475 },
+    { 0x36, 14, 499 },
+    { 0x37, 14, 532 },
+    { 0x38, 14, 555 },
+    { 0x39, 14, 597 },
+    { 0x3a, 6, 628 },
+    { 0x3b, 6, 636 },
+    { 0x3c, 14, 646 },
+    { 0x3d, 14, 672 },
+    { 0x3e, 14, 686 },
+    { 0x3f, 10, 712 },
+    { 0x40, 23, 734 },
+    { 0x41, 15, 788 },
+    { 0x42, 15, 819 },
+    { 0x43, 15, 846 },
+    { 0x44, 17, 875 },
+    { 0x45, 14, 901 },
+    { 0x46, 13, 916 },
+    { 0x47, 16, 930 },
+    { 0x48, 17, 960 },
+    { 0x49, 6, 978 },
+    { 0x4a, 12, 984 },
+    { 0x4b, 15, 1001 },
+    { 0x4c, 12, 1039 },
+    { 0x4d, 20, 1051 },
+    { 0x4e, 17, 1090 },
+    { 0x4f, 18, 1122 },
+    { 0x50, 15, 1161 },
+    { 0x51, 19, 1184 },
+    { 0x52, 15, 1230 },
+    { 0x53, 13, 1260 },
+    { 0x54, 12, 1292 },
+    { 0x55, 17, 1304 },
+    { 0x56, 16, 1328 },
+    { 0x57, 23, 1362 },
+    { 0x58, 15, 1409 },
+    { 0x59, 14, 1455 },
+    { 0x5a, 14, 1485 },
+    { 0x5b, 8, 1513 },
+    { 0x5c, 10, 1522 },
+    { 0x5d, 8, 1545 },
+    { 0x5e, 14, 1554 },
+    { 0x5f, 12, 1584 },
+    { 0x60, 9, 1594 },
+    { 0x61, 13, 1610 },
+    { 0x62, 14, 1631 },
+    { 0x63, 11, 1656 },
+    { 0x64, 14, 1675 },
+    { 0x65, 13, 1700 },
+    { 0x66, 9, 1726 },
+    { 0x67, 14, 1739 },
+    { 0x68, 14, 1767 },
+    { 0x69, 6, 1784 },
+    { 0x6a, 6, 1792 },
+    { 0x6b, 13, 1804 },
+    { 0x6c, 7, 1835 },
+    { 0x6d, 22, 1844 },
+    { 0x6e, 14, 1872 },
+    { 0x6f, 14, 1889 },
+    { 0x70, 14, 1920 },
+    { 0x71, 14, 1945 },
+    { 0x72, 9, 1970 },
+    { 0x73, 11, 1980 },
+    { 0x74, 10, 2004 },
+    { 0x75, 14, 2019 },
+    { 0x76, 12, 2036 },
+    { 0x77, 19, 2062 },
+    { 0x78, 12, 2103 },
+    { 0x79, 11, 2139 },
+    { 0x7a, 11, 2166 },
+    { 0x7b, 8, 2186 },
+    { 0x7c, 7, 2207 },
+    { 0x7d, 8, 2215 },
+    { 0x7e, 14, 2236 },
+    { 0xb0, 8, 2259 },
+    { 0xb9, 11, 2276 },
+    { 0xbb, 10, 2310 },
+    { 0xbe, 11, 2328 },
+    { 0xe1, 13, 2358 },
+    { 0xe8, 11, 2386 },
+    { 0xe9, 13, 2415 },
+    { 0xec, 13, 2448 },
+    { 0xed, 6, 2484 },
+    { 0xef, 16, 2500 },
+    { 0xf2, 14, 2529 },
+    { 0xf8, 9, 2556 },
+    { 0xf9, 14, 2577 },
+    { 0xfa, 14, 2600 },
+    { 0xfd, 11, 2624 },
+};
+
+static const uint8_t bc_font_ubuntu_24_index[BC_FONT_INDEX_LENGTH] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xff, 0x61, 0xff, 0xff, 0x62, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x65, 0xff, 0xff, 0x66, 0x67, 0xff, 0x68,
+    0xff, 0xff, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x6b, 0x6c, 0xff, 0xff, 0x6d, 0xff, 0xff,
+};
+
+const bc_font_t bc_font_ubuntu_24 = { 110, NULL, bc_font_ubuntu_24_index, 24, bc_font_ubuntu_24_rle_chars, bc_font_ubuntu_24_rle_data };
@@ -27,4743 +27,359 @@
 
 #include <bc_font_common.h>
 
-
-
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x20[28] = {
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc, 
-    0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x20 = { image_data_bc_font_ubuntu_28_0x20,
-    6, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x21[28] = {
-    0xff, 
-    0xff, 
-    0xff, 
-    0xe3, 
-    0xe3, 
-    0xe3, 
-    0xe3, 
-    0xe3, 
-    0xe3, 
-    0xe3, 
-    0xe3, 
-    0xe3, 
-    0xe3, 
-    0xe3, 
-    0xf7, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xe3, 
-    0xe3, 
-    0xe3, 
-    0xe3, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x21 = { image_data_bc_font_ubuntu_28_0x21,
-    8, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x22[56] = {
-    0xc6, 0x30, 
-    0xc6, 0x30, 
-    0xc6, 0x30, 
-    0xc6, 0x30, 
-    0xc6, 0x30, 
-    0xc6, 0x30, 
-    0xef, 0x70, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x22 = { image_data_bc_font_ubuntu_28_0x22,
-    12, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x23[84] = {
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xfc, 0x7c, 0x60, 
-    0xfc, 0x7c, 0x60, 
-    0xf8, 0xf8, 0xe0, 
-    0xf8, 0xf8, 0xe0, 
-    0xf8, 0xf8, 0xe0, 
-    0x80, 0x00, 0x20, 
-    0x80, 0x00, 0x20, 
-    0xf1, 0xf1, 0xe0, 
-    0xf1, 0xf1, 0xe0, 
-    0xf1, 0xf1, 0xe0, 
-    0xf1, 0xf1, 0xe0, 
-    0xf1, 0xf1, 0xe0, 
-    0x80, 0x00, 0x20, 
-    0x80, 0x00, 0x20, 
-    0xe3, 0xe3, 0xe0, 
-    0xe3, 0xe3, 0xe0, 
-    0xe3, 0xe3, 0xe0, 
-    0xc7, 0xc7, 0xe0, 
-    0xc7, 0xc7, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x23 = { image_data_bc_font_ubuntu_28_0x23,
-    19, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x24[56] = {
-    0xfe, 0x7f, 
-    0xfe, 0x7f, 
-    0xfe, 0x7f, 
-    0xf8, 0x0f, 
-    0xf0, 0x07, 
-    0xe3, 0xf7, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc3, 0xff, 
-    0xe1, 0xff, 
-    0xe0, 0x7f, 
-    0xf8, 0x1f, 
-    0xfe, 0x07, 
-    0xff, 0xc7, 
-    0xff, 0xe3, 
-    0xff, 0xe3, 
-    0xff, 0xe3, 
-    0xff, 0xe3, 
-    0xcf, 0xc7, 
-    0xc0, 0x07, 
-    0xf0, 0x1f, 
-    0xfe, 0x7f, 
-    0xfe, 0x7f, 
-    0xfe, 0x7f, 
-    0xfe, 0x7f, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x24 = { image_data_bc_font_ubuntu_28_0x24,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x25[84] = {
-    0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 
-    0xe0, 0xff, 0x1f, 
-    0xc0, 0x7f, 0x3f, 
-    0x8e, 0x3e, 0x7f, 
-    0x9f, 0x3e, 0x7f, 
-    0x9f, 0x3c, 0xff, 
-    0x9f, 0x38, 0xff, 
-    0x9f, 0x39, 0xff, 
-    0x8e, 0x33, 0xff, 
-    0xc0, 0x73, 0xff, 
-    0xe0, 0xe7, 0x07, 
-    0xff, 0xce, 0x03, 
-    0xff, 0xcc, 0x71, 
-    0xff, 0x9c, 0xf9, 
-    0xff, 0x1c, 0xf9, 
-    0xff, 0x3c, 0xf9, 
-    0xfe, 0x7c, 0xf9, 
-    0xfe, 0x7c, 0x71, 
-    0xfc, 0xfe, 0x03, 
-    0xf8, 0xff, 0x07, 
-    0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x25 = { image_data_bc_font_ubuntu_28_0x25,
-    24, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x26[84] = {
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xfc, 0x1f, 0xe0, 
-    0xf0, 0x0f, 0xe0, 
-    0xf1, 0x87, 0xe0, 
-    0xe3, 0xc7, 0xe0, 
-    0xe3, 0xc7, 0xe0, 
-    0xe3, 0xc7, 0xe0, 
-    0xe3, 0x8f, 0xe0, 
-    0xf1, 0x0f, 0xe0, 
-    0xf8, 0x3f, 0xe0, 
-    0xf0, 0x7f, 0xe0, 
-    0xe2, 0x3e, 0x60, 
-    0xc7, 0x1e, 0x60, 
-    0x8f, 0x8c, 0xe0, 
-    0x8f, 0xc0, 0xe0, 
-    0x8f, 0xe1, 0xe0, 
-    0x8f, 0xf1, 0xe0, 
-    0xc3, 0xc0, 0xe0, 
-    0xe0, 0x0c, 0x60, 
-    0xf0, 0x1e, 0x20, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x26 = { image_data_bc_font_ubuntu_28_0x26,
-    19, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x27[28] = {
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xee, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x27 = { image_data_bc_font_ubuntu_28_0x27,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x28[56] = {
-    0xfe, 0x80, 
-    0xfc, 0x00, 
-    0xf8, 0x80, 
-    0xf8, 0x80, 
-    0xf1, 0x80, 
-    0xf1, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xf1, 0x80, 
-    0xf1, 0x80, 
-    0xf8, 0x80, 
-    0xf8, 0x80, 
-    0xfc, 0x00, 
-    0xfe, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x28 = { image_data_bc_font_ubuntu_28_0x28,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x29[56] = {
-    0xbf, 0x80, 
-    0x1f, 0x80, 
-    0x8f, 0x80, 
-    0x8f, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xf1, 0x80, 
-    0xf1, 0x80, 
-    0xf1, 0x80, 
-    0xf1, 0x80, 
-    0xf1, 0x80, 
-    0xf1, 0x80, 
-    0xf1, 0x80, 
-    0xf1, 0x80, 
-    0xf1, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0x8f, 0x80, 
-    0x8f, 0x80, 
-    0x1f, 0x80, 
-    0xbf, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x29 = { image_data_bc_font_ubuntu_28_0x29,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x2a[56] = {
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xf8, 0xf8, 
-    0xf8, 0xf8, 
-    0xf8, 0xf8, 
-    0xdc, 0xd8, 
-    0x85, 0x08, 
-    0xc0, 0x18, 
-    0xf8, 0xf8, 
-    0xf2, 0x78, 
-    0xe2, 0x38, 
-    0xc7, 0x18, 
-    0xef, 0xb8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x2a = { image_data_bc_font_ubuntu_28_0x2a,
-    13, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x2b[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xfe, 0x7f, 
-    0xfe, 0x7f, 
-    0xfe, 0x7f, 
-    0xfe, 0x7f, 
-    0xfe, 0x7f, 
-    0xc0, 0x03, 
-    0xc0, 0x03, 
-    0xfe, 0x7f, 
-    0xfe, 0x7f, 
-    0xfe, 0x7f, 
-    0xfe, 0x7f, 
-    0xfe, 0x7f, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x2b = { image_data_bc_font_ubuntu_28_0x2b,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x2c[28] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xce, 
-    0x8e, 
-    0x9e, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x2c = { image_data_bc_font_ubuntu_28_0x2c,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x2d[56] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0x80, 0x80, 
-    0x80, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x2d = { image_data_bc_font_ubuntu_28_0x2d,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x2e[28] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xe6, 
-    0xc2, 
-    0xc2, 
-    0xe6, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x2e = { image_data_bc_font_ubuntu_28_0x2e,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x2f[56] = {
-    0xff, 0x80, 
-    0xff, 0x20, 
-    0xff, 0x20, 
-    0xff, 0x20, 
-    0xfe, 0x60, 
-    0xfe, 0x60, 
-    0xfe, 0x60, 
-    0xfc, 0xe0, 
-    0xfc, 0xe0, 
-    0xf8, 0xe0, 
-    0xf9, 0xe0, 
-    0xf9, 0xe0, 
-    0xf3, 0xe0, 
-    0xf3, 0xe0, 
-    0xf3, 0xe0, 
-    0xe7, 0xe0, 
-    0xe7, 0xe0, 
-    0xc7, 0xe0, 
-    0xcf, 0xe0, 
-    0xcf, 0xe0, 
-    0x9f, 0xe0, 
-    0x9f, 0xe0, 
-    0x9f, 0xe0, 
-    0x3f, 0xe0, 
-    0x3f, 0xe0, 
-    0x3f, 0xe0, 
-    0x7f, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x2f = { image_data_bc_font_ubuntu_28_0x2f,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x30[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xf8, 0x1f, 
-    0xf0, 0x0f, 
-    0xe3, 0xc7, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0x8f, 0xf1, 
-    0x8f, 0xf1, 
-    0x8f, 0xf1, 
-    0x8f, 0xf1, 
-    0x8f, 0xf1, 
-    0x8f, 0xf1, 
-    0x8f, 0xf1, 
-    0x8f, 0xf1, 
-    0x8f, 0xf1, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xe3, 0xc7, 
-    0xf0, 0x0f, 
-    0xf8, 0x1f, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x30 = { image_data_bc_font_ubuntu_28_0x30,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x31[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0x1f, 
-    0xfe, 0x1f, 
-    0xfc, 0x1f, 
-    0xf0, 0x1f, 
-    0xe1, 0x1f, 
-    0xf7, 0x1f, 
-    0xff, 0x1f, 
-    0xff, 0x1f, 
-    0xff, 0x1f, 
-    0xff, 0x1f, 
-    0xff, 0x1f, 
-    0xff, 0x1f, 
-    0xff, 0x1f, 
-    0xff, 0x1f, 
-    0xff, 0x1f, 
-    0xff, 0x1f, 
-    0xff, 0x1f, 
-    0xff, 0x1f, 
-    0xff, 0x1f, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x31 = { image_data_bc_font_ubuntu_28_0x31,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x32[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xf8, 0x3f, 
-    0xe0, 0x0f, 
-    0xc7, 0x8f, 
-    0xef, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xcf, 
-    0xff, 0x8f, 
-    0xff, 0x1f, 
-    0xfe, 0x3f, 
-    0xfc, 0x7f, 
-    0xf8, 0xff, 
-    0xf1, 0xff, 
-    0xe3, 0xff, 
-    0xe3, 0xff, 
-    0xc7, 0xff, 
-    0xc0, 0x03, 
-    0xc0, 0x03, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x32 = { image_data_bc_font_ubuntu_28_0x32,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x33[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xf0, 0x3f, 
-    0xc0, 0x0f, 
-    0xef, 0x8f, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0x0f, 
-    0xf8, 0x1f, 
-    0xf8, 0x1f, 
-    0xff, 0x87, 
-    0xff, 0xc7, 
-    0xff, 0xe3, 
-    0xff, 0xe3, 
-    0xff, 0xe3, 
-    0xff, 0xc3, 
-    0xcf, 0x87, 
-    0xc0, 0x0f, 
-    0xe0, 0x3f, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x33 = { image_data_bc_font_ubuntu_28_0x33,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x34[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0x87, 
-    0xff, 0x87, 
-    0xff, 0x07, 
-    0xfe, 0x07, 
-    0xfc, 0x47, 
-    0xf8, 0xc7, 
-    0xf9, 0xc7, 
-    0xf1, 0xc7, 
-    0xe3, 0xc7, 
-    0xe7, 0xc7, 
-    0xc7, 0xc7, 
-    0x8f, 0xc7, 
-    0x80, 0x01, 
-    0x80, 0x01, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x34 = { image_data_bc_font_ubuntu_28_0x34,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x35[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xf0, 0x07, 
-    0xf0, 0x07, 
-    0xf1, 0xff, 
-    0xf1, 0xff, 
-    0xf1, 0xff, 
-    0xf1, 0xff, 
-    0xf1, 0xff, 
-    0xe0, 0x3f, 
-    0xe0, 0x0f, 
-    0xff, 0x07, 
-    0xff, 0xc7, 
-    0xff, 0xe3, 
-    0xff, 0xe3, 
-    0xff, 0xe3, 
-    0xff, 0xe3, 
-    0xff, 0xc3, 
-    0xcf, 0x87, 
-    0xc0, 0x0f, 
-    0xe0, 0x3f, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x35 = { image_data_bc_font_ubuntu_28_0x35,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x36[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xc3, 
-    0xfe, 0x03, 
-    0xfc, 0x3f, 
-    0xf8, 0xff, 
-    0xf1, 0xff, 
-    0xe3, 0xff, 
-    0xe3, 0xff, 
-    0xc4, 0x0f, 
-    0xc0, 0x07, 
-    0xc3, 0xe3, 
-    0xc7, 0xe1, 
-    0xc7, 0xf1, 
-    0xc7, 0xf1, 
-    0xc7, 0xf1, 
-    0xc7, 0xf1, 
-    0xe3, 0xe3, 
-    0xe1, 0xc3, 
-    0xf0, 0x07, 
-    0xfc, 0x1f, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x36 = { image_data_bc_font_ubuntu_28_0x36,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x37[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xc0, 0x03, 
-    0xc0, 0x03, 
-    0xff, 0xe3, 
-    0xff, 0xc7, 
-    0xff, 0x8f, 
-    0xff, 0x8f, 
-    0xff, 0x1f, 
-    0xff, 0x1f, 
-    0xff, 0x3f, 
-    0xfe, 0x3f, 
-    0xfe, 0x3f, 
-    0xfc, 0x7f, 
-    0xfc, 0x7f, 
-    0xfc, 0x7f, 
-    0xfc, 0x7f, 
-    0xf8, 0xff, 
-    0xf8, 0xff, 
-    0xf8, 0xff, 
-    0xf8, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x37 = { image_data_bc_font_ubuntu_28_0x37,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x38[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xf8, 0x1f, 
-    0xf0, 0x0f, 
-    0xe3, 0xc7, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc3, 0xe3, 
-    0xe1, 0xc7, 
-    0xf0, 0x0f, 
-    0xf8, 0x1f, 
-    0xf2, 0x0f, 
-    0xe3, 0x87, 
-    0xc7, 0xc3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xe3, 0xc7, 
-    0xe0, 0x07, 
-    0xf8, 0x1f, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x38 = { image_data_bc_font_ubuntu_28_0x38,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x39[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xf8, 0x3f, 
-    0xe0, 0x0f, 
-    0xc3, 0x87, 
-    0xc7, 0xc7, 
-    0x8f, 0xe3, 
-    0x8f, 0xe3, 
-    0x8f, 0xe3, 
-    0x8f, 0xe3, 
-    0x87, 0xe3, 
-    0xc7, 0xc3, 
-    0xe0, 0x03, 
-    0xf0, 0x23, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0x8f, 
-    0xff, 0x0f, 
-    0xfc, 0x1f, 
-    0xc0, 0x7f, 
-    0xc3, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x39 = { image_data_bc_font_ubuntu_28_0x39,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x3a[28] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xe6, 
-    0xc2, 
-    0xc2, 
-    0xe6, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xe6, 
-    0xc2, 
-    0xc2, 
-    0xe6, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x3a = { image_data_bc_font_ubuntu_28_0x3a,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x3b[28] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xce, 
-    0x86, 
-    0x86, 
-    0xce, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xce, 
-    0x8e, 
-    0x9e, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x3b = { image_data_bc_font_ubuntu_28_0x3b,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x3c[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xfb, 
-    0xff, 0xe1, 
-    0xff, 0x07, 
-    0xfc, 0x1f, 
-    0xf0, 0x7f, 
-    0x83, 0xff, 
-    0x8f, 0xff, 
-    0x83, 0xff, 
-    0xf0, 0x7f, 
-    0xfc, 0x1f, 
-    0xff, 0x07, 
-    0xff, 0xe1, 
-    0xff, 0xfb, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x3c = { image_data_bc_font_ubuntu_28_0x3c,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x3d[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xc0, 0x01, 
-    0xc0, 0x01, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xc0, 0x01, 
-    0xc0, 0x01, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x3d = { image_data_bc_font_ubuntu_28_0x3d,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x3e[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xdf, 0xff, 
-    0x87, 0xff, 
-    0xe1, 0xff, 
-    0xf8, 0x7f, 
-    0xfe, 0x1f, 
-    0xff, 0x87, 
-    0xff, 0xe3, 
-    0xff, 0x87, 
-    0xfe, 0x1f, 
-    0xf8, 0x7f, 
-    0xe1, 0xff, 
-    0x87, 0xff, 
-    0xdf, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x3e = { image_data_bc_font_ubuntu_28_0x3e,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x3f[56] = {
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xc0, 0xe0, 
-    0x80, 0x60, 
-    0xdc, 0x20, 
-    0xfe, 0x20, 
-    0xfe, 0x20, 
-    0xfe, 0x20, 
-    0xfc, 0x60, 
-    0xf8, 0x60, 
-    0xf8, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x3f = { image_data_bc_font_ubuntu_28_0x3f,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x40[112] = {
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xc0, 0x7f, 0xe0, 
-    0xfe, 0x00, 0x0f, 0xe0, 
-    0xfc, 0x1f, 0x87, 0xe0, 
-    0xf8, 0x7f, 0xe3, 0xe0, 
-    0xf1, 0xff, 0xf1, 0xe0, 
-    0xe1, 0xe0, 0x78, 0xe0, 
-    0xe3, 0xc0, 0x38, 0xe0, 
-    0xe3, 0x8e, 0x3c, 0x60, 
-    0xc7, 0x8e, 0x3c, 0x60, 
-    0xc7, 0x1e, 0x3c, 0x60, 
-    0xc7, 0x1e, 0x3c, 0x60, 
-    0xc7, 0x1e, 0x3c, 0x60, 
-    0xc7, 0x1e, 0x3c, 0x60, 
-    0xc7, 0x1e, 0x3c, 0x60, 
-    0xc7, 0x0e, 0x38, 0xe0, 
-    0xe3, 0x8e, 0x30, 0xe0, 
-    0xe3, 0xc0, 0x01, 0xe0, 
-    0xe1, 0xe0, 0x83, 0xe0, 
-    0xf1, 0xff, 0xff, 0xe0, 
-    0xf8, 0x7f, 0xff, 0xe0, 
-    0xfc, 0x1f, 0xff, 0xe0, 
-    0xfe, 0x00, 0x3f, 0xe0, 
-    0xff, 0xc0, 0x3f, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x40 = { image_data_bc_font_ubuntu_28_0x40,
-    27, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x41[84] = {
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0x0f, 0xe0, 
-    0xfe, 0x0f, 0xe0, 
-    0xfe, 0x0f, 0xe0, 
-    0xfc, 0x47, 0xe0, 
-    0xfc, 0x47, 0xe0, 
-    0xf8, 0xe3, 0xe0, 
-    0xf8, 0xe3, 0xe0, 
-    0xf8, 0xe3, 0xe0, 
-    0xf1, 0xf1, 0xe0, 
-    0xf1, 0xf1, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xe0, 0x00, 0xe0, 
-    0xc0, 0x00, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0x8f, 0xfe, 0x20, 
-    0x8f, 0xfe, 0x20, 
-    0x8f, 0xfe, 0x20, 
-    0x1f, 0xff, 0x00, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x41 = { image_data_bc_font_ubuntu_28_0x41,
-    19, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x42[84] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xc0, 0x0f, 0xc0, 
-    0xc0, 0x03, 0xc0, 
-    0xc7, 0xe1, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xe1, 0xc0, 
-    0xc0, 0x03, 0xc0, 
-    0xc0, 0x01, 0xc0, 
-    0xc7, 0xf0, 0xc0, 
-    0xc7, 0xf8, 0x40, 
-    0xc7, 0xfc, 0x40, 
-    0xc7, 0xfc, 0x40, 
-    0xc7, 0xfc, 0x40, 
-    0xc7, 0xf8, 0x40, 
-    0xc7, 0xf0, 0xc0, 
-    0xc0, 0x01, 0xc0, 
-    0xc0, 0x0f, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x42 = { image_data_bc_font_ubuntu_28_0x42,
-    18, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x43[84] = {
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0x03, 0x80, 
-    0xfc, 0x00, 0x80, 
-    0xf8, 0x7c, 0x80, 
-    0xf1, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xc7, 0xff, 0x80, 
-    0xc7, 0xff, 0x80, 
-    0xc7, 0xff, 0x80, 
-    0xc7, 0xff, 0x80, 
-    0xc7, 0xff, 0x80, 
-    0xc7, 0xff, 0x80, 
-    0xc7, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xf1, 0xff, 0x80, 
-    0xf0, 0xfc, 0x80, 
-    0xf8, 0x00, 0x80, 
-    0xfe, 0x03, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x43 = { image_data_bc_font_ubuntu_28_0x43,
-    17, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x44[84] = {
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xc0, 0x1f, 0xf0, 
-    0xc0, 0x03, 0xf0, 
-    0xc7, 0xe1, 0xf0, 
-    0xc7, 0xf8, 0xf0, 
-    0xc7, 0xfc, 0x70, 
-    0xc7, 0xfc, 0x70, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfc, 0x70, 
-    0xc7, 0xfc, 0x70, 
-    0xc7, 0xf8, 0xf0, 
-    0xc7, 0xe1, 0xf0, 
-    0xc0, 0x03, 0xf0, 
-    0xc0, 0x1f, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x44 = { image_data_bc_font_ubuntu_28_0x44,
-    20, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x45[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xc0, 0x03, 
-    0xc0, 0x03, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc0, 0x07, 
-    0xc0, 0x07, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc0, 0x01, 
-    0xc0, 0x01, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x45 = { image_data_bc_font_ubuntu_28_0x45,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x46[56] = {
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xc0, 0x02, 
-    0xc0, 0x02, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc0, 0x06, 
-    0xc0, 0x06, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x46 = { image_data_bc_font_ubuntu_28_0x46,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x47[84] = {
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0x01, 0xe0, 
-    0xfc, 0x00, 0x60, 
-    0xf8, 0x7e, 0xe0, 
-    0xf1, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xc7, 0xff, 0xe0, 
-    0xc7, 0xff, 0xe0, 
-    0xc7, 0xff, 0xe0, 
-    0xc7, 0xff, 0xe0, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xe3, 0xfc, 0x60, 
-    0xe3, 0xfc, 0x60, 
-    0xf1, 0xfc, 0x60, 
-    0xf0, 0x7c, 0x60, 
-    0xfc, 0x00, 0x60, 
-    0xff, 0x00, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x47 = { image_data_bc_font_ubuntu_28_0x47,
-    19, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x48[84] = {
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc0, 0x00, 0x30, 
-    0xc0, 0x00, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x48 = { image_data_bc_font_ubuntu_28_0x48,
-    20, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x49[28] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x49 = { image_data_bc_font_ubuntu_28_0x49,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x4a[56] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0x8c, 
-    0xff, 0x8c, 
-    0xff, 0x8c, 
-    0xff, 0x8c, 
-    0xff, 0x8c, 
-    0xff, 0x8c, 
-    0xff, 0x8c, 
-    0xff, 0x8c, 
-    0xff, 0x8c, 
-    0xff, 0x8c, 
-    0xff, 0x8c, 
-    0xff, 0x8c, 
-    0xff, 0x8c, 
-    0xff, 0x8c, 
-    0xff, 0x8c, 
-    0xff, 0x0c, 
-    0x9e, 0x1c, 
-    0x00, 0x3c, 
-    0xc0, 0x7c, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x4a = { image_data_bc_font_ubuntu_28_0x4a,
-    14, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x4b[84] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf1, 0xc0, 
-    0xc7, 0xe3, 0xc0, 
-    0xc7, 0xc7, 0xc0, 
-    0xc7, 0x8f, 0xc0, 
-    0xc7, 0x1f, 0xc0, 
-    0xc6, 0x3f, 0xc0, 
-    0xc4, 0x7f, 0xc0, 
-    0xc0, 0xff, 0xc0, 
-    0xc0, 0x7f, 0xc0, 
-    0xc4, 0x3f, 0xc0, 
-    0xc6, 0x1f, 0xc0, 
-    0xc7, 0x07, 0xc0, 
-    0xc7, 0xc3, 0xc0, 
-    0xc7, 0xe1, 0xc0, 
-    0xc7, 0xe1, 0xc0, 
-    0xc7, 0xf0, 0xc0, 
-    0xc7, 0xf8, 0x40, 
-    0xc7, 0xfc, 0x00, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x4b = { image_data_bc_font_ubuntu_28_0x4b,
-    18, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x4c[56] = {
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc0, 0x00, 
-    0xc0, 0x00, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x4c = { image_data_bc_font_ubuntu_28_0x4c,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x4d[112] = {
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xe3, 0xff, 0xe3, 0x80, 
-    0xe1, 0xff, 0xc3, 0x80, 
-    0xe1, 0xff, 0xc3, 0x80, 
-    0xe0, 0xff, 0x83, 0x80, 
-    0xe0, 0x7f, 0x83, 0x80, 
-    0xe2, 0x7f, 0x23, 0x80, 
-    0xe6, 0x3f, 0x33, 0x80, 
-    0xc7, 0x3e, 0x73, 0x80, 
-    0xc7, 0x3e, 0x71, 0x80, 
-    0xc7, 0x1c, 0x71, 0x80, 
-    0xc7, 0x9c, 0xf1, 0x80, 
-    0xc7, 0x88, 0xf1, 0x80, 
-    0xc7, 0xc9, 0xf1, 0x80, 
-    0xc7, 0xc1, 0xf1, 0x80, 
-    0xc7, 0xc1, 0xf1, 0x80, 
-    0xc7, 0xe3, 0xf1, 0x80, 
-    0xc7, 0xff, 0xf1, 0x80, 
-    0xc7, 0xff, 0xf1, 0x80, 
-    0xc7, 0xff, 0xf1, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x4d = { image_data_bc_font_ubuntu_28_0x4d,
-    25, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x4e[84] = {
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xc7, 0xfe, 0x30, 
-    0xc3, 0xfe, 0x30, 
-    0xc1, 0xfe, 0x30, 
-    0xc0, 0xfe, 0x30, 
-    0xc0, 0x7e, 0x30, 
-    0xc4, 0x7e, 0x30, 
-    0xc6, 0x3e, 0x30, 
-    0xc7, 0x1e, 0x30, 
-    0xc7, 0x9e, 0x30, 
-    0xc7, 0x8e, 0x30, 
-    0xc7, 0xc6, 0x30, 
-    0xc7, 0xe6, 0x30, 
-    0xc7, 0xe2, 0x30, 
-    0xc7, 0xf0, 0x30, 
-    0xc7, 0xf8, 0x30, 
-    0xc7, 0xf8, 0x30, 
-    0xc7, 0xfc, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x4e = { image_data_bc_font_ubuntu_28_0x4e,
-    20, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x4f[84] = {
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0x03, 0xfc, 
-    0xfc, 0x00, 0xfc, 
-    0xf8, 0x78, 0x7c, 
-    0xf1, 0xfe, 0x3c, 
-    0xe3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xc7, 0xff, 0x8c, 
-    0xc7, 0xff, 0x8c, 
-    0xc7, 0xff, 0x8c, 
-    0xc7, 0xff, 0x8c, 
-    0xc7, 0xff, 0x8c, 
-    0xc7, 0xff, 0x8c, 
-    0xc7, 0xff, 0x8c, 
-    0xe3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xf1, 0xfe, 0x3c, 
-    0xf8, 0x78, 0x7c, 
-    0xfc, 0x00, 0xfc, 
-    0xff, 0x03, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x4f = { image_data_bc_font_ubuntu_28_0x4f,
-    22, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x50[84] = {
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xc0, 0x1f, 0x80, 
-    0xc0, 0x03, 0x80, 
-    0xc7, 0xe1, 0x80, 
-    0xc7, 0xf1, 0x80, 
-    0xc7, 0xf8, 0x80, 
-    0xc7, 0xf8, 0x80, 
-    0xc7, 0xf8, 0x80, 
-    0xc7, 0xf8, 0x80, 
-    0xc7, 0xf0, 0x80, 
-    0xc7, 0xe1, 0x80, 
-    0xc0, 0x03, 0x80, 
-    0xc0, 0x0f, 0x80, 
-    0xc7, 0xff, 0x80, 
-    0xc7, 0xff, 0x80, 
-    0xc7, 0xff, 0x80, 
-    0xc7, 0xff, 0x80, 
-    0xc7, 0xff, 0x80, 
-    0xc7, 0xff, 0x80, 
-    0xc7, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x50 = { image_data_bc_font_ubuntu_28_0x50,
-    17, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x51[84] = {
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0x03, 0xfc, 
-    0xfc, 0x00, 0xfc, 
-    0xf8, 0x78, 0x7c, 
-    0xf1, 0xfe, 0x3c, 
-    0xe3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xc7, 0xff, 0x8c, 
-    0xc7, 0xff, 0x8c, 
-    0xc7, 0xff, 0x8c, 
-    0xc7, 0xff, 0x8c, 
-    0xc7, 0xff, 0x8c, 
-    0xc7, 0xff, 0x8c, 
-    0xc7, 0xff, 0x8c, 
-    0xe3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xf1, 0xfe, 0x3c, 
-    0xf0, 0x78, 0x7c, 
-    0xfc, 0x00, 0xfc, 
-    0xff, 0x03, 0xfc, 
-    0xff, 0xc7, 0xfc, 
-    0xff, 0xe3, 0xfc, 
-    0xff, 0xe0, 0xfc, 
-    0xff, 0xf8, 0x3c, 
-    0xff, 0xfe, 0x3c, 
-    0xff, 0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x51 = { image_data_bc_font_ubuntu_28_0x51,
-    22, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x52[84] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xc0, 0x0f, 0xc0, 
-    0xc0, 0x03, 0xc0, 
-    0xc7, 0xe1, 0xc0, 
-    0xc7, 0xf1, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf0, 0xc0, 
-    0xc7, 0xe1, 0xc0, 
-    0xc0, 0x03, 0xc0, 
-    0xc0, 0x0f, 0xc0, 
-    0xc7, 0x87, 0xc0, 
-    0xc7, 0xc3, 0xc0, 
-    0xc7, 0xe1, 0xc0, 
-    0xc7, 0xf1, 0xc0, 
-    0xc7, 0xf0, 0xc0, 
-    0xc7, 0xf8, 0x40, 
-    0xc7, 0xfc, 0x40, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x52 = { image_data_bc_font_ubuntu_28_0x52,
-    18, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x53[56] = {
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xf0, 0x1e, 
-    0xe0, 0x06, 
-    0xc7, 0xee, 
-    0x8f, 0xfe, 
-    0x8f, 0xfe, 
-    0x8f, 0xfe, 
-    0x87, 0xfe, 
-    0xc1, 0xfe, 
-    0xe0, 0x3e, 
-    0xf0, 0x0e, 
-    0xfe, 0x06, 
-    0xff, 0xc2, 
-    0xff, 0xe2, 
-    0xff, 0xe2, 
-    0xff, 0xe2, 
-    0xff, 0xe2, 
-    0x8f, 0xc6, 
-    0x80, 0x0e, 
-    0xe0, 0x3e, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x53 = { image_data_bc_font_ubuntu_28_0x53,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x54[56] = {
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0x00, 0x00, 
-    0x00, 0x00, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x54 = { image_data_bc_font_ubuntu_28_0x54,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x55[84] = {
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xe3, 0xf8, 0xe0, 
-    0xe1, 0xf0, 0xe0, 
-    0xf0, 0x01, 0xe0, 
-    0xfc, 0x07, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x55 = { image_data_bc_font_ubuntu_28_0x55,
-    19, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x56[84] = {
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0x1f, 0xff, 0x00, 
-    0x8f, 0xfe, 0x20, 
-    0x8f, 0xfe, 0x20, 
-    0x8f, 0xfe, 0x20, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc3, 0xf8, 0x60, 
-    0xe3, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xf1, 0xf1, 0xe0, 
-    0xf1, 0xf1, 0xe0, 
-    0xf8, 0xe3, 0xe0, 
-    0xf8, 0xe3, 0xe0, 
-    0xf8, 0x43, 0xe0, 
-    0xfc, 0x47, 0xe0, 
-    0xfc, 0x07, 0xe0, 
-    0xfe, 0x0f, 0xe0, 
-    0xfe, 0x0f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x56 = { image_data_bc_font_ubuntu_28_0x56,
-    19, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x57[112] = {
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0, 
-    0x8f, 0xff, 0xfe, 0x20, 
-    0x8f, 0xff, 0xfe, 0x20, 
-    0x87, 0xf1, 0xfc, 0x20, 
-    0xc7, 0xf0, 0xfc, 0x60, 
-    0xc7, 0xe0, 0xfc, 0x60, 
-    0xc7, 0xe0, 0xfc, 0x60, 
-    0xc7, 0xe4, 0xfc, 0x60, 
-    0xc3, 0xc4, 0x78, 0x60, 
-    0xe3, 0xc4, 0x78, 0xe0, 
-    0xe3, 0xcc, 0x78, 0xe0, 
-    0xe3, 0x8e, 0x38, 0xe0, 
-    0xe3, 0x8e, 0x38, 0xe0, 
-    0xe1, 0x9e, 0x30, 0xe0, 
-    0xf1, 0x1f, 0x11, 0xe0, 
-    0xf1, 0x1f, 0x11, 0xe0, 
-    0xf1, 0x3f, 0x11, 0xe0, 
-    0xf0, 0x3f, 0x81, 0xe0, 
-    0xf8, 0x3f, 0x83, 0xe0, 
-    0xf8, 0x7f, 0x83, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x57 = { image_data_bc_font_ubuntu_28_0x57,
-    27, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x58[84] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0x8f, 0xfc, 0x40, 
-    0xc7, 0xf8, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xf1, 0xe3, 0xc0, 
-    0xf8, 0xc7, 0xc0, 
-    0xf8, 0xc7, 0xc0, 
-    0xfc, 0x0f, 0xc0, 
-    0xfe, 0x1f, 0xc0, 
-    0xfe, 0x1f, 0xc0, 
-    0xfe, 0x1f, 0xc0, 
-    0xfc, 0x0f, 0xc0, 
-    0xf8, 0xc7, 0xc0, 
-    0xf8, 0xc7, 0xc0, 
-    0xf1, 0xe3, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xc3, 0xf0, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0x8f, 0xfc, 0x40, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x58 = { image_data_bc_font_ubuntu_28_0x58,
-    18, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x59[84] = {
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0x1f, 0xfc, 0x00, 
-    0x8f, 0xf8, 0x80, 
-    0x8f, 0xf8, 0x80, 
-    0xc7, 0xf1, 0x80, 
-    0xe3, 0xe3, 0x80, 
-    0xe3, 0xe3, 0x80, 
-    0xf1, 0xc7, 0x80, 
-    0xf8, 0x8f, 0x80, 
-    0xf8, 0x8f, 0x80, 
-    0xfc, 0x1f, 0x80, 
-    0xfe, 0x3f, 0x80, 
-    0xfe, 0x3f, 0x80, 
-    0xfe, 0x3f, 0x80, 
-    0xfe, 0x3f, 0x80, 
-    0xfe, 0x3f, 0x80, 
-    0xfe, 0x3f, 0x80, 
-    0xfe, 0x3f, 0x80, 
-    0xfe, 0x3f, 0x80, 
-    0xfe, 0x3f, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x59 = { image_data_bc_font_ubuntu_28_0x59,
-    17, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x5a[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xc0, 0x01, 
-    0xc0, 0x01, 
-    0xff, 0xf1, 
-    0xff, 0xe3, 
-    0xff, 0xc7, 
-    0xff, 0x8f, 
-    0xff, 0x8f, 
-    0xff, 0x1f, 
-    0xfe, 0x3f, 
-    0xfc, 0x7f, 
-    0xfc, 0x7f, 
-    0xf8, 0xff, 
-    0xf1, 0xff, 
-    0xf1, 0xff, 
-    0xe3, 0xff, 
-    0xe3, 0xff, 
-    0xc7, 0xff, 
-    0x80, 0x01, 
-    0x80, 0x01, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x5a = { image_data_bc_font_ubuntu_28_0x5a,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x5b[56] = {
-    0xe0, 0x00, 
-    0xe0, 0x00, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe0, 0x00, 
-    0xe0, 0x00, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x5b = { image_data_bc_font_ubuntu_28_0x5b,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x5c[56] = {
-    0x7f, 0xe0, 
-    0x3f, 0xe0, 
-    0x3f, 0xe0, 
-    0x3f, 0xe0, 
-    0x9f, 0xe0, 
-    0x9f, 0xe0, 
-    0x9f, 0xe0, 
-    0xcf, 0xe0, 
-    0xcf, 0xe0, 
-    0xc7, 0xe0, 
-    0xe7, 0xe0, 
-    0xe7, 0xe0, 
-    0xf3, 0xe0, 
-    0xf3, 0xe0, 
-    0xf3, 0xe0, 
-    0xf9, 0xe0, 
-    0xf9, 0xe0, 
-    0xf8, 0xe0, 
-    0xfc, 0xe0, 
-    0xfc, 0xe0, 
-    0xfe, 0x60, 
-    0xfe, 0x60, 
-    0xfe, 0x60, 
-    0xff, 0x20, 
-    0xff, 0x20, 
-    0xff, 0x20, 
-    0xff, 0x80, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x5c = { image_data_bc_font_ubuntu_28_0x5c,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x5d[56] = {
-    0x03, 0x80, 
-    0x03, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0x03, 0x80, 
-    0x03, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x5d = { image_data_bc_font_ubuntu_28_0x5d,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x5e[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xfc, 0x7f, 
-    0xf8, 0x3f, 
-    0xf8, 0x3f, 
-    0xf1, 0x1f, 
-    0xf1, 0x1f, 
-    0xe3, 0x8f, 
-    0xe3, 0x8f, 
-    0xc7, 0xc7, 
-    0xcf, 0xe7, 
-    0x8f, 0xe3, 
-    0xdf, 0xf7, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x5e = { image_data_bc_font_ubuntu_28_0x5e,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x5f[56] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0x00, 0x00, 
-    0x00, 0x00, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x5f = { image_data_bc_font_ubuntu_28_0x5f,
-    14, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x60[56] = {
-    0xff, 0xe0, 
-    0xef, 0xe0, 
-    0xc7, 0xe0, 
-    0xe3, 0xe0, 
-    0xf1, 0xe0, 
-    0xfb, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x60 = { image_data_bc_font_ubuntu_28_0x60,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x61[56] = {
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xe0, 0x3e, 
-    0xe0, 0x0e, 
-    0xff, 0x8e, 
-    0xff, 0xc6, 
-    0xff, 0xc6, 
-    0xff, 0xc6, 
-    0xf0, 0x06, 
-    0xc0, 0x06, 
-    0x87, 0xc6, 
-    0x8f, 0xc6, 
-    0x8f, 0xc6, 
-    0x8f, 0xc6, 
-    0x87, 0xc6, 
-    0xc0, 0x06, 
-    0xf0, 0x06, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x61 = { image_data_bc_font_ubuntu_28_0x61,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x62[56] = {
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc4, 0x1f, 
-    0xc0, 0x07, 
-    0xc3, 0xc3, 
-    0xc7, 0xe3, 
-    0xc7, 0xf1, 
-    0xc7, 0xf1, 
-    0xc7, 0xf1, 
-    0xc7, 0xf1, 
-    0xc7, 0xf1, 
-    0xc7, 0xf1, 
-    0xc7, 0xe1, 
-    0xc7, 0xe3, 
-    0xc7, 0xc7, 
-    0xc0, 0x0f, 
-    0xe0, 0x1f, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x62 = { image_data_bc_font_ubuntu_28_0x62,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x63[56] = {
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xf8, 0x18, 
-    0xf0, 0x08, 
-    0xe3, 0xf8, 
-    0xc7, 0xf8, 
-    0xc7, 0xf8, 
-    0x8f, 0xf8, 
-    0x8f, 0xf8, 
-    0x8f, 0xf8, 
-    0x8f, 0xf8, 
-    0x8f, 0xf8, 
-    0x87, 0xf8, 
-    0xc7, 0xf8, 
-    0xc3, 0xe8, 
-    0xe0, 0x08, 
-    0xf8, 0x18, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x63 = { image_data_bc_font_ubuntu_28_0x63,
-    13, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x64[56] = {
-    0xff, 0xe3, 
-    0xff, 0xe3, 
-    0xff, 0xe3, 
-    0xff, 0xe3, 
-    0xff, 0xe3, 
-    0xff, 0xe3, 
-    0xff, 0xe3, 
-    0xf8, 0x23, 
-    0xe0, 0x03, 
-    0xc3, 0xc3, 
-    0xc7, 0xe3, 
-    0x8f, 0xe3, 
-    0x8f, 0xe3, 
-    0x8f, 0xe3, 
-    0x8f, 0xe3, 
-    0x8f, 0xe3, 
-    0x8f, 0xe3, 
-    0x87, 0xe3, 
-    0xc7, 0xe3, 
-    0xe3, 0xe3, 
-    0xf0, 0x03, 
-    0xf8, 0x07, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x64 = { image_data_bc_font_ubuntu_28_0x64,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x65[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xfc, 0x1f, 
-    0xf0, 0x07, 
-    0xe3, 0xc3, 
-    0xc7, 0xe3, 
-    0xcf, 0xf1, 
-    0x8f, 0xf1, 
-    0x80, 0x01, 
-    0x80, 0x01, 
-    0x8f, 0xff, 
-    0x8f, 0xff, 
-    0x87, 0xff, 
-    0xc7, 0xff, 
-    0xe1, 0xfb, 
-    0xf0, 0x03, 
-    0xfc, 0x07, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x65 = { image_data_bc_font_ubuntu_28_0x65,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x66[56] = {
-    0xf8, 0x00, 
-    0xe0, 0x00, 
-    0xe3, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc0, 0x20, 
-    0xc0, 0x20, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x66 = { image_data_bc_font_ubuntu_28_0x66,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x67[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xf8, 0x07, 
-    0xf0, 0x03, 
-    0xc3, 0xe3, 
-    0xc7, 0xe3, 
-    0x8f, 0xe3, 
-    0x8f, 0xe3, 
-    0x8f, 0xe3, 
-    0x8f, 0xe3, 
-    0x8f, 0xe3, 
-    0x8f, 0xe3, 
-    0xc7, 0xe3, 
-    0xc3, 0xc3, 
-    0xe0, 0x03, 
-    0xf8, 0x23, 
-    0xff, 0xe3, 
-    0xff, 0xe3, 
-    0xff, 0xc3, 
-    0xdf, 0x87, 
-    0xc0, 0x0f, 
-    0xe0, 0x3f, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x67 = { image_data_bc_font_ubuntu_28_0x67,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x68[56] = {
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc0, 0x1f, 
-    0xc0, 0x0f, 
-    0xc7, 0xc7, 
-    0xc7, 0xc3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x68 = { image_data_bc_font_ubuntu_28_0x68,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x69[28] = {
-    0xfe, 
-    0xc6, 
-    0xc6, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x69 = { image_data_bc_font_ubuntu_28_0x69,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x6a[28] = {
-    0xfe, 
-    0xc6, 
-    0xc6, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0x8e, 
-    0x0e, 
-    0x3e, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x6a = { image_data_bc_font_ubuntu_28_0x6a,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x6b[56] = {
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xc2, 
-    0xc7, 0xc6, 
-    0xc7, 0x8e, 
-    0xc7, 0x1e, 
-    0xc6, 0x3e, 
-    0xc4, 0x7e, 
-    0xc0, 0xfe, 
-    0xc0, 0x7e, 
-    0xc4, 0x3e, 
-    0xc6, 0x1e, 
-    0xc7, 0x0e, 
-    0xc7, 0x86, 
-    0xc7, 0xc6, 
-    0xc7, 0xc2, 
-    0xc7, 0xe0, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x6b = { image_data_bc_font_ubuntu_28_0x6b,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x6c[28] = {
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc3, 
-    0xe1, 
-    0xf1, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x6c = { image_data_bc_font_ubuntu_28_0x6c,
-    8, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x6d[112] = {
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xe0, 0x1c, 0x0f, 0x80, 
-    0xc0, 0x00, 0x03, 0x80, 
-    0xc7, 0xc3, 0xe3, 0x80, 
-    0xc7, 0xe3, 0xf1, 0x80, 
-    0xc7, 0xe3, 0xf1, 0x80, 
-    0xc7, 0xe3, 0xf1, 0x80, 
-    0xc7, 0xe3, 0xf1, 0x80, 
-    0xc7, 0xe3, 0xf1, 0x80, 
-    0xc7, 0xe3, 0xf1, 0x80, 
-    0xc7, 0xe3, 0xf1, 0x80, 
-    0xc7, 0xe3, 0xf1, 0x80, 
-    0xc7, 0xe3, 0xf1, 0x80, 
-    0xc7, 0xe3, 0xf1, 0x80, 
-    0xc7, 0xe3, 0xf1, 0x80, 
-    0xc7, 0xe3, 0xf1, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x6d = { image_data_bc_font_ubuntu_28_0x6d,
-    25, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x6e[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xe0, 0x1f, 
-    0xc0, 0x0f, 
-    0xc7, 0xc7, 
-    0xc7, 0xc3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x6e = { image_data_bc_font_ubuntu_28_0x6e,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x6f[84] = {
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xfc, 0x1f, 0x80, 
-    0xf0, 0x07, 0x80, 
-    0xe3, 0xe3, 0x80, 
-    0xc7, 0xf1, 0x80, 
-    0xc7, 0xf1, 0x80, 
-    0x8f, 0xf8, 0x80, 
-    0x8f, 0xf8, 0x80, 
-    0x8f, 0xf8, 0x80, 
-    0x8f, 0xf8, 0x80, 
-    0x8f, 0xf8, 0x80, 
-    0xc7, 0xf1, 0x80, 
-    0xc7, 0xf1, 0x80, 
-    0xe3, 0xe3, 0x80, 
-    0xf0, 0x07, 0x80, 
-    0xfc, 0x1f, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x6f = { image_data_bc_font_ubuntu_28_0x6f,
-    17, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x70[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xe0, 0x1f, 
-    0xc0, 0x0f, 
-    0xc7, 0xc7, 
-    0xc7, 0xe3, 
-    0xc7, 0xe1, 
-    0xc7, 0xf1, 
-    0xc7, 0xf1, 
-    0xc7, 0xf1, 
-    0xc7, 0xf1, 
-    0xc7, 0xf1, 
-    0xc7, 0xf1, 
-    0xc7, 0xe3, 
-    0xc3, 0xc3, 
-    0xc0, 0x07, 
-    0xc4, 0x1f, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xc7, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x70 = { image_data_bc_font_ubuntu_28_0x70,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x71[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xf8, 0x07, 
-    0xf0, 0x03, 
-    0xe3, 0xe3, 
-    0xc7, 0xe3, 
-    0x87, 0xe3, 
-    0x8f, 0xe3, 
-    0x8f, 0xe3, 
-    0x8f, 0xe3, 
-    0x8f, 0xe3, 
-    0x8f, 0xe3, 
-    0x8f, 0xe3, 
-    0xc7, 0xe3, 
-    0xc3, 0xc3, 
-    0xe0, 0x03, 
-    0xf8, 0x23, 
-    0xff, 0xe3, 
-    0xff, 0xe3, 
-    0xff, 0xe3, 
-    0xff, 0xe3, 
-    0xff, 0xe3, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x71 = { image_data_bc_font_ubuntu_28_0x71,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x72[56] = {
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xf0, 0x00, 
-    0xc0, 0x00, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x72 = { image_data_bc_font_ubuntu_28_0x72,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x73[56] = {
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xf0, 0x30, 
-    0xc0, 0x30, 
-    0x87, 0xb0, 
-    0x8f, 0xf0, 
-    0x8f, 0xf0, 
-    0x87, 0xf0, 
-    0x81, 0xf0, 
-    0xc0, 0x30, 
-    0xf8, 0x10, 
-    0xfe, 0x10, 
-    0xff, 0x10, 
-    0xff, 0x10, 
-    0xbe, 0x10, 
-    0x80, 0x30, 
-    0xc0, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x73 = { image_data_bc_font_ubuntu_28_0x73,
-    12, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x74[56] = {
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc0, 0x60, 
-    0xc0, 0x60, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc3, 0xa0, 
-    0xe0, 0x20, 
-    0xf0, 0x60, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x74 = { image_data_bc_font_ubuntu_28_0x74,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x75[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc3, 0xe3, 
-    0xe3, 0xe3, 
-    0xf0, 0x03, 
-    0xf8, 0x07, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x75 = { image_data_bc_font_ubuntu_28_0x75,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x76[56] = {
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0x1f, 0xc0, 
-    0x1f, 0xc0, 
-    0x8f, 0x88, 
-    0x8f, 0x88, 
-    0x8f, 0x88, 
-    0xc7, 0x18, 
-    0xc7, 0x18, 
-    0xc7, 0x18, 
-    0xe2, 0x38, 
-    0xe2, 0x38, 
-    0xe0, 0x38, 
-    0xf0, 0x78, 
-    0xf0, 0x78, 
-    0xf0, 0x78, 
-    0xf8, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x76 = { image_data_bc_font_ubuntu_28_0x76,
-    13, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x77[84] = {
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0x1f, 0x8f, 0xc0, 
-    0x1f, 0x8f, 0xc0, 
-    0x9f, 0x8f, 0xc8, 
-    0x8f, 0x07, 0x88, 
-    0x8f, 0x07, 0x88, 
-    0x8f, 0x27, 0x88, 
-    0xce, 0x23, 0x98, 
-    0xce, 0x23, 0x98, 
-    0xc6, 0x73, 0x18, 
-    0xc4, 0x71, 0x18, 
-    0xe4, 0x71, 0x38, 
-    0xe4, 0xf9, 0x38, 
-    0xe0, 0xf8, 0x38, 
-    0xf0, 0xf8, 0x78, 
-    0xf1, 0xfc, 0x78, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x77 = { image_data_bc_font_ubuntu_28_0x77,
-    21, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x78[56] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0x1f, 0xc4, 
-    0x8f, 0x8c, 
-    0xc7, 0x1c, 
-    0xc7, 0x1c, 
-    0xe2, 0x3c, 
-    0xf0, 0x7c, 
-    0xf8, 0xfc, 
-    0xf8, 0xfc, 
-    0xf0, 0x7c, 
-    0xf0, 0x7c, 
-    0xe2, 0x3c, 
-    0xc7, 0x1c, 
-    0xc7, 0x1c, 
-    0x8f, 0x8c, 
-    0x1f, 0xc4, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x78 = { image_data_bc_font_ubuntu_28_0x78,
-    14, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x79[56] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0x1f, 0xc4, 
-    0x1f, 0xc4, 
-    0x8f, 0x8c, 
-    0x8f, 0x8c, 
-    0x8f, 0x8c, 
-    0xc7, 0x1c, 
-    0xc7, 0x1c, 
-    0xc7, 0x1c, 
-    0xe2, 0x3c, 
-    0xe2, 0x3c, 
-    0xe2, 0x3c, 
-    0xe2, 0x7c, 
-    0xf0, 0x7c, 
-    0xf0, 0x7c, 
-    0xf0, 0xfc, 
-    0xf0, 0xfc, 
-    0xf0, 0xfc, 
-    0xf1, 0xfc, 
-    0x03, 0xfc, 
-    0x07, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x79 = { image_data_bc_font_ubuntu_28_0x79,
-    14, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x7a[56] = {
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0x80, 0x08, 
-    0x80, 0x08, 
-    0xff, 0x88, 
-    0xff, 0x18, 
-    0xfe, 0x38, 
-    0xfc, 0x78, 
-    0xf8, 0xf8, 
-    0xf8, 0xf8, 
-    0xf1, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xc7, 0xf8, 
-    0x8f, 0xf8, 
-    0x80, 0x08, 
-    0x80, 0x08, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x7a = { image_data_bc_font_ubuntu_28_0x7a,
-    13, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x7b[56] = {
-    0xfc, 0x00, 
-    0xf8, 0x00, 
-    0xf0, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xe1, 0xc0, 
-    0x83, 0xc0, 
-    0x87, 0xc0, 
-    0xe3, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf0, 0xc0, 
-    0xf8, 0x00, 
-    0xfe, 0x00, 
-    0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x7b = { image_data_bc_font_ubuntu_28_0x7b,
-    10, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x7c[28] = {
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xe7, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x7c = { image_data_bc_font_ubuntu_28_0x7c,
-    8, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x7d[56] = {
-    0x1f, 0x80, 
-    0x0f, 0x80, 
-    0x87, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc3, 0x80, 
-    0xe0, 0x80, 
-    0xf0, 0x80, 
-    0xe3, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0xc7, 0x80, 
-    0x87, 0x80, 
-    0x0f, 0x80, 
-    0x3f, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x7d = { image_data_bc_font_ubuntu_28_0x7d,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0x7e[56] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xe1, 0xf3, 
-    0xc0, 0x63, 
-    0x8c, 0x07, 
-    0x9f, 0x0f, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0x7e = { image_data_bc_font_ubuntu_28_0x7e,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0xb0[56] = {
-    0xff, 0x80, 
-    0xe3, 0x80, 
-    0xc1, 0x80, 
-    0x9c, 0x80, 
-    0x9c, 0x80, 
-    0x9c, 0x80, 
-    0xc1, 0x80, 
-    0xe3, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_28_0xb0 = { image_data_bc_font_ubuntu_28_0xb0,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0xb9[56] = {
-    0xff, 0xf0, 
-    0xee, 0xf0, 
-    0xc4, 0x70, 
-    0xe0, 0xf0, 
-    0xf1, 0xf0, 
-    0xfb, 0xf0, 
-    0xff, 0xf0, 
-    0xf0, 0x30, 
-    0xc0, 0x30, 
-    0x87, 0xb0, 
-    0x8f, 0xf0, 
-    0x8f, 0xf0, 
-    0x87, 0xf0, 
-    0x81, 0xf0, 
-    0xc0, 0x30, 
-    0xf8, 0x10, 
-    0xfe, 0x10, 
-    0xff, 0x10, 
-    0xff, 0x10, 
-    0xbe, 0x10, 
-    0x80, 0x30, 
-    0xc0, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0xb9 = { image_data_bc_font_ubuntu_28_0xb9,
-    12, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0xbb[56] = {
-    0xfe, 0x60, 
-    0xfe, 0x60, 
-    0xc6, 0x60, 
-    0xc6, 0x60, 
-    0xc6, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc0, 0x60, 
-    0xc0, 0x60, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc3, 0xa0, 
-    0xe0, 0x20, 
-    0xf0, 0x60, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0xbb = { image_data_bc_font_ubuntu_28_0xbb,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0xbe[56] = {
-    0xff, 0xf8, 
-    0xf7, 0x78, 
-    0xe2, 0x38, 
-    0xf0, 0x78, 
-    0xf8, 0xf8, 
-    0xfd, 0xf8, 
-    0xff, 0xf8, 
-    0x80, 0x08, 
-    0x80, 0x08, 
-    0xff, 0x88, 
-    0xff, 0x18, 
-    0xfe, 0x38, 
-    0xfc, 0x78, 
-    0xf8, 0xf8, 
-    0xf8, 0xf8, 
-    0xf1, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xc7, 0xf8, 
-    0x8f, 0xf8, 
-    0x80, 0x08, 
-    0x80, 0x08, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_28_0xbe = { image_data_bc_font_ubuntu_28_0xbe,
-    13, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0xe1[56] = {
-    0xff, 0xfe, 
-    0xff, 0xbe, 
-    0xff, 0x1e, 
-    0xfe, 0x3e, 
-    0xfc, 0x7e, 
-    0xfe, 0xfe, 
-    0xff, 0xfe, 
-    0xe0, 0x3e, 
-    0xe0, 0x0e, 
-    0xff, 0x8e, 
-    0xff, 0xc6, 
-    0xff, 0xc6, 
-    0xff, 0xc6, 
-    0xf0, 0x06, 
-    0xc0, 0x06, 
-    0x87, 0xc6, 
-    0x8f, 0xc6, 
-    0x8f, 0xc6, 
-    0x8f, 0xc6, 
-    0x87, 0xc6, 
-    0xc0, 0x06, 
-    0xf0, 0x06, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_28_0xe1 = { image_data_bc_font_ubuntu_28_0xe1,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0xe8[56] = {
-    0xff, 0xf8, 
-    0xfb, 0xb8, 
-    0xf1, 0x18, 
-    0xf8, 0x38, 
-    0xfc, 0x78, 
-    0xfe, 0xf8, 
-    0xff, 0xf8, 
-    0xf8, 0x18, 
-    0xf0, 0x08, 
-    0xe3, 0xf8, 
-    0xc7, 0xf8, 
-    0xc7, 0xf8, 
-    0x8f, 0xf8, 
-    0x8f, 0xf8, 
-    0x8f, 0xf8, 
-    0x8f, 0xf8, 
-    0x8f, 0xf8, 
-    0x87, 0xf8, 
-    0xc7, 0xf8, 
-    0xc3, 0xe8, 
-    0xe0, 0x08, 
-    0xf8, 0x18, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_28_0xe8 = { image_data_bc_font_ubuntu_28_0xe8,
-    13, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0xe9[56] = {
-    0xff, 0xff, 
-    0xff, 0xbf, 
-    0xff, 0x1f, 
-    0xfe, 0x3f, 
-    0xfc, 0x7f, 
-    0xfe, 0xff, 
-    0xff, 0xff, 
-    0xfc, 0x1f, 
-    0xf0, 0x07, 
-    0xe3, 0xc3, 
-    0xc7, 0xe3, 
-    0xcf, 0xf1, 
-    0x8f, 0xf1, 
-    0x80, 0x01, 
-    0x80, 0x01, 
-    0x8f, 0xff, 
-    0x8f, 0xff, 
-    0x87, 0xff, 
-    0xc7, 0xff, 
-    0xe1, 0xfb, 
-    0xf0, 0x03, 
-    0xfc, 0x07, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0xe9 = { image_data_bc_font_ubuntu_28_0xe9,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0xec[56] = {
-    0xfd, 0xdf, 
-    0xf8, 0x8f, 
-    0xfc, 0x1f, 
-    0xfe, 0x3f, 
-    0xff, 0x7f, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xfc, 0x1f, 
-    0xf0, 0x07, 
-    0xe3, 0xc3, 
-    0xc7, 0xe3, 
-    0xcf, 0xf1, 
-    0x8f, 0xf1, 
-    0x80, 0x01, 
-    0x80, 0x01, 
-    0x8f, 0xff, 
-    0x8f, 0xff, 
-    0x87, 0xff, 
-    0xc7, 0xff, 
-    0xe1, 0xfb, 
-    0xf0, 0x03, 
-    0xfc, 0x07, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0xec = { image_data_bc_font_ubuntu_28_0xec,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0xed[28] = {
-    0xfe, 
-    0xfa, 
-    0xf0, 
-    0xe2, 
-    0xc6, 
-    0xee, 
-    0xfe, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xc6, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_28_0xed = { image_data_bc_font_ubuntu_28_0xed,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0xef[84] = {
-    0xff, 0xe3, 0x80, 
-    0xff, 0xe3, 0x80, 
-    0xff, 0xe3, 0x80, 
-    0xff, 0xe3, 0x80, 
-    0xff, 0xe3, 0x90, 
-    0xff, 0xe3, 0x90, 
-    0xff, 0xe3, 0xf0, 
-    0xf8, 0x23, 0xf0, 
-    0xe0, 0x03, 0xf0, 
-    0xc3, 0xc3, 0xf0, 
-    0xc7, 0xe3, 0xf0, 
-    0x8f, 0xe3, 0xf0, 
-    0x8f, 0xe3, 0xf0, 
-    0x8f, 0xe3, 0xf0, 
-    0x8f, 0xe3, 0xf0, 
-    0x8f, 0xe3, 0xf0, 
-    0x8f, 0xe3, 0xf0, 
-    0x87, 0xe3, 0xf0, 
-    0xc7, 0xe3, 0xf0, 
-    0xe3, 0xe3, 0xf0, 
-    0xf0, 0x03, 0xf0, 
-    0xf8, 0x07, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0xef = { image_data_bc_font_ubuntu_28_0xef,
-    20, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0xf2[56] = {
-    0xff, 0xff, 
-    0xfb, 0xbf, 
-    0xf1, 0x1f, 
-    0xf8, 0x3f, 
-    0xfc, 0x7f, 
-    0xfe, 0xff, 
-    0xff, 0xff, 
-    0xe0, 0x1f, 
-    0xc0, 0x0f, 
-    0xc7, 0xc7, 
-    0xc7, 0xc3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0xf2 = { image_data_bc_font_ubuntu_28_0xf2,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0xf8[56] = {
-    0xff, 0xe0, 
-    0xf7, 0x60, 
-    0xe2, 0x20, 
-    0xf0, 0x60, 
-    0xf8, 0xe0, 
-    0xfd, 0xe0, 
-    0xff, 0xe0, 
-    0xf0, 0x00, 
-    0xc0, 0x00, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xc7, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_28_0xf8 = { image_data_bc_font_ubuntu_28_0xf8,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0xf9[56] = {
-    0xf8, 0x3f, 
-    0xf3, 0x9f, 
-    0xf3, 0x9f, 
-    0xf3, 0x9f, 
-    0xf3, 0x9f, 
-    0xf8, 0x3f, 
-    0xff, 0xff, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc3, 0xe3, 
-    0xe3, 0xe3, 
-    0xf0, 0x03, 
-    0xf8, 0x07, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0xf9 = { image_data_bc_font_ubuntu_28_0xf9,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0xfa[56] = {
-    0xff, 0xff, 
-    0xff, 0xbf, 
-    0xff, 0x1f, 
-    0xfe, 0x3f, 
-    0xfc, 0x7f, 
-    0xfe, 0xff, 
-    0xff, 0xff, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc3, 0xe3, 
-    0xe3, 0xe3, 
-    0xf0, 0x03, 
-    0xf8, 0x07, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_28_0xfa = { image_data_bc_font_ubuntu_28_0xfa,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_28_0xfd[56] = {
-    0xff, 0xfc, 
-    0xff, 0x7c, 
-    0xfe, 0x3c, 
-    0xfc, 0x7c, 
-    0xf8, 0xfc, 
-    0xfd, 0xfc, 
-    0xff, 0xfc, 
-    0x1f, 0xc4, 
-    0x1f, 0xc4, 
-    0x8f, 0x8c, 
-    0x8f, 0x8c, 
-    0x8f, 0x8c, 
-    0xc7, 0x1c, 
-    0xc7, 0x1c, 
-    0xc7, 0x1c, 
-    0xe2, 0x3c, 
-    0xe2, 0x3c, 
-    0xe2, 0x3c, 
-    0xe2, 0x7c, 
-    0xf0, 0x7c, 
-    0xf0, 0x7c, 
-    0xf0, 0xfc, 
-    0xf0, 0xfc, 
-    0xf0, 0xfc, 
-    0xf1, 0xfc, 
-    0x03, 0xfc, 
-    0x07, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_28_0xfd = { image_data_bc_font_ubuntu_28_0xfd,
-    14, 28/*, 8*/};
-#endif
-
-
-static const bc_font_char_t bc_font_ubuntu_28_array[] = {
-
-#if (0x0 == 0x0)
-  // character: ' '
-  {0x20, &bc_font_ubuntu_28_0x20},
-#else
-  // character: ' ' == ''
-  {0x20, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '!'
-  {0x21, &bc_font_ubuntu_28_0x21},
-#else
-  // character: '!' == ''
-  {0x21, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '"'
-  {0x22, &bc_font_ubuntu_28_0x22},
-#else
-  // character: '"' == ''
-  {0x22, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '#'
-  {0x23, &bc_font_ubuntu_28_0x23},
-#else
-  // character: '#' == ''
-  {0x23, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '$'
-  {0x24, &bc_font_ubuntu_28_0x24},
-#else
-  // character: '$' == ''
-  {0x24, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '%'
-  {0x25, &bc_font_ubuntu_28_0x25},
-#else
-  // character: '%' == ''
-  {0x25, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '&'
-  {0x26, &bc_font_ubuntu_28_0x26},
-#else
-  // character: '&' == ''
-  {0x26, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '''
-  {0x27, &bc_font_ubuntu_28_0x27},
-#else
-  // character: ''' == ''
-  {0x27, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '('
-  {0x28, &bc_font_ubuntu_28_0x28},
-#else
-  // character: '(' == ''
-  {0x28, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ')'
-  {0x29, &bc_font_ubuntu_28_0x29},
-#else
-  // character: ')' == ''
-  {0x29, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '*'
-  {0x2a, &bc_font_ubuntu_28_0x2a},
-#else
-  // character: '*' == ''
-  {0x2a, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '+'
-  {0x2b, &bc_font_ubuntu_28_0x2b},
-#else
-  // character: '+' == ''
-  {0x2b, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ','
-  {0x2c, &bc_font_ubuntu_28_0x2c},
-#else
-  // character: ',' == ''
-  {0x2c, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '-'
-  {0x2d, &bc_font_ubuntu_28_0x2d},
-#else
-  // character: '-' == ''
-  {0x2d, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '.'
-  {0x2e, &bc_font_ubuntu_28_0x2e},
-#else
-  // character: '.' == ''
-  {0x2e, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '/'
-  {0x2f, &bc_font_ubuntu_28_0x2f},
-#else
-  // character: '/' == ''
-  {0x2f, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '0'
-  {0x30, &bc_font_ubuntu_28_0x30},
-#else
-  // character: '0' == ''
-  {0x30, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '1'
-  {0x31, &bc_font_ubuntu_28_0x31},
-#else
-  // character: '1' == ''
-  {0x31, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '2'
-  {0x32, &bc_font_ubuntu_28_0x32},
-#else
-  // character: '2' == ''
-  {0x32, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '3'
-  {0x33, &bc_font_ubuntu_28_0x33},
-#else
-  // character: '3' == ''
-  {0x33, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '4'
-  {0x34, &bc_font_ubuntu_28_0x34},
-#else
-  // character: '4' == ''
-  {0x34, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '5'
-  {0x35, &bc_font_ubuntu_28_0x35},
-#else
-  // character: '5' == ''
-  {0x35, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '6'
-  {0x36, &bc_font_ubuntu_28_0x36},
-#else
-  // character: '6' == ''
-  {0x36, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '7'
-  {0x37, &bc_font_ubuntu_28_0x37},
-#else
-  // character: '7' == ''
-  {0x37, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '8'
-  {0x38, &bc_font_ubuntu_28_0x38},
-#else
-  // character: '8' == ''
-  {0x38, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '9'
-  {0x39, &bc_font_ubuntu_28_0x39},
-#else
-  // character: '9' == ''
-  {0x39, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ':'
-  {0x3a, &bc_font_ubuntu_28_0x3a},
-#else
-  // character: ':' == ''
-  {0x3a, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ';'
-  {0x3b, &bc_font_ubuntu_28_0x3b},
-#else
-  // character: ';' == ''
-  {0x3b, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '<'
-  {0x3c, &bc_font_ubuntu_28_0x3c},
-#else
-  // character: '<' == ''
-  {0x3c, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '='
-  {0x3d, &bc_font_ubuntu_28_0x3d},
-#else
-  // character: '=' == ''
-  {0x3d, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '>'
-  {0x3e, &bc_font_ubuntu_28_0x3e},
-#else
-  // character: '>' == ''
-  {0x3e, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '?'
-  {0x3f, &bc_font_ubuntu_28_0x3f},
-#else
-  // character: '?' == ''
-  {0x3f, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\x0040'
-  {0x40, &bc_font_ubuntu_28_0x40},
-#else
-  // character: '\x0040' == ''
-  {0x40, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'A'
-  {0x41, &bc_font_ubuntu_28_0x41},
-#else
-  // character: 'A' == ''
-  {0x41, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'B'
-  {0x42, &bc_font_ubuntu_28_0x42},
-#else
-  // character: 'B' == ''
-  {0x42, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'C'
-  {0x43, &bc_font_ubuntu_28_0x43},
-#else
-  // character: 'C' == ''
-  {0x43, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'D'
-  {0x44, &bc_font_ubuntu_28_0x44},
-#else
-  // character: 'D' == ''
-  {0x44, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'E'
-  {0x45, &bc_font_ubuntu_28_0x45},
-#else
-  // character: 'E' == ''
-  {0x45, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'F'
-  {0x46, &bc_font_ubuntu_28_0x46},
-#else
-  // character: 'F' == ''
-  {0x46, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'G'
-  {0x47, &bc_font_ubuntu_28_0x47},
-#else
-  // character: 'G' == ''
-  {0x47, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'H'
-  {0x48, &bc_font_ubuntu_28_0x48},
-#else
-  // character: 'H' == ''
-  {0x48, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'I'
-  {0x49, &bc_font_ubuntu_28_0x49},
-#else
-  // character: 'I' == ''
-  {0x49, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'J'
-  {0x4a, &bc_font_ubuntu_28_0x4a},
-#else
-  // character: 'J' == ''
-  {0x4a, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'K'
-  {0x4b, &bc_font_ubuntu_28_0x4b},
-#else
-  // character: 'K' == ''
-  {0x4b, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'L'
-  {0x4c, &bc_font_ubuntu_28_0x4c},
-#else
-  // character: 'L' == ''
-  {0x4c, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'M'
-  {0x4d, &bc_font_ubuntu_28_0x4d},
-#else
-  // character: 'M' == ''
-  {0x4d, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'N'
-  {0x4e, &bc_font_ubuntu_28_0x4e},
-#else
-  // character: 'N' == ''
-  {0x4e, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'O'
-  {0x4f, &bc_font_ubuntu_28_0x4f},
-#else
-  // character: 'O' == ''
-  {0x4f, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'P'
-  {0x50, &bc_font_ubuntu_28_0x50},
-#else
-  // character: 'P' == ''
-  {0x50, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Q'
-  {0x51, &bc_font_ubuntu_28_0x51},
-#else
-  // character: 'Q' == ''
-  {0x51, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'R'
-  {0x52, &bc_font_ubuntu_28_0x52},
-#else
-  // character: 'R' == ''
-  {0x52, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'S'
-  {0x53, &bc_font_ubuntu_28_0x53},
-#else
-  // character: 'S' == ''
-  {0x53, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'T'
-  {0x54, &bc_font_ubuntu_28_0x54},
-#else
-  // character: 'T' == ''
-  {0x54, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'U'
-  {0x55, &bc_font_ubuntu_28_0x55},
-#else
-  // character: 'U' == ''
-  {0x55, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'V'
-  {0x56, &bc_font_ubuntu_28_0x56},
-#else
-  // character: 'V' == ''
-  {0x56, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'W'
-  {0x57, &bc_font_ubuntu_28_0x57},
-#else
-  // character: 'W' == ''
-  {0x57, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'X'
-  {0x58, &bc_font_ubuntu_28_0x58},
-#else
-  // character: 'X' == ''
-  {0x58, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Y'
-  {0x59, &bc_font_ubuntu_28_0x59},
-#else
-  // character: 'Y' == ''
-  {0x59, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Z'
-  {0x5a, &bc_font_ubuntu_28_0x5a},
-#else
-  // character: 'Z' == ''
-  {0x5a, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '['
-  {0x5b, &bc_font_ubuntu_28_0x5b},
-#else
-  // character: '[' == ''
-  {0x5b, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\'
-  {0x5c, &bc_font_ubuntu_28_0x5c},
-#else
-  // character: '\' == ''
-  {0x5c, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ']'
-  {0x5d, &bc_font_ubuntu_28_0x5d},
-#else
-  // character: ']' == ''
-  {0x5d, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '^'
-  {0x5e, &bc_font_ubuntu_28_0x5e},
-#else
-  // character: '^' == ''
-  {0x5e, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '_'
-  {0x5f, &bc_font_ubuntu_28_0x5f},
-#else
-  // character: '_' == ''
-  {0x5f, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '`'
-  {0x60, &bc_font_ubuntu_28_0x60},
-#else
-  // character: '`' == ''
-  {0x60, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'a'
-  {0x61, &bc_font_ubuntu_28_0x61},
-#else
-  // character: 'a' == ''
-  {0x61, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'b'
-  {0x62, &bc_font_ubuntu_28_0x62},
-#else
-  // character: 'b' == ''
-  {0x62, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'c'
-  {0x63, &bc_font_ubuntu_28_0x63},
-#else
-  // character: 'c' == ''
-  {0x63, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'd'
-  {0x64, &bc_font_ubuntu_28_0x64},
-#else
-  // character: 'd' == ''
-  {0x64, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'e'
-  {0x65, &bc_font_ubuntu_28_0x65},
-#else
-  // character: 'e' == ''
-  {0x65, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'f'
-  {0x66, &bc_font_ubuntu_28_0x66},
-#else
-  // character: 'f' == ''
-  {0x66, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'g'
-  {0x67, &bc_font_ubuntu_28_0x67},
-#else
-  // character: 'g' == ''
-  {0x67, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'h'
-  {0x68, &bc_font_ubuntu_28_0x68},
-#else
-  // character: 'h' == ''
-  {0x68, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'i'
-  {0x69, &bc_font_ubuntu_28_0x69},
-#else
-  // character: 'i' == ''
-  {0x69, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'j'
-  {0x6a, &bc_font_ubuntu_28_0x6a},
-#else
-  // character: 'j' == ''
-  {0x6a, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'k'
-  {0x6b, &bc_font_ubuntu_28_0x6b},
-#else
-  // character: 'k' == ''
-  {0x6b, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'l'
-  {0x6c, &bc_font_ubuntu_28_0x6c},
-#else
-  // character: 'l' == ''
-  {0x6c, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'm'
-  {0x6d, &bc_font_ubuntu_28_0x6d},
-#else
-  // character: 'm' == ''
-  {0x6d, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'n'
-  {0x6e, &bc_font_ubuntu_28_0x6e},
-#else
-  // character: 'n' == ''
-  {0x6e, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'o'
-  {0x6f, &bc_font_ubuntu_28_0x6f},
-#else
-  // character: 'o' == ''
-  {0x6f, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'p'
-  {0x70, &bc_font_ubuntu_28_0x70},
-#else
-  // character: 'p' == ''
-  {0x70, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'q'
-  {0x71, &bc_font_ubuntu_28_0x71},
-#else
-  // character: 'q' == ''
-  {0x71, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'r'
-  {0x72, &bc_font_ubuntu_28_0x72},
-#else
-  // character: 'r' == ''
-  {0x72, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 's'
-  {0x73, &bc_font_ubuntu_28_0x73},
-#else
-  // character: 's' == ''
-  {0x73, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 't'
-  {0x74, &bc_font_ubuntu_28_0x74},
-#else
-  // character: 't' == ''
-  {0x74, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'u'
-  {0x75, &bc_font_ubuntu_28_0x75},
-#else
-  // character: 'u' == ''
-  {0x75, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'v'
-  {0x76, &bc_font_ubuntu_28_0x76},
-#else
-  // character: 'v' == ''
-  {0x76, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'w'
-  {0x77, &bc_font_ubuntu_28_0x77},
-#else
-  // character: 'w' == ''
-  {0x77, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'x'
-  {0x78, &bc_font_ubuntu_28_0x78},
-#else
-  // character: 'x' == ''
-  {0x78, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'y'
-  {0x79, &bc_font_ubuntu_28_0x79},
-#else
-  // character: 'y' == ''
-  {0x79, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'z'
-  {0x7a, &bc_font_ubuntu_28_0x7a},
-#else
-  // character: 'z' == ''
-  {0x7a, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '{'
-  {0x7b, &bc_font_ubuntu_28_0x7b},
-#else
-  // character: '{' == ''
-  {0x7b, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '|'
-  {0x7c, &bc_font_ubuntu_28_0x7c},
-#else
-  // character: '|' == ''
-  {0x7c, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '}'
-  {0x7d, &bc_font_ubuntu_28_0x7d},
-#else
-  // character: '}' == ''
-  {0x7d, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '~'
-  {0x7e, &bc_font_ubuntu_28_0x7e},
-#else
-  // character: '~' == ''
-  {0x7e, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '°'
-  {0xb0, &bc_font_ubuntu_28_0xb0},
-#else
-  // character: '°' == ''
-  {0xb0, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'š'
-  {0xb9, &bc_font_ubuntu_28_0xb9},
-#else
-  // character: 'š' == ''
-  {0xb9, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ť'
-  {0xbb, &bc_font_ubuntu_28_0xbb},
-#else
-  // character: 'ť' == ''
-  {0xbb, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ž'
-  {0xbe, &bc_font_ubuntu_28_0xbe},
-#else
-  // character: 'ž' == ''
-  {0xbe, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'á'
-  {0xe1, &bc_font_ubuntu_28_0xe1},
-#else
-  // character: 'á' == ''
-  {0xe1, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'č'
-  {0xe8, &bc_font_ubuntu_28_0xe8},
-#else
-  // character: 'č' == ''
-  {0xe8, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'é'
-  {0xe9, &bc_font_ubuntu_28_0xe9},
-#else
-  // character: 'é' == ''
-  {0xe9, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ě'
-  {0xec, &bc_font_ubuntu_28_0xec},
-#else
-  // character: 'ě' == ''
-  {0xec, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'í'
-  {0xed, &bc_font_ubuntu_28_0xed},
-#else
-  // character: 'í' == ''
-  {0xed, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ď'
-  {0xef, &bc_font_ubuntu_28_0xef},
-#else
-  // character: 'ď' == ''
-  {0xef, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ň'
-  {0xf2, &bc_font_ubuntu_28_0xf2},
-#else
-  // character: 'ň' == ''
-  {0xf2, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ř'
-  {0xf8, &bc_font_ubuntu_28_0xf8},
-#else
-  // character: 'ř' == ''
-  {0xf8, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ů'
-  {0xf9, &bc_font_ubuntu_28_0xf9},
-#else
-  // character: 'ů' == ''
-  {0xf9, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ú'
-  {0xfa, &bc_font_ubuntu_28_0xfa},
-#else
-  // character: 'ú' == ''
-  {0xfa, &bc_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ý'
-  {0xfd, &bc_font_ubuntu_28_0xfd}
-#else
-  // character: 'ý' == ''
-  {0xfd, &bc_font_ubuntu_28_0x}
-#endif
-
-};
-
-
-const bc_font_t bc_font_ubuntu_28 = { 110, bc_font_ubuntu_28_array };
+// Glyphs are compressed by sdk/tools/font/bc-font-rle.py
+
+static const uint8_t bc_font_ubuntu_28_rle_data[3224] = {
+    // ' '
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    // '!'
+    0xfc, 0x3f, 0xff, 0xff, 0xa1, 0x11, 0x61, 0xf7, 0x3f, 0xe3, 0xff, 0xc0,
+    // '"'
+    0x23, 0x23, 0xff, 0xff, 0x41, 0x11, 0x21, 0x11, 0x51, 0x41, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
+    // '#'
+    0xff, 0xff, 0x33, 0x53, 0xfb, 0x12, 0x14, 0x12, 0x1f, 0xfb, 0x43, 0x53, 0x2f, 0x63, 0x35, 0x33, 0xff, 0xff, 0xf3, 0x33, 0x53, 0x3f, 0x62, 0x35, 0x34, 0xff, 0xb1, 0x21, 0x41, 0x21, 0xfb, 0x35, 0x3f, 0xff, 0xff, 0xfb,
+    // '$'
+    0x72, 0xff, 0xe2, 0x23, 0x81, 0x71, 0x61, 0x26, 0x61, 0x21, 0x61, 0xff, 0xa1, 0xc1, 0x31, 0xf1, 0x2a, 0x24, 0x2a, 0x24, 0x2a, 0x3f, 0x11, 0x21, 0xff, 0xf7, 0x26, 0x12, 0x16, 0x68, 0x27, 0x27, 0x32, 0x2f, 0xff, 0xf0, 0x2f, 0x80,
+    // '%'
+    0xff, 0xff, 0xf0, 0x58, 0x37, 0x15, 0x19, 0x16, 0x12, 0x32, 0x15, 0x11, 0x19, 0x13, 0x1f, 0xf0, 0x11, 0x1f, 0x51, 0xfa, 0x1b, 0x13, 0x14, 0x11, 0x1a, 0x12, 0x32, 0x1f, 0x11, 0x51, 0x21, 0x11, 0x25, 0x65, 0x21, 0x11, 0x21, 0x51, 0xf1, 0x12, 0x32, 0x1a, 0x11, 0x14, 0x13, 0x1b, 0x1f, 0xa1, 0xf5, 0x11, 0x1f, 0xf0, 0x13, 0x19, 0x11, 0x15, 0x12, 0x32, 0x16, 0x19, 0x15, 0x17, 0x38, 0x5f, 0xff, 0xff, 0xff, 0xf3,
+    // '&'
+    0xff, 0xff, 0x35, 0xc2, 0x51, 0xe2, 0x31, 0x91, 0x21, 0x21, 0xff, 0xfb, 0x12, 0x19, 0x12, 0x11, 0x1e, 0x12, 0x12, 0x2b, 0x14, 0x1c, 0x12, 0x12, 0x15, 0x24, 0x12, 0x11, 0x12, 0x19, 0x12, 0x13, 0x12, 0x12, 0x11, 0x1b, 0x12, 0x2f, 0x01, 0x41, 0xe1, 0x81, 0x22, 0x42, 0x31, 0x51, 0x34, 0x22, 0x21, 0x51, 0x71, 0x21, 0x21, 0x57, 0x43, 0xff, 0xff, 0xff, 0x60,
+    // "'"
+    0x23, 0xff, 0x91, 0x11, 0x51, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    // '('
+    0x71, 0x71, 0x11, 0x51, 0x21, 0xd1, 0x21, 0xd1, 0x21, 0xf7, 0x12, 0x1f, 0xff, 0xff, 0x21, 0x21, 0xf9, 0x12, 0x1f, 0x01, 0x21, 0xf0, 0x12, 0x16, 0x11, 0x17, 0x11,
+    // ')'
+    0x11, 0x71, 0x11, 0x61, 0x21, 0xf0, 0x12, 0x1f, 0x01, 0x21, 0xf9, 0x12, 0x1f, 0xff, 0xff, 0x21, 0x21, 0xf7, 0x12, 0x1d, 0x12, 0x1d, 0x12, 0x15, 0x11, 0x17, 0x17,
+    // '*'
+    0xff, 0xe3, 0xff, 0x31, 0x21, 0x41, 0x31, 0x12, 0x23, 0x11, 0x21, 0x31, 0x11, 0x31, 0x33, 0x33, 0x61, 0x11, 0x11, 0x71, 0x51, 0x51, 0x21, 0x11, 0x21, 0x41, 0x11, 0x31, 0x11, 0x51, 0x51, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    // '+'
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xfd, 0x52, 0x5f, 0x55, 0x25, 0xff, 0xff, 0xd2, 0xff, 0xff, 0xff, 0xfe,
+    // ','
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xc1, 0x31, 0x81, 0x42, 0xb0,
+    // '-'
+    0xff, 0xff, 0xff, 0xfd, 0x7b, 0x7f, 0xff, 0xff, 0xff, 0x40,
+    // '.'
+    0xff, 0xff, 0xff, 0xff, 0x92, 0x41, 0x21, 0xa1, 0x21, 0x42, 0xff, 0x70,
+    // '/'
+    0x92, 0x81, 0x11, 0xfe, 0x11, 0x1f, 0xe1, 0x11, 0xf3, 0x1c, 0x1f, 0x31, 0x11, 0xfe, 0x11, 0x1f, 0x31, 0xc1, 0xf3, 0x11, 0x1f, 0xe1, 0x11, 0xff, 0x11, 0x91, 0xa0,
+    // '0'
+    0xff, 0xf8, 0x69, 0x16, 0x17, 0x12, 0x42, 0x15, 0x12, 0x14, 0x12, 0x1f, 0x41, 0x21, 0x61, 0x21, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x21, 0x61, 0x21, 0xf4, 0x12, 0x14, 0x12, 0x15, 0x12, 0x42, 0x17, 0x16, 0x19, 0x6f, 0xff, 0xff, 0xa0,
+    // '1'
+    0xff, 0xfb, 0x3c, 0x1e, 0x1d, 0x2d, 0x13, 0x1b, 0x11, 0x2d, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff, 0xa0,
+    // '2'
+    0xff, 0xf8, 0x59, 0x25, 0x26, 0x12, 0x49, 0x11, 0x14, 0x12, 0x16, 0x1f, 0xff, 0xb1, 0xc1, 0xe1, 0x21, 0xb1, 0x21, 0xb1, 0x21, 0xb1, 0x21, 0xb1, 0x21, 0xb1, 0x21, 0xfc, 0x12, 0x1f, 0x09, 0xf5, 0xcf, 0xff, 0xff, 0x70,
+    // '3'
+    0xff, 0xf7, 0x68, 0x26, 0x26, 0x11, 0x5a, 0x15, 0x12, 0x1f, 0xff, 0xe2, 0x21, 0x83, 0x31, 0xfa, 0x42, 0x2c, 0x1f, 0x11, 0x21, 0xff, 0xe1, 0x72, 0x51, 0x31, 0x65, 0x31, 0x51, 0x72, 0x77, 0xff, 0xff, 0xfb,
+    // '4'
+    0xff, 0xfc, 0x4f, 0xc1, 0xe1, 0xe1, 0x21, 0xb1, 0x21, 0xe1, 0xc1, 0xe1, 0x21, 0xe1, 0xc1, 0xe1, 0x21, 0xf0, 0x63, 0x2f, 0x39, 0x32, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x80,
+    // '5'
+    0xff, 0xf7, 0x9f, 0xb6, 0xff, 0xff, 0xa1, 0x33, 0xf1, 0x27, 0x54, 0x1b, 0x2f, 0x11, 0x21, 0xff, 0xff, 0x01, 0x72, 0x51, 0x31, 0x65, 0x31, 0x51, 0x72, 0x77, 0xff, 0xff, 0xfb,
+    // '6'
+    0xff, 0xfd, 0x49, 0x3c, 0x13, 0x47, 0x12, 0x2a, 0x12, 0x1b, 0x12, 0x1f, 0xc1, 0x27, 0x91, 0x61, 0x95, 0x21, 0x71, 0x81, 0xc1, 0xff, 0xf9, 0x12, 0x15, 0x12, 0x17, 0x13, 0x18, 0x13, 0x33, 0x16, 0x25, 0x29, 0x5f, 0xff, 0xff, 0xa0,
+    // '7'
+    0xff, 0xf5, 0xcf, 0x59, 0xf0, 0x12, 0x1b, 0x12, 0x1f, 0xc1, 0x21, 0xff, 0x01, 0xc1, 0xff, 0x01, 0x21, 0xff, 0xfe, 0x12, 0x1f, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xd0,
+    // '8'
+    0xff, 0xf8, 0x69, 0x16, 0x17, 0x12, 0x42, 0x15, 0x12, 0x14, 0x12, 0x1f, 0xf9, 0x1c, 0x13, 0x13, 0x12, 0x15, 0x13, 0x32, 0x17, 0x16, 0x18, 0x11, 0x14, 0x17, 0x13, 0x23, 0x15, 0x12, 0x13, 0x13, 0x1c, 0x1f, 0xf9, 0x12, 0x14, 0x12, 0x18, 0x49, 0x26, 0x28, 0x6f, 0xff, 0xff, 0xa0,
+    // '9'
+    0xff, 0xf8, 0x59, 0x25, 0x26, 0x13, 0x33, 0x18, 0x13, 0x17, 0x12, 0x15, 0x12, 0x1f, 0xff, 0x91, 0xc1, 0x81, 0x71, 0x25, 0x91, 0x61, 0x97, 0x21, 0xfc, 0x12, 0x1b, 0x1d, 0x23, 0x16, 0x43, 0x2b, 0x39, 0x4f, 0xff, 0xff, 0xf0,
+    // ':'
+    0xff, 0xf7, 0x24, 0x12, 0x1a, 0x12, 0x14, 0x2f, 0xff, 0x22, 0x41, 0x21, 0xa1, 0x21, 0x42, 0xff, 0x70,
+    // ';'
+    0xff, 0xf6, 0x24, 0x12, 0x1a, 0x12, 0x14, 0x2f, 0xff, 0x93, 0xfc, 0x13, 0x18, 0x14, 0x2b,
+    // '<'
+    0xff, 0xff, 0xff, 0xff, 0x51, 0xd2, 0x11, 0x93, 0x22, 0x72, 0x32, 0x72, 0x32, 0x63, 0x23, 0xb2, 0xe2, 0xb3, 0x23, 0xb2, 0x32, 0xb2, 0x32, 0xb3, 0x22, 0xc2, 0x11, 0xe1, 0xff, 0xff, 0xff, 0xf9,
+    // '='
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xf4, 0xdf, 0xff, 0x6d, 0xf4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xa0,
+    // '>'
+    0xff, 0xff, 0xff, 0xf9, 0x1e, 0x11, 0x2c, 0x22, 0x2c, 0x22, 0x2c, 0x22, 0x2c, 0x22, 0x2c, 0x22, 0x1b, 0x22, 0x19, 0x22, 0x28, 0x22, 0x28, 0x22, 0x28, 0x22, 0x2a, 0x11, 0x2d, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+    // '?'
+    0xff, 0x56, 0x41, 0x61, 0x31, 0x13, 0x31, 0x31, 0x31, 0xff, 0x21, 0x21, 0x61, 0xd1, 0x61, 0x21, 0xfe, 0x3f, 0xf0, 0x3f, 0xfb, 0x3f, 0xff, 0xe0,
+    // '@'
+    0xff, 0xff, 0xff, 0x17, 0xf2, 0x37, 0x3d, 0x14, 0x63, 0x1b, 0x13, 0x26, 0x22, 0x19, 0x12, 0x2a, 0x12, 0x17, 0x17, 0x63, 0x12, 0x19, 0x13, 0x16, 0x1f, 0x31, 0x23, 0x61, 0x21, 0x41, 0x21, 0xfe, 0x12, 0x1f, 0xff, 0xff, 0xff, 0xfe, 0x19, 0x12, 0x14, 0x12, 0x12, 0x1b, 0x1f, 0x01, 0x23, 0x32, 0x31, 0x91, 0x31, 0x51, 0x51, 0x71, 0x75, 0x15, 0x91, 0x22, 0xf8, 0x13, 0x2f, 0x71, 0x47, 0xf1, 0x3f, 0xc8, 0xff, 0x60,
+    // 'A'
+    0xff, 0xff, 0x54, 0xe1, 0xff, 0x61, 0x21, 0x21, 0xff, 0x01, 0x21, 0x11, 0x21, 0xff, 0xf2, 0x12, 0x13, 0x12, 0x1f, 0xb1, 0x21, 0x51, 0x21, 0xfd, 0x78, 0x1d, 0x17, 0x96, 0x12, 0x19, 0x12, 0x1f, 0xf9, 0x12, 0x1b, 0x12, 0x4d, 0x3f, 0xff, 0xff, 0xf5,
+    // 'B'
+    0xff, 0xfb, 0xaf, 0x32, 0x96, 0x31, 0xe2, 0x21, 0xff, 0xff, 0x72, 0x21, 0x76, 0x31, 0xf2, 0x18, 0x73, 0x1e, 0x13, 0x1e, 0x1f, 0xff, 0x81, 0xf1, 0x13, 0x16, 0x73, 0x1e, 0x35, 0xaf, 0xff, 0xff, 0xf6,
+    // 'C'
+    0xff, 0xfe, 0x69, 0x26, 0x26, 0x13, 0x57, 0x12, 0x25, 0x24, 0x12, 0x1f, 0xe1, 0x21, 0xff, 0xff, 0xff, 0xfa, 0x12, 0x1f, 0xf1, 0x12, 0x1f, 0x21, 0x62, 0x51, 0x36, 0x82, 0x72, 0x87, 0xff, 0xff, 0xfd,
+    // 'D'
+    0xff, 0xff, 0x29, 0xf5, 0x3b, 0x63, 0x1f, 0x12, 0x21, 0xf2, 0x12, 0x1f, 0xf7, 0x12, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x11, 0x21, 0xff, 0x51, 0x21, 0xe2, 0x21, 0x96, 0x31, 0xf1, 0x38, 0x9f, 0xff, 0xff, 0xff, 0x40,
+    // 'E'
+    0xff, 0xf5, 0xcf, 0x89, 0xff, 0xff, 0xfc, 0x8f, 0x98, 0xff, 0xff, 0xff, 0xea, 0xf4, 0xdf, 0xff, 0xff, 0x60,
+    // 'F'
+    0xff, 0xf2, 0xcf, 0x69, 0xff, 0xff, 0xf6, 0x8f, 0x78, 0xff, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xfa,
+    // 'G'
+    0xff, 0xff, 0x57, 0xa2, 0x72, 0x71, 0x36, 0x11, 0x61, 0x22, 0x61, 0x61, 0x21, 0xff, 0x31, 0x21, 0xff, 0xff, 0xf9, 0x3f, 0xfc, 0x12, 0x1f, 0xf5, 0x12, 0x1f, 0x42, 0xe2, 0x35, 0xb2, 0x81, 0xa8, 0xff, 0xff, 0xff, 0x80,
+    // 'H'
+    0xff, 0xff, 0x23, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xaf, 0xf0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xa3, 0xff, 0xff, 0xff, 0xc0,
+    // 'I'
+    0xf8, 0x3f, 0xff, 0xff, 0xff, 0xfa, 0x3f, 0xf7,
+    // 'J'
+    0xff, 0xf6, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x62, 0x41, 0x31, 0x21, 0x24, 0x31, 0x32, 0x71, 0x67, 0xff, 0xff, 0xf0,
+    // 'K'
+    0xff, 0xfb, 0x38, 0x3e, 0x12, 0x1d, 0x12, 0x1d, 0x12, 0x1d, 0x12, 0x1d, 0x12, 0x1d, 0x12, 0x1d, 0x12, 0x1d, 0x12, 0x1f, 0x21, 0xe1, 0x31, 0xe1, 0x31, 0xe1, 0x32, 0xd2, 0x31, 0xe1, 0x31, 0xff, 0x21, 0x31, 0xe1, 0x31, 0xe1, 0x31, 0x23, 0x94, 0xff, 0xff, 0xff, 0x00,
+    // 'L'
+    0xff, 0xf2, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xf2, 0xdf, 0xff, 0xff, 0x00,
+    // 'M'
+    0xff, 0xff, 0xf3, 0x3d, 0x39, 0x1b, 0x1f, 0xf8, 0x19, 0x1f, 0x01, 0xf7, 0x19, 0x11, 0x1b, 0x13, 0x19, 0x17, 0x14, 0x17, 0x11, 0x1f, 0xe1, 0xc1, 0x31, 0xf3, 0x17, 0x1f, 0x41, 0x11, 0xf5, 0x15, 0x1f, 0x61, 0xff, 0xf2, 0x13, 0x1f, 0x63, 0xff, 0xff, 0x33, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xf7,
+    // 'N'
+    0xff, 0xff, 0x23, 0xa3, 0x71, 0xf5, 0x1f, 0x51, 0xf5, 0x1f, 0x11, 0xf5, 0x12, 0x1f, 0x21, 0x21, 0xf2, 0x1f, 0x71, 0xf2, 0x12, 0x1f, 0x21, 0xf7, 0x1f, 0x21, 0x21, 0xf2, 0x1f, 0xfa, 0x1f, 0x51, 0xfc, 0x3a, 0x3f, 0xff, 0xff, 0xfc,
+    // 'O'
+    0xff, 0xff, 0xe6, 0xe2, 0x62, 0xb1, 0x34, 0x31, 0x91, 0x22, 0x42, 0x21, 0x71, 0x21, 0x81, 0x21, 0xfc, 0x12, 0x1a, 0x12, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x11, 0x21, 0xa1, 0x21, 0xfc, 0x12, 0x18, 0x12, 0x17, 0x12, 0x24, 0x22, 0x19, 0x13, 0x43, 0x1b, 0x26, 0x2e, 0x6f, 0xff, 0xff, 0xff, 0xd0,
+    // 'P'
+    0xff, 0xf8, 0x9f, 0x23, 0x86, 0x31, 0xd1, 0xf2, 0x12, 0x1f, 0xff, 0xf4, 0x1f, 0x01, 0x31, 0x66, 0x31, 0xe2, 0x87, 0xff, 0xff, 0xff, 0xf4, 0x3f, 0xff, 0xff, 0xf7,
+    // 'Q'
+    0xff, 0xff, 0xe6, 0xe2, 0x62, 0xb1, 0x34, 0x31, 0x91, 0x22, 0x42, 0x21, 0x71, 0x21, 0x81, 0x21, 0xfc, 0x12, 0x1a, 0x12, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x11, 0x21, 0xa1, 0x21, 0xfc, 0x12, 0x18, 0x12, 0x1a, 0x24, 0x22, 0x18, 0x23, 0x43, 0x1b, 0x26, 0x2e, 0x23, 0x1f, 0x31, 0x21, 0xf7, 0x2f, 0x22, 0x32, 0xf2, 0x2f, 0x73, 0x40,
+    // 'R'
+    0xff, 0xfb, 0xaf, 0x32, 0x96, 0x31, 0xe1, 0xf3, 0x12, 0x1f, 0xff, 0xf8, 0x1f, 0x11, 0x31, 0x76, 0x31, 0xf0, 0x29, 0x43, 0x1e, 0x13, 0x1e, 0x13, 0x1e, 0x1f, 0x61, 0xe1, 0x31, 0xe1, 0x63, 0x93, 0xff, 0xff, 0xff, 0x10,
+    // 'S'
+    0xff, 0xf4, 0x77, 0x17, 0x24, 0x12, 0x61, 0x13, 0x12, 0x16, 0x1f, 0xf7, 0x1b, 0x13, 0x2a, 0x14, 0x38, 0x16, 0x27, 0x35, 0x19, 0x33, 0x1b, 0x1f, 0xff, 0x53, 0x61, 0x21, 0x56, 0x21, 0x32, 0x72, 0x67, 0xff, 0xff, 0xf5,
+    // 'T'
+    0xff, 0xf0, 0xf0, 0xf0, 0x63, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff, 0x60,
+    // 'U'
+    0xff, 0xfe, 0x39, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x12, 0x17, 0x12, 0x18, 0x15, 0x19, 0x13, 0x53, 0x17, 0x27, 0x2a, 0x7f, 0xff, 0xff, 0xfb,
+    // 'V'
+    0xff, 0xfc, 0x3d, 0x42, 0x1b, 0x12, 0x1f, 0xf9, 0x12, 0x19, 0x12, 0x1f, 0xa1, 0x71, 0x71, 0xd1, 0xf9, 0x12, 0x15, 0x12, 0x1f, 0xb1, 0x21, 0x31, 0x21, 0xff, 0x11, 0x11, 0xd1, 0x71, 0xe1, 0xf0, 0x15, 0x1f, 0xf2, 0x13, 0x1f, 0x03, 0xff, 0xff, 0xff, 0xd0,
+    // 'W'
+    0xff, 0xff, 0xf7, 0x3f, 0x43, 0xff, 0x21, 0x73, 0x71, 0x51, 0xd1, 0x91, 0xc1, 0xff, 0xfa, 0x1f, 0x31, 0x41, 0x51, 0x41, 0x71, 0xf6, 0x1e, 0x1f, 0x81, 0x41, 0x21, 0xff, 0xc1, 0x41, 0x81, 0x91, 0x41, 0x61, 0x21, 0x41, 0xff, 0xa1, 0xf8, 0x18, 0x12, 0x1b, 0x1f, 0x21, 0xd1, 0xf7, 0x48, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x50,
+    // 'X'
+    0xff, 0xfa, 0x3a, 0x32, 0x12, 0x18, 0x12, 0x13, 0x12, 0x16, 0x12, 0x1f, 0x81, 0x21, 0x41, 0x21, 0x71, 0x21, 0x21, 0x21, 0xfc, 0x12, 0x22, 0x1b, 0x14, 0x1f, 0xff, 0x31, 0x41, 0xb1, 0x22, 0x21, 0xfc, 0x12, 0x12, 0x12, 0x17, 0x12, 0x14, 0x12, 0x15, 0x1c, 0x17, 0x16, 0x16, 0x12, 0x18, 0x12, 0x12, 0x3a, 0x3f, 0xff, 0xff, 0xf1,
+    // 'Y'
+    0xff, 0xf6, 0x3b, 0x42, 0x19, 0x12, 0x1f, 0x31, 0x21, 0x71, 0x21, 0x31, 0x21, 0x51, 0x21, 0xf7, 0x12, 0x13, 0x12, 0x17, 0x12, 0x11, 0x12, 0x1f, 0xb1, 0x21, 0x21, 0xb1, 0x31, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xf2,
+    // 'Z'
+    0xff, 0xf5, 0xdf, 0x4a, 0xf0, 0x12, 0x1b, 0x12, 0x1b, 0x12, 0x1f, 0xc1, 0x21, 0xb1, 0x21, 0xb1, 0x21, 0xfc, 0x12, 0x1b, 0x12, 0x1f, 0xc1, 0x21, 0xfc, 0x12, 0x1b, 0x13, 0xaf, 0x3e, 0xff, 0xff, 0xf6,
+    // '['
+    0x36, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xc6,
+    // '\\'
+    0x01, 0xb1, 0xff, 0x11, 0x11, 0xff, 0x11, 0x11, 0xf7, 0x18, 0x1f, 0x71, 0x11, 0xff, 0x11, 0x11, 0xf7, 0x18, 0x1f, 0x71, 0x11, 0xff, 0x11, 0x11, 0xff, 0x11, 0x11, 0x92,
+    // ']'
+    0x06, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x3f, 0x06, 0x30,
+    // '^'
+    0xff, 0xf9, 0x3c, 0x13, 0x1f, 0xb1, 0x21, 0x21, 0xf9, 0x12, 0x11, 0x12, 0x1f, 0x71, 0x21, 0x31, 0x21, 0x71, 0x51, 0x61, 0xb1, 0x31, 0x11, 0x71, 0x11, 0x41, 0x91, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
+    // '_'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xee, 0xe0,
+    // '`'
+    0xe1, 0x91, 0x11, 0x81, 0x21, 0x81, 0x21, 0x81, 0x11, 0x91, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    // 'a'
+    0xff, 0xff, 0xff, 0xf3, 0x7f, 0x02, 0x66, 0xf0, 0x12, 0x1f, 0xf6, 0x67, 0x2c, 0x13, 0x59, 0x1f, 0xfe, 0x1b, 0x13, 0x57, 0x2f, 0x09, 0xff, 0xff, 0xf2,
+    // 'b'
+    0x23, 0xff, 0xff, 0xff, 0xf8, 0x5a, 0x15, 0x29, 0x43, 0x17, 0x14, 0x1f, 0x11, 0x21, 0xff, 0xff, 0xff, 0x21, 0xf3, 0x1b, 0x12, 0x17, 0x52, 0x15, 0x18, 0x17, 0x8f, 0xff, 0xff, 0xa0,
+    // 'c'
+    0xff, 0xff, 0xff, 0x66, 0x61, 0x61, 0x41, 0x26, 0x31, 0x21, 0xf6, 0x12, 0x1f, 0xff, 0xf4, 0x19, 0x1f, 0x11, 0x51, 0x31, 0x35, 0x52, 0x61, 0x66, 0xff, 0xff, 0x70,
+    // 'd'
+    0xb3, 0xff, 0xff, 0xff, 0xd5, 0x92, 0x51, 0x71, 0x34, 0xb1, 0x41, 0x61, 0x21, 0xff, 0xff, 0xff, 0x51, 0xc1, 0xf1, 0x12, 0x1d, 0x12, 0x59, 0x18, 0x17, 0x8f, 0xff, 0xff, 0x80,
+    // 'e'
+    0xff, 0xff, 0xff, 0xfd, 0x59, 0x25, 0x26, 0x12, 0x43, 0x14, 0x12, 0x14, 0x19, 0x16, 0x12, 0x12, 0x1f, 0x38, 0xf9, 0xbf, 0x61, 0xc1, 0xf1, 0x12, 0x26, 0x15, 0x13, 0x67, 0x27, 0x18, 0x7f, 0xff, 0xff, 0x80,
+    // 'f'
+    0x56, 0x32, 0xc5, 0x21, 0x21, 0xff, 0xd5, 0xf2, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0x10,
+    // 'g'
+    0xff, 0xff, 0xff, 0xfc, 0x87, 0x18, 0x14, 0x22, 0x5a, 0x1b, 0x12, 0x1f, 0xff, 0xff, 0xf2, 0x12, 0x1f, 0x11, 0x41, 0x71, 0x34, 0x92, 0x51, 0xa5, 0xff, 0x21, 0x71, 0x61, 0x31, 0x56, 0x31, 0x51, 0x72, 0x77, 0x60,
+    // 'h'
+    0x23, 0xff, 0xff, 0xff, 0xf7, 0x6f, 0x11, 0x95, 0x21, 0xf1, 0x1c, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0x63, 0xff, 0xff, 0xf7,
+    // 'i'
+    0x93, 0xb3, 0xfa, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xf7,
+    // 'j'
+    0x93, 0xb3, 0xfa, 0x3f, 0xff, 0xff, 0xff, 0xa1, 0x21, 0x21, 0x82, 0x32, 0x50,
+    // 'k'
+    0x23, 0xff, 0xff, 0xff, 0xf5, 0x4e, 0x1a, 0x12, 0x1a, 0x12, 0x1a, 0x12, 0x1a, 0x12, 0x1a, 0x12, 0x1e, 0x1b, 0x13, 0x1b, 0x13, 0x1b, 0x13, 0x1b, 0x13, 0x1b, 0x1f, 0x31, 0xb1, 0x31, 0x23, 0x64, 0xff, 0xff, 0xf0,
+    // 'l'
+    0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0x41, 0x31, 0x41, 0x83, 0xff, 0xb0,
+    // 'm'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x83, 0x67, 0x18, 0x36, 0x28, 0x54, 0x5f, 0x11, 0x81, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x63, 0x63, 0xff, 0xff, 0xff, 0xff, 0x70,
+    // 'n'
+    0xff, 0xff, 0xff, 0xfa, 0x87, 0x18, 0x19, 0x52, 0x1f, 0x11, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x36, 0x3f, 0xff, 0xff, 0x70,
+    // 'o'
+    0xff, 0xff, 0xff, 0xff, 0x55, 0xa2, 0x52, 0x71, 0x25, 0x21, 0x51, 0x21, 0x51, 0x21, 0xf5, 0x12, 0x17, 0x12, 0x1f, 0xff, 0xfa, 0x12, 0x17, 0x12, 0x1f, 0x51, 0x21, 0x51, 0x21, 0x51, 0x25, 0x21, 0x72, 0x52, 0xa5, 0xff, 0xff, 0xff, 0x10,
+    // 'p'
+    0xff, 0xff, 0xff, 0xfa, 0x87, 0x18, 0x19, 0x52, 0x1d, 0x12, 0x1f, 0x11, 0xc1, 0xff, 0xff, 0xff, 0x51, 0x21, 0x61, 0x41, 0xb4, 0x31, 0x71, 0x52, 0x95, 0xff, 0xff, 0xb3, 0xb0,
+    // 'q'
+    0xff, 0xff, 0xff, 0xfc, 0x87, 0x18, 0x15, 0x12, 0x57, 0x12, 0x1b, 0x1f, 0x31, 0xff, 0xff, 0xff, 0x21, 0x21, 0xf1, 0x14, 0x17, 0x13, 0x49, 0x25, 0x1a, 0x5f, 0xff, 0xff, 0x63, 0x20,
+    // 'r'
+    0xff, 0xff, 0xf6, 0x72, 0x2c, 0x6f, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xf1,
+    // 's'
+    0xff, 0xff, 0xfd, 0x64, 0x29, 0x13, 0x47, 0x14, 0x1f, 0x31, 0xc2, 0x61, 0x53, 0x43, 0x51, 0x62, 0xc1, 0xf2, 0x15, 0x16, 0x53, 0x12, 0x16, 0x24, 0x6f, 0xff, 0xf4,
+    // 't'
+    0xf9, 0x3f, 0xff, 0xa4, 0xf3, 0x4f, 0xff, 0xff, 0xff, 0x11, 0x31, 0x31, 0x33, 0x51, 0x51, 0x55, 0xff, 0xfc,
+    // 'u'
+    0xff, 0xff, 0xff, 0xf9, 0x36, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xc1, 0xf1, 0x12, 0x59, 0x18, 0x17, 0x8f, 0xff, 0xff, 0x80,
+    // 'v'
+    0xff, 0xff, 0xff, 0x13, 0x73, 0xd1, 0x21, 0x51, 0x21, 0xfc, 0x12, 0x13, 0x12, 0x1f, 0xe1, 0x21, 0x11, 0x21, 0xf6, 0x19, 0x15, 0x1f, 0xf3, 0x13, 0x19, 0x3f, 0xff, 0xfa,
+    // 'w'
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x36, 0x36, 0x3f, 0x61, 0xf4, 0x13, 0x14, 0x13, 0x14, 0x1f, 0xf4, 0x1b, 0x15, 0x15, 0x15, 0x1f, 0xb1, 0x41, 0x11, 0x41, 0xa1, 0x71, 0x81, 0xf0, 0x1a, 0x13, 0x1d, 0x19, 0x18, 0x1d, 0x1a, 0x15, 0x1b, 0x37, 0x3f, 0xff, 0xff, 0xff, 0x40,
+    // 'x'
+    0xff, 0xff, 0xff, 0x83, 0x73, 0x11, 0x21, 0x51, 0x21, 0x21, 0x21, 0x31, 0x21, 0xf3, 0x12, 0x11, 0x12, 0x16, 0x12, 0x12, 0x18, 0x13, 0x1f, 0x81, 0x31, 0xf7, 0x12, 0x12, 0x16, 0x12, 0x11, 0x12, 0x1f, 0x31, 0x21, 0x31, 0x21, 0x21, 0x21, 0x51, 0x21, 0x13, 0x73, 0xff, 0xff, 0xb0,
+    // 'y'
+    0xff, 0xff, 0xff, 0x83, 0x73, 0xf0, 0x12, 0x15, 0x12, 0x1f, 0xf0, 0x12, 0x13, 0x12, 0x1f, 0xf2, 0x12, 0x11, 0x12, 0x1f, 0xfa, 0x17, 0x12, 0x1f, 0xe1, 0xff, 0xa1, 0x64, 0x21, 0xc1, 0x85, 0x90,
+    // 'z'
+    0xff, 0xff, 0xff, 0x2b, 0xf0, 0x8c, 0x12, 0x18, 0x12, 0x18, 0x12, 0x18, 0x12, 0x1f, 0x61, 0x21, 0x81, 0x21, 0xf6, 0x12, 0x18, 0x12, 0x1c, 0x8f, 0x0b, 0xff, 0xff, 0x60,
+    // '{'
+    0x64, 0x51, 0x81, 0x32, 0x71, 0xff, 0xff, 0xf0, 0x17, 0x23, 0x18, 0x15, 0x22, 0x17, 0x12, 0x1f, 0xff, 0xff, 0xf0, 0x16, 0x13, 0x25, 0x2a, 0x30,
+    // '|'
+    0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x42, 0x30,
+    // '}'
+    0x03, 0x91, 0x51, 0x31, 0x51, 0xff, 0xff, 0xf0, 0x15, 0x13, 0x24, 0x18, 0x12, 0x23, 0x12, 0x1f, 0xff, 0xff, 0x11, 0x71, 0x31, 0x62, 0x52, 0x70,
+    // '~'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x45, 0x24, 0x14, 0x22, 0x15, 0x12, 0x23, 0x22, 0x15, 0x12, 0x24, 0x14, 0x25, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    // '°'
+    0xc3, 0x51, 0x31, 0x31, 0x13, 0x11, 0xf5, 0x11, 0x31, 0x13, 0x13, 0x15, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
+    // 'š'
+    0xf0, 0x13, 0x16, 0x11, 0x11, 0x11, 0x15, 0x12, 0x12, 0x16, 0x13, 0x18, 0x11, 0x1a, 0x1a, 0x64, 0x29, 0x13, 0x47, 0x14, 0x1f, 0x31, 0xc2, 0x61, 0x53, 0x43, 0x51, 0x62, 0xc1, 0xf2, 0x15, 0x16, 0x53, 0x12, 0x16, 0x24, 0x6f, 0xff, 0xf4,
+    // 'ť'
+    0x72, 0xf0, 0x3f, 0xa1, 0x91, 0xf4, 0x4f, 0x34, 0xff, 0xff, 0xff, 0xf1, 0x13, 0x13, 0x13, 0x35, 0x15, 0x15, 0x5f, 0xff, 0xc0,
+    // 'ž'
+    0xf2, 0x13, 0x17, 0x11, 0x11, 0x11, 0x16, 0x12, 0x12, 0x17, 0x13, 0x19, 0x11, 0x1b, 0x17, 0xbf, 0x08, 0xc1, 0x21, 0x81, 0x21, 0x81, 0x21, 0x81, 0x21, 0xf6, 0x12, 0x18, 0x12, 0x1f, 0x61, 0x21, 0x81, 0x21, 0xc8, 0xf0, 0xbf, 0xff, 0xf6,
+    // 'á'
+    0xf9, 0x1d, 0x11, 0x1b, 0x12, 0x1a, 0x12, 0x1b, 0x11, 0x1d, 0x1a, 0x7f, 0x02, 0x66, 0xf0, 0x12, 0x1f, 0xf6, 0x67, 0x2c, 0x13, 0x59, 0x1f, 0xfe, 0x1b, 0x13, 0x57, 0x2f, 0x09, 0xff, 0xff, 0xf2,
+    // 'č'
+    0xf3, 0x13, 0x17, 0x11, 0x11, 0x11, 0x16, 0x12, 0x12, 0x17, 0x13, 0x19, 0x11, 0x1b, 0x1a, 0x66, 0x16, 0x14, 0x12, 0x63, 0x12, 0x1f, 0x61, 0x21, 0xff, 0xff, 0x41, 0x91, 0xf1, 0x15, 0x13, 0x13, 0x55, 0x26, 0x16, 0x6f, 0xff, 0xf7,
+    // 'é'
+    0xfa, 0x1e, 0x11, 0x1c, 0x12, 0x1b, 0x12, 0x1c, 0x11, 0x1e, 0x1e, 0x59, 0x25, 0x26, 0x12, 0x43, 0x14, 0x12, 0x14, 0x19, 0x16, 0x12, 0x12, 0x1f, 0x38, 0xf9, 0xbf, 0x61, 0xc1, 0xf1, 0x12, 0x26, 0x15, 0x13, 0x67, 0x27, 0x18, 0x7f, 0xff, 0xff, 0x80,
+    // 'ě'
+    0x61, 0x31, 0xa1, 0x11, 0x11, 0x11, 0x91, 0x21, 0x21, 0xa1, 0x31, 0xc1, 0x11, 0xe1, 0xfe, 0x59, 0x25, 0x26, 0x12, 0x43, 0x14, 0x12, 0x14, 0x19, 0x16, 0x12, 0x12, 0x1f, 0x38, 0xf9, 0xbf, 0x61, 0xc1, 0xf1, 0x12, 0x26, 0x15, 0x13, 0x67, 0x27, 0x18, 0x7f, 0xff, 0xff, 0x80,
+    // 'í'
+    0xc1, 0x51, 0x11, 0x31, 0x21, 0x21, 0x21, 0x31, 0x11, 0x51, 0x53, 0xff, 0xff, 0xff, 0xc3, 0xff, 0x70,
+    // 'ď'
+    0xb3, 0x33, 0xff, 0xff, 0xf4, 0x1f, 0xf7, 0x26, 0x5d, 0x25, 0x1b, 0x13, 0x4f, 0x01, 0x41, 0xa1, 0x21, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0x11, 0xf5, 0x12, 0x1f, 0x21, 0x25, 0xd1, 0x81, 0xb8, 0xff, 0xff, 0xff, 0xf2,
+    // 'ň'
+    0xf6, 0x13, 0x1a, 0x11, 0x11, 0x11, 0x19, 0x12, 0x12, 0x1a, 0x13, 0x1c, 0x11, 0x1e, 0x1b, 0x87, 0x18, 0x19, 0x52, 0x1f, 0x11, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x36, 0x3f, 0xff, 0xff, 0x70,
+    // 'ř'
+    0xf0, 0x13, 0x15, 0x11, 0x11, 0x11, 0x14, 0x12, 0x12, 0x15, 0x13, 0x17, 0x11, 0x19, 0x18, 0x72, 0x2c, 0x6f, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xf1,
+    // 'ů'
+    0x55, 0xa1, 0x13, 0x11, 0xff, 0xfc, 0x11, 0x31, 0x1a, 0x58, 0x36, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xc1, 0xf1, 0x12, 0x59, 0x18, 0x17, 0x8f, 0xff, 0xff, 0x80,
+    // 'ú'
+    0xfa, 0x1e, 0x11, 0x1c, 0x12, 0x1b, 0x12, 0x1c, 0x11, 0x1e, 0x1a, 0x36, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xc1, 0xf1, 0x12, 0x59, 0x18, 0x17, 0x8f, 0xff, 0xff, 0x80,
+    // 'ý'
+    0xf7, 0x1c, 0x11, 0x1a, 0x12, 0x19, 0x12, 0x1a, 0x11, 0x1c, 0x17, 0x37, 0x3f, 0x01, 0x21, 0x51, 0x21, 0xff, 0x01, 0x21, 0x31, 0x21, 0xff, 0x21, 0x21, 0x11, 0x21, 0xff, 0xa1, 0x71, 0x21, 0xfe, 0x1f, 0xfa, 0x16, 0x42, 0x1c, 0x18, 0x59,
+};
+
+static const bc_font_rle_char_t bc_font_ubuntu_28_rle_chars[110] = {
+    { 0x20, 6, 0 },
+    { 0x21, 8, 6 },
+    { 0x22, 12, 18 },
+    { 0x23, 19, 37 },
+    { 0x24, 16, 73 },
+    { 0x25, 24, 111 },
+    { 0x26, 19, 179 },
+    { 0x27, 7, 238 },
+    { 0x28, 9, 248 },
+    { 0x29, 9, 275 },
+    { 0x2a, 13, 302 },
+    { 0x2b, 16, 339 },
+    { 0x2c, 7, 358 },
+    { 0x2d, 9, 369 },
+    { 0x2e, 7, 379 },
+    { 0x2f, 11, 391 },
+    { 0x30, 16, 418 },
+    { 0x31, 16, 456 },
+    { 0x32, 16, 478 },
+    { 0x33, 16, 514 },
+    { 0x34, 16, 548 },
+    { 0x35, 16, 577 },
+    { 0x36, 16, 606 },
+    { 0x37, 16, 644 },
+    { 0x38, 16, 671 },
+    { 0x39, 16, 717 },
+    { 0x3a, 7, 754 },
+    { 0x3b, 7, 771 },
+    { 0x3c, 16, 786 },
+    { 0x3d, 16, 818 },
+    { 0x3e, 16, 835 },
+    { 0x3f, 11, 869 },
+    { 0x40, 27, 893 },
+    { 0x41, 19, 961 },
+    { 0x42, 18, 1002 },
+    { 0x43, 17, 1035 },
+    { 0x44, 20, 1068 },
+    { 0x45, 16, 1103 },
+    { 0x46, 15, 1121 },
+    { 0x47, 19, 1138 },
+    { 0x48, 20, 1174 },
+    { 0x49, 7, 1197 },
+    { 0x4a, 14, 1205 },
+    { 0x4b, 18, 1227 },
+    { 0x4c, 15, 1271 },
+    { 0x4d, 25, 1288 },
+    { 0x4e, 20, 1336 },
+    { 0x4f, 22, 1374 },
+    { 0x50, 17, 1422 },
+    { 0x51, 22, 1449 },
+    { 0x52, 18, 1503 },
+    { 0x53, 15, 1539 },
+    { 0x54, 15, 1575 },
+    { 0x55, 19, 1593 },
+    { 0x56, 19, 1621 },
+    { 0x57, 27, 1663 },
+    { 0x58, 18, 1716 },
+    { 0x59, 17, 1770 },
+    { 0x5a, 16, 1808 },
+    { 0x5b, 9, 1841 },
+    { 0x5c, 11, 1852 },
+    { 0x5d, 9, 1880 },
+    { 0x5e, 16, 1892 },
+    { 0x5f, 14, 1927 },
+    { 0x60, 11, 1941 },
+    { 0x61, 15, 1959 },
+    { 0x62, 16, 1984 },
+    { 0x63, 13, 2014 },
+    { 0x64, 16, 2041 },
+    { 0x65, 16, 2070 },
+    { 0x66, 11, 2104 },
+    { 0x67, 16, 2121 },
+    { 0x68, 16, 2156 },
+    { 0x69, 7, 2178 },
+    { 0x6a, 7, 2187 },
+    { 0x6b, 15, 2200 },
+    { 0x6c, 8, 2235 },
+    { 0x6d, 25, 2248 },
+    { 0x6e, 16, 2281 },
+    { 0x6f, 17, 2303 },
+    { 0x70, 16, 2342 },
+    { 0x71, 16, 2371 },
+    { 0x72, 11, 2401 },
+    { 0x73, 12, 2414 },
+    { 0x74, 11, 2441 },
+    { 0x75, 16, 2459 },
+    { 0x76, 13, 2481 },
+    { 0x77, 21, 2509 },
+    { 0x78, 14, 2553 },
+    { 0x79, 14, 2599 },
+    { 0x7a, 13, 2631 },
+    { 0x7b, 10, 2659 },
+    { 0x7c, 8, 2683 },
+    { 0x7d, 9, 2693 },
+    { 0x7e, 16, 2717 },
+    { 0xb0, 9, 2744 },
+    { 0xb9, 12, 2763 },
+    { 0xbb, 11, 2802 },
+    { 0xbe, 13, 2823 },
+    { 0xe1, 15, 2862 },
+    { 0xe8, 13, 2894 },
+    { 0xe9, 16, 2932 },
+    { 0xec, 16, 2973 },
+    { 0xed, 7, 3018 },
+    { 0xef, 20, 3035 },
+    { 0xf2, 16, 3070 },
+    { 0xf8, 11, 3103 },
+    { 0xf9, 16, 3128 },
+    { 0xfa, 16, 3156 },
+    { 0xfd, 14, 3185 },
+};
+
+static const uint8_t bc_font_ubuntu_28_index[BC_FONT_INDEX_LENGTH] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xff, 0x61, 0xff, 0xff, 0x62, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x65, 0xff, 0xff, 0x66, 0x67, 0xff, 0x68,
+    0xff, 0xff, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x6b, 0x6c, 0xff, 0xff, 0x6d, 0xff, 0xff,
+};
+
+const bc_font_t bc_font_ubuntu_28 = { 110, NULL, bc_font_ubuntu_28_index, 28, bc_font_ubuntu_28_rle_chars, bc_font_ubuntu_28_rle_data };
@@ -27,5293 +27,359 @@
 
 #include <bc_font_common.h>
 
-
-
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x20[33] = {
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe, 
-    0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x20 = { image_data_bc_font_ubuntu_33_0x20,
-    7, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x21[66] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xf7, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xe3, 0x80, 
-    0xc1, 0x80, 
-    0xc1, 0x80, 
-    0xe3, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x21 = { image_data_bc_font_ubuntu_33_0x21,
-    9, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x22[66] = {
-    0xff, 0xf8, 
-    0xc7, 0x18, 
-    0xc7, 0x18, 
-    0xc7, 0x18, 
-    0xc7, 0x18, 
-    0xc7, 0x18, 
-    0xc7, 0x18, 
-    0xc7, 0x18, 
-    0xef, 0xb8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x22 = { image_data_bc_font_ubuntu_33_0x22,
-    13, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x23[99] = {
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0x1c, 0x78, 
-    0xff, 0x1c, 0x78, 
-    0xff, 0x1c, 0x78, 
-    0xfe, 0x38, 0xf8, 
-    0xfe, 0x38, 0xf8, 
-    0xfe, 0x38, 0xf8, 
-    0xc0, 0x00, 0x18, 
-    0xc0, 0x00, 0x18, 
-    0xc0, 0x00, 0x18, 
-    0xfc, 0x71, 0xf8, 
-    0xfc, 0x71, 0xf8, 
-    0xfc, 0x71, 0xf8, 
-    0xfc, 0x71, 0xf8, 
-    0xc0, 0x00, 0x18, 
-    0xc0, 0x00, 0x18, 
-    0xc0, 0x00, 0x18, 
-    0xf8, 0xe3, 0xf8, 
-    0xf8, 0xe3, 0xf8, 
-    0xf8, 0xe3, 0xf8, 
-    0xf1, 0xc7, 0xf8, 
-    0xf1, 0xc7, 0xf8, 
-    0xf1, 0xc7, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x23 = { image_data_bc_font_ubuntu_33_0x23,
-    21, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x24[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xfc, 0x03, 0xc0, 
-    0xf0, 0x01, 0xc0, 
-    0xe0, 0x01, 0xc0, 
-    0xc3, 0xfb, 0xc0, 
-    0xc7, 0xff, 0xc0, 
-    0xc7, 0xff, 0xc0, 
-    0xc7, 0xff, 0xc0, 
-    0xc3, 0xff, 0xc0, 
-    0xe0, 0x7f, 0xc0, 
-    0xf0, 0x1f, 0xc0, 
-    0xfc, 0x07, 0xc0, 
-    0xff, 0x03, 0xc0, 
-    0xff, 0xe1, 0xc0, 
-    0xff, 0xf0, 0xc0, 
-    0xff, 0xf8, 0xc0, 
-    0xff, 0xf8, 0xc0, 
-    0xff, 0xf8, 0xc0, 
-    0xe7, 0xf0, 0xc0, 
-    0xc0, 0x01, 0xc0, 
-    0xc0, 0x03, 0xc0, 
-    0xf0, 0x07, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x24 = { image_data_bc_font_ubuntu_33_0x24,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x25[132] = {
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0, 
-    0xf8, 0x3f, 0xc7, 0xe0, 
-    0xe0, 0x0f, 0x8f, 0xe0, 
-    0xe3, 0x8f, 0x8f, 0xe0, 
-    0xc7, 0xc7, 0x1f, 0xe0, 
-    0xc7, 0xc7, 0x1f, 0xe0, 
-    0xc7, 0xc6, 0x3f, 0xe0, 
-    0xc7, 0xc4, 0x7f, 0xe0, 
-    0xc7, 0xc4, 0x7f, 0xe0, 
-    0xe3, 0x88, 0xff, 0xe0, 
-    0xe0, 0x08, 0xff, 0xe0, 
-    0xf8, 0x31, 0xff, 0xe0, 
-    0xff, 0xf1, 0x83, 0xe0, 
-    0xff, 0xe2, 0x00, 0xe0, 
-    0xff, 0xe2, 0x38, 0xe0, 
-    0xff, 0xc4, 0x7c, 0x60, 
-    0xff, 0xc4, 0x7c, 0x60, 
-    0xff, 0x8c, 0x7c, 0x60, 
-    0xff, 0x1c, 0x7c, 0x60, 
-    0xff, 0x1c, 0x7c, 0x60, 
-    0xfe, 0x3e, 0x38, 0xe0, 
-    0xfe, 0x3e, 0x00, 0xe0, 
-    0xfc, 0x7f, 0x83, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x25 = { image_data_bc_font_ubuntu_33_0x25,
-    27, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x26[99] = {
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xfc, 0x0f, 0xf8, 
-    0xf8, 0x03, 0xf8, 
-    0xf0, 0x03, 0xf8, 
-    0xe1, 0xe1, 0xf8, 
-    0xe3, 0xf1, 0xf8, 
-    0xe3, 0xf1, 0xf8, 
-    0xe3, 0xe1, 0xf8, 
-    0xf3, 0x83, 0xf8, 
-    0xf0, 0x07, 0xf8, 
-    0xf8, 0x1f, 0xf8, 
-    0xf0, 0x3f, 0xf8, 
-    0xe0, 0x3f, 0x98, 
-    0xc1, 0x1f, 0x18, 
-    0xc7, 0x8f, 0x18, 
-    0x8f, 0xc6, 0x38, 
-    0x8f, 0xe0, 0x38, 
-    0x8f, 0xf0, 0x78, 
-    0x8f, 0xf8, 0xf8, 
-    0xc3, 0xf0, 0x78, 
-    0xc0, 0x00, 0x38, 
-    0xe0, 0x07, 0x18, 
-    0xf8, 0x1f, 0x88, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x26 = { image_data_bc_font_ubuntu_33_0x26,
-    21, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x27[33] = {
-    0xff, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xc7, 
-    0xef, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x27 = { image_data_bc_font_ubuntu_33_0x27,
-    8, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x28[66] = {
-    0xff, 0xe0, 
-    0xff, 0xa0, 
-    0xff, 0x00, 
-    0xfe, 0x20, 
-    0xfc, 0x60, 
-    0xfc, 0x60, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xfc, 0x60, 
-    0xfc, 0x60, 
-    0xfe, 0x20, 
-    0xff, 0x00, 
-    0xff, 0xa0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x28 = { image_data_bc_font_ubuntu_33_0x28,
-    11, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x29[66] = {
-    0xff, 0xc0, 
-    0x7f, 0xc0, 
-    0x3f, 0xc0, 
-    0x1f, 0xc0, 
-    0x8f, 0xc0, 
-    0x8f, 0xc0, 
-    0xc7, 0xc0, 
-    0xc7, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xf1, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xc7, 0xc0, 
-    0xc7, 0xc0, 
-    0x8f, 0xc0, 
-    0x8f, 0xc0, 
-    0x1f, 0xc0, 
-    0x3f, 0xc0, 
-    0x7f, 0xc0, 
-    0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x29 = { image_data_bc_font_ubuntu_33_0x29,
-    10, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x2a[66] = {
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xfc, 0x7e, 
-    0xdc, 0x76, 
-    0x86, 0xc2, 
-    0xc0, 0x06, 
-    0xfc, 0x7e, 
-    0xf9, 0x3e, 
-    0xf1, 0x1e, 
-    0xf1, 0x1e, 
-    0xe3, 0x8e, 
-    0xfb, 0xbe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x2a = { image_data_bc_font_ubuntu_33_0x2a,
-    15, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x2b[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xc0, 0x00, 0x40, 
-    0xc0, 0x00, 0x40, 
-    0xc0, 0x00, 0x40, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x2b = { image_data_bc_font_ubuntu_33_0x2b,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x2c[33] = {
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xe3, 
-    0xe3, 
-    0xe3, 
-    0xe3, 
-    0xe3, 
-    0xe7, 
-    0xe7, 
-    0xc7, 
-    0xef, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x2c = { image_data_bc_font_ubuntu_33_0x2c,
-    8, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x2d[66] = {
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0x80, 0x40, 
-    0x80, 0x40, 
-    0x80, 0x40, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x2d = { image_data_bc_font_ubuntu_33_0x2d,
-    10, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x2e[33] = {
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xe7, 
-    0xc3, 
-    0xc3, 
-    0xe7, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x2e = { image_data_bc_font_ubuntu_33_0x2e,
-    8, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x2f[66] = {
-    0xff, 0xf8, 
-    0xff, 0xc0, 
-    0xff, 0x88, 
-    0xff, 0x88, 
-    0xff, 0x88, 
-    0xff, 0x18, 
-    0xff, 0x18, 
-    0xff, 0x18, 
-    0xfe, 0x38, 
-    0xfe, 0x38, 
-    0xfe, 0x38, 
-    0xfc, 0x78, 
-    0xfc, 0x78, 
-    0xfc, 0x78, 
-    0xf8, 0xf8, 
-    0xf8, 0xf8, 
-    0xf0, 0xf8, 
-    0xf1, 0xf8, 
-    0xf1, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xc7, 0xf8, 
-    0xc7, 0xf8, 
-    0xc7, 0xf8, 
-    0x8f, 0xf8, 
-    0x8f, 0xf8, 
-    0x8f, 0xf8, 
-    0x1f, 0xf8, 
-    0x1f, 0xf8, 
-    0x1f, 0xf8, 
-    0x3f, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x2f = { image_data_bc_font_ubuntu_33_0x2f,
-    13, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x30[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xfe, 0x1f, 0xc0, 
-    0xf8, 0x07, 0xc0, 
-    0xf0, 0x03, 0xc0, 
-    0xe1, 0xe1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe1, 0xe1, 0xc0, 
-    0xf0, 0x03, 0xc0, 
-    0xf8, 0x07, 0xc0, 
-    0xfe, 0x1f, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x30 = { image_data_bc_font_ubuntu_33_0x30,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x31[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x0f, 0xc0, 
-    0xfc, 0x0f, 0xc0, 
-    0xf0, 0x0f, 0xc0, 
-    0xe0, 0x0f, 0xc0, 
-    0xe1, 0x8f, 0xc0, 
-    0xf7, 0x8f, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x31 = { image_data_bc_font_ubuntu_33_0x31,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x32[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xf8, 0x1f, 0xc0, 
-    0xe0, 0x07, 0xc0, 
-    0xc0, 0x03, 0xc0, 
-    0xe3, 0xc1, 0xc0, 
-    0xef, 0xf1, 0xc0, 
-    0xff, 0xf1, 0xc0, 
-    0xff, 0xf1, 0xc0, 
-    0xff, 0xf1, 0xc0, 
-    0xff, 0xe3, 0xc0, 
-    0xff, 0xc3, 0xc0, 
-    0xff, 0xc7, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xfe, 0x3f, 0xc0, 
-    0xfc, 0x7f, 0xc0, 
-    0xf8, 0xff, 0xc0, 
-    0xf1, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xc0, 0x00, 0xc0, 
-    0xc0, 0x00, 0xc0, 
-    0xc0, 0x00, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x32 = { image_data_bc_font_ubuntu_33_0x32,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x33[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xf8, 0x0f, 0xc0, 
-    0xc0, 0x07, 0xc0, 
-    0xc0, 0x03, 0xc0, 
-    0xe7, 0xe1, 0xc0, 
-    0xff, 0xf1, 0xc0, 
-    0xff, 0xf1, 0xc0, 
-    0xff, 0xf1, 0xc0, 
-    0xff, 0xc3, 0xc0, 
-    0xfc, 0x07, 0xc0, 
-    0xfc, 0x07, 0xc0, 
-    0xfc, 0x03, 0xc0, 
-    0xff, 0xc1, 0xc0, 
-    0xff, 0xf0, 0xc0, 
-    0xff, 0xf8, 0xc0, 
-    0xff, 0xf8, 0xc0, 
-    0xff, 0xf8, 0xc0, 
-    0xff, 0xf8, 0xc0, 
-    0xff, 0xf0, 0xc0, 
-    0xcf, 0xe1, 0xc0, 
-    0xc0, 0x03, 0xc0, 
-    0xc0, 0x07, 0xc0, 
-    0xf0, 0x1f, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x33 = { image_data_bc_font_ubuntu_33_0x33,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x34[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xe3, 0xc0, 
-    0xff, 0xc3, 0xc0, 
-    0xff, 0x83, 0xc0, 
-    0xff, 0x03, 0xc0, 
-    0xfe, 0x03, 0xc0, 
-    0xfc, 0x23, 0xc0, 
-    0xf8, 0x63, 0xc0, 
-    0xf8, 0xe3, 0xc0, 
-    0xf1, 0xe3, 0xc0, 
-    0xe3, 0xe3, 0xc0, 
-    0xe3, 0xe3, 0xc0, 
-    0xc7, 0xe3, 0xc0, 
-    0x8f, 0xe3, 0xc0, 
-    0x80, 0x00, 0x40, 
-    0x80, 0x00, 0x40, 
-    0x80, 0x00, 0x40, 
-    0xff, 0xe3, 0xc0, 
-    0xff, 0xe3, 0xc0, 
-    0xff, 0xe3, 0xc0, 
-    0xff, 0xe3, 0xc0, 
-    0xff, 0xe3, 0xc0, 
-    0xff, 0xe3, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x34 = { image_data_bc_font_ubuntu_33_0x34,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x35[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xf0, 0x01, 0xc0, 
-    0xf0, 0x01, 0xc0, 
-    0xf0, 0x01, 0xc0, 
-    0xf1, 0xff, 0xc0, 
-    0xf1, 0xff, 0xc0, 
-    0xf1, 0xff, 0xc0, 
-    0xf1, 0xff, 0xc0, 
-    0xf1, 0xff, 0xc0, 
-    0xf0, 0x3f, 0xc0, 
-    0xe0, 0x07, 0xc0, 
-    0xe0, 0x03, 0xc0, 
-    0xff, 0x81, 0xc0, 
-    0xff, 0xf1, 0xc0, 
-    0xff, 0xf8, 0xc0, 
-    0xff, 0xf8, 0xc0, 
-    0xff, 0xf8, 0xc0, 
-    0xff, 0xf8, 0xc0, 
-    0xff, 0xf0, 0xc0, 
-    0xcf, 0xe1, 0xc0, 
-    0xc0, 0x01, 0xc0, 
-    0xc0, 0x07, 0xc0, 
-    0xf0, 0x1f, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x35 = { image_data_bc_font_ubuntu_33_0x35,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x36[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xe1, 0xc0, 
-    0xff, 0x01, 0xc0, 
-    0xfc, 0x01, 0xc0, 
-    0xf8, 0x1f, 0xc0, 
-    0xf0, 0xff, 0xc0, 
-    0xf1, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xe4, 0x0f, 0xc0, 
-    0xc0, 0x03, 0xc0, 
-    0xc0, 0x01, 0xc0, 
-    0xc3, 0xe1, 0xc0, 
-    0xc7, 0xf0, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc3, 0xf8, 0xc0, 
-    0xe3, 0xf0, 0xc0, 
-    0xe1, 0xe1, 0xc0, 
-    0xf0, 0x03, 0xc0, 
-    0xf8, 0x03, 0xc0, 
-    0xfc, 0x0f, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x36 = { image_data_bc_font_ubuntu_33_0x36,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x37[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xc0, 0x00, 0xc0, 
-    0xc0, 0x00, 0xc0, 
-    0xc0, 0x00, 0xc0, 
-    0xff, 0xf9, 0xc0, 
-    0xff, 0xf1, 0xc0, 
-    0xff, 0xe3, 0xc0, 
-    0xff, 0xc7, 0xc0, 
-    0xff, 0xc7, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xfe, 0x3f, 0xc0, 
-    0xfe, 0x3f, 0xc0, 
-    0xfe, 0x3f, 0xc0, 
-    0xfc, 0x7f, 0xc0, 
-    0xfc, 0x7f, 0xc0, 
-    0xfc, 0x7f, 0xc0, 
-    0xfc, 0xff, 0xc0, 
-    0xf8, 0xff, 0xc0, 
-    0xf8, 0xff, 0xc0, 
-    0xf8, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x37 = { image_data_bc_font_ubuntu_33_0x37,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x38[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xfc, 0x0f, 0xc0, 
-    0xf8, 0x07, 0xc0, 
-    0xf0, 0x03, 0xc0, 
-    0xe1, 0xe1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe1, 0xf1, 0xc0, 
-    0xf0, 0xe3, 0xc0, 
-    0xf8, 0x07, 0xc0, 
-    0xfc, 0x0f, 0xc0, 
-    0xf0, 0x03, 0xc0, 
-    0xe3, 0xc1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc3, 0xf8, 0xc0, 
-    0xe1, 0xe0, 0xc0, 
-    0xe0, 0x01, 0xc0, 
-    0xf0, 0x03, 0xc0, 
-    0xfc, 0x0f, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x38 = { image_data_bc_font_ubuntu_33_0x38,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x39[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xfc, 0x0f, 0xc0, 
-    0xf0, 0x07, 0xc0, 
-    0xf0, 0x03, 0xc0, 
-    0xe1, 0xe1, 0xc0, 
-    0xc3, 0xf1, 0xc0, 
-    0xc7, 0xf0, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc3, 0xf8, 0xc0, 
-    0xe1, 0xf0, 0xc0, 
-    0xe0, 0x00, 0xc0, 
-    0xf0, 0x00, 0xc0, 
-    0xfc, 0x08, 0xc0, 
-    0xff, 0xf1, 0xc0, 
-    0xff, 0xf1, 0xc0, 
-    0xff, 0xe3, 0xc0, 
-    0xff, 0xc3, 0xc0, 
-    0xfe, 0x07, 0xc0, 
-    0xe0, 0x0f, 0xc0, 
-    0xe0, 0x3f, 0xc0, 
-    0xe1, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x39 = { image_data_bc_font_ubuntu_33_0x39,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x3a[33] = {
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xe7, 
-    0xc3, 
-    0xc3, 
-    0xe7, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xe7, 
-    0xc3, 
-    0xc3, 
-    0xe7, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x3a = { image_data_bc_font_ubuntu_33_0x3a,
-    8, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x3b[33] = {
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xe7, 
-    0xc3, 
-    0xc3, 
-    0xe7, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xff, 
-    0xe3, 
-    0xe3, 
-    0xe3, 
-    0xe3, 
-    0xe3, 
-    0xe7, 
-    0xe7, 
-    0xc7, 
-    0xef, 
-    0xff, 
-    0xff
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x3b = { image_data_bc_font_ubuntu_33_0x3b,
-    8, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x3c[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xfe, 0xc0, 
-    0xff, 0xf0, 0xc0, 
-    0xff, 0xc0, 0x40, 
-    0xfe, 0x01, 0xc0, 
-    0xf8, 0x0f, 0xc0, 
-    0xe0, 0x3f, 0xc0, 
-    0xc1, 0xff, 0xc0, 
-    0xc7, 0xff, 0xc0, 
-    0xc1, 0xff, 0xc0, 
-    0xe0, 0x3f, 0xc0, 
-    0xf8, 0x0f, 0xc0, 
-    0xfe, 0x01, 0xc0, 
-    0xff, 0xc0, 0x40, 
-    0xff, 0xf0, 0xc0, 
-    0xff, 0xfe, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x3c = { image_data_bc_font_ubuntu_33_0x3c,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x3d[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0x80, 0x00, 0xc0, 
-    0x80, 0x00, 0xc0, 
-    0x80, 0x00, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0x80, 0x00, 0xc0, 
-    0x80, 0x00, 0xc0, 
-    0x80, 0x00, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x3d = { image_data_bc_font_ubuntu_33_0x3d,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x3e[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xef, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xc0, 0x7f, 0xc0, 
-    0xf0, 0x1f, 0xc0, 
-    0xfc, 0x07, 0xc0, 
-    0xff, 0x81, 0xc0, 
-    0xff, 0xe0, 0xc0, 
-    0xff, 0xf8, 0xc0, 
-    0xff, 0xe0, 0xc0, 
-    0xff, 0x81, 0xc0, 
-    0xfc, 0x07, 0xc0, 
-    0xf0, 0x1f, 0xc0, 
-    0xc0, 0x7f, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xef, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x3e = { image_data_bc_font_ubuntu_33_0x3e,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x3f[66] = {
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xe0, 0x78, 
-    0x80, 0x18, 
-    0x80, 0x18, 
-    0xdf, 0x08, 
-    0xff, 0x88, 
-    0xff, 0x88, 
-    0xff, 0x88, 
-    0xff, 0x18, 
-    0xff, 0x18, 
-    0xfc, 0x38, 
-    0xf8, 0x78, 
-    0xf8, 0xf8, 
-    0xf1, 0xf8, 
-    0xf1, 0xf8, 
-    0xf1, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xf1, 0xf8, 
-    0xf1, 0xf8, 
-    0xf1, 0xf8, 
-    0xf1, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x3f = { image_data_bc_font_ubuntu_33_0x3f,
-    13, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x40[132] = {
-    0xff, 0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xff, 0xfc, 
-    0xff, 0xe0, 0x1f, 0xfc, 
-    0xff, 0x80, 0x03, 0xfc, 
-    0xfe, 0x00, 0x01, 0xfc, 
-    0xfc, 0x0f, 0xe0, 0xfc, 
-    0xf8, 0x3f, 0xf8, 0x7c, 
-    0xf0, 0xff, 0xfc, 0x3c, 
-    0xf1, 0xff, 0xfe, 0x1c, 
-    0xe1, 0xf8, 0x1f, 0x1c, 
-    0xe3, 0xe0, 0x0f, 0x1c, 
-    0xe3, 0xc0, 0x0f, 0x8c, 
-    0xc7, 0xc3, 0x8f, 0x8c, 
-    0xc7, 0x87, 0x8f, 0x8c, 
-    0xc7, 0x8f, 0x8f, 0x8c, 
-    0xc7, 0x8f, 0x8f, 0x8c, 
-    0xc7, 0x8f, 0x8f, 0x8c, 
-    0xc7, 0x8f, 0x8f, 0x0c, 
-    0xc7, 0x87, 0x8f, 0x1c, 
-    0xc7, 0xc7, 0x8e, 0x1c, 
-    0xc3, 0xc0, 0x00, 0x3c, 
-    0xe3, 0xe0, 0x00, 0x7c, 
-    0xe1, 0xf0, 0x60, 0xfc, 
-    0xf1, 0xff, 0xff, 0xfc, 
-    0xf0, 0xff, 0xff, 0xfc, 
-    0xf8, 0x3f, 0xff, 0xfc, 
-    0xfc, 0x0f, 0xef, 0xfc, 
-    0xfe, 0x00, 0x0f, 0xfc, 
-    0xff, 0x80, 0x0f, 0xfc, 
-    0xff, 0xe0, 0x0f, 0xfc, 
-    0xff, 0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x40 = { image_data_bc_font_ubuntu_33_0x40,
-    30, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x41[99] = {
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0x8f, 0xf8, 
-    0xff, 0x07, 0xf8, 
-    0xff, 0x07, 0xf8, 
-    0xff, 0x07, 0xf8, 
-    0xfe, 0x23, 0xf8, 
-    0xfe, 0x23, 0xf8, 
-    0xfc, 0x71, 0xf8, 
-    0xfc, 0x71, 0xf8, 
-    0xf8, 0x70, 0xf8, 
-    0xf8, 0xf8, 0xf8, 
-    0xf8, 0xf8, 0xf8, 
-    0xf1, 0xfc, 0x78, 
-    0xf1, 0xfc, 0x78, 
-    0xe1, 0xfc, 0x38, 
-    0xe0, 0x00, 0x38, 
-    0xe0, 0x00, 0x38, 
-    0xc0, 0x00, 0x18, 
-    0xc7, 0xff, 0x18, 
-    0x87, 0xff, 0x08, 
-    0x8f, 0xff, 0x88, 
-    0x8f, 0xff, 0x88, 
-    0x1f, 0xff, 0xc0, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x41 = { image_data_bc_font_ubuntu_33_0x41,
-    21, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x42[99] = {
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xe0, 0x03, 0xf8, 
-    0xe0, 0x00, 0xf8, 
-    0xe0, 0x00, 0x78, 
-    0xe3, 0xf8, 0x38, 
-    0xe3, 0xfc, 0x38, 
-    0xe3, 0xfe, 0x38, 
-    0xe3, 0xfe, 0x38, 
-    0xe3, 0xfe, 0x38, 
-    0xe3, 0xf8, 0x78, 
-    0xe0, 0x00, 0xf8, 
-    0xe0, 0x00, 0xf8, 
-    0xe0, 0x00, 0x78, 
-    0xe3, 0xfc, 0x38, 
-    0xe3, 0xfe, 0x18, 
-    0xe3, 0xff, 0x18, 
-    0xe3, 0xff, 0x18, 
-    0xe3, 0xff, 0x18, 
-    0xe3, 0xfe, 0x18, 
-    0xe3, 0xf8, 0x38, 
-    0xe0, 0x00, 0x38, 
-    0xe0, 0x00, 0xf8, 
-    0xe0, 0x03, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x42 = { image_data_bc_font_ubuntu_33_0x42,
-    21, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x43[99] = {
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0x80, 0x70, 
-    0xfe, 0x00, 0x10, 
-    0xf8, 0x00, 0x10, 
-    0xf8, 0x3f, 0x30, 
-    0xf0, 0xff, 0xf0, 
-    0xe1, 0xff, 0xf0, 
-    0xe3, 0xff, 0xf0, 
-    0xc3, 0xff, 0xf0, 
-    0xc7, 0xff, 0xf0, 
-    0xc7, 0xff, 0xf0, 
-    0xc7, 0xff, 0xf0, 
-    0xc7, 0xff, 0xf0, 
-    0xc7, 0xff, 0xf0, 
-    0xc7, 0xff, 0xf0, 
-    0xc3, 0xff, 0xf0, 
-    0xe3, 0xff, 0xf0, 
-    0xe1, 0xff, 0xf0, 
-    0xf0, 0xff, 0xf0, 
-    0xf0, 0x7f, 0x30, 
-    0xf8, 0x00, 0x10, 
-    0xfe, 0x00, 0x10, 
-    0xff, 0x80, 0x70, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x43 = { image_data_bc_font_ubuntu_33_0x43,
-    20, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x44[99] = {
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xe0, 0x07, 0xfe, 
-    0xe0, 0x00, 0xfe, 
-    0xe0, 0x00, 0x7e, 
-    0xe3, 0xf8, 0x3e, 
-    0xe3, 0xfe, 0x1e, 
-    0xe3, 0xff, 0x0e, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x86, 
-    0xe3, 0xff, 0xc6, 
-    0xe3, 0xff, 0xc6, 
-    0xe3, 0xff, 0xc6, 
-    0xe3, 0xff, 0xc6, 
-    0xe3, 0xff, 0xc6, 
-    0xe3, 0xff, 0xc6, 
-    0xe3, 0xff, 0x86, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x0e, 
-    0xe3, 0xfe, 0x1e, 
-    0xe3, 0xf8, 0x3e, 
-    0xe0, 0x00, 0x7e, 
-    0xe0, 0x00, 0xfe, 
-    0xe0, 0x07, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x44 = { image_data_bc_font_ubuntu_33_0x44,
-    23, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x45[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xe0, 0x00, 0xc0, 
-    0xe0, 0x00, 0xc0, 
-    0xe0, 0x00, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xe0, 0x01, 0xc0, 
-    0xe0, 0x01, 0xc0, 
-    0xe0, 0x01, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xe0, 0x00, 0x40, 
-    0xe0, 0x00, 0x40, 
-    0xe0, 0x00, 0x40, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x45 = { image_data_bc_font_ubuntu_33_0x45,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x46[99] = {
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xe0, 0x00, 0x80, 
-    0xe0, 0x00, 0x80, 
-    0xe0, 0x00, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe0, 0x01, 0x80, 
-    0xe0, 0x01, 0x80, 
-    0xe0, 0x01, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x46 = { image_data_bc_font_ubuntu_33_0x46,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x47[99] = {
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0x80, 0x7c, 
-    0xfe, 0x00, 0x1c, 
-    0xf8, 0x00, 0x1c, 
-    0xf0, 0x3f, 0x3c, 
-    0xf0, 0xff, 0xfc, 
-    0xe1, 0xff, 0xfc, 
-    0xe3, 0xff, 0xfc, 
-    0xc3, 0xff, 0xfc, 
-    0xc7, 0xff, 0xfc, 
-    0xc7, 0xff, 0xfc, 
-    0xc7, 0xff, 0xfc, 
-    0xc7, 0xff, 0x1c, 
-    0xc7, 0xff, 0x1c, 
-    0xc7, 0xff, 0x1c, 
-    0xc3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xe1, 0xff, 0x1c, 
-    0xf0, 0xff, 0x1c, 
-    0xf0, 0x7f, 0x1c, 
-    0xf8, 0x00, 0x1c, 
-    0xfc, 0x00, 0x1c, 
-    0xff, 0x80, 0x7c, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x47 = { image_data_bc_font_ubuntu_33_0x47,
-    22, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x48[99] = {
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x8e, 
-    0xe0, 0x00, 0x0e, 
-    0xe0, 0x00, 0x0e, 
-    0xe0, 0x00, 0x0e, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x8e, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x48 = { image_data_bc_font_ubuntu_33_0x48,
-    23, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x49[66] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x49 = { image_data_bc_font_ubuntu_33_0x49,
-    9, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x4a[66] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0xc7, 
-    0xff, 0x87, 
-    0x9f, 0x0f, 
-    0x00, 0x0f, 
-    0x00, 0x1f, 
-    0xe0, 0x7f, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x4a = { image_data_bc_font_ubuntu_33_0x4a,
-    16, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x4b[99] = {
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xe3, 0xfe, 0x10, 
-    0xe3, 0xfc, 0x30, 
-    0xe3, 0xf8, 0x70, 
-    0xe3, 0xf0, 0xf0, 
-    0xe3, 0xe1, 0xf0, 
-    0xe3, 0xc3, 0xf0, 
-    0xe3, 0x87, 0xf0, 
-    0xe3, 0x0f, 0xf0, 
-    0xe2, 0x1f, 0xf0, 
-    0xe0, 0x3f, 0xf0, 
-    0xe0, 0x7f, 0xf0, 
-    0xe0, 0x1f, 0xf0, 
-    0xe2, 0x0f, 0xf0, 
-    0xe3, 0x07, 0xf0, 
-    0xe3, 0x83, 0xf0, 
-    0xe3, 0xe1, 0xf0, 
-    0xe3, 0xf0, 0xf0, 
-    0xe3, 0xf8, 0x70, 
-    0xe3, 0xf8, 0x30, 
-    0xe3, 0xfc, 0x30, 
-    0xe3, 0xfe, 0x10, 
-    0xe3, 0xff, 0x00, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x4b = { image_data_bc_font_ubuntu_33_0x4b,
-    20, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x4c[99] = {
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe0, 0x00, 0x80, 
-    0xe0, 0x00, 0x80, 
-    0xe0, 0x00, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x4c = { image_data_bc_font_ubuntu_33_0x4c,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x4d[132] = {
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xf1, 0xff, 0xfc, 0x78, 
-    0xf0, 0xff, 0xf8, 0x78, 
-    0xf0, 0xff, 0xf8, 0x78, 
-    0xf0, 0x7f, 0xf0, 0x78, 
-    0xe0, 0x7f, 0xf0, 0x38, 
-    0xe0, 0x3f, 0xe0, 0x38, 
-    0xe2, 0x3f, 0xe2, 0x38, 
-    0xe3, 0x1f, 0xc6, 0x38, 
-    0xe3, 0x1f, 0xc6, 0x38, 
-    0xe3, 0x8f, 0x8e, 0x38, 
-    0xe3, 0x8f, 0x8e, 0x38, 
-    0xe3, 0xc7, 0x1e, 0x38, 
-    0xe3, 0xc7, 0x1e, 0x38, 
-    0xe3, 0xe7, 0x3e, 0x38, 
-    0xc3, 0xe2, 0x3e, 0x38, 
-    0xc7, 0xf2, 0x7f, 0x18, 
-    0xc7, 0xf0, 0x7f, 0x18, 
-    0xc7, 0xf0, 0x7f, 0x18, 
-    0xc7, 0xf8, 0xff, 0x18, 
-    0xc7, 0xff, 0xff, 0x18, 
-    0xc7, 0xff, 0xff, 0x18, 
-    0xc7, 0xff, 0xff, 0x18, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x4d = { image_data_bc_font_ubuntu_33_0x4d,
-    29, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x4e[99] = {
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xe3, 0xff, 0x8e, 
-    0xe1, 0xff, 0x8e, 
-    0xe0, 0xff, 0x8e, 
-    0xe0, 0x7f, 0x8e, 
-    0xe0, 0x7f, 0x8e, 
-    0xe2, 0x3f, 0x8e, 
-    0xe2, 0x1f, 0x8e, 
-    0xe3, 0x0f, 0x8e, 
-    0xe3, 0x8f, 0x8e, 
-    0xe3, 0xc7, 0x8e, 
-    0xe3, 0xc3, 0x8e, 
-    0xe3, 0xe3, 0x8e, 
-    0xe3, 0xf1, 0x8e, 
-    0xe3, 0xf1, 0x8e, 
-    0xe3, 0xf8, 0x8e, 
-    0xe3, 0xfc, 0x0e, 
-    0xe3, 0xfc, 0x0e, 
-    0xe3, 0xfe, 0x0e, 
-    0xe3, 0xff, 0x0e, 
-    0xe3, 0xff, 0x0e, 
-    0xe3, 0xff, 0x8e, 
-    0xe3, 0xff, 0x8e, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x4e = { image_data_bc_font_ubuntu_33_0x4e,
-    23, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x4f[132] = {
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0x80, 0xff, 0x80, 
-    0xfe, 0x00, 0x3f, 0x80, 
-    0xf8, 0x00, 0x0f, 0x80, 
-    0xf0, 0x3e, 0x07, 0x80, 
-    0xf0, 0xff, 0x87, 0x80, 
-    0xe1, 0xff, 0xc3, 0x80, 
-    0xe3, 0xff, 0xe3, 0x80, 
-    0xc3, 0xff, 0xe1, 0x80, 
-    0xc7, 0xff, 0xf1, 0x80, 
-    0xc7, 0xff, 0xf1, 0x80, 
-    0xc7, 0xff, 0xf1, 0x80, 
-    0xc7, 0xff, 0xf1, 0x80, 
-    0xc7, 0xff, 0xf1, 0x80, 
-    0xc7, 0xff, 0xf1, 0x80, 
-    0xc3, 0xff, 0xe1, 0x80, 
-    0xe3, 0xff, 0xe3, 0x80, 
-    0xe1, 0xff, 0xc3, 0x80, 
-    0xf0, 0xff, 0x87, 0x80, 
-    0xf0, 0x3e, 0x07, 0x80, 
-    0xf8, 0x00, 0x0f, 0x80, 
-    0xfe, 0x00, 0x3f, 0x80, 
-    0xff, 0x80, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x4f = { image_data_bc_font_ubuntu_33_0x4f,
-    25, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x50[99] = {
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xe0, 0x07, 0xe0, 
-    0xe0, 0x01, 0xe0, 
-    0xe0, 0x00, 0xe0, 
-    0xe3, 0xf8, 0x60, 
-    0xe3, 0xfc, 0x20, 
-    0xe3, 0xfe, 0x20, 
-    0xe3, 0xfe, 0x20, 
-    0xe3, 0xfe, 0x20, 
-    0xe3, 0xfe, 0x20, 
-    0xe3, 0xfc, 0x20, 
-    0xe3, 0xf0, 0x60, 
-    0xe0, 0x00, 0xe0, 
-    0xe0, 0x01, 0xe0, 
-    0xe0, 0x07, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x50 = { image_data_bc_font_ubuntu_33_0x50,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x51[132] = {
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0x80, 0xff, 0x80, 
-    0xfe, 0x00, 0x3f, 0x80, 
-    0xf8, 0x00, 0x0f, 0x80, 
-    0xf0, 0x3e, 0x07, 0x80, 
-    0xf0, 0xff, 0x87, 0x80, 
-    0xe1, 0xff, 0xc3, 0x80, 
-    0xe3, 0xff, 0xe3, 0x80, 
-    0xc3, 0xff, 0xe1, 0x80, 
-    0xc7, 0xff, 0xf1, 0x80, 
-    0xc7, 0xff, 0xf1, 0x80, 
-    0xc7, 0xff, 0xf1, 0x80, 
-    0xc7, 0xff, 0xf1, 0x80, 
-    0xc7, 0xff, 0xf1, 0x80, 
-    0xc7, 0xff, 0xf1, 0x80, 
-    0xc3, 0xff, 0xe1, 0x80, 
-    0xe3, 0xff, 0xe3, 0x80, 
-    0xe1, 0xff, 0xc3, 0x80, 
-    0xf0, 0xff, 0x87, 0x80, 
-    0xf8, 0x3e, 0x07, 0x80, 
-    0xfc, 0x00, 0x0f, 0x80, 
-    0xfe, 0x00, 0x3f, 0x80, 
-    0xff, 0x80, 0xff, 0x80, 
-    0xff, 0xf1, 0xff, 0x80, 
-    0xff, 0xf0, 0xff, 0x80, 
-    0xff, 0xf8, 0x1f, 0x80, 
-    0xff, 0xfc, 0x03, 0x80, 
-    0xff, 0xff, 0x07, 0x80, 
-    0xff, 0xff, 0xc7, 0x80, 
-    0xff, 0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x51 = { image_data_bc_font_ubuntu_33_0x51,
-    25, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x52[99] = {
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xe0, 0x07, 0xf0, 
-    0xe0, 0x01, 0xf0, 
-    0xe0, 0x00, 0x70, 
-    0xe3, 0xf8, 0x70, 
-    0xe3, 0xfc, 0x30, 
-    0xe3, 0xfe, 0x30, 
-    0xe3, 0xfe, 0x30, 
-    0xe3, 0xfe, 0x30, 
-    0xe3, 0xfc, 0x30, 
-    0xe3, 0xf8, 0x70, 
-    0xe0, 0x00, 0x70, 
-    0xe0, 0x01, 0xf0, 
-    0xe0, 0x07, 0xf0, 
-    0xe3, 0xe3, 0xf0, 
-    0xe3, 0xe1, 0xf0, 
-    0xe3, 0xf1, 0xf0, 
-    0xe3, 0xf0, 0xf0, 
-    0xe3, 0xf8, 0xf0, 
-    0xe3, 0xf8, 0x70, 
-    0xe3, 0xfc, 0x70, 
-    0xe3, 0xfc, 0x30, 
-    0xe3, 0xfe, 0x10, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x52 = { image_data_bc_font_ubuntu_33_0x52,
-    20, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x53[99] = {
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xfc, 0x07, 0x80, 
-    0xf0, 0x01, 0x80, 
-    0xe0, 0x01, 0x80, 
-    0xc3, 0xf3, 0x80, 
-    0xc7, 0xff, 0x80, 
-    0xc7, 0xff, 0x80, 
-    0xc7, 0xff, 0x80, 
-    0xc3, 0xff, 0x80, 
-    0xe0, 0xff, 0x80, 
-    0xf0, 0x3f, 0x80, 
-    0xf8, 0x0f, 0x80, 
-    0xff, 0x03, 0x80, 
-    0xff, 0xc1, 0x80, 
-    0xff, 0xe1, 0x80, 
-    0xff, 0xf8, 0x80, 
-    0xff, 0xf8, 0x80, 
-    0xff, 0xf8, 0x80, 
-    0xff, 0xf8, 0x80, 
-    0xcf, 0xe0, 0x80, 
-    0x80, 0x01, 0x80, 
-    0x80, 0x03, 0x80, 
-    0xf0, 0x0f, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x53 = { image_data_bc_font_ubuntu_33_0x53,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x54[99] = {
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0x80, 0x00, 0x20, 
-    0x80, 0x00, 0x20, 
-    0x80, 0x00, 0x20, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x54 = { image_data_bc_font_ubuntu_33_0x54,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x55[99] = {
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xe3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xe3, 0xff, 0x1c, 
-    0xe1, 0xfe, 0x1c, 
-    0xf1, 0xfe, 0x3c, 
-    0xf0, 0x78, 0x3c, 
-    0xf8, 0x00, 0x7c, 
-    0xfc, 0x00, 0xfc, 
-    0xff, 0x03, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x55 = { image_data_bc_font_ubuntu_33_0x55,
-    22, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x56[99] = {
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0x1f, 0xff, 0xc0, 
-    0x8f, 0xff, 0x88, 
-    0x8f, 0xff, 0x88, 
-    0x87, 0xff, 0x08, 
-    0xc7, 0xff, 0x18, 
-    0xc7, 0xff, 0x18, 
-    0xc3, 0xfe, 0x18, 
-    0xe3, 0xfe, 0x38, 
-    0xe3, 0xfe, 0x38, 
-    0xf1, 0xfc, 0x78, 
-    0xf1, 0xfc, 0x78, 
-    0xf0, 0xf8, 0x78, 
-    0xf8, 0xf8, 0xf8, 
-    0xf8, 0x70, 0xf8, 
-    0xfc, 0x71, 0xf8, 
-    0xfc, 0x71, 0xf8, 
-    0xfe, 0x21, 0xf8, 
-    0xfe, 0x23, 0xf8, 
-    0xfe, 0x03, 0xf8, 
-    0xff, 0x07, 0xf8, 
-    0xff, 0x07, 0xf8, 
-    0xff, 0x8f, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x56 = { image_data_bc_font_ubuntu_33_0x56,
-    21, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x57[132] = {
-    0xff, 0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xff, 0xfe, 
-    0x8f, 0xff, 0xff, 0xe2, 
-    0x8f, 0xff, 0xff, 0xe2, 
-    0x87, 0xff, 0xff, 0xc2, 
-    0xc7, 0xfc, 0x7f, 0xc6, 
-    0xc7, 0xfc, 0x3f, 0xc6, 
-    0xc7, 0xf8, 0x3f, 0xc6, 
-    0xc7, 0xf8, 0x3f, 0xc6, 
-    0xc3, 0xf9, 0x1f, 0x86, 
-    0xe3, 0xf1, 0x1f, 0x8e, 
-    0xe3, 0xf1, 0x1f, 0x8e, 
-    0xe3, 0xf3, 0x0f, 0x8e, 
-    0xe1, 0xe3, 0x8f, 0x0e, 
-    0xf1, 0xe3, 0x8f, 0x1e, 
-    0xf1, 0xc7, 0x87, 0x1e, 
-    0xf1, 0xc7, 0xc7, 0x1e, 
-    0xf0, 0xc7, 0xc6, 0x1e, 
-    0xf8, 0x8f, 0xe2, 0x3e, 
-    0xf8, 0x8f, 0xe2, 0x3e, 
-    0xf8, 0x0f, 0xe0, 0x3e, 
-    0xf8, 0x1f, 0xf0, 0x3e, 
-    0xfc, 0x1f, 0xf0, 0x7e, 
-    0xfc, 0x3f, 0xf0, 0x7e, 
-    0xff, 0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xff, 0xfe, 
-    0xff, 0xff, 0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x57 = { image_data_bc_font_ubuntu_33_0x57,
-    31, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x58[99] = {
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0x87, 0xfc, 0x30, 
-    0xc7, 0xfc, 0x70, 
-    0xe3, 0xf8, 0xf0, 
-    0xe1, 0xf0, 0xf0, 
-    0xf1, 0xf1, 0xf0, 
-    0xf8, 0xe1, 0xf0, 
-    0xf8, 0x63, 0xf0, 
-    0xfc, 0x47, 0xf0, 
-    0xfe, 0x07, 0xf0, 
-    0xfe, 0x0f, 0xf0, 
-    0xff, 0x0f, 0xf0, 
-    0xfe, 0x0f, 0xf0, 
-    0xfe, 0x07, 0xf0, 
-    0xfc, 0x03, 0xf0, 
-    0xf8, 0x63, 0xf0, 
-    0xf8, 0xe1, 0xf0, 
-    0xf0, 0xf0, 0xf0, 
-    0xf1, 0xf8, 0xf0, 
-    0xe3, 0xf8, 0x70, 
-    0xc3, 0xfc, 0x30, 
-    0xc7, 0xfe, 0x30, 
-    0x87, 0xfe, 0x10, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0, 
-    0xff, 0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x58 = { image_data_bc_font_ubuntu_33_0x58,
-    20, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x59[99] = {
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0x0f, 0xfe, 0x00, 
-    0x8f, 0xfe, 0x20, 
-    0x87, 0xfc, 0x20, 
-    0xc7, 0xfc, 0x60, 
-    0xe3, 0xf8, 0xe0, 
-    0xe1, 0xf0, 0xe0, 
-    0xf1, 0xf1, 0xe0, 
-    0xf0, 0xe1, 0xe0, 
-    0xf8, 0xc3, 0xe0, 
-    0xfc, 0x47, 0xe0, 
-    0xfc, 0x07, 0xe0, 
-    0xfe, 0x0f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0x1f, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x59 = { image_data_bc_font_ubuntu_33_0x59,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x5a[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xc0, 0x00, 0x40, 
-    0xc0, 0x00, 0x40, 
-    0xc0, 0x00, 0x40, 
-    0xff, 0xf8, 0x40, 
-    0xff, 0xf0, 0xc0, 
-    0xff, 0xe1, 0xc0, 
-    0xff, 0xe3, 0xc0, 
-    0xff, 0xc7, 0xc0, 
-    0xff, 0x87, 0xc0, 
-    0xff, 0x0f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xfe, 0x3f, 0xc0, 
-    0xfc, 0x3f, 0xc0, 
-    0xf8, 0x7f, 0xc0, 
-    0xf8, 0xff, 0xc0, 
-    0xf1, 0xff, 0xc0, 
-    0xe1, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xc3, 0xff, 0xc0, 
-    0x80, 0x00, 0x40, 
-    0x80, 0x00, 0x40, 
-    0x80, 0x00, 0x40, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x5a = { image_data_bc_font_ubuntu_33_0x5a,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x5b[66] = {
-    0xff, 0xe0, 
-    0xe0, 0x00, 
-    0xe0, 0x00, 
-    0xe0, 0x00, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe3, 0xe0, 
-    0xe0, 0x00, 
-    0xe0, 0x00, 
-    0xe0, 0x00, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x5b = { image_data_bc_font_ubuntu_33_0x5b,
-    11, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x5c[66] = {
-    0xff, 0xf8, 
-    0x3f, 0xf8, 
-    0x1f, 0xf8, 
-    0x1f, 0xf8, 
-    0x1f, 0xf8, 
-    0x8f, 0xf8, 
-    0x8f, 0xf8, 
-    0x8f, 0xf8, 
-    0xc7, 0xf8, 
-    0xc7, 0xf8, 
-    0xc7, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xf1, 0xf8, 
-    0xf1, 0xf8, 
-    0xf0, 0xf8, 
-    0xf8, 0xf8, 
-    0xf8, 0xf8, 
-    0xfc, 0x78, 
-    0xfc, 0x78, 
-    0xfc, 0x78, 
-    0xfe, 0x38, 
-    0xfe, 0x38, 
-    0xfe, 0x38, 
-    0xff, 0x18, 
-    0xff, 0x18, 
-    0xff, 0x18, 
-    0xff, 0x88, 
-    0xff, 0x88, 
-    0xff, 0x88, 
-    0xff, 0xc0, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x5c = { image_data_bc_font_ubuntu_33_0x5c,
-    13, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x5d[66] = {
-    0xff, 0xe0, 
-    0x00, 0xe0, 
-    0x00, 0xe0, 
-    0x00, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0xf8, 0xe0, 
-    0x00, 0xe0, 
-    0x00, 0xe0, 
-    0x00, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x5d = { image_data_bc_font_ubuntu_33_0x5d,
-    11, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x5e[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xfe, 0x0f, 0xc0, 
-    0xfe, 0x0f, 0xc0, 
-    0xfc, 0x47, 0xc0, 
-    0xf8, 0x43, 0xc0, 
-    0xf8, 0xe3, 0xc0, 
-    0xf1, 0xf1, 0xc0, 
-    0xf1, 0xf1, 0xc0, 
-    0xe3, 0xf8, 0xc0, 
-    0xe3, 0xf8, 0xc0, 
-    0xc7, 0xfc, 0x40, 
-    0xef, 0xfe, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x5e = { image_data_bc_font_ubuntu_33_0x5e,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x5f[66] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0x00, 0x00, 
-    0x00, 0x00, 
-    0x00, 0x00, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x5f = { image_data_bc_font_ubuntu_33_0x5f,
-    16, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x60[66] = {
-    0xff, 0xf0, 
-    0xef, 0xf0, 
-    0xc7, 0xf0, 
-    0xe3, 0xf0, 
-    0xf1, 0xf0, 
-    0xf8, 0xf0, 
-    0xfd, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x60 = { image_data_bc_font_ubuntu_33_0x60,
-    12, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x61[99] = {
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xf0, 0x1f, 0x80, 
-    0xe0, 0x0f, 0x80, 
-    0xe0, 0x07, 0x80, 
-    0xef, 0xc3, 0x80, 
-    0xff, 0xe3, 0x80, 
-    0xff, 0xe3, 0x80, 
-    0xf8, 0x03, 0x80, 
-    0xe0, 0x03, 0x80, 
-    0xc0, 0x03, 0x80, 
-    0x87, 0xe3, 0x80, 
-    0x8f, 0xe3, 0x80, 
-    0x8f, 0xe3, 0x80, 
-    0x8f, 0xe3, 0x80, 
-    0x87, 0xe3, 0x80, 
-    0xc0, 0x03, 0x80, 
-    0xe0, 0x03, 0x80, 
-    0xf0, 0x07, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x61 = { image_data_bc_font_ubuntu_33_0x61,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x62[99] = {
-    0xff, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe2, 0x07, 0xe0, 
-    0xe0, 0x03, 0xe0, 
-    0xe0, 0x01, 0xe0, 
-    0xe1, 0xf0, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0x60, 
-    0xe3, 0xfc, 0x60, 
-    0xe3, 0xfc, 0x60, 
-    0xe3, 0xfc, 0x60, 
-    0xe3, 0xfc, 0x60, 
-    0xe3, 0xfc, 0x60, 
-    0xe3, 0xf8, 0x60, 
-    0xe3, 0xf8, 0xe0, 
-    0xe3, 0xe0, 0xe0, 
-    0xe0, 0x01, 0xe0, 
-    0xe0, 0x03, 0xe0, 
-    0xf0, 0x0f, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x62 = { image_data_bc_font_ubuntu_33_0x62,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x63[66] = {
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xfe, 0x06, 
-    0xf8, 0x02, 
-    0xf0, 0x02, 
-    0xe0, 0xfe, 
-    0xe3, 0xfe, 
-    0xc3, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc3, 0xfe, 
-    0xe3, 0xfe, 
-    0xe0, 0xfa, 
-    0xf0, 0x02, 
-    0xf8, 0x02, 
-    0xfe, 0x06, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x63 = { image_data_bc_font_ubuntu_33_0x63,
-    15, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x64[99] = {
-    0xff, 0xff, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xfc, 0x08, 0xe0, 
-    0xf8, 0x00, 0xe0, 
-    0xf0, 0x00, 0xe0, 
-    0xe1, 0xf0, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xc3, 0xf8, 0xe0, 
-    0xc7, 0xf8, 0xe0, 
-    0xc7, 0xf8, 0xe0, 
-    0xc7, 0xf8, 0xe0, 
-    0xc7, 0xf8, 0xe0, 
-    0xc7, 0xf8, 0xe0, 
-    0xc3, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xe0, 0xf8, 0xe0, 
-    0xf0, 0x00, 0xe0, 
-    0xf8, 0x00, 0xe0, 
-    0xfe, 0x01, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x64 = { image_data_bc_font_ubuntu_33_0x64,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x65[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xfe, 0x0f, 0xc0, 
-    0xf8, 0x03, 0xc0, 
-    0xf0, 0x01, 0xc0, 
-    0xe1, 0xf1, 0xc0, 
-    0xe3, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc0, 0x00, 0xc0, 
-    0xc0, 0x00, 0xc0, 
-    0xc0, 0x00, 0xc0, 
-    0xc7, 0xff, 0xc0, 
-    0xc7, 0xff, 0xc0, 
-    0xc3, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xe0, 0xfd, 0xc0, 
-    0xf0, 0x01, 0xc0, 
-    0xf8, 0x01, 0xc0, 
-    0xfe, 0x03, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x65 = { image_data_bc_font_ubuntu_33_0x65,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x66[66] = {
-    0xff, 0xf0, 
-    0xfc, 0x00, 
-    0xf8, 0x00, 
-    0xf0, 0x00, 
-    0xe1, 0xe0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe0, 0x10, 
-    0xe0, 0x10, 
-    0xe0, 0x10, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x66 = { image_data_bc_font_ubuntu_33_0x66,
-    12, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x67[99] = {
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xfe, 0x03, 0xe0, 
-    0xf8, 0x00, 0xe0, 
-    0xf0, 0x00, 0xe0, 
-    0xe1, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xc3, 0xf8, 0xe0, 
-    0xc7, 0xf8, 0xe0, 
-    0xc7, 0xf8, 0xe0, 
-    0xc7, 0xf8, 0xe0, 
-    0xc7, 0xf8, 0xe0, 
-    0xc7, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xe1, 0xf0, 0xe0, 
-    0xf0, 0x00, 0xe0, 
-    0xf8, 0x00, 0xe0, 
-    0xfc, 0x08, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xf0, 0xe0, 
-    0xe7, 0xe1, 0xe0, 
-    0xe0, 0x01, 0xe0, 
-    0xe0, 0x03, 0xe0, 
-    0xf0, 0x0f, 0xe0, 
-    0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x67 = { image_data_bc_font_ubuntu_33_0x67,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x68[99] = {
-    0xff, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe0, 0x0f, 0xe0, 
-    0xe0, 0x03, 0xe0, 
-    0xe0, 0x01, 0xe0, 
-    0xe3, 0xe1, 0xe0, 
-    0xe3, 0xf0, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x68 = { image_data_bc_font_ubuntu_33_0x68,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x69[66] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x69 = { image_data_bc_font_ubuntu_33_0x69,
-    9, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x6a[66] = {
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xc3, 0x80, 
-    0x07, 0x80, 
-    0x0f, 0x80, 
-    0x1f, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x6a = { image_data_bc_font_ubuntu_33_0x6a,
-    9, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x6b[99] = {
-    0xff, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xff, 0x80, 
-    0xe3, 0xf0, 0x80, 
-    0xe3, 0xf1, 0x80, 
-    0xe3, 0xe3, 0x80, 
-    0xe3, 0xc7, 0x80, 
-    0xe3, 0x8f, 0x80, 
-    0xe3, 0x1f, 0x80, 
-    0xe2, 0x3f, 0x80, 
-    0xe0, 0x7f, 0x80, 
-    0xe0, 0x3f, 0x80, 
-    0xe2, 0x1f, 0x80, 
-    0xe3, 0x0f, 0x80, 
-    0xe3, 0x87, 0x80, 
-    0xe3, 0xc3, 0x80, 
-    0xe3, 0xe1, 0x80, 
-    0xe3, 0xf1, 0x80, 
-    0xe3, 0xf8, 0x80, 
-    0xe3, 0xf8, 0x00, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x6b = { image_data_bc_font_ubuntu_33_0x6b,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x6c[66] = {
-    0xff, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe3, 0xc0, 
-    0xe1, 0xc0, 
-    0xe0, 0x40, 
-    0xf0, 0x40, 
-    0xf8, 0x40, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0, 
-    0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x6c = { image_data_bc_font_ubuntu_33_0x6c,
-    10, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x6d[132] = {
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xf8, 0x07, 0x81, 0xf8, 
-    0xe0, 0x02, 0x00, 0xf8, 
-    0xe0, 0x00, 0x00, 0x78, 
-    0xe3, 0xe0, 0x78, 0x78, 
-    0xe3, 0xf0, 0xfc, 0x38, 
-    0xe3, 0xf8, 0xfe, 0x38, 
-    0xe3, 0xf8, 0xfe, 0x38, 
-    0xe3, 0xf8, 0xfe, 0x38, 
-    0xe3, 0xf8, 0xfe, 0x38, 
-    0xe3, 0xf8, 0xfe, 0x38, 
-    0xe3, 0xf8, 0xfe, 0x38, 
-    0xe3, 0xf8, 0xfe, 0x38, 
-    0xe3, 0xf8, 0xfe, 0x38, 
-    0xe3, 0xf8, 0xfe, 0x38, 
-    0xe3, 0xf8, 0xfe, 0x38, 
-    0xe3, 0xf8, 0xfe, 0x38, 
-    0xe3, 0xf8, 0xfe, 0x38, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8, 
-    0xff, 0xff, 0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x6d = { image_data_bc_font_ubuntu_33_0x6d,
-    29, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x6e[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xf0, 0x0f, 0xc0, 
-    0xe0, 0x07, 0xc0, 
-    0xe0, 0x03, 0xc0, 
-    0xe3, 0xe3, 0xc0, 
-    0xe3, 0xe1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x6e = { image_data_bc_font_ubuntu_33_0x6e,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x6f[99] = {
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xfe, 0x0f, 0xe0, 
-    0xf8, 0x03, 0xe0, 
-    0xf0, 0x01, 0xe0, 
-    0xe1, 0xf0, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xc3, 0xf8, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc7, 0xfc, 0x60, 
-    0xc3, 0xf8, 0x60, 
-    0xe3, 0xf8, 0xe0, 
-    0xe1, 0xf0, 0xe0, 
-    0xf0, 0x01, 0xe0, 
-    0xf8, 0x03, 0xe0, 
-    0xfe, 0x0f, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x6f = { image_data_bc_font_ubuntu_33_0x6f,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x70[99] = {
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xf8, 0x0f, 0xe0, 
-    0xe0, 0x03, 0xe0, 
-    0xe0, 0x01, 0xe0, 
-    0xe3, 0xe0, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0x60, 
-    0xe3, 0xfc, 0x60, 
-    0xe3, 0xfc, 0x60, 
-    0xe3, 0xfc, 0x60, 
-    0xe3, 0xfc, 0x60, 
-    0xe3, 0xfc, 0x60, 
-    0xe3, 0xf8, 0x60, 
-    0xe3, 0xf8, 0xe0, 
-    0xe1, 0xf0, 0xe0, 
-    0xe0, 0x01, 0xe0, 
-    0xe0, 0x03, 0xe0, 
-    0xe2, 0x07, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xe3, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x70 = { image_data_bc_font_ubuntu_33_0x70,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x71[99] = {
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xff, 0xff, 0xe0, 
-    0xfe, 0x03, 0xe0, 
-    0xf8, 0x00, 0xe0, 
-    0xf0, 0x00, 0xe0, 
-    0xe0, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xc3, 0xf8, 0xe0, 
-    0xc7, 0xf8, 0xe0, 
-    0xc7, 0xf8, 0xe0, 
-    0xc7, 0xf8, 0xe0, 
-    0xc7, 0xf8, 0xe0, 
-    0xc7, 0xf8, 0xe0, 
-    0xc3, 0xf8, 0xe0, 
-    0xe3, 0xf8, 0xe0, 
-    0xe1, 0xf0, 0xe0, 
-    0xf0, 0x00, 0xe0, 
-    0xf8, 0x00, 0xe0, 
-    0xfc, 0x08, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x71 = { image_data_bc_font_ubuntu_33_0x71,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x72[66] = {
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xf8, 0x00, 
-    0xe0, 0x00, 
-    0xe0, 0x00, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x72 = { image_data_bc_font_ubuntu_33_0x72,
-    12, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x73[66] = {
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xf0, 0x3c, 
-    0xc0, 0x1c, 
-    0xc0, 0x1c, 
-    0x87, 0xdc, 
-    0x8f, 0xfc, 
-    0x8f, 0xfc, 
-    0x87, 0xfc, 
-    0xc0, 0xfc, 
-    0xe0, 0x3c, 
-    0xf8, 0x1c, 
-    0xff, 0x0c, 
-    0xff, 0x8c, 
-    0xff, 0x8c, 
-    0x9f, 0x0c, 
-    0x80, 0x0c, 
-    0x80, 0x1c, 
-    0xc0, 0x7c, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x73 = { image_data_bc_font_ubuntu_33_0x73,
-    14, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x74[66] = {
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe0, 0x18, 
-    0xe0, 0x18, 
-    0xe0, 0x18, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe1, 0xf8, 
-    0xf0, 0x08, 
-    0xf0, 0x08, 
-    0xfc, 0x18, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x74 = { image_data_bc_font_ubuntu_33_0x74,
-    13, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x75[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe1, 0xf1, 0xc0, 
-    0xf1, 0xf1, 0xc0, 
-    0xf0, 0x01, 0xc0, 
-    0xf8, 0x01, 0xc0, 
-    0xfc, 0x03, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x75 = { image_data_bc_font_ubuntu_33_0x75,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x76[99] = {
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0x8f, 0xf8, 0x80, 
-    0x8f, 0xf8, 0x80, 
-    0xc7, 0xf1, 0x80, 
-    0xc7, 0xf1, 0x80, 
-    0xc7, 0xf1, 0x80, 
-    0xe3, 0xe3, 0x80, 
-    0xe3, 0xe3, 0x80, 
-    0xe3, 0xe3, 0x80, 
-    0xf1, 0xc7, 0x80, 
-    0xf1, 0xc7, 0x80, 
-    0xf0, 0x87, 0x80, 
-    0xf8, 0x8f, 0x80, 
-    0xf8, 0x8f, 0x80, 
-    0xfc, 0x1f, 0x80, 
-    0xfc, 0x1f, 0x80, 
-    0xfc, 0x1f, 0x80, 
-    0xfe, 0x3f, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x76 = { image_data_bc_font_ubuntu_33_0x76,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x77[132] = {
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0x8f, 0xe3, 0xf8, 0x80, 
-    0x8f, 0xe3, 0xf8, 0x80, 
-    0xc7, 0xe3, 0xf1, 0x80, 
-    0xc7, 0xc1, 0xf1, 0x80, 
-    0xc7, 0xc1, 0xf1, 0x80, 
-    0xc7, 0xc9, 0xf1, 0x80, 
-    0xe7, 0xc9, 0xf3, 0x80, 
-    0xe3, 0x88, 0xe3, 0x80, 
-    0xe3, 0x88, 0xe3, 0x80, 
-    0xe3, 0x9c, 0xe3, 0x80, 
-    0xf1, 0x1c, 0x47, 0x80, 
-    0xf1, 0x1c, 0x47, 0x80, 
-    0xf1, 0x3e, 0x47, 0x80, 
-    0xf8, 0x3e, 0x0f, 0x80, 
-    0xf8, 0x3e, 0x0f, 0x80, 
-    0xf8, 0x7f, 0x0f, 0x80, 
-    0xfc, 0x7f, 0x1f, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80, 
-    0xff, 0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x77 = { image_data_bc_font_ubuntu_33_0x77,
-    25, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x78[66] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0x8f, 0xe3, 
-    0xc7, 0xc7, 
-    0xe3, 0xc7, 
-    0xe3, 0x8f, 
-    0xf1, 0x1f, 
-    0xf8, 0x1f, 
-    0xf8, 0x3f, 
-    0xfc, 0x3f, 
-    0xfc, 0x3f, 
-    0xf8, 0x3f, 
-    0xf8, 0x1f, 
-    0xf1, 0x0f, 
-    0xe1, 0x8f, 
-    0xe3, 0xc7, 
-    0xc7, 0xc3, 
-    0xc7, 0xe3, 
-    0x8f, 0xf1, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x78 = { image_data_bc_font_ubuntu_33_0x78,
-    16, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x79[66] = {
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0x8f, 0xf1, 
-    0x8f, 0xf1, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xe3, 0xc7, 
-    0xe3, 0xc7, 
-    0xe3, 0xc7, 
-    0xf1, 0xc7, 
-    0xf1, 0x8f, 
-    0xf1, 0x8f, 
-    0xf8, 0x8f, 
-    0xf8, 0x9f, 
-    0xf8, 0x9f, 
-    0xfc, 0x1f, 
-    0xfc, 0x3f, 
-    0xfc, 0x3f, 
-    0xfe, 0x3f, 
-    0xfc, 0x3f, 
-    0xfc, 0x7f, 
-    0x80, 0xff, 
-    0x80, 0xff, 
-    0x83, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x79 = { image_data_bc_font_ubuntu_33_0x79,
-    16, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x7a[66] = {
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0x80, 0x02, 
-    0x80, 0x02, 
-    0x80, 0x02, 
-    0xff, 0xc2, 
-    0xff, 0xc6, 
-    0xff, 0x8e, 
-    0xff, 0x1e, 
-    0xfe, 0x3e, 
-    0xfc, 0x7e, 
-    0xf8, 0xfe, 
-    0xf1, 0xfe, 
-    0xf1, 0xfe, 
-    0xe3, 0xfe, 
-    0xc7, 0xfe, 
-    0x80, 0x02, 
-    0x80, 0x02, 
-    0x80, 0x02, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x7a = { image_data_bc_font_ubuntu_33_0x7a,
-    15, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x7b[66] = {
-    0xff, 0xe0, 
-    0xfe, 0x20, 
-    0xf8, 0x20, 
-    0xf0, 0x20, 
-    0xf0, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xe1, 0xe0, 
-    0x83, 0xe0, 
-    0x87, 0xe0, 
-    0x83, 0xe0, 
-    0xe1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf0, 0xe0, 
-    0xf0, 0x20, 
-    0xf8, 0x20, 
-    0xfe, 0x20, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x7b = { image_data_bc_font_ubuntu_33_0x7b,
-    11, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x7c[66] = {
-    0xff, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x7c = { image_data_bc_font_ubuntu_33_0x7c,
-    9, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x7d[66] = {
-    0xff, 0xe0, 
-    0x8f, 0xe0, 
-    0x83, 0xe0, 
-    0x81, 0xe0, 
-    0xe1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf0, 0xe0, 
-    0xf8, 0x20, 
-    0xfc, 0x20, 
-    0xf8, 0x20, 
-    0xf0, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xf1, 0xe0, 
-    0xe1, 0xe0, 
-    0x81, 0xe0, 
-    0x83, 0xe0, 
-    0x8f, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x7d = { image_data_bc_font_ubuntu_33_0x7d,
-    11, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0x7e[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xe1, 0xf8, 0xc0, 
-    0xc0, 0xf8, 0xc0, 
-    0xc0, 0x30, 0xc0, 
-    0x86, 0x01, 0xc0, 
-    0x8f, 0x81, 0xc0, 
-    0x8f, 0xc3, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0x7e = { image_data_bc_font_ubuntu_33_0x7e,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0xb0[66] = {
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xe0, 0xe0, 
-    0xc0, 0x60, 
-    0x8e, 0x20, 
-    0x9f, 0x20, 
-    0x9f, 0x20, 
-    0x8e, 0x20, 
-    0xc0, 0x60, 
-    0xe0, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0, 
-    0xff, 0xe0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0xb0 = { image_data_bc_font_ubuntu_33_0xb0,
-    11, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0xb9[66] = {
-    0xff, 0xfc, 
-    0xef, 0xbc, 
-    0xc7, 0x1c, 
-    0xe2, 0x3c, 
-    0xf0, 0x7c, 
-    0xf8, 0xfc, 
-    0xfd, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xf0, 0x3c, 
-    0xc0, 0x1c, 
-    0xc0, 0x1c, 
-    0x87, 0xdc, 
-    0x8f, 0xfc, 
-    0x8f, 0xfc, 
-    0x87, 0xfc, 
-    0xc0, 0xfc, 
-    0xe0, 0x3c, 
-    0xf8, 0x1c, 
-    0xff, 0x0c, 
-    0xff, 0x8c, 
-    0xff, 0x8c, 
-    0x9f, 0x0c, 
-    0x80, 0x0c, 
-    0x80, 0x1c, 
-    0xc0, 0x7c, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc, 
-    0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_33_0xb9 = { image_data_bc_font_ubuntu_33_0xb9,
-    14, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0xbb[66] = {
-    0xff, 0xf8, 
-    0xff, 0x18, 
-    0xff, 0x18, 
-    0xff, 0x18, 
-    0xe3, 0x38, 
-    0xe3, 0x38, 
-    0xe3, 0x38, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe0, 0x18, 
-    0xe0, 0x18, 
-    0xe0, 0x18, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe3, 0xf8, 
-    0xe1, 0xf8, 
-    0xf0, 0x08, 
-    0xf0, 0x08, 
-    0xfc, 0x18, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8, 
-    0xff, 0xf8
-};
-static const bc_font_image_t bc_font_ubuntu_33_0xbb = { image_data_bc_font_ubuntu_33_0xbb,
-    13, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0xbe[66] = {
-    0xff, 0xfe, 
-    0xf7, 0xde, 
-    0xe3, 0x8e, 
-    0xf1, 0x1e, 
-    0xf8, 0x3e, 
-    0xfc, 0x7e, 
-    0xfe, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0x80, 0x02, 
-    0x80, 0x02, 
-    0x80, 0x02, 
-    0xff, 0xc2, 
-    0xff, 0xc6, 
-    0xff, 0x8e, 
-    0xff, 0x1e, 
-    0xfe, 0x3e, 
-    0xfc, 0x7e, 
-    0xf8, 0xfe, 
-    0xf1, 0xfe, 
-    0xf1, 0xfe, 
-    0xe3, 0xfe, 
-    0xc7, 0xfe, 
-    0x80, 0x02, 
-    0x80, 0x02, 
-    0x80, 0x02, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_33_0xbe = { image_data_bc_font_ubuntu_33_0xbe,
-    15, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0xe1[99] = {
-    0xff, 0xff, 0x80, 
-    0xff, 0xdf, 0x80, 
-    0xff, 0x8f, 0x80, 
-    0xff, 0x1f, 0x80, 
-    0xfe, 0x3f, 0x80, 
-    0xfc, 0x7f, 0x80, 
-    0xfe, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xf0, 0x1f, 0x80, 
-    0xe0, 0x0f, 0x80, 
-    0xe0, 0x07, 0x80, 
-    0xef, 0xc3, 0x80, 
-    0xff, 0xe3, 0x80, 
-    0xff, 0xe3, 0x80, 
-    0xf8, 0x03, 0x80, 
-    0xe0, 0x03, 0x80, 
-    0xc0, 0x03, 0x80, 
-    0x87, 0xe3, 0x80, 
-    0x8f, 0xe3, 0x80, 
-    0x8f, 0xe3, 0x80, 
-    0x8f, 0xe3, 0x80, 
-    0x87, 0xe3, 0x80, 
-    0xc0, 0x03, 0x80, 
-    0xe0, 0x03, 0x80, 
-    0xf0, 0x07, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80, 
-    0xff, 0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_33_0xe1 = { image_data_bc_font_ubuntu_33_0xe1,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0xe8[66] = {
-    0xff, 0xfe, 
-    0xfd, 0xf6, 
-    0xf8, 0xe2, 
-    0xfc, 0x46, 
-    0xfe, 0x0e, 
-    0xff, 0x1e, 
-    0xff, 0xbe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xfe, 0x06, 
-    0xf8, 0x02, 
-    0xf0, 0x02, 
-    0xe0, 0xfe, 
-    0xe3, 0xfe, 
-    0xc3, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc7, 0xfe, 
-    0xc3, 0xfe, 
-    0xe3, 0xfe, 
-    0xe0, 0xfa, 
-    0xf0, 0x02, 
-    0xf8, 0x02, 
-    0xfe, 0x06, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe, 
-    0xff, 0xfe
-};
-static const bc_font_image_t bc_font_ubuntu_33_0xe8 = { image_data_bc_font_ubuntu_33_0xe8,
-    15, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0xe9[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xef, 0xc0, 
-    0xff, 0xc7, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xfe, 0x3f, 0xc0, 
-    0xff, 0x7f, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xfe, 0x0f, 0xc0, 
-    0xf8, 0x03, 0xc0, 
-    0xf0, 0x01, 0xc0, 
-    0xe1, 0xf1, 0xc0, 
-    0xe3, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc0, 0x00, 0xc0, 
-    0xc0, 0x00, 0xc0, 
-    0xc0, 0x00, 0xc0, 
-    0xc7, 0xff, 0xc0, 
-    0xc7, 0xff, 0xc0, 
-    0xc3, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xe0, 0xfd, 0xc0, 
-    0xf0, 0x01, 0xc0, 
-    0xf8, 0x01, 0xc0, 
-    0xfe, 0x03, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0xe9 = { image_data_bc_font_ubuntu_33_0xe9,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0xec[99] = {
-    0xfd, 0xf7, 0xc0, 
-    0xf8, 0xe3, 0xc0, 
-    0xfc, 0x47, 0xc0, 
-    0xfe, 0x0f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xff, 0xbf, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xfe, 0x0f, 0xc0, 
-    0xf8, 0x03, 0xc0, 
-    0xf0, 0x01, 0xc0, 
-    0xe1, 0xf1, 0xc0, 
-    0xe3, 0xf8, 0xc0, 
-    0xc7, 0xf8, 0xc0, 
-    0xc0, 0x00, 0xc0, 
-    0xc0, 0x00, 0xc0, 
-    0xc0, 0x00, 0xc0, 
-    0xc7, 0xff, 0xc0, 
-    0xc7, 0xff, 0xc0, 
-    0xc3, 0xff, 0xc0, 
-    0xe3, 0xff, 0xc0, 
-    0xe0, 0xfd, 0xc0, 
-    0xf0, 0x01, 0xc0, 
-    0xf8, 0x01, 0xc0, 
-    0xfe, 0x03, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0xec = { image_data_bc_font_ubuntu_33_0xec,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0xed[66] = {
-    0xff, 0x80, 
-    0xfd, 0x80, 
-    0xf8, 0x80, 
-    0xf1, 0x80, 
-    0xe3, 0x80, 
-    0xc7, 0x80, 
-    0xef, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xe3, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80, 
-    0xff, 0x80
-};
-static const bc_font_image_t bc_font_ubuntu_33_0xed = { image_data_bc_font_ubuntu_33_0xed,
-    9, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0xef[99] = {
-    0xff, 0xff, 0xfc, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xf8, 0xe0, 
-    0xff, 0xf8, 0xe4, 
-    0xff, 0xf8, 0xe4, 
-    0xff, 0xf8, 0xe4, 
-    0xff, 0xf8, 0xfc, 
-    0xfc, 0x08, 0xfc, 
-    0xf8, 0x00, 0xfc, 
-    0xf0, 0x00, 0xfc, 
-    0xe1, 0xf0, 0xfc, 
-    0xe3, 0xf8, 0xfc, 
-    0xc3, 0xf8, 0xfc, 
-    0xc7, 0xf8, 0xfc, 
-    0xc7, 0xf8, 0xfc, 
-    0xc7, 0xf8, 0xfc, 
-    0xc7, 0xf8, 0xfc, 
-    0xc7, 0xf8, 0xfc, 
-    0xc3, 0xf8, 0xfc, 
-    0xe3, 0xf8, 0xfc, 
-    0xe0, 0xf8, 0xfc, 
-    0xf0, 0x00, 0xfc, 
-    0xf8, 0x00, 0xfc, 
-    0xfe, 0x01, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc, 
-    0xff, 0xff, 0xfc
-};
-static const bc_font_image_t bc_font_ubuntu_33_0xef = { image_data_bc_font_ubuntu_33_0xef,
-    22, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0xf2[99] = {
-    0xff, 0xff, 0xc0, 
-    0xfb, 0xef, 0xc0, 
-    0xf1, 0xc7, 0xc0, 
-    0xf8, 0x8f, 0xc0, 
-    0xfc, 0x1f, 0xc0, 
-    0xfe, 0x3f, 0xc0, 
-    0xff, 0x7f, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xf0, 0x0f, 0xc0, 
-    0xe0, 0x07, 0xc0, 
-    0xe0, 0x03, 0xc0, 
-    0xe3, 0xe3, 0xc0, 
-    0xe3, 0xe1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0xf2 = { image_data_bc_font_ubuntu_33_0xf2,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0xf8[66] = {
-    0xff, 0xf0, 
-    0xf7, 0xd0, 
-    0xe3, 0x80, 
-    0xf1, 0x10, 
-    0xf8, 0x30, 
-    0xfc, 0x70, 
-    0xfe, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xf8, 0x00, 
-    0xe0, 0x00, 
-    0xe0, 0x00, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xe3, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0, 
-    0xff, 0xf0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0xf8 = { image_data_bc_font_ubuntu_33_0xf8,
-    12, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0xf9[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xfc, 0x1f, 0xc0, 
-    0xf9, 0xcf, 0xc0, 
-    0xf9, 0xcf, 0xc0, 
-    0xf9, 0xcf, 0xc0, 
-    0xfc, 0x1f, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe1, 0xf1, 0xc0, 
-    0xf1, 0xf1, 0xc0, 
-    0xf0, 0x01, 0xc0, 
-    0xf8, 0x01, 0xc0, 
-    0xfc, 0x03, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0xf9 = { image_data_bc_font_ubuntu_33_0xf9,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0xfa[99] = {
-    0xff, 0xff, 0xc0, 
-    0xff, 0xef, 0xc0, 
-    0xff, 0xc7, 0xc0, 
-    0xff, 0x8f, 0xc0, 
-    0xff, 0x1f, 0xc0, 
-    0xfe, 0x3f, 0xc0, 
-    0xff, 0x7f, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe3, 0xf1, 0xc0, 
-    0xe1, 0xf1, 0xc0, 
-    0xf1, 0xf1, 0xc0, 
-    0xf0, 0x01, 0xc0, 
-    0xf8, 0x01, 0xc0, 
-    0xfc, 0x03, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0, 
-    0xff, 0xff, 0xc0
-};
-static const bc_font_image_t bc_font_ubuntu_33_0xfa = { image_data_bc_font_ubuntu_33_0xfa,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_bc_font_ubuntu_33_0xfd[66] = {
-    0xff, 0xff, 
-    0xff, 0xdf, 
-    0xff, 0x8f, 
-    0xff, 0x1f, 
-    0xfe, 0x3f, 
-    0xfc, 0x7f, 
-    0xfe, 0xff, 
-    0xff, 0xff, 
-    0xff, 0xff, 
-    0x8f, 0xf1, 
-    0x8f, 0xf1, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xc7, 0xe3, 
-    0xe3, 0xc7, 
-    0xe3, 0xc7, 
-    0xe3, 0xc7, 
-    0xf1, 0xc7, 
-    0xf1, 0x8f, 
-    0xf1, 0x8f, 
-    0xf8, 0x8f, 
-    0xf8, 0x9f, 
-    0xf8, 0x9f, 
-    0xfc, 0x1f, 
-    0xfc, 0x3f, 
-    0xfc, 0x3f, 
-    0xfe, 0x3f, 
-    0xfc, 0x3f, 
-    0xfc, 0x7f, 
-    0x80, 0xff, 
-    0x80, 0xff, 
-    0x83, 0xff, 
-    0xff, 0xff
-};
-static const bc_font_image_t bc_font_ubuntu_33_0xfd = { image_data_bc_font_ubuntu_33_0xfd,
-    16, 33/*, 8*/};
-#endif
-
-
-static const bc_font_char_t bc_font_ubuntu_33_array[] = {
-
-#if (0x0 == 0x0)
-  // character: ' '
-  {0x20, &bc_font_ubuntu_33_0x20},
-#else
-  // character: ' ' == ''
-  {0x20, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '!'
-  {0x21, &bc_font_ubuntu_33_0x21},
-#else
-  // character: '!' == ''
-  {0x21, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '"'
-  {0x22, &bc_font_ubuntu_33_0x22},
-#else
-  // character: '"' == ''
-  {0x22, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '#'
-  {0x23, &bc_font_ubuntu_33_0x23},
-#else
-  // character: '#' == ''
-  {0x23, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '$'
-  {0x24, &bc_font_ubuntu_33_0x24},
-#else
-  // character: '$' == ''
-  {0x24, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '%'
-  {0x25, &bc_font_ubuntu_33_0x25},
-#else
-  // character: '%' == ''
-  {0x25, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '&'
-  {0x26, &bc_font_ubuntu_33_0x26},
-#else
-  // character: '&' == ''
-  {0x26, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '''
-  {0x27, &bc_font_ubuntu_33_0x27},
-#else
-  // character: ''' == ''
-  {0x27, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '('
-  {0x28, &bc_font_ubuntu_33_0x28},
-#else
-  // character: '(' == ''
-  {0x28, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ')'
-  {0x29, &bc_font_ubuntu_33_0x29},
-#else
-  // character: ')' == ''
-  {0x29, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '*'
-  {0x2a, &bc_font_ubuntu_33_0x2a},
-#else
-  // character: '*' == ''
-  {0x2a, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '+'
-  {0x2b, &bc_font_ubuntu_33_0x2b},
-#else
-  // character: '+' == ''
-  {0x2b, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ','
-  {0x2c, &bc_font_ubuntu_33_0x2c},
-#else
-  // character: ',' == ''
-  {0x2c, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '-'
-  {0x2d, &bc_font_ubuntu_33_0x2d},
-#else
-  // character: '-' == ''
-  {0x2d, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '.'
-  {0x2e, &bc_font_ubuntu_33_0x2e},
-#else
-  // character: '.' == ''
-  {0x2e, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '/'
-  {0x2f, &bc_font_ubuntu_33_0x2f},
-#else
-  // character: '/' == ''
-  {0x2f, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '0'
-  {0x30, &bc_font_ubuntu_33_0x30},
-#else
-  // character: '0' == ''
-  {0x30, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '1'
-  {0x31, &bc_font_ubuntu_33_0x31},
-#else
-  // character: '1' == ''
-  {0x31, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '2'
-  {0x32, &bc_font_ubuntu_33_0x32},
-#else
-  // character: '2' == ''
-  {0x32, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '3'
-  {0x33, &bc_font_ubuntu_33_0x33},
-#else
-  // character: '3' == ''
-  {0x33, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '4'
-  {0x34, &bc_font_ubuntu_33_0x34},
-#else
-  // character: '4' == ''
-  {0x34, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '5'
-  {0x35, &bc_font_ubuntu_33_0x35},
-#else
-  // character: '5' == ''
-  {0x35, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '6'
-  {0x36, &bc_font_ubuntu_33_0x36},
-#else
-  // character: '6' == ''
-  {0x36, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '7'
-  {0x37, &bc_font_ubuntu_33_0x37},
-#else
-  // character: '7' == ''
-  {0x37, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '8'
-  {0x38, &bc_font_ubuntu_33_0x38},
-#else
-  // character: '8' == ''
-  {0x38, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '9'
-  {0x39, &bc_font_ubuntu_33_0x39},
-#else
-  // character: '9' == ''
-  {0x39, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ':'
-  {0x3a, &bc_font_ubuntu_33_0x3a},
-#else
-  // character: ':' == ''
-  {0x3a, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ';'
-  {0x3b, &bc_font_ubuntu_33_0x3b},
-#else
-  // character: ';' == ''
-  {0x3b, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '<'
-  {0x3c, &bc_font_ubuntu_33_0x3c},
-#else
-  // character: '<' == ''
-  {0x3c, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '='
-  {0x3d, &bc_font_ubuntu_33_0x3d},
-#else
-  // character: '=' == ''
-  {0x3d, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '>'
-  {0x3e, &bc_font_ubuntu_33_0x3e},
-#else
-  // character: '>' == ''
-  {0x3e, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '?'
-  {0x3f, &bc_font_ubuntu_33_0x3f},
-#else
-  // character: '?' == ''
-  {0x3f, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\x0040'
-  {0x40, &bc_font_ubuntu_33_0x40},
-#else
-  // character: '\x0040' == ''
-  {0x40, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'A'
-  {0x41, &bc_font_ubuntu_33_0x41},
-#else
-  // character: 'A' == ''
-  {0x41, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'B'
-  {0x42, &bc_font_ubuntu_33_0x42},
-#else
-  // character: 'B' == ''
-  {0x42, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'C'
-  {0x43, &bc_font_ubuntu_33_0x43},
-#else
-  // character: 'C' == ''
-  {0x43, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'D'
-  {0x44, &bc_font_ubuntu_33_0x44},
-#else
-  // character: 'D' == ''
-  {0x44, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'E'
-  {0x45, &bc_font_ubuntu_33_0x45},
-#else
-  // character: 'E' == ''
-  {0x45, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'F'
-  {0x46, &bc_font_ubuntu_33_0x46},
-#else
-  // character: 'F' == ''
-  {0x46, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'G'
-  {0x47, &bc_font_ubuntu_33_0x47},
-#else
-  // character: 'G' == ''
-  {0x47, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'H'
-  {0x48, &bc_font_ubuntu_33_0x48},
-#else
-  // character: 'H' == ''
-  {0x48, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'I'
-  {0x49, &bc_font_ubuntu_33_0x49},
-#else
-  // character: 'I' == ''
-  {0x49, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'J'
-  {0x4a, &bc_font_ubuntu_33_0x4a},
-#else
-  // character: 'J' == ''
-  {0x4a, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'K'
-  {0x4b, &bc_font_ubuntu_33_0x4b},
-#else
-  // character: 'K' == ''
-  {0x4b, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'L'
-  {0x4c, &bc_font_ubuntu_33_0x4c},
-#else
-  // character: 'L' == ''
-  {0x4c, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'M'
-  {0x4d, &bc_font_ubuntu_33_0x4d},
-#else
-  // character: 'M' == ''
-  {0x4d, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'N'
-  {0x4e, &bc_font_ubuntu_33_0x4e},
-#else
-  // character: 'N' == ''
-  {0x4e, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'O'
-  {0x4f, &bc_font_ubuntu_33_0x4f},
-#else
-  // character: 'O' == ''
-  {0x4f, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'P'
-  {0x50, &bc_font_ubuntu_33_0x50},
-#else
-  // character: 'P' == ''
-  {0x50, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Q'
-  {0x51, &bc_font_ubuntu_33_0x51},
-#else
-  // character: 'Q' == ''
-  {0x51, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'R'
-  {0x52, &bc_font_ubuntu_33_0x52},
-#else
-  // character: 'R' == ''
-  {0x52, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'S'
-  {0x53, &bc_font_ubuntu_33_0x53},
-#else
-  // character: 'S' == ''
-  {0x53, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'T'
-  {0x54, &bc_font_ubuntu_33_0x54},
-#else
-  // character: 'T' == ''
-  {0x54, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'U'
-  {0x55, &bc_font_ubuntu_33_0x55},
-#else
-  // character: 'U' == ''
-  {0x55, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'V'
-  {0x56, &bc_font_ubuntu_33_0x56},
-#else
-  // character: 'V' == ''
-  {0x56, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'W'
-  {0x57, &bc_font_ubuntu_33_0x57},
-#else
-  // character: 'W' == ''
-  {0x57, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'X'
-  {0x58, &bc_font_ubuntu_33_0x58},
-#else
-  // character: 'X' == ''
-  {0x58, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Y'
-  {0x59, &bc_font_ubuntu_33_0x59},
-#else
-  // character: 'Y' == ''
-  {0x59, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Z'
-  {0x5a, &bc_font_ubuntu_33_0x5a},
-#else
-  // character: 'Z' == ''
-  {0x5a, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '['
-  {0x5b, &bc_font_ubuntu_33_0x5b},
-#else
-  // character: '[' == ''
-  {0x5b, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\'
-  {0x5c, &bc_font_ubuntu_33_0x5c},
-#else
-  // character: '\' == ''
-  {0x5c, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ']'
-  {0x5d, &bc_font_ubuntu_33_0x5d},
-#else
-  // character: ']' == ''
-  {0x5d, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '^'
-  {0x5e, &bc_font_ubuntu_33_0x5e},
-#else
-  // character: '^' == ''
-  {0x5e, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '_'
-  {0x5f, &bc_font_ubuntu_33_0x5f},
-#else
-  // character: '_' == ''
-  {0x5f, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '`'
-  {0x60, &bc_font_ubuntu_33_0x60},
-#else
-  // character: '`' == ''
-  {0x60, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'a'
-  {0x61, &bc_font_ubuntu_33_0x61},
-#else
-  // character: 'a' == ''
-  {0x61, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'b'
-  {0x62, &bc_font_ubuntu_33_0x62},
-#else
-  // character: 'b' == ''
-  {0x62, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'c'
-  {0x63, &bc_font_ubuntu_33_0x63},
-#else
-  // character: 'c' == ''
-  {0x63, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'd'
-  {0x64, &bc_font_ubuntu_33_0x64},
-#else
-  // character: 'd' == ''
-  {0x64, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'e'
-  {0x65, &bc_font_ubuntu_33_0x65},
-#else
-  // character: 'e' == ''
-  {0x65, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'f'
-  {0x66, &bc_font_ubuntu_33_0x66},
-#else
-  // character: 'f' == ''
-  {0x66, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'g'
-  {0x67, &bc_font_ubuntu_33_0x67},
-#else
-  // character: 'g' == ''
-  {0x67, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'h'
-  {0x68, &bc_font_ubuntu_33_0x68},
-#else
-  // character: 'h' == ''
-  {0x68, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'i'
-  {0x69, &bc_font_ubuntu_33_0x69},
-#else
-  // character: 'i' == ''
-  {0x69, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'j'
-  {0x6a, &bc_font_ubuntu_33_0x6a},
-#else
-  // character: 'j' == ''
-  {0x6a, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'k'
-  {0x6b, &bc_font_ubuntu_33_0x6b},
-#else
-  // character: 'k' == ''
-  {0x6b, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'l'
-  {0x6c, &bc_font_ubuntu_33_0x6c},
-#else
-  // character: 'l' == ''
-  {0x6c, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'm'
-  {0x6d, &bc_font_ubuntu_33_0x6d},
-#else
-  // character: 'm' == ''
-  {0x6d, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'n'
-  {0x6e, &bc_font_ubuntu_33_0x6e},
-#else
-  // character: 'n' == ''
-  {0x6e, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'o'
-  {0x6f, &bc_font_ubuntu_33_0x6f},
-#else
-  // character: 'o' == ''
-  {0x6f, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'p'
-  {0x70, &bc_font_ubuntu_33_0x70},
-#else
-  // character: 'p' == ''
-  {0x70, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'q'
-  {0x71, &bc_font_ubuntu_33_0x71},
-#else
-  // character: 'q' == ''
-  {0x71, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'r'
-  {0x72, &bc_font_ubuntu_33_0x72},
-#else
-  // character: 'r' == ''
-  {0x72, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 's'
-  {0x73, &bc_font_ubuntu_33_0x73},
-#else
-  // character: 's' == ''
-  {0x73, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 't'
-  {0x74, &bc_font_ubuntu_33_0x74},
-#else
-  // character: 't' == ''
-  {0x74, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'u'
-  {0x75, &bc_font_ubuntu_33_0x75},
-#else
-  // character: 'u' == ''
-  {0x75, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'v'
-  {0x76, &bc_font_ubuntu_33_0x76},
-#else
-  // character: 'v' == ''
-  {0x76, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'w'
-  {0x77, &bc_font_ubuntu_33_0x77},
-#else
-  // character: 'w' == ''
-  {0x77, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'x'
-  {0x78, &bc_font_ubuntu_33_0x78},
-#else
-  // character: 'x' == ''
-  {0x78, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'y'
-  {0x79, &bc_font_ubuntu_33_0x79},
-#else
-  // character: 'y' == ''
-  {0x79, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'z'
-  {0x7a, &bc_font_ubuntu_33_0x7a},
-#else
-  // character: 'z' == ''
-  {0x7a, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '{'
-  {0x7b, &bc_font_ubuntu_33_0x7b},
-#else
-  // character: '{' == ''
-  {0x7b, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '|'
-  {0x7c, &bc_font_ubuntu_33_0x7c},
-#else
-  // character: '|' == ''
-  {0x7c, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '}'
-  {0x7d, &bc_font_ubuntu_33_0x7d},
-#else
-  // character: '}' == ''
-  {0x7d, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '~'
-  {0x7e, &bc_font_ubuntu_33_0x7e},
-#else
-  // character: '~' == ''
-  {0x7e, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '°'
-  {0xb0, &bc_font_ubuntu_33_0xb0},
-#else
-  // character: '°' == ''
-  {0xb0, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'š'
-  {0xb9, &bc_font_ubuntu_33_0xb9},
-#else
-  // character: 'š' == ''
-  {0xb9, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ť'
-  {0xbb, &bc_font_ubuntu_33_0xbb},
-#else
-  // character: 'ť' == ''
-  {0xbb, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ž'
-  {0xbe, &bc_font_ubuntu_33_0xbe},
-#else
-  // character: 'ž' == ''
-  {0xbe, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'á'
-  {0xe1, &bc_font_ubuntu_33_0xe1},
-#else
-  // character: 'á' == ''
-  {0xe1, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'č'
-  {0xe8, &bc_font_ubuntu_33_0xe8},
-#else
-  // character: 'č' == ''
-  {0xe8, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'é'
-  {0xe9, &bc_font_ubuntu_33_0xe9},
-#else
-  // character: 'é' == ''
-  {0xe9, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ě'
-  {0xec, &bc_font_ubuntu_33_0xec},
-#else
-  // character: 'ě' == ''
-  {0xec, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'í'
-  {0xed, &bc_font_ubuntu_33_0xed},
-#else
-  // character: 'í' == ''
-  {0xed, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ď'
-  {0xef, &bc_font_ubuntu_33_0xef},
-#else
-  // character: 'ď' == ''
-  {0xef, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ň'
-  {0xf2, &bc_font_ubuntu_33_0xf2},
-#else
-  // character: 'ň' == ''
-  {0xf2, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ř'
-  {0xf8, &bc_font_ubuntu_33_0xf8},
-#else
-  // character: 'ř' == ''
-  {0xf8, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ů'
-  {0xf9, &bc_font_ubuntu_33_0xf9},
-#else
-  // character: 'ů' == ''
-  {0xf9, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ú'
-  {0xfa, &bc_font_ubuntu_33_0xfa},
-#else
-  // character: 'ú' == ''
-  {0xfa, &bc_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ý'
-  {0xfd, &bc_font_ubuntu_33_0xfd}
-#else
-  // character: 'ý' == ''
-  {0xfd, &bc_font_ubuntu_33_0x}
-#endif
-
-};
-
-
-const bc_font_t bc_font_ubuntu_33 = { 110, bc_font_ubuntu_33_array };
+// Glyphs are compressed by sdk/tools/font/bc-font-rle.py
+
+static const uint8_t bc_font_ubuntu_33_rle_data[3879] = {
+    // ' '
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    // '!'
+    0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0x31, 0x11, 0x71, 0xfa, 0x35, 0x13, 0x1d, 0x13, 0x15, 0x3f, 0xff, 0xc0,
+    // '"'
+    0xf0, 0x33, 0x3f, 0xff, 0xff, 0x71, 0x11, 0x31, 0x11, 0x51, 0x51, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
+    // '#'
+    0xff, 0xff, 0xff, 0x23, 0x33, 0xff, 0xf8, 0x12, 0x12, 0x12, 0x1f, 0xff, 0x35, 0x33, 0x33, 0xff, 0xf1, 0x43, 0x33, 0x4f, 0xff, 0xf7, 0x43, 0x33, 0x4f, 0xff, 0x13, 0x33, 0x35, 0xff, 0xf3, 0x12, 0x12, 0x12, 0x1f, 0xff, 0x83, 0x33, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    // '$'
+    0xfb, 0x3f, 0xff, 0xf7, 0x23, 0x38, 0x28, 0x16, 0x1f, 0x11, 0x37, 0x11, 0x81, 0x71, 0xff, 0xf0, 0x1e, 0x13, 0x3c, 0x15, 0x2b, 0x25, 0x2b, 0x25, 0x1c, 0x33, 0x1e, 0x13, 0x1e, 0x1f, 0xfe, 0x27, 0x17, 0x12, 0x73, 0x1f, 0x11, 0x52, 0x91, 0x84, 0x32, 0xff, 0xff, 0x73, 0xff, 0xd0,
+    // '%'
+    0xff, 0xff, 0xff, 0xf8, 0x58, 0x39, 0x25, 0x25, 0x12, 0x1c, 0x3f, 0x51, 0x21, 0x31, 0x21, 0x31, 0x21, 0xff, 0xf4, 0x12, 0x1f, 0x71, 0x21, 0xff, 0x81, 0x21, 0x31, 0x22, 0x21, 0xf1, 0x3f, 0x62, 0x53, 0x21, 0xf1, 0x57, 0x5f, 0x11, 0x23, 0x52, 0xf6, 0x3f, 0x11, 0x22, 0x21, 0x31, 0x21, 0xff, 0x81, 0x21, 0xf7, 0x12, 0x1f, 0xff, 0x41, 0x21, 0x31, 0x21, 0x31, 0x21, 0xf5, 0x3c, 0x12, 0x15, 0x25, 0x29, 0x38, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
+    // '&'
+    0xff, 0xff, 0xff, 0x06, 0xe1, 0x62, 0xb1, 0xf4, 0x13, 0x43, 0x1c, 0x14, 0x1f, 0xfb, 0x1c, 0x15, 0x23, 0x1c, 0x34, 0x1b, 0x16, 0x2c, 0x15, 0x1d, 0x1d, 0x24, 0x14, 0x12, 0x15, 0x19, 0x21, 0x12, 0x1a, 0x12, 0x14, 0x12, 0x12, 0x12, 0x1c, 0x12, 0x2f, 0x21, 0x51, 0xf0, 0x13, 0x15, 0x12, 0x26, 0x13, 0x1a, 0x65, 0x15, 0x1a, 0x32, 0x15, 0x26, 0x23, 0x12, 0x16, 0x66, 0x3f, 0xff, 0xff, 0xff, 0xf7,
+    // "'"
+    0xa3, 0xff, 0xf8, 0x11, 0x16, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    // '('
+    0xf5, 0x19, 0x11, 0x17, 0x12, 0x16, 0x12, 0x1f, 0x21, 0x21, 0xf2, 0x12, 0x1f, 0xf9, 0x12, 0x1f, 0xff, 0xff, 0xf5, 0x12, 0x1f, 0xfb, 0x12, 0x1f, 0x41, 0x21, 0xf4, 0x12, 0x18, 0x12, 0x18, 0x11, 0x19, 0x11,
+    // ')'
+    0xa1, 0xa1, 0xa1, 0x71, 0x21, 0xf2, 0x12, 0x1f, 0x21, 0x21, 0xff, 0x71, 0x21, 0xff, 0xff, 0xfb, 0x12, 0x1f, 0xf5, 0x12, 0x1f, 0x01, 0x21, 0xf0, 0x12, 0x18, 0x18, 0x18, 0x19,
+    // '*'
+    0xff, 0xff, 0x63, 0xff, 0x81, 0x91, 0x31, 0x12, 0x11, 0x11, 0x12, 0x11, 0x21, 0x32, 0x12, 0x31, 0x34, 0x34, 0x71, 0x11, 0x11, 0x91, 0x51, 0xf7, 0x12, 0x11, 0x12, 0x16, 0x25, 0x28, 0x13, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    // '+'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x3f, 0xff, 0xff, 0xf9, 0x63, 0x6f, 0xf9, 0x63, 0x6f, 0xff, 0xff, 0xf9, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    // ','
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf9, 0x1c, 0x17, 0x11, 0x16, 0x1c,
+    // '-'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xf7, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x60,
+    // '.'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x25, 0x12, 0x1c, 0x12, 0x15, 0x2f, 0xff, 0x60,
+    // '/'
+    0xf8, 0x39, 0x12, 0x1f, 0xf4, 0x12, 0x1f, 0xf4, 0x12, 0x1f, 0xf4, 0x12, 0x1f, 0xf4, 0x12, 0x1f, 0x61, 0xf0, 0x1f, 0x61, 0x21, 0xff, 0x41, 0x21, 0xff, 0x41, 0x21, 0xff, 0x41, 0x21, 0xff, 0x71, 0xa2, 0xb0,
+    // '0'
+    0xff, 0xff, 0xf4, 0x4c, 0x24, 0x29, 0x18, 0x17, 0x13, 0x43, 0x19, 0x14, 0x1f, 0xb1, 0x21, 0x61, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x12, 0x16, 0x12, 0x1f, 0xb1, 0x41, 0x91, 0x34, 0x31, 0x71, 0x81, 0x92, 0x42, 0xc4, 0xff, 0xff, 0xff, 0xfa,
+    // '1'
+    0xff, 0xff, 0xf6, 0x3e, 0x1f, 0x02, 0xe2, 0xf0, 0x1f, 0x62, 0xc1, 0x12, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x3f, 0xff, 0xff, 0xff, 0x90,
+    // '2'
+    0xff, 0xff, 0xf2, 0x6a, 0x26, 0x27, 0x1a, 0x16, 0x13, 0x44, 0x17, 0x24, 0x29, 0x1f, 0xff, 0xf1, 0x12, 0x1d, 0x1f, 0x51, 0xd1, 0x21, 0xd1, 0x21, 0xd1, 0x21, 0xd1, 0x21, 0xd1, 0x21, 0xd1, 0x21, 0xd1, 0x21, 0xff, 0x11, 0x3a, 0xff, 0xae, 0xff, 0xff, 0xff, 0xf5,
+    // '3'
+    0xff, 0xff, 0xf2, 0x78, 0x37, 0x1f, 0x31, 0x61, 0x26, 0x31, 0x62, 0x61, 0xff, 0xf7, 0x22, 0x19, 0x43, 0x1f, 0xf5, 0x1a, 0x44, 0x1d, 0x23, 0x1e, 0x1f, 0xff, 0xfb, 0x17, 0x27, 0x13, 0x16, 0x73, 0x1f, 0x11, 0x62, 0x72, 0x97, 0xff, 0xff, 0xff, 0xfa,
+    // '4'
+    0xff, 0xff, 0xf8, 0x3e, 0x1f, 0x11, 0xf1, 0x1f, 0x11, 0xf1, 0x13, 0x1c, 0x13, 0x1f, 0x11, 0xd1, 0x21, 0xd1, 0x21, 0xff, 0x11, 0x21, 0xd1, 0x21, 0xf2, 0x73, 0x3f, 0xf8, 0xa3, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0x70,
+    // '5'
+    0xff, 0xff, 0xf1, 0xbf, 0xff, 0x18, 0xff, 0xff, 0xf7, 0x3b, 0x16, 0x3f, 0x31, 0x76, 0x51, 0xc3, 0xf3, 0x12, 0x1f, 0xff, 0xf8, 0x17, 0x27, 0x13, 0x16, 0x7f, 0x52, 0x52, 0x72, 0x97, 0xff, 0xff, 0xff, 0xfa,
+    // '6'
+    0xff, 0xff, 0xf8, 0x4b, 0x3d, 0x2f, 0x01, 0x54, 0x71, 0x33, 0xe1, 0xd1, 0x21, 0xff, 0x47, 0x81, 0x21, 0x62, 0xf3, 0x19, 0x5c, 0x15, 0x13, 0x1e, 0x1f, 0xff, 0x11, 0xe1, 0x91, 0xb1, 0x41, 0x31, 0x51, 0x34, 0x31, 0x71, 0xf3, 0x16, 0x2a, 0x6f, 0xff, 0xff, 0xff, 0x90,
+    // '7'
+    0xff, 0xff, 0xee, 0xff, 0xab, 0x21, 0xe1, 0xf1, 0x12, 0x1d, 0x12, 0x1f, 0xf1, 0x12, 0x1f, 0xf1, 0x12, 0x1f, 0xf1, 0x12, 0x1f, 0xff, 0x41, 0x21, 0xff, 0xf7, 0x1e, 0x1f, 0xff, 0x83, 0xff, 0xff, 0xff, 0xfd,
+    // '8'
+    0xff, 0xff, 0xf3, 0x6b, 0x16, 0x19, 0x18, 0x17, 0x13, 0x43, 0x19, 0x14, 0x1f, 0xff, 0x31, 0xe1, 0x31, 0x31, 0x21, 0x71, 0x33, 0x21, 0x91, 0x61, 0x92, 0x62, 0x71, 0x24, 0x41, 0xd2, 0x81, 0x21, 0x61, 0x21, 0xff, 0xd1, 0xe1, 0x31, 0x42, 0xc4, 0x41, 0x51, 0xa1, 0x72, 0x62, 0xa6, 0xff, 0xff, 0xff, 0xf9,
+    // '9'
+    0xff, 0xff, 0xf3, 0x6a, 0x26, 0x1f, 0x31, 0x71, 0x34, 0x31, 0x51, 0x31, 0x41, 0xb1, 0x91, 0xe1, 0xff, 0xf1, 0x1e, 0x13, 0x15, 0x1c, 0x59, 0x1f, 0x32, 0x61, 0xb7, 0x21, 0xff, 0x11, 0x21, 0xd1, 0xe3, 0x31, 0x74, 0x51, 0xf0, 0x2d, 0x3b, 0x4f, 0xff, 0xff, 0xff, 0xe0,
+    // ':'
+    0xff, 0xff, 0xf0, 0x25, 0x12, 0x1c, 0x12, 0x15, 0x2f, 0xff, 0xfa, 0x25, 0x12, 0x1c, 0x12, 0x15, 0x2f, 0xff, 0x60,
+    // ';'
+    0xff, 0xff, 0xf0, 0x25, 0x12, 0x1c, 0x12, 0x15, 0x2f, 0xff, 0xfa, 0x3f, 0xf9, 0x1c, 0x17, 0x11, 0x16, 0x1c,
+    // '<'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1e, 0x3d, 0x24, 0x18, 0x35, 0x26, 0x25, 0x36, 0x25, 0x28, 0x14, 0x3d, 0x2f, 0x12, 0xd1, 0x43, 0xb2, 0x52, 0xb2, 0x53, 0xa3, 0x52, 0xb2, 0x41, 0xd3, 0xf3, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xb0,
+    // '='
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf0, 0xff, 0x9f, 0x0f, 0xff, 0xcf, 0x0f, 0xf9, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    // '>'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0x32, 0xe1, 0x33, 0xb2, 0x52, 0xb2, 0x52, 0xb3, 0x42, 0xc2, 0x41, 0xd2, 0xf1, 0x2e, 0x24, 0x18, 0x34, 0x27, 0x25, 0x27, 0x25, 0x29, 0x13, 0x3d, 0x2f, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+    // '?'
+    0xff, 0xfa, 0x65, 0x26, 0x2f, 0x11, 0x15, 0x31, 0x31, 0x51, 0xff, 0x81, 0x21, 0xf5, 0x22, 0x17, 0x13, 0x1b, 0x18, 0x12, 0x1f, 0xf5, 0x3f, 0xf6, 0x3f, 0xff, 0x43, 0xff, 0xff, 0xf9,
+    // '@'
+    0xff, 0xff, 0xff, 0xb8, 0xf5, 0x28, 0x3f, 0x02, 0xd1, 0xd1, 0x57, 0x41, 0xb1, 0x42, 0x72, 0x31, 0x91, 0x32, 0xb1, 0x31, 0xb1, 0xe1, 0x31, 0x61, 0x96, 0x41, 0xc1, 0x42, 0x61, 0xf5, 0x1d, 0x12, 0x14, 0x12, 0x18, 0x3f, 0x71, 0x31, 0xfd, 0x1f, 0xff, 0xff, 0xfb, 0x1f, 0x21, 0xe1, 0xb1, 0xd1, 0xb1, 0x74, 0x33, 0x31, 0x51, 0x71, 0xe1, 0xa1, 0x41, 0x52, 0x51, 0x81, 0x85, 0x25, 0xd1, 0xfb, 0x13, 0x2f, 0xa1, 0x42, 0x71, 0xf1, 0x15, 0x7f, 0x32, 0xff, 0x02, 0xff, 0x09, 0xff, 0xa0,
+    // 'A'
+    0xff, 0xff, 0xff, 0x33, 0xf2, 0x13, 0x1f, 0xff, 0xc1, 0x21, 0x21, 0xff, 0x41, 0x21, 0x11, 0x21, 0xff, 0x21, 0x91, 0xd1, 0x31, 0xff, 0x31, 0x21, 0x51, 0x21, 0xfd, 0x1d, 0x1a, 0x7f, 0xf0, 0x1f, 0x01, 0x7b, 0x61, 0xf2, 0x15, 0x1b, 0x1f, 0xa1, 0x21, 0xd1, 0x24, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xf6,
+    // 'B'
+    0xff, 0xff, 0xfc, 0xbf, 0x62, 0xf6, 0x1a, 0x74, 0x1f, 0x11, 0xf6, 0x1f, 0xff, 0xf1, 0x22, 0x19, 0x73, 0x1f, 0xfb, 0x1a, 0x83, 0x1f, 0x21, 0x31, 0xf2, 0x1f, 0xff, 0xf2, 0x1f, 0x32, 0x31, 0x87, 0xf9, 0x2f, 0x22, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    // 'C'
+    0xff, 0xff, 0xfe, 0x8a, 0x28, 0x26, 0x2f, 0x86, 0x21, 0x51, 0x32, 0x62, 0x51, 0x31, 0xf3, 0x1f, 0x01, 0xf7, 0x1f, 0xff, 0xff, 0xff, 0xe1, 0xf1, 0x1f, 0x81, 0xf1, 0x13, 0x1f, 0x51, 0x72, 0x61, 0x47, 0x21, 0x62, 0xf5, 0x28, 0x2a, 0x8f, 0xff, 0xff, 0xff, 0xf3,
+    // 'D'
+    0xff, 0xff, 0xff, 0x5a, 0xf8, 0x3f, 0x81, 0xc7, 0x41, 0xf3, 0x23, 0x1f, 0x41, 0x31, 0xf4, 0x1f, 0xb1, 0xf4, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x21, 0xfa, 0x1f, 0x31, 0xf6, 0x13, 0x1f, 0x12, 0x31, 0xa7, 0x41, 0xf6, 0x1f, 0x43, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    // 'E'
+    0xff, 0xff, 0xf0, 0xdf, 0xfe, 0xaf, 0xff, 0xff, 0xf8, 0x9f, 0xff, 0x09, 0xff, 0xff, 0xff, 0xfc, 0xbf, 0xfa, 0xef, 0xff, 0xff, 0xff, 0x40,
+    // 'F'
+    0xff, 0xff, 0xbd, 0xff, 0xba, 0xff, 0xff, 0xff, 0x29, 0xff, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xf8,
+    // 'G'
+    0xff, 0xff, 0xff, 0x78, 0xc2, 0x82, 0x82, 0xf4, 0x15, 0x62, 0x1b, 0x26, 0x27, 0x13, 0x1f, 0x51, 0xf2, 0x1f, 0x91, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0x71, 0xf3, 0x1f, 0xa1, 0xf3, 0x13, 0x1f, 0x71, 0xf2, 0x14, 0x7b, 0x1f, 0x73, 0x82, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    // 'H'
+    0xff, 0xff, 0xff, 0x53, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3b, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x60,
+    // 'I'
+    0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xc0,
+    // 'J'
+    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x17, 0x25, 0x13, 0x13, 0x12, 0x5f, 0x41, 0x43, 0x62, 0x86, 0xff, 0xff, 0xff, 0xd0,
+    // 'K'
+    0xff, 0xff, 0xf8, 0x39, 0x4f, 0x01, 0x31, 0xe1, 0x31, 0xe1, 0x31, 0xe1, 0x31, 0xe1, 0x31, 0xe1, 0x31, 0xe1, 0x31, 0xe1, 0x31, 0xe1, 0x31, 0xf3, 0x1f, 0x42, 0xf0, 0x14, 0x1f, 0x01, 0x41, 0xf0, 0x14, 0x1f, 0x02, 0x31, 0xf1, 0x13, 0x1f, 0x11, 0x31, 0xf5, 0x1f, 0x01, 0xf5, 0x13, 0x1f, 0x11, 0x31, 0x33, 0xa4, 0xff, 0xff, 0xff, 0xff, 0x00,
+    // 'L'
+    0xff, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xaf, 0xf8, 0xdf, 0xff, 0xff, 0xfd,
+    // 'M'
+    0xff, 0xff, 0xff, 0xff, 0x03, 0xf0, 0x3b, 0x1d, 0x1f, 0xfe, 0x1b, 0x1b, 0x1f, 0x61, 0xc1, 0x91, 0xf0, 0x1f, 0x01, 0xd1, 0x21, 0x71, 0x21, 0xff, 0xe1, 0x21, 0x51, 0x21, 0xff, 0xf1, 0x12, 0x13, 0x12, 0x1f, 0xff, 0x31, 0x71, 0xc1, 0xa1, 0x11, 0xf3, 0x15, 0x15, 0x15, 0x12, 0x1f, 0x11, 0xff, 0xfa, 0x13, 0x1f, 0xa3, 0xff, 0xff, 0xd3, 0xf4, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
+    // 'N'
+    0xff, 0xff, 0xff, 0x53, 0xb3, 0x91, 0xf8, 0x1f, 0x81, 0xff, 0xd1, 0x21, 0xf8, 0x1f, 0x41, 0x31, 0xf4, 0x1f, 0x81, 0x21, 0xf8, 0x1f, 0x41, 0xf8, 0x12, 0x1f, 0xfd, 0x12, 0x1f, 0x51, 0x21, 0xff, 0xd1, 0xf8, 0x1f, 0xff, 0x11, 0xff, 0x23, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    // 'O'
+    0xff, 0xff, 0xff, 0xf4, 0x7f, 0x12, 0x72, 0xc2, 0xb2, 0x91, 0x55, 0x51, 0xc2, 0x52, 0xb1, 0x31, 0x91, 0x31, 0x91, 0xb1, 0x81, 0xf4, 0x17, 0x1d, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x01, 0xd1, 0x71, 0xf4, 0x18, 0x1b, 0x19, 0x13, 0x19, 0x13, 0x1b, 0x25, 0x2c, 0x15, 0x55, 0x19, 0x2b, 0x2c, 0x27, 0x2f, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
+    // 'P'
+    0xff, 0xff, 0xf4, 0xaf, 0x42, 0xf4, 0x19, 0x73, 0x1f, 0x01, 0x31, 0xf0, 0x1f, 0xff, 0xff, 0x01, 0xf1, 0x23, 0x17, 0x64, 0x1f, 0x21, 0xf1, 0x2a, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0x70,
+    // 'Q'
+    0xff, 0xff, 0xff, 0xf4, 0x7f, 0x12, 0x72, 0xc2, 0xb2, 0x91, 0x55, 0x51, 0xc2, 0x52, 0xb1, 0x31, 0x91, 0x31, 0x91, 0xb1, 0x81, 0xf4, 0x17, 0x1d, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x01, 0xd1, 0x71, 0xf4, 0x18, 0x1b, 0x19, 0x13, 0x19, 0x13, 0x17, 0x13, 0x25, 0x2d, 0x14, 0x55, 0x1a, 0x1b, 0x2c, 0x27, 0x2f, 0x13, 0x31, 0xf9, 0x1f, 0x61, 0x33, 0xf4, 0x15, 0x3f, 0x22, 0x51, 0xf4, 0x2f, 0xa3, 0x40,
+    // 'R'
+    0xff, 0xff, 0xf8, 0xaf, 0x52, 0xf5, 0x29, 0x7f, 0x51, 0x31, 0xf1, 0x1f, 0xff, 0xe1, 0xf3, 0x13, 0x18, 0x7f, 0x72, 0xf1, 0x2b, 0x52, 0x1f, 0x51, 0xf1, 0x1f, 0x81, 0xf1, 0x1f, 0x81, 0xf1, 0x1f, 0x81, 0xf1, 0x13, 0x14, 0x39, 0x4f, 0xff, 0xff, 0xff, 0xf1,
+    // 'S'
+    0xff, 0xff, 0xe7, 0x82, 0x72, 0x51, 0xf0, 0x13, 0x62, 0x17, 0x16, 0x2f, 0xfc, 0x1d, 0x13, 0x2c, 0x14, 0x2b, 0x15, 0x2a, 0x34, 0x2b, 0x24, 0x1c, 0x1f, 0x22, 0x21, 0xff, 0xf9, 0x27, 0x25, 0x12, 0x74, 0x1f, 0x01, 0x33, 0x82, 0x78, 0xff, 0xff, 0xff, 0xf2,
+    // 'T'
+    0xff, 0xff, 0xf2, 0xf2, 0xff, 0xa7, 0x37, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff, 0xff, 0xf2,
+    // 'U'
+    0xff, 0xff, 0xff, 0x13, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x81, 0x91, 0xe1, 0xa2, 0x42, 0xb1, 0x44, 0x41, 0x91, 0xa1, 0xb2, 0x62, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    // 'V'
+    0xff, 0xff, 0xf9, 0x3f, 0x04, 0x21, 0xd1, 0x21, 0xfa, 0x1b, 0x15, 0x1f, 0x21, 0xfc, 0x19, 0x17, 0x1f, 0x01, 0xfb, 0x12, 0x17, 0x12, 0x1f, 0xf1, 0x15, 0x1b, 0x1b, 0x1c, 0x13, 0x1d, 0x19, 0x1f, 0xf2, 0x12, 0x11, 0x1f, 0x81, 0xf1, 0x1f, 0x21, 0x51, 0xff, 0x61, 0x31, 0xf2, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x00,
+    // 'W'
+    0xff, 0xff, 0xff, 0xff, 0x53, 0xf8, 0x3f, 0xf6, 0x1f, 0x61, 0x51, 0xc3, 0xc1, 0xf3, 0x1f, 0xb1, 0xff, 0xf8, 0x19, 0x12, 0x16, 0x17, 0x19, 0x1f, 0x01, 0xff, 0xf2, 0x14, 0x1f, 0x21, 0x41, 0x41, 0x71, 0x91, 0xf8, 0x1d, 0x12, 0x16, 0x1f, 0xc1, 0xf5, 0x1f, 0x01, 0xb1, 0x41, 0x21, 0x51, 0x21, 0x41, 0xff, 0xd1, 0xd1, 0xf4, 0x17, 0x1f, 0x11, 0xf4, 0x1f, 0x01, 0xfb, 0x4a, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    // 'X'
+    0xff, 0xff, 0xf6, 0x49, 0x43, 0x1f, 0x01, 0x41, 0x21, 0x71, 0x21, 0x91, 0x51, 0xa1, 0xb1, 0x81, 0x21, 0x31, 0xf1, 0x15, 0x1a, 0x14, 0x12, 0x1c, 0x12, 0x1f, 0x71, 0xe1, 0xf4, 0x1f, 0x91, 0xd1, 0x61, 0xb1, 0x32, 0xf2, 0x15, 0x19, 0x16, 0x13, 0x1b, 0x14, 0x1a, 0x12, 0x19, 0x15, 0x1a, 0x13, 0x17, 0x18, 0x16, 0x1f, 0x11, 0x24, 0xa4, 0xff, 0xff, 0xff, 0xff, 0x10,
+    // 'Y'
+    0xff, 0xff, 0xf1, 0x4b, 0x5f, 0x21, 0x41, 0x91, 0x51, 0xf0, 0x13, 0x12, 0x17, 0x12, 0x18, 0x15, 0x19, 0x1b, 0x1a, 0x13, 0x1b, 0x15, 0x13, 0x19, 0x12, 0x14, 0x1e, 0x1f, 0x01, 0x51, 0xd1, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0x20,
+    // 'Z'
+    0xff, 0xff, 0xef, 0x0f, 0xf9, 0xbf, 0x21, 0x31, 0xc1, 0x31, 0xf1, 0x1d, 0x12, 0x1d, 0x1f, 0x11, 0x31, 0xf1, 0x1d, 0x12, 0x1d, 0x1f, 0x11, 0x31, 0xf1, 0x1d, 0x12, 0x1d, 0x1f, 0x51, 0xd1, 0xf1, 0x14, 0xbf, 0xf8, 0xf1, 0xff, 0xff, 0xff, 0xf4,
+    // '['
+    0xe8, 0xfd, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x5f, 0xa8,
+    // '\\'
+    0xd2, 0xd1, 0xff, 0x61, 0x21, 0xff, 0x61, 0x21, 0xff, 0x61, 0x21, 0xff, 0x61, 0x21, 0xfb, 0x19, 0x1f, 0xb1, 0x21, 0xff, 0x61, 0x21, 0xff, 0x61, 0x21, 0xff, 0x61, 0x21, 0xff, 0x61, 0x21, 0xa3,
+    // ']'
+    0xb8, 0xfa, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x5f, 0xd8, 0x30,
+    // '^'
+    0xff, 0xff, 0xf5, 0x3e, 0x13, 0x1f, 0xf0, 0x12, 0x12, 0x1a, 0x17, 0x1c, 0x11, 0x1b, 0x12, 0x13, 0x12, 0x1f, 0x91, 0x21, 0x51, 0x21, 0xf7, 0x12, 0x17, 0x12, 0x13, 0x11, 0x19, 0x11, 0x14, 0x1b, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
+    // '_'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x1f, 0xf2, 0xf1,
+    // '`'
+    0xf0, 0x1a, 0x11, 0x19, 0x12, 0x19, 0x12, 0x19, 0x12, 0x19, 0x11, 0x1a, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    // 'a'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0x91, 0x71, 0xf2, 0x18, 0x63, 0x16, 0x16, 0x1f, 0xd6, 0x92, 0xe1, 0xf0, 0x13, 0x6a, 0x1f, 0xff, 0x51, 0xd1, 0x36, 0x81, 0xf2, 0x19, 0x17, 0x9f, 0xff, 0xff, 0xff, 0x10,
+    // 'b'
+    0xf7, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x6c, 0x16, 0x1f, 0x41, 0xb5, 0x31, 0x91, 0x51, 0xf7, 0x1f, 0x01, 0xff, 0xff, 0xff, 0x41, 0xf6, 0x1d, 0x2c, 0x54, 0x1f, 0x21, 0x71, 0x82, 0x98, 0xff, 0xff, 0xff, 0xff, 0x10,
+    // 'c'
+    0xff, 0xff, 0xff, 0xff, 0xf7, 0x67, 0x26, 0x15, 0x1d, 0x14, 0x67, 0x29, 0x1f, 0x21, 0xff, 0xff, 0xe1, 0xb1, 0xf3, 0x25, 0x14, 0x14, 0x56, 0x1f, 0x02, 0x61, 0x86, 0xff, 0xff, 0xff, 0x20,
+    // 'd'
+    0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x6c, 0x16, 0x1a, 0x1f, 0x21, 0x35, 0xd1, 0x51, 0x81, 0xf6, 0x1f, 0xff, 0xff, 0xf4, 0x1f, 0x01, 0xf7, 0x2e, 0x14, 0x5a, 0x1f, 0x42, 0x81, 0xa8, 0xff, 0xff, 0xff, 0xfd,
+    // 'e'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x5b, 0x25, 0x28, 0x19, 0x16, 0x13, 0x5c, 0x15, 0x12, 0x14, 0x12, 0x1f, 0x28, 0xff, 0xf1, 0xbf, 0xa1, 0xe1, 0xf6, 0x26, 0x16, 0x14, 0x68, 0x1f, 0x32, 0x71, 0xa7, 0xff, 0xff, 0xff, 0xf7,
+    // 'f'
+    0xf3, 0x65, 0x1a, 0x1a, 0x13, 0x47, 0x14, 0x1f, 0xfc, 0x5f, 0xf1, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x3f, 0xff, 0xff, 0x30,
+    // 'g'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x7a, 0x27, 0x27, 0x1f, 0x21, 0x36, 0xc1, 0xe1, 0xf6, 0x1f, 0xff, 0xff, 0xf1, 0x12, 0x1f, 0x41, 0x51, 0x91, 0x35, 0xb1, 0xf4, 0x16, 0x1c, 0x6f, 0xf8, 0x19, 0x26, 0x13, 0x18, 0x6f, 0x71, 0x71, 0x82, 0x98, 0x70,
+    // 'h'
+    0xf7, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x6f, 0x42, 0xf4, 0x1a, 0x5f, 0x41, 0x31, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x37, 0x3f, 0xff, 0xff, 0xff, 0xc0,
+    // 'i'
+    0xf6, 0x3f, 0x93, 0xff, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xfc,
+    // 'j'
+    0xf6, 0x3f, 0x93, 0xff, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x16, 0x23, 0x17, 0x17, 0x15, 0x36,
+    // 'k'
+    0xf5, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x74, 0xf1, 0x1c, 0x12, 0x1c, 0x12, 0x1c, 0x12, 0x1c, 0x12, 0x1c, 0x12, 0x1c, 0x12, 0x1f, 0x11, 0xd1, 0x31, 0xd1, 0x31, 0xd1, 0x31, 0xd1, 0x31, 0xd1, 0x31, 0xd1, 0xf2, 0x12, 0x1f, 0x21, 0x33, 0x74, 0xff, 0xff, 0xff, 0xc0,
+    // 'l'
+    0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xa2, 0x41, 0xa1, 0xa4, 0xff, 0xff, 0x10,
+    // 'm'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x84, 0x69, 0x28, 0x11, 0x26, 0x1f, 0x41, 0x91, 0xa5, 0x64, 0xf4, 0x14, 0x14, 0x13, 0x1f, 0x01, 0x91, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x37, 0x37, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    // 'n'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x89, 0x18, 0x1f, 0x31, 0xa5, 0xf6, 0x1e, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x63, 0xff, 0xff, 0xff, 0xf6,
+    // 'o'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x5c, 0x25, 0x29, 0x19, 0x17, 0x13, 0x53, 0x19, 0x15, 0x18, 0x1d, 0x17, 0x17, 0x1f, 0xff, 0xff, 0xb1, 0x71, 0x71, 0xd1, 0x81, 0x51, 0x91, 0x35, 0x31, 0x71, 0x91, 0x92, 0x52, 0xc5, 0xff, 0xff, 0xff, 0xff, 0x10,
+    // 'p'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x7a, 0x27, 0x2f, 0x41, 0xa5, 0x41, 0xe2, 0xf7, 0x1f, 0x01, 0xff, 0xff, 0xff, 0x41, 0xf6, 0x18, 0x15, 0x1d, 0x53, 0x1f, 0x21, 0xa1, 0x61, 0xc6, 0xff, 0xff, 0xff, 0xe3, 0xd0,
+    // 'q'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x7a, 0x27, 0x27, 0x1f, 0x21, 0x45, 0xc2, 0xd1, 0xf6, 0x1f, 0xff, 0xff, 0xf4, 0x1f, 0x01, 0xf7, 0x15, 0x19, 0x13, 0x5b, 0x1f, 0x41, 0x61, 0xc6, 0xff, 0xff, 0xff, 0xfa, 0x33,
+    // 'r'
+    0xff, 0xff, 0xff, 0xf8, 0x73, 0x2f, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0xff, 0xf3,
+    // 's'
+    0xff, 0xff, 0xff, 0xff, 0xa6, 0x62, 0x61, 0xf3, 0x13, 0x58, 0x15, 0x1f, 0x61, 0xa1, 0x33, 0x81, 0x52, 0x72, 0x51, 0x83, 0x31, 0xa1, 0xf5, 0x25, 0x18, 0x5f, 0x21, 0x31, 0x72, 0x57, 0xff, 0xff, 0xfe,
+    // 't'
+    0xff, 0xfa, 0x3f, 0xff, 0xf5, 0x5f, 0xf4, 0x5f, 0xff, 0xff, 0xff, 0xf5, 0x19, 0x13, 0x5f, 0x32, 0x51, 0x75, 0xff, 0xff, 0xf5,
+    // 'u'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x36, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xe1, 0xf6, 0x5a, 0x1f, 0x31, 0x81, 0x98, 0xff, 0xff, 0xff, 0xf7,
+    // 'v'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x43, 0x93, 0xf4, 0x12, 0x17, 0x12, 0x1f, 0xf7, 0x12, 0x15, 0x12, 0x1f, 0xf9, 0x12, 0x13, 0x12, 0x1f, 0xc1, 0x11, 0xb1, 0x71, 0xfb, 0x12, 0x12, 0x1f, 0xff, 0x01, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xf4,
+    // 'w'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x37, 0x37, 0x3f, 0xc1, 0x21, 0xf0, 0x12, 0x1b, 0x13, 0x1f, 0xff, 0x21, 0xe1, 0xf4, 0x17, 0x13, 0x15, 0x13, 0x1f, 0xfb, 0x11, 0x1e, 0x12, 0x11, 0x17, 0x11, 0x12, 0x1f, 0xf8, 0x13, 0x1e, 0x12, 0x19, 0x12, 0x1f, 0xf8, 0x15, 0x1e, 0x1d, 0x1b, 0x37, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    // 'x'
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0x37, 0x33, 0x12, 0x15, 0x12, 0x14, 0x12, 0x1f, 0x41, 0x21, 0x61, 0x21, 0x11, 0x21, 0x81, 0x21, 0xf3, 0x1a, 0x1f, 0xf1, 0x1f, 0x51, 0x91, 0x21, 0x31, 0x71, 0x41, 0xd1, 0x21, 0x21, 0x51, 0x21, 0x71, 0xc1, 0x61, 0x21, 0x61, 0x21, 0x23, 0x83, 0xff, 0xff, 0xff, 0x70,
+    // 'y'
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0x38, 0x3f, 0x31, 0x21, 0x61, 0x21, 0xff, 0x51, 0x21, 0x41, 0x21, 0xff, 0x71, 0x21, 0xf3, 0x12, 0x1f, 0x81, 0x21, 0xf4, 0x1f, 0xa1, 0x21, 0xf2, 0x1f, 0xc1, 0xf0, 0x1f, 0x31, 0x75, 0x21, 0xfe, 0x29, 0x5a,
+    // 'z'
+    0xff, 0xff, 0xff, 0xff, 0xf1, 0xdf, 0xf2, 0x9f, 0x31, 0xa1, 0x21, 0xa1, 0x21, 0xa1, 0x21, 0xa1, 0x21, 0xa1, 0x21, 0xa1, 0x21, 0xfa, 0x12, 0x1a, 0x12, 0x1a, 0x13, 0x9f, 0xf2, 0xdf, 0xff, 0xff, 0xf1,
+    // '{'
+    0xf3, 0x36, 0x28, 0x1e, 0x28, 0x1f, 0xff, 0xff, 0xf4, 0x18, 0x23, 0x19, 0x1a, 0x16, 0x23, 0x17, 0x1f, 0xff, 0xff, 0xfc, 0x1b, 0x25, 0x1b, 0x2b, 0x31,
+    // '|'
+    0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x63, 0x30,
+    // '}'
+    0xc3, 0xb2, 0xb1, 0x52, 0xb1, 0xff, 0xff, 0xff, 0xc1, 0x71, 0x32, 0x61, 0xa1, 0x91, 0x32, 0x81, 0xff, 0xff, 0xff, 0x41, 0x82, 0xe1, 0x82, 0x63, 0x70,
+    // '~'
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x46, 0x34, 0x14, 0x1f, 0x32, 0x21, 0x61, 0x32, 0x32, 0x31, 0x61, 0x22, 0xf3, 0x14, 0x14, 0x36, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    // '°'
+    0xfa, 0x55, 0x15, 0x13, 0x12, 0x32, 0x14, 0x13, 0x1f, 0x21, 0x31, 0x41, 0x23, 0x21, 0x31, 0x51, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
+    // 'š'
+    0xf2, 0x15, 0x16, 0x11, 0x13, 0x11, 0x15, 0x12, 0x11, 0x12, 0x16, 0x12, 0x12, 0x18, 0x13, 0x1a, 0x11, 0x1c, 0x1f, 0xa6, 0x62, 0x61, 0xf3, 0x13, 0x58, 0x15, 0x1f, 0x61, 0xa1, 0x33, 0x81, 0x52, 0x72, 0x51, 0x83, 0x31, 0xa1, 0xf5, 0x25, 0x18, 0x5f, 0x21, 0x31, 0x72, 0x57, 0xff, 0xff, 0xfe,
+    // 'ť'
+    0xf6, 0x3f, 0xf1, 0x34, 0x1f, 0xf6, 0x2f, 0x75, 0xff, 0x45, 0xff, 0xff, 0xff, 0xff, 0x51, 0x91, 0x35, 0xf3, 0x25, 0x17, 0x5f, 0xff, 0xff, 0x50,
+    // 'ž'
+    0xf4, 0x15, 0x17, 0x11, 0x13, 0x11, 0x16, 0x12, 0x11, 0x12, 0x17, 0x12, 0x12, 0x19, 0x13, 0x1b, 0x11, 0x1d, 0x1f, 0x8d, 0xff, 0x29, 0xf3, 0x1a, 0x12, 0x1a, 0x12, 0x1a, 0x12, 0x1a, 0x12, 0x1a, 0x12, 0x1a, 0x12, 0x1f, 0xa1, 0x21, 0xa1, 0x21, 0xa1, 0x39, 0xff, 0x2d, 0xff, 0xff, 0xff, 0x10,
+    // 'á'
+    0xfc, 0x1f, 0x01, 0x11, 0xd1, 0x21, 0xc1, 0x21, 0xc1, 0x21, 0xd1, 0x11, 0xf0, 0x1f, 0xf0, 0x79, 0x17, 0x1f, 0x21, 0x86, 0x31, 0x61, 0x61, 0xfd, 0x69, 0x2e, 0x1f, 0x01, 0x36, 0xa1, 0xff, 0xf5, 0x1d, 0x13, 0x68, 0x1f, 0x21, 0x91, 0x79, 0xff, 0xff, 0xff, 0xf1,
+    // 'č'
+    0xf6, 0x15, 0x17, 0x11, 0x13, 0x11, 0x16, 0x12, 0x11, 0x12, 0x17, 0x12, 0x12, 0x19, 0x13, 0x1b, 0x11, 0x1d, 0x1f, 0xc6, 0x72, 0x61, 0x51, 0xd1, 0x46, 0x72, 0x91, 0xf2, 0x1f, 0xff, 0xfe, 0x1b, 0x1f, 0x32, 0x51, 0x41, 0x45, 0x61, 0xf0, 0x26, 0x18, 0x6f, 0xff, 0xff, 0xf2,
+    // 'é'
+    0xfe, 0x1f, 0x11, 0x11, 0xe1, 0x21, 0xd1, 0x21, 0xd1, 0x21, 0xe1, 0x11, 0xf1, 0x1f, 0xf4, 0x5b, 0x25, 0x28, 0x19, 0x16, 0x13, 0x5c, 0x15, 0x12, 0x14, 0x12, 0x1f, 0x28, 0xff, 0xf1, 0xbf, 0xa1, 0xe1, 0xf6, 0x26, 0x16, 0x14, 0x68, 0x1f, 0x32, 0x71, 0xa7, 0xff, 0xff, 0xff, 0xf7,
+    // 'ě'
+    0x61, 0x51, 0xa1, 0x11, 0x31, 0x11, 0x91, 0x21, 0x11, 0x21, 0xa1, 0x21, 0x21, 0xc1, 0x31, 0xe1, 0x11, 0xf1, 0x1f, 0xff, 0x65, 0xb2, 0x52, 0x81, 0x91, 0x61, 0x35, 0xc1, 0x51, 0x21, 0x41, 0x21, 0xf2, 0x8f, 0xff, 0x1b, 0xfa, 0x1e, 0x1f, 0x62, 0x61, 0x61, 0x46, 0x81, 0xf3, 0x27, 0x1a, 0x7f, 0xff, 0xff, 0xff, 0x70,
+    // 'í'
+    0xf0, 0x17, 0x11, 0x15, 0x12, 0x14, 0x12, 0x14, 0x12, 0x15, 0x11, 0x17, 0x1f, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xfc,
+    // 'ď'
+    0xff, 0x53, 0x33, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xf3, 0x27, 0x6f, 0x01, 0x61, 0xd1, 0xf5, 0x13, 0x5f, 0x11, 0x51, 0xb1, 0xf9, 0x1f, 0xff, 0xff, 0xff, 0x41, 0xf3, 0x1f, 0xa2, 0xf2, 0x14, 0x5d, 0x1f, 0x72, 0x81, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    // 'ň'
+    0xf8, 0x15, 0x1a, 0x11, 0x13, 0x11, 0x19, 0x12, 0x11, 0x12, 0x1a, 0x12, 0x12, 0x1c, 0x13, 0x1e, 0x11, 0x1f, 0x11, 0xff, 0x18, 0x91, 0x81, 0xf3, 0x1a, 0x5f, 0x61, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x36, 0x3f, 0xff, 0xff, 0xff, 0x60,
+    // 'ř'
+    0xf1, 0x15, 0x14, 0x11, 0x13, 0x11, 0x13, 0x12, 0x11, 0x12, 0x14, 0x12, 0x12, 0x16, 0x13, 0x18, 0x11, 0x1a, 0x1f, 0x67, 0x32, 0xfa, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x3f, 0xff, 0xff, 0x30,
+    // 'ů'
+    0xff, 0xc5, 0xc1, 0x13, 0x11, 0xff, 0xf2, 0x11, 0x31, 0x1c, 0x5f, 0xd3, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1e, 0x1f, 0x65, 0xa1, 0xf3, 0x18, 0x19, 0x8f, 0xff, 0xff, 0xff, 0x70,
+    // 'ú'
+    0xfe, 0x1f, 0x11, 0x11, 0xe1, 0x21, 0xd1, 0x21, 0xd1, 0x21, 0xe1, 0x11, 0xf1, 0x1f, 0xf0, 0x36, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xe1, 0xf6, 0x5a, 0x1f, 0x31, 0x81, 0x98, 0xff, 0xff, 0xff, 0xf7,
+    // 'ý'
+    0xfb, 0x1e, 0x11, 0x1c, 0x12, 0x1b, 0x12, 0x1b, 0x12, 0x1c, 0x11, 0x1e, 0x1f, 0xa3, 0x83, 0xf3, 0x12, 0x16, 0x12, 0x1f, 0xf5, 0x12, 0x14, 0x12, 0x1f, 0xf7, 0x12, 0x1f, 0x31, 0x21, 0xf8, 0x12, 0x1f, 0x41, 0xfa, 0x12, 0x1f, 0x21, 0xfc, 0x1f, 0x01, 0xf3, 0x17, 0x52, 0x1f, 0xe2, 0x95, 0xa0,
+};
+
+static const bc_font_rle_char_t bc_font_ubuntu_33_rle_chars[110] = {
+    { 0x20, 7, 0 },
+    { 0x21, 9, 8 },
+    { 0x22, 13, 26 },
+    { 0x23, 21, 48 },
+    { 0x24, 18, 91 },
+    { 0x25, 27, 137 },
+    { 0x26, 21, 211 },
+    { 0x27, 8, 276 },
+    { 0x28, 11, 288 },
+    { 0x29, 10, 322 },
+    { 0x2a, 15, 351 },
+    { 0x2b, 18, 391 },
+    { 0x2c, 8, 415 },
+    { 0x2d, 10, 428 },
+    { 0x2e, 8, 441 },
+    { 0x2f, 13, 455 },
+    { 0x30, 18, 489 },
+    { 0x31, 18, 530 },
+    { 0x32, 18, 558 },
+    { 0x33, 18, 601 },
+    { 0x34, 18, 642 },
+    { 0x35, 18, 680 },
+    { 0x36, 18, 714 },
+    { 0x37, 18, 758 },
+    { 0x38, 18, 792 },
+    { 0x39, 18, 842 },
+    { 0x3a, 8, 886 },
+    { 0x3b, 8, 905 },
+    { 0x3c, 18, 923 },
+    { 0x3d, 18, 961 },
+    { 0x3e, 18, 984 },
+    { 0x3f, 13, 1023 },
+    { 0x40, 30, 1053 },
+    { 0x41, 21, 1132 },
+    { 0x42, 21, 1181 },
+    { 0x43, 20, 1222 },
+    { 0x44, 23, 1265 },
+    { 0x45, 18, 1308 },
+    { 0x46, 17, 1331 },
+    { 0x47, 22, 1352 },
+    { 0x48, 23, 1396 },
+    { 0x49, 9, 1425 },
+    { 0x4a, 16, 1437 },
+    { 0x4b, 20, 1463 },
+    { 0x4c, 17, 1519 },
+    { 0x4d, 29, 1539 },
+    { 0x4e, 23, 1602 },
+    { 0x4f, 25, 1647 },
+    { 0x50, 19, 1703 },
+    { 0x51, 25, 1738 },
+    { 0x52, 20, 1803 },
+    { 0x53, 17, 1845 },
+    { 0x54, 19, 1887 },
+    { 0x55, 22, 1911 },
+    { 0x56, 21, 1946 },
+    { 0x57, 31, 1997 },
+    { 0x58, 20, 2065 },
+    { 0x59, 19, 2125 },
+    { 0x5a, 18, 2169 },
+    { 0x5b, 11, 2209 },
+    { 0x5c, 13, 2223 },
+    { 0x5d, 11, 2255 },
+    { 0x5e, 18, 2270 },
+    { 0x5f, 16, 2313 },
+    { 0x60, 12, 2332 },
+    { 0x61, 17, 2355 },
+    { 0x62, 19, 2389 },
+    { 0x63, 15, 2425 },
+    { 0x64, 19, 2456 },
+    { 0x65, 18, 2491 },
+    { 0x66, 12, 2528 },
+    { 0x67, 19, 2549 },
+    { 0x68, 19, 2590 },
+    { 0x69, 9, 2619 },
+    { 0x6a, 9, 2632 },
+    { 0x6b, 17, 2649 },
+    { 0x6c, 10, 2692 },
+    { 0x6d, 29, 2708 },
+    { 0x6e, 18, 2754 },
+    { 0x6f, 19, 2780 },
+    { 0x70, 19, 2821 },
+    { 0x71, 19, 2856 },
+    { 0x72, 12, 2891 },
+    { 0x73, 14, 2907 },
+    { 0x74, 13, 2940 },
+    { 0x75, 18, 2961 },
+    { 0x76, 17, 2987 },
+    { 0x77, 25, 3025 },
+    { 0x78, 16, 3080 },
+    { 0x79, 16, 3129 },
+    { 0x7a, 15, 3168 },
+    { 0x7b, 11, 3201 },
+    { 0x7c, 9, 3226 },
+    { 0x7d, 11, 3238 },
+    { 0x7e, 18, 3263 },
+    { 0xb0, 11, 3296 },
+    { 0xb9, 14, 3322 },
+    { 0xbb, 13, 3370 },
+    { 0xbe, 15, 3394 },
+    { 0xe1, 17, 3442 },
+    { 0xe8, 15, 3485 },
+    { 0xe9, 18, 3530 },
+    { 0xec, 18, 3576 },
+    { 0xed, 9, 3628 },
+    { 0xef, 22, 3650 },
+    { 0xf2, 18, 3691 },
+    { 0xf8, 12, 3732 },
+    { 0xf9, 18, 3764 },
+    { 0xfa, 18, 3796 },
+    { 0xfd, 16, 3831 },
+};
+
+static const uint8_t bc_font_ubuntu_33_index[BC_FONT_INDEX_LENGTH] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xff, 0x61, 0xff, 0xff, 0x62, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x65, 0xff, 0xff, 0x66, 0x67, 0xff, 0x68,
+    0xff, 0xff, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x6b, 0x6c, 0xff, 0xff, 0x6d, 0xff, 0xff,
+};
+
+const bc_font_t bc_font_ubuntu_33 = { 110, NULL, bc_font_ubuntu_33_index, 33, bc_font_ubuntu_33_rle_chars, bc_font_ubuntu_33_rle_data };
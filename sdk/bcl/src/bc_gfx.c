@@ -1,5 +1,12 @@
 #include <bc_gfx.h>
 
+static int _bc_gfx_find_char(const bc_font_t *font, uint8_t ch);
+static void _bc_gfx_draw_mono(bc_gfx_t *self, int left, int top, const uint8_t *image, int w, int h, uint32_t color);
+static int _bc_gfx_draw_rle_char(bc_gfx_t *self, int left, int top, const bc_font_rle_char_t *rle_char, uint32_t color);
+static inline void _bc_gfx_flip_bits(uint8_t *row, int x, int count);
+static inline void _bc_gfx_draw_span(bc_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t color);
+static void _bc_gfx_fill_rect(bc_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t color);
+
 void bc_gfx_init(bc_gfx_t *self, void *display, const bc_gfx_driver_t *driver)
 {
     memset(self, 0, sizeof(*self));
@@ -86,58 +93,49 @@ void bc_gfx_draw_pixel(bc_gfx_t *self, int x, int y, uint32_t color)
 
 int bc_gfx_draw_char(bc_gfx_t *self, int left, int top, uint8_t ch, uint32_t color)
 {
-    const bc_font_t *font = self->_font;
-
-    int w = 0;
-    uint8_t h = 0;
-    uint16_t i;
-    uint16_t x;
-    uint16_t y;
-    uint8_t bytes;
+    int position = _bc_gfx_find_char(self->_font, ch);
 
-    for (i = 0; i < font->length; i++)
+    if (position < 0)
     {
-        if (font->chars[i].code == ch)
-        {
-            w = font->chars[i].image->width;
-            h = font->chars[i].image->heigth;
+        return 0;
+    }
 
-            bytes = (w + 7) / 8;
+    if (self->_font->rle_chars != NULL)
+    {
+        return _bc_gfx_draw_rle_char(self, left, top, &self->_font->rle_chars[position], color);
+    }
 
-            for (y = 0; y < h; y++)
-            {
-                for (x = 0; x < w; x++)
-                {
-                    uint32_t byteIndex = x / 8;
-                    byteIndex += y * bytes;
+    const bc_font_image_t *image = self->_font->chars[position].image;
 
-                    uint8_t bitMask = 1 << (7 - (x % 8));
+    int w = image->width;
+    int h = image->heigth;
 
-                    if ((font->chars[i].image->image[byteIndex] & bitMask) == 0)
-                    {
-                        bc_gfx_draw_pixel(self, left + x, top + y, color);
-                    }
-                }
-            }
-        }
+    // Glyph out of display is not drawn at all
+    if (left >= self->_caps.width || top >= self->_caps.height || left + w <= 0 || top + h <= 0)
+    {
+        return w;
     }
 
+    _bc_gfx_draw_mono(self, left, top, image->image, w, h, color);
+
     return w;
 }
 
 int bc_gfx_calc_char_width(bc_gfx_t *self, uint8_t ch)
 {
-    const bc_font_t *font = self->_font;
+    int position = _bc_gfx_find_char(self->_font, ch);
 
-    for (int i = 0; i < font->length; i++)
+    if (position < 0)
     {
-        if (font->chars[i].code == ch)
-        {
-            return font->chars[i].image->width;
-        }
+        return 0;
     }
 
-    return 0;
+    if (self->_font->rle_chars != NULL)
+    {
+        return self->_font->rle_chars[position].width;
+    }
+
+    return self->_font->chars[position].image->width;
 }
 
 int bc_gfx_draw_string(bc_gfx_t *self, int left, int top, char *str, uint32_t color)
@@ -176,6 +174,30 @@ int bc_gfx_printf(bc_gfx_t *self, int left, int top, uint32_t color, char *forma
     return bc_gfx_draw_string(self, left, top, buffer, color);
 }
 
+void bc_gfx_draw_image(bc_gfx_t *self, int left, int top, const bc_image_t *image)
+{
+    int w = image->width;
+    int h = image->height;
+
+    if (self->_driver->blit != NULL && self->_rotation == BC_GFX_ROTATION_0 &&
+        left >= 0 && top >= 0 && left + w <= self->_caps.width && top + h <= self->_caps.height)
+    {
+        self->_driver->blit(self->_display, left, top, image->data, w, h);
+
+        return;
+    }
+
+    int bytes = (w + 7) / 8;
+
+    for (int y = 0; y < h; y++)
+    {
+        for (int x = 0; x < w; x++)
+        {
+            bc_gfx_draw_pixel(self, left + x, top + y, (image->data[x / 8 + y * bytes] >> (x % 8)) & 1);
+        }
+    }
+}
+
 void bc_gfx_draw_line(bc_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t color)
 {
     int tmp;
@@ -189,10 +211,7 @@ void bc_gfx_draw_line(bc_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t c
             x1 = tmp;
         }
 
-        for (; x0 <= x1; x0++)
-        {
-            bc_gfx_draw_pixel(self, x0, y0, color);
-        }
+        _bc_gfx_fill_rect(self, x0, y0, x1, y1, color);
 
         return;
     }
@@ -205,10 +224,7 @@ void bc_gfx_draw_line(bc_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t c
             y1 = tmp;
         }
 
-        for (; y0 <= y1; y0++)
-        {
-            bc_gfx_draw_pixel(self, x0, y0, color);
-        }
+        _bc_gfx_fill_rect(self, x0, y0, x1, y1, color);
 
         return;
     }
@@ -245,18 +261,26 @@ void bc_gfx_draw_line(bc_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t c
 
     ystep = y0 < y1 ? 1 : -1;
 
+    // Pixels are drawn as runs which share the same minor coordinate
+    int run = x0;
+
     for (; x0 <= x1; x0++)
     {
-        if (step)
-        {
-            bc_gfx_draw_pixel(self, y0, x0, color);
-        }
-        else
+        err -= dy;
+
+        if (err < 0 || x0 == x1)
         {
-            bc_gfx_draw_pixel(self, x0, y0, color);
-        }
+            if (step)
+            {
+                _bc_gfx_fill_rect(self, y0, run, y0, x0, color);
+            }
+            else
+            {
+                _bc_gfx_fill_rect(self, run, y0, x0, y0, color);
+            }
 
-        err -= dy;
+            run = x0 + 1;
+        }
 
         if (err < 0)
         {
@@ -276,14 +300,7 @@ void bc_gfx_draw_rectangle(bc_gfx_t *self, int x0, int y0, int x1, int y1, uint3
 
 void bc_gfx_draw_fill_rectangle(bc_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t color)
 {
-    int y;
-    for (; x0 <= x1; x0++)
-    {
-        for (y = y0; y <= y1; y++)
-        {
-            bc_gfx_draw_pixel(self, x0, y, color);
-        }
-    }
+    _bc_gfx_fill_rect(self, x0, y0, x1, y1, color);
 }
 
 void bc_gfx_draw_fill_rectangle_dithering(bc_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t color)
@@ -468,3 +485,351 @@ bool bc_gfx_update(bc_gfx_t *self)
 {
     return self->_driver->update(self->_display);
 }
+
+static int _bc_gfx_find_char(const bc_font_t *font, uint8_t ch)
+{
+    if (font->index != NULL)
+    {
+        if (ch < BC_FONT_INDEX_FIRST || font->index[ch - BC_FONT_INDEX_FIRST] == BC_FONT_INDEX_NONE)
+        {
+            return -1;
+        }
+
+        return font->index[ch - BC_FONT_INDEX_FIRST];
+    }
+
+    for (int i = 0; i < font->length; i++)
+    {
+        if ((font->rle_chars != NULL ? font->rle_chars[i].code : font->chars[i].code) == ch)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static void _bc_gfx_draw_mono(bc_gfx_t *self, int left, int top, const uint8_t *image, int w, int h, uint32_t color)
+{
+    // Rows are copied to framebuffer byte-wise if display is not rotated and image is not clipped
+    if (self->_driver->blit_mono != NULL && self->_rotation == BC_GFX_ROTATION_0 &&
+        left >= 0 && top >= 0 && left + w <= self->_caps.width && top + h <= self->_caps.height)
+    {
+        self->_driver->blit_mono(self->_display, left, top, image, w, h, color);
+
+        return;
+    }
+
+    uint8_t bytes = (w + 7) / 8;
+
+    // Driver without span operations gets pixels
+    if (self->_driver->draw_hspan == NULL && self->_driver->fill_rect == NULL)
+    {
+        for (int y = 0; y < h; y++)
+        {
+            for (int x = 0; x < w; x++)
+            {
+                if ((image[y * bytes + x / 8] & (0x80 >> (x % 8))) == 0)
+                {
+                    bc_gfx_draw_pixel(self, left + x, top + y, color);
+                }
+            }
+        }
+
+        return;
+    }
+
+    // Otherwise pixels of cleared bits are drawn by spans, which are clipped and rotated once per span.
+    // Spans go along rows of display, that is along image columns if display is rotated by 90 or 270 degrees.
+    if (self->_rotation == BC_GFX_ROTATION_90 || self->_rotation == BC_GFX_ROTATION_270)
+    {
+        for (int x = 0; x < w; x++)
+        {
+            const uint8_t *column = &image[x / 8];
+            uint8_t mask = 0x80 >> (x % 8);
+
+            for (int y = 0; y < h;)
+            {
+                if ((column[y * bytes] & mask) != 0)
+                {
+                    y++;
+
+                    continue;
+                }
+
+                int start = y;
+
+                while (y < h && (column[y * bytes] & mask) == 0)
+                {
+                    y++;
+                }
+
+                _bc_gfx_draw_span(self, left + x, top + start, left + x, top + y - 1, color);
+            }
+        }
+
+        return;
+    }
+
+    for (int y = 0; y < h; y++)
+    {
+        const uint8_t *row = &image[y * bytes];
+
+        for (int x = 0; x < w;)
+        {
+            // Whole bytes of set bits are skipped
+            if ((x % 8) == 0 && row[x / 8] == 0xff)
+            {
+                x += 8;
+
+                continue;
+            }
+
+            if ((row[x / 8] & (0x80 >> (x % 8))) != 0)
+            {
+                x++;
+
+                continue;
+            }
+
+            int start = x;
+
+            while (x < w)
+            {
+                if ((x % 8) == 0 && x + 8 <= w && row[x / 8] == 0)
+                {
+                    x += 8;
+                }
+                else if ((row[x / 8] & (0x80 >> (x % 8))) == 0)
+                {
+                    x++;
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            _bc_gfx_draw_span(self, left + start, top + y, left + x - 1, top + y, color);
+        }
+    }
+}
+
+static int _bc_gfx_draw_rle_char(bc_gfx_t *self, int left, int top, const bc_font_rle_char_t *rle_char, uint32_t color)
+{
+    int w = rle_char->width;
+    int h = self->_font->rle_height;
+
+    // Glyph out of display is not drawn at all
+    if (left >= self->_caps.width || top >= self->_caps.height || left + w <= 0 || top + h <= 0)
+    {
+        return w;
+    }
+
+    // Rows below display are not decoded
+    if (top + h > self->_caps.height)
+    {
+        h = self->_caps.height - top;
+    }
+
+    const uint8_t *data = &self->_font->rle_data[rle_char->offset];
+
+    // Decoded rows in glyph image format (pixels of cleared bits are drawn), they are drawn in chunks
+    uint8_t buffer[BC_FONT_RLE_BUFFER_SIZE];
+
+    int bytes = (w + 7) / 8;
+    int chunk = sizeof(buffer) / bytes;
+    int first = 0;
+
+    uint8_t *row = buffer;
+
+    memset(row, 0xff, bytes);
+
+    int nibble = 0;
+    int run = 0;
+    bool flip = true;
+
+    for (int y = 0; y < h; y++)
+    {
+        // Every row is coded as pixels flipped against the previous row
+        if (y > first)
+        {
+            memcpy(row + bytes, row, bytes);
+
+            row += bytes;
+        }
+
+        for (int x = 0; x < w;)
+        {
+            // Runs alternate between kept and flipped pixels, a run can have zero length
+            while (run == 0)
+            {
+                uint8_t value;
+
+                flip = !flip;
+
+                do
+                {
+                    value = (data[nibble / 2] >> ((nibble % 2) == 0 ? 4 : 0)) & 0x0f;
+
+                    run += value;
+
+                    nibble++;
+                }
+                while (value == 15);
+            }
+
+            int count = run < w - x ? run : w - x;
+
+            if (flip)
+            {
+                _bc_gfx_flip_bits(row, x, count);
+            }
+
+            x += count;
+            run -= count;
+        }
+
+        if (y - first + 1 == chunk || y == h - 1)
+        {
+            // Rows above display are skipped
+            int skip = top + first < 0 ? -(top + first) : 0;
+
+            if (y - first + 1 > skip)
+            {
+                _bc_gfx_draw_mono(self, left, top + first + skip, buffer + skip * bytes, w, y - first + 1 - skip, color);
+            }
+
+            // The last row is the base of the next chunk
+            memcpy(buffer, row, bytes);
+
+            row = buffer;
+            first = y + 1;
+        }
+    }
+
+    return w;
+}
+
+static inline void _bc_gfx_flip_bits(uint8_t *row, int x, int count)
+{
+    while (count > 0)
+    {
+        int n = 8 - (x % 8) < count ? 8 - (x % 8) : count;
+
+        row[x / 8] ^= (uint8_t) (0xff << (8 - n)) >> (x % 8);
+
+        x += n;
+        count -= n;
+    }
+}
+
+static inline void _bc_gfx_draw_span(bc_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t color)
+{
+    // Single pixel is cheaper without rectangle setup of driver
+    if (x0 == x1 && y0 == y1)
+    {
+        bc_gfx_draw_pixel(self, x0, y0, color);
+    }
+    else
+    {
+        _bc_gfx_fill_rect(self, x0, y0, x1, y1, color);
+    }
+}
+
+static void _bc_gfx_fill_rect(bc_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t color)
+{
+    int width = self->_caps.width;
+    int height = self->_caps.height;
+
+    // Clip as bc_gfx_draw_pixel does
+    x0 = x0 < 0 ? 0 : x0;
+    y0 = y0 < 0 ? 0 : y0;
+    x1 = x1 >= width ? width - 1 : x1;
+    y1 = y1 >= height ? height - 1 : y1;
+
+    if (x0 > x1 || y0 > y1)
+    {
+        return;
+    }
+
+    int left;
+    int top;
+    int right;
+    int bottom;
+
+    // Corners in display coordinates
+    switch (self->_rotation)
+    {
+        case BC_GFX_ROTATION_90:
+        {
+            left = height - 1 - y1;
+            right = height - 1 - y0;
+            top = x0;
+            bottom = x1;
+            break;
+        }
+        case BC_GFX_ROTATION_180:
+        {
+            left = width - 1 - x1;
+            right = width - 1 - x0;
+            top = height - 1 - y1;
+            bottom = height - 1 - y0;
+            break;
+        }
+        case BC_GFX_ROTATION_270:
+        {
+            left = y0;
+            right = y1;
+            top = width - 1 - x1;
+            bottom = width - 1 - x0;
+            break;
+        }
+        case BC_GFX_ROTATION_0:
+        default:
+        {
+            left = x0;
+            right = x1;
+            top = y0;
+            bottom = y1;
+            break;
+        }
+    }
+
+    // Rotated rectangle of non-square display can get out of it
+    right = right >= width ? width - 1 : right;
+    bottom = bottom >= height ? height - 1 : bottom;
+
+    if (left > right || top > bottom)
+    {
+        return;
+    }
+
+    const bc_gfx_driver_t *driver = self->_driver;
+
+    if (top == bottom && driver->draw_hspan != NULL)
+    {
+        driver->draw_hspan(self->_display, left, top, right - left + 1, color);
+    }
+    else if (driver->fill_rect != NULL)
+    {
+        driver->fill_rect(self->_display, left, top, right - left + 1, bottom - top + 1, color);
+    }
+    else if (driver->draw_hspan != NULL)
+    {
+        for (int y = top; y <= bottom; y++)
+        {
+            driver->draw_hspan(self->_display, left, y, right - left + 1, color);
+        }
+    }
+    else
+    {
+        for (int y = top; y <= bottom; y++)
+        {
+            for (int x = left; x <= right; x++)
+            {
+                driver->draw_pixel(self->_display, x, y, color);
+            }
+        }
+    }
+}
@@ -1,5 +1,6 @@
 #include <bc_i2c.h>
 #include <bc_tick.h>
+#include <bc_irq.h>
 #include <stm32l0xx.h>
 #include <bc_scheduler.h>
 #include <bc_ds28e17.h>
@@ -19,6 +20,11 @@
 #define _BC_I2C_BYTE_TRANSFER_TIME_US_100     80
 #define _BC_I2C_BYTE_TRANSFER_TIME_US_400     20
 
+// Finished transaction holds bc_i2c_status_t in its state
+#define _BC_I2C_STATE_PENDING   (-1)
+
+#define _BC_I2C_CR1_IRQ_MASK (I2C_CR1_TXIE | I2C_CR1_RXIE | I2C_CR1_TCIE | I2C_CR1_STOPIE | I2C_CR1_NACKIE | I2C_CR1_ERRIE)
+
 #define __BC_I2C_RESET_PERIPHERAL(__I2C__) {__I2C__->CR1 &= ~I2C_CR1_PE; __I2C__->CR1 |= I2C_CR1_PE; }
 
 static struct
@@ -27,28 +33,62 @@ static struct
     bc_i2c_speed_t speed;
     I2C_TypeDef *i2c;
 
+    // Queue of submitted transactions, head is the one in progress
+    bc_i2c_transaction_t *head;
+    bc_i2c_transaction_t *tail;
+
+    // Finished transactions waiting for callback
+    bc_i2c_transaction_t *done_head;
+    bc_i2c_transaction_t *done_tail;
+
+    uint8_t address[2];
+    size_t address_length;
+    size_t address_index;
+    uint8_t *pointer;
+    bool data_phase;
+    bc_tick_t deadline;
+
+    bool task_registered;
+    bc_scheduler_task_id_t task_id;
+
 } _bc_i2c[] = {
     [BC_I2C_I2C0] = { .initialized_semaphore = 0, .i2c = I2C2 },
     [BC_I2C_I2C1] = { .initialized_semaphore = 0, .i2c = I2C1 },
     [BC_I2C_I2C_1W]= { .initialized_semaphore = 0, .i2c = NULL }
 };
 
-static bc_tick_t tick_timeout;
+static struct
+{
+    struct
+    {
+        bool used;
+        bc_i2c_channel_t channel;
+        uint8_t device_address;
+        bc_i2c_profile_t profile;
+
+    } device[BC_I2C_PROFILE_DEVICE_COUNT];
+
+    void (*trace_handler)(const bc_i2c_trace_t *, void *);
+    void *trace_param;
+
+} _bc_i2c_profile;
+
 static bc_ds28e17_t ds28e17;
 
-static bool _bc_i2c_mem_write(I2C_TypeDef *i2c, uint8_t device_address, uint16_t memory_address, uint16_t memory_address_length, uint8_t *buffer, uint16_t length);
-static bool _bc_i2c_mem_read(I2C_TypeDef *i2c, uint8_t device_address, uint16_t memory_address, uint16_t memory_address_length, uint8_t *buffer, uint16_t length);
-static bool _bc_i2c_req_mem_write(I2C_TypeDef *i2c, uint8_t device_address, uint16_t memory_address, uint16_t memory_address_length);
-static bool _bc_i2c_req_mem_read(I2C_TypeDef *i2c, uint8_t device_address, uint16_t memory_address, uint16_t memory_address_length);
+static bool _bc_i2c_transaction(bc_i2c_channel_t channel, bc_i2c_transaction_type_t type, uint8_t device_address, uint32_t memory_address, void *buffer, size_t length);
+static bool _bc_i2c_enqueue(bc_i2c_channel_t channel, bc_i2c_transaction_t *transaction);
+static void _bc_i2c_start(bc_i2c_channel_t channel);
+static void _bc_i2c_finish(bc_i2c_channel_t channel, bc_i2c_status_t status);
+static void _bc_i2c_check_timeout(bc_i2c_channel_t channel);
+static void _bc_i2c_release(bc_i2c_channel_t channel);
+static void _bc_i2c_account(bc_i2c_channel_t channel, bc_i2c_transaction_t *transaction);
+static bool _bc_i2c_1w_transaction(bc_i2c_transaction_t *transaction);
+static void _bc_i2c_task(void *param);
+static void _bc_i2c_1w_handler(bc_ds28e17_t *self, bc_ds28e17_event_t event, void *param);
+static void _bc_i2c_irq_handler(bc_i2c_channel_t channel);
 static void _bc_i2c_config(I2C_TypeDef *i2c, uint8_t device_address, uint8_t length, uint32_t mode, uint32_t Request);
-static bool _bc_i2c_watch_flag(I2C_TypeDef *i2c, uint32_t flag, FlagStatus status);
-static bool _bc_i2c_is_ack_failure(I2C_TypeDef *i2c);
-static bool _bc_i2c_read(I2C_TypeDef *i2c, const void *buffer, size_t length);
-static bool _bc_i2c_write(I2C_TypeDef *i2c, const void *buffer, size_t length);
 static uint32_t bc_i2c_get_timeout_ms(bc_i2c_channel_t channel, size_t length);
 static uint32_t bc_i2c_get_timeout_us(bc_i2c_channel_t channel, size_t length);
-static void _bc_i2c_timeout_begin(uint32_t timeout_ms);
-static bool _bc_i2c_timeout_is_expired(void);
 static void _bc_i2c_restore_bus(I2C_TypeDef *i2c);
 
 void bc_i2c_init(bc_i2c_channel_t channel, bc_i2c_speed_t speed)
@@ -81,6 +121,8 @@ void bc_i2c_init(bc_i2c_channel_t channel, bc_i2c_speed_t speed)
         // Enable I2C2 peripheral
         I2C2->CR1 |= I2C_CR1_PE;
 
+        NVIC_EnableIRQ(I2C2_IRQn);
+
         bc_i2c_set_speed(channel, speed);
     }
     else if (channel == BC_I2C_I2C1)
@@ -106,6 +148,8 @@ void bc_i2c_init(bc_i2c_channel_t channel, bc_i2c_speed_t speed)
         // Enable I2C1 peripheral
         I2C1->CR1 |= I2C_CR1_PE;
 
+        NVIC_EnableIRQ(I2C1_IRQn);
+
         bc_i2c_set_speed(channel, speed);
     }
     else if (channel == BC_I2C_I2C_1W)
@@ -145,6 +189,8 @@ void bc_i2c_deinit(bc_i2c_channel_t channel)
 
     if (channel == BC_I2C_I2C0)
     {
+        NVIC_DisableIRQ(I2C2_IRQn);
+
         // Disable I2C2 peripheral
         I2C2->CR1 |= I2C_CR1_PE;
 
@@ -162,6 +208,8 @@ void bc_i2c_deinit(bc_i2c_channel_t channel)
     }
     else if (channel == BC_I2C_I2C1)
     {
+        NVIC_DisableIRQ(I2C1_IRQn);
+
         // Disable I2C1 peripheral
         I2C1->CR1 &= ~I2C_CR1_PE;
 
@@ -241,43 +289,7 @@ bool bc_i2c_write(bc_i2c_channel_t channel, const bc_i2c_transfer_t *transfer)
         return false;
     }
 
-    if (channel == BC_I2C_I2C_1W)
-    {
-        return bc_ds28e17_write(&ds28e17, transfer);
-    }
-
-    I2C_TypeDef *i2c = _bc_i2c[channel].i2c;
-
-    bc_system_pll_enable();
-
-    // Get maximum allowed timeout in ms
-    uint32_t timeout_ms = _BC_I2C_TX_TIMEOUT_ADJUST_FACTOR * bc_i2c_get_timeout_ms(channel, transfer->length);
-
-    _bc_i2c_timeout_begin(timeout_ms);
-
-    bool status = false;
-
-    // Wait until bus is not busy
-    if (_bc_i2c_watch_flag(i2c, I2C_ISR_BUSY, SET))
-    {
-        // Configure I2C peripheral and try to get ACK on device address write
-        _bc_i2c_config(i2c, transfer->device_address << 1, transfer->length, I2C_CR2_AUTOEND, _BC_I2C_GENERATE_START_WRITE);
-
-        // Try to transmit buffer and update status
-        status = _bc_i2c_write(i2c, transfer->buffer, transfer->length);
-    }
-
-    // If error occured ( timeout | NACK | ... ) ...
-    if (status == false)
-    {
-        // Reset I2C peripheral to generate STOP conditions immediately
-        __BC_I2C_RESET_PERIPHERAL(i2c);
-    }
-
-    bc_system_pll_disable();
-
-    return status;
-
+    return _bc_i2c_transaction(channel, BC_I2C_TRANSACTION_WRITE, transfer->device_address, 0, transfer->buffer, transfer->length);
 }
 
 bool bc_i2c_read(bc_i2c_channel_t channel, const bc_i2c_transfer_t *transfer)
@@ -287,116 +299,95 @@ bool bc_i2c_read(bc_i2c_channel_t channel, const bc_i2c_transfer_t *transfer)
         return false;
     }
 
-    if (channel == BC_I2C_I2C_1W)
-    {
-        return bc_ds28e17_read(&ds28e17, transfer);
-    }
-
-    I2C_TypeDef *i2c = _bc_i2c[channel].i2c;
-
-    bc_system_pll_enable();
-
-    // Get maximum allowed timeout in ms
-    uint32_t timeout_ms = _BC_I2C_RX_TIMEOUT_ADJUST_FACTOR * bc_i2c_get_timeout_ms(channel, transfer->length);
-
-    _bc_i2c_timeout_begin(timeout_ms);
-
-    bool status = false;
-
-    // Wait until bus is not busy
-    if (_bc_i2c_watch_flag(i2c, I2C_ISR_BUSY, SET))
-    {
-        // Configure I2C peripheral and try to get ACK on device address read
-        _bc_i2c_config(i2c, transfer->device_address << 1, transfer->length, I2C_CR2_AUTOEND, I2C_CR2_START | I2C_CR2_RD_WRN);
-
-        // Try to receive data to buffer and update status
-        status = _bc_i2c_read(i2c, transfer->buffer, transfer->length);
-    }
+    return _bc_i2c_transaction(channel, BC_I2C_TRANSACTION_READ, transfer->device_address, 0, transfer->buffer, transfer->length);
+}
 
-    // If error occured ( timeout | NACK | ... ) ...
-    if (status == false)
+bool bc_i2c_memory_write(bc_i2c_channel_t channel, const bc_i2c_memory_transfer_t *transfer)
+{
+    if (_bc_i2c[channel].initialized_semaphore == 0)
     {
-        _bc_i2c_restore_bus(i2c);
+        return false;
     }
 
-    bc_system_pll_disable();
-
-    return status;
+    return _bc_i2c_transaction(channel, BC_I2C_TRANSACTION_MEMORY_WRITE, transfer->device_address, transfer->memory_address, transfer->buffer, transfer->length);
 }
 
-bool bc_i2c_memory_write(bc_i2c_channel_t channel, const bc_i2c_memory_transfer_t *transfer)
+bool bc_i2c_memory_read(bc_i2c_channel_t channel, const bc_i2c_memory_transfer_t *transfer)
 {
     if (_bc_i2c[channel].initialized_semaphore == 0)
     {
         return false;
     }
 
-    if (channel == BC_I2C_I2C_1W)
+    return _bc_i2c_transaction(channel, BC_I2C_TRANSACTION_MEMORY_READ, transfer->device_address, transfer->memory_address, transfer->buffer, transfer->length);
+}
+
+bool bc_i2c_submit(bc_i2c_channel_t channel, bc_i2c_transaction_t *transaction, void (*callback)(bc_i2c_transaction_t *, bc_i2c_event_t, void *), void *param)
+{
+    if (callback == NULL)
     {
-        return bc_ds28e17_memory_write(&ds28e17, transfer);
+        return false;
     }
 
-    I2C_TypeDef *i2c = _bc_i2c[channel].i2c;
-
-    // Enable PLL and disable sleep
-    bc_system_pll_enable();
-
-    uint16_t transfer_memory_address_length =
-            (transfer->memory_address & BC_I2C_MEMORY_ADDRESS_16_BIT) != 0 ? _BC_I2C_MEMORY_ADDRESS_SIZE_16BIT : _BC_I2C_MEMORY_ADDRESS_SIZE_8BIT;
-
-    // If memory write failed ...
-    if (!_bc_i2c_mem_write(i2c, transfer->device_address << 1, transfer->memory_address, transfer_memory_address_length, transfer->buffer, transfer->length))
+    if (!_bc_i2c[channel].task_registered)
     {
-        // Reset I2C peripheral to generate STOP conditions immediately
-        __BC_I2C_RESET_PERIPHERAL(i2c);
-
-        // Disable PLL and enable sleep
-        bc_system_pll_disable();
+        _bc_i2c[channel].task_id = bc_scheduler_register(_bc_i2c_task, (void *) channel, BC_TICK_INFINITY);
 
-        return false;
+        _bc_i2c[channel].task_registered = true;
     }
 
-    // Disable PLL and enable sleep
-    bc_system_pll_disable();
+    transaction->_callback = callback;
+    transaction->_param = param;
 
-    return true;
+    return _bc_i2c_enqueue(channel, transaction);
 }
 
-bool bc_i2c_memory_read(bc_i2c_channel_t channel, const bc_i2c_memory_transfer_t *transfer)
+bool bc_i2c_get_profile(bc_i2c_channel_t channel, uint8_t device_address, bc_i2c_profile_t *profile)
 {
-    if (_bc_i2c[channel].initialized_semaphore == 0)
+    for (int i = 0; i < BC_I2C_PROFILE_DEVICE_COUNT; i++)
     {
-        return false;
-    }
+        if (_bc_i2c_profile.device[i].used && _bc_i2c_profile.device[i].channel == channel && _bc_i2c_profile.device[i].device_address == device_address)
+        {
+            *profile = _bc_i2c_profile.device[i].profile;
 
-    if (channel == BC_I2C_I2C_1W)
-    {
-        return bc_ds28e17_memory_read(&ds28e17, transfer);
+            return true;
+        }
     }
 
-    I2C_TypeDef *i2c = _bc_i2c[channel].i2c;
+    return false;
+}
 
-    // Enable PLL and disable sleep
-    bc_system_pll_enable();
+void bc_i2c_reset_profile(void)
+{
+    memset(_bc_i2c_profile.device, 0, sizeof(_bc_i2c_profile.device));
+}
 
-    uint16_t transfer_memory_address_length =
-            (transfer->memory_address & BC_I2C_MEMORY_ADDRESS_16_BIT) != 0 ? _BC_I2C_MEMORY_ADDRESS_SIZE_16BIT : _BC_I2C_MEMORY_ADDRESS_SIZE_8BIT;
+void bc_i2c_set_trace_handler(void (*trace_handler)(const bc_i2c_trace_t *, void *), void *trace_param)
+{
+    _bc_i2c_profile.trace_handler = trace_handler;
+    _bc_i2c_profile.trace_param = trace_param;
+}
 
-    // If error occurs during memory read ...
-    if (!_bc_i2c_mem_read(i2c, transfer->device_address << 1, transfer->memory_address, transfer_memory_address_length, transfer->buffer, transfer->length))
-    {
-        _bc_i2c_restore_bus(i2c);
+size_t bc_i2c_trace_format(const bc_i2c_trace_t *trace, char *buffer, size_t size)
+{
+    static const char *type[] = { "W", "R", "MW", "MR" };
+    static const char *status[] = { "OK", "NACK", "ERR", "TIMEOUT" };
 
-        // Disable PLL and enable sleep
-        bc_system_pll_disable();
+    int length = snprintf(buffer, size, "i2c %d %s %02x %08" PRIx32 " %u %s %" PRIu32 " ", (int) trace->channel, type[trace->type],
+            trace->device_address, trace->memory_address, (unsigned) trace->length, status[trace->status], trace->bus_time_us);
 
-        return false;
+    if (length < 0 || (size_t) length >= size)
+    {
+        return size > 0 ? size - 1 : 0;
     }
 
-    // Disable PLL and enable sleep
-    bc_system_pll_disable();
+    // Data are appended only when they have been transferred
+    for (size_t i = 0; trace->status == BC_I2C_STATUS_OK && i < trace->length && (size_t) length + 2 < size; i++)
+    {
+        length += snprintf(buffer + length, size - length, "%02x", ((const uint8_t *) trace->buffer)[i]);
+    }
 
-    return true;
+    return length;
 }
 
 bool bc_i2c_memory_write_8b(bc_i2c_channel_t channel, uint8_t device_address, uint32_t memory_address, uint8_t data)
@@ -461,307 +452,571 @@ bool bc_i2c_memory_read_16b(bc_i2c_channel_t channel, uint8_t device_address, ui
     return true;
 }
 
-static bool _bc_i2c_mem_write(I2C_TypeDef *i2c, uint8_t device_address, uint16_t memory_address, uint16_t memory_address_length, uint8_t *buffer, uint16_t length)
+
+void I2C1_IRQHandler(void)
 {
-    // Get maximum allowed timeout in ms
-    uint32_t timeout_ms = _BC_I2C_TX_TIMEOUT_ADJUST_FACTOR * bc_i2c_get_timeout_ms(i2c == I2C2 ? BC_I2C_I2C0 : BC_I2C_I2C1, length);
+    _bc_i2c_irq_handler(BC_I2C_I2C1);
+}
 
-    _bc_i2c_timeout_begin(timeout_ms);
+void I2C2_IRQHandler(void)
+{
+    _bc_i2c_irq_handler(BC_I2C_I2C0);
+}
 
-    // Wait until bus is not busy
-    if (!_bc_i2c_watch_flag(i2c, I2C_ISR_BUSY, SET))
-    {
-        return false;
-    }
+static bool _bc_i2c_transaction(bc_i2c_channel_t channel, bc_i2c_transaction_type_t type, uint8_t device_address, uint32_t memory_address, void *buffer, size_t length)
+{
+    bc_i2c_transaction_t transaction;
+
+    transaction.type = type;
+    transaction.device_address = device_address;
+    transaction.memory_address = memory_address;
+    transaction.buffer = buffer;
+    transaction.length = length;
+    transaction._callback = NULL;
+    transaction._param = NULL;
 
-    // Send slave address and memory address
-    if (!_bc_i2c_req_mem_write(i2c, device_address, memory_address, memory_address_length))
+    if (channel == BC_I2C_I2C_1W)
     {
-        return false;
-    }
+        if (_bc_i2c[channel].initialized_semaphore == 0)
+        {
+            return false;
+        }
 
-    // Set size of data to write
-    _bc_i2c_config(i2c, device_address, length, _BC_I2C_AUTOEND_MODE, _BC_I2C_NO_STARTSTOP);
+        // Submitted transactions are driven by scheduler tasks, which can't run while caller waits here,
+        // and bridge commands must not be interleaved, so synchronous transfer is refused until queue is empty
+        bc_irq_disable();
 
-    // Perform I2C transfer
-    return _bc_i2c_write(i2c, buffer, length);
-}
+        bool queued = _bc_i2c[channel].head != NULL;
 
-static bool _bc_i2c_mem_read(I2C_TypeDef *i2c, uint8_t device_address, uint16_t memory_address, uint16_t memory_address_length, uint8_t *buffer, uint16_t length)
-{
-    // Get maximum allowed timeout in ms
-    uint32_t timeout_ms = _BC_I2C_RX_TIMEOUT_ADJUST_FACTOR * bc_i2c_get_timeout_ms(i2c == I2C2 ? BC_I2C_I2C0 : BC_I2C_I2C1, length);
+        bc_irq_enable();
 
-    _bc_i2c_timeout_begin(timeout_ms);
+        if (queued)
+        {
+            return false;
+        }
+
+        transaction._state = _bc_i2c_1w_transaction(&transaction) ? BC_I2C_STATUS_OK : BC_I2C_STATUS_BUS_ERROR;
+        transaction._bytes = transaction._state == BC_I2C_STATUS_OK ? transaction.length + 1 : 1;
+        transaction._starts = 1;
+
+        _bc_i2c_account(channel, &transaction);
+
+        return transaction._state == BC_I2C_STATUS_OK;
+    }
 
-    // Wait until bus is not busy
-    if (!_bc_i2c_watch_flag(i2c, I2C_ISR_BUSY, SET))
+    if (!_bc_i2c_enqueue(channel, &transaction))
     {
         return false;
     }
 
-    // Send slave address and memory address
-    if (!_bc_i2c_req_mem_read(i2c, device_address, memory_address, memory_address_length))
+    for (;;)
     {
-        return false;
+        _bc_i2c_check_timeout(channel);
+
+        // Interrupts are masked between the check and WFI, so no wake-up is lost
+        __disable_irq();
+
+        if (transaction._state != _BC_I2C_STATE_PENDING)
+        {
+            __enable_irq();
+
+            break;
+        }
+
+        // Deep sleep is disabled during transaction, peripheral keeps running
+        __WFI();
+
+        __enable_irq();
     }
 
-    // Set size of data to read
-    _bc_i2c_config(i2c, device_address, length, I2C_CR2_AUTOEND, I2C_CR2_START | I2C_CR2_RD_WRN);
+    _bc_i2c_release(channel);
 
-    // Perform I2C transfer
-    return _bc_i2c_read(i2c, buffer, length);
+    _bc_i2c_account(channel, &transaction);
+
+    return transaction._state == BC_I2C_STATUS_OK;
 }
 
-static bool _bc_i2c_req_mem_write(I2C_TypeDef *i2c, uint8_t device_address, uint16_t memory_address, uint16_t memory_address_length)
+static bool _bc_i2c_enqueue(bc_i2c_channel_t channel, bc_i2c_transaction_t *transaction)
 {
-    _bc_i2c_config(i2c, device_address, memory_address_length, _BC_I2C_RELOAD_MODE, _BC_I2C_GENERATE_START_WRITE);
-
-    // Wait until TXIS flag is set
-    if (!_bc_i2c_watch_flag(i2c, I2C_ISR_TXIS, RESET))
+    if (_bc_i2c[channel].initialized_semaphore == 0)
     {
         return false;
     }
 
-    // If memory address size is 16Bit
-    if (memory_address_length == _BC_I2C_MEMORY_ADDRESS_SIZE_16BIT)
+    if (transaction->type == BC_I2C_TRANSACTION_WRITE || transaction->type == BC_I2C_TRANSACTION_MEMORY_WRITE)
     {
-        // Send MSB of memory address
-        i2c->TXDR = (memory_address >> 8) & 0xff;
+        transaction->_timeout = _BC_I2C_TX_TIMEOUT_ADJUST_FACTOR * bc_i2c_get_timeout_ms(channel, transaction->length);
+    }
+    else
+    {
+        transaction->_timeout = _BC_I2C_RX_TIMEOUT_ADJUST_FACTOR * bc_i2c_get_timeout_ms(channel, transaction->length);
+    }
 
-        // Wait until TXIS flag is set
-        if (!_bc_i2c_watch_flag(i2c, I2C_ISR_TXIS, RESET))
-        {
-            return false;
-        }
+    transaction->_next = NULL;
+    transaction->_state = _BC_I2C_STATE_PENDING;
+
+    if (channel != BC_I2C_I2C_1W)
+    {
+        // Peripheral timing is derived from PLL clock, stop mode would halt the transfer.
+        // PLL keeps HSI16 on, which disables sleep of scheduler, but core can sleep in sleep mode until interrupt.
+        bc_system_pll_enable();
+        bc_system_deep_sleep_disable();
+        bc_scheduler_enable_sleep();
     }
 
-    // Send LSB of memory address
-    i2c->TXDR = memory_address & 0xff;
+    bc_irq_disable();
 
-    // Wait until TCR flag is set
-    if (!_bc_i2c_watch_flag(i2c, I2C_ISR_TCR, RESET))
+    if (_bc_i2c[channel].head == NULL)
     {
-        return false;
+        _bc_i2c[channel].head = transaction;
+        _bc_i2c[channel].tail = transaction;
+
+        _bc_i2c_start(channel);
+    }
+    else
+    {
+        _bc_i2c[channel].tail->_next = transaction;
+        _bc_i2c[channel].tail = transaction;
     }
 
+    bc_irq_enable();
+
     return true;
 }
 
-static bool _bc_i2c_req_mem_read(I2C_TypeDef *i2c, uint8_t device_address, uint16_t memory_address, uint16_t memory_address_length)
+static void _bc_i2c_start(bc_i2c_channel_t channel)
 {
-    _bc_i2c_config(i2c, device_address, memory_address_length, _BC_I2C_SOFTEND_MODE, _BC_I2C_GENERATE_START_WRITE);
+    bc_i2c_transaction_t *transaction = _bc_i2c[channel].head;
 
-    // Wait until TXIS flag is set
-    if (!_bc_i2c_watch_flag(i2c, I2C_ISR_TXIS, RESET))
-    {
-        return false;
-    }
+    _bc_i2c[channel].deadline = bc_tick_get() + transaction->_timeout;
+    _bc_i2c[channel].pointer = transaction->buffer;
+    _bc_i2c[channel].address_index = 0;
+    _bc_i2c[channel].data_phase = false;
 
-    // If memory address size is 16Bit
-    if (memory_address_length == _BC_I2C_MEMORY_ADDRESS_SIZE_16BIT)
+    if (channel == BC_I2C_I2C_1W)
     {
-        // Send MSB of memory address
-        i2c->TXDR = (memory_address >> 8) & 0xff;
+        bool started = false;
 
-        // Wait until TXIS flag is set
-        if (!_bc_i2c_watch_flag(i2c, I2C_ISR_TXIS, RESET))
+        if (transaction->type == BC_I2C_TRANSACTION_WRITE || transaction->type == BC_I2C_TRANSACTION_READ)
         {
-            return false;
+            bc_i2c_transfer_t transfer = { transaction->device_address, transaction->buffer, transaction->length };
+
+            if (transaction->type == BC_I2C_TRANSACTION_WRITE)
+            {
+                started = bc_ds28e17_async_write(&ds28e17, &transfer, _bc_i2c_1w_handler, NULL);
+            }
+            else
+            {
+                started = bc_ds28e17_async_read(&ds28e17, &transfer, _bc_i2c_1w_handler, NULL);
+            }
         }
+        else
+        {
+            bc_i2c_memory_transfer_t transfer = { transaction->device_address, transaction->memory_address, transaction->buffer, transaction->length };
+
+            if (transaction->type == BC_I2C_TRANSACTION_MEMORY_WRITE)
+            {
+                started = bc_ds28e17_async_memory_write(&ds28e17, &transfer, _bc_i2c_1w_handler, NULL);
+            }
+            else
+            {
+                started = bc_ds28e17_async_memory_read(&ds28e17, &transfer, _bc_i2c_1w_handler, NULL);
+            }
+        }
+
+        if (!started)
+        {
+            _bc_i2c_finish(channel, BC_I2C_STATUS_BUS_ERROR);
+        }
+
+        return;
     }
 
-    // Send LSB of memory address
-    i2c->TXDR = memory_address & 0xff;
+    I2C_TypeDef *i2c = _bc_i2c[channel].i2c;
+
+    i2c->ICR = I2C_ICR_NACKCF | I2C_ICR_STOPCF | I2C_ICR_BERRCF | I2C_ICR_ARLOCF | I2C_ICR_OVRCF;
+
+    i2c->CR1 |= _BC_I2C_CR1_IRQ_MASK;
 
-    // Wait until TC flag is set
-    if (!_bc_i2c_watch_flag(i2c, I2C_ISR_TC, RESET))
+    if (transaction->type == BC_I2C_TRANSACTION_WRITE)
     {
-        return false;
+        _bc_i2c[channel].data_phase = true;
+
+        _bc_i2c_config(i2c, transaction->device_address << 1, transaction->length, _BC_I2C_AUTOEND_MODE, _BC_I2C_GENERATE_START_WRITE);
     }
+    else if (transaction->type == BC_I2C_TRANSACTION_READ)
+    {
+        _bc_i2c[channel].data_phase = true;
 
-    return true;
+        _bc_i2c_config(i2c, transaction->device_address << 1, transaction->length, _BC_I2C_AUTOEND_MODE, I2C_CR2_START | I2C_CR2_RD_WRN);
+    }
+    else
+    {
+        if ((transaction->memory_address & BC_I2C_MEMORY_ADDRESS_16_BIT) != 0)
+        {
+            _bc_i2c[channel].address[0] = (transaction->memory_address >> 8) & 0xff;
+            _bc_i2c[channel].address[1] = transaction->memory_address & 0xff;
+            _bc_i2c[channel].address_length = _BC_I2C_MEMORY_ADDRESS_SIZE_16BIT;
+        }
+        else
+        {
+            _bc_i2c[channel].address[0] = transaction->memory_address & 0xff;
+            _bc_i2c[channel].address_length = _BC_I2C_MEMORY_ADDRESS_SIZE_8BIT;
+        }
+
+        // Memory write continues by data after reload, memory read by repeated start
+        uint32_t mode = transaction->type == BC_I2C_TRANSACTION_MEMORY_WRITE ? _BC_I2C_RELOAD_MODE : _BC_I2C_SOFTEND_MODE;
+
+        _bc_i2c_config(i2c, transaction->device_address << 1, _bc_i2c[channel].address_length, mode, _BC_I2C_GENERATE_START_WRITE);
+    }
+
+    if (_bc_i2c[channel].task_registered && _bc_i2c[channel].done_head == NULL)
+    {
+        bc_scheduler_plan_absolute(_bc_i2c[channel].task_id, _bc_i2c[channel].deadline + 1);
+    }
 }
 
-static void _bc_i2c_config(I2C_TypeDef *i2c, uint8_t device_address, uint8_t length, uint32_t mode, uint32_t Request)
+static void _bc_i2c_finish(bc_i2c_channel_t channel, bc_i2c_status_t status)
 {
-    uint32_t reg;
+    bc_i2c_transaction_t *transaction = _bc_i2c[channel].head;
 
-    // Get the CR2 register value
-    reg = i2c->CR2;
+    if (channel == BC_I2C_I2C_1W)
+    {
+        // Bridge doesn't tell how far it got
+        transaction->_bytes = status == BC_I2C_STATUS_OK ? transaction->length + 1 : 1;
+        transaction->_starts = 1;
+    }
+    else
+    {
+        I2C_TypeDef *i2c = _bc_i2c[channel].i2c;
 
-    // clear tmpreg specific bits
-    reg &= ~(I2C_CR2_SADD | I2C_CR2_NBYTES | I2C_CR2_RELOAD | I2C_CR2_AUTOEND | I2C_CR2_RD_WRN | I2C_CR2_START | I2C_CR2_STOP);
+        i2c->CR1 &= ~_BC_I2C_CR1_IRQ_MASK;
 
-    // update tmpreg
-    reg |= (device_address & I2C_CR2_SADD) | (length << I2C_CR2_NBYTES_Pos) | mode | Request;
+        // Count bytes which have been clocked out for profile
+        transaction->_bytes = 1 + _bc_i2c[channel].address_index;
+        transaction->_starts = 1;
 
-    // update CR2 register
-    i2c->CR2 = reg;
-}
+        if (_bc_i2c[channel].data_phase)
+        {
+            transaction->_bytes += _bc_i2c[channel].pointer - (uint8_t *) transaction->buffer;
 
-static bool _bc_i2c_watch_flag(I2C_TypeDef *i2c, uint32_t flag, FlagStatus status)
-{
-    while ((i2c->ISR & flag) == status)
-    {
-        if ((flag == I2C_ISR_STOPF) || (flag == I2C_ISR_TXIS))
+            if (transaction->type == BC_I2C_TRANSACTION_MEMORY_READ)
+            {
+                transaction->_bytes++;
+                transaction->_starts++;
+            }
+        }
+
+        if (status != BC_I2C_STATUS_OK)
         {
-            // Check if a NACK is not detected ...
-            if (!_bc_i2c_is_ack_failure(i2c))
+            if (transaction->type == BC_I2C_TRANSACTION_READ || transaction->type == BC_I2C_TRANSACTION_MEMORY_READ)
             {
-                return false;
+                _bc_i2c_restore_bus(i2c);
+            }
+            else
+            {
+                // Reset I2C peripheral to generate STOP conditions immediately
+                __BC_I2C_RESET_PERIPHERAL(i2c);
             }
         }
 
-        if (_bc_i2c_timeout_is_expired())
+        // Clear Configuration Register 2
+        i2c->CR2 &= ~(I2C_CR2_SADD | I2C_CR2_HEAD10R | I2C_CR2_NBYTES | I2C_CR2_RELOAD | I2C_CR2_RD_WRN);
+    }
+
+    _bc_i2c[channel].head = transaction->_next;
+
+    if (_bc_i2c[channel].head == NULL)
+    {
+        _bc_i2c[channel].tail = NULL;
+    }
+
+    transaction->_next = NULL;
+    transaction->_state = status;
+
+    // Synchronous caller is waiting for the state, others get callback from task
+    if (transaction->_callback != NULL)
+    {
+        if (_bc_i2c[channel].done_head == NULL)
         {
-            return false;
+            _bc_i2c[channel].done_head = transaction;
         }
+        else
+        {
+            _bc_i2c[channel].done_tail->_next = transaction;
+        }
+
+        _bc_i2c[channel].done_tail = transaction;
+    }
+
+    if (_bc_i2c[channel].head != NULL)
+    {
+        _bc_i2c_start(channel);
+    }
+
+    if (_bc_i2c[channel].done_head != NULL)
+    {
+        bc_scheduler_plan_now(_bc_i2c[channel].task_id);
     }
-    return true;
 }
 
-static bool _bc_i2c_is_ack_failure(I2C_TypeDef *i2c)
+static void _bc_i2c_check_timeout(bc_i2c_channel_t channel)
 {
-    if ((i2c->ISR & I2C_ISR_NACKF) != 0)
+    // 1-Wire bridge has its own timeout
+    if (channel == BC_I2C_I2C_1W)
     {
-        // Wait until STOP flag is reset
-        // AutoEnd should be initialized after AF
-        while ((i2c->ISR & I2C_ISR_STOPF) == 0)
+        return;
+    }
+
+    bc_irq_disable();
+
+    if (_bc_i2c[channel].head != NULL && _bc_i2c[channel].deadline < bc_tick_get())
+    {
+        _bc_i2c_finish(channel, BC_I2C_STATUS_TIMEOUT);
+    }
+
+    bc_irq_enable();
+}
+
+static void _bc_i2c_release(bc_i2c_channel_t channel)
+{
+    if (channel != BC_I2C_I2C_1W)
+    {
+        // Offset made in _bc_i2c_enqueue is taken back before PLL can release HSI16 and its sleep bypass
+        bc_scheduler_disable_sleep();
+        bc_system_deep_sleep_enable();
+        bc_system_pll_disable();
+    }
+}
+
+static void _bc_i2c_account(bc_i2c_channel_t channel, bc_i2c_transaction_t *transaction)
+{
+    bc_i2c_trace_t trace;
+
+    trace.channel = channel;
+    trace.type = transaction->type;
+    trace.device_address = transaction->device_address;
+    trace.memory_address = transaction->memory_address;
+    trace.buffer = transaction->buffer;
+    trace.length = transaction->length;
+    trace.status = transaction->_state;
+    trace.bus_time_us = bc_i2c_get_bus_time_us(_bc_i2c[channel].speed, transaction->_bytes, transaction->_starts);
+
+    for (int i = 0; i < BC_I2C_PROFILE_DEVICE_COUNT; i++)
+    {
+        if (!_bc_i2c_profile.device[i].used)
         {
-            if (_bc_i2c_timeout_is_expired())
-            {
-                return false;
-            }
+            _bc_i2c_profile.device[i].used = true;
+            _bc_i2c_profile.device[i].channel = channel;
+            _bc_i2c_profile.device[i].device_address = transaction->device_address;
+        }
+        else if (_bc_i2c_profile.device[i].channel != channel || _bc_i2c_profile.device[i].device_address != transaction->device_address)
+        {
+            continue;
         }
 
-        // Clear NACKF flag
-        i2c->ICR = I2C_ISR_NACKF;
+        bc_i2c_profile_t *profile = &_bc_i2c_profile.device[i].profile;
 
-        // Clear STOP flag
-        i2c->ICR = I2C_ISR_STOPF;
+        profile->transactions++;
+        profile->bus_time_us += trace.bus_time_us;
 
-        // If a pending TXIS flag is set ...
-        if ((i2c->ISR & I2C_ISR_TXIS) != 0)
+        if (trace.status == BC_I2C_STATUS_OK)
         {
-            // ... write a dummy data in TXDR to clear it
-            i2c->TXDR = 0;
+            profile->bytes += trace.length;
         }
-
-        // Flush TX register if not empty
-        if ((i2c->ISR & I2C_ISR_TXE) == 0)
+        else if (trace.status == BC_I2C_STATUS_NACK)
+        {
+            profile->nacks++;
+        }
+        else
         {
-            i2c->ISR |= I2C_ISR_TXE;
+            profile->errors++;
         }
 
-        // Clear Configuration Register 2
-        i2c->CR2 &= ~(I2C_CR2_SADD | I2C_CR2_HEAD10R | I2C_CR2_NBYTES | I2C_CR2_RELOAD | I2C_CR2_RD_WRN);
+        // Failed read is followed by bus recovery
+        if (trace.status != BC_I2C_STATUS_OK && channel != BC_I2C_I2C_1W &&
+                (trace.type == BC_I2C_TRANSACTION_READ || trace.type == BC_I2C_TRANSACTION_MEMORY_READ))
+        {
+            profile->recoveries++;
+        }
 
-        return false;
+        break;
     }
 
-    return true;
+    if (_bc_i2c_profile.trace_handler != NULL)
+    {
+        _bc_i2c_profile.trace_handler(&trace, _bc_i2c_profile.trace_param);
+    }
 }
 
-static bool _bc_i2c_read(I2C_TypeDef *i2c, const void *buffer, size_t length)
+static bool _bc_i2c_1w_transaction(bc_i2c_transaction_t *transaction)
 {
-    uint8_t *p = (uint8_t *) buffer;
-
-    while (length > 0)
+    if (transaction->type == BC_I2C_TRANSACTION_WRITE || transaction->type == BC_I2C_TRANSACTION_READ)
     {
-        // Wait until RXNE flag is set
-        if (!_bc_i2c_watch_flag(i2c, I2C_ISR_RXNE, RESET))
+        bc_i2c_transfer_t transfer = { transaction->device_address, transaction->buffer, transaction->length };
+
+        if (transaction->type == BC_I2C_TRANSACTION_WRITE)
         {
-            return false;
+            return bc_ds28e17_write(&ds28e17, &transfer);
         }
 
-        // Read data from RXDR
-        *p++ = i2c->RXDR;
-
-        length--;
+        return bc_ds28e17_read(&ds28e17, &transfer);
     }
 
-    // No need to Check TC flag, with AUTOEND mode the stop is automatically generated
+    bc_i2c_memory_transfer_t transfer = { transaction->device_address, transaction->memory_address, transaction->buffer, transaction->length };
 
-    // Wait until STOPF flag is reset
-    if (!_bc_i2c_watch_flag(i2c, I2C_ISR_STOPF, RESET))
+    if (transaction->type == BC_I2C_TRANSACTION_MEMORY_WRITE)
     {
-        return false;
+        return bc_ds28e17_memory_write(&ds28e17, &transfer);
     }
 
-    // Clear STOP flag
-    i2c->ICR = I2C_ICR_STOPCF;
+    return bc_ds28e17_memory_read(&ds28e17, &transfer);
+}
 
-    // Clear Configuration Register 2
-    i2c->CR2 &= ~(I2C_CR2_SADD | I2C_CR2_HEAD10R | I2C_CR2_NBYTES | I2C_CR2_RELOAD | I2C_CR2_RD_WRN);
+static void _bc_i2c_task(void *param)
+{
+    bc_i2c_channel_t channel = (bc_i2c_channel_t) param;
 
-    return true;
+    _bc_i2c_check_timeout(channel);
+
+    for (;;)
+    {
+        bc_irq_disable();
+
+        bc_i2c_transaction_t *transaction = _bc_i2c[channel].done_head;
+
+        if (transaction == NULL)
+        {
+            if (_bc_i2c[channel].head != NULL && channel != BC_I2C_I2C_1W)
+            {
+                bc_scheduler_plan_current_absolute(_bc_i2c[channel].deadline + 1);
+            }
+
+            bc_irq_enable();
+
+            return;
+        }
+
+        _bc_i2c[channel].done_head = transaction->_next;
+
+        if (_bc_i2c[channel].done_head == NULL)
+        {
+            _bc_i2c[channel].done_tail = NULL;
+        }
+
+        transaction->_next = NULL;
+
+        bc_irq_enable();
+
+        _bc_i2c_release(channel);
+
+        _bc_i2c_account(channel, transaction);
+
+        bc_i2c_event_t event = transaction->_state == BC_I2C_STATUS_OK ? BC_I2C_EVENT_DONE : BC_I2C_EVENT_ERROR;
+
+        transaction->_callback(transaction, event, transaction->_param);
+    }
 }
 
-static uint32_t bc_i2c_get_timeout_ms(bc_i2c_channel_t channel, size_t length)
+static void _bc_i2c_1w_handler(bc_ds28e17_t *self, bc_ds28e17_event_t event, void *param)
 {
-    uint32_t timeout_us = bc_i2c_get_timeout_us(channel, length);
+    (void) self;
+    (void) param;
 
-    return (timeout_us / 1000) + 10;
+    _bc_i2c_finish(BC_I2C_I2C_1W, event == BC_DS28E17_EVENT_DONE ? BC_I2C_STATUS_OK : BC_I2C_STATUS_BUS_ERROR);
 }
 
-static uint32_t bc_i2c_get_timeout_us(bc_i2c_channel_t channel, size_t length)
+static void _bc_i2c_irq_handler(bc_i2c_channel_t channel)
 {
-    if (bc_i2c_get_speed(channel) == BC_I2C_SPEED_100_KHZ)
+    I2C_TypeDef *i2c = _bc_i2c[channel].i2c;
+    bc_i2c_transaction_t *transaction = _bc_i2c[channel].head;
+    uint32_t isr = i2c->ISR;
+
+    if (transaction == NULL)
     {
-        return _BC_I2C_BYTE_TRANSFER_TIME_US_100 * (length + 3);
+        i2c->CR1 &= ~_BC_I2C_CR1_IRQ_MASK;
+
+        return;
     }
-    else
+
+    if ((isr & (I2C_ISR_NACKF | I2C_ISR_BERR | I2C_ISR_ARLO | I2C_ISR_OVR)) != 0)
     {
-        return _BC_I2C_BYTE_TRANSFER_TIME_US_400 * (length + 3);
+        i2c->ICR = I2C_ICR_NACKCF | I2C_ICR_BERRCF | I2C_ICR_ARLOCF | I2C_ICR_OVRCF;
+
+        _bc_i2c_finish(channel, (isr & I2C_ISR_NACKF) != 0 ? BC_I2C_STATUS_NACK : BC_I2C_STATUS_BUS_ERROR);
     }
-}
+    else if ((isr & I2C_ISR_TCR) != 0)
+    {
+        // Memory address has been sent, data follow without restart
+        _bc_i2c[channel].data_phase = true;
 
-static bool _bc_i2c_write(I2C_TypeDef *i2c, const void *buffer, size_t length)
-{
-    uint8_t *p = (uint8_t *) buffer;
+        _bc_i2c_config(i2c, transaction->device_address << 1, transaction->length, _BC_I2C_AUTOEND_MODE, _BC_I2C_NO_STARTSTOP);
+    }
+    else if ((isr & I2C_ISR_TC) != 0)
+    {
+        // Memory address has been sent, data are read after repeated start
+        _bc_i2c[channel].data_phase = true;
 
-    while (length > 0)
+        _bc_i2c_config(i2c, transaction->device_address << 1, transaction->length, _BC_I2C_AUTOEND_MODE, I2C_CR2_START | I2C_CR2_RD_WRN);
+    }
+    else if ((isr & I2C_ISR_TXIS) != 0)
     {
-        // Wait until TXIS flag is set
-        if (!_bc_i2c_watch_flag(i2c, I2C_ISR_TXIS, RESET))
+        if (_bc_i2c[channel].data_phase)
         {
-            return false;
+            i2c->TXDR = *_bc_i2c[channel].pointer++;
         }
+        else
+        {
+            i2c->TXDR = _bc_i2c[channel].address[_bc_i2c[channel].address_index++];
+        }
+    }
+    else if ((isr & I2C_ISR_RXNE) != 0)
+    {
+        *_bc_i2c[channel].pointer++ = i2c->RXDR;
+    }
+    else if ((isr & I2C_ISR_STOPF) != 0)
+    {
+        // Clear STOP flag
+        i2c->ICR = I2C_ICR_STOPCF;
 
-        // Write data to TXDR
-        i2c->TXDR = *p++;
-
-        length--;
+        _bc_i2c_finish(channel, BC_I2C_STATUS_OK);
     }
+}
 
-    // No need to Check TC flag, with AUTOEND mode the stop is automatically generated
+static void _bc_i2c_config(I2C_TypeDef *i2c, uint8_t device_address, uint8_t length, uint32_t mode, uint32_t Request)
+{
+    uint32_t reg;
 
-    // Wait until STOPF flag is reset
-    if (!_bc_i2c_watch_flag(i2c, I2C_ISR_STOPF, RESET))
-    {
-        return false;
-    }
+    // Get the CR2 register value
+    reg = i2c->CR2;
 
-    // Clear STOP flag
-    i2c->ICR = I2C_ICR_STOPCF;
+    // clear tmpreg specific bits
+    reg &= ~(I2C_CR2_SADD | I2C_CR2_NBYTES | I2C_CR2_RELOAD | I2C_CR2_AUTOEND | I2C_CR2_RD_WRN | I2C_CR2_START | I2C_CR2_STOP);
 
-    // Clear Configuration Register 2
-    i2c->CR2 &= ~(I2C_CR2_SADD | I2C_CR2_HEAD10R | I2C_CR2_NBYTES | I2C_CR2_RELOAD | I2C_CR2_RD_WRN);
+    // update tmpreg
+    reg |= (device_address & I2C_CR2_SADD) | (length << I2C_CR2_NBYTES_Pos) | mode | Request;
 
-    return true;
+    // update CR2 register
+    i2c->CR2 = reg;
 }
 
-void _bc_i2c_timeout_begin(uint32_t timeout_ms)
+static uint32_t bc_i2c_get_timeout_ms(bc_i2c_channel_t channel, size_t length)
 {
-    tick_timeout = bc_tick_get() + timeout_ms;
+    uint32_t timeout_us = bc_i2c_get_timeout_us(channel, length);
+
+    return (timeout_us / 1000) + 10;
 }
 
-bool _bc_i2c_timeout_is_expired(void)
+static uint32_t bc_i2c_get_timeout_us(bc_i2c_channel_t channel, size_t length)
 {
-    bool is_expired = tick_timeout < bc_tick_get() ? true : false;
-
-    return is_expired;
+    if (bc_i2c_get_speed(channel) == BC_I2C_SPEED_100_KHZ)
+    {
+        return _BC_I2C_BYTE_TRANSFER_TIME_US_100 * (length + 3);
+    }
+    else
+    {
+        return _BC_I2C_BYTE_TRANSFER_TIME_US_400 * (length + 3);
+    }
 }
 
 static void _bc_i2c_restore_bus(I2C_TypeDef *i2c)
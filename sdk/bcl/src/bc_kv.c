@@ -0,0 +1,575 @@
+#include <bc_kv.h>
+#include <bc_eeprom.h>
+#include <bc_scheduler.h>
+#include <bc_crc.h>
+
+// Sector header: signature (4 B), generation (2 B), CRC of signature and generation (2 B)
+// Record: key (1 B), length (1 B, 0 is deletion), CRC of generation, key, length and value (2 B), value padded to 4 B
+// Every write is followed by end word (0xffffffff), so records left behind by an aborted compaction are never scanned
+
+#define _BC_KV_SIGNATURE 0x3176624bUL
+#define _BC_KV_HEADER_SIZE 8
+#define _BC_KV_RECORD_HEADER_SIZE 4
+#define _BC_KV_RECORD_SIZE(length) (_BC_KV_RECORD_HEADER_SIZE + (((length) + 3) & ~3U))
+#define _BC_KV_END_SIZE 4
+#define _BC_KV_RETRY_INTERVAL 100
+
+static struct
+{
+    bool initialized;
+    uint32_t address;
+    size_t sector_size;
+
+    int sector;
+    uint16_t generation;
+    size_t head;
+    uint16_t index[BC_KV_KEY_COUNT];
+
+    bool compacting;
+    size_t compact_head;
+    uint16_t compact_index[BC_KV_KEY_COUNT];
+    uint32_t compact_pending[(BC_KV_KEY_COUNT + 31) / 32];
+    int compact_key;
+    size_t compact_length;
+    uint8_t compact_buffer[_BC_KV_RECORD_SIZE(BC_KV_MAX_LENGTH) + _BC_KV_END_SIZE];
+    bc_scheduler_task_id_t task_id;
+
+} _bc_kv;
+
+static uint32_t _bc_kv_sector_address(int sector);
+static bool _bc_kv_read_header(int sector, uint16_t *generation);
+static void _bc_kv_build_header(uint8_t *header, uint16_t generation);
+static uint16_t _bc_kv_crc(uint16_t generation, const uint8_t *record);
+static void _bc_kv_seal(uint16_t generation, uint8_t *record);
+static size_t _bc_kv_read_record(size_t offset, uint8_t *record);
+static size_t _bc_kv_end(uint8_t *buffer, size_t offset, size_t length);
+static void _bc_kv_scan(void);
+static size_t _bc_kv_get_garbage(void);
+static bool _bc_kv_append(uint8_t key, const void *buffer, size_t length);
+static void _bc_kv_compact_start(void);
+static bool _bc_kv_compact(void);
+static bool _bc_kv_compact_commit(void);
+static void _bc_kv_compact_finish(void);
+static void _bc_kv_task(void *param);
+static void _bc_kv_eeprom_event_handler(bc_eepromc_event_t event, void *event_param);
+
+bool bc_kv_init(uint32_t address, size_t size)
+{
+    uint16_t generation[2];
+    bool valid[2];
+
+    memset(&_bc_kv, 0, sizeof(_bc_kv));
+
+    _bc_kv.address = address;
+    _bc_kv.sector_size = (size / 2) & ~3U;
+
+    if ((address % 4) != 0 || address + size > bc_eeprom_get_size() || _bc_kv.sector_size > UINT16_MAX ||
+            _bc_kv.sector_size < _BC_KV_HEADER_SIZE + 2 * _BC_KV_RECORD_SIZE(BC_KV_MAX_LENGTH))
+    {
+        return false;
+    }
+
+    valid[0] = _bc_kv_read_header(0, &generation[0]);
+    valid[1] = _bc_kv_read_header(1, &generation[1]);
+
+    if (!valid[0] && !valid[1])
+    {
+        // Blank area is formatted, stale data behind the header fail CRC of the new generation
+        _bc_kv.sector = 0;
+        _bc_kv.generation = 1;
+
+        _bc_kv_build_header(_bc_kv.compact_buffer, _bc_kv.generation);
+
+        if (!bc_eeprom_write(_bc_kv_sector_address(0), _bc_kv.compact_buffer, _bc_kv_end(_bc_kv.compact_buffer, 0, _BC_KV_HEADER_SIZE)))
+        {
+            return false;
+        }
+    }
+    else if (!valid[1] || (valid[0] && (int16_t) (generation[0] - generation[1]) > 0))
+    {
+        _bc_kv.sector = 0;
+        _bc_kv.generation = generation[0];
+    }
+    else
+    {
+        _bc_kv.sector = 1;
+        _bc_kv.generation = generation[1];
+    }
+
+    _bc_kv_scan();
+
+    _bc_kv.task_id = bc_scheduler_register(_bc_kv_task, NULL, BC_TICK_INFINITY);
+
+    _bc_kv.initialized = true;
+
+    return true;
+}
+
+bool bc_kv_get(uint8_t key, void *buffer, size_t length)
+{
+    if (length == 0 || bc_kv_get_length(key) != length)
+    {
+        return false;
+    }
+
+    return bc_eeprom_read(_bc_kv_sector_address(_bc_kv.sector) + _bc_kv.index[key] + _BC_KV_RECORD_HEADER_SIZE, buffer, length);
+}
+
+size_t bc_kv_get_length(uint8_t key)
+{
+    uint8_t header[_BC_KV_RECORD_HEADER_SIZE];
+
+    if (!_bc_kv.initialized || key >= BC_KV_KEY_COUNT || _bc_kv.index[key] == 0)
+    {
+        return 0;
+    }
+
+    bc_eeprom_read(_bc_kv_sector_address(_bc_kv.sector) + _bc_kv.index[key], header, sizeof(header));
+
+    return header[1];
+}
+
+bool bc_kv_set(uint8_t key, const void *buffer, size_t length)
+{
+    uint8_t value[BC_KV_MAX_LENGTH];
+
+    if (!_bc_kv.initialized || key >= BC_KV_KEY_COUNT || length == 0 || length > BC_KV_MAX_LENGTH)
+    {
+        return false;
+    }
+
+    // Unchanged value costs no EEPROM write
+    if (bc_kv_get(key, value, length) && memcmp(value, buffer, length) == 0)
+    {
+        return true;
+    }
+
+    return _bc_kv_append(key, buffer, length);
+}
+
+bool bc_kv_delete(uint8_t key)
+{
+    if (!_bc_kv.initialized || key >= BC_KV_KEY_COUNT)
+    {
+        return false;
+    }
+
+    if (_bc_kv.index[key] == 0)
+    {
+        return true;
+    }
+
+    return _bc_kv_append(key, NULL, 0);
+}
+
+size_t bc_kv_get_free(void)
+{
+    if (!_bc_kv.initialized)
+    {
+        return 0;
+    }
+
+    return _bc_kv.sector_size - _bc_kv.head;
+}
+
+static uint32_t _bc_kv_sector_address(int sector)
+{
+    return _bc_kv.address + sector * _bc_kv.sector_size;
+}
+
+static bool _bc_kv_read_header(int sector, uint16_t *generation)
+{
+    uint8_t header[_BC_KV_HEADER_SIZE];
+    uint8_t expected[_BC_KV_HEADER_SIZE];
+
+    bc_eeprom_read(_bc_kv_sector_address(sector), header, sizeof(header));
+
+    *generation = (uint16_t) header[5] << 8 | header[4];
+
+    _bc_kv_build_header(expected, *generation);
+
+    return memcmp(header, expected, sizeof(header)) == 0;
+}
+
+static void _bc_kv_build_header(uint8_t *header, uint16_t generation)
+{
+    header[0] = (uint8_t) _BC_KV_SIGNATURE;
+    header[1] = (uint8_t) (_BC_KV_SIGNATURE >> 8);
+    header[2] = (uint8_t) (_BC_KV_SIGNATURE >> 16);
+    header[3] = (uint8_t) (_BC_KV_SIGNATURE >> 24);
+    header[4] = generation;
+    header[5] = generation >> 8;
+
+    uint16_t crc = bc_crc16_ibm(header, 6, 0xffff);
+
+    header[6] = crc;
+    header[7] = crc >> 8;
+}
+
+static uint16_t _bc_kv_crc(uint16_t generation, const uint8_t *record)
+{
+    uint8_t buffer[2] = { generation, generation >> 8 };
+
+    // Generation makes records left behind by older use of the sector invalid
+    uint16_t crc = bc_crc16_ibm(buffer, sizeof(buffer), 0xffff);
+
+    crc = bc_crc16_ibm(record, 2, crc);
+
+    return bc_crc16_ibm(record + _BC_KV_RECORD_HEADER_SIZE, record[1], crc);
+}
+
+static void _bc_kv_seal(uint16_t generation, uint8_t *record)
+{
+    uint16_t crc = _bc_kv_crc(generation, record);
+
+    record[2] = crc;
+    record[3] = crc >> 8;
+}
+
+static size_t _bc_kv_read_record(size_t offset, uint8_t *record)
+{
+    uint32_t address = _bc_kv_sector_address(_bc_kv.sector) + offset;
+
+    if (offset + _BC_KV_RECORD_HEADER_SIZE > _bc_kv.sector_size)
+    {
+        return 0;
+    }
+
+    bc_eeprom_read(address, record, _BC_KV_RECORD_HEADER_SIZE);
+
+    size_t record_size = _BC_KV_RECORD_SIZE(record[1]);
+
+    if (record[0] >= BC_KV_KEY_COUNT || record[1] > BC_KV_MAX_LENGTH || offset + record_size > _bc_kv.sector_size)
+    {
+        return 0;
+    }
+
+    bc_eeprom_read(address + _BC_KV_RECORD_HEADER_SIZE, record + _BC_KV_RECORD_HEADER_SIZE, record_size - _BC_KV_RECORD_HEADER_SIZE);
+
+    return record_size;
+}
+
+static size_t _bc_kv_end(uint8_t *buffer, size_t offset, size_t length)
+{
+    // End word is not needed when the sector is full
+    if (offset + length + _BC_KV_END_SIZE > _bc_kv.sector_size)
+    {
+        return length;
+    }
+
+    memset(buffer + length, 0xff, _BC_KV_END_SIZE);
+
+    return length + _BC_KV_END_SIZE;
+}
+
+static void _bc_kv_scan(void)
+{
+    uint8_t *record = _bc_kv.compact_buffer;
+
+    _bc_kv.head = _BC_KV_HEADER_SIZE;
+
+    for (;;)
+    {
+        size_t record_size = _bc_kv_read_record(_bc_kv.head, record);
+
+        // Log ends with the first invalid record (unwritten, torn or from older generation)
+        if (record_size == 0 || _bc_kv_crc(_bc_kv.generation, record) != ((uint16_t) record[3] << 8 | record[2]))
+        {
+            break;
+        }
+
+        _bc_kv.index[record[0]] = record[1] != 0 ? _bc_kv.head : 0;
+
+        _bc_kv.head += record_size;
+    }
+}
+
+static size_t _bc_kv_get_garbage(void)
+{
+    size_t live = 0;
+
+    for (uint8_t key = 0; key < BC_KV_KEY_COUNT; key++)
+    {
+        if (_bc_kv.index[key] != 0)
+        {
+            live += _BC_KV_RECORD_SIZE(bc_kv_get_length(key));
+        }
+    }
+
+    return _bc_kv.head - _BC_KV_HEADER_SIZE - live;
+}
+
+static bool _bc_kv_append(uint8_t key, const void *buffer, size_t length)
+{
+    uint8_t record[_BC_KV_RECORD_SIZE(BC_KV_MAX_LENGTH) + _BC_KV_END_SIZE];
+    size_t record_size = _BC_KV_RECORD_SIZE(length);
+
+    if (_bc_kv.compacting && _bc_kv.compact_key < 0 && _bc_kv.compact_length != 0)
+    {
+        // Only header of the other sector is missing, it is finished right now so the record goes there
+        bc_eeprom_async_cancel();
+
+        _bc_kv.compact_length = 0;
+
+        _bc_kv_compact_commit();
+    }
+
+    if (_bc_kv.head + record_size > _bc_kv.sector_size)
+    {
+        // Background compaction has not made it in time
+        if (!_bc_kv_compact() || _bc_kv.head + record_size > _bc_kv.sector_size)
+        {
+            return false;
+        }
+    }
+
+    memset(record, 0, record_size);
+
+    record[0] = key;
+    record[1] = length;
+
+    if (length != 0)
+    {
+        memcpy(record + _BC_KV_RECORD_HEADER_SIZE, buffer, length);
+    }
+
+    _bc_kv_seal(_bc_kv.generation, record);
+
+    // Head stays on failure, so the bad record is overwritten and it doesn't cut the log
+    if (!bc_eeprom_write(_bc_kv_sector_address(_bc_kv.sector) + _bc_kv.head, record, _bc_kv_end(record, _bc_kv.head, record_size)))
+    {
+        return false;
+    }
+
+    _bc_kv.index[key] = length != 0 ? _bc_kv.head : 0;
+
+    _bc_kv.head += record_size;
+
+    if (_bc_kv.compacting)
+    {
+        // Key has to be copied again with its new value
+        _bc_kv.compact_pending[key / 32] |= 1UL << (key % 32);
+
+        bc_scheduler_plan_now(_bc_kv.task_id);
+    }
+    else if (bc_kv_get_free() < _bc_kv.sector_size / 4 && _bc_kv_get_garbage() >= _bc_kv.sector_size / 4)
+    {
+        _bc_kv_compact_start();
+    }
+
+    return true;
+}
+
+static void _bc_kv_compact_start(void)
+{
+    memset(_bc_kv.compact_index, 0, sizeof(_bc_kv.compact_index));
+    memset(_bc_kv.compact_pending, 0, sizeof(_bc_kv.compact_pending));
+
+    for (uint8_t key = 0; key < BC_KV_KEY_COUNT; key++)
+    {
+        if (_bc_kv.index[key] != 0)
+        {
+            _bc_kv.compact_pending[key / 32] |= 1UL << (key % 32);
+        }
+    }
+
+    _bc_kv.compact_head = _BC_KV_HEADER_SIZE;
+    _bc_kv.compact_length = 0;
+    _bc_kv.compacting = true;
+
+    bc_scheduler_plan_now(_bc_kv.task_id);
+}
+
+static bool _bc_kv_compact(void)
+{
+    uint32_t address = _bc_kv_sector_address(1 - _bc_kv.sector);
+    size_t head = _BC_KV_HEADER_SIZE;
+
+    if (_bc_kv.compacting && _bc_kv.compact_length != 0)
+    {
+        bc_eeprom_async_cancel();
+
+        _bc_kv.compact_length = 0;
+    }
+
+    _bc_kv.compacting = false;
+
+    for (uint8_t key = 0; key < BC_KV_KEY_COUNT; key++)
+    {
+        _bc_kv.compact_index[key] = 0;
+
+        if (_bc_kv.index[key] == 0)
+        {
+            continue;
+        }
+
+        size_t record_size = _bc_kv_read_record(_bc_kv.index[key], _bc_kv.compact_buffer);
+
+        _bc_kv_seal(_bc_kv.generation + 1, _bc_kv.compact_buffer);
+
+        if (head + record_size > _bc_kv.sector_size ||
+                !bc_eeprom_write(address + head, _bc_kv.compact_buffer, _bc_kv_end(_bc_kv.compact_buffer, head, record_size)))
+        {
+            return false;
+        }
+
+        _bc_kv.compact_index[key] = head;
+
+        head += record_size;
+    }
+
+    _bc_kv.compact_head = head;
+
+    return _bc_kv_compact_commit();
+}
+
+static bool _bc_kv_compact_commit(void)
+{
+    uint8_t header[_BC_KV_HEADER_SIZE];
+
+    _bc_kv_build_header(header, _bc_kv.generation + 1);
+
+    if (!bc_eeprom_write(_bc_kv_sector_address(1 - _bc_kv.sector), header, sizeof(header)))
+    {
+        _bc_kv.compacting = false;
+
+        return false;
+    }
+
+    _bc_kv_compact_finish();
+
+    return true;
+}
+
+static void _bc_kv_compact_finish(void)
+{
+    // Header of the other sector is written, it has newer generation and it becomes active
+    _bc_kv.sector = 1 - _bc_kv.sector;
+    _bc_kv.generation++;
+    _bc_kv.head = _bc_kv.compact_head;
+
+    memcpy(_bc_kv.index, _bc_kv.compact_index, sizeof(_bc_kv.index));
+
+    _bc_kv.compacting = false;
+}
+
+static void _bc_kv_task(void *param)
+{
+    (void) param;
+
+    uint32_t address = _bc_kv_sector_address(1 - _bc_kv.sector);
+    int key;
+
+    if (!_bc_kv.compacting || _bc_kv.compact_length != 0)
+    {
+        return;
+    }
+
+    for (key = 0; key < BC_KV_KEY_COUNT; key++)
+    {
+        if ((_bc_kv.compact_pending[key / 32] & (1UL << (key % 32))) != 0)
+        {
+            break;
+        }
+    }
+
+    if (key == BC_KV_KEY_COUNT)
+    {
+        // Header is written last, so the other sector takes over only with all records in place
+        _bc_kv_build_header(_bc_kv.compact_buffer, _bc_kv.generation + 1);
+
+        _bc_kv.compact_key = -1;
+        _bc_kv.compact_length = _BC_KV_HEADER_SIZE;
+    }
+    else
+    {
+        _bc_kv.compact_pending[key / 32] &= ~(1UL << (key % 32));
+
+        size_t record_size;
+
+        if (_bc_kv.index[key] != 0)
+        {
+            record_size = _bc_kv_read_record(_bc_kv.index[key], _bc_kv.compact_buffer);
+        }
+        else if (_bc_kv.compact_index[key] != 0)
+        {
+            // Key has been deleted after it was copied, deletion has to be copied too
+            memset(_bc_kv.compact_buffer, 0, _BC_KV_RECORD_HEADER_SIZE);
+
+            _bc_kv.compact_buffer[0] = key;
+
+            record_size = _BC_KV_RECORD_HEADER_SIZE;
+        }
+        else
+        {
+            bc_scheduler_plan_current_now();
+
+            return;
+        }
+
+        if (_bc_kv.compact_head + record_size > _bc_kv.sector_size)
+        {
+            // Values rewritten meanwhile don't fit, sync compaction is done once the sector is full
+            _bc_kv.compacting = false;
+
+            return;
+        }
+
+        _bc_kv_seal(_bc_kv.generation + 1, _bc_kv.compact_buffer);
+
+        _bc_kv.compact_key = key;
+        _bc_kv.compact_length = record_size;
+
+        address += _bc_kv.compact_head;
+    }
+
+    size_t length = _bc_kv.compact_key < 0 ? _BC_KV_HEADER_SIZE : _bc_kv_end(_bc_kv.compact_buffer, _bc_kv.compact_head, _bc_kv.compact_length);
+
+    if (!bc_eeprom_async_write(address, _bc_kv.compact_buffer, length, _bc_kv_eeprom_event_handler, NULL))
+    {
+        // EEPROM is busy with another async write
+        if (_bc_kv.compact_key >= 0)
+        {
+            _bc_kv.compact_pending[key / 32] |= 1UL << (key % 32);
+        }
+
+        _bc_kv.compact_length = 0;
+
+        bc_scheduler_plan_current_from_now(_BC_KV_RETRY_INTERVAL);
+    }
+}
+
+static void _bc_kv_eeprom_event_handler(bc_eepromc_event_t event, void *event_param)
+{
+    (void) event_param;
+
+    size_t length = _bc_kv.compact_length;
+
+    _bc_kv.compact_length = 0;
+
+    if (!_bc_kv.compacting)
+    {
+        return;
+    }
+
+    if (event != BC_EEPROM_EVENT_ASYNC_WRITE_DONE)
+    {
+        // Compaction is started again by the next append
+        _bc_kv.compacting = false;
+
+        return;
+    }
+
+    if (_bc_kv.compact_key < 0)
+    {
+        _bc_kv_compact_finish();
+
+        return;
+    }
+
+    _bc_kv.compact_index[_bc_kv.compact_key] = _bc_kv.compact_buffer[1] != 0 ? _bc_kv.compact_head : 0;
+
+    _bc_kv.compact_head += length;
+
+    bc_scheduler_plan_now(_bc_kv.task_id);
+}
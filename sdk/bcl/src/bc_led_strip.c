@@ -3,7 +3,8 @@
 #define BC_LED_STRIP_NULL_TASK BC_SCHEDULER_MAX_TASKS + 1
 
 static uint32_t _bc_led_strip_wheel(int position);
-static void _bc_led_strip_get_heat_map_color(float value, float *red, float *green, float *blue);
+static void _bc_led_strip_draw_heat_map(bc_led_strip_t *self, int length);
+static int _bc_led_strip_thermometer_index(int count, int32_t value, int32_t span);
 
 void bc_led_strip_init(bc_led_strip_t *self, const bc_led_strip_driver_t *driver, const bc_led_strip_buffer_t *buffer)
 {
@@ -125,10 +126,11 @@ static void _bc_led_strip_effect_done(bc_led_strip_t *self)
     }
 }
 
-static void _bc_led_strip_effect_test_task(void *param)
+static void _bc_led_strip_effect_task(void *param)
 {
     bc_led_strip_t *self = (bc_led_strip_t *)param;
 
+    // Driver streams pixels from its buffer, frame can't be rendered before it is sent
     if (!self->_driver->is_ready())
     {
         bc_scheduler_plan_current_now();
@@ -136,6 +138,45 @@ static void _bc_led_strip_effect_test_task(void *param)
         return;
     }
 
+    bool running = self->_effect.render(self);
+
+    self->_driver->write();
+
+    if (!running)
+    {
+        _bc_led_strip_effect_done(self);
+
+        return;
+    }
+
+    // Frames are paced from planned tick, so rendering and waiting for driver don't stretch the period,
+    // pacing starts again from now on first frame or when a whole period is lost
+    self->_effect.tick += self->_effect.wait;
+
+    if (self->_effect.tick <= bc_scheduler_get_spin_tick())
+    {
+        self->_effect.tick = bc_scheduler_get_spin_tick() + self->_effect.wait;
+    }
+
+    bc_scheduler_plan_current_absolute(self->_effect.tick);
+}
+
+static void _bc_led_strip_effect_start(bc_led_strip_t *self, bool (*render)(bc_led_strip_t *), uint32_t color, bc_tick_t wait)
+{
+    bc_led_strip_effect_stop(self);
+
+    self->_effect.render = render;
+    self->_effect.color = color;
+    self->_effect.wait = wait;
+    self->_effect.tick = bc_scheduler_get_spin_tick();
+    self->_effect.led = 0;
+    self->_effect.round = 0;
+
+    self->_effect.task_id = bc_scheduler_register(_bc_led_strip_effect_task, self, 0);
+}
+
+static bool _bc_led_strip_effect_test_render(bc_led_strip_t *self)
+{
     uint8_t intensity = 255 * (self->_effect.led + 1) / (self->_buffer->count + 1);
 
     if (self->_effect.round == 0)
@@ -175,143 +216,84 @@ static void _bc_led_strip_effect_test_task(void *param)
         self->_effect.round++;
     }
 
-    self->_driver->write();
-
-    if (self->_effect.round == 5)
-    {
-        _bc_led_strip_effect_done(self);
-        return;
-    }
-
-    bc_scheduler_plan_current_relative(self->_effect.wait);
+    return self->_effect.round != 5;
 }
 
 void bc_led_strip_effect_test(bc_led_strip_t *self)
 {
-    bc_led_strip_effect_stop(self);
-
-    self->_effect.led = 0;
-    self->_effect.round = 0;
-    self->_effect.wait = 2000 / self->_buffer->count;
-
     bc_led_strip_fill(self, 0x00000000);
 
-    self->_effect.task_id = bc_scheduler_register(_bc_led_strip_effect_test_task, self, 0);
+    _bc_led_strip_effect_start(self, _bc_led_strip_effect_test_render, 0, 2000 / self->_buffer->count);
 }
 
-static void _bc_led_strip_effect_rainbow_task(void *param)
+static bool _bc_led_strip_effect_rainbow_render(bc_led_strip_t *self)
 {
-    bc_led_strip_t *self = (bc_led_strip_t *)param;
-
-    if (!self->_driver->is_ready())
+    for (int i = 0; i < self->_buffer->count; i++)
     {
-        bc_scheduler_plan_current_now();
-
-        return;
-    }
-
-    for(int i = 0; i< self->_buffer->count; i++) {
         bc_led_strip_set_pixel(self, i, _bc_led_strip_wheel((i + self->_effect.round) & 255));
     }
 
-    self->_effect.round++;
-
-    self->_driver->write();
+    self->_effect.round = (self->_effect.round + 1) & 255;
 
-    bc_scheduler_plan_current_relative(self->_effect.wait);
+    return true;
 }
 
 void bc_led_strip_effect_rainbow(bc_led_strip_t *self, bc_tick_t wait)
 {
-    bc_led_strip_effect_stop(self);
-
-    self->_effect.round = 0;
-    self->_effect.wait = wait;
-
-    self->_effect.task_id = bc_scheduler_register(_bc_led_strip_effect_rainbow_task, self, 0);
+    _bc_led_strip_effect_start(self, _bc_led_strip_effect_rainbow_render, 0, wait);
 }
 
-static void _bc_led_strip_effect_rainbow_cycle_task(void *param)
+static bool _bc_led_strip_effect_rainbow_cycle_render(bc_led_strip_t *self)
 {
-    bc_led_strip_t *self = (bc_led_strip_t *)param;
+    int count = self->_buffer->count;
 
-    if (!self->_driver->is_ready())
+    // Wheel position i * 256 / count is stepped without division
+    int step = 256 / count;
+    int step_remainder = 256 % count;
+    int position = self->_effect.round;
+    int remainder = 0;
+
+    for (int i = 0; i < count; i++)
     {
-        bc_scheduler_plan_current_now();
+        bc_led_strip_set_pixel(self, i, _bc_led_strip_wheel(position & 255));
 
-        return;
-    }
+        position += step;
+        remainder += step_remainder;
 
-    for(int i = 0; i< self->_buffer->count; i++) {
-        bc_led_strip_set_pixel(self, i, _bc_led_strip_wheel(((i * 256 / self->_buffer->count) + self->_effect.round) & 255));
+        if (remainder >= count)
+        {
+            remainder -= count;
+            position++;
+        }
     }
 
-    self->_effect.round++;
+    self->_effect.round = (self->_effect.round + 1) & 255;
 
-    self->_driver->write();
-
-    bc_scheduler_plan_current_relative(self->_effect.wait);
+    return true;
 }
 
 void bc_led_strip_effect_rainbow_cycle(bc_led_strip_t *self, bc_tick_t wait)
 {
-    bc_led_strip_effect_stop(self);
-
-    self->_effect.round = 0;
-    self->_effect.wait = wait;
-
-    self->_effect.task_id = bc_scheduler_register(_bc_led_strip_effect_rainbow_cycle_task, self, 0);
+    _bc_led_strip_effect_start(self, _bc_led_strip_effect_rainbow_cycle_render, 0, wait);
 }
 
-static void _bc_led_strip_effect_color_wipe_task(void *param)
+static bool _bc_led_strip_effect_color_wipe_render(bc_led_strip_t *self)
 {
-    bc_led_strip_t *self = (bc_led_strip_t *)param;
-
-    if (!self->_driver->is_ready())
-    {
-        bc_scheduler_plan_current_now();
-
-        return;
-    }
-
     bc_led_strip_set_pixel(self, self->_effect.led++, self->_effect.color);
 
-    if (self->_effect.led == self->_buffer->count)
-    {
-        _bc_led_strip_effect_done(self);
-        return;
-    }
-
-    self->_driver->write();
-
-    bc_scheduler_plan_current_relative(self->_effect.wait);
-
+    return self->_effect.led != self->_buffer->count;
 }
 
 void bc_led_strip_effect_color_wipe(bc_led_strip_t *self, uint32_t color, bc_tick_t wait)
 {
-    bc_led_strip_effect_stop(self);
-
-    self->_effect.led = 0;
-    self->_effect.wait = wait;
-    self->_effect.color = color;
-
-    self->_effect.task_id = bc_scheduler_register(_bc_led_strip_effect_color_wipe_task, self, 0);
+    _bc_led_strip_effect_start(self, _bc_led_strip_effect_color_wipe_render, color, wait);
 }
 
-static void _bc_led_strip_effect_theater_chase_task(void *param)
+static void _bc_led_strip_effect_theater_chase_step(bc_led_strip_t *self)
 {
-    bc_led_strip_t *self = (bc_led_strip_t *)param;
-
-    if (!self->_driver->is_ready())
+    for (int i = self->_effect.led; i < self->_buffer->count; i += 3)
     {
-        bc_scheduler_plan_current_now();
-
-        return;
-    }
-
-    for (int i = self->_effect.led; i < self->_buffer->count; i += 3) {
-        self->_driver->set_pixel(i, 0);    //turn every third pixel off
+        self->_driver->set_pixel(i, 0); // turn every third pixel off
     }
 
     self->_effect.led++;
@@ -320,124 +302,81 @@ static void _bc_led_strip_effect_theater_chase_task(void *param)
     {
         self->_effect.led = 0;
     }
+}
 
-    for (int i = self->_effect.led ; i < self->_buffer->count; i += 3) {
-        bc_led_strip_set_pixel(self, i, self->_effect.color);    //turn every third pixel on
-    }
-
-    self->_driver->write();
+static bool _bc_led_strip_effect_theater_chase_render(bc_led_strip_t *self)
+{
+    _bc_led_strip_effect_theater_chase_step(self);
 
-    bc_scheduler_plan_current_relative(self->_effect.wait);
+    for (int i = self->_effect.led; i < self->_buffer->count; i += 3)
+    {
+        bc_led_strip_set_pixel(self, i, self->_effect.color); // turn every third pixel on
+    }
 
+    return true;
 }
 
 void bc_led_strip_effect_theater_chase(bc_led_strip_t *self, uint32_t color, bc_tick_t wait)
 {
-    bc_led_strip_effect_stop(self);
-
-    self->_effect.led = 0;
-    self->_effect.round = 0;
-    self->_effect.color = color;
-    self->_effect.wait = wait;
-
-    self->_effect.task_id = bc_scheduler_register(_bc_led_strip_effect_theater_chase_task, self, 0);
+    _bc_led_strip_effect_start(self, _bc_led_strip_effect_theater_chase_render, color, wait);
 }
 
-static void _bc_led_strip_effect_theater_chase_rainbow_task(void *param)
+static bool _bc_led_strip_effect_theater_chase_rainbow_render(bc_led_strip_t *self)
 {
-    bc_led_strip_t *self = (bc_led_strip_t *)param;
-
-    if (!self->_driver->is_ready())
-    {
-        bc_scheduler_plan_current_now();
+    _bc_led_strip_effect_theater_chase_step(self);
 
-        return;
-    }
+    // Wheel position (i + round) % 255 is stepped without division, round is kept modulo 255
+    int position = self->_effect.led + self->_effect.round;
 
-    for (int i = self->_effect.led; i < self->_buffer->count; i += 3) {
-        self->_driver->set_pixel(i, 0);    //turn every third pixel off
-    }
-
-    self->_effect.led++;
-
-    if (self->_effect.led == 3)
+    if (position >= 255)
     {
-        self->_effect.led = 0;
+        position -= 255;
     }
 
-    for (int i = self->_effect.led; i < self->_buffer->count; i += 3) {
-        bc_led_strip_set_pixel(self, i, _bc_led_strip_wheel((i + self->_effect.round) % 255) );    //turn every third pixel on
-    }
+    for (int i = self->_effect.led; i < self->_buffer->count; i += 3)
+    {
+        bc_led_strip_set_pixel(self, i, _bc_led_strip_wheel(position)); // turn every third pixel on
 
-    self->_driver->write();
+        position += 3;
 
-    self->_effect.round++;
+        if (position >= 255)
+        {
+            position -= 255;
+        }
+    }
 
-    bc_scheduler_plan_current_relative(self->_effect.wait);
+    self->_effect.round = self->_effect.round == 254 ? 0 : self->_effect.round + 1;
 
+    return true;
 }
 
 void bc_led_strip_effect_theater_chase_rainbow(bc_led_strip_t *self, bc_tick_t wait)
 {
-    bc_led_strip_effect_stop(self);
-
-    self->_effect.led = 0;
-    self->_effect.round = 0;
-    self->_effect.wait = wait;
-
-    self->_effect.task_id = bc_scheduler_register(_bc_led_strip_effect_theater_chase_rainbow_task, self, 0);
+    _bc_led_strip_effect_start(self, _bc_led_strip_effect_theater_chase_rainbow_render, 0, wait);
 }
 
-static void bc_led_strip_effect_stroboscope_task(void *param)
+static bool _bc_led_strip_effect_stroboscope_render(bc_led_strip_t *self)
 {
-    bc_led_strip_t *self = (bc_led_strip_t *)param;
-
-    if (!self->_driver->is_ready())
-    {
-        bc_scheduler_plan_current_now();
-
-        return;
-    }
-
     uint32_t color = (self->_effect.round & 1) == 0 ? self->_effect.color : 0;
 
     bc_led_strip_fill(self, color);
 
-    bc_led_strip_write(self);
-
-    self->_effect.round++;
+    self->_effect.round ^= 1;
 
-    bc_scheduler_plan_current_relative(self->_effect.wait);
+    return true;
 }
 
 void bc_led_strip_effect_stroboscope(bc_led_strip_t *self, uint32_t color, bc_tick_t wait)
 {
-    bc_led_strip_effect_stop(self);
-
-    self->_effect.wait = wait;
-
-    self->_effect.round = 0;
-
-    self->_effect.color = color;
-
-    self->_effect.task_id = bc_scheduler_register(bc_led_strip_effect_stroboscope_task, self, 0);
+    _bc_led_strip_effect_start(self, _bc_led_strip_effect_stroboscope_render, color, wait);
 }
 
-void _bc_led_strip_effect_icicle_task(void *param)
+static bool _bc_led_strip_effect_icicle_render(bc_led_strip_t *self)
 {
-    bc_led_strip_t *self = (bc_led_strip_t *)param;
-
-    if (!self->_driver->is_ready())
-    {
-        bc_scheduler_plan_current_now();
-
-        return;
-    }
-
     const int length = 10;
 
-    for (int i = self->_effect.led; (i < self->_effect.led + length) && i < self->_buffer->count; i++) {
-
+    for (int i = self->_effect.led; (i < self->_effect.led + length) && i < self->_buffer->count; i++)
+    {
         if (i < 0)
         {
             continue;
@@ -453,7 +392,6 @@ void _bc_led_strip_effect_icicle_task(void *param)
         self->_effect.led = -length;
     }
 
-
     uint8_t r, g, b, w, dr, dg, db, dw;
 
     dr = ((uint8_t) (self->_effect.color >> 24)) / length;
@@ -466,14 +404,14 @@ void _bc_led_strip_effect_icicle_task(void *param)
     b = db;
     w = dw;
 
-    for (int i = self->_effect.led; (i < self->_effect.led + length) && i < self->_buffer->count; i++) {
-
+    for (int i = self->_effect.led; (i < self->_effect.led + length) && i < self->_buffer->count; i++)
+    {
         if (i < 0)
         {
             continue;
         }
 
-        bc_led_strip_set_pixel_rgbw(self, i, r, g, b, w); // 0x20000000
+        bc_led_strip_set_pixel_rgbw(self, i, r, g, b, w);
 
         r += dr;
         g += dg;
@@ -481,35 +419,18 @@ void _bc_led_strip_effect_icicle_task(void *param)
         w += dw;
     }
 
-    bc_led_strip_write(self);
-
-    bc_scheduler_plan_current_relative(self->_effect.wait);
+    return true;
 }
 
 void bc_led_strip_effect_icicle(bc_led_strip_t *self, uint32_t color, bc_tick_t wait)
 {
-    bc_led_strip_effect_stop(self);
-
-    self->_effect.color = color;
-
-    self->_effect.wait = wait;
+    _bc_led_strip_effect_start(self, _bc_led_strip_effect_icicle_render, color, wait);
 
     self->_effect.led = -10;
-
-    self->_effect.task_id = bc_scheduler_register(_bc_led_strip_effect_icicle_task, self, 0);
 }
 
-static void _bc_led_strip_effect_pulse_color_task(void *param)
+static bool _bc_led_strip_effect_pulse_color_render(bc_led_strip_t *self)
 {
-    bc_led_strip_t *self = (bc_led_strip_t *)param;
-
-    if (!self->_driver->is_ready())
-    {
-        bc_scheduler_plan_current_now();
-
-        return;
-    }
-
     uint8_t r = self->_effect.color >> 24;
     uint8_t g = self->_effect.color >> 16;
     uint8_t b = self->_effect.color >> 8;
@@ -532,27 +453,24 @@ static void _bc_led_strip_effect_pulse_color_task(void *param)
         bc_led_strip_set_pixel_rgbw(self, i, r, g, b, w);
     }
 
-    self->_driver->write();
-
-    bc_scheduler_plan_current_relative(self->_effect.wait);
+    return true;
 }
 
 void bc_led_strip_effect_pulse_color(bc_led_strip_t *self, uint32_t color, bc_tick_t wait)
 {
-    bc_led_strip_effect_stop(self);
-
-    self->_effect.round = 0;
-    self->_effect.wait = wait;
-    self->_effect.color = color;
-
-    self->_effect.task_id = bc_scheduler_register(_bc_led_strip_effect_pulse_color_task, self, 0);
+    _bc_led_strip_effect_start(self, _bc_led_strip_effect_pulse_color_render, color, wait);
 }
 
 void bc_led_strip_thermometer(bc_led_strip_t *self, float temperature, float min, float max, uint8_t white_dots, float set_point, uint32_t color)
 {
-    temperature -= min;
+    // Temperatures are converted to 1/256 degree once, strip is scaled by integer arithmetic
+    int32_t temperature_q = temperature * 256.f;
+    int32_t min_q = min * 256.f;
+    int32_t max_q = max * 256.f;
+    int32_t set_point_q = set_point * 256.f;
+    int32_t span = (max_q < 0 ? -max_q : max_q) + (min_q < 0 ? -min_q : min_q);
 
-    int max_i = ((float)self->_buffer->count / (float)(fabs(max) + fabs(min))) * temperature;
+    int max_i = _bc_led_strip_thermometer_index(self->_buffer->count, temperature_q - min_q, span);
 
     if (max_i > self->_buffer->count)
     {
@@ -564,16 +482,7 @@ void bc_led_strip_thermometer(bc_led_strip_t *self, float temperature, float min
         max_i = 0;
     }
 
-    float red;
-    float green;
-    float blue;
-
-    for (int i = 0; i < max_i; i++)
-    {
-        _bc_led_strip_get_heat_map_color((float)i / self->_buffer->count, &red, &green, &blue);
-
-        self->_driver->set_pixel_rgbw(i, self->_brightness * red, self->_brightness * green, self->_brightness * blue, 0);
-    }
+    _bc_led_strip_draw_heat_map(self, max_i);
 
     if (self->_buffer->type == BC_LED_STRIP_TYPE_RGBW)
     {
@@ -590,11 +499,9 @@ void bc_led_strip_thermometer(bc_led_strip_t *self, float temperature, float min
         }
     }
 
-    if ((min < set_point) && (max > set_point))
+    if ((min_q < set_point_q) && (max_q > set_point_q))
     {
-        set_point -= min;
-
-        int color_i = ((float)self->_buffer->count / (float)(fabs(max) + fabs(min))) * set_point;
+        int color_i = _bc_led_strip_thermometer_index(self->_buffer->count, set_point_q - min_q, span);
 
         self->_driver->set_pixel(color_i, color);
     }
@@ -619,32 +526,64 @@ static uint32_t _bc_led_strip_wheel(int position) {
     }
 }
 
-static void _bc_led_strip_get_heat_map_color(float value, float *red, float *green, float *blue)
+static void _bc_led_strip_draw_heat_map(bc_led_strip_t *self, int length)
 {
-    const int NUM_COLORS = 4;
-    const float color[4][3] = { {0,0,1}, {0,1,0}, {1,1,0}, {1,0,0} };
-
-    int idx1;        // Our desired color will be between these two indexes in "color".
-    int idx2;
-    float fractBetween = 0; // Fraction between "idx1" and "idx2" where our value is.
+    // Heat map goes blue - green - yellow - red over the strip, pixel i is at 3 * i / count of the way,
+    // segment is the integer part and fraction is remainder / count. Brightness times fraction is
+    // stepped as quotient and remainder, so there is no division per pixel.
+    int count = self->_buffer->count;
+    int brightness = self->_brightness;
+    int step = 3 * brightness / count;
+    int step_remainder = 3 * brightness % count;
+    int segment = 0;
+    int position = 0;
+    int rise = 0;
+    int remainder = 0;
 
-    if(value <= 0)
+    for (int i = 0; i < length; i++)
     {
-        idx1 = idx2 = 0;
-    }
-    else if(value >= 1)
-    {
-        idx1 = idx2 = NUM_COLORS - 1;
+        // Falling channel is brightness * (count - position) / count rounded down
+        int fall = remainder == 0 ? brightness - rise : brightness - rise - 1;
+
+        if (segment == 0)
+        {
+            self->_driver->set_pixel_rgbw(i, 0, rise, fall, 0);
+        }
+        else if (segment == 1)
+        {
+            self->_driver->set_pixel_rgbw(i, rise, brightness, 0, 0);
+        }
+        else
+        {
+            self->_driver->set_pixel_rgbw(i, brightness, fall, 0, 0);
+        }
+
+        position += 3;
+        rise += step;
+        remainder += step_remainder;
+
+        if (remainder >= count)
+        {
+            remainder -= count;
+            rise++;
+        }
+
+        while (position >= count)
+        {
+            position -= count;
+            rise -= brightness;
+            segment++;
+        }
     }
-    else
+}
+
+// Pixel of value on strip which shows span, rounded toward zero
+static int _bc_led_strip_thermometer_index(int count, int32_t value, int32_t span)
+{
+    if (span == 0)
     {
-        value = value * (NUM_COLORS - 1);      // Will multiply value by 3.
-        idx1  = floor(value);                  // Our desired color will be after this index.
-        idx2  = idx1 + 1;                      // ... and before this index (inclusive).
-        fractBetween = value - (float)idx1;    // Distance between the two indexes (0-1).
+        return 0;
     }
 
-    *red   = (color[idx2][0] - color[idx1][0]) * fractBetween + color[idx1][0];
-    *green = (color[idx2][1] - color[idx1][1]) * fractBetween + color[idx1][1];
-    *blue  = (color[idx2][2] - color[idx1][2]) * fractBetween + color[idx1][2];
+    return count * value / span;
 }
@@ -1,5 +1,12 @@
 #include <bc_log.h>
 #include <bc_error.h>
+#include <bc_fifo.h>
+#include <bc_crc.h>
+
+#define _BC_LOG_TOKEN_MESSAGE 0xf0
+#define _BC_LOG_TOKEN_SYNC 0xf8
+#define _BC_LOG_TOKEN_SYNC_INTERVAL 16384
+#define _BC_LOG_TOKEN_ARGS_RESERVE 80
 
 typedef struct
 {
@@ -7,9 +14,15 @@ typedef struct
     bc_log_level_t level;
     bc_log_timestamp_t timestamp;
     bc_tick_t tick_last;
+    bool blocking;
+    uint32_t dropped;
+    uint32_t dropped_reported;
 
     char buffer[256];
 
+    bc_fifo_t fifo;
+    uint8_t fifo_buffer[BC_LOG_BUFFER_SIZE];
+
 } bc_log_t;
 
 #ifndef RELEASE
@@ -18,7 +31,18 @@ static bc_log_t _bc_log = { .initialized = false };
 
 void application_error(bc_error_t code);
 
+#ifndef BC_LOG_TOKENIZED
 static void _bc_log_message(bc_log_level_t level, char id, const char *format, va_list ap);
+#else
+static bool _bc_log_token_check(bc_log_level_t level);
+static void _bc_log_token_sync(bc_tick_t tick_now);
+static size_t _bc_log_token_begin(bc_log_level_t level, uint32_t token, bc_tick_t tick_now);
+static size_t _bc_log_token_put_varint(size_t offset, uint32_t value);
+static size_t _bc_log_token_put_varint64(size_t offset, uint64_t value);
+static size_t _bc_log_token_put_args(size_t offset, uint32_t types, va_list ap);
+static bool _bc_log_token_end(size_t offset);
+#endif
+static bool _bc_log_write(const char *buffer, size_t length);
 
 void bc_log_init(bc_log_level_t level, bc_log_timestamp_t timestamp)
 {
@@ -35,9 +59,18 @@ void bc_log_init(bc_log_level_t level, bc_log_timestamp_t timestamp)
     bc_uart_init(BC_LOG_UART, BC_UART_BAUDRATE_115200, BC_UART_SETTING_8N1);
     bc_uart_write(BC_LOG_UART, "\r\n", 2);
 
+    bc_fifo_init(&_bc_log.fifo, _bc_log.fifo_buffer, sizeof(_bc_log.fifo_buffer));
+    bc_uart_set_async_fifo(BC_LOG_UART, &_bc_log.fifo, NULL);
+
     _bc_log.initialized = true;
+
+#ifdef BC_LOG_TOKENIZED
+    _bc_log_token_sync(bc_tick_get());
+#endif
 }
 
+#ifndef BC_LOG_TOKENIZED
+
 void bc_log_dump(const void *buffer, size_t length, const char *format, ...)
 {
     va_list ap;
@@ -136,7 +169,7 @@ void bc_log_dump(const void *buffer, size_t length, const char *format, ...)
             _bc_log.buffer[offset++] = '\r';
             _bc_log.buffer[offset++] = '\n';
 
-            bc_uart_write(BC_LOG_UART, _bc_log.buffer, offset);
+            _bc_log_write(_bc_log.buffer, offset);
         }
     }
 }
@@ -177,6 +210,94 @@ void bc_log_error(const char *format, ...)
     va_end(ap);
 }
 
+#else
+
+void _bc_log_tokenized(bc_log_level_t level, uint32_t token, uint32_t types, ...)
+{
+    va_list ap;
+
+    if (!_bc_log_token_check(level))
+    {
+        return;
+    }
+
+    bc_tick_t tick_now = bc_tick_get();
+
+    size_t offset = _bc_log_token_begin(level, token, tick_now);
+
+    va_start(ap, types);
+    offset = _bc_log_token_put_args(offset, types, ap);
+    va_end(ap);
+
+    if (_bc_log_token_end(offset))
+    {
+        _bc_log.tick_last = tick_now;
+    }
+}
+
+void _bc_log_tokenized_dump(const void *buffer, size_t length, uint32_t token, uint32_t types, ...)
+{
+    va_list ap;
+
+    if (!_bc_log_token_check(BC_LOG_LEVEL_DUMP))
+    {
+        return;
+    }
+
+    bc_tick_t tick_now = bc_tick_get();
+
+    size_t offset = _bc_log_token_begin(BC_LOG_LEVEL_DUMP, token, tick_now);
+
+    va_start(ap, types);
+    offset = _bc_log_token_put_args(offset, types, ap);
+    va_end(ap);
+
+    // Dumped data follow arguments, they are truncated to fit into the record
+    size_t space = sizeof(_bc_log.buffer) - 3 - offset;
+
+    if (buffer == NULL)
+    {
+        length = 0;
+    }
+
+    if (length > space)
+    {
+        length = space;
+    }
+
+    offset = _bc_log_token_put_varint(offset, length);
+
+    memcpy(&_bc_log.buffer[offset], buffer, length);
+
+    offset += length;
+
+    if (_bc_log_token_end(offset))
+    {
+        _bc_log.tick_last = tick_now;
+    }
+}
+
+#endif
+
+uint32_t bc_log_get_dropped(void)
+{
+    return _bc_log.dropped;
+}
+
+void bc_log_flush_on_fault(void)
+{
+    if (!_bc_log.initialized)
+    {
+        return;
+    }
+
+    bc_uart_async_write_flush(BC_LOG_UART);
+
+    _bc_log.blocking = true;
+}
+
+#ifndef BC_LOG_TOKENIZED
+
 static void _bc_log_message(bc_log_level_t level, char id, const char *format, va_list ap)
 {
     if (!_bc_log.initialized)
@@ -218,12 +339,236 @@ static void _bc_log_message(bc_log_level_t level, char id, const char *format, v
         offset = 6;
     }
 
-    offset += vsnprintf(&_bc_log.buffer[offset], sizeof(_bc_log.buffer) - offset - 3, format, ap);
+    size_t size = sizeof(_bc_log.buffer) - offset - 2;
+
+    int length = vsnprintf(&_bc_log.buffer[offset], size, format, ap);
+
+    // Long message is truncated
+    if (length > 0)
+    {
+        offset += (size_t) length < size ? (size_t) length : size - 1;
+    }
 
     _bc_log.buffer[offset++] = '\r';
     _bc_log.buffer[offset++] = '\n';
 
-    bc_uart_write(BC_LOG_UART, _bc_log.buffer, offset);
+    _bc_log_write(_bc_log.buffer, offset);
+}
+
+#else
+
+static bool _bc_log_token_check(bc_log_level_t level)
+{
+    if (!_bc_log.initialized)
+    {
+        application_error(BC_ERROR_LOG_NOT_INITIALIZED);
+    }
+
+    return _bc_log.level <= level;
+}
+
+static void _bc_log_token_sync(bc_tick_t tick_now)
+{
+    size_t offset = 2;
+
+    _bc_log.buffer[0] = (char) _BC_LOG_TOKEN_SYNC;
+
+    offset = _bc_log_token_put_varint64(offset, tick_now);
+
+    _bc_log.buffer[offset++] = _bc_log.timestamp - BC_LOG_TIMESTAMP_OFF;
+
+    if (_bc_log_token_end(offset))
+    {
+        _bc_log.tick_last = tick_now;
+    }
+}
+
+static size_t _bc_log_token_begin(bc_log_level_t level, uint32_t token, bc_tick_t tick_now)
+{
+    size_t offset = 2;
+
+    // Absolute time is sent after a pause, so decoder attached later catches up
+    if (tick_now - _bc_log.tick_last >= _BC_LOG_TOKEN_SYNC_INTERVAL)
+    {
+        _bc_log_token_sync(tick_now);
+    }
+
+    _bc_log.buffer[0] = (char) (_BC_LOG_TOKEN_MESSAGE | level);
+
+    offset = _bc_log_token_put_varint(offset, token);
+
+    return _bc_log_token_put_varint64(offset, tick_now - _bc_log.tick_last);
+}
+
+static size_t _bc_log_token_put_varint(size_t offset, uint32_t value)
+{
+    while (value >= 0x80)
+    {
+        _bc_log.buffer[offset++] = (value & 0x7f) | 0x80;
+
+        value >>= 7;
+    }
+
+    _bc_log.buffer[offset++] = value;
+
+    return offset;
+}
+
+static size_t _bc_log_token_put_varint64(size_t offset, uint64_t value)
+{
+    while (value > UINT32_MAX)
+    {
+        _bc_log.buffer[offset++] = (value & 0x7f) | 0x80;
+
+        value >>= 7;
+    }
+
+    return _bc_log_token_put_varint(offset, value);
+}
+
+static size_t _bc_log_token_put_args(size_t offset, uint32_t types, va_list ap)
+{
+    // Integers are zigzag encoded regardless of their signedness, decoder interprets them by format string
+    for (; types != 0; types >>= 4)
+    {
+        switch (types & 0x0f)
+        {
+            case _BC_LOG_ARG_INT:
+            {
+                int value = va_arg(ap, int);
+
+                offset = _bc_log_token_put_varint(offset, (uint32_t) value << 1 ^ (uint32_t) (value >> 31));
+
+                break;
+            }
+            case _BC_LOG_ARG_UINT:
+            {
+                unsigned int value = va_arg(ap, unsigned int);
+
+                offset = _bc_log_token_put_varint64(offset, (uint64_t) value << 1);
+
+                break;
+            }
+            case _BC_LOG_ARG_INT64:
+            {
+                long long value = va_arg(ap, long long);
+
+                offset = _bc_log_token_put_varint64(offset, (uint64_t) value << 1 ^ (uint64_t) (value >> 63));
+
+                break;
+            }
+            case _BC_LOG_ARG_UINT64:
+            {
+                unsigned long long value = va_arg(ap, unsigned long long);
+
+                offset = _bc_log_token_put_varint64(offset, value << 1 ^ ((value >> 63) != 0 ? UINT64_MAX : 0));
+
+                break;
+            }
+            case _BC_LOG_ARG_DOUBLE:
+            {
+                float value = va_arg(ap, double);
+
+                memcpy(&_bc_log.buffer[offset], &value, sizeof(value));
+
+                offset += sizeof(value);
+
+                break;
+            }
+            case _BC_LOG_ARG_STRING:
+            {
+                const char *value = va_arg(ap, const char *);
+
+                size_t length = value != NULL ? strlen(value) : 0;
+
+                // Space is left for the longest values of following arguments
+                size_t space = offset + _BC_LOG_TOKEN_ARGS_RESERVE + 2 < sizeof(_bc_log.buffer) ? sizeof(_bc_log.buffer) - offset - _BC_LOG_TOKEN_ARGS_RESERVE - 2 : 0;
+
+                if (length > space)
+                {
+                    length = space;
+                }
+
+                if (length > 0x7f)
+                {
+                    length = 0x7f;
+                }
+
+                _bc_log.buffer[offset++] = length;
+
+                memcpy(&_bc_log.buffer[offset], value, length);
+
+                offset += length;
+
+                break;
+            }
+            case _BC_LOG_ARG_POINTER:
+            {
+                void *value = va_arg(ap, void *);
+
+                offset = _bc_log_token_put_varint64(offset, (uint64_t) (uintptr_t) value << 1);
+
+                break;
+            }
+            default:
+            {
+                return offset;
+            }
+        }
+    }
+
+    return offset;
+}
+
+static bool _bc_log_token_end(size_t offset)
+{
+    // Record is framed by header byte, payload length and CRC, so decoder can find it among text
+    _bc_log.buffer[1] = offset - 2;
+
+    _bc_log.buffer[offset] = bc_crc8_maxim(&_bc_log.buffer[1], offset - 1, 0);
+
+    return _bc_log_write(_bc_log.buffer, offset + 1);
+}
+
+#endif
+
+static bool _bc_log_write(const char *buffer, size_t length)
+{
+    char report[48];
+    size_t report_length = 0;
+
+    if (_bc_log.blocking)
+    {
+        return bc_uart_write(BC_LOG_UART, buffer, length) == length;
+    }
+
+    if (_bc_log.dropped != _bc_log.dropped_reported)
+    {
+        report_length = snprintf(report, sizeof(report), "# <W> %lu log messages dropped\r\n", (unsigned long) (_bc_log.dropped - _bc_log.dropped_reported));
+    }
+
+    // Whole message is dropped rather than waiting for space or sending its part
+    if (bc_fifo_get_free_space(&_bc_log.fifo) < report_length + length)
+    {
+        _bc_log.dropped++;
+
+        return false;
+    }
+
+    if (report_length != 0)
+    {
+        bc_uart_async_write(BC_LOG_UART, report, report_length);
+
+        _bc_log.dropped_reported = _bc_log.dropped;
+    }
+
+    // UART can be reinitialized by another module sharing it (bc_atci), then message is written synchronously
+    if (bc_uart_async_write(BC_LOG_UART, buffer, length) == 0)
+    {
+        return bc_uart_write(BC_LOG_UART, buffer, length) == length;
+    }
+
+    return true;
 }
 
 #endif
@@ -1,4 +1,5 @@
 #include <bc_lp8.h>
+#include <bc_crc.h>
 
 #define _BC_LP8_MODBUS_DEVICE_ADDRESS 0xfe
 #define _BC_LP8_MODBUS_WRITE 0x41
@@ -15,8 +16,6 @@ static void _bc_lp8_task_interval(void *param);
 
 static void _bc_lp8_task_measure(void *param);
 
-static uint16_t _bc_lp8_calculate_crc16(uint8_t *buffer, uint8_t length);
-
 void bc_lp8_init(bc_lp8_t *self, const bc_lp8_driver_t *driver)
 {
     memset(self, 0, sizeof(*self));
@@ -268,7 +267,7 @@ start:
                 self->_tx_buffer[29] = self->_pressure >> 8;
                 self->_tx_buffer[30] = self->_pressure;
 
-                crc16 = _bc_lp8_calculate_crc16(self->_tx_buffer, 31);
+                crc16 = bc_crc16_ibm(self->_tx_buffer, 31, 0xffff);
 
                 self->_tx_buffer[31] = crc16;
                 self->_tx_buffer[32] = crc16 >> 8;
@@ -327,7 +326,7 @@ start:
                     goto start;
                 }
 
-                if (_bc_lp8_calculate_crc16(self->_rx_buffer, 4) != 0)
+                if (bc_crc16_ibm(self->_rx_buffer, 4, 0xffff) != 0)
                 {
                     _bc_lp8_error(self, BC_LP8_ERROR_BOOT_READ_CRC);
 
@@ -387,7 +386,7 @@ start:
             self->_tx_buffer[3] = 0x80;
             self->_tx_buffer[4] = 0x2c;
 
-            uint16_t crc16 = _bc_lp8_calculate_crc16(self->_tx_buffer, 5);
+            uint16_t crc16 = bc_crc16_ibm(self->_tx_buffer, 5, 0xffff);
 
             self->_tx_buffer[5] = crc16;
             self->_tx_buffer[6] = crc16 >> 8;
@@ -450,7 +449,7 @@ start:
                     goto start;
                 }
 
-                if (_bc_lp8_calculate_crc16(self->_rx_buffer, 49) != 0)
+                if (bc_crc16_ibm(self->_rx_buffer, 49, 0xffff) != 0)
                 {
                     _bc_lp8_error(self, BC_LP8_ERROR_MEASURE_READ_CRC);
 
@@ -533,28 +532,3 @@ start:
         }
     }
 }
-
-static uint16_t _bc_lp8_calculate_crc16(uint8_t *buffer, uint8_t length)
-{
-    uint16_t crc16;
-
-    for (crc16 = 0xffff; length != 0; length--, buffer++)
-    {
-        crc16 ^= *buffer;
-
-        for (int i = 0; i < 8; i++)
-        {
-            if ((crc16 & 1) != 0)
-            {
-                crc16 >>= 1;
-                crc16 ^= 0xa001;
-            }
-            else
-            {
-                crc16 >>= 1;
-            }
-        }
-    }
-
-    return crc16;
-}
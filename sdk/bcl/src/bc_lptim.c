@@ -0,0 +1,119 @@
+#include <bc_lptim.h>
+#include <bc_irq.h>
+#include <stm32l0xx.h>
+
+static struct
+{
+    bool initialized;
+    void (*callback)(void *);
+    void *param;
+
+} _bc_lptim;
+
+void bc_lptim_init(void)
+{
+    if (_bc_lptim.initialized)
+    {
+        return;
+    }
+
+    _bc_lptim.initialized = true;
+
+    // LSE oscillator clock used as LPTIM1 clock (it is enabled by RTC)
+    RCC->CCIPR |= RCC_CCIPR_LPTIM1SEL_0 | RCC_CCIPR_LPTIM1SEL_1;
+
+    // Enable LPTIM1 clock
+    RCC->APB1ENR |= RCC_APB1ENR_LPTIM1EN;
+
+    // Errata workaround
+    RCC->APB1ENR;
+
+    // Prescaler 32 (32768 Hz / 32 = 1024 Hz)
+    LPTIM1->CFGR = LPTIM_CFGR_PRESC_2 | LPTIM_CFGR_PRESC_0;
+
+    // Enable compare match interrupt
+    LPTIM1->IER = LPTIM_IER_CMPMIE;
+
+    // Enable timer
+    LPTIM1->CR = LPTIM_CR_ENABLE;
+
+    // Counter is free running over full 16-bit range
+    LPTIM1->ARR = 0xffff;
+
+    while ((LPTIM1->ISR & LPTIM_ISR_ARROK) == 0)
+    {
+        continue;
+    }
+
+    LPTIM1->ICR = LPTIM_ICR_ARROKCF;
+
+    // Start timer in continuous mode
+    LPTIM1->CR |= LPTIM_CR_CNTSTRT;
+
+    // LPTIM1 IRQ wakes up MCU from stop mode through EXTI
+    EXTI->IMR |= EXTI_IMR_IM29;
+
+    NVIC_EnableIRQ(LPTIM1_IRQn);
+}
+
+uint16_t bc_lptim_get_counter(void)
+{
+    uint16_t counter;
+
+    // Counter is asynchronous to APB clock, read it until two reads match
+    do
+    {
+        counter = LPTIM1->CNT;
+
+    } while (counter != LPTIM1->CNT);
+
+    return counter;
+}
+
+void bc_lptim_set_alarm(uint16_t counter, void (*callback)(void *), void *param)
+{
+    // Previous alarm must not fire with the new callback
+    bc_lptim_clear_alarm();
+
+    LPTIM1->CMP = counter;
+
+    while ((LPTIM1->ISR & LPTIM_ISR_CMPOK) == 0)
+    {
+        continue;
+    }
+
+    LPTIM1->ICR = LPTIM_ICR_CMPOKCF | LPTIM_ICR_CMPMCF;
+
+    bc_irq_disable();
+
+    _bc_lptim.callback = callback;
+    _bc_lptim.param = param;
+
+    bc_irq_enable();
+}
+
+void bc_lptim_clear_alarm(void)
+{
+    bc_irq_disable();
+
+    _bc_lptim.callback = NULL;
+
+    bc_irq_enable();
+}
+
+void LPTIM1_IRQHandler(void)
+{
+    if ((LPTIM1->ISR & LPTIM_ISR_CMPM) != 0)
+    {
+        LPTIM1->ICR = LPTIM_ICR_CMPMCF;
+
+        void (*callback)(void *) = _bc_lptim.callback;
+
+        _bc_lptim.callback = NULL;
+
+        if (callback != NULL)
+        {
+            callback(_bc_lptim.param);
+        }
+    }
+}
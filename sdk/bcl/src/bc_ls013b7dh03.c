@@ -2,8 +2,14 @@
 #include <bc_spi.h>
 
 #define _BC_LS013B7DH03_VCOM_PERIOD 15000
+#define _BC_LS013B7DH03_LINE_SIZE 18
 
 static void _bc_ls013b7dh03_task(void *param);
+static bool _bc_ls013b7dh03_update_lines(bc_ls013b7dh03_t *self, bool first_run);
+static void _bc_ls013b7dh03_update_abort(bc_ls013b7dh03_t *self);
+static inline void _bc_ls013b7dh03_set_dirty(bc_ls013b7dh03_t *self, int line);
+static inline bool _bc_ls013b7dh03_is_dirty(bc_ls013b7dh03_t *self, int line);
+static inline uint8_t _bc_ls013b7dh03_merge(uint8_t *byte, uint8_t mask, uint8_t value);
 static bool _bc_ls013b7dh03_spi_transfer(bc_ls013b7dh03_t *self, uint8_t *buffer, size_t length);
 static void _bc_ls013b7dh03_spi_event_handler(bc_spi_event_t event, void *event_param);
 static inline uint8_t _bc_ls013b7dh03_reverse(uint8_t b);
@@ -14,6 +20,9 @@ void bc_ls013b7dh03_init(bc_ls013b7dh03_t *self, bool (*pin_cs_set)(bool state))
 
     self->_vcom = 0;
     self->_pin_cs_set = pin_cs_set;
+    self->_update_in_progress = false;
+
+    // All lines are dirty (_dirty is filled by memset), so the first update sends full frame
 
     bc_spi_init(BC_SPI_SPEED_1_MHZ, BC_SPI_MODE_0);
 
@@ -42,9 +51,7 @@ bc_gfx_caps_t bc_ls013b7dh03_get_caps(bc_ls013b7dh03_t *self)
 
 bool bc_ls013b7dh03_is_ready(bc_ls013b7dh03_t *self)
 {
-    (void) self;
-
-    return bc_spi_is_ready();
+    return bc_spi_is_ready() && !self->_update_in_progress;
 }
 
 void bc_ls013b7dh03_clear(bc_ls013b7dh03_t *self)
@@ -52,11 +59,16 @@ void bc_ls013b7dh03_clear(bc_ls013b7dh03_t *self)
     uint8_t line;
     uint32_t offs;
     uint8_t col;
-    for (line = 0x01, offs = 2; line <= 128; line++, offs += 18)
+    for (line = 0x00, offs = 2; line < 128; line++, offs += 18)
     {
         for (col = 0; col < 16; col++)
         {
-            self->_framebuffer[offs + col] = 0xff;
+            if (self->_framebuffer[offs + col] != 0xff)
+            {
+                self->_framebuffer[offs + col] = 0xff;
+
+                _bc_ls013b7dh03_set_dirty(self, line);
+            }
         }
     }
 }
@@ -72,6 +84,8 @@ void bc_ls013b7dh03_draw_pixel(bc_ls013b7dh03_t *self, int x, int y, uint32_t co
 
     uint8_t bitMask = 1 << (7 - (x % 8));
 
+    uint8_t byte = self->_framebuffer[byteIndex];
+
     if (color == 0)
     {
         self->_framebuffer[byteIndex] |= bitMask;
@@ -80,6 +94,11 @@ void bc_ls013b7dh03_draw_pixel(bc_ls013b7dh03_t *self, int x, int y, uint32_t co
     {
         self->_framebuffer[byteIndex] &= ~bitMask;
     }
+
+    if (self->_framebuffer[byteIndex] != byte)
+    {
+        _bc_ls013b7dh03_set_dirty(self, y);
+    }
 }
 
 uint32_t bc_ls013b7dh03_get_pixel(bc_ls013b7dh03_t *self, int x, int y)
@@ -94,6 +113,151 @@ uint32_t bc_ls013b7dh03_get_pixel(bc_ls013b7dh03_t *self, int x, int y)
     return (self->_framebuffer[byteIndex] >> (7 - (x % 8))) & 1;
 }
 
+void bc_ls013b7dh03_blit_mono(bc_ls013b7dh03_t *self, int left, int top, const uint8_t *image, int width, int height, uint32_t color)
+{
+    int bytes = (width + 7) / 8;
+    int shift = left % 8;
+
+    // Pixels beyond width in the last byte of image row
+    uint8_t last_mask = 0xff << ((8 - width % 8) % 8);
+
+    for (int y = 0; y < height; y++)
+    {
+        // Skip mode byte + addr byte, skip lines, select column byte
+        uint8_t *line = &self->_framebuffer[2 + (top + y) * 18 + left / 8];
+
+        uint8_t changed = 0;
+
+        for (int i = 0; i < bytes; i++)
+        {
+            // Bits of pixels which are drawn, framebuffer has cleared bits for black pixels
+            uint8_t bits = ~image[y * bytes + i];
+
+            if (i == bytes - 1)
+            {
+                bits &= last_mask;
+            }
+
+            uint8_t first = bits >> shift;
+            uint8_t second = bits << (8 - shift);
+
+            if (color == 0)
+            {
+                changed |= first & ~line[i];
+                line[i] |= first;
+            }
+            else
+            {
+                changed |= first & line[i];
+                line[i] &= ~first;
+            }
+
+            // Image fits into display, so the second byte exists whenever it has bits to draw
+            if (second != 0)
+            {
+                if (color == 0)
+                {
+                    changed |= second & ~line[i + 1];
+                    line[i + 1] |= second;
+                }
+                else
+                {
+                    changed |= second & line[i + 1];
+                    line[i + 1] &= ~second;
+                }
+            }
+        }
+
+        if (changed != 0)
+        {
+            _bc_ls013b7dh03_set_dirty(self, top + y);
+        }
+    }
+}
+
+void bc_ls013b7dh03_draw_hspan(bc_ls013b7dh03_t *self, int left, int top, int width, uint32_t color)
+{
+    int right = left + width - 1;
+
+    // Skip mode byte + addr byte, skip lines
+    uint8_t *line = &self->_framebuffer[2 + top * _BC_LS013B7DH03_LINE_SIZE];
+
+    // Framebuffer has cleared bits for black pixels
+    uint8_t value = color == 0 ? 0xff : 0x00;
+
+    uint8_t first_mask = 0xff >> (left % 8);
+    uint8_t last_mask = 0xff << (7 - right % 8);
+
+    uint8_t changed;
+
+    if (left / 8 == right / 8)
+    {
+        changed = _bc_ls013b7dh03_merge(&line[left / 8], first_mask & last_mask, value);
+    }
+    else
+    {
+        changed = _bc_ls013b7dh03_merge(&line[left / 8], first_mask, value);
+
+        for (int i = left / 8 + 1; i < right / 8; i++)
+        {
+            changed |= _bc_ls013b7dh03_merge(&line[i], 0xff, value);
+        }
+
+        changed |= _bc_ls013b7dh03_merge(&line[right / 8], last_mask, value);
+    }
+
+    if (changed != 0)
+    {
+        _bc_ls013b7dh03_set_dirty(self, top);
+    }
+}
+
+void bc_ls013b7dh03_fill_rect(bc_ls013b7dh03_t *self, int left, int top, int width, int height, uint32_t color)
+{
+    for (int y = top; y < top + height; y++)
+    {
+        bc_ls013b7dh03_draw_hspan(self, left, y, width, color);
+    }
+}
+
+void bc_ls013b7dh03_blit(bc_ls013b7dh03_t *self, int left, int top, const uint8_t *image, int width, int height)
+{
+    int bytes = (width + 7) / 8;
+    int shift = left % 8;
+
+    // Pixels in the last byte of image row
+    uint8_t last_mask = 0xff << ((8 - width % 8) % 8);
+
+    for (int y = 0; y < height; y++)
+    {
+        // Skip mode byte + addr byte, skip lines, select column byte
+        uint8_t *line = &self->_framebuffer[2 + (top + y) * _BC_LS013B7DH03_LINE_SIZE + left / 8];
+
+        uint8_t changed = 0;
+
+        for (int i = 0; i < bytes; i++)
+        {
+            uint8_t mask = i == bytes - 1 ? last_mask : 0xff;
+
+            // Image is LSB first with set bits for black pixels, framebuffer is MSB first with cleared ones
+            uint8_t value = ~_bc_ls013b7dh03_reverse(image[y * bytes + i]);
+
+            changed |= _bc_ls013b7dh03_merge(&line[i], mask >> shift, value >> shift);
+
+            // Image fits into display, so the second byte exists whenever it has bits to draw
+            if ((uint8_t) (mask << (8 - shift)) != 0)
+            {
+                changed |= _bc_ls013b7dh03_merge(&line[i + 1], mask << (8 - shift), value << (8 - shift));
+            }
+        }
+
+        if (changed != 0)
+        {
+            _bc_ls013b7dh03_set_dirty(self, top + y);
+        }
+    }
+}
+
 /*
 
 Framebuffer format for updating multiple lines, ideal for later DMA TX:
@@ -102,22 +266,55 @@ Framebuffer format for updating multiple lines, ideal for later DMA TX:
 ||        1B        ||   1B |  16B |  1B   ||   1B |  16B |  1B   |
 ||  M0 M1 M2  DUMMY || ADDR | DATA | DUMMY || ADDR | DATA | DUMMY |
 
+Every line carries its address, so modified lines are sent in one chip select window as runs of consecutive
+lines, one DMA transfer per run. MODE byte is placed in DUMMY of the line in front of the first run and ADDR of
+the line behind the last run is zeroed for the final DUMMY byte while it is transferred.
+
 */
 bool bc_ls013b7dh03_update(bc_ls013b7dh03_t *self)
 {
-    if (bc_spi_is_ready())
+    if (bc_spi_is_ready() && !self->_update_in_progress)
     {
+        int dirty = 0;
+        int first = -1;
+
+        for (int line = 0; line < BC_LS013B7DH03_HEIGHT; line++)
+        {
+            if (_bc_ls013b7dh03_is_dirty(self, line))
+            {
+                first = first < 0 ? line : first;
+
+                dirty++;
+            }
+        }
+
+        // Display memory holds the frame, there is nothing to send
+        if (dirty == 0)
+        {
+            return true;
+        }
+
         if (!self->_pin_cs_set(0))
         {
             return false;
         }
 
-        self->_framebuffer[0] = 0x80 | self->_vcom;
-
-        if (!bc_spi_async_transfer(self->_framebuffer, NULL, BC_LS013B7DH03_FRAMEBUFFER_SIZE, _bc_ls013b7dh03_spi_event_handler, self))
+        // Full frame is sent in one transfer when most of lines are dirty
+        if (dirty > BC_LS013B7DH03_HEIGHT / 2)
         {
-            self->_pin_cs_set(1);
+            first = 0;
+
+            memset(self->_dirty, 0xff, sizeof(self->_dirty));
+        }
 
+        // MODE byte goes in front of ADDR of the first line
+        self->_framebuffer[first * _BC_LS013B7DH03_LINE_SIZE] = 0x80 | self->_vcom;
+
+        self->_update_line = first;
+        self->_update_in_progress = true;
+
+        if (!_bc_ls013b7dh03_update_lines(self, true))
+        {
             return false;
         }
 
@@ -140,7 +337,11 @@ const bc_gfx_driver_t *bc_ls013b7dh03_get_driver(void)
         .draw_pixel = (void (*)(void *, int, int, uint32_t)) bc_ls013b7dh03_draw_pixel,
         .get_pixel = (uint32_t (*)(void *, int, int)) bc_ls013b7dh03_get_pixel,
         .update = (bool (*)(void *)) bc_ls013b7dh03_update,
-        .get_caps = (bc_gfx_caps_t (*)(void *)) bc_ls013b7dh03_get_caps
+        .get_caps = (bc_gfx_caps_t (*)(void *)) bc_ls013b7dh03_get_caps,
+        .blit_mono = (void (*)(void *, int, int, const uint8_t *, int, int, uint32_t)) bc_ls013b7dh03_blit_mono,
+        .draw_hspan = (void (*)(void *, int, int, int, uint32_t)) bc_ls013b7dh03_draw_hspan,
+        .fill_rect = (void (*)(void *, int, int, int, int, uint32_t)) bc_ls013b7dh03_fill_rect,
+        .blit = (void (*)(void *, int, int, const uint8_t *, int, int)) bc_ls013b7dh03_blit
     };
 
     return &driver;
@@ -150,6 +351,14 @@ bool bc_ls013b7dh03_clear_memory_command(bc_ls013b7dh03_t *self)
 {
     uint8_t spi_data[2] = { 0x20, 0x00 };
 
+    if (self->_update_in_progress)
+    {
+        return false;
+    }
+
+    // Framebuffer differs from cleared display memory
+    memset(self->_dirty, 0xff, sizeof(self->_dirty));
+
     return _bc_ls013b7dh03_spi_transfer(self, spi_data, sizeof(spi_data));
 }
 
@@ -157,6 +366,16 @@ static void _bc_ls013b7dh03_task(void *param)
 {
     bc_ls013b7dh03_t *self = (bc_ls013b7dh03_t *) param;
 
+    if (self->_update_in_progress)
+    {
+        // Next run of modified lines
+        _bc_ls013b7dh03_update_lines(self, false);
+
+        bc_scheduler_plan_current_from_now(_BC_LS013B7DH03_VCOM_PERIOD);
+
+        return;
+    }
+
     uint8_t spi_data[2] = {self->_vcom, 0x00};
 
     if (_bc_ls013b7dh03_spi_transfer(self, spi_data, sizeof(spi_data)))
@@ -186,16 +405,119 @@ static bool _bc_ls013b7dh03_spi_transfer(bc_ls013b7dh03_t *self, uint8_t *buffer
     return spi_state;
 }
 
+static bool _bc_ls013b7dh03_update_lines(bc_ls013b7dh03_t *self, bool first_run)
+{
+    int first = self->_update_line;
+    int end = first;
+
+    // Run of consecutive dirty lines, they are clean from now on
+    while (end < BC_LS013B7DH03_HEIGHT && _bc_ls013b7dh03_is_dirty(self, end))
+    {
+        self->_dirty[end / 32] &= ~(1UL << (end % 32));
+
+        end++;
+    }
+
+    // Start of the next run
+    int next = end;
+
+    while (next < BC_LS013B7DH03_HEIGHT && !_bc_ls013b7dh03_is_dirty(self, next))
+    {
+        next++;
+    }
+
+    self->_update_line = next;
+
+    size_t offset = 1 + first * _BC_LS013B7DH03_LINE_SIZE;
+    size_t length = (end - first) * _BC_LS013B7DH03_LINE_SIZE;
+
+    // The first run starts with MODE byte
+    if (first_run)
+    {
+        offset--;
+        length++;
+    }
+
+    // The last run ends with DUMMY byte
+    if (next == BC_LS013B7DH03_HEIGHT)
+    {
+        self->_update_trailer = 1 + end * _BC_LS013B7DH03_LINE_SIZE;
+        self->_update_trailer_value = self->_framebuffer[self->_update_trailer];
+        self->_framebuffer[self->_update_trailer] = 0x00;
+
+        length++;
+    }
+
+    if (!bc_spi_async_transfer(&self->_framebuffer[offset], NULL, length, _bc_ls013b7dh03_spi_event_handler, self))
+    {
+        _bc_ls013b7dh03_update_abort(self);
+
+        return false;
+    }
+
+    return true;
+}
+
+static void _bc_ls013b7dh03_update_abort(bc_ls013b7dh03_t *self)
+{
+    if (self->_update_line == BC_LS013B7DH03_HEIGHT)
+    {
+        self->_framebuffer[self->_update_trailer] = self->_update_trailer_value;
+    }
+
+    // Lines which have not been sent are unknown, so everything is sent next time
+    memset(self->_dirty, 0xff, sizeof(self->_dirty));
+
+    self->_pin_cs_set(1);
+
+    self->_update_in_progress = false;
+}
+
 static void _bc_ls013b7dh03_spi_event_handler(bc_spi_event_t event, void *event_param)
 {
     bc_ls013b7dh03_t *self = (bc_ls013b7dh03_t *) event_param;
 
     if (event == BC_SPI_EVENT_DONE)
     {
+        if (self->_update_in_progress)
+        {
+            if (self->_update_line < BC_LS013B7DH03_HEIGHT)
+            {
+                // Chip select stays active, the next run is transferred from task
+                bc_scheduler_plan_now(self->_task_id);
+
+                return;
+            }
+
+            self->_framebuffer[self->_update_trailer] = self->_update_trailer_value;
+
+            self->_update_in_progress = false;
+        }
+
         self->_pin_cs_set(1);
     }
 }
 
+static inline void _bc_ls013b7dh03_set_dirty(bc_ls013b7dh03_t *self, int line)
+{
+    self->_dirty[line / 32] |= 1UL << (line % 32);
+}
+
+static inline bool _bc_ls013b7dh03_is_dirty(bc_ls013b7dh03_t *self, int line)
+{
+    return (self->_dirty[line / 32] & (1UL << (line % 32))) != 0;
+}
+
+static inline uint8_t _bc_ls013b7dh03_merge(uint8_t *byte, uint8_t mask, uint8_t value)
+{
+    uint8_t old = *byte;
+
+    *byte = (old & ~mask) | (value & mask);
+
+    // Bits which have been changed
+    return old ^ *byte;
+}
+
 static inline uint8_t _bc_ls013b7dh03_reverse(uint8_t b)
 {
    b = (b & 0xf0) >> 4 | (b & 0x0f) << 4;
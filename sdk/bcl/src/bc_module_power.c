@@ -5,21 +5,21 @@
 
 #define BC_MODULE_POWER_PIN_RELAY BC_GPIO_P0
 
-static uint32_t _bc_module_power_led_strip_dma_buffer_rgbw_144[144 * 4 * 2];
-static uint32_t _bc_module_power_led_strip_dma_buffer_rgb_150[150 * 3 * 2];
+static uint32_t _bc_module_power_led_strip_buffer_rgbw_144[144 * 4 / 4];
+static uint32_t _bc_module_power_led_strip_buffer_rgb_150[150 * 3 / 4 + 1];
 
 const bc_led_strip_buffer_t bc_module_power_led_strip_buffer_rgbw_144 =
 {
     .type = BC_LED_STRIP_TYPE_RGBW,
     .count = 144,
-    .buffer = _bc_module_power_led_strip_dma_buffer_rgbw_144
+    .buffer = _bc_module_power_led_strip_buffer_rgbw_144
 };
 
 const bc_led_strip_buffer_t bc_module_power_led_strip_buffer_rgb_150 =
 {
     .type = BC_LED_STRIP_TYPE_RGB,
     .count = 150,
-    .buffer = _bc_module_power_led_strip_dma_buffer_rgb_150
+    .buffer = _bc_module_power_led_strip_buffer_rgb_150
 };
 
 #if LED_STRIP_SWAP_RG == 0
@@ -1,6 +1,7 @@
 #include <bc_module_sensor.h>
 #include <bc_tca9534a.h>
 #include <bc_onewire.h>
+#include <bc_energy.h>
 
 #define _BC_MODULE_SENSOR_INITIALIZED_STATE 0xff
 #define _BC_MODULE_SENSOR_INITIALIZED_DIRECTION 0x00
@@ -295,6 +296,8 @@ bool bc_module_sensor_onewire_power_up(void)
 
     _bc_module_sensor.onewire_init_semaphore++;
 
+    bc_energy_set_state(BC_ENERGY_SUBSYSTEM_ONEWIRE, true);
+
     return true;
 }
 
@@ -304,6 +307,8 @@ bool bc_module_sensor_onewire_power_down(void)
 
     if (_bc_module_sensor.onewire_init_semaphore == 0)
     {
+        bc_energy_set_state(BC_ENERGY_SUBSYSTEM_ONEWIRE, false);
+
         if (bc_module_sensor_get_revision() == BC_MODULE_SENSOR_REVISION_R1_1)
         {
             if (!bc_module_sensor_set_vdd(0))
@@ -3,11 +3,157 @@
 #include <bc_onewire.h>
 #include <bc_system.h>
 #include <bc_timer.h>
+#include <bc_dma.h>
+#include <bc_scheduler.h>
+#include <bc_crc.h>
+
+// Maximal number of bytes generated by one run of DMA, longer transfers are split
+#define _BC_ONEWIRE_ASYNC_CHUNK 8
+// Asynchronous transfer is aborted when it takes longer (ms)
+#define _BC_ONEWIRE_ASYNC_TIMEOUT 20
+// Polled read is aborted when device stays busy longer (ms)
+#define _BC_ONEWIRE_ASYNC_POLL_TIMEOUT 50
+// TIM2 is clocked from PLL during asynchronous transfer
+#define _BC_ONEWIRE_ASYNC_TICKS_PER_US 32
+// Bus rise time before sampling, about 0.4 us at 32 MHz (overdrive sample must be within 2 us from slot start)
+#define _BC_ONEWIRE_RISE_DELAY() do { __NOP(); __NOP(); __NOP(); __NOP(); __NOP(); __NOP(); \
+        __NOP(); __NOP(); __NOP(); __NOP(); __NOP(); __NOP(); } while (0)
+
+typedef struct
+{
+    uint16_t reset_low;
+    uint16_t reset_presence;
+    uint16_t reset_tail;
+    uint16_t write_1_low;
+    uint16_t write_1_high;
+    uint16_t write_0_low;
+    uint16_t write_0_high;
+    uint16_t read_low;
+    uint16_t read_sample;
+    uint16_t read_tail;
+
+} _bc_onewire_timing_t;
+
+// Slot timing in microseconds, sample is taken after rise delay which follows release of bus
+static const _bc_onewire_timing_t _bc_onewire_timing_lut[2] =
+{
+    [BC_ONEWIRE_SPEED_STANDARD] =
+    {
+        .reset_low = 480,
+        .reset_presence = 70,
+        .reset_tail = 410,
+        .write_1_low = 3,
+        .write_1_high = 60,
+        .write_0_low = 55,
+        .write_0_high = 8,
+        .read_low = 3,
+        .read_sample = 8,
+        .read_tail = 50
+    },
+    [BC_ONEWIRE_SPEED_OVERDRIVE] =
+    {
+        .reset_low = 70,
+        .reset_presence = 8,
+        .reset_tail = 40,
+        .write_1_low = 1,
+        .write_1_high = 8,
+        .write_0_low = 8,
+        .write_0_high = 3,
+        .read_low = 1,
+        .read_sample = 0,
+        .read_tail = 7
+    }
+};
+
+typedef struct
+{
+    GPIO_TypeDef *port;
+    uint32_t input_mask;
+    uint32_t moder_mask;
+    uint32_t moder_output;
+
+} _bc_onewire_pin_t;
+
+typedef struct
+{
+    uint16_t reset_low;
+    uint16_t reset_slot;
+    uint16_t reset_sample;
+    uint16_t slot;
+    uint16_t write_1_low;
+    uint16_t write_0_low;
+    uint16_t read_low;
+    uint16_t read_sample;
+
+} _bc_onewire_async_timing_t;
+
+// Slot timing of asynchronous transfers in microseconds, low pulses and slot lengths are generated by timer,
+// samples are times of rising edge captured from slot start
+static const _bc_onewire_async_timing_t _bc_onewire_async_timing_lut[2] =
+{
+    [BC_ONEWIRE_SPEED_STANDARD] =
+    {
+        .reset_low = 480,
+        .reset_slot = 960,
+        .reset_sample = 30,
+        .slot = 70,
+        .write_1_low = 6,
+        .write_0_low = 60,
+        .read_low = 6,
+        .read_sample = 15
+    },
+    [BC_ONEWIRE_SPEED_OVERDRIVE] =
+    {
+        .reset_low = 70,
+        .reset_slot = 140,
+        .reset_sample = 5,
+        .slot = 10,
+        .write_1_low = 1,
+        .write_0_low = 8,
+        .read_low = 1,
+        .read_sample = 2
+    }
+};
+
+typedef enum
+{
+    _BC_ONEWIRE_ASYNC_RESET = 0,
+    _BC_ONEWIRE_ASYNC_WRITE = 1,
+    _BC_ONEWIRE_ASYNC_READ = 2,
+    _BC_ONEWIRE_ASYNC_POLL_READ = 3
+
+} _bc_onewire_async_operation_t;
+
+typedef struct
+{
+    bool busy;
+    bc_gpio_channel_t channel;
+    _bc_onewire_async_operation_t operation;
+    const _bc_onewire_async_timing_t *timing;
+    uint8_t *buffer;
+    size_t bits;
+    size_t offset;
+    size_t chunk;
+    bool polling;
+    void (*callback)(bc_onewire_async_event_t, void *);
+    void *param;
+    bc_scheduler_task_id_t task_id;
+
+    // Compare values of slots and two idle slots at the end
+    uint16_t slot[_BC_ONEWIRE_ASYNC_CHUNK * 8 + 2];
+    uint16_t capture[_BC_ONEWIRE_ASYNC_CHUNK * 8];
+
+} _bc_onewire_async_t;
 
 typedef struct
 {
     bool initialized;
 
+    // Bit mask of GPIO channels whose devices are switched to overdrive speed
+    uint32_t overdrive;
+
+    _bc_onewire_async_t async;
+
     uint8_t last_discrepancy;
     uint8_t last_family_discrepancy;
     bool last_device_flag;
@@ -21,16 +167,27 @@ typedef struct
 
 static _bc_onewire_t _bc_onewire = { .initialized = false };
 
+extern GPIO_TypeDef * const bc_gpio_port[];
+extern const uint16_t bc_gpio_16_bit_mask[];
+
 static bool _bc_onewire_reset(bc_gpio_channel_t channel);
 static void _bc_onewire_write_byte(bc_gpio_channel_t channel, uint8_t byte);
 static uint8_t _bc_onewire_read_byte(bc_gpio_channel_t channel);
 static void _bc_onewire_write_bit(bc_gpio_channel_t channel, uint8_t bit);
 static uint8_t _bc_onewire_read_bit(bc_gpio_channel_t channel);
+static void _bc_onewire_pin_init(bc_gpio_channel_t channel, _bc_onewire_pin_t *pin);
+static uint16_t _bc_onewire_slot_start(void);
+static void _bc_onewire_slot_wait(uint16_t start, uint16_t microseconds);
 static void _bc_onewire_start(void);
 static void _bc_onewire_stop(void);
 static void _bc_onewire_search_reset(void);
 static void _bc_onewire_search_target_setup(uint8_t family_code);
 static int _bc_onewire_search_devices(bc_gpio_channel_t channel, uint64_t *device_list, size_t device_list_size);
+static bool _bc_onewire_async_start(bc_gpio_channel_t channel, _bc_onewire_async_operation_t operation, void *buffer, size_t bits, void (*callback)(bc_onewire_async_event_t, void *), void *param);
+static void _bc_onewire_async_run(void);
+static void _bc_onewire_async_finish(bc_onewire_async_event_t event);
+static void _bc_onewire_async_dma_event_handler(bc_dma_channel_t channel, bc_dma_event_t event, void *event_param);
+static void _bc_onewire_async_task_timeout(void *param);
 
 void bc_onewire_init(bc_gpio_channel_t channel)
 {
@@ -38,6 +195,8 @@ void bc_onewire_init(bc_gpio_channel_t channel)
     {
         memset(&_bc_onewire, 0, sizeof(_bc_onewire));
 
+        _bc_onewire.async.task_id = bc_scheduler_register(_bc_onewire_async_task_timeout, NULL, BC_TICK_INFINITY);
+
         _bc_onewire.initialized = true;
     }
 
@@ -50,7 +209,7 @@ void bc_onewire_init(bc_gpio_channel_t channel)
 
 bool bc_onewire_transaction_start(bc_gpio_channel_t channel)
 {
-	if (_bc_onewire.transaction)
+	if (_bc_onewire.transaction || _bc_onewire.async.busy)
 	{
         return false;
 	}
@@ -122,6 +281,13 @@ void bc_onewire_select(bc_gpio_channel_t channel, uint64_t *device_number)
     _bc_onewire_stop();
 }
 
+void bc_onewire_resume(bc_gpio_channel_t channel)
+{
+    _bc_onewire_start();
+    _bc_onewire_write_byte(channel, 0xA5);
+    _bc_onewire_stop();
+}
+
 void bc_onewire_skip_rom(bc_gpio_channel_t channel)
 {
     _bc_onewire_start();
@@ -129,6 +295,72 @@ void bc_onewire_skip_rom(bc_gpio_channel_t channel)
     _bc_onewire_stop();
 }
 
+bool bc_onewire_overdrive_select(bc_gpio_channel_t channel, uint64_t *device_number)
+{
+    bool state;
+
+    _bc_onewire_start();
+
+    // Standard reset puts all devices to standard speed
+    bc_onewire_set_speed(channel, BC_ONEWIRE_SPEED_STANDARD);
+
+    if (!_bc_onewire_reset(channel))
+    {
+        _bc_onewire_stop();
+
+        return false;
+    }
+
+    if (*device_number == BC_ONEWIRE_DEVICE_NUMBER_SKIP_ROM)
+    {
+        _bc_onewire_write_byte(channel, 0x3C);
+
+        bc_onewire_set_speed(channel, BC_ONEWIRE_SPEED_OVERDRIVE);
+    }
+    else
+    {
+        _bc_onewire_write_byte(channel, 0x69);
+
+        // Device number is already sent at overdrive speed
+        bc_onewire_set_speed(channel, BC_ONEWIRE_SPEED_OVERDRIVE);
+
+        for (size_t i = 0; i < sizeof(uint64_t); i++)
+        {
+            _bc_onewire_write_byte(channel, ((uint8_t *) device_number)[i]);
+        }
+    }
+
+    state = _bc_onewire_reset(channel);
+
+    if (!state)
+    {
+        bc_onewire_set_speed(channel, BC_ONEWIRE_SPEED_STANDARD);
+
+        _bc_onewire_reset(channel);
+    }
+
+    _bc_onewire_stop();
+
+    return state;
+}
+
+void bc_onewire_set_speed(bc_gpio_channel_t channel, bc_onewire_speed_t speed)
+{
+    if (speed == BC_ONEWIRE_SPEED_OVERDRIVE)
+    {
+        _bc_onewire.overdrive |= 1UL << channel;
+    }
+    else
+    {
+        _bc_onewire.overdrive &= ~(1UL << channel);
+    }
+}
+
+bc_onewire_speed_t bc_onewire_get_speed(bc_gpio_channel_t channel)
+{
+    return (_bc_onewire.overdrive & (1UL << channel)) != 0 ? BC_ONEWIRE_SPEED_OVERDRIVE : BC_ONEWIRE_SPEED_STANDARD;
+}
+
 void bc_onewire_write(bc_gpio_channel_t channel, const void *buffer, size_t length)
 {
     _bc_onewire_start();
@@ -196,55 +428,21 @@ int bc_onewire_search_family(bc_gpio_channel_t channel, uint8_t family_code, uin
 
 uint8_t bc_onewire_crc8(const void *buffer, size_t length, uint8_t crc)
 {
-    uint8_t *_buffer = (uint8_t *) buffer;
-    uint8_t inbyte;
-    uint8_t i;
-
-    while (length--)
-    {
-        inbyte = *_buffer++;
-        for (i = 8; i; i--)
-        {
-            if ((crc ^ inbyte) & 0x01)
-            {
-                crc >>= 1;
-                crc ^= 0x8C;
-            }
-            else
-            {
-                crc >>= 1;
-            }
-            inbyte >>= 1;
-        }
-    }
-
-    return crc;
+    return bc_crc8_maxim(buffer, length, crc);
 }
 
 uint16_t bc_onewire_crc16(const void *buffer, size_t length, uint16_t crc)
 {
-    static const uint8_t oddparity[16] =
-    { 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0 };
-
-    uint16_t i;
-    for (i = 0; i < length; i++)
-    {
-        uint16_t cdata = ((uint8_t *) buffer)[i];
-        cdata = (cdata ^ crc) & 0xff;
-        crc >>= 8;
-
-        if (oddparity[cdata & 0x0F] ^ oddparity[cdata >> 4]) crc ^= 0xC001;
-
-        cdata <<= 6;
-        crc ^= cdata;
-        cdata <<= 1;
-        crc ^= cdata;
-    }
-    return crc;
+    return bc_crc16_ibm(buffer, length, crc);
 }
 
 static bool _bc_onewire_reset(bc_gpio_channel_t channel)
 {
+    bc_onewire_speed_t speed = bc_onewire_get_speed(channel);
+    const _bc_onewire_timing_t *timing = &_bc_onewire_timing_lut[speed];
+
+    _bc_onewire_pin_t pin;
+    uint16_t start;
     int i;
     uint8_t retries = 125;
 
@@ -261,16 +459,38 @@ static bool _bc_onewire_reset(bc_gpio_channel_t channel)
     while (bc_gpio_get_input(channel) == 0);
 
     bc_gpio_set_output(channel, 0);
-    bc_gpio_set_mode(channel, BC_GPIO_MODE_OUTPUT);
 
-    bc_timer_delay(480);
+    // Overdrive reset pulse must not be longer than 80 us, so it is not interrupted
+    bc_irq_disable();
 
-    bc_gpio_set_mode(channel, BC_GPIO_MODE_INPUT);
-    bc_timer_delay(70);
+    _bc_onewire_pin_init(channel, &pin);
+
+    start = _bc_onewire_slot_start();
+
+    pin.port->MODER = pin.moder_output;
+
+    if (speed == BC_ONEWIRE_SPEED_STANDARD)
+    {
+        bc_irq_enable();
+
+        _bc_onewire_slot_wait(start, timing->reset_low);
+
+        bc_irq_disable();
+    }
+    else
+    {
+        _bc_onewire_slot_wait(start, timing->reset_low);
+    }
+
+    pin.port->MODER &= ~pin.moder_mask;
 
-    i = bc_gpio_get_input(channel);
+    _bc_onewire_slot_wait(start, timing->reset_low + timing->reset_presence);
 
-    bc_timer_delay(410);
+    i = (pin.port->IDR & pin.input_mask) != 0;
+
+    bc_irq_enable();
+
+    bc_timer_delay(timing->reset_tail);
 
     return i == 0;
 }
@@ -296,61 +516,115 @@ static uint8_t _bc_onewire_read_byte(bc_gpio_channel_t channel)
 
 static void _bc_onewire_write_bit(bc_gpio_channel_t channel, uint8_t bit)
 {
+    bc_onewire_speed_t speed = bc_onewire_get_speed(channel);
+    const _bc_onewire_timing_t *timing = &_bc_onewire_timing_lut[speed];
+
+    _bc_onewire_pin_t pin;
+    uint16_t start;
+
     bc_gpio_set_output(channel, 0);
-    bc_gpio_set_mode(channel, BC_GPIO_MODE_OUTPUT);
 
-    if (bit)
-    {
-        bc_irq_disable();
+    // Pin registers are written directly, as overdrive write one pulse must be shorter than 2 us
+    bc_irq_disable();
 
-        bc_timer_delay(3);
+    _bc_onewire_pin_init(channel, &pin);
 
-        bc_irq_enable();
+    start = _bc_onewire_slot_start();
+
+    pin.port->MODER = pin.moder_output;
 
-        bc_gpio_set_mode(channel, BC_GPIO_MODE_INPUT);
+    // Only standard write zero pulse is long enough to tolerate interrupts
+    if (!bit && speed == BC_ONEWIRE_SPEED_STANDARD)
+    {
+        bc_irq_enable();
 
-        bc_timer_delay(60);
+        _bc_onewire_slot_wait(start, timing->write_0_low);
 
+        bc_irq_disable();
     }
     else
     {
-        bc_timer_delay(55);
+        _bc_onewire_slot_wait(start, bit ? timing->write_1_low : timing->write_0_low);
+    }
 
-        bc_gpio_set_mode(channel, BC_GPIO_MODE_INPUT);
+    pin.port->MODER &= ~pin.moder_mask;
 
-        bc_timer_delay(8);
-    }
+    bc_irq_enable();
+
+    bc_timer_delay(bit ? timing->write_1_high : timing->write_0_high);
 }
 
 static uint8_t _bc_onewire_read_bit(bc_gpio_channel_t channel)
 {
-    uint8_t bit = 0;
+    const _bc_onewire_timing_t *timing = &_bc_onewire_timing_lut[bc_onewire_get_speed(channel)];
 
-    bc_gpio_set_output(channel, 0);
+    _bc_onewire_pin_t pin;
+    uint16_t start;
+    uint8_t bit;
 
-    bc_gpio_set_mode(channel, BC_GPIO_MODE_OUTPUT);
+    bc_gpio_set_output(channel, 0);
 
+    // Slot is not interrupted from its start to sampling, overdrive sample must be taken within 2 us
     bc_irq_disable();
 
-    bc_timer_delay(3);
+    _bc_onewire_pin_init(channel, &pin);
 
-    bc_irq_enable();
+    start = _bc_onewire_slot_start();
 
-    bc_gpio_set_mode(channel, BC_GPIO_MODE_INPUT);
+    pin.port->MODER = pin.moder_output;
 
-    bc_irq_disable();
+    _bc_onewire_slot_wait(start, timing->read_low);
 
-    bc_timer_delay(8);
+    pin.port->MODER &= ~pin.moder_mask;
 
-    bc_irq_enable();
+    _bc_onewire_slot_wait(start, timing->read_low + timing->read_sample);
+
+    _BC_ONEWIRE_RISE_DELAY();
+
+    bit = (pin.port->IDR & pin.input_mask) != 0 ? 1 : 0;
 
-    bit = bc_gpio_get_input(channel);
+    bc_irq_enable();
 
-    bc_timer_delay(50);
+    bc_timer_delay(timing->read_tail);
 
     return bit;
 }
 
+static void _bc_onewire_pin_init(bc_gpio_channel_t channel, _bc_onewire_pin_t *pin)
+{
+    uint32_t mask = bc_gpio_16_bit_mask[channel];
+
+    pin->port = bc_gpio_port[channel];
+    pin->input_mask = mask;
+
+    // Mode field of pin n is at bit 2 * n, (1 << n) squared is 1 << 2 * n
+    pin->moder_mask = 3 * mask * mask;
+
+    // Output data register holds zero, so output mode drives the bus low
+    pin->moder_output = (pin->port->MODER & ~pin->moder_mask) | (mask * mask);
+}
+
+static uint16_t _bc_onewire_slot_start(void)
+{
+    uint16_t now = bc_timer_get_microseconds();
+
+    // Slot starts right at the timer tick, so even 1 us long pulses are accurate
+    while (bc_timer_get_microseconds() == now)
+    {
+        continue;
+    }
+
+    return now + 1;
+}
+
+static void _bc_onewire_slot_wait(uint16_t start, uint16_t microseconds)
+{
+    while ((uint16_t) (bc_timer_get_microseconds() - start) < microseconds)
+    {
+        continue;
+    }
+}
+
 static void _bc_onewire_start(void)
 {
 	if (_bc_onewire.transaction)
@@ -542,6 +816,37 @@ bool bc_onewire_search_next(bc_gpio_channel_t channel, uint64_t *device_number)
     return search_result;
 }
 
+bool bc_onewire_async_reset(bc_gpio_channel_t channel, void (*callback)(bc_onewire_async_event_t, void *), void *param)
+{
+    return _bc_onewire_async_start(channel, _BC_ONEWIRE_ASYNC_RESET, NULL, 0, callback, param);
+}
+
+bool bc_onewire_async_write(bc_gpio_channel_t channel, const void *buffer, size_t length, void (*callback)(bc_onewire_async_event_t, void *), void *param)
+{
+    return _bc_onewire_async_start(channel, _BC_ONEWIRE_ASYNC_WRITE, (void *) buffer, length * 8, callback, param);
+}
+
+bool bc_onewire_async_read(bc_gpio_channel_t channel, void *buffer, size_t length, void (*callback)(bc_onewire_async_event_t, void *), void *param)
+{
+    memset(buffer, 0, length);
+
+    return _bc_onewire_async_start(channel, _BC_ONEWIRE_ASYNC_READ, buffer, length * 8, callback, param);
+}
+
+bool bc_onewire_async_read_bit(bc_gpio_channel_t channel, uint8_t *bit, void (*callback)(bc_onewire_async_event_t, void *), void *param)
+{
+    *bit = 0;
+
+    return _bc_onewire_async_start(channel, _BC_ONEWIRE_ASYNC_READ, bit, 1, callback, param);
+}
+
+bool bc_onewire_async_poll_read(bc_gpio_channel_t channel, void *buffer, size_t length, void (*callback)(bc_onewire_async_event_t, void *), void *param)
+{
+    memset(buffer, 0, length);
+
+    return _bc_onewire_async_start(channel, _BC_ONEWIRE_ASYNC_POLL_READ, buffer, length * 8, callback, param);
+}
+
 void bc_onewire_auto_ds28e17_sleep_mode(bool on)
 {
     _bc_onewire.auto_ds28e17_sleep_mode = on;
@@ -560,3 +865,331 @@ static int _bc_onewire_search_devices(bc_gpio_channel_t channel, uint64_t *devic
 
     return devices;
 }
+
+static bool _bc_onewire_async_start(bc_gpio_channel_t channel, _bc_onewire_async_operation_t operation, void *buffer, size_t bits, void (*callback)(bc_onewire_async_event_t, void *), void *param)
+{
+    _bc_onewire_async_t *async = &_bc_onewire.async;
+
+    if (!_bc_onewire.initialized || ((channel != BC_GPIO_P0) && (channel != BC_GPIO_P5)))
+    {
+        return false;
+    }
+
+    // Synchronous transaction or other user of TIM2 is running
+    if (async->busy || _bc_onewire.transaction || ((RCC->APB1ENR & RCC_APB1ENR_TIM2EN) != 0 && (TIM2->CR1 & TIM_CR1_CEN) != 0))
+    {
+        return false;
+    }
+
+    // Capture of bit slots uses DMA channel 7, which is shared with UART transmission
+    if ((operation != _BC_ONEWIRE_ASYNC_RESET) && !bc_dma_channel_claim(BC_DMA_CHANNEL_7, async))
+    {
+        return false;
+    }
+
+    async->busy = true;
+    async->channel = channel;
+    async->operation = operation;
+    async->timing = &_bc_onewire_async_timing_lut[bc_onewire_get_speed(channel)];
+    async->buffer = buffer;
+    async->bits = bits;
+    async->offset = 0;
+    async->polling = operation == _BC_ONEWIRE_ASYNC_POLL_READ;
+    async->callback = callback;
+    async->param = param;
+
+    // Clock must not change during transfer, PLL is enabled so nobody else can switch it.
+    // Stop mode would halt timer and DMA, but core can sleep in sleep mode.
+    bc_system_pll_enable();
+    bc_system_deep_sleep_disable();
+    bc_scheduler_enable_sleep();
+
+    bc_dma_init();
+    bc_dma_set_event_handler(BC_DMA_CHANNEL_2, _bc_onewire_async_dma_event_handler, NULL);
+
+    // Enable TIM2 clock
+    RCC->APB1ENR |= RCC_APB1ENR_TIM2EN;
+
+    // Errata workaround
+    RCC->APB1ENR;
+
+    TIM2->CR1 = 0;
+    TIM2->PSC = 0;
+
+    // Channel 1 in PWM mode 1 with preload, output is active low while counter is below compare value;
+    // channel 2 captures rising edges of the same pin (TI1)
+    TIM2->CCMR1 = TIM_CCMR1_OC1M_2 | TIM_CCMR1_OC1M_1 | TIM_CCMR1_OC1PE | TIM_CCMR1_CC2S_1;
+    TIM2->CCER = TIM_CCER_CC1P | TIM_CCER_CC2E;
+
+    // Pin is open-drain alternate function TIM2_CH1 (P0 is PA0 AF2, P5 is PA5 AF5)
+    uint32_t pos = channel == BC_GPIO_P0 ? 0 : 5;
+    uint32_t af = channel == BC_GPIO_P0 ? 2 : 5;
+
+    GPIOA->AFR[0] = (GPIOA->AFR[0] & ~(0xfUL << (pos * 4))) | (af << (pos * 4));
+    GPIOA->OTYPER |= 1UL << pos;
+    GPIOA->MODER = (GPIOA->MODER & ~(3UL << (pos * 2))) | (2UL << (pos * 2));
+
+    bc_scheduler_plan_from_now(async->task_id, async->polling ? _BC_ONEWIRE_ASYNC_POLL_TIMEOUT : _BC_ONEWIRE_ASYNC_TIMEOUT);
+
+    _bc_onewire_async_run();
+
+    return true;
+}
+
+static void _bc_onewire_async_run(void)
+{
+    _bc_onewire_async_t *async = &_bc_onewire.async;
+
+    const _bc_onewire_async_timing_t *timing = async->timing;
+
+    size_t slots;
+
+    if (async->operation == _BC_ONEWIRE_ASYNC_RESET)
+    {
+        slots = 1;
+
+        async->slot[0] = timing->reset_low * _BC_ONEWIRE_ASYNC_TICKS_PER_US;
+
+        TIM2->ARR = timing->reset_slot * _BC_ONEWIRE_ASYNC_TICKS_PER_US - 1;
+    }
+    else
+    {
+        slots = async->bits - async->offset;
+
+        if (slots > _BC_ONEWIRE_ASYNC_CHUNK * 8)
+        {
+            slots = _BC_ONEWIRE_ASYNC_CHUNK * 8;
+        }
+
+        // Busy device is polled by one byte of slots, so just a few slots after it is ready are read in advance
+        if (async->polling && (slots > 8))
+        {
+            slots = 8;
+        }
+
+        for (size_t i = 0; i < slots; i++)
+        {
+            size_t bit = async->offset + i;
+
+            if (async->operation != _BC_ONEWIRE_ASYNC_WRITE)
+            {
+                async->slot[i] = timing->read_low * _BC_ONEWIRE_ASYNC_TICKS_PER_US;
+            }
+            else if ((async->buffer[bit / 8] & (1 << (bit % 8))) != 0)
+            {
+                async->slot[i] = timing->write_1_low * _BC_ONEWIRE_ASYNC_TICKS_PER_US;
+            }
+            else
+            {
+                async->slot[i] = timing->write_0_low * _BC_ONEWIRE_ASYNC_TICKS_PER_US;
+            }
+        }
+
+        TIM2->ARR = timing->slot * _BC_ONEWIRE_ASYNC_TICKS_PER_US - 1;
+    }
+
+    async->chunk = slots;
+
+    // Idle slots keep the bus released until transfer is handled
+    async->slot[slots] = 0;
+    async->slot[slots + 1] = 0;
+
+    // The first slot is loaded to shadow register by update event, the second one waits in preload register
+    TIM2->CCR1 = async->slot[0];
+    TIM2->CNT = 0;
+    TIM2->EGR = TIM_EGR_UG;
+    TIM2->CCR1 = async->slot[1];
+    TIM2->SR = 0;
+
+    // DMA loads compare value of slot after the next one on every update, it's done after the last slot
+    bc_dma_channel_config_t config_slot = {
+        .request = BC_DMA_REQUEST_8,
+        .direction = BC_DMA_DIRECTION_TO_PERIPHERAL,
+        .data_size_memory = BC_DMA_SIZE_2,
+        .data_size_peripheral = BC_DMA_SIZE_2,
+        .length = slots,
+        .mode = BC_DMA_MODE_STANDARD,
+        .address_memory = &async->slot[2],
+        .address_peripheral = (void *) &TIM2->CCR1,
+        .priority = BC_DMA_PRIORITY_HIGH
+    };
+
+    bc_dma_channel_config(BC_DMA_CHANNEL_2, &config_slot);
+    bc_dma_channel_run(BC_DMA_CHANNEL_2);
+
+    TIM2->DIER = TIM_DIER_UDE;
+
+    // Every bit slot has exactly one rising edge, its time is stored by DMA
+    if (async->operation != _BC_ONEWIRE_ASYNC_RESET)
+    {
+        bc_dma_channel_config_t config_capture = {
+            .request = BC_DMA_REQUEST_8,
+            .direction = BC_DMA_DIRECTION_TO_RAM,
+            .data_size_memory = BC_DMA_SIZE_2,
+            .data_size_peripheral = BC_DMA_SIZE_2,
+            .length = slots,
+            .mode = BC_DMA_MODE_STANDARD,
+            .address_memory = async->capture,
+            .address_peripheral = (void *) &TIM2->CCR2,
+            .priority = BC_DMA_PRIORITY_HIGH
+        };
+
+        bc_dma_channel_config(BC_DMA_CHANNEL_7, &config_capture);
+        bc_dma_channel_run(BC_DMA_CHANNEL_7);
+
+        TIM2->DIER |= TIM_DIER_CC2DE;
+    }
+
+    bc_irq_disable();
+
+    TIM2->CCER |= TIM_CCER_CC1E;
+    TIM2->CR1 |= TIM_CR1_CEN;
+
+    bc_irq_enable();
+}
+
+static void _bc_onewire_async_dma_event_handler(bc_dma_channel_t channel, bc_dma_event_t event, void *event_param)
+{
+    (void) channel;
+    (void) event_param;
+
+    _bc_onewire_async_t *async = &_bc_onewire.async;
+
+    if (!async->busy || (event == BC_DMA_EVENT_HALF_DONE))
+    {
+        return;
+    }
+
+    // Bus is idle now, timer can be stopped
+    TIM2->CR1 &= ~TIM_CR1_CEN;
+    TIM2->DIER = 0;
+
+    if (async->operation != _BC_ONEWIRE_ASYNC_RESET)
+    {
+        bc_dma_channel_stop(BC_DMA_CHANNEL_7);
+    }
+
+    if (event == BC_DMA_EVENT_ERROR)
+    {
+        _bc_onewire_async_finish(BC_ONEWIRE_ASYNC_EVENT_ERROR);
+
+        return;
+    }
+
+    if (async->operation == _BC_ONEWIRE_ASYNC_RESET)
+    {
+        // Presence pulse delays the last rising edge behind the end of reset pulse
+        bool presence = ((TIM2->SR & TIM_SR_CC2IF) != 0) &&
+                (TIM2->CCR2 > (uint32_t) (async->timing->reset_low + async->timing->reset_sample) * _BC_ONEWIRE_ASYNC_TICKS_PER_US);
+
+        _bc_onewire_async_finish(presence ? BC_ONEWIRE_ASYNC_EVENT_DONE : BC_ONEWIRE_ASYNC_EVENT_ERROR);
+
+        return;
+    }
+
+    // Missing rising edge means bus was held low
+    if (bc_dma_channel_get_length(BC_DMA_CHANNEL_7) != 0)
+    {
+        _bc_onewire_async_finish(BC_ONEWIRE_ASYNC_EVENT_ERROR);
+
+        return;
+    }
+
+    if (async->operation != _BC_ONEWIRE_ASYNC_WRITE)
+    {
+        uint16_t sample = async->timing->read_sample * _BC_ONEWIRE_ASYNC_TICKS_PER_US;
+
+        size_t i = 0;
+
+        // Device reads as ones while it is busy, the slots after the first zero are data already
+        if (async->polling)
+        {
+            while ((i < async->chunk) && (async->capture[i] < sample))
+            {
+                i++;
+            }
+
+            if (i == async->chunk)
+            {
+                _bc_onewire_async_run();
+
+                return;
+            }
+
+            async->polling = false;
+
+            i++;
+        }
+
+        for (; i < async->chunk; i++)
+        {
+            if (async->capture[i] < sample)
+            {
+                async->buffer[async->offset / 8] |= 1 << (async->offset % 8);
+            }
+
+            async->offset++;
+        }
+    }
+    else
+    {
+        async->offset += async->chunk;
+    }
+
+    if (async->offset < async->bits)
+    {
+        _bc_onewire_async_run();
+
+        return;
+    }
+
+    _bc_onewire_async_finish(BC_ONEWIRE_ASYNC_EVENT_DONE);
+}
+
+static void _bc_onewire_async_finish(bc_onewire_async_event_t event)
+{
+    _bc_onewire_async_t *async = &_bc_onewire.async;
+
+    TIM2->CR1 &= ~TIM_CR1_CEN;
+    TIM2->DIER = 0;
+    TIM2->CCER = 0;
+
+    bc_dma_channel_stop(BC_DMA_CHANNEL_2);
+
+    // Channel 7 may be running UART transmission when it was not claimed
+    if (async->operation != _BC_ONEWIRE_ASYNC_RESET)
+    {
+        bc_dma_channel_stop(BC_DMA_CHANNEL_7);
+
+        bc_dma_channel_release(BC_DMA_CHANNEL_7, async);
+    }
+
+    // Release the pin
+    bc_gpio_set_mode(async->channel, BC_GPIO_MODE_INPUT);
+
+    // Disable TIM2 clock
+    RCC->APB1ENR &= ~RCC_APB1ENR_TIM2EN;
+
+    bc_scheduler_disable_sleep();
+    bc_system_deep_sleep_enable();
+    bc_system_pll_disable();
+
+    bc_scheduler_plan_absolute(async->task_id, BC_TICK_INFINITY);
+
+    async->busy = false;
+
+    if (async->callback != NULL)
+    {
+        async->callback(event, async->param);
+    }
+}
+
+static void _bc_onewire_async_task_timeout(void *param)
+{
+    (void) param;
+
+    if (_bc_onewire.async.busy)
+    {
+        _bc_onewire_async_finish(BC_ONEWIRE_ASYNC_EVENT_ERROR);
+    }
+}
@@ -272,6 +272,11 @@ bool bc_radio_is_peer_device(uint64_t id)
     return false;
 }
 
+bool bc_radio_is_pub_queue_empty(void)
+{
+    return _bc_radio.pub_queue._length == 0;
+}
+
 bool bc_radio_pub_queue_put(const void *buffer, size_t length)
 {
     if (!bc_queue_put(&_bc_radio.pub_queue, buffer, length))
@@ -684,6 +689,11 @@ static void _bc_radio_spirit1_event_handler(bc_spirit1_event_t event, void *even
 
                 return;
             }
+
+            if (_bc_radio.event_handler)
+            {
+                _bc_radio.event_handler(BC_RADIO_EVENT_TX_ERROR, _bc_radio.event_param);
+            }
         }
 
         _bc_radio_go_to_state_rx_or_sleep();
@@ -705,6 +715,11 @@ static void _bc_radio_spirit1_event_handler(bc_spirit1_event_t event, void *even
 
                     return;
                 }
+
+                if (_bc_radio.event_handler)
+                {
+                    _bc_radio.event_handler(BC_RADIO_EVENT_TX_ERROR, _bc_radio.event_param);
+                }
             }
 
             _bc_radio_go_to_state_rx_or_sleep();
@@ -771,6 +786,11 @@ static void _bc_radio_spirit1_event_handler(bc_spirit1_event_t event, void *even
                             _bc_radio.rx_timeout_sleeping = bc_tick_get() + _bc_radio.sleeping_mode_rx_timeout;
                         }
 
+                        if (_bc_radio.event_handler)
+                        {
+                            _bc_radio.event_handler(BC_RADIO_EVENT_TX_DONE, _bc_radio.event_param);
+                        }
+
                         _bc_radio_go_to_state_rx_or_sleep();
                     }
 
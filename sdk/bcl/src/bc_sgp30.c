@@ -1,4 +1,5 @@
 #include <bc_sgp30.h>
+#include <bc_crc.h>
 
 #define _BC_SGP30_DELAY_RUN 100
 #define _BC_SGP30_DELAY_INITIALIZE 500
@@ -12,8 +13,6 @@ static void _bc_sgp30_task_interval(void *param);
 
 static void _bc_sgp30_task_measure(void *param);
 
-static uint8_t _bc_sgp30_calculate_crc(uint8_t *buffer, size_t length);
-
 void bc_sgp30_init(bc_sgp30_t *self, bc_i2c_channel_t i2c_channel, uint8_t i2c_address)
 {
     memset(self, 0, sizeof(*self));
@@ -189,7 +188,7 @@ start:
                 goto start;
             }
 
-            if (_bc_sgp30_calculate_crc(&buffer[0], 3) != 0)
+            if (bc_crc8_sensirion(&buffer[0], 3, 0xff) != 0)
             {
                 goto start;
             }
@@ -238,7 +237,7 @@ start:
             buffer[1] = 0x61;
             buffer[2] = self->_ah_scaled >> 8;
             buffer[3] = self->_ah_scaled;
-            buffer[4] = _bc_sgp30_calculate_crc(&buffer[2], 2);
+            buffer[4] = bc_crc8_sensirion(&buffer[2], 2, 0xff);
 
             bc_i2c_transfer_t transfer;
 
@@ -299,8 +298,8 @@ start:
                 goto start;
             }
 
-            if (_bc_sgp30_calculate_crc(&buffer[0], 3) != 0 ||
-                _bc_sgp30_calculate_crc(&buffer[3], 3) != 0)
+            if (bc_crc8_sensirion(&buffer[0], 3, 0xff) != 0 ||
+                bc_crc8_sensirion(&buffer[3], 3, 0xff) != 0)
             {
                 goto start;
             }
@@ -324,27 +323,3 @@ start:
         }
     }
 }
-
-static uint8_t _bc_sgp30_calculate_crc(uint8_t *buffer, size_t length)
-{
-    uint8_t crc = 0xff;
-
-    for (size_t i = 0; i < length; i++)
-    {
-        crc ^= buffer[i];
-
-        for (int j = 0; j < 8; j++)
-        {
-            if ((crc & 0x80) != 0)
-            {
-                crc = (crc << 1) ^ 0x31;
-            }
-            else
-            {
-                crc <<= 1;
-            }
-        }
-    }
-
-    return crc;
-}
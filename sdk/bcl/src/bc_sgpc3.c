@@ -1,4 +1,5 @@
 #include <bc_sgpc3.h>
+#include <bc_crc.h>
 
 #define _BC_SGPC3_DELAY_RUN 30
 #define _BC_SGPC3_DELAY_INITIALIZE 500
@@ -13,8 +14,6 @@ static void _bc_sgpc3_task_interval(void *param);
 
 static void _bc_sgpc3_task_measure(void *param);
 
-static uint8_t _bc_sgpc3_calculate_crc(uint8_t *buffer, size_t length);
-
 void bc_sgpc3_init(bc_sgpc3_t *self, bc_i2c_channel_t i2c_channel, uint8_t i2c_address)
 {
     memset(self, 0, sizeof(*self));
@@ -171,7 +170,7 @@ start:
             buffer[1] = 0x9f;
             buffer[2] = 0x00;
             buffer[3] = 0x00;
-            buffer[4] = _bc_sgpc3_calculate_crc(&buffer[2], 2);
+            buffer[4] = bc_crc8_sensirion(&buffer[2], 2, 0xff);
 
             bc_i2c_transfer_t transfer;
 
@@ -207,7 +206,7 @@ start:
                 goto start;
             }
 
-            if (_bc_sgpc3_calculate_crc(&buffer[0], 3) != 0)
+            if (bc_crc8_sensirion(&buffer[0], 3, 0xff) != 0)
             {
                 goto start;
             }
@@ -256,7 +255,7 @@ start:
             buffer[1] = 0x61;
             buffer[2] = self->_ah_scaled >> 8;
             buffer[3] = self->_ah_scaled;
-            buffer[4] = _bc_sgpc3_calculate_crc(&buffer[2], 2);
+            buffer[4] = bc_crc8_sensirion(&buffer[2], 2, 0xff);
 
             bc_i2c_transfer_t transfer;
 
@@ -317,7 +316,7 @@ start:
                 goto start;
             }
 
-            if (_bc_sgpc3_calculate_crc(&buffer[0], 3) != 0)
+            if (bc_crc8_sensirion(&buffer[0], 3, 0xff) != 0)
             {
                 goto start;
             }
@@ -340,27 +339,3 @@ start:
         }
     }
 }
-
-static uint8_t _bc_sgpc3_calculate_crc(uint8_t *buffer, size_t length)
-{
-    uint8_t crc = 0xff;
-
-    for (size_t i = 0; i < length; i++)
-    {
-        crc ^= buffer[i];
-
-        for (int j = 0; j < 8; j++)
-        {
-            if ((crc & 0x80) != 0)
-            {
-                crc = (crc << 1) ^ 0x31;
-            }
-            else
-            {
-                crc <<= 1;
-            }
-        }
-    }
-
-    return crc;
-}
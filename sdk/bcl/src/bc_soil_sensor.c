@@ -4,6 +4,9 @@
 #include <bc_i2c.h>
 #include <bc_system.h>
 #include <bc_tick.h>
+#include <bc_eeprom.h>
+#include <bc_crc.h>
+#include <bc_radio.h>
 
 #define _BC_SOIL_SENSOR_TMP112_ADDRESS   0x48
 #define _BC_SOIL_SENSOR_ZSSC3123_ADDRESS 0x28
@@ -11,20 +14,39 @@
 #define _BC_SOIL_SENSOR_EEPROM_BANK_A    0x000
 #define _BC_SOIL_SENSOR_EEPROM_BANK_B    0x080
 #define _BC_SOIL_SENSOR_EEPROM_BANK_C    0x100
+// Reference temperature of compensation in TMP112 raw units (25 °C)
+#define _BC_SOIL_SENSOR_REFERENCE_TEMPERATURE (25 * 256)
+#define _BC_SOIL_SENSOR_CACHE_SIGNATURE  0x50115e75
+#define _BC_SOIL_SENSOR_CACHE_VERSION    1
+#define _BC_SOIL_SENSOR_CACHE_ENTRY_SIZE (sizeof(uint64_t) + sizeof(bc_soil_sensor_eeprom_t))
+// End of EEPROM keeps peer devices of bc_radio (length byte and three copies of every id)
+#define _BC_SOIL_SENSOR_CACHE_RESERVED   (8 + BC_RADIO_MAX_DEVICES * 3 * sizeof(uint64_t))
+// Power up delay before enumeration and when cached sensors are verified (ms)
+#define _BC_SOIL_SENSOR_POWER_UP_DELAY        750
+#define _BC_SOIL_SENSOR_POWER_UP_DELAY_CACHED 50
 
 static void _bc_soil_sensor_task_interval(void *param);
 static void _bc_soil_sensor_error(bc_soil_sensor_t *self, bc_soil_sensor_error_t error);
 static void _bc_soil_sensor_task_measure(void *param);
 static bool _bc_soil_sensor_tmp112_init(bc_ds28e17_t *ds28e17);
-static bool _bc_soil_sensor_tmp112_measurement_request(bc_ds28e17_t *ds28e17);
-static bool _bc_soil_sensor_tmp112_data_fetch(bc_soil_sensor_sensor_t *sensor);
-static bool _bc_soil_sensor_zssc3123_measurement_request(bc_ds28e17_t *ds28e17);
 static bool _bc_soil_sensor_zssc3123_data_fetch(bc_soil_sensor_sensor_t *sensor);
+static bc_soil_sensor_error_t _bc_soil_sensor_measurement_request(bc_soil_sensor_sensor_t *sensor);
+static bc_soil_sensor_error_t _bc_soil_sensor_data_fetch(bc_soil_sensor_sensor_t *sensor);
+static void _bc_soil_sensor_fetch_setup(bc_ds28e17_operation_t *operation, uint8_t *buffer);
+static bc_soil_sensor_error_t _bc_soil_sensor_fetch_result(bc_soil_sensor_sensor_t *sensor, int done, const uint8_t *buffer);
+static bc_soil_sensor_error_t _bc_soil_sensor_fetch_sync(bc_soil_sensor_t *self);
+static bool _bc_soil_sensor_fetch_async(bc_soil_sensor_t *self);
+static void _bc_soil_sensor_fetch_async_handler(bc_ds28e17_t *ds28e17, bc_ds28e17_event_t event, void *param);
 static bc_soil_sensor_error_t _bc_soil_sensor_eeprom_load(bc_soil_sensor_sensor_t *sensor);
 static void _bc_soil_sensor_eeprom_fill(bc_soil_sensor_sensor_t *sensor);
 static bool _bc_soil_sensor_eeprom_save(bc_soil_sensor_sensor_t *sensor);
 static bool _bc_soil_sensor_eeprom_read(bc_soil_sensor_sensor_t *sensor, uint8_t address, void *buffer, size_t length);
 static bool _bc_soil_sensor_eeprom_write(bc_soil_sensor_sensor_t *sensor, uint8_t address, const void *buffer, size_t length);
+static bool _bc_soil_sensor_cache_load(bc_soil_sensor_t *self);
+static void _bc_soil_sensor_cache_save(bc_soil_sensor_t *self);
+static void _bc_soil_sensor_cache_drop(bc_soil_sensor_t *self);
+static void _bc_soil_sensor_calibration_update(bc_soil_sensor_sensor_t *sensor);
+static int _bc_soil_sensor_moisture_tenths(bc_soil_sensor_sensor_t *sensor);
 
 void bc_soil_sensor_init(bc_soil_sensor_t *self)
 {
@@ -40,6 +62,8 @@ void bc_soil_sensor_init_multiple(bc_soil_sensor_t *self, bc_soil_sensor_sensor_
     self->_channel = BC_GPIO_P5;
     self->_sensor = sensors;
     self->_sensor_count = sensor_count;
+    self->_overdrive = true;
+    self->_cache_address = bc_eeprom_get_size() - _BC_SOIL_SENSOR_CACHE_RESERVED - sizeof(bc_soil_sensor_eeprom_header_t) - sensor_count * _BC_SOIL_SENSOR_CACHE_ENTRY_SIZE;
 
     self->_task_id_interval = bc_scheduler_register(_bc_soil_sensor_task_interval, self, BC_TICK_INFINITY);
     self->_task_id_measure = bc_scheduler_register(_bc_soil_sensor_task_measure, self, 10);
@@ -72,6 +96,16 @@ void bc_soil_sensor_set_update_interval(bc_soil_sensor_t *self, bc_tick_t interv
     }
 }
 
+void bc_soil_sensor_set_overdrive(bc_soil_sensor_t *self, bool on)
+{
+    self->_overdrive = on;
+}
+
+void bc_soil_sensor_set_cache_address(bc_soil_sensor_t *self, uint32_t address)
+{
+    self->_cache_address = address;
+}
+
 int bc_soil_sensor_get_sensor_found(bc_soil_sensor_t *self)
 {
     return self->_sensor_found;
@@ -192,27 +226,43 @@ bool bc_soil_sensor_get_moisture(bc_soil_sensor_t *self, uint64_t device_address
         return false;
     }
 
-    uint16_t raw = self->_sensor[i]._cap_raw;
-    uint16_t *calibration = self->_sensor[i]._eeprom.calibration;
+    *moisture = (_bc_soil_sensor_moisture_tenths(&self->_sensor[i]) + 5) / 10;
+
+    return true;
+}
+
+int bc_soil_sensor_get_moisture_all(bc_soil_sensor_t *self, int16_t *moisture, int count)
+{
+    if (count > self->_sensor_found)
+    {
+        count = self->_sensor_found;
+    }
 
-    for (int i = 0; i < 11; i++)
+    for (int i = 0; i < count; i++)
     {
-        if (raw < calibration[i])
+        if (self->_sensor[i]._cap_valid)
         {
-            if (i == 0)
-            {
-                *moisture = 0;
+            moisture[i] = _bc_soil_sensor_moisture_tenths(&self->_sensor[i]);
+        }
+        else
+        {
+            moisture[i] = BC_SOIL_SENSOR_MOISTURE_INVALID;
+        }
+    }
 
-                return true;
-            }
+    return count;
+}
 
-            *moisture = (((raw - calibration[i - 1]) * 10) / (calibration[i] - calibration[i - 1])) + (10 * (i - 1));
+bool bc_soil_sensor_set_temperature_coefficient(bc_soil_sensor_t *self, uint64_t device_address, int16_t coefficient)
+{
+    int i = bc_soil_sensor_get_index_by_device_address(self, device_address);
 
-            return true;
-        }
+    if (i == -1)
+    {
+        return false;
     }
 
-    *moisture = 100;
+    self->_sensor[i]._temperature_coefficient = coefficient;
 
     return true;
 }
@@ -284,6 +334,8 @@ bool bc_soil_sensor_calibration_set_point(bc_soil_sensor_t *self, uint64_t devic
 
     self->_sensor[i]._eeprom.calibration[point] = value;
 
+    _bc_soil_sensor_calibration_update(&self->_sensor[i]);
+
     return true;
 }
 
@@ -296,7 +348,14 @@ bool bc_soil_sensor_eeprom_save(bc_soil_sensor_t *self, uint64_t device_address)
         return false;
     }
 
-    return _bc_soil_sensor_eeprom_save(&self->_sensor[i]);
+    if (!_bc_soil_sensor_eeprom_save(&self->_sensor[i]))
+    {
+        return false;
+    }
+
+    _bc_soil_sensor_cache_save(self);
+
+    return true;
 }
 
 bc_soil_sensor_error_t bc_soil_sensor_get_error(bc_soil_sensor_t *self)
@@ -330,6 +389,9 @@ static void _bc_soil_sensor_task_measure(void *param)
         {
             bc_onewire_auto_ds28e17_sleep_mode(true);
 
+            // Sensors are at standard speed after power up
+            bc_onewire_set_speed(self->_channel, BC_ONEWIRE_SPEED_STANDARD);
+
             for (int i = 0; i < self->_sensor_found; i++)
             {
                 self->_sensor[i]._temperature_valid = false;
@@ -367,7 +429,9 @@ static void _bc_soil_sensor_task_measure(void *param)
 
             self->_state = BC_SOIL_SENSOR_STATE_INITIALIZE;
 
-            bc_scheduler_plan_current_from_now(750);
+            self->_cache_valid = _bc_soil_sensor_cache_load(self);
+
+            bc_scheduler_plan_current_from_now(self->_cache_valid ? _BC_SOIL_SENSOR_POWER_UP_DELAY_CACHED : _BC_SOIL_SENSOR_POWER_UP_DELAY);
 
             return;
         }
@@ -375,19 +439,53 @@ static void _bc_soil_sensor_task_measure(void *param)
         {
             uint64_t device_address = 0;
 
-            self->_sensor_found = 0;
-
             bc_onewire_transaction_start(self->_channel);
 
-            bc_onewire_reset(self->_channel);
+            if (!self->_cache_valid)
+            {
+                self->_sensor_found = 0;
+
+                bc_onewire_reset(self->_channel);
+
+                bc_onewire_search_start(0x19);
 
-            bc_onewire_search_start(0x19);
+                while ((self->_sensor_found < self->_sensor_count) && bc_onewire_search_next(self->_channel, &device_address))
+                {
+                    bc_ds28e17_init(&self->_sensor[self->_sensor_found]._ds28e17, self->_channel, device_address);
+
+                    self->_sensor_found++;
+                }
+            }
+            else if (self->_sensor_found < self->_sensor_count)
+            {
+                // Free slots are left, so bridge connected after the cache was saved has to be found by search
+                int count = 0;
+
+                bc_onewire_reset(self->_channel);
+
+                bc_onewire_search_start(0x19);
+
+                while ((count <= self->_sensor_found) && bc_onewire_search_next(self->_channel, &device_address))
+                {
+                    count++;
+                }
 
-            while ((self->_sensor_found < self->_sensor_count) && bc_onewire_search_next(self->_channel, &device_address))
+                if (count > self->_sensor_found)
+                {
+                    bc_onewire_transaction_stop(self->_channel);
+
+                    _bc_soil_sensor_cache_drop(self);
+
+                    return;
+                }
+            }
+
+            // All found bridges support overdrive, every following transaction is several times shorter
+            if (self->_overdrive && (self->_sensor_found != 0))
             {
-                bc_ds28e17_init(&self->_sensor[self->_sensor_found]._ds28e17, self->_channel, device_address);
+                uint64_t skip_rom = BC_ONEWIRE_DEVICE_NUMBER_SKIP_ROM;
 
-                self->_sensor_found++;
+                bc_onewire_overdrive_select(self->_channel, &skip_rom);
             }
 
             bc_onewire_transaction_stop(self->_channel);
@@ -403,15 +501,26 @@ static void _bc_soil_sensor_task_measure(void *param)
 
             for (int i = 0; i < self->_sensor_found; i++)
             {
+                // Addressed write to TMP112 verifies cached sensor, full search is done after power cycle otherwise
                 if (!_bc_soil_sensor_tmp112_init(&self->_sensor[i]._ds28e17))
                 {
+                    if (self->_cache_valid)
+                    {
+                        _bc_soil_sensor_cache_drop(self);
+
+                        return;
+                    }
+
                     _bc_soil_sensor_error(self, BC_SOIL_SENSOR_ERROR_TMP112_INITIALIZE);
 
                     return;
                 }
             }
 
-            for (int i = 0; i < self->_sensor_found; i++)
+            // Calibration which could not be read is not cached, so it is read again next time
+            bool cacheable = !self->_cache_valid;
+
+            for (int i = 0; (i < self->_sensor_found) && !self->_cache_valid; i++)
             {
                 bc_soil_sensor_error_t error = _bc_soil_sensor_eeprom_load(&self->_sensor[i]);
 
@@ -421,6 +530,8 @@ static void _bc_soil_sensor_task_measure(void *param)
                     {
                         _bc_soil_sensor_eeprom_fill(&self->_sensor[i]);
 
+                        cacheable = false;
+
                         continue;
                     }
 
@@ -430,6 +541,11 @@ static void _bc_soil_sensor_task_measure(void *param)
                 }
             }
 
+            if (cacheable)
+            {
+                _bc_soil_sensor_cache_save(self);
+            }
+
             for (int i = 0; i < self->_sensor_found; i++)
             {
                 if (i + 1 == self->_sensor_found) // last sensor
@@ -465,25 +581,19 @@ static void _bc_soil_sensor_task_measure(void *param)
 
             for (int i = 0; i < self->_sensor_found; i++)
             {
-                if (!_bc_soil_sensor_zssc3123_measurement_request(&self->_sensor[i]._ds28e17))
-                {
-                    _bc_soil_sensor_error(self, BC_SOIL_SENSOR_ERROR_ZSSC3123_MEASUREMENT_REQUEST);
-
-                    return;
-                }
-
                 if (i + 1 == self->_sensor_found) // last sensor
                 {
                     bc_onewire_auto_ds28e17_sleep_mode(true);
                 }
 
-                if (!_bc_soil_sensor_tmp112_measurement_request(&self->_sensor[i]._ds28e17))
+                bc_soil_sensor_error_t error = _bc_soil_sensor_measurement_request(&self->_sensor[i]);
+
+                if (error)
                 {
-                    _bc_soil_sensor_error(self, BC_SOIL_SENSOR_ERROR_TMP112_MEASUREMENT_REQUEST);
+                    _bc_soil_sensor_error(self, error);
 
                     return;
                 }
-
             }
 
             self->_state = BC_SOIL_SENSOR_STATE_READ;
@@ -494,29 +604,71 @@ static void _bc_soil_sensor_task_measure(void *param)
         }
         case BC_SOIL_SENSOR_STATE_READ:
         {
-            bc_onewire_auto_ds28e17_sleep_mode(false);
+            self->_fetch_index = 0;
 
-            for (int i = 0; i < self->_sensor_found; i++)
+            // Bus is driven by timer and DMA so core can sleep, synchronous read is used when it is not possible
+            if (_bc_soil_sensor_fetch_async(self))
             {
-                if (!_bc_soil_sensor_tmp112_data_fetch(&self->_sensor[i]))
-                {
-                    _bc_soil_sensor_error(self, BC_SOIL_SENSOR_ERROR_TMP112_DATA_FETCH);
+                self->_state = BC_SOIL_SENSOR_STATE_READ_ASYNC;
 
-                    return;
-                }
+                return;
+            }
 
-                if (i + 1 == self->_sensor_found) // last sensor
+            bc_soil_sensor_error_t error = _bc_soil_sensor_fetch_sync(self);
+
+            if (error)
+            {
+                _bc_soil_sensor_error(self, error);
+
+                return;
+            }
+
+            self->_state = BC_SOIL_SENSOR_STATE_UPDATE;
+
+            bc_scheduler_plan_current_now();
+
+            return;
+        }
+        case BC_SOIL_SENSOR_STATE_READ_ASYNC:
+        {
+            bc_soil_sensor_sensor_t *sensor = &self->_sensor[self->_fetch_index];
+
+            // All data of one sensor are read by one bridge transaction
+            bc_soil_sensor_error_t error = _bc_soil_sensor_fetch_result(sensor, bc_ds28e17_async_get_done(&sensor->_ds28e17), self->_fetch_buffer);
+
+            if (error)
+            {
+                _bc_soil_sensor_error(self, error);
+
+                return;
+            }
+
+            if (++self->_fetch_index < self->_sensor_found)
+            {
+                if (_bc_soil_sensor_fetch_async(self))
                 {
-                    bc_onewire_auto_ds28e17_sleep_mode(true);
+                    return;
                 }
 
-                if (!_bc_soil_sensor_zssc3123_data_fetch(&self->_sensor[i]))
+                // DMA channel is taken by UART meanwhile, the rest of sensors is read synchronously
+                error = _bc_soil_sensor_fetch_sync(self);
+
+                if (error)
                 {
-                    _bc_soil_sensor_error(self, BC_SOIL_SENSOR_ERROR_ZSSC3123_DATA_FETCH);
+                    _bc_soil_sensor_error(self, error);
 
                     return;
                 }
             }
+            else
+            {
+                // Put all bridges to sleep at once
+                bc_onewire_auto_ds28e17_sleep_mode(true);
+
+                bc_onewire_transaction_start(self->_channel);
+
+                bc_onewire_transaction_stop(self->_channel);
+            }
 
             self->_state = BC_SOIL_SENSOR_STATE_UPDATE;
 
@@ -565,91 +717,166 @@ static bool _bc_soil_sensor_tmp112_init(bc_ds28e17_t *ds28e17)
     return bc_ds28e17_memory_write(ds28e17, &memory_transfer);
 }
 
-static bool _bc_soil_sensor_tmp112_measurement_request(bc_ds28e17_t *ds28e17)
+static bool _bc_soil_sensor_zssc3123_data_fetch(bc_soil_sensor_sensor_t *sensor)
 {
-    const uint8_t buffer[] = { 0x81 };
+    uint8_t buffer[2];
 
-    bc_i2c_memory_transfer_t memory_transfer = {
-        .device_address = _BC_SOIL_SENSOR_TMP112_ADDRESS,
-        .memory_address = 0x01,
-        .buffer = (void *) buffer,
+    bc_i2c_transfer_t transfer = {
+        .device_address = _BC_SOIL_SENSOR_ZSSC3123_ADDRESS,
+        .buffer = buffer,
         .length = sizeof(buffer)
     };
 
-    return bc_ds28e17_memory_write(ds28e17, &memory_transfer);
+    if (!bc_ds28e17_read(&sensor->_ds28e17, &transfer))
+    {
+        return false;
+    }
+
+    if ((buffer[0] & 0xc0) == 0)
+    {
+        sensor->_cap_raw = (uint16_t) (buffer[0] & 0x3f) << 8 | buffer[1];
+
+        sensor->_cap_valid = true;
+    }
+
+    return true;
 }
 
-static bool _bc_soil_sensor_tmp112_data_fetch(bc_soil_sensor_sensor_t *sensor)
+static bc_soil_sensor_error_t _bc_soil_sensor_measurement_request(bc_soil_sensor_sensor_t *sensor)
 {
-    uint8_t buffer[2];
+    uint8_t zssc3123_buffer[] = { _BC_SOIL_SENSOR_ZSSC3123_ADDRESS << 1 };
+    uint8_t tmp112_buffer[] = { 0x81 };
 
-    bc_i2c_memory_transfer_t memory_transfer = {
-        .device_address = _BC_SOIL_SENSOR_TMP112_ADDRESS,
-        .memory_address = 0x01,
-        .buffer = buffer,
-        .length = 1
+    const bc_ds28e17_operation_t operation[] = {
+        {
+            .type = BC_DS28E17_OPERATION_WRITE,
+            .device_address = _BC_SOIL_SENSOR_ZSSC3123_ADDRESS,
+            .buffer = zssc3123_buffer,
+            .length = sizeof(zssc3123_buffer)
+        },
+        {
+            .type = BC_DS28E17_OPERATION_MEMORY_WRITE,
+            .device_address = _BC_SOIL_SENSOR_TMP112_ADDRESS,
+            .memory_address = 0x01,
+            .buffer = tmp112_buffer,
+            .length = sizeof(tmp112_buffer)
+        }
     };
 
-    if (!bc_ds28e17_memory_read(&sensor->_ds28e17, &memory_transfer))
+    int done = bc_ds28e17_execute(&sensor->_ds28e17, operation, 2);
+
+    if (done == 0)
     {
-        return false;
+        return BC_SOIL_SENSOR_ERROR_ZSSC3123_MEASUREMENT_REQUEST;
     }
 
-    if ((buffer[0] & 0x81) != 0x81)
+    if (done == 1)
     {
-        return false;
+        return BC_SOIL_SENSOR_ERROR_TMP112_MEASUREMENT_REQUEST;
     }
 
-    memory_transfer.memory_address = 0x00;
-    memory_transfer.length = 2;
+    return BC_SOIL_SENSOR_ERROR_NONE;
+}
 
-    if (!bc_ds28e17_memory_read(&sensor->_ds28e17, &memory_transfer))
+static bc_soil_sensor_error_t _bc_soil_sensor_data_fetch(bc_soil_sensor_sensor_t *sensor)
+{
+    uint8_t buffer[5];
+
+    bc_ds28e17_operation_t operation[3];
+
+    _bc_soil_sensor_fetch_setup(operation, buffer);
+
+    int done = bc_ds28e17_execute(&sensor->_ds28e17, operation, 3);
+
+    return _bc_soil_sensor_fetch_result(sensor, done, buffer);
+}
+
+static void _bc_soil_sensor_fetch_setup(bc_ds28e17_operation_t *operation, uint8_t *buffer)
+{
+    // TMP112 configuration to buffer[0], TMP112 temperature to buffer[1..2] and ZSSC3123 data to buffer[3..4]
+    operation[0].type = BC_DS28E17_OPERATION_MEMORY_READ;
+    operation[0].device_address = _BC_SOIL_SENSOR_TMP112_ADDRESS;
+    operation[0].memory_address = 0x01;
+    operation[0].buffer = &buffer[0];
+    operation[0].length = 1;
+
+    operation[1].type = BC_DS28E17_OPERATION_MEMORY_READ;
+    operation[1].device_address = _BC_SOIL_SENSOR_TMP112_ADDRESS;
+    operation[1].memory_address = 0x00;
+    operation[1].buffer = &buffer[1];
+    operation[1].length = 2;
+
+    operation[2].type = BC_DS28E17_OPERATION_READ;
+    operation[2].device_address = _BC_SOIL_SENSOR_ZSSC3123_ADDRESS;
+    operation[2].memory_address = 0;
+    operation[2].buffer = &buffer[3];
+    operation[2].length = 2;
+}
+
+static bc_soil_sensor_error_t _bc_soil_sensor_fetch_result(bc_soil_sensor_sensor_t *sensor, int done, const uint8_t *buffer)
+{
+    if ((done < 2) || ((buffer[0] & 0x81) != 0x81))
     {
-        return false;
+        return BC_SOIL_SENSOR_ERROR_TMP112_DATA_FETCH;
     }
 
-    sensor->_temperature_raw = (uint16_t) buffer[0] << 8 | buffer[1];
+    sensor->_temperature_raw = (uint16_t) buffer[1] << 8 | buffer[2];
     sensor->_temperature_valid = true;
 
-    return true;
+    if (done < 3)
+    {
+        return BC_SOIL_SENSOR_ERROR_ZSSC3123_DATA_FETCH;
+    }
+
+    if ((buffer[3] & 0xc0) == 0)
+    {
+        sensor->_cap_raw = (uint16_t) (buffer[3] & 0x3f) << 8 | buffer[4];
+        sensor->_cap_valid = true;
+    }
+
+    return BC_SOIL_SENSOR_ERROR_NONE;
 }
 
-static bool _bc_soil_sensor_zssc3123_measurement_request(bc_ds28e17_t *ds28e17)
+static bc_soil_sensor_error_t _bc_soil_sensor_fetch_sync(bc_soil_sensor_t *self)
 {
-    const uint8_t buffer[] = { _BC_SOIL_SENSOR_ZSSC3123_ADDRESS << 1 };
+    bc_onewire_auto_ds28e17_sleep_mode(false);
 
-    bc_i2c_transfer_t transfer = {
-        .device_address = _BC_SOIL_SENSOR_ZSSC3123_ADDRESS,
-        .buffer = (void *) buffer,
-        .length = sizeof(buffer)
-    };
+    for (int i = self->_fetch_index; i < self->_sensor_found; i++)
+    {
+        if (i + 1 == self->_sensor_found) // last sensor
+        {
+            bc_onewire_auto_ds28e17_sleep_mode(true);
+        }
+
+        bc_soil_sensor_error_t error = _bc_soil_sensor_data_fetch(&self->_sensor[i]);
+
+        if (error)
+        {
+            return error;
+        }
+    }
 
-    return bc_ds28e17_write(ds28e17, &transfer);
+    return BC_SOIL_SENSOR_ERROR_NONE;
 }
 
-static bool _bc_soil_sensor_zssc3123_data_fetch(bc_soil_sensor_sensor_t *sensor)
+static bool _bc_soil_sensor_fetch_async(bc_soil_sensor_t *self)
 {
-    uint8_t buffer[2];
+    bc_ds28e17_t *ds28e17 = &self->_sensor[self->_fetch_index]._ds28e17;
 
-    bc_i2c_transfer_t transfer = {
-        .device_address = _BC_SOIL_SENSOR_ZSSC3123_ADDRESS,
-        .buffer = buffer,
-        .length = sizeof(buffer)
-    };
+    _bc_soil_sensor_fetch_setup(self->_fetch_operation, self->_fetch_buffer);
 
-    if (!bc_ds28e17_read(&sensor->_ds28e17, &transfer))
-    {
-        return false;
-    }
+    return bc_ds28e17_async_execute(ds28e17, self->_fetch_operation, 3, _bc_soil_sensor_fetch_async_handler, self);
+}
 
-    if ((buffer[0] & 0xc0) == 0)
-    {
-        sensor->_cap_raw = (uint16_t) (buffer[0] & 0x3f) << 8 | buffer[1];
+static void _bc_soil_sensor_fetch_async_handler(bc_ds28e17_t *ds28e17, bc_ds28e17_event_t event, void *param)
+{
+    (void) ds28e17;
+    (void) event;
 
-        sensor->_cap_valid = true;
-    }
+    bc_soil_sensor_t *self = param;
 
-    return true;
+    // Result is evaluated from number of executed operations
+    bc_scheduler_plan_now(self->_task_id_measure);
 }
 
 static bc_soil_sensor_error_t _bc_soil_sensor_eeprom_load(bc_soil_sensor_sensor_t *sensor)
@@ -681,11 +908,13 @@ static bc_soil_sensor_error_t _bc_soil_sensor_eeprom_load(bc_soil_sensor_sensor_
         return BC_SOIL_SENSOR_ERROR_EEPROM_PAYLOAD_READ;
     }
 
-    if (header.crc != bc_onewire_crc16(&sensor->_eeprom, sizeof(bc_soil_sensor_eeprom_t), 0))
+    if (header.crc != bc_crc16_ibm(&sensor->_eeprom, sizeof(bc_soil_sensor_eeprom_t), 0))
     {
         return BC_SOIL_SENSOR_ERROR_EEPROM_PAYLOAD_CRC;
     }
 
+    _bc_soil_sensor_calibration_update(sensor);
+
     return BC_SOIL_SENSOR_ERROR_NONE;
 }
 
@@ -705,6 +934,8 @@ static void _bc_soil_sensor_eeprom_fill(bc_soil_sensor_sensor_t *sensor)
     }
 
     memset(sensor->_eeprom.label, 0, sizeof(sensor->_eeprom.label));
+
+    _bc_soil_sensor_calibration_update(sensor);
 }
 
 static bool _bc_soil_sensor_eeprom_save(bc_soil_sensor_sensor_t *sensor)
@@ -713,7 +944,7 @@ static bool _bc_soil_sensor_eeprom_save(bc_soil_sensor_sensor_t *sensor)
         .signature = 0xdeadbeef,
         .version = 1,
         .length = sizeof(bc_soil_sensor_eeprom_t),
-        .crc = bc_onewire_crc16(&sensor->_eeprom, sizeof(bc_soil_sensor_eeprom_t), 0)
+        .crc = bc_crc16_ibm(&sensor->_eeprom, sizeof(bc_soil_sensor_eeprom_t), 0)
     };
 
     if (!_bc_soil_sensor_eeprom_write(sensor, 0, &header, sizeof(header)))
@@ -859,3 +1090,187 @@ static bool _bc_soil_sensor_eeprom_write(bc_soil_sensor_sensor_t *sensor, uint8_
 
     return true;
 }
+
+static bool _bc_soil_sensor_cache_load(bc_soil_sensor_t *self)
+{
+    bc_soil_sensor_eeprom_header_t header;
+
+    if (self->_cache_address == BC_SOIL_SENSOR_CACHE_DISABLED)
+    {
+        return false;
+    }
+
+    if (!bc_eeprom_read(self->_cache_address, &header, sizeof(header)))
+    {
+        return false;
+    }
+
+    if ((header.signature != _BC_SOIL_SENSOR_CACHE_SIGNATURE) || (header.version != _BC_SOIL_SENSOR_CACHE_VERSION))
+    {
+        return false;
+    }
+
+    if ((header.length == 0) || (header.length > self->_sensor_count))
+    {
+        return false;
+    }
+
+    uint32_t address = self->_cache_address + sizeof(header);
+    uint16_t crc = 0;
+
+    for (int i = 0; i < header.length; i++)
+    {
+        bc_soil_sensor_sensor_t *sensor = &self->_sensor[i];
+        uint64_t device_number;
+
+        if (!bc_eeprom_read(address, &device_number, sizeof(device_number)) ||
+            !bc_eeprom_read(address + sizeof(device_number), &sensor->_eeprom, sizeof(sensor->_eeprom)))
+        {
+            return false;
+        }
+
+        crc = bc_crc16_ibm(&device_number, sizeof(device_number), crc);
+        crc = bc_crc16_ibm(&sensor->_eeprom, sizeof(sensor->_eeprom), crc);
+
+        bc_ds28e17_init(&sensor->_ds28e17, self->_channel, device_number);
+
+        _bc_soil_sensor_calibration_update(sensor);
+
+        address += _BC_SOIL_SENSOR_CACHE_ENTRY_SIZE;
+    }
+
+    if (crc != header.crc)
+    {
+        return false;
+    }
+
+    self->_sensor_found = header.length;
+
+    return true;
+}
+
+static void _bc_soil_sensor_cache_save(bc_soil_sensor_t *self)
+{
+    bc_soil_sensor_eeprom_header_t header;
+
+    if ((self->_cache_address == BC_SOIL_SENSOR_CACHE_DISABLED) || (self->_sensor_found == 0))
+    {
+        return;
+    }
+
+    header.signature = _BC_SOIL_SENSOR_CACHE_SIGNATURE;
+    header.version = _BC_SOIL_SENSOR_CACHE_VERSION;
+    header.length = self->_sensor_found;
+    header.crc = 0;
+
+    uint32_t address = self->_cache_address + sizeof(header);
+
+    for (int i = 0; i < self->_sensor_found; i++)
+    {
+        bc_soil_sensor_sensor_t *sensor = &self->_sensor[i];
+
+        header.crc = bc_crc16_ibm(&sensor->_ds28e17._device_number, sizeof(uint64_t), header.crc);
+        header.crc = bc_crc16_ibm(&sensor->_eeprom, sizeof(sensor->_eeprom), header.crc);
+
+        // Entries are written before header, so interrupted save leaves header with wrong CRC
+        bc_eeprom_write(address, &sensor->_ds28e17._device_number, sizeof(uint64_t));
+        bc_eeprom_write(address + sizeof(uint64_t), &sensor->_eeprom, sizeof(sensor->_eeprom));
+
+        address += _BC_SOIL_SENSOR_CACHE_ENTRY_SIZE;
+    }
+
+    // Unchanged words are not programmed by bc_eeprom_write, so saving unchanged cache costs no endurance
+    bc_eeprom_write(self->_cache_address, &header, sizeof(header));
+}
+
+static void _bc_soil_sensor_cache_drop(bc_soil_sensor_t *self)
+{
+    // Cleared signature fails the next cache load, so the power cycle leads to full search which saves the cache again
+    if (self->_cache_address != BC_SOIL_SENSOR_CACHE_DISABLED)
+    {
+        uint32_t signature = 0;
+
+        bc_eeprom_write(self->_cache_address + offsetof(bc_soil_sensor_eeprom_header_t, signature), &signature, sizeof(signature));
+    }
+
+    self->_cache_valid = false;
+
+    bc_onewire_auto_ds28e17_sleep_mode(true);
+
+    bc_onewire_set_speed(self->_channel, BC_ONEWIRE_SPEED_STANDARD);
+
+    bc_module_sensor_onewire_power_down();
+
+    self->_state = BC_SOIL_SENSOR_STATE_PREINITIALIZE;
+
+    bc_scheduler_plan_current_now();
+}
+
+static void _bc_soil_sensor_calibration_update(bc_soil_sensor_sensor_t *sensor)
+{
+    uint16_t *calibration = sensor->_eeprom.calibration;
+
+    // Every segment spans 10 % which is expressed in Q16 per raw capacitance unit
+    for (int i = 0; i < 10; i++)
+    {
+        if (calibration[i + 1] > calibration[i])
+        {
+            sensor->_calibration_slope[i] = (10UL << 16) / (calibration[i + 1] - calibration[i]);
+        }
+        else
+        {
+            sensor->_calibration_slope[i] = 0;
+        }
+    }
+}
+
+static int _bc_soil_sensor_moisture_tenths(bc_soil_sensor_sensor_t *sensor)
+{
+    uint16_t *calibration = sensor->_eeprom.calibration;
+
+    int32_t raw = sensor->_cap_raw;
+
+    // Coefficient and temperature are both in 1/256 units
+    if (sensor->_temperature_valid && (sensor->_temperature_coefficient != 0))
+    {
+        raw -= ((int32_t) sensor->_temperature_coefficient * (sensor->_temperature_raw - _BC_SOIL_SENSOR_REFERENCE_TEMPERATURE)) >> 16;
+    }
+
+    if (raw < calibration[0])
+    {
+        return 0;
+    }
+
+    if (raw >= calibration[10])
+    {
+        return 1000;
+    }
+
+    // Find segment so that calibration[low] <= raw < calibration[high]
+    int low = 0;
+    int high = 10;
+
+    while (high - low > 1)
+    {
+        int middle = (low + high) / 2;
+
+        if (raw < calibration[middle])
+        {
+            high = middle;
+        }
+        else
+        {
+            low = middle;
+        }
+    }
+
+    uint32_t q16 = ((uint32_t) low * 10 << 16) + (uint32_t) (raw - calibration[low]) * sensor->_calibration_slope[low];
+
+    // Non-increasing calibration points could overflow segment
+    if (q16 > (100UL << 16))
+    {
+        q16 = 100UL << 16;
+    }
+
+    return (int) ((q16 * 10 + 0x8000) >> 16);
+}
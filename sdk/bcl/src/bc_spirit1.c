@@ -3,6 +3,7 @@
 #include <bc_exti.h>
 #include <bc_system.h>
 #include <bc_timer.h>
+#include <bc_energy.h>
 #include <stm32l0xx.h>
 #include "SPIRIT_Config.h"
 #include "SDK_Configuration_Common.h"
@@ -77,6 +78,7 @@ SGpioInit xGpioIRQ={
   SPIRIT_GPIO_DIG_OUT_IRQ
 };
 
+static void _bc_spirit1_set_current_state(bc_spirit1_state_t state);
 static void _bc_spirit1_enter_state_tx(void);
 static void _bc_spirit1_check_state_tx(void);
 static void _bc_spirit1_enter_state_rx(void);
@@ -239,6 +241,11 @@ void bc_spirit1_rx(void)
     }
 }
 
+bool bc_spirit1_is_tx(void)
+{
+    return (_bc_spirit1.desired_state == BC_SPIRIT1_STATE_TX) || (_bc_spirit1.current_state == BC_SPIRIT1_STATE_TX);
+}
+
 void bc_spirit1_sleep(void)
 {
     _bc_spirit1.desired_state = BC_SPIRIT1_STATE_SLEEP;
@@ -299,11 +306,19 @@ static void _bc_spirit1_task(void *param)
     }
 }
 
+static void _bc_spirit1_set_current_state(bc_spirit1_state_t state)
+{
+    _bc_spirit1.current_state = state;
+
+    bc_energy_set_state(BC_ENERGY_SUBSYSTEM_RADIO_TX, state == BC_SPIRIT1_STATE_TX);
+    bc_energy_set_state(BC_ENERGY_SUBSYSTEM_RADIO_RX, state == BC_SPIRIT1_STATE_RX);
+}
+
 static void _bc_spirit1_enter_state_tx(void)
 {
     GPIOA->PUPDR |= GPIO_PUPDR_PUPD7_1;
 
-    _bc_spirit1.current_state = BC_SPIRIT1_STATE_TX;
+    _bc_spirit1_set_current_state(BC_SPIRIT1_STATE_TX);
 
     SpiritCmdStrobeSabort();
     SpiritCmdStrobeReady();
@@ -361,7 +376,7 @@ static void _bc_spirit1_enter_state_rx(void)
 {
     GPIOA->PUPDR |= GPIO_PUPDR_PUPD7_1;
 
-    _bc_spirit1.current_state = BC_SPIRIT1_STATE_RX;
+    _bc_spirit1_set_current_state(BC_SPIRIT1_STATE_RX);
 
     if (_bc_spirit1.rx_timeout == BC_TICK_INFINITY)
     {
@@ -454,7 +469,7 @@ static void _bc_spirit1_check_state_rx(void)
 
 static void _bc_spirit1_enter_state_sleep(void)
 {
-    _bc_spirit1.current_state = BC_SPIRIT1_STATE_SLEEP;
+    _bc_spirit1_set_current_state(BC_SPIRIT1_STATE_SLEEP);
 
     SpiritCmdStrobeSabort();
     SpiritCmdStrobeReady();
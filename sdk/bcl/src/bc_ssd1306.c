@@ -93,11 +93,80 @@ void bc_ssd1306_draw_pixel(bc_ssd1306_t *self, int x, int y, uint32_t color)
 
 uint32_t bc_ssd1306_get_pixel(bc_ssd1306_t *self, int x, int y)
 {
-    (void) self;
-    (void) x;
-    (void) y;
+    return (self->_framebuffer->buffer[x + (y / 8) * self->_framebuffer->width] >> (y % 8)) & 1;
+}
+
+void bc_ssd1306_draw_hspan(bc_ssd1306_t *self, int left, int top, int width, uint32_t color)
+{
+    bc_ssd1306_fill_rect(self, left, top, width, 1, color);
+}
+
+void bc_ssd1306_fill_rect(bc_ssd1306_t *self, int left, int top, int width, int height, uint32_t color)
+{
+    int bottom = top + height - 1;
+
+    for (int page = top / 8; page <= bottom / 8; page++)
+    {
+        // Rows of the page which are covered by rectangle
+        uint8_t mask = 0xff;
+
+        if (page == top / 8)
+        {
+            mask &= 0xff << (top % 8);
+        }
 
-    return 0;
+        if (page == bottom / 8)
+        {
+            mask &= 0xff >> (7 - bottom % 8);
+        }
+
+        uint8_t *column = &self->_framebuffer->buffer[left + page * self->_framebuffer->width];
+
+        if (mask == 0xff)
+        {
+            memset(column, color == 0 ? 0x00 : 0xff, width);
+        }
+        else if (color == 0)
+        {
+            for (int i = 0; i < width; i++)
+            {
+                column[i] &= ~mask;
+            }
+        }
+        else
+        {
+            for (int i = 0; i < width; i++)
+            {
+                column[i] |= mask;
+            }
+        }
+    }
+}
+
+void bc_ssd1306_blit(bc_ssd1306_t *self, int left, int top, const uint8_t *image, int width, int height)
+{
+    int bytes = (width + 7) / 8;
+
+    for (int y = 0; y < height; y++)
+    {
+        uint8_t *column = &self->_framebuffer->buffer[left + ((top + y) / 8) * self->_framebuffer->width];
+
+        uint8_t mask = 1 << ((top + y) % 8);
+
+        const uint8_t *row = &image[y * bytes];
+
+        for (int x = 0; x < width; x++)
+        {
+            if (row[x / 8] & (1 << (x % 8)))
+            {
+                column[x] |= mask;
+            }
+            else
+            {
+                column[x] &= ~mask;
+            }
+        }
+    }
 }
 
 bool bc_ssd1306_update(bc_ssd1306_t *self)
@@ -142,7 +211,10 @@ const bc_gfx_driver_t *bc_ssd1306_get_driver(void)
         .draw_pixel = (void (*)(void *, int, int, uint32_t)) bc_ssd1306_draw_pixel,
         .get_pixel = (uint32_t (*)(void *, int, int)) bc_ssd1306_get_pixel,
         .update = (bool (*)(void *)) bc_ssd1306_update,
-        .get_caps = (bc_gfx_caps_t (*)(void *)) bc_ssd1306_get_caps
+        .get_caps = (bc_gfx_caps_t (*)(void *)) bc_ssd1306_get_caps,
+        .draw_hspan = (void (*)(void *, int, int, int, uint32_t)) bc_ssd1306_draw_hspan,
+        .fill_rect = (void (*)(void *, int, int, int, int, uint32_t)) bc_ssd1306_fill_rect,
+        .blit = (void (*)(void *, int, int, const uint8_t *, int, int)) bc_ssd1306_blit
     };
 
     return &driver;
@@ -3,6 +3,8 @@
 #include <bc_irq.h>
 #include <bc_i2c.h>
 #include <bc_timer.h>
+#include <bc_energy.h>
+#include <bc_log.h>
 #include <stm32l0xx.h>
 
 #define _BC_SYSTEM_DEBUG_ENABLE 0
@@ -281,7 +283,15 @@ static void _bc_system_init_shutdown_tmp112(void)
 
 void bc_system_sleep(void)
 {
+    // Core draws almost run current in sleep mode, only stop mode counts as sleeping
+    if ((SCB->SCR & SCB_SCR_SLEEPDEEP_Msk) != 0)
+    {
+        bc_energy_set_state(BC_ENERGY_SUBSYSTEM_MCU_RUN, false);
+    }
+
     __WFI();
+
+    bc_energy_set_state(BC_ENERGY_SUBSYSTEM_MCU_RUN, true);
 }
 
 void bc_system_deep_sleep_enable(void)
@@ -440,6 +450,8 @@ void bc_system_pll_enable(void)
 
         // Update SystemCoreClock variable
         SystemCoreClock = 32000000;
+
+        bc_energy_set_state(BC_ENERGY_SUBSYSTEM_PLL, true);
     }
 }
 
@@ -447,6 +459,8 @@ void bc_system_pll_disable(void)
 {
     if (--_bc_system_pll_enable_semaphore == 0)
     {
+        bc_energy_set_state(BC_ENERGY_SUBSYSTEM_PLL, false);
+
         _bc_system_switch_clock(BC_SYSTEM_CLOCK_HSI);
 
         // Turn PLL off
@@ -505,6 +519,9 @@ __attribute__((weak)) void bc_system_error(void)
 #ifdef RELEASE
     bc_system_reset();
 #else
+    // Messages waiting in log buffer are transmitted, they may tell what went wrong
+    bc_log_flush_on_fault();
+
     for (;;);
 #endif
 }
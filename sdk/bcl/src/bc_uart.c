@@ -5,6 +5,13 @@
 #include <stm32l0xx.h>
 #include <bc_dma.h>
 
+typedef struct
+{
+    bc_dma_channel_t channel;
+    bc_dma_request_t request;
+
+} bc_uart_dma_t;
+
 typedef struct
 {
     bool initialized;
@@ -18,6 +25,11 @@ typedef struct
     bool async_read_in_progress;
     bc_tick_t async_timeout;
     USART_TypeDef *usart;
+    const bc_uart_dma_t *dma_tx;
+    const bc_uart_dma_t *dma_rx;
+    size_t dma_tx_length;
+    bool dma_rx_in_progress;
+    bool async_write_hold;
 
 } bc_uart_t;
 
@@ -28,12 +40,16 @@ static bc_uart_t _bc_uart[3] =
     [BC_UART_UART2] = { .initialized = false }
 };
 
-static struct
-{
-    bc_scheduler_task_id_t read_task_id;
-    size_t length;
+// DMA channels of USART4 and USART2 (or LPUART1) are shared, the one which starts transfer first gets DMA channel,
+// channel 7 is used by 1-Wire async transfers too
+static const bc_uart_dma_t _bc_uart_dma_usart4_tx = { BC_DMA_CHANNEL_7, BC_DMA_REQUEST_12 };
+static const bc_uart_dma_t _bc_uart_dma_usart4_rx = { BC_DMA_CHANNEL_6, BC_DMA_REQUEST_12 };
+static const bc_uart_dma_t _bc_uart_dma_usart2_tx = { BC_DMA_CHANNEL_7, BC_DMA_REQUEST_4 };
+static const bc_uart_dma_t _bc_uart_dma_usart2_rx = { BC_DMA_CHANNEL_6, BC_DMA_REQUEST_4 };
+static const bc_uart_dma_t _bc_uart_dma_lpuart1_tx = { BC_DMA_CHANNEL_7, BC_DMA_REQUEST_5 };
+static const bc_uart_dma_t _bc_uart_dma_usart1_tx = { BC_DMA_CHANNEL_4, BC_DMA_REQUEST_3 };
+static const bc_uart_dma_t _bc_uart_dma_usart1_rx = { BC_DMA_CHANNEL_3, BC_DMA_REQUEST_3 };
 
-} _bc_uart_2_dma;
 
 static uint32_t _bc_uart_brr_t[] =
 {
@@ -47,11 +63,27 @@ static uint32_t _bc_uart_brr_t[] =
 
 static void _bc_uart_async_write_task(void *param);
 static void _bc_uart_async_read_task(void *param);
-static void _bc_uart_2_dma_read_task(void *param);
+static void _bc_uart_async_write_start(bc_uart_channel_t channel);
+static void _bc_uart_async_write_hold(bc_uart_channel_t channel);
+static void _bc_uart_async_write_resume(bc_uart_channel_t channel);
+static bool _bc_uart_dma_acquire(bc_uart_channel_t channel, const bc_uart_dma_t *dma);
+static void _bc_uart_dma_tx_start(bc_uart_channel_t channel);
+static void _bc_uart_dma_tx_event_handler(bc_dma_channel_t dma_channel, bc_dma_event_t event, void *event_param);
+static void _bc_uart_dma_rx_start(bc_uart_channel_t channel);
+static void _bc_uart_dma_rx_update(bc_uart_channel_t channel);
+static void _bc_uart_dma_rx_event_handler(bc_dma_channel_t dma_channel, bc_dma_event_t event, void *event_param);
 static void _bc_uart_irq_handler(bc_uart_channel_t channel);
 
 void bc_uart_init(bc_uart_channel_t channel, bc_uart_baudrate_t baudrate, bc_uart_setting_t setting)
 {
+    if (_bc_uart[channel].initialized)
+    {
+        // Release DMA channels and scheduler tasks of previous initialization
+        bc_uart_async_write_flush(channel);
+
+        bc_uart_async_read_cancel(channel);
+    }
+
     memset(&_bc_uart[channel], 0, sizeof(_bc_uart[channel]));
 
     switch(channel)
@@ -91,6 +123,8 @@ void bc_uart_init(bc_uart_channel_t channel, bc_uart_baudrate_t baudrate, bc_uar
             NVIC_EnableIRQ(USART4_5_IRQn);
 
             _bc_uart[channel].usart = USART4;
+            _bc_uart[channel].dma_tx = &_bc_uart_dma_usart4_tx;
+            _bc_uart[channel].dma_rx = &_bc_uart_dma_usart4_rx;
 
             break;
         }
@@ -134,6 +168,9 @@ void bc_uart_init(bc_uart_channel_t channel, bc_uart_baudrate_t baudrate, bc_uar
                 NVIC_EnableIRQ(LPUART1_IRQn);
 
                 _bc_uart[channel].usart = LPUART1;
+
+                // Receiver stays on interrupts, DMA does not run in stop mode
+                _bc_uart[channel].dma_tx = &_bc_uart_dma_lpuart1_tx;
             }
             else
             {
@@ -161,6 +198,8 @@ void bc_uart_init(bc_uart_channel_t channel, bc_uart_baudrate_t baudrate, bc_uar
                 NVIC_EnableIRQ(USART2_IRQn);
 
                 _bc_uart[channel].usart = USART2;
+                _bc_uart[channel].dma_tx = &_bc_uart_dma_usart2_tx;
+                _bc_uart[channel].dma_rx = &_bc_uart_dma_usart2_rx;
             }
 
             break;
@@ -200,6 +239,8 @@ void bc_uart_init(bc_uart_channel_t channel, bc_uart_baudrate_t baudrate, bc_uar
             NVIC_EnableIRQ(USART1_IRQn);
 
             _bc_uart[channel].usart = USART1;
+            _bc_uart[channel].dma_tx = &_bc_uart_dma_usart1_tx;
+            _bc_uart[channel].dma_rx = &_bc_uart_dma_usart1_rx;
 
             break;
         }
@@ -329,11 +370,14 @@ void bc_uart_deinit(bc_uart_channel_t channel)
 
 size_t bc_uart_write(bc_uart_channel_t channel, const void *buffer, size_t length)
 {
-    if (!_bc_uart[channel].initialized || _bc_uart[channel].async_write_in_progress)
+    if (!_bc_uart[channel].initialized)
     {
         return 0;
     }
 
+    // Data written asynchronously go first, so order is kept
+    _bc_uart_async_write_hold(channel);
+
     USART_TypeDef *usart = _bc_uart[channel].usart;
 
     size_t bytes_written = 0;
@@ -366,6 +410,8 @@ size_t bc_uart_write(bc_uart_channel_t channel, const void *buffer, size_t lengt
         bc_system_pll_disable();
     }
 
+    _bc_uart_async_write_resume(channel);
+
     return bytes_written;
 }
 
@@ -459,17 +505,75 @@ size_t bc_uart_async_write(bc_uart_channel_t channel, const void *buffer, size_t
             bc_scheduler_plan_absolute(_bc_uart[channel].async_write_task_id, BC_TICK_INFINITY);
         }
 
-        bc_irq_disable();
+        _bc_uart[channel].async_write_in_progress = true;
 
-        // Enable transmit interrupt
-        _bc_uart[channel].usart->CR1 |= USART_CR1_TXEIE;
+        _bc_uart_async_write_start(channel);
+    }
 
-        bc_irq_enable();
+    return bytes_written;
+}
 
-        _bc_uart[channel].async_write_in_progress = true;
+void bc_uart_async_write_flush(bc_uart_channel_t channel)
+{
+    if (!_bc_uart[channel].initialized || !_bc_uart[channel].async_write_in_progress)
+    {
+        return;
     }
 
-    return bytes_written;
+    USART_TypeDef *usart = _bc_uart[channel].usart;
+
+    uint8_t character;
+
+    bc_irq_disable();
+
+    // Disable transmit interrupts, data are moved to transmit data register here
+    usart->CR1 &= ~(USART_CR1_TXEIE | USART_CR1_TCIE);
+
+    if (_bc_uart[channel].dma_tx_length != 0)
+    {
+        bc_dma_channel_t dma_channel = _bc_uart[channel].dma_tx->channel;
+
+        // Until DMA transfer is not complete...
+        while (bc_dma_channel_get_length(dma_channel) != 0 && (DMA1->ISR & (DMA_ISR_TEIF1 << (dma_channel * 4))) == 0)
+        {
+            continue;
+        }
+
+        bc_dma_channel_stop(dma_channel);
+
+        usart->CR3 &= ~USART_CR3_DMAT;
+
+        bc_fifo_t *fifo = _bc_uart[channel].write_fifo;
+
+        fifo->tail = (fifo->tail + _bc_uart[channel].dma_tx_length) % fifo->size;
+
+        _bc_uart[channel].dma_tx_length = 0;
+
+        bc_dma_channel_release(dma_channel, &_bc_uart[channel]);
+    }
+
+    while (bc_fifo_irq_read(_bc_uart[channel].write_fifo, &character, 1) != 0)
+    {
+        // Until transmit data register is not empty...
+        while ((usart->ISR & USART_ISR_TXE) == 0)
+        {
+            continue;
+        }
+
+        // Load transmit data register
+        usart->TDR = character;
+    }
+
+    // Until transmission is not complete...
+    while ((usart->ISR & USART_ISR_TC) == 0)
+    {
+        continue;
+    }
+
+    bc_irq_enable();
+
+    // Async write is finished here, scheduler may not run anymore
+    _bc_uart_async_write_task((void *) channel);
 }
 
 bool bc_uart_async_read_start(bc_uart_channel_t channel, bc_tick_t timeout)
@@ -483,32 +587,23 @@ bool bc_uart_async_read_start(bc_uart_channel_t channel, bc_tick_t timeout)
 
     _bc_uart[channel].async_read_task_id = bc_scheduler_register(_bc_uart_async_read_task, (void *) channel, _bc_uart[channel].async_timeout);
 
-    if (channel == BC_UART_UART2)
+    if (_bc_uart[channel].dma_rx != NULL && _bc_uart_dma_acquire(channel, _bc_uart[channel].dma_rx))
     {
-        bc_dma_channel_config_t config = {
-                .request = BC_DMA_REQUEST_3,
-                .direction = BC_DMA_DIRECTION_TO_RAM,
-                .data_size_memory = BC_DMA_SIZE_1,
-                .data_size_peripheral = BC_DMA_SIZE_1,
-                .length = _bc_uart[channel].read_fifo->size,
-                .mode = BC_DMA_MODE_CIRCULAR,
-                .address_memory = _bc_uart[channel].read_fifo->buffer,
-                .address_peripheral = (void *) &_bc_uart[channel].usart->RDR,
-                .priority = BC_DMA_PRIORITY_HIGH
-        };
-
-        bc_dma_init();
+        bc_dma_set_event_handler(_bc_uart[channel].dma_rx->channel, _bc_uart_dma_rx_event_handler, (void *) channel);
 
-        bc_dma_channel_config(BC_DMA_CHANNEL_3, &config);
+        _bc_uart[channel].dma_rx_in_progress = true;
 
-        _bc_uart_2_dma.read_task_id = bc_scheduler_register(_bc_uart_2_dma_read_task, (void *) channel, 0);
+        _bc_uart_dma_rx_start(channel);
 
         bc_irq_disable();
-        // Enable receive DMA interrupt
-        _bc_uart[channel].usart->CR3 |=  USART_CR3_DMAR;
-        bc_irq_enable();
 
-        bc_dma_channel_run(BC_DMA_CHANNEL_3);
+        // Enable receive DMA request and idle line interrupt, received data are picked up on half transfer,
+        // transfer complete and idle line events
+        _bc_uart[channel].usart->ICR = USART_ICR_IDLECF;
+        _bc_uart[channel].usart->CR3 |= USART_CR3_DMAR;
+        _bc_uart[channel].usart->CR1 |= USART_CR1_IDLEIE;
+
+        bc_irq_enable();
     }
     else
     {
@@ -537,16 +632,21 @@ bool bc_uart_async_read_cancel(bc_uart_channel_t channel)
 
     _bc_uart[channel].async_read_in_progress = false;
 
-    if (channel == BC_UART_UART2)
+    if (_bc_uart[channel].dma_rx_in_progress)
     {
-        bc_dma_channel_stop(BC_DMA_CHANNEL_3);
-
-        bc_scheduler_unregister(_bc_uart_2_dma.read_task_id);
+        bc_dma_channel_stop(_bc_uart[channel].dma_rx->channel);
 
         bc_irq_disable();
-        // Disable receive DMA interrupt
+
+        // Disable receive DMA request and idle line interrupt
         _bc_uart[channel].usart->CR3 &= ~USART_CR3_DMAR_Msk;
+        _bc_uart[channel].usart->CR1 &= ~USART_CR1_IDLEIE_Msk;
+
         bc_irq_enable();
+
+        _bc_uart[channel].dma_rx_in_progress = false;
+
+        bc_dma_channel_release(_bc_uart[channel].dma_rx->channel, &_bc_uart[channel]);
     }
     else
     {
@@ -624,30 +724,292 @@ static void _bc_uart_async_read_task(void *param)
     }
 }
 
-static void _bc_uart_2_dma_read_task(void *param)
+static void _bc_uart_async_write_start(bc_uart_channel_t channel)
 {
-    (void) param;
+    bc_uart_t *uart = &_bc_uart[channel];
 
-    size_t length = bc_dma_channel_get_length(BC_DMA_CHANNEL_3);
+    bc_irq_disable();
 
-    bc_uart_t *uart = &_bc_uart[BC_UART_UART2];
+    // If data are being transmitted, new data are picked up when transfer is done
+    if (uart->async_write_hold || uart->dma_tx_length != 0 || (uart->usart->CR1 & USART_CR1_TXEIE) != 0)
+    {
+        bc_irq_enable();
 
-    if (_bc_uart_2_dma.length != length)
+        return;
+    }
+
+    if (uart->dma_tx != NULL && _bc_uart_dma_acquire(channel, uart->dma_tx))
     {
-        uart->read_fifo->head = uart->read_fifo->size - length;
+        _bc_uart_dma_tx_start(channel);
+    }
+    else
+    {
+        // Enable transmit interrupt
+        uart->usart->CR1 |= USART_CR1_TXEIE;
+    }
 
-        _bc_uart_2_dma.length = length;
+    bc_irq_enable();
+}
+
+static void _bc_uart_async_write_hold(bc_uart_channel_t channel)
+{
+    bc_uart_t *uart = &_bc_uart[channel];
+    USART_TypeDef *usart = uart->usart;
+
+    uint8_t character;
+
+    bc_irq_disable();
+
+    // Data added from interrupts stay in FIFO until _bc_uart_async_write_resume
+    uart->async_write_hold = true;
+
+    // Disable transmit interrupts, data are moved to transmit data register here
+    usart->CR1 &= ~(USART_CR1_TXEIE | USART_CR1_TCIE);
+
+    bc_irq_enable();
+
+    if (!uart->async_write_in_progress)
+    {
+        return;
+    }
+
+    // Interrupts stay enabled while waiting, unlike in bc_uart_async_write_flush
+    if (uart->dma_tx_length != 0)
+    {
+        bc_dma_channel_t dma_channel = uart->dma_tx->channel;
+
+        // Until DMA transfer is not complete...
+        while (bc_dma_channel_get_length(dma_channel) != 0 && (DMA1->ISR & (DMA_ISR_TEIF1 << (dma_channel * 4))) == 0)
+        {
+            continue;
+        }
+
+        bc_irq_disable();
+
+        bc_dma_channel_stop(dma_channel);
+
+        usart->CR3 &= ~USART_CR3_DMAT;
+
+        bc_fifo_t *fifo = uart->write_fifo;
+
+        fifo->tail = (fifo->tail + uart->dma_tx_length) % fifo->size;
+
+        uart->dma_tx_length = 0;
+
+        bc_irq_enable();
+
+        bc_dma_channel_release(dma_channel, uart);
+    }
+
+    while (bc_fifo_read(uart->write_fifo, &character, 1) != 0)
+    {
+        // Until transmit data register is not empty...
+        while ((usart->ISR & USART_ISR_TXE) == 0)
+        {
+            continue;
+        }
+
+        // Load transmit data register
+        usart->TDR = character;
+    }
+}
+
+static void _bc_uart_async_write_resume(bc_uart_channel_t channel)
+{
+    bc_uart_t *uart = &_bc_uart[channel];
+
+    uart->async_write_hold = false;
+
+    if (!uart->async_write_in_progress)
+    {
+        return;
+    }
+
+    if (bc_fifo_is_empty(uart->write_fifo))
+    {
+        // Transmission is complete here, async write is finished in its task
+        bc_scheduler_plan_now(uart->async_write_task_id);
+    }
+    else
+    {
+        // Data added from interrupts meanwhile are transmitted as usual
+        _bc_uart_async_write_start(channel);
+    }
+}
+
+static bool _bc_uart_dma_acquire(bc_uart_channel_t channel, const bc_uart_dma_t *dma)
+{
+    // Channel 7 is shared with 1-Wire async transfers and channel 4 with DAC, so claim is done in bc_dma
+    if (!bc_dma_channel_claim(dma->channel, &_bc_uart[channel]))
+    {
+        return false;
+    }
+
+    bc_dma_init();
+
+    return true;
+}
+
+static void _bc_uart_dma_tx_start(bc_uart_channel_t channel)
+{
+    bc_uart_t *uart = &_bc_uart[channel];
+    bc_fifo_t *fifo = uart->write_fifo;
+
+    // Data stay in FIFO during transfer, so only continuous part up to the end of buffer can be transferred
+    size_t length = fifo->head >= fifo->tail ? fifo->head - fifo->tail : fifo->size - fifo->tail;
+
+    bc_dma_channel_config_t config = {
+            .request = uart->dma_tx->request,
+            .direction = BC_DMA_DIRECTION_TO_PERIPHERAL,
+            .data_size_memory = BC_DMA_SIZE_1,
+            .data_size_peripheral = BC_DMA_SIZE_1,
+            .length = length,
+            .mode = BC_DMA_MODE_STANDARD,
+            .address_memory = (uint8_t *) fifo->buffer + fifo->tail,
+            .address_peripheral = (void *) &uart->usart->TDR,
+            .priority = BC_DMA_PRIORITY_MEDIUM
+    };
+
+    bc_dma_channel_config(uart->dma_tx->channel, &config);
+
+    bc_dma_set_event_handler(uart->dma_tx->channel, _bc_uart_dma_tx_event_handler, (void *) channel);
+
+    uart->dma_tx_length = length;
+
+    // Transmission complete flag is cleared by the first write to transmit data register
+    uart->usart->CR1 &= ~USART_CR1_TCIE;
+
+    // Enable transmit DMA request
+    uart->usart->CR3 |= USART_CR3_DMAT;
+
+    bc_dma_channel_run(uart->dma_tx->channel);
+}
+
+static void _bc_uart_dma_tx_event_handler(bc_dma_channel_t dma_channel, bc_dma_event_t event, void *event_param)
+{
+    bc_uart_channel_t channel = (bc_uart_channel_t) event_param;
+    bc_uart_t *uart = &_bc_uart[channel];
+
+    if (event == BC_DMA_EVENT_HALF_DONE)
+    {
+        return;
+    }
+
+    bc_irq_disable();
+
+    // Event of transfer which has been finished by bc_uart_async_write_flush is ignored
+    if (uart->dma_tx_length == 0 || (event == BC_DMA_EVENT_DONE && bc_dma_channel_get_length(dma_channel) != 0))
+    {
+        bc_irq_enable();
+
+        return;
+    }
+
+    bc_dma_channel_stop(dma_channel);
+
+    bc_fifo_t *fifo = uart->write_fifo;
+
+    fifo->tail = (fifo->tail + uart->dma_tx_length) % fifo->size;
+
+    uart->dma_tx_length = 0;
+
+    // If there are still data in FIFO...
+    if (fifo->tail != fifo->head)
+    {
+        _bc_uart_dma_tx_start(channel);
+    }
+    else
+    {
+        // Disable transmit DMA request
+        uart->usart->CR3 &= ~USART_CR3_DMAT;
+
+        bc_dma_channel_release(dma_channel, uart);
+
+        // Enable transmission complete interrupt
+        uart->usart->CR1 |= USART_CR1_TCIE;
+    }
+
+    bc_irq_enable();
+}
+
+static void _bc_uart_dma_rx_start(bc_uart_channel_t channel)
+{
+    bc_uart_t *uart = &_bc_uart[channel];
+
+    bc_dma_channel_config_t config = {
+            .request = uart->dma_rx->request,
+            .direction = BC_DMA_DIRECTION_TO_RAM,
+            .data_size_memory = BC_DMA_SIZE_1,
+            .data_size_peripheral = BC_DMA_SIZE_1,
+            .length = uart->read_fifo->size,
+            .mode = BC_DMA_MODE_CIRCULAR,
+            .address_memory = uart->read_fifo->buffer,
+            .address_peripheral = (void *) &uart->usart->RDR,
+            .priority = BC_DMA_PRIORITY_HIGH
+    };
+
+    // DMA fills FIFO buffer from its beginning
+    bc_fifo_purge(uart->read_fifo);
+
+    bc_dma_channel_config(uart->dma_rx->channel, &config);
+
+    bc_dma_channel_run(uart->dma_rx->channel);
+}
+
+static void _bc_uart_dma_rx_update(bc_uart_channel_t channel)
+{
+    bc_uart_t *uart = &_bc_uart[channel];
+
+    // DMA counts down remaining bytes and it is reloaded at the end of buffer
+    size_t head = (uart->read_fifo->size - bc_dma_channel_get_length(uart->dma_rx->channel)) % uart->read_fifo->size;
+
+    if (uart->read_fifo->head != head)
+    {
+        uart->read_fifo->head = head;
 
         bc_scheduler_plan_now(uart->async_read_task_id);
     }
+}
+
+static void _bc_uart_dma_rx_event_handler(bc_dma_channel_t dma_channel, bc_dma_event_t event, void *event_param)
+{
+    (void) dma_channel;
+
+    bc_uart_channel_t channel = (bc_uart_channel_t) event_param;
+    bc_uart_t *uart = &_bc_uart[channel];
+
+    if (!uart->dma_rx_in_progress)
+    {
+        return;
+    }
+
+    if (event == BC_DMA_EVENT_ERROR)
+    {
+        // Channel is disabled by transfer error, data which have not been read yet are lost
+        _bc_uart_dma_rx_start(channel);
+
+        return;
+    }
 
-    bc_scheduler_plan_current_now();
+    bc_irq_disable();
+
+    _bc_uart_dma_rx_update(channel);
+
+    bc_irq_enable();
 }
 
 static void _bc_uart_irq_handler(bc_uart_channel_t channel)
 {
     USART_TypeDef *usart = _bc_uart[channel].usart;
 
+    // If it is idle line interrupt, DMA has stopped in the middle of receive buffer...
+    if ((usart->CR1 & USART_CR1_IDLEIE) != 0 && (usart->ISR & USART_ISR_IDLE) != 0)
+    {
+        usart->ICR = USART_ICR_IDLECF;
+
+        _bc_uart_dma_rx_update(channel);
+    }
+
     if ((usart->CR1 & USART_CR1_RXNEIE) != 0 && (usart->ISR & USART_ISR_RXNE) != 0)
     {
         uint8_t character;
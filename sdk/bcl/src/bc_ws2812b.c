@@ -13,9 +13,18 @@
 #define _BC_WS2812_BC_WS2812B_PORT GPIOA
 #define _BC_WS2812_BC_WS2812B_PIN GPIO_PIN_1
 
+// Color bytes encoded into one half of DMA window, a half takes 80 us to transmit
+#define _BC_WS2812B_HALF_BYTES 8
+// Every color byte is 8 compare values of 1 byte, they are written as 2 words
+#define _BC_WS2812B_HALF_WORDS (_BC_WS2812B_HALF_BYTES * 2)
+
 static struct ws2812b_t
 {
-    uint32_t *dma_bit_buffer;
+    uint8_t *pixels;
+    size_t length;
+    size_t position;
+    uint32_t dma_window[2 * _BC_WS2812B_HALF_WORDS];
+    bool half_has_data[2];
     const bc_led_strip_buffer_t *buffer;
 
     bool transfer;
@@ -31,7 +40,8 @@ static bc_dma_channel_config_t _bc_ws2812b_dma_config =
     .direction = BC_DMA_DIRECTION_TO_PERIPHERAL,
     .data_size_memory = BC_DMA_SIZE_1,
     .data_size_peripheral = BC_DMA_SIZE_2,
-    .mode = BC_DMA_MODE_STANDARD,
+    .length = 2 * _BC_WS2812B_HALF_WORDS * 4,
+    .mode = BC_DMA_MODE_CIRCULAR,
     .address_peripheral = (void *)&(TIM2->CCR2),
     .priority = BC_DMA_PRIORITY_VERY_HIGH
 };
@@ -61,6 +71,8 @@ const uint32_t _bc_ws2812b_pulse_tab[] =
 
 static void _bc_ws2812b_dma_event_handler(bc_dma_channel_t channel, bc_dma_event_t event, void *event_param);
 
+static void _bc_ws2812b_encode_half(int half);
+
 static void _bc_ws2812b_task(void *param);
 
 bool bc_ws2812b_init(const bc_led_strip_buffer_t *led_strip)
@@ -69,11 +81,12 @@ bool bc_ws2812b_init(const bc_led_strip_buffer_t *led_strip)
 
     _bc_ws2812b.buffer = led_strip;
 
-    _bc_ws2812b.dma_bit_buffer = led_strip->buffer;
+    // Pixels are kept as color bytes in order of transmission, they are encoded into DMA window while it is sent
+    _bc_ws2812b.pixels = (uint8_t *) led_strip->buffer;
 
-    size_t dma_bit_buffer_size = _bc_ws2812b.buffer->count * _bc_ws2812b.buffer->type * 8;
+    _bc_ws2812b.length = _bc_ws2812b.buffer->count * _bc_ws2812b.buffer->type;
 
-    memset(_bc_ws2812b.dma_bit_buffer, _BC_WS2812_COMPARE_PULSE_LOGIC_0, dma_bit_buffer_size);
+    memset(_bc_ws2812b.pixels, 0, _bc_ws2812b.length);
 
     __HAL_RCC_GPIOA_CLK_ENABLE();
 
@@ -87,7 +100,6 @@ bool bc_ws2812b_init(const bc_led_strip_buffer_t *led_strip)
     HAL_GPIO_Init(_BC_WS2812_BC_WS2812B_PORT, &GPIO_InitStruct);
 
     bc_dma_init();
-    bc_dma_set_event_handler(BC_DMA_CHANNEL_2, _bc_ws2812b_dma_event_handler, NULL);
 
      // TIM2 Periph clock enable
     __HAL_RCC_TIM2_CLK_ENABLE();
@@ -131,82 +143,31 @@ void bc_ws2812b_set_event_handler(void (*event_handler)(bc_ws2812b_event_t, void
 
 void bc_ws2812b_set_pixel_from_rgb(int position, uint8_t red, uint8_t green, uint8_t blue, uint8_t white)
 {
-    uint32_t calculated_position = (position * _bc_ws2812b.buffer->type * 2);
-
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(green & 0xf0) >> 4];
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[green & 0x0f];
+    uint8_t *pixel = &_bc_ws2812b.pixels[position * _bc_ws2812b.buffer->type];
 
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(red & 0xf0) >> 4];
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[red & 0x0f];
+    pixel[0] = green;
+    pixel[1] = red;
+    pixel[2] = blue;
 
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(blue & 0xf0) >> 4];
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[blue & 0x0f];
-
-     if (_bc_ws2812b.buffer->type == BC_LED_STRIP_TYPE_RGBW)
-     {
-         _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(white & 0xf0) >> 4];
-         _bc_ws2812b.dma_bit_buffer[calculated_position] = _bc_ws2812b_pulse_tab[white & 0x0f];
-     }
+    if (_bc_ws2812b.buffer->type == BC_LED_STRIP_TYPE_RGBW)
+    {
+        pixel[3] = white;
+    }
 }
 
 void bc_ws2812b_set_pixel_from_uint32(int position, uint32_t color)
 {
-    uint32_t calculated_position = (position * _bc_ws2812b.buffer->type * 2);
-
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(color & 0x00f00000) >> 20];
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(color & 0x000f0000) >> 16];
-
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(color & 0xf0000000) >> 28];
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(color & 0x0f000000) >> 24];
-
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(color & 0x0000f000) >> 12];
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(color & 0x00000f00) >>  8];
-
-     if (_bc_ws2812b.buffer->type == BC_LED_STRIP_TYPE_RGBW)
-     {
-         _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(color & 0x000000f0) >> 4];
-         _bc_ws2812b.dma_bit_buffer[calculated_position] = _bc_ws2812b_pulse_tab[color & 0x0000000f];
-     }
+    bc_ws2812b_set_pixel_from_rgb(position, color >> 24, color >> 16, color >> 8, color);
 }
 
 void bc_ws2812b_set_pixel_from_rgb_swap_rg(int position, uint8_t red, uint8_t green, uint8_t blue, uint8_t white)
 {
-    uint32_t calculated_position = (position * _bc_ws2812b.buffer->type * 2);
-
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(red & 0xf0) >> 4];
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[red & 0x0f];
-
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(green & 0xf0) >> 4];
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[green & 0x0f];
-
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(blue & 0xf0) >> 4];
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[blue & 0x0f];
-
-     if (_bc_ws2812b.buffer->type == BC_LED_STRIP_TYPE_RGBW)
-     {
-         _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(white & 0xf0) >> 4];
-         _bc_ws2812b.dma_bit_buffer[calculated_position] = _bc_ws2812b_pulse_tab[white & 0x0f];
-     }
+    bc_ws2812b_set_pixel_from_rgb(position, green, red, blue, white);
 }
 
 void bc_ws2812b_set_pixel_from_uint32_swap_rg(int position, uint32_t color)
 {
-    uint32_t calculated_position = (position * _bc_ws2812b.buffer->type * 2);
-
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(color & 0xf0000000) >> 28];
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(color & 0x0f000000) >> 24];
-
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(color & 0x00f00000) >> 20];
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(color & 0x000f0000) >> 16];
-
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(color & 0x0000f000) >> 12];
-    _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(color & 0x00000f00) >>  8];
-
-     if (_bc_ws2812b.buffer->type == BC_LED_STRIP_TYPE_RGBW)
-     {
-         _bc_ws2812b.dma_bit_buffer[calculated_position++] = _bc_ws2812b_pulse_tab[(color & 0x000000f0) >> 4];
-         _bc_ws2812b.dma_bit_buffer[calculated_position] = _bc_ws2812b_pulse_tab[color & 0x0000000f];
-     }
+    bc_ws2812b_set_pixel_from_rgb(position, color >> 16, color >> 24, color >> 8, color);
 }
 
 bool bc_ws2812b_write(void)
@@ -230,10 +191,16 @@ bool bc_ws2812b_write(void)
     // clear all TIM2 flags
     __HAL_TIM_CLEAR_FLAG(&_bc_ws2812b_timer2_handle, TIM_FLAG_UPDATE | TIM_FLAG_CC1 | TIM_FLAG_CC2 | TIM_FLAG_CC3 | TIM_FLAG_CC4);
 
-    size_t dma_bit_buffer_size = _bc_ws2812b.buffer->count * _bc_ws2812b.buffer->type * 8;
+    // Both halves of window are encoded in advance, then each one is refilled after it has been sent
+    _bc_ws2812b.position = 0;
+
+    _bc_ws2812b_encode_half(0);
+    _bc_ws2812b_encode_half(1);
 
-    _bc_ws2812b_dma_config.address_memory = (void *)_bc_ws2812b.dma_bit_buffer;
-    _bc_ws2812b_dma_config.length = dma_bit_buffer_size;
+    // Channel can be shared with other drivers, so the handler is set for every transfer
+    bc_dma_set_irq_event_handler(BC_DMA_CHANNEL_2, _bc_ws2812b_dma_event_handler, NULL);
+
+    _bc_ws2812b_dma_config.address_memory = (void *)_bc_ws2812b.dma_window;
     bc_dma_channel_config(BC_DMA_CHANNEL_2, &_bc_ws2812b_dma_config);
     bc_dma_channel_run(BC_DMA_CHANNEL_2);
 
@@ -259,38 +226,74 @@ bool bc_ws2812b_is_ready(void)
     return !_bc_ws2812b.transfer;
 }
 
+static void _bc_ws2812b_encode_half(int half)
+{
+    uint32_t *window = &_bc_ws2812b.dma_window[half * _BC_WS2812B_HALF_WORDS];
+
+    _bc_ws2812b.half_has_data[half] = _bc_ws2812b.position < _bc_ws2812b.length;
+
+    for (int i = 0; i < _BC_WS2812B_HALF_WORDS; i += 2)
+    {
+        if (_bc_ws2812b.position < _bc_ws2812b.length)
+        {
+            uint8_t byte = _bc_ws2812b.pixels[_bc_ws2812b.position++];
+
+            window[i] = _bc_ws2812b_pulse_tab[byte >> 4];
+            window[i + 1] = _bc_ws2812b_pulse_tab[byte & 0x0f];
+        }
+        else
+        {
+            // Zero compare keeps output low, it is a part of reset pulse
+            window[i] = 0;
+            window[i + 1] = 0;
+        }
+    }
+}
+
 static void _bc_ws2812b_dma_event_handler(bc_dma_channel_t channel, bc_dma_event_t event, void *event_param)
 {
     (void) channel;
-    (void) event;
     (void) event_param;
 
-    if (event == BC_DMA_EVENT_DONE)
+    // Called from DMA interrupt, half of window has been sent and DMA continues with the other one
+    if (event != BC_DMA_EVENT_ERROR)
     {
-        // Stop timer
-        TIM2->CR1 &= ~TIM_CR1_CEN;
+        int half = event == BC_DMA_EVENT_HALF_DONE ? 0 : 1;
+
+        if (_bc_ws2812b.half_has_data[half])
+        {
+            _bc_ws2812b_encode_half(half);
 
-        // Disable the DMA requests
-        __HAL_TIM_DISABLE_DMA(&_bc_ws2812b_timer2_handle, TIM_DMA_UPDATE);
+            return;
+        }
+    }
 
-        // Disable PWM output Compare 2
-        (&_bc_ws2812b_timer2_handle)->Instance->CCMR1 &= ~(TIM_CCMR1_OC2M_Msk);
-        (&_bc_ws2812b_timer2_handle)->Instance->CCMR1 |= TIM_CCMR1_OC2M_2;
+    // All pixels have been sent, halves which follow have no data
+    bc_dma_channel_stop(BC_DMA_CHANNEL_2);
 
-        // Set 50us period for Treset pulse
-        TIM2->ARR = _BC_WS2812_TIMER_RESET_PULSE_PERIOD;
-        // Reset the timer
-        TIM2->CNT = 0;
+    // Stop timer
+    TIM2->CR1 &= ~TIM_CR1_CEN;
 
-        // Generate an update event to reload the prescaler value immediately
-        TIM2->EGR = TIM_EGR_UG;
-        __HAL_TIM_CLEAR_FLAG(&_bc_ws2812b_timer2_handle, TIM_FLAG_UPDATE);
+    // Disable the DMA requests
+    __HAL_TIM_DISABLE_DMA(&_bc_ws2812b_timer2_handle, TIM_DMA_UPDATE);
 
-        // Enable TIM2 Update interrupt for Treset signal
-        __HAL_TIM_ENABLE_IT(&_bc_ws2812b_timer2_handle, TIM_IT_UPDATE);
-        // Enable timer
-        TIM2->CR1 |= TIM_CR1_CEN;
-    }
+    // Disable PWM output Compare 2
+    (&_bc_ws2812b_timer2_handle)->Instance->CCMR1 &= ~(TIM_CCMR1_OC2M_Msk);
+    (&_bc_ws2812b_timer2_handle)->Instance->CCMR1 |= TIM_CCMR1_OC2M_2;
+
+    // Set 50us period for Treset pulse
+    TIM2->ARR = _BC_WS2812_TIMER_RESET_PULSE_PERIOD;
+    // Reset the timer
+    TIM2->CNT = 0;
+
+    // Generate an update event to reload the prescaler value immediately
+    TIM2->EGR = TIM_EGR_UG;
+    __HAL_TIM_CLEAR_FLAG(&_bc_ws2812b_timer2_handle, TIM_FLAG_UPDATE);
+
+    // Enable TIM2 Update interrupt for Treset signal
+    __HAL_TIM_ENABLE_IT(&_bc_ws2812b_timer2_handle, TIM_IT_UPDATE);
+    // Enable timer
+    TIM2->CR1 |= TIM_CR1_CEN;
 }
 
 void TIM2_IRQHandler(void)
@@ -49,6 +49,9 @@ __attribute__((weak)) void application_error(bc_error_t code)
 
     bc_log_init(BC_LOG_LEVEL_DEBUG, BC_LOG_TIMESTAMP_ABS);
 
+    // Error may come from scheduler, so log is written synchronously from now
+    bc_log_flush_on_fault();
+
     bc_led_t led;
 
     bc_tick_t timeout = 0;
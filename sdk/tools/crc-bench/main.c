@@ -0,0 +1,261 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include <bc_common.h>
+#include <time.h>
+#include "reference.h"
+#include "variants.h"
+
+#define BUFFER_SIZE 255
+#define BUFFERS 20000
+
+static const struct
+{
+    const char *name;
+    uint8_t (*crc8_maxim)(const void *, size_t, uint8_t);
+    uint8_t (*crc8_sensirion)(const void *, size_t, uint8_t);
+    uint16_t (*crc16_ibm)(const void *, size_t, uint16_t);
+
+} _variants[] =
+{
+    { "table 16", bc_crc8_maxim_16, bc_crc8_sensirion_16, bc_crc16_ibm_16 },
+    { "table 256", bc_crc8_maxim_256, bc_crc8_sensirion_256, bc_crc16_ibm_256 }
+};
+
+static uint32_t _random_state = 0x12345678;
+
+// Reproducible xorshift, so failing buffer is the same in every run
+static uint32_t _random(void)
+{
+    _random_state ^= _random_state << 13;
+    _random_state ^= _random_state >> 17;
+    _random_state ^= _random_state << 5;
+
+    return _random_state;
+}
+
+static int _check(const char *variant, const char *name, unsigned value, unsigned expected)
+{
+    if (value != expected)
+    {
+        printf("%s: %s is %04x, expected %04x\n", variant, name, value, expected);
+
+        return 1;
+    }
+
+    return 0;
+}
+
+// Standard check values of CRC catalogue for "123456789"
+static int _verify_check_values(void)
+{
+    static const char check[] = "123456789";
+    int errors = 0;
+
+    errors += _check("reference", "onewire_crc8", reference_onewire_crc8(check, 9, 0), 0xa1);
+    errors += _check("reference", "onewire_crc16", reference_onewire_crc16(check, 9, 0), 0xbb3d);
+    errors += _check("reference", "sgp30_crc", reference_sgp30_crc((uint8_t *) check, 9), 0xf7);
+    errors += _check("reference", "lp8_crc16", reference_lp8_crc16((uint8_t *) check, 9), 0x4b37);
+
+    for (size_t v = 0; v < sizeof(_variants) / sizeof(_variants[0]); v++)
+    {
+        errors += _check(_variants[v].name, "crc8_maxim", _variants[v].crc8_maxim(check, 9, 0), 0xa1);
+        errors += _check(_variants[v].name, "crc8_sensirion", _variants[v].crc8_sensirion(check, 9, 0xff), 0xf7);
+        errors += _check(_variants[v].name, "crc16_ibm", _variants[v].crc16_ibm(check, 9, 0), 0xbb3d);
+        errors += _check(_variants[v].name, "crc16_ibm modbus", _variants[v].crc16_ibm(check, 9, 0xffff), 0x4b37);
+    }
+
+    return errors;
+}
+
+// Every byte with every starting value covers every table entry in every step
+static int _verify_exhaustive(size_t v)
+{
+    for (unsigned crc = 0; crc < 0x10000; crc++)
+    {
+        for (unsigned byte = 0; byte < 0x100; byte++)
+        {
+            uint8_t data = byte;
+
+            if (crc < 0x100)
+            {
+                if (_variants[v].crc8_maxim(&data, 1, crc) != reference_onewire_crc8(&data, 1, crc))
+                {
+                    printf("%s: crc8_maxim of %02x from %02x\n", _variants[v].name, byte, crc);
+
+                    return 1;
+                }
+            }
+
+            if (_variants[v].crc16_ibm(&data, 1, crc) != reference_onewire_crc16(&data, 1, crc))
+            {
+                printf("%s: crc16_ibm of %02x from %04x\n", _variants[v].name, byte, crc);
+
+                return 1;
+            }
+        }
+    }
+
+    // Sensirion CRC starts always at 0xff in drivers, so all two byte words are checked
+    for (unsigned word = 0; word < 0x10000; word++)
+    {
+        uint8_t data[2] = { word >> 8, word };
+
+        if (_variants[v].crc8_sensirion(data, 2, 0xff) != reference_sgp30_crc(data, 2))
+        {
+            printf("%s: crc8_sensirion of %04x\n", _variants[v].name, word);
+
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+// Random buffers of all lengths as drivers pass them, 1-Wire with random starting value
+static int _verify_random(size_t v)
+{
+    uint8_t buffer[BUFFER_SIZE];
+
+    for (int i = 0; i < BUFFERS; i++)
+    {
+        size_t length = _random() % (BUFFER_SIZE + 1);
+        uint16_t crc = _random();
+
+        for (size_t j = 0; j < length; j++)
+        {
+            buffer[j] = _random();
+        }
+
+        if (_variants[v].crc8_maxim(buffer, length, crc) != reference_onewire_crc8(buffer, length, crc) ||
+            _variants[v].crc16_ibm(buffer, length, crc) != reference_onewire_crc16(buffer, length, crc) ||
+            _variants[v].crc8_sensirion(buffer, length, 0xff) != reference_sgp30_crc(buffer, length) ||
+            _variants[v].crc16_ibm(buffer, length, 0xffff) != reference_lp8_crc16(buffer, length))
+        {
+            printf("%s: mismatch of buffer %d with length %zu\n", _variants[v].name, i, length);
+
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static double _now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+typedef enum
+{
+    FUNCTION_CRC8_MAXIM = 0,
+    FUNCTION_CRC8_SENSIRION = 1,
+    FUNCTION_CRC16_IBM = 2
+
+} function_t;
+
+static volatile unsigned _sink;
+
+// Time per byte in nanoseconds, the best of five runs, variant -1 is the reference
+static double _measure(int v, function_t function, uint8_t *buffer, size_t length, int iterations)
+{
+    double best = 0;
+
+    for (int run = 0; run < 5; run++)
+    {
+        unsigned crc = 0;
+
+        double start = _now();
+
+        for (int i = 0; i < iterations; i++)
+        {
+            switch (function)
+            {
+                case FUNCTION_CRC8_MAXIM:
+                    crc ^= v < 0 ? reference_onewire_crc8(buffer, length, crc) : _variants[v].crc8_maxim(buffer, length, crc);
+                    break;
+                case FUNCTION_CRC8_SENSIRION:
+                    crc ^= v < 0 ? reference_sgp30_crc(buffer, length) : _variants[v].crc8_sensirion(buffer, length, 0xff);
+                    break;
+                case FUNCTION_CRC16_IBM:
+                    crc ^= v < 0 ? reference_onewire_crc16(buffer, length, crc) : _variants[v].crc16_ibm(buffer, length, crc);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        double time = (_now() - start) / iterations / length;
+
+        _sink = crc;
+
+        if (run == 0 || time < best)
+        {
+            best = time;
+        }
+    }
+
+    return best;
+}
+
+int main(int argc, char *argv[])
+{
+    int iterations = argc > 1 ? atoi(argv[1]) : 100000;
+    int errors = 0;
+
+    static const char *functions[] = { "crc8_maxim", "crc8_sensirion", "crc16_ibm" };
+    static const size_t lengths[] = { 3, 8, 49 };
+    uint8_t buffer[BUFFER_SIZE];
+
+    errors += _verify_check_values();
+
+    for (size_t v = 0; v < sizeof(_variants) / sizeof(_variants[0]); v++)
+    {
+        errors += _verify_exhaustive(v);
+        errors += _verify_random(v);
+    }
+
+    for (size_t i = 0; i < sizeof(buffer); i++)
+    {
+        buffer[i] = _random();
+    }
+
+    printf("Host time per byte in nanoseconds for buffer length (Sensirion word, 1-Wire ROM, LP8 frame)\n\n");
+    printf("%-16s %-10s", "function", "length");
+
+    printf(" %10s", "reference");
+
+    for (size_t v = 0; v < sizeof(_variants) / sizeof(_variants[0]); v++)
+    {
+        printf(" %10s", _variants[v].name);
+    }
+
+    printf("\n");
+
+    for (int f = FUNCTION_CRC8_MAXIM; f <= FUNCTION_CRC16_IBM; f++)
+    {
+        for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+        {
+            printf("%-16s %-10zu", functions[f], lengths[l]);
+
+            for (int v = -1; v < (int) (sizeof(_variants) / sizeof(_variants[0])); v++)
+            {
+                printf(" %10.2f", _measure(v, f, buffer, lengths[l], iterations));
+            }
+
+            printf("\n");
+        }
+    }
+
+    if (errors != 0)
+    {
+        printf("\n%d mismatches against reference\n", errors);
+
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include "reference.h"
+
+uint8_t reference_onewire_crc8(const void *buffer, size_t length, uint8_t crc)
+{
+    uint8_t *_buffer = (uint8_t *) buffer;
+    uint8_t inbyte;
+    uint8_t i;
+
+    while (length--)
+    {
+        inbyte = *_buffer++;
+        for (i = 8; i; i--)
+        {
+            if ((crc ^ inbyte) & 0x01)
+            {
+                crc >>= 1;
+                crc ^= 0x8C;
+            }
+            else
+            {
+                crc >>= 1;
+            }
+            inbyte >>= 1;
+        }
+    }
+
+    return crc;
+}
+
+uint16_t reference_onewire_crc16(const void *buffer, size_t length, uint16_t crc)
+{
+    static const uint8_t oddparity[16] =
+    { 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0 };
+
+    uint16_t i;
+    for (i = 0; i < length; i++)
+    {
+        uint16_t cdata = ((uint8_t *) buffer)[i];
+        cdata = (cdata ^ crc) & 0xff;
+        crc >>= 8;
+
+        if (oddparity[cdata & 0x0F] ^ oddparity[cdata >> 4]) crc ^= 0xC001;
+
+        cdata <<= 6;
+        crc ^= cdata;
+        cdata <<= 1;
+        crc ^= cdata;
+    }
+    return crc;
+}
+
+uint8_t reference_sgp30_crc(uint8_t *buffer, size_t length)
+{
+    uint8_t crc = 0xff;
+
+    for (size_t i = 0; i < length; i++)
+    {
+        crc ^= buffer[i];
+
+        for (int j = 0; j < 8; j++)
+        {
+            if ((crc & 0x80) != 0)
+            {
+                crc = (crc << 1) ^ 0x31;
+            }
+            else
+            {
+                crc <<= 1;
+            }
+        }
+    }
+
+    return crc;
+}
+
+uint16_t reference_lp8_crc16(uint8_t *buffer, uint8_t length)
+{
+    uint16_t crc16;
+
+    for (crc16 = 0xffff; length != 0; length--, buffer++)
+    {
+        crc16 ^= *buffer;
+
+        for (int i = 0; i < 8; i++)
+        {
+            if ((crc16 & 1) != 0)
+            {
+                crc16 >>= 1;
+                crc16 ^= 0xa001;
+            }
+            else
+            {
+                crc16 >>= 1;
+            }
+        }
+    }
+
+    return crc16;
+}
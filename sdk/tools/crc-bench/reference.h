@@ -0,0 +1,20 @@
+#ifndef _REFERENCE_H
+#define _REFERENCE_H
+
+#include <bc_common.h>
+
+// Bitwise CRC functions as they were implemented in drivers before bc_crc
+
+// bc_onewire_crc8
+uint8_t reference_onewire_crc8(const void *buffer, size_t length, uint8_t crc);
+
+// bc_onewire_crc16
+uint16_t reference_onewire_crc16(const void *buffer, size_t length, uint16_t crc);
+
+// _bc_sgp30_calculate_crc, _bc_sgpc3_calculate_crc was the same
+uint8_t reference_sgp30_crc(uint8_t *buffer, size_t length);
+
+// _bc_lp8_calculate_crc16
+uint16_t reference_lp8_crc16(uint8_t *buffer, uint8_t length);
+
+#endif // _REFERENCE_H
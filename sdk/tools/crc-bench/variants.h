@@ -0,0 +1,16 @@
+#ifndef _VARIANTS_H
+#define _VARIANTS_H
+
+#include <bc_common.h>
+
+// bc_crc.c built with BC_CRC_TABLE_SIZE 16 and 256, see Makefile
+
+uint8_t bc_crc8_maxim_16(const void *buffer, size_t length, uint8_t crc);
+uint8_t bc_crc8_sensirion_16(const void *buffer, size_t length, uint8_t crc);
+uint16_t bc_crc16_ibm_16(const void *buffer, size_t length, uint16_t crc);
+
+uint8_t bc_crc8_maxim_256(const void *buffer, size_t length, uint8_t crc);
+uint8_t bc_crc8_sensirion_256(const void *buffer, size_t length, uint8_t crc);
+uint16_t bc_crc16_ibm_256(const void *buffer, size_t length, uint16_t crc);
+
+#endif // _VARIANTS_H
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""Generate direct-index lookup table of a bc_font_*.c file.
+
+The table maps character code (BC_FONT_INDEX_FIRST .. 0xff) to position
+of the character in font array, so bc_gfx finds a glyph without searching.
+The table is written in front of font definition, which gets a pointer
+to it. Running the tool again regenerates the table.
+"""
+
+import argparse
+import re
+import sys
+
+INDEX_FIRST = 0x20
+INDEX_LENGTH = 0x100 - INDEX_FIRST
+INDEX_NONE = 0xff
+
+CHAR = re.compile(r'^\s*\{\s*(0x[0-9a-fA-F]+)\s*,\s*&\w+\s*\}', re.MULTILINE)
+DEFINITION = re.compile(r'(?:static const uint8_t (\w+)_index\[BC_FONT_INDEX_LENGTH\] = \{.*?\};\s*)?'
+                        r'const bc_font_t (\w+) = \{\s*(\d+),\s*(\w+)(?:,\s*\w+)?\s*\};', re.DOTALL)
+
+
+def chars_of_array(source, array):
+    start = source.index('bc_font_char_t %s[]' % array)
+    end = source.index('};', start)
+    codes = []
+
+    # Entries in #else branches of generated file are never compiled
+    for block in re.split(r'^#else.*?^#endif', source[start:end], flags=re.MULTILINE | re.DOTALL):
+        codes += [int(code, 16) for code in CHAR.findall(block)]
+
+    return codes
+
+
+def index_table(name, codes):
+    if len(codes) >= INDEX_NONE:
+        raise ValueError('%s has too many characters for index' % name)
+
+    index = [INDEX_NONE] * INDEX_LENGTH
+
+    for position, code in enumerate(codes):
+        if INDEX_FIRST <= code <= 0xff and index[code - INDEX_FIRST] == INDEX_NONE:
+            index[code - INDEX_FIRST] = position
+
+    lines = ['static const uint8_t %s_index[BC_FONT_INDEX_LENGTH] = {' % name]
+
+    for row in range(0, INDEX_LENGTH, 16):
+        lines.append('    ' + ' '.join('0x%02x,' % value for value in index[row:row + 16]))
+
+    lines.append('};')
+
+    return '\n'.join(lines)
+
+
+def generate(source):
+    match = DEFINITION.search(source)
+
+    if match is None:
+        raise ValueError('font definition not found')
+
+    name, length, array = match.group(2), int(match.group(3)), match.group(4)
+    codes = chars_of_array(source, array)
+
+    if len(codes) != length:
+        raise ValueError('%s declares %d characters, array has %d' % (name, length, len(codes)))
+
+    definition = '%s\n\n\nconst bc_font_t %s = { %d, %s, %s_index };' % (index_table(name, codes), name, length, array, name)
+
+    return source[:match.start()] + definition + source[match.end():]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate direct-index lookup table of bc_font_*.c file')
+    parser.add_argument('files', nargs='+', help='font source file generated by LCD Image Converter')
+    args = parser.parse_args()
+
+    for path in args.files:
+        with open(path, newline='') as f:
+            source = f.read()
+
+        try:
+            source = generate(source)
+        except ValueError as e:
+            sys.exit('%s: %s' % (path, e))
+
+        with open(path, 'w', newline='') as f:
+            f.write(source)
+
+
+if __name__ == '__main__':
+    main()
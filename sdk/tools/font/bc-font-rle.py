@@ -0,0 +1,233 @@
+#!/usr/bin/env python3
+"""Compress glyphs of a bc_font_*.c file generated by LCD Image Converter.
+
+Every glyph row is XORed with the previous one (the first one with background),
+so only edges of strokes remain, and the resulting bits are run-length coded.
+Runs alternate between kept and flipped pixels, starting with kept ones, and
+they are stored in 4-bit nibbles, high nibble first. Nibble value 15 means 15
+pixels and the run continues in the next nibble. Every glyph starts at a byte
+boundary. bc_gfx decodes glyphs row by row while drawing them.
+
+The file is rewritten with compressed glyphs, direct-index lookup table and
+font definition, sizes before and after compression are printed.
+"""
+
+import argparse
+import importlib.util
+import os
+import re
+import sys
+
+WIDTH_MAX = 64
+RUN_CONTINUE = 15
+
+IMAGE = re.compile(r'static const uint8_t image_data_\w+\[\d+\] = \{(.*?)\};\s*'
+                   r'static const bc_font_image_t (\w+) = \{ image_data_\w+,\s*(\d+), (\d+)', re.DOTALL)
+CHAR = re.compile(r'\{\s*(0x[0-9a-fA-F]+)\s*,\s*&(\w+)\s*\}')
+DEFINITION = re.compile(r'const bc_font_t (\w+) = \{\s*(\d+),\s*(\w+)[^}]*\};')
+
+# Flash used by structures on 32-bit MCU
+SIZEOF_FONT_CHAR = 8
+SIZEOF_FONT_IMAGE = 8
+SIZEOF_FONT_RLE_CHAR = 6
+
+
+def load_index_tool():
+    path = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'bc-font-index.py')
+    spec = importlib.util.spec_from_file_location('bc_font_index', path)
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+
+    return module
+
+
+def parse(source):
+    if 'bc_font_rle_char_t' in source:
+        raise ValueError('font is compressed already')
+
+    match = DEFINITION.search(source)
+
+    if match is None:
+        raise ValueError('font definition not found')
+
+    name, array = match.group(1), match.group(3)
+
+    images = {}
+
+    for data, image, width, height in IMAGE.findall(source):
+        images[image] = (int(width), int(height), [int(value, 16) for value in re.findall(r'0x[0-9a-fA-F]+', data)])
+
+    start = source.index('bc_font_char_t %s[]' % array)
+    end = source.index('};', start)
+    chars = []
+
+    # Entries in #else branches of generated file are never compiled
+    for block in re.split(r'^#else.*?^#endif', source[start:end], flags=re.MULTILINE | re.DOTALL):
+        chars += [(int(code, 16), images[image]) for code, image in CHAR.findall(block)]
+
+    if len(chars) != int(match.group(2)):
+        raise ValueError('%s declares %s characters, array has %d' % (name, match.group(2), len(chars)))
+
+    return name, chars
+
+
+def pixels(width, height, data):
+    """Rows of glyph pixels, 1 for drawn pixel (cleared bit)."""
+    bytes_per_row = (width + 7) // 8
+
+    if len(data) != bytes_per_row * height:
+        raise ValueError('glyph %dx%d has %d bytes' % (width, height, len(data)))
+
+    return [[((data[y * bytes_per_row + x // 8] >> (7 - x % 8)) & 1) ^ 1 for x in range(width)] for y in range(height)]
+
+
+def encode(rows):
+    bits = []
+    previous = [0] * len(rows[0])
+
+    for row in rows:
+        bits += [a ^ b for a, b in zip(row, previous)]
+        previous = row
+
+    runs = []
+    flip = 0
+    length = 0
+
+    for bit in bits:
+        if bit != flip:
+            runs.append(length)
+            flip ^= 1
+            length = 0
+
+        length += 1
+
+    runs.append(length)
+
+    nibbles = []
+
+    for length in runs:
+        while length >= RUN_CONTINUE:
+            nibbles.append(RUN_CONTINUE)
+            length -= RUN_CONTINUE
+
+        nibbles.append(length)
+
+    if len(nibbles) % 2 != 0:
+        nibbles.append(0)
+
+    return [nibbles[i] << 4 | nibbles[i + 1] for i in range(0, len(nibbles), 2)]
+
+
+def decode(data, width, height):
+    """Reference of the decoder in bc_gfx, used to verify compressed glyphs."""
+    nibbles = [n for byte in data for n in (byte >> 4, byte & 0x0f)]
+    rows = []
+    row = [0] * width
+    position = 0
+    flip = 1
+    run = 0
+
+    for _ in range(height):
+        row = list(row)
+
+        for x in range(width):
+            while run == 0:
+                flip ^= 1
+
+                while True:
+                    value = nibbles[position]
+                    position += 1
+                    run += value
+
+                    if value != RUN_CONTINUE:
+                        break
+
+            row[x] ^= flip
+            run -= 1
+
+        rows.append(row)
+
+    return rows
+
+
+def character(code):
+    text = bytes([code]).decode('iso-8859-2')
+
+    return repr(text) if code < 0x7f else "'%s'" % text
+
+
+def generate(source, index_tool):
+    name, chars = parse(source)
+
+    heights = set(height for _, (_, height, _) in chars)
+
+    if len(heights) != 1:
+        raise ValueError('glyphs have different heights')
+
+    height = heights.pop()
+
+    data_lines = []
+    char_lines = []
+    offset = 0
+
+    for code, (width, _, data) in chars:
+        if width > WIDTH_MAX:
+            raise ValueError('glyph 0x%02x is wider than %d pixels' % (code, WIDTH_MAX))
+
+        rows = pixels(width, height, data)
+        packed = encode(rows)
+
+        if decode(packed, width, height) != rows:
+            raise ValueError('glyph 0x%02x does not survive compression' % code)
+
+        if offset + len(packed) > 0xffff:
+            raise ValueError('compressed glyphs exceed 64 kB')
+
+        data_lines.append('    // %s\n    %s' % (character(code), ' '.join('0x%02x,' % value for value in packed)))
+        char_lines.append('    { 0x%02x, %d, %d },' % (code, width, offset))
+
+        offset += len(packed)
+
+    index = index_tool.index_table(name, [code for code, _ in chars])
+
+    header = source[:source.index('#include <bc_font_common.h>')]
+
+    result = header + '#include <bc_font_common.h>\n\n'
+    result += '// Glyphs are compressed by sdk/tools/font/bc-font-rle.py\n\n'
+    result += 'static const uint8_t %s_rle_data[%d] = {\n%s\n};\n\n' % (name, offset, '\n'.join(data_lines))
+    result += 'static const bc_font_rle_char_t %s_rle_chars[%d] = {\n%s\n};\n\n' % (name, len(chars), '\n'.join(char_lines))
+    result += '%s\n\n' % index
+    result += 'const bc_font_t %s = { %d, NULL, %s_index, %d, %s_rle_chars, %s_rle_data };\n' % (
+        name, len(chars), name, height, name, name)
+
+    before = sum(len(data) for _, (_, _, data) in chars) + len(chars) * (SIZEOF_FONT_CHAR + SIZEOF_FONT_IMAGE)
+    after = offset + len(chars) * SIZEOF_FONT_RLE_CHAR
+
+    return name, result, before, after
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compress glyphs of bc_font_*.c file generated by LCD Image Converter')
+    parser.add_argument('files', nargs='+', help='font source file generated by LCD Image Converter')
+    args = parser.parse_args()
+
+    index_tool = load_index_tool()
+
+    for path in args.files:
+        with open(path, newline='', encoding='utf-8') as f:
+            source = f.read()
+
+        try:
+            name, source, before, after = generate(source, index_tool)
+        except ValueError as e:
+            sys.exit('%s: %s' % (path, e))
+
+        with open(path, 'w', newline='', encoding='utf-8') as f:
+            f.write(source)
+
+        print('%s: glyphs %d B -> %d B (saved %d B, %.0f %%)' % (name, before, after, before - after,
+                                                                  100.0 * (before - after) / before))
+
+
+if __name__ == '__main__':
+    main()
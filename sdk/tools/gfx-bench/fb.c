@@ -0,0 +1,111 @@
+#include "fb.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static bool fb_is_ready(fb_t *self);
+static void fb_clear(fb_t *self);
+static void fb_draw_pixel(fb_t *self, int x, int y, uint32_t color);
+static uint32_t fb_get_pixel(fb_t *self, int x, int y);
+static bool fb_update(fb_t *self);
+static bc_gfx_caps_t fb_get_caps(fb_t *self);
+
+bool fb_init(fb_t *self, int width, int height)
+{
+    self->width = width;
+    self->height = height;
+    self->pixels = calloc(width * height, 1);
+
+    return self->pixels != NULL;
+}
+
+void fb_free(fb_t *self)
+{
+    free(self->pixels);
+
+    self->pixels = NULL;
+}
+
+const bc_gfx_driver_t *fb_get_driver(void)
+{
+    static const bc_gfx_driver_t driver =
+    {
+        .is_ready = (bool (*)(void *)) fb_is_ready,
+        .clear = (void (*)(void *)) fb_clear,
+        .draw_pixel = (void (*)(void *, int, int, uint32_t)) fb_draw_pixel,
+        .get_pixel = (uint32_t (*)(void *, int, int)) fb_get_pixel,
+        .update = (bool (*)(void *)) fb_update,
+        .get_caps = (bc_gfx_caps_t (*)(void *)) fb_get_caps
+    };
+
+    return &driver;
+}
+
+bool fb_write_pbm(const char *path, void *display, const bc_gfx_driver_t *driver, bool inverted)
+{
+    FILE *f = fopen(path, "wb");
+
+    if (f == NULL)
+    {
+        return false;
+    }
+
+    bc_gfx_caps_t caps = driver->get_caps(display);
+
+    fprintf(f, "P4\n%d %d\n", caps.width, caps.height);
+
+    for (int y = 0; y < caps.height; y++)
+    {
+        uint8_t byte = 0;
+
+        // Rows are padded to whole bytes, MSB is the leftmost pixel
+        for (int x = 0; x < caps.width; x++)
+        {
+            byte |= ((driver->get_pixel(display, x, y) != 0) != inverted ? 1 : 0) << (7 - x % 8);
+
+            if (x % 8 == 7 || x == caps.width - 1)
+            {
+                fputc(byte, f);
+
+                byte = 0;
+            }
+        }
+    }
+
+    return fclose(f) == 0;
+}
+
+static bool fb_is_ready(fb_t *self)
+{
+    (void) self;
+
+    return true;
+}
+
+static void fb_clear(fb_t *self)
+{
+    memset(self->pixels, 0, self->width * self->height);
+}
+
+static void fb_draw_pixel(fb_t *self, int x, int y, uint32_t color)
+{
+    self->pixels[x + y * self->width] = color != 0 ? 1 : 0;
+}
+
+static uint32_t fb_get_pixel(fb_t *self, int x, int y)
+{
+    return self->pixels[x + y * self->width];
+}
+
+static bool fb_update(fb_t *self)
+{
+    (void) self;
+
+    return true;
+}
+
+static bc_gfx_caps_t fb_get_caps(fb_t *self)
+{
+    bc_gfx_caps_t caps = { .width = self->width, .height = self->height };
+
+    return caps;
+}
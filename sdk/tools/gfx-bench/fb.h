@@ -0,0 +1,28 @@
+#ifndef _FB_H
+#define _FB_H
+
+#include <bc_gfx.h>
+
+// Host framebuffer of one byte per pixel, the simplest possible driver
+// (pixel operations only), so it serves as a reference of rendering
+
+typedef struct
+{
+    int width;
+    int height;
+    uint8_t *pixels;
+
+} fb_t;
+
+bool fb_init(fb_t *self, int width, int height);
+
+void fb_free(fb_t *self);
+
+const bc_gfx_driver_t *fb_get_driver(void);
+
+// Write display content read by get_pixel of its driver to PBM file, color 1 is black
+// (inverted for drivers which return 0 for pixels of color 1)
+
+bool fb_write_pbm(const char *path, void *display, const bc_gfx_driver_t *driver, bool inverted);
+
+#endif // _FB_H
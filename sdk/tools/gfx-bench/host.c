@@ -0,0 +1,85 @@
+#include <bc_spi.h>
+#include <bc_scheduler.h>
+#include <bc_i2c.h>
+
+// Host stubs of SPI, I2C and scheduler, display update is not benchmarked
+
+void bc_spi_init(bc_spi_speed_t speed, bc_spi_mode_t mode)
+{
+    (void) speed;
+    (void) mode;
+}
+
+bool bc_spi_is_ready(void)
+{
+    return true;
+}
+
+bool bc_spi_transfer(const void *source, void *destination, size_t length)
+{
+    (void) source;
+    (void) destination;
+    (void) length;
+
+    return true;
+}
+
+bool bc_spi_async_transfer(const void *source, void *destination, size_t length, void (*event_handler)(bc_spi_event_t event, void *event_param), void (*event_param))
+{
+    (void) source;
+    (void) destination;
+    (void) length;
+
+    event_handler(BC_SPI_EVENT_DONE, event_param);
+
+    return true;
+}
+
+bc_scheduler_task_id_t bc_scheduler_register(void (*task)(void *), void *param, bc_tick_t tick)
+{
+    (void) task;
+    (void) param;
+    (void) tick;
+
+    return 0;
+}
+
+void bc_scheduler_plan_relative(bc_scheduler_task_id_t task_id, bc_tick_t tick)
+{
+    (void) task_id;
+    (void) tick;
+}
+
+void bc_scheduler_plan_now(bc_scheduler_task_id_t task_id)
+{
+    (void) task_id;
+}
+
+void bc_scheduler_plan_current_from_now(bc_tick_t tick)
+{
+    (void) tick;
+}
+
+void bc_i2c_init(bc_i2c_channel_t channel, bc_i2c_speed_t speed)
+{
+    (void) channel;
+    (void) speed;
+}
+
+bool bc_i2c_memory_write(bc_i2c_channel_t channel, const bc_i2c_memory_transfer_t *transfer)
+{
+    (void) channel;
+    (void) transfer;
+
+    return true;
+}
+
+bool bc_i2c_memory_write_8b(bc_i2c_channel_t channel, uint8_t device_address, uint32_t memory_address, uint8_t data)
+{
+    (void) channel;
+    (void) device_address;
+    (void) memory_address;
+    (void) data;
+
+    return true;
+}
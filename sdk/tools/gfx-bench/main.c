@@ -0,0 +1,582 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include <bc_gfx.h>
+#include <bc_ls013b7dh03.h>
+#include <bc_ssd1306.h>
+#include <time.h>
+#include "fb.h"
+
+// Benchmark of bc_gfx rendering into display framebuffers
+//
+// Every font fills the whole screen with text, which is drawn by the
+// reference path (linear glyph search, pixel by pixel through the driver)
+// and by the fast paths. Uncompressed glyphs are unpacked from compressed
+// font by the host, independently of the decoder in bc_gfx. Framebuffers
+// have to be identical, exit status is non-zero otherwise, so the benchmark
+// works as a regression test.
+//
+// Every primitive scene is drawn pixel by pixel and by span, rectangle and
+// image operations of the drivers, both have to give the same pixels as
+// the host framebuffer (in all rotations of square displays).
+
+#define DEFAULT_FRAMES 200
+#define RUNS 5
+
+typedef struct
+{
+    const char *name;
+    const bc_font_t *font;
+    bc_font_t *unpacked;
+
+} font_t;
+
+typedef struct
+{
+    const char *name;
+    bool index;
+    bool blit;
+    bool rle;
+    bc_gfx_rotation_t rotation;
+
+} render_t;
+
+static bc_font_t unpacked_table[6];
+
+static const font_t font_table[] =
+{
+    { "ubuntu_11", &bc_font_ubuntu_11, &unpacked_table[0] },
+    { "ubuntu_13", &bc_font_ubuntu_13, &unpacked_table[1] },
+    { "ubuntu_15", &bc_font_ubuntu_15, &unpacked_table[2] },
+    { "ubuntu_24", &bc_font_ubuntu_24, &unpacked_table[3] },
+    { "ubuntu_28", &bc_font_ubuntu_28, &unpacked_table[4] },
+    { "ubuntu_33", &bc_font_ubuntu_33, &unpacked_table[5] },
+};
+
+static const render_t render_table[] =
+{
+    { "reference", false, false, false, BC_GFX_ROTATION_0 },
+    { "index", true, false, false, BC_GFX_ROTATION_0 },
+    { "index+blit", true, true, false, BC_GFX_ROTATION_0 },
+    { "rle", true, false, true, BC_GFX_ROTATION_0 },
+    { "rle+blit", true, true, true, BC_GFX_ROTATION_0 },
+    { "reference/90", false, false, false, BC_GFX_ROTATION_90 },
+    { "rle+blit/90", true, true, true, BC_GFX_ROTATION_90 },
+};
+
+typedef struct
+{
+    const char *name;
+    void (*draw)(bc_gfx_t *gfx);
+
+} scene_t;
+
+typedef struct
+{
+    const char *name;
+    void *display;
+    const bc_gfx_driver_t *(*get_driver)(void);
+    bool inverted;
+
+} display_t;
+
+static void draw_lines(bc_gfx_t *gfx);
+static void draw_rectangles(bc_gfx_t *gfx);
+static void draw_fill_rectangles(bc_gfx_t *gfx);
+static void draw_circles(bc_gfx_t *gfx);
+static void draw_fill_circles(bc_gfx_t *gfx);
+static void draw_images(bc_gfx_t *gfx);
+
+static const scene_t scene_table[] =
+{
+    { "lines", draw_lines },
+    { "rectangle", draw_rectangles },
+    { "fill_rect", draw_fill_rectangles },
+    { "circle", draw_circles },
+    { "fill_circle", draw_fill_circles },
+    { "image", draw_images },
+};
+
+static const char *text = "The quick brown fox jumps over the lazy dog 0123456789 +-*/=%";
+
+static bc_ls013b7dh03_t lcd;
+
+static bc_ssd1306_t oled;
+
+BC_SSD1306_FRAMEBUFFER(oled_framebuffer, 128, 64)
+
+static const display_t display_table[] =
+{
+    // LS013B7DH03 get_pixel returns framebuffer bit, which is set for white pixel
+    { "ls013b7dh03", &lcd, bc_ls013b7dh03_get_driver, true },
+    { "ssd1306", &oled, bc_ssd1306_get_driver, false },
+};
+
+static uint8_t image_data[37 * 5];
+
+static const bc_image_t image = { image_data, 37, 37, sizeof(image_data) };
+
+static bool pin_cs_set(bool state);
+static void unpack(const bc_font_t *font, bc_font_t *unpacked);
+static void draw_screen(bc_gfx_t *gfx, const bc_font_t *font);
+static double run(const font_t *font, const render_t *mode, int frames, uint8_t *framebuffer);
+static double measure(bc_gfx_t *gfx, void (*draw)(bc_gfx_t *gfx), int frames);
+static bool compare(bc_gfx_t *gfx, bool inverted, bc_gfx_t *reference);
+static int run_scenes(int frames, const char *output);
+
+int main(int argc, char *argv[])
+{
+    const char *output = NULL;
+
+    if (argc > 2 && strcmp(argv[1], "-o") == 0)
+    {
+        output = argv[2];
+
+        argc -= 2;
+        argv += 2;
+    }
+
+    int frames = argc > 1 ? atoi(argv[1]) : DEFAULT_FRAMES;
+
+    if (frames <= 0)
+    {
+        fprintf(stderr, "usage: gfx-bench [-o directory] [frames]\n");
+
+        return 2;
+    }
+
+    // Reference framebuffer of every rotation
+    static uint8_t reference[4][BC_LS013B7DH03_FRAMEBUFFER_SIZE];
+    static uint8_t framebuffer[BC_LS013B7DH03_FRAMEBUFFER_SIZE];
+
+    int mismatches = 0;
+
+    printf("%-10s", "font");
+
+    for (size_t m = 0; m < sizeof(render_table) / sizeof(render_table[0]); m++)
+    {
+        printf(" %14s", render_table[m].name);
+    }
+
+    printf("   (us per full-screen text redraw)\n");
+
+    for (size_t f = 0; f < sizeof(font_table) / sizeof(font_table[0]); f++)
+    {
+        unpack(font_table[f].font, font_table[f].unpacked);
+
+        printf("%-10s", font_table[f].name);
+
+        for (size_t m = 0; m < sizeof(render_table) / sizeof(render_table[0]); m++)
+        {
+            const render_t *mode = &render_table[m];
+
+            uint8_t *mode_reference = reference[mode->rotation];
+
+            double us = run(&font_table[f], mode, frames, !mode->index ? mode_reference : framebuffer);
+
+            bool match = !mode->index || memcmp(mode_reference, framebuffer, sizeof(framebuffer)) == 0;
+
+            printf(" %13.1f%s", us, match ? " " : "!");
+
+            mismatches += match ? 0 : 1;
+        }
+
+        printf("\n");
+    }
+
+    printf("\n");
+
+    mismatches += run_scenes(frames, output);
+
+    if (mismatches != 0)
+    {
+        printf("%d framebuffer mismatches (marked by !)\n", mismatches);
+
+        return 1;
+    }
+
+    return 0;
+}
+
+static bool pin_cs_set(bool state)
+{
+    (void) state;
+
+    return true;
+}
+
+static void unpack(const bc_font_t *font, bc_font_t *unpacked)
+{
+    int height = font->rle_height;
+
+    bc_font_char_t *chars = calloc(font->length, sizeof(bc_font_char_t));
+    bc_font_image_t *images = calloc(font->length, sizeof(bc_font_image_t));
+
+    for (int i = 0; i < font->length; i++)
+    {
+        const bc_font_rle_char_t *rle_char = &font->rle_chars[i];
+
+        int width = rle_char->width;
+        int bytes = (width + 7) / 8;
+
+        uint8_t *image = calloc(bytes * height, 1);
+
+        // Pixel by pixel, nibbles are run lengths of kept and flipped pixels (15 continues the run)
+        const uint8_t *data = &font->rle_data[rle_char->offset];
+        int nibble = 0;
+        int run = 0;
+        int flip = 1;
+
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                while (run == 0)
+                {
+                    int value;
+
+                    flip ^= 1;
+
+                    do
+                    {
+                        value = nibble % 2 == 0 ? data[nibble / 2] >> 4 : data[nibble / 2] & 0x0f;
+                        run += value;
+                        nibble++;
+                    }
+                    while (value == 15);
+                }
+
+                int drawn = y > 0 ? (image[(y - 1) * bytes + x / 8] >> (7 - x % 8) & 1) == 0 : 0;
+
+                if ((drawn ^ flip) == 0)
+                {
+                    image[y * bytes + x / 8] |= 1 << (7 - x % 8);
+                }
+
+                run--;
+            }
+        }
+
+        images[i].image = image;
+        images[i].width = width;
+        images[i].heigth = height;
+
+        chars[i].code = rle_char->code;
+        chars[i].image = &images[i];
+    }
+
+    *unpacked = *font;
+
+    unpacked->chars = chars;
+    unpacked->rle_height = 0;
+    unpacked->rle_chars = NULL;
+    unpacked->rle_data = NULL;
+}
+
+static void draw_screen(bc_gfx_t *gfx, const bc_font_t *font)
+{
+    bc_gfx_clear(gfx);
+
+    bc_gfx_set_font(gfx, font);
+
+    int height = font->rle_chars != NULL ? font->rle_height : font->chars[0].image->heigth;
+
+    // Odd offset, so glyphs are not aligned to framebuffer bytes, and the last line is clipped
+    for (int top = -3, line = 0; top < BC_LS013B7DH03_HEIGHT; top += height, line++)
+    {
+        bc_gfx_draw_string(gfx, 1 - line * 5, top, (char *) text + line % 7, 1);
+    }
+
+    // White text over black one
+    bc_gfx_draw_string(gfx, 2, 40, (char *) text, 0);
+}
+
+static double run(const font_t *font, const render_t *mode, int frames, uint8_t *framebuffer)
+{
+    static bc_gfx_driver_t driver;
+    static bc_font_t mode_font;
+    bc_gfx_t gfx;
+
+    driver = *bc_ls013b7dh03_get_driver();
+
+    if (!mode->blit)
+    {
+        driver.blit_mono = NULL;
+    }
+
+    // Reference draws every pixel through the driver
+    if (!mode->index)
+    {
+        driver.draw_hspan = NULL;
+        driver.fill_rect = NULL;
+    }
+
+    mode_font = mode->rle ? *font->font : *font->unpacked;
+
+    if (!mode->index)
+    {
+        mode_font.index = NULL;
+    }
+
+    bc_ls013b7dh03_init(&lcd, pin_cs_set);
+
+    bc_gfx_init(&gfx, &lcd, &driver);
+
+    bc_gfx_set_rotation(&gfx, mode->rotation);
+
+    double best = 0;
+
+    // The best of several runs, so the result is not affected by other processes
+    for (int run = 0; run < RUNS; run++)
+    {
+        struct timespec start;
+        struct timespec end;
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+
+        for (int i = 0; i < frames; i++)
+        {
+            draw_screen(&gfx, &mode_font);
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        double us = ((end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3) / frames;
+
+        best = run == 0 || us < best ? us : best;
+    }
+
+    memcpy(framebuffer, lcd._framebuffer, sizeof(lcd._framebuffer));
+
+    return best;
+}
+
+static double measure(bc_gfx_t *gfx, void (*draw)(bc_gfx_t *gfx), int frames)
+{
+    double best = 0;
+
+    for (int run = 0; run < RUNS; run++)
+    {
+        struct timespec start;
+        struct timespec end;
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+
+        for (int i = 0; i < frames; i++)
+        {
+            bc_gfx_clear(gfx);
+
+            draw(gfx);
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        double us = ((end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3) / frames;
+
+        best = run == 0 || us < best ? us : best;
+    }
+
+    return best;
+}
+
+static bool compare(bc_gfx_t *gfx, bool inverted, bc_gfx_t *reference)
+{
+    bc_gfx_caps_t caps = bc_gfx_get_caps(gfx);
+
+    for (int y = 0; y < caps.height; y++)
+    {
+        for (int x = 0; x < caps.width; x++)
+        {
+            uint32_t pixel = gfx->_driver->get_pixel(gfx->_display, x, y);
+            uint32_t expected = reference->_driver->get_pixel(reference->_display, x, y);
+
+            if (((pixel != 0) != inverted) != (expected != 0))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+static int run_scenes(int frames, const char *output)
+{
+    int mismatches = 0;
+
+    // Pattern of image, which is not symmetric, so mirrored drawing is caught
+    for (int y = 0; y < image.height; y++)
+    {
+        for (int x = 0; x < image.width; x++)
+        {
+            if ((x * x + 2 * y * y) % 23 < 9 || x == y + 3)
+            {
+                image_data[x / 8 + y * ((image.width + 7) / 8)] |= 1 << (x % 8);
+            }
+        }
+    }
+
+    bc_ls013b7dh03_init(&lcd, pin_cs_set);
+
+    bc_ssd1306_init(&oled, BC_I2C_I2C0, BC_SSD1306_ADDRESS_I2C_ADDRESS_DEFAULT, &oled_framebuffer);
+
+    printf("%-12s %-12s %14s %14s %8s   (us per scene)\n", "display", "scene", "pixel", "fast", "speedup");
+
+    for (size_t d = 0; d < sizeof(display_table) / sizeof(display_table[0]); d++)
+    {
+        const display_t *display = &display_table[d];
+
+        // Driver without optional operations, everything is drawn by draw_pixel
+        bc_gfx_driver_t pixel_driver = *display->get_driver();
+
+        pixel_driver.blit_mono = NULL;
+        pixel_driver.draw_hspan = NULL;
+        pixel_driver.fill_rect = NULL;
+        pixel_driver.blit = NULL;
+
+        bc_gfx_t pixel_gfx;
+        bc_gfx_t fast_gfx;
+        bc_gfx_t reference_gfx;
+        fb_t fb;
+
+        bc_gfx_init(&pixel_gfx, display->display, &pixel_driver);
+        bc_gfx_init(&fast_gfx, display->display, display->get_driver());
+
+        bc_gfx_caps_t caps = bc_gfx_get_caps(&fast_gfx);
+
+        fb_init(&fb, caps.width, caps.height);
+
+        bc_gfx_init(&reference_gfx, &fb, fb_get_driver());
+
+        for (size_t s = 0; s < sizeof(scene_table) / sizeof(scene_table[0]); s++)
+        {
+            const scene_t *scene = &scene_table[s];
+
+            bc_gfx_clear(&reference_gfx);
+
+            scene->draw(&reference_gfx);
+
+            double pixel_us = measure(&pixel_gfx, scene->draw, frames);
+
+            bool pixel_match = compare(&pixel_gfx, display->inverted, &reference_gfx);
+
+            double fast_us = measure(&fast_gfx, scene->draw, frames);
+
+            bool fast_match = compare(&fast_gfx, display->inverted, &reference_gfx);
+
+            if (output != NULL)
+            {
+                char path[256];
+
+                snprintf(path, sizeof(path), "%s/%s_%s.pbm", output, display->name, scene->name);
+
+                if (!fb_write_pbm(path, display->display, display->get_driver(), display->inverted))
+                {
+                    fprintf(stderr, "can't write %s\n", path);
+                }
+            }
+
+            // Rotated drawing of non-square display doesn't fit into it
+            for (int rotation = BC_GFX_ROTATION_90; caps.width == caps.height && rotation <= BC_GFX_ROTATION_270; rotation++)
+            {
+                bc_gfx_set_rotation(&reference_gfx, rotation);
+                bc_gfx_set_rotation(&fast_gfx, rotation);
+
+                bc_gfx_clear(&reference_gfx);
+                bc_gfx_clear(&fast_gfx);
+
+                scene->draw(&reference_gfx);
+                scene->draw(&fast_gfx);
+
+                fast_match = fast_match && compare(&fast_gfx, display->inverted, &reference_gfx);
+
+                bc_gfx_set_rotation(&reference_gfx, BC_GFX_ROTATION_0);
+                bc_gfx_set_rotation(&fast_gfx, BC_GFX_ROTATION_0);
+            }
+
+            printf("%-12s %-12s %13.1f%s %13.1f%s %7.1fx\n", display->name, scene->name,
+                    pixel_us, pixel_match ? " " : "!", fast_us, fast_match ? " " : "!", pixel_us / fast_us);
+
+            mismatches += (pixel_match ? 0 : 1) + (fast_match ? 0 : 1);
+        }
+
+        fb_free(&fb);
+    }
+
+    return mismatches;
+}
+
+static void draw_lines(bc_gfx_t *gfx)
+{
+    bc_gfx_caps_t caps = bc_gfx_get_caps(gfx);
+
+    // Fan of lines from the center, so all octants are drawn, lines end out of display
+    for (int i = -caps.width; i <= 2 * caps.width; i += 9)
+    {
+        bc_gfx_draw_line(gfx, caps.width / 2, caps.height / 2, i, -7, 1);
+        bc_gfx_draw_line(gfx, caps.width / 2, caps.height / 2, caps.width - i, caps.height + 5, 1);
+    }
+
+    for (int i = 0; i < caps.height; i += 6)
+    {
+        bc_gfx_draw_line(gfx, -3, i, caps.width / 3 + i, i, i % 4 == 0);
+        bc_gfx_draw_line(gfx, caps.width - 1 - i, caps.height + 2, caps.width - 1 - i, i, 1);
+    }
+}
+
+static void draw_rectangles(bc_gfx_t *gfx)
+{
+    bc_gfx_caps_t caps = bc_gfx_get_caps(gfx);
+
+    for (int i = -2; i < caps.height / 2; i += 3)
+    {
+        bc_gfx_draw_rectangle(gfx, i, i + 1, caps.width - 1 - i / 2, caps.height - 1 - i, 1);
+    }
+}
+
+static void draw_fill_rectangles(bc_gfx_t *gfx)
+{
+    bc_gfx_caps_t caps = bc_gfx_get_caps(gfx);
+
+    // Overlapping rectangles of both colors, not aligned to framebuffer bytes, partly out of display
+    for (int i = 0; i < 24; i++)
+    {
+        int x = (i * 37) % (caps.width + 20) - 10;
+        int y = (i * 23) % (caps.height + 10) - 5;
+
+        bc_gfx_draw_fill_rectangle(gfx, x, y, x + 5 + (i * 13) % 50, y + 3 + (i * 7) % 30, i % 3 != 0);
+    }
+}
+
+static void draw_circles(bc_gfx_t *gfx)
+{
+    bc_gfx_caps_t caps = bc_gfx_get_caps(gfx);
+
+    for (int r = 2; r < caps.width; r += 5)
+    {
+        bc_gfx_draw_circle(gfx, caps.width / 3, caps.height / 2, r, 1);
+    }
+}
+
+static void draw_fill_circles(bc_gfx_t *gfx)
+{
+    bc_gfx_caps_t caps = bc_gfx_get_caps(gfx);
+
+    for (int i = 0; i < 12; i++)
+    {
+        bc_gfx_draw_fill_circle(gfx, (i * 29) % caps.width, (i * 17) % caps.height, 4 + (i * 5) % 25, i % 4 != 0);
+    }
+}
+
+static void draw_images(bc_gfx_t *gfx)
+{
+    bc_gfx_caps_t caps = bc_gfx_get_caps(gfx);
+
+    // Images fitting into display at all bit offsets and clipped ones
+    for (int i = 0; i < 8; i++)
+    {
+        bc_gfx_draw_image(gfx, i * 11, (i * 3) % (caps.height - image.height), &image);
+    }
+
+    bc_gfx_draw_image(gfx, -5, caps.height - 20, &image);
+    bc_gfx_draw_image(gfx, caps.width - 30, -9, &image);
+}
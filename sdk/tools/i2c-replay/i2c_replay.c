@@ -0,0 +1,420 @@
+#include <i2c_replay.h>
+
+#define _I2C_REPLAY_MAX_RECORDS 4096
+#define _I2C_REPLAY_MAX_DATA 64
+
+typedef struct
+{
+    int line;
+    bc_i2c_channel_t channel;
+    bc_i2c_transaction_type_t type;
+    uint8_t device_address;
+    uint32_t memory_address;
+    size_t length;
+    bc_i2c_status_t status;
+    uint32_t bus_time_us;
+    uint8_t data[_I2C_REPLAY_MAX_DATA];
+
+} _i2c_replay_record_t;
+
+static struct
+{
+    _i2c_replay_record_t record[_I2C_REPLAY_MAX_RECORDS];
+    int count;
+    int position;
+    int mismatches;
+    bc_i2c_speed_t speed[3];
+
+    struct
+    {
+        bool used;
+        bc_i2c_channel_t channel;
+        uint8_t device_address;
+        bc_i2c_profile_t profile;
+
+    } device[BC_I2C_PROFILE_DEVICE_COUNT];
+
+    void (*trace_handler)(const bc_i2c_trace_t *, void *);
+    void *trace_param;
+
+} _i2c_replay;
+
+static const char *_i2c_replay_type[] = { "W", "R", "MW", "MR" };
+static const char *_i2c_replay_status[] = { "OK", "NACK", "ERR", "TIMEOUT" };
+
+static bool _i2c_replay_parse(const char *line, _i2c_replay_record_t *record);
+static int _i2c_replay_lookup(const char *table[], int count, const char *name);
+static bool _i2c_replay_transaction(bc_i2c_channel_t channel, bc_i2c_transaction_type_t type, uint8_t device_address, uint32_t memory_address, void *buffer, size_t length);
+static void _i2c_replay_account(const bc_i2c_trace_t *trace);
+
+bool i2c_replay_load(const char *path)
+{
+    char line[512];
+    int number = 0;
+
+    FILE *file = fopen(path, "r");
+
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    _i2c_replay.count = 0;
+    _i2c_replay.position = 0;
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        number++;
+
+        const char *p = strstr(line, "i2c ");
+
+        if (p == NULL)
+        {
+            continue;
+        }
+
+        if (_i2c_replay.count == _I2C_REPLAY_MAX_RECORDS)
+        {
+            fprintf(stderr, "%s:%d: too many records\n", path, number);
+
+            break;
+        }
+
+        _i2c_replay_record_t *record = &_i2c_replay.record[_i2c_replay.count];
+
+        if (!_i2c_replay_parse(p + 4, record))
+        {
+            fprintf(stderr, "%s:%d: invalid record\n", path, number);
+
+            continue;
+        }
+
+        record->line = number;
+
+        _i2c_replay.count++;
+    }
+
+    fclose(file);
+
+    return true;
+}
+
+bool i2c_replay_is_finished(void)
+{
+    return _i2c_replay.position == _i2c_replay.count;
+}
+
+int i2c_replay_get_mismatches(void)
+{
+    return _i2c_replay.mismatches;
+}
+
+void bc_i2c_init(bc_i2c_channel_t channel, bc_i2c_speed_t speed)
+{
+    _i2c_replay.speed[channel] = speed;
+}
+
+void bc_i2c_deinit(bc_i2c_channel_t channel)
+{
+    (void) channel;
+}
+
+bc_i2c_speed_t bc_i2c_get_speed(bc_i2c_channel_t channel)
+{
+    return _i2c_replay.speed[channel];
+}
+
+void bc_i2c_set_speed(bc_i2c_channel_t channel, bc_i2c_speed_t speed)
+{
+    _i2c_replay.speed[channel] = speed;
+}
+
+bool bc_i2c_write(bc_i2c_channel_t channel, const bc_i2c_transfer_t *transfer)
+{
+    return _i2c_replay_transaction(channel, BC_I2C_TRANSACTION_WRITE, transfer->device_address, 0, transfer->buffer, transfer->length);
+}
+
+bool bc_i2c_read(bc_i2c_channel_t channel, const bc_i2c_transfer_t *transfer)
+{
+    return _i2c_replay_transaction(channel, BC_I2C_TRANSACTION_READ, transfer->device_address, 0, transfer->buffer, transfer->length);
+}
+
+bool bc_i2c_memory_write(bc_i2c_channel_t channel, const bc_i2c_memory_transfer_t *transfer)
+{
+    return _i2c_replay_transaction(channel, BC_I2C_TRANSACTION_MEMORY_WRITE, transfer->device_address, transfer->memory_address, transfer->buffer, transfer->length);
+}
+
+bool bc_i2c_memory_read(bc_i2c_channel_t channel, const bc_i2c_memory_transfer_t *transfer)
+{
+    return _i2c_replay_transaction(channel, BC_I2C_TRANSACTION_MEMORY_READ, transfer->device_address, transfer->memory_address, transfer->buffer, transfer->length);
+}
+
+bool bc_i2c_submit(bc_i2c_channel_t channel, bc_i2c_transaction_t *transaction, void (*callback)(bc_i2c_transaction_t *, bc_i2c_event_t, void *), void *param)
+{
+    if (callback == NULL)
+    {
+        return false;
+    }
+
+    // Transaction is finished at once, callback is called before return
+    bool success = _i2c_replay_transaction(channel, transaction->type, transaction->device_address, transaction->memory_address, transaction->buffer, transaction->length);
+
+    callback(transaction, success ? BC_I2C_EVENT_DONE : BC_I2C_EVENT_ERROR, param);
+
+    return true;
+}
+
+bool bc_i2c_memory_write_8b(bc_i2c_channel_t channel, uint8_t device_address, uint32_t memory_address, uint8_t data)
+{
+    return _i2c_replay_transaction(channel, BC_I2C_TRANSACTION_MEMORY_WRITE, device_address, memory_address, &data, 1);
+}
+
+bool bc_i2c_memory_write_16b(bc_i2c_channel_t channel, uint8_t device_address, uint32_t memory_address, uint16_t data)
+{
+    uint8_t buffer[2];
+
+    buffer[0] = data >> 8;
+    buffer[1] = data;
+
+    return _i2c_replay_transaction(channel, BC_I2C_TRANSACTION_MEMORY_WRITE, device_address, memory_address, buffer, 2);
+}
+
+bool bc_i2c_memory_read_8b(bc_i2c_channel_t channel, uint8_t device_address, uint32_t memory_address, uint8_t *data)
+{
+    return _i2c_replay_transaction(channel, BC_I2C_TRANSACTION_MEMORY_READ, device_address, memory_address, data, 1);
+}
+
+bool bc_i2c_memory_read_16b(bc_i2c_channel_t channel, uint8_t device_address, uint32_t memory_address, uint16_t *data)
+{
+    uint8_t buffer[2];
+
+    if (!_i2c_replay_transaction(channel, BC_I2C_TRANSACTION_MEMORY_READ, device_address, memory_address, buffer, 2))
+    {
+        return false;
+    }
+
+    *data = buffer[0] << 8 | buffer[1];
+
+    return true;
+}
+
+bool bc_i2c_get_profile(bc_i2c_channel_t channel, uint8_t device_address, bc_i2c_profile_t *profile)
+{
+    for (int i = 0; i < BC_I2C_PROFILE_DEVICE_COUNT; i++)
+    {
+        if (_i2c_replay.device[i].used && _i2c_replay.device[i].channel == channel && _i2c_replay.device[i].device_address == device_address)
+        {
+            *profile = _i2c_replay.device[i].profile;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void bc_i2c_reset_profile(void)
+{
+    memset(_i2c_replay.device, 0, sizeof(_i2c_replay.device));
+}
+
+void bc_i2c_set_trace_handler(void (*trace_handler)(const bc_i2c_trace_t *, void *), void *trace_param)
+{
+    _i2c_replay.trace_handler = trace_handler;
+    _i2c_replay.trace_param = trace_param;
+}
+
+static bool _i2c_replay_parse(const char *line, _i2c_replay_record_t *record)
+{
+    int channel;
+    char type[4];
+    unsigned int device_address;
+    uint32_t memory_address;
+    unsigned int length;
+    char status[8];
+    uint32_t bus_time_us;
+    int offset;
+
+    if (sscanf(line, "%d %3s %x %" SCNx32 " %u %7s %" SCNu32 " %n", &channel, type, &device_address, &memory_address,
+            &length, status, &bus_time_us, &offset) != 7)
+    {
+        return false;
+    }
+
+    int type_index = _i2c_replay_lookup(_i2c_replay_type, 4, type);
+    int status_index = _i2c_replay_lookup(_i2c_replay_status, 4, status);
+
+    if (channel < 0 || channel > BC_I2C_I2C_1W || type_index < 0 || status_index < 0 || length > _I2C_REPLAY_MAX_DATA)
+    {
+        return false;
+    }
+
+    record->channel = channel;
+    record->type = type_index;
+    record->device_address = device_address;
+    record->memory_address = memory_address;
+    record->length = length;
+    record->status = status_index;
+    record->bus_time_us = bus_time_us;
+
+    memset(record->data, 0, sizeof(record->data));
+
+    // Data are present for successful transactions only
+    for (size_t i = 0; record->status == BC_I2C_STATUS_OK && i < record->length; i++)
+    {
+        unsigned int byte;
+
+        if (sscanf(line + offset + i * 2, "%2x", &byte) != 1)
+        {
+            return false;
+        }
+
+        record->data[i] = byte;
+    }
+
+    return true;
+}
+
+static int _i2c_replay_lookup(const char *table[], int count, const char *name)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (strcmp(table[i], name) == 0)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static bool _i2c_replay_transaction(bc_i2c_channel_t channel, bc_i2c_transaction_type_t type, uint8_t device_address, uint32_t memory_address, void *buffer, size_t length)
+{
+    bc_i2c_trace_t trace;
+
+    trace.channel = channel;
+    trace.type = type;
+    trace.device_address = device_address;
+    trace.memory_address = memory_address;
+    trace.buffer = buffer;
+    trace.length = length;
+
+    if (i2c_replay_is_finished())
+    {
+        fprintf(stderr, "transaction %s %02x after end of trace\n", _i2c_replay_type[type], device_address);
+
+        _i2c_replay.mismatches++;
+
+        return false;
+    }
+
+    _i2c_replay_record_t *record = &_i2c_replay.record[_i2c_replay.position++];
+
+    bool match = record->channel == channel && record->type == type && record->device_address == device_address &&
+            record->memory_address == memory_address && record->length == length;
+
+    bool write = type == BC_I2C_TRANSACTION_WRITE || type == BC_I2C_TRANSACTION_MEMORY_WRITE;
+
+    if (match && write && record->status == BC_I2C_STATUS_OK && memcmp(record->data, buffer, length) != 0)
+    {
+        match = false;
+    }
+
+    if (!match)
+    {
+        fprintf(stderr, "line %d: transaction %d %s %02x %08" PRIx32 " %u doesn't match record\n", record->line, (int) channel,
+                _i2c_replay_type[type], device_address, memory_address, (unsigned) length);
+
+        _i2c_replay.mismatches++;
+
+        trace.status = BC_I2C_STATUS_NACK;
+        trace.bus_time_us = bc_i2c_get_bus_time_us(_i2c_replay.speed[channel], 1, 1);
+
+        _i2c_replay_account(&trace);
+
+        return false;
+    }
+
+    trace.status = record->status;
+
+    if (record->status == BC_I2C_STATUS_OK)
+    {
+        size_t bytes = 1 + length;
+        int starts = 1;
+
+        if (type == BC_I2C_TRANSACTION_MEMORY_WRITE || type == BC_I2C_TRANSACTION_MEMORY_READ)
+        {
+            bytes += (memory_address & BC_I2C_MEMORY_ADDRESS_16_BIT) != 0 ? 2 : 1;
+        }
+
+        if (type == BC_I2C_TRANSACTION_MEMORY_READ)
+        {
+            bytes++;
+            starts++;
+        }
+
+        if (!write)
+        {
+            memcpy(buffer, record->data, length);
+        }
+
+        trace.bus_time_us = channel == BC_I2C_I2C_1W ? record->bus_time_us : bc_i2c_get_bus_time_us(_i2c_replay.speed[channel], bytes, starts);
+    }
+    else
+    {
+        // It is not known how far a failed transaction got, recorded time is used
+        trace.bus_time_us = record->bus_time_us;
+    }
+
+    _i2c_replay_account(&trace);
+
+    return record->status == BC_I2C_STATUS_OK;
+}
+
+static void _i2c_replay_account(const bc_i2c_trace_t *trace)
+{
+    for (int i = 0; i < BC_I2C_PROFILE_DEVICE_COUNT; i++)
+    {
+        if (!_i2c_replay.device[i].used)
+        {
+            _i2c_replay.device[i].used = true;
+            _i2c_replay.device[i].channel = trace->channel;
+            _i2c_replay.device[i].device_address = trace->device_address;
+        }
+        else if (_i2c_replay.device[i].channel != trace->channel || _i2c_replay.device[i].device_address != trace->device_address)
+        {
+            continue;
+        }
+
+        bc_i2c_profile_t *profile = &_i2c_replay.device[i].profile;
+
+        profile->transactions++;
+        profile->bus_time_us += trace->bus_time_us;
+
+        if (trace->status == BC_I2C_STATUS_OK)
+        {
+            profile->bytes += trace->length;
+        }
+        else if (trace->status == BC_I2C_STATUS_NACK)
+        {
+            profile->nacks++;
+        }
+        else
+        {
+            profile->errors++;
+        }
+
+        if (trace->status != BC_I2C_STATUS_OK && trace->channel != BC_I2C_I2C_1W &&
+                (trace->type == BC_I2C_TRANSACTION_READ || trace->type == BC_I2C_TRANSACTION_MEMORY_READ))
+        {
+            profile->recoveries++;
+        }
+
+        break;
+    }
+
+    if (_i2c_replay.trace_handler != NULL)
+    {
+        _i2c_replay.trace_handler(trace, _i2c_replay.trace_param);
+    }
+}
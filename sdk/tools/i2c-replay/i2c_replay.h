@@ -0,0 +1,22 @@
+#ifndef _I2C_REPLAY_H
+#define _I2C_REPLAY_H
+
+#include <bc_i2c.h>
+
+// Host stand-in of bc_i2c which replays recorded transactions
+//
+// Every transaction of a driver is compared with the next record of the
+// trace (channel, type, addresses, length and written data). Read data
+// and status are taken from the record, bus time is counted by the same
+// model as on the device.
+
+// load trace, lines without "i2c " are skipped, so raw log can be used
+bool i2c_replay_load(const char *path);
+
+// check whether all records have been replayed
+bool i2c_replay_is_finished(void);
+
+// get number of transactions which didn't match the trace
+int i2c_replay_get_mismatches(void);
+
+#endif // _I2C_REPLAY_H
@@ -0,0 +1,212 @@
+#include <i2c_replay.h>
+#include <bc_scheduler.h>
+#include <bc_system.h>
+#include <bc_error.h>
+#include <bc_tmp112.h>
+#include <bc_sht30.h>
+#include <bc_opt3001.h>
+
+// Benchmark of a sensor driver against recorded I2C trace
+//
+// The driver runs on the real scheduler with virtual time, every sleep
+// of the scheduler moves the time by one RTC tick. The run ends after
+// requested number of measurements or at the end of the trace.
+
+#define MEASUREMENT_INTERVAL 1000
+
+typedef struct
+{
+    const char *name;
+    uint8_t device_address;
+    void (*start)(uint8_t device_address);
+
+} driver_t;
+
+static void tmp112_start(uint8_t device_address);
+static void sht30_start(uint8_t device_address);
+static void opt3001_start(uint8_t device_address);
+
+static const driver_t driver_table[] =
+{
+    { "tmp112", 0x49, tmp112_start },
+    { "sht30", BC_SHT30_ADDRESS_DEFAULT, sht30_start },
+    { "opt3001", 0x44, opt3001_start },
+};
+
+static struct
+{
+    const driver_t *driver;
+    uint8_t device_address;
+    int measurements;
+    int updates;
+    int errors;
+    bc_tick_t tick;
+
+} host;
+
+static void report(void);
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: %s <driver> <trace> [measurements] [device address]\n", argv[0]);
+        fprintf(stderr, "drivers:");
+
+        for (size_t i = 0; i < sizeof(driver_table) / sizeof(driver_table[0]); i++)
+        {
+            fprintf(stderr, " %s", driver_table[i].name);
+        }
+
+        fprintf(stderr, "\n");
+
+        return 2;
+    }
+
+    for (size_t i = 0; i < sizeof(driver_table) / sizeof(driver_table[0]); i++)
+    {
+        if (strcmp(driver_table[i].name, argv[1]) == 0)
+        {
+            host.driver = &driver_table[i];
+        }
+    }
+
+    if (host.driver == NULL)
+    {
+        fprintf(stderr, "unknown driver %s\n", argv[1]);
+
+        return 2;
+    }
+
+    if (!i2c_replay_load(argv[2]))
+    {
+        fprintf(stderr, "cannot read %s\n", argv[2]);
+
+        return 2;
+    }
+
+    host.measurements = argc > 3 ? atoi(argv[3]) : 10;
+    host.device_address = argc > 4 ? strtol(argv[4], NULL, 0) : host.driver->device_address;
+
+    bc_scheduler_init();
+
+    host.driver->start(host.device_address);
+
+    bc_scheduler_run();
+}
+
+bc_tick_t bc_tick_get(void)
+{
+    return host.tick;
+}
+
+void bc_system_sleep(void)
+{
+    if (host.updates + host.errors >= host.measurements || i2c_replay_is_finished())
+    {
+        report();
+    }
+
+    // RTC wakes the node every 10 ms
+    host.tick += 10;
+}
+
+void application_error(bc_error_t code)
+{
+    fprintf(stderr, "application error %d\n", (int) code);
+
+    exit(2);
+}
+
+static void report(void)
+{
+    bc_i2c_profile_t profile;
+    int measurements = host.updates + host.errors;
+
+    printf("driver %s: %d measurements (%d updates, %d errors)\n", host.driver->name, measurements, host.updates, host.errors);
+
+    if (bc_i2c_get_profile(BC_I2C_I2C0, host.device_address, &profile))
+    {
+        printf("device 0x%02x: %" PRIu32 " transactions, %" PRIu32 " bytes, %" PRIu32 " nacks, %" PRIu32 " errors, %" PRIu32 " recoveries\n",
+                host.device_address, profile.transactions, profile.bytes, profile.nacks, profile.errors, profile.recoveries);
+
+        printf("bus time: %" PRIu32 " us total, %" PRIu32 " us per measurement\n", profile.bus_time_us,
+                measurements > 0 ? profile.bus_time_us / measurements : 0);
+    }
+
+    printf("mismatches: %d\n", i2c_replay_get_mismatches());
+
+    exit(i2c_replay_get_mismatches() == 0 ? 0 : 1);
+}
+
+static void tmp112_event_handler(bc_tmp112_t *self, bc_tmp112_event_t event, void *event_param)
+{
+    (void) self;
+    (void) event_param;
+
+    if (event == BC_TMP112_EVENT_UPDATE)
+    {
+        host.updates++;
+    }
+    else
+    {
+        host.errors++;
+    }
+}
+
+static void tmp112_start(uint8_t device_address)
+{
+    static bc_tmp112_t tmp112;
+
+    bc_tmp112_init(&tmp112, BC_I2C_I2C0, device_address);
+    bc_tmp112_set_event_handler(&tmp112, tmp112_event_handler, NULL);
+    bc_tmp112_set_update_interval(&tmp112, MEASUREMENT_INTERVAL);
+}
+
+static void sht30_event_handler(bc_sht30_t *self, bc_sht30_event_t event, void *event_param)
+{
+    (void) self;
+    (void) event_param;
+
+    if (event == BC_SHT30_EVENT_UPDATE)
+    {
+        host.updates++;
+    }
+    else
+    {
+        host.errors++;
+    }
+}
+
+static void sht30_start(uint8_t device_address)
+{
+    static bc_sht30_t sht30;
+
+    bc_sht30_init(&sht30, BC_I2C_I2C0, device_address);
+    bc_sht30_set_event_handler(&sht30, sht30_event_handler, NULL);
+    bc_sht30_set_update_interval(&sht30, MEASUREMENT_INTERVAL);
+}
+
+static void opt3001_event_handler(bc_opt3001_t *self, bc_opt3001_event_t event, void *event_param)
+{
+    (void) self;
+    (void) event_param;
+
+    if (event == BC_OPT3001_EVENT_UPDATE)
+    {
+        host.updates++;
+    }
+    else
+    {
+        host.errors++;
+    }
+}
+
+static void opt3001_start(uint8_t device_address)
+{
+    static bc_opt3001_t opt3001;
+
+    bc_opt3001_init(&opt3001, BC_I2C_I2C0, device_address);
+    bc_opt3001_set_event_handler(&opt3001, opt3001_event_handler, NULL);
+    bc_opt3001_set_update_interval(&opt3001, MEASUREMENT_INTERVAL);
+}
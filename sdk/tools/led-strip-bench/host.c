@@ -0,0 +1,39 @@
+#include <bc_scheduler.h>
+
+// Host stub of scheduler, it runs single task of the effect, see main.c
+
+bc_tick_t host_tick;
+void (*host_task)(void *);
+void *host_task_param;
+bc_tick_t host_task_tick;
+
+bc_scheduler_task_id_t bc_scheduler_register(void (*task)(void *), void *param, bc_tick_t tick)
+{
+    host_task = task;
+    host_task_param = param;
+    host_task_tick = tick;
+
+    return 0;
+}
+
+void bc_scheduler_unregister(bc_scheduler_task_id_t task_id)
+{
+    (void) task_id;
+
+    host_task = NULL;
+}
+
+bc_tick_t bc_scheduler_get_spin_tick(void)
+{
+    return host_tick;
+}
+
+void bc_scheduler_plan_current_now(void)
+{
+    host_task_tick = 0;
+}
+
+void bc_scheduler_plan_current_absolute(bc_tick_t tick)
+{
+    host_task_tick = tick;
+}
@@ -0,0 +1,365 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include <bc_led_strip.h>
+#include <stdio.h>
+#include <time.h>
+#include "reference.h"
+
+#define COUNT_MAX 300
+#define FRAMES 600
+#define WAIT 25
+
+// Host stub of scheduler in host.c
+extern bc_tick_t host_tick;
+extern void (*host_task)(void *);
+extern void *host_task_param;
+extern bc_tick_t host_task_tick;
+
+static uint32_t _pixels[COUNT_MAX];
+static uint32_t _reference_pixels[COUNT_MAX];
+static int _writes;
+
+static bool _driver_init(const bc_led_strip_buffer_t *buffer)
+{
+    (void) buffer;
+
+    return true;
+}
+
+static void _driver_set_pixel(int position, uint32_t color)
+{
+    _pixels[position] = color;
+}
+
+static void _driver_set_pixel_rgbw(int position, uint8_t r, uint8_t g, uint8_t b, uint8_t w)
+{
+    _pixels[position] = (uint32_t) r << 24 | (uint32_t) g << 16 | (uint32_t) b << 8 | w;
+}
+
+static bool _driver_write(void)
+{
+    _writes++;
+
+    return true;
+}
+
+static bool _driver_is_ready(void)
+{
+    return true;
+}
+
+static const bc_led_strip_driver_t _driver =
+{
+    .init = _driver_init,
+    .set_pixel = _driver_set_pixel,
+    .set_pixel_rgbw = _driver_set_pixel_rgbw,
+    .write = _driver_write,
+    .is_ready = _driver_is_ready
+};
+
+static const struct
+{
+    const char *name;
+    reference_effect_t effect;
+    uint32_t color;
+
+} _effects[] =
+{
+    { "test", REFERENCE_TEST, 0 },
+    { "rainbow", REFERENCE_RAINBOW, 0 },
+    { "rainbow_cycle", REFERENCE_RAINBOW_CYCLE, 0 },
+    { "color_wipe", REFERENCE_COLOR_WIPE, 0x12345678 },
+    { "theater_chase", REFERENCE_THEATER_CHASE, 0xff804020 },
+    { "theater_chase_rainbow", REFERENCE_THEATER_CHASE_RAINBOW, 0 },
+    { "stroboscope", REFERENCE_STROBOSCOPE, 0x80ff4001 },
+    { "icicle", REFERENCE_ICICLE, 0xfe7f3f1f },
+    { "pulse_color", REFERENCE_PULSE_COLOR, 0xc0a08060 }
+};
+
+static void _start(bc_led_strip_t *strip, reference_effect_t effect, uint32_t color)
+{
+    switch (effect)
+    {
+        case REFERENCE_TEST: bc_led_strip_effect_test(strip); break;
+        case REFERENCE_RAINBOW: bc_led_strip_effect_rainbow(strip, WAIT); break;
+        case REFERENCE_RAINBOW_CYCLE: bc_led_strip_effect_rainbow_cycle(strip, WAIT); break;
+        case REFERENCE_COLOR_WIPE: bc_led_strip_effect_color_wipe(strip, color, WAIT); break;
+        case REFERENCE_THEATER_CHASE: bc_led_strip_effect_theater_chase(strip, color, WAIT); break;
+        case REFERENCE_THEATER_CHASE_RAINBOW: bc_led_strip_effect_theater_chase_rainbow(strip, WAIT); break;
+        case REFERENCE_STROBOSCOPE: bc_led_strip_effect_stroboscope(strip, color, WAIT); break;
+        case REFERENCE_ICICLE: bc_led_strip_effect_icicle(strip, color, WAIT); break;
+        case REFERENCE_PULSE_COLOR: bc_led_strip_effect_pulse_color(strip, color, WAIT); break;
+        default: break;
+    }
+}
+
+static int _compare(const char *name, int count, int brightness, int frame)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (_pixels[i] != _reference_pixels[i])
+        {
+            printf("%s: count %d brightness %d frame %d pixel %d is %08x, reference %08x\n",
+                   name, count, brightness, frame, i, _pixels[i], _reference_pixels[i]);
+
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+// Every frame of every effect has to be equal to the reference and frames have to be paced by planned tick
+static int _verify_effect(int index, bc_led_strip_type_t type, int count, uint8_t brightness)
+{
+    bc_led_strip_buffer_t buffer = { .type = type, .count = count, .buffer = NULL };
+    bc_led_strip_t strip;
+    reference_t reference = { .type = type, .count = count, .brightness = brightness, .pixels = _reference_pixels };
+
+    memset(_pixels, 0, sizeof(_pixels));
+    memset(_reference_pixels, 0, sizeof(_reference_pixels));
+
+    bc_led_strip_init(&strip, &_driver, &buffer);
+    bc_led_strip_set_brightness(&strip, brightness);
+
+    host_tick = 1000;
+
+    _start(&strip, _effects[index].effect, _effects[index].color);
+    reference_start(&reference, _effects[index].effect, _effects[index].color);
+
+    bc_tick_t planned = host_tick + strip._effect.wait;
+
+    for (int frame = 0; frame < FRAMES; frame++)
+    {
+        _writes = 0;
+
+        bool running = reference_frame(&reference);
+
+        host_task(host_task_param);
+
+        if (_writes != 1 || _compare(_effects[index].name, count, brightness, frame) != 0)
+        {
+            return 1;
+        }
+
+        if (!running)
+        {
+            if (host_task != NULL)
+            {
+                printf("%s: count %d effect is not done\n", _effects[index].name, count);
+
+                return 1;
+            }
+
+            return 0;
+        }
+
+        if (host_task_tick != planned)
+        {
+            printf("%s: frame %d planned at %llu, expected %llu\n", _effects[index].name, frame,
+                   (unsigned long long) host_task_tick, (unsigned long long) planned);
+
+            return 1;
+        }
+
+        // Frame runs late, within the period
+        host_tick = planned + (strip._effect.wait != 0 ? frame % strip._effect.wait : 0);
+        planned += strip._effect.wait;
+    }
+
+    bc_led_strip_effect_stop(&strip);
+
+    return 0;
+}
+
+static int _verify_thermometer(bc_led_strip_type_t type, int count)
+{
+    bc_led_strip_buffer_t buffer = { .type = type, .count = count, .buffer = NULL };
+    bc_led_strip_t strip;
+    reference_t reference = { .type = type, .count = count, .pixels = _reference_pixels };
+
+    bc_led_strip_init(&strip, &_driver, &buffer);
+
+    for (int brightness = 0; brightness < 256; brightness++)
+    {
+        bc_led_strip_set_brightness(&strip, brightness);
+        reference.brightness = brightness;
+
+        for (float temperature = -12.f; temperature <= 42.f; temperature += 2.5f)
+        {
+            bc_led_strip_thermometer(&strip, temperature, -10.f, 40.f, 8, 21.f, 0x00ff0000);
+            reference_thermometer(&reference, temperature, -10.f, 40.f, 8, 21.f, 0x00ff0000);
+
+            if (_compare("thermometer", count, brightness, (int) temperature) != 0)
+            {
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+static double _now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// Time of one rendered frame in microseconds, the best of five runs
+static double _measure(int index, bc_led_strip_type_t type, int count, int frames)
+{
+    bc_led_strip_buffer_t buffer = { .type = type, .count = count, .buffer = NULL };
+    bc_led_strip_t strip;
+    double best = 0;
+
+    bc_led_strip_init(&strip, &_driver, &buffer);
+
+    for (int run = 0; run < 5; run++)
+    {
+        _start(&strip, _effects[index].effect, _effects[index].color);
+
+        double start = _now();
+
+        for (int frame = 0; frame < frames && host_task != NULL; frame++)
+        {
+            host_tick += WAIT;
+
+            host_task(host_task_param);
+        }
+
+        double time = (_now() - start) / frames;
+
+        if (run == 0 || time < best)
+        {
+            best = time;
+        }
+
+        bc_led_strip_effect_stop(&strip);
+    }
+
+    return best;
+}
+
+static double _measure_reference(int index, bc_led_strip_type_t type, int count, int frames)
+{
+    reference_t reference = { .type = type, .count = count, .brightness = 255, .pixels = _reference_pixels };
+    double best = 0;
+
+    for (int run = 0; run < 5; run++)
+    {
+        reference_start(&reference, _effects[index].effect, _effects[index].color);
+
+        double start = _now();
+
+        for (int frame = 0; frame < frames && reference_frame(&reference); frame++)
+        {
+        }
+
+        double time = (_now() - start) / frames;
+
+        if (run == 0 || time < best)
+        {
+            best = time;
+        }
+    }
+
+    return best;
+}
+
+static double _measure_thermometer(bc_led_strip_type_t type, int count, int frames, bool is_reference)
+{
+    reference_t reference = { .type = type, .count = count, .brightness = 255, .pixels = is_reference ? _reference_pixels : NULL };
+    bc_led_strip_buffer_t buffer = { .type = type, .count = count, .buffer = NULL };
+    bc_led_strip_t strip;
+    double best = 0;
+
+    bc_led_strip_init(&strip, &_driver, &buffer);
+
+    for (int run = 0; run < 5; run++)
+    {
+        double start = _now();
+
+        for (int frame = 0; frame < frames; frame++)
+        {
+            // Whole strip is heat map
+            if (reference.pixels != NULL)
+            {
+                reference_thermometer(&reference, 40.f, 0.f, 40.f, 0, 100.f, 0);
+            }
+            else
+            {
+                bc_led_strip_thermometer(&strip, 40.f, 0.f, 40.f, 0, 100.f, 0);
+            }
+        }
+
+        double time = (_now() - start) / frames;
+
+        if (run == 0 || time < best)
+        {
+            best = time;
+        }
+    }
+
+    return best;
+}
+
+static void _report(const char *name, double reference, double render, bc_led_strip_type_t type, int count)
+{
+    // Bit takes 1.25 us, up to two halves of DMA window (80 us each) are sent after data, reset pulse takes 60 us
+    double wire = count * type * 8 * 1.25 + 2 * 80 + 60;
+
+    printf("%-22s %9.3f %9.3f %9.0f %9.1f\n", name, reference, render, wire, 1e6 / (wire + render));
+}
+
+int main(int argc, char *argv[])
+{
+    int frames = argc > 1 ? atoi(argv[1]) : 1000;
+    int count = 144;
+    int errors = 0;
+
+    static const int counts[] = { 1, 2, 3, 7, 10, 11, 144, 255, 300 };
+    static const uint8_t brightnesses[] = { 255, 100, 1 };
+
+    for (size_t e = 0; e < sizeof(_effects) / sizeof(_effects[0]); e++)
+    {
+        for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++)
+        {
+            for (size_t b = 0; b < sizeof(brightnesses) / sizeof(brightnesses[0]); b++)
+            {
+                errors += _verify_effect(e, BC_LED_STRIP_TYPE_RGB, counts[c], brightnesses[b]);
+                errors += _verify_effect(e, BC_LED_STRIP_TYPE_RGBW, counts[c], brightnesses[b]);
+            }
+        }
+    }
+
+    for (int c = 1; c <= COUNT_MAX; c++)
+    {
+        errors += _verify_thermometer(BC_LED_STRIP_TYPE_RGB, c);
+        errors += _verify_thermometer(BC_LED_STRIP_TYPE_RGBW, c);
+    }
+
+    printf("%d RGB pixels, host time of frame rendering and wire time of transfer in microseconds\n\n", count);
+    printf("%-22s %9s %9s %9s %9s\n", "effect", "reference", "render", "wire", "fps");
+
+    for (size_t e = 0; e < sizeof(_effects) / sizeof(_effects[0]); e++)
+    {
+        _report(_effects[e].name, _measure_reference(e, BC_LED_STRIP_TYPE_RGB, count, frames),
+                _measure(e, BC_LED_STRIP_TYPE_RGB, count, frames), BC_LED_STRIP_TYPE_RGB, count);
+    }
+
+    _report("thermometer", _measure_thermometer(BC_LED_STRIP_TYPE_RGB, count, frames, true),
+            _measure_thermometer(BC_LED_STRIP_TYPE_RGB, count, frames, false), BC_LED_STRIP_TYPE_RGB, count);
+
+    if (errors != 0)
+    {
+        printf("\n%d mismatches against reference\n", errors);
+
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,341 @@
+#include "reference.h"
+
+static void _reference_set_pixel_rgbw(reference_t *self, int position, uint8_t r, uint8_t g, uint8_t b, uint8_t w)
+{
+    self->pixels[position] = (uint32_t) r << 24 | (uint32_t) g << 16 | (uint32_t) b << 8 | w;
+}
+
+static void _reference_set_pixel_scaled_rgbw(reference_t *self, int position, uint8_t r, uint8_t g, uint8_t b, uint8_t w)
+{
+    if (self->brightness != 255)
+    {
+        r = ((uint16_t) r * self->brightness) >> 8;
+        g = ((uint16_t) g * self->brightness) >> 8;
+        b = ((uint16_t) b * self->brightness) >> 8;
+        w = ((uint16_t) w * self->brightness) >> 8;
+    }
+
+    _reference_set_pixel_rgbw(self, position, r, g, b, w);
+}
+
+static void _reference_set_pixel_scaled(reference_t *self, int position, uint32_t color)
+{
+    _reference_set_pixel_scaled_rgbw(self, position, color >> 24, color >> 16, color >> 8, color);
+}
+
+static uint32_t _reference_wheel(int position)
+{
+    if (position < 85)
+    {
+        return ((position * 3) << 24) | ((255 - position * 3) << 16);
+    }
+    else if (position < 170)
+    {
+        position -= 85;
+        return ((255 - position * 3) << 24) | ((position * 3) << 8);
+    }
+    else
+    {
+        position -= 170;
+        return ((position * 3) << 16) | ((255 - position * 3) << 8);
+    }
+}
+
+// Exact heat map color, pixel i is 3 * i / count of the way blue - green - yellow - red,
+// channels are brightness times fraction rounded down
+static void _reference_get_heat_map_color(int i, int count, int brightness, int *red, int *green, int *blue)
+{
+    int segment = 3 * i / count;
+    int position = 3 * i % count;
+    int rise = brightness * position / count;
+    int fall = brightness * (count - position) / count;
+
+    *red = segment == 0 ? 0 : segment == 1 ? rise : brightness;
+    *green = segment == 0 ? rise : segment == 1 ? brightness : fall;
+    *blue = segment == 0 ? fall : 0;
+}
+
+void reference_start(reference_t *self, reference_effect_t effect, uint32_t color)
+{
+    self->effect = effect;
+    self->led = effect == REFERENCE_ICICLE ? -10 : 0;
+    self->round = 0;
+    self->color = color;
+
+    if (effect == REFERENCE_TEST)
+    {
+        for (int i = 0; i < self->count; i++)
+        {
+            _reference_set_pixel_scaled(self, i, 0);
+        }
+    }
+}
+
+static bool _reference_test(reference_t *self)
+{
+    uint8_t intensity = 255 * (self->led + 1) / (self->count + 1);
+
+    if (self->round == 0)
+    {
+        _reference_set_pixel_rgbw(self, self->led, intensity, 0, 0, 0);
+    }
+    else if (self->round == 1)
+    {
+        _reference_set_pixel_rgbw(self, self->led, 0, intensity, 0, 0);
+    }
+    else if (self->round == 2)
+    {
+        _reference_set_pixel_rgbw(self, self->led, 0, 0, intensity, 0);
+    }
+    else if (self->round == 3)
+    {
+        if (self->type == BC_LED_STRIP_TYPE_RGBW)
+        {
+            _reference_set_pixel_rgbw(self, self->led, 0, 0, 0, intensity);
+        }
+        else
+        {
+            _reference_set_pixel_rgbw(self, self->led, intensity, intensity, intensity, 0);
+        }
+    }
+    else
+    {
+        _reference_set_pixel_rgbw(self, self->led, 0, 0, 0, 0);
+    }
+
+    self->led++;
+
+    if (self->led == self->count)
+    {
+        self->led = 0;
+
+        self->round++;
+    }
+
+    return self->round != 5;
+}
+
+static void _reference_theater_chase_off(reference_t *self)
+{
+    for (int i = self->led; i < self->count; i += 3)
+    {
+        self->pixels[i] = 0;
+    }
+
+    self->led++;
+
+    if (self->led == 3)
+    {
+        self->led = 0;
+    }
+}
+
+static bool _reference_icicle(reference_t *self)
+{
+    const int length = 10;
+
+    for (int i = self->led; (i < self->led + length) && i < self->count; i++)
+    {
+        if (i >= 0)
+        {
+            _reference_set_pixel_scaled(self, i, 0);
+        }
+    }
+
+    self->led++;
+
+    if (self->led == self->count)
+    {
+        self->led = -length;
+    }
+
+    uint8_t r, g, b, w, dr, dg, db, dw;
+
+    dr = ((uint8_t) (self->color >> 24)) / length;
+    dg = ((uint8_t) (self->color >> 16)) / length;
+    db = ((uint8_t) (self->color >> 8)) / length;
+    dw = ((uint8_t) (self->color)) / length;
+
+    r = dr;
+    g = dg;
+    b = db;
+    w = dw;
+
+    for (int i = self->led; (i < self->led + length) && i < self->count; i++)
+    {
+        if (i < 0)
+        {
+            continue;
+        }
+
+        _reference_set_pixel_scaled_rgbw(self, i, r, g, b, w);
+
+        r += dr;
+        g += dg;
+        b += db;
+        w += dw;
+    }
+
+    return true;
+}
+
+static bool _reference_pulse_color(reference_t *self)
+{
+    uint8_t r = self->color >> 24;
+    uint8_t g = self->color >> 16;
+    uint8_t b = self->color >> 8;
+    uint8_t w = self->color;
+
+    uint8_t brightness = (abs(19 - self->round) + 1) * (255 / 20);
+
+    if (++self->round == 38)
+    {
+        self->round = 0;
+    }
+
+    r = ((uint16_t) r * brightness) >> 8;
+    g = ((uint16_t) g * brightness) >> 8;
+    b = ((uint16_t) b * brightness) >> 8;
+    w = ((uint16_t) w * brightness) >> 8;
+
+    for (int i = 0; i < self->count; i++)
+    {
+        _reference_set_pixel_scaled_rgbw(self, i, r, g, b, w);
+    }
+
+    return true;
+}
+
+bool reference_frame(reference_t *self)
+{
+    switch (self->effect)
+    {
+        case REFERENCE_TEST:
+        {
+            return _reference_test(self);
+        }
+        case REFERENCE_RAINBOW:
+        {
+            for (int i = 0; i < self->count; i++)
+            {
+                _reference_set_pixel_scaled(self, i, _reference_wheel((i + self->round) & 255));
+            }
+
+            self->round++;
+
+            return true;
+        }
+        case REFERENCE_RAINBOW_CYCLE:
+        {
+            for (int i = 0; i < self->count; i++)
+            {
+                _reference_set_pixel_scaled(self, i, _reference_wheel(((i * 256 / self->count) + self->round) & 255));
+            }
+
+            self->round++;
+
+            return true;
+        }
+        case REFERENCE_COLOR_WIPE:
+        {
+            _reference_set_pixel_scaled(self, self->led++, self->color);
+
+            return self->led != self->count;
+        }
+        case REFERENCE_THEATER_CHASE:
+        {
+            _reference_theater_chase_off(self);
+
+            for (int i = self->led; i < self->count; i += 3)
+            {
+                _reference_set_pixel_scaled(self, i, self->color);
+            }
+
+            return true;
+        }
+        case REFERENCE_THEATER_CHASE_RAINBOW:
+        {
+            _reference_theater_chase_off(self);
+
+            for (int i = self->led; i < self->count; i += 3)
+            {
+                _reference_set_pixel_scaled(self, i, _reference_wheel((i + self->round) % 255));
+            }
+
+            self->round++;
+
+            return true;
+        }
+        case REFERENCE_STROBOSCOPE:
+        {
+            uint32_t color = (self->round & 1) == 0 ? self->color : 0;
+
+            for (int i = 0; i < self->count; i++)
+            {
+                _reference_set_pixel_scaled(self, i, color);
+            }
+
+            self->round++;
+
+            return true;
+        }
+        case REFERENCE_ICICLE:
+        {
+            return _reference_icicle(self);
+        }
+        case REFERENCE_PULSE_COLOR:
+        {
+            return _reference_pulse_color(self);
+        }
+        default:
+        {
+            return false;
+        }
+    }
+}
+
+void reference_thermometer(reference_t *self, float temperature, float min, float max, uint8_t white_dots, float set_point, uint32_t color)
+{
+    // Exact in double for temperatures used by benchmark, the product is taken before division
+    int max_i = (double) self->count * (temperature - min) / (fabs(max) + fabs(min));
+
+    if (max_i > self->count)
+    {
+        max_i = self->count;
+    }
+
+    if (max_i < 0)
+    {
+        max_i = 0;
+    }
+
+    int red;
+    int green;
+    int blue;
+
+    for (int i = 0; i < max_i; i++)
+    {
+        _reference_get_heat_map_color(i, self->count, self->brightness, &red, &green, &blue);
+
+        _reference_set_pixel_rgbw(self, i, red, green, blue, 0);
+    }
+
+    for (int i = max_i; i < self->count; i++)
+    {
+        if (self->type == BC_LED_STRIP_TYPE_RGBW)
+        {
+            _reference_set_pixel_rgbw(self, i, 0, 0, 0, white_dots);
+        }
+        else
+        {
+            _reference_set_pixel_rgbw(self, i, white_dots, white_dots, white_dots, 0);
+        }
+    }
+
+    if ((min < set_point) && (max > set_point))
+    {
+        int color_i = (double) self->count * (set_point - min) / (fabs(max) + fabs(min));
+
+        self->pixels[color_i] = color;
+    }
+}
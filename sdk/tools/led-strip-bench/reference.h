@@ -0,0 +1,43 @@
+#ifndef _REFERENCE_H
+#define _REFERENCE_H
+
+#include <bc_led_strip.h>
+
+// Effects as they were implemented with one scheduler task per effect, thermometer with exact heat map
+
+typedef enum
+{
+    REFERENCE_TEST = 0,
+    REFERENCE_RAINBOW = 1,
+    REFERENCE_RAINBOW_CYCLE = 2,
+    REFERENCE_COLOR_WIPE = 3,
+    REFERENCE_THEATER_CHASE = 4,
+    REFERENCE_THEATER_CHASE_RAINBOW = 5,
+    REFERENCE_STROBOSCOPE = 6,
+    REFERENCE_ICICLE = 7,
+    REFERENCE_PULSE_COLOR = 8
+
+} reference_effect_t;
+
+typedef struct
+{
+    bc_led_strip_type_t type;
+    int count;
+    uint8_t brightness;
+    uint32_t *pixels;
+
+    reference_effect_t effect;
+    int led;
+    int round;
+    uint32_t color;
+
+} reference_t;
+
+void reference_start(reference_t *self, reference_effect_t effect, uint32_t color);
+
+// Renders one frame, returns false after the last frame of finite effect
+bool reference_frame(reference_t *self);
+
+void reference_thermometer(reference_t *self, float temperature, float min, float max, uint8_t white_dots, float set_point, uint32_t color);
+
+#endif // _REFERENCE_H
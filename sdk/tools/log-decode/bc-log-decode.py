@@ -0,0 +1,285 @@
+#!/usr/bin/env python3
+"""Decode tokenized bc_log output (BC_LOG_TOKENIZED) back to text log.
+
+Format strings are read from .bc_log_tokens section of firmware ELF file,
+the log is read from a file, a serial port device or standard input.
+Text which is not a part of a record (e.g. bc_atci output) is passed through.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+RECORD_MESSAGE = 0xf0
+RECORD_SYNC = 0xf8
+LEVEL_ID = 'XDIWE'
+LEVEL_DUMP = 0
+DUMP_WIDTH = 8
+
+TIMESTAMP_OFF = 0
+TIMESTAMP_ABS = 1
+TIMESTAMP_REL = 2
+
+CONVERSION = re.compile(r'%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l|j|z|t|L)?([diouxXeEfFgGcsp%])')
+
+
+def load_tokens(path, section_name='.bc_log_tokens'):
+    with open(path, 'rb') as f:
+        elf = f.read()
+
+    if elf[:4] != b'\x7fELF':
+        raise ValueError('%s is not an ELF file' % path)
+
+    is_64 = elf[4] == 2
+    endian = '<' if elf[5] == 1 else '>'
+
+    if is_64:
+        shoff, = struct.unpack_from(endian + 'Q', elf, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + 'HHH', elf, 0x3a)
+        header = endian + 'IIQQQQIIQQ'
+    else:
+        shoff, = struct.unpack_from(endian + 'I', elf, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + 'HHH', elf, 0x2e)
+        header = endian + 'IIIIIIIIII'
+
+    sections = [struct.unpack_from(header, elf, shoff + i * shentsize) for i in range(shnum)]
+    names = sections[shstrndx][4]
+
+    for name, _, _, addr, offset, size, _, _, _, _ in sections:
+        if elf[names + name:elf.index(b'\0', names + name)].decode() != section_name:
+            continue
+
+        data = elf[offset:offset + size]
+        tokens = {}
+        start = 0
+
+        while start < len(data):
+            end = data.index(b'\0', start)
+            tokens[addr + start] = data[start:end].decode('utf-8', 'replace')
+            start = end + 1
+
+        return tokens
+
+    raise ValueError('%s has no %s section, was it built with LOG_TOKENIZED=1?' % (path, section_name))
+
+
+def crc8_maxim(data):
+    crc = 0
+
+    for byte in data:
+        crc ^= byte
+
+        for _ in range(8):
+            crc = (crc >> 1) ^ 0x8c if crc & 1 else crc >> 1
+
+    return crc
+
+
+class Payload:
+    def __init__(self, data):
+        self.data = data
+        self.offset = 0
+
+    def varint(self):
+        value = 0
+        shift = 0
+
+        while True:
+            byte = self.data[self.offset]
+            self.offset += 1
+            value |= (byte & 0x7f) << shift
+            shift += 7
+
+            if byte < 0x80:
+                return value
+
+    def zigzag(self):
+        value = self.varint()
+
+        return (value >> 1) ^ -(value & 1)
+
+    def float(self):
+        value, = struct.unpack_from('<f', self.data, self.offset)
+        self.offset += 4
+
+        return value
+
+    def bytes(self, length):
+        value = self.data[self.offset:self.offset + length]
+        self.offset += length
+
+        return value
+
+
+def format_message(fmt, payload):
+    """Format message like newlib printf, arguments are taken from record payload."""
+    result = []
+    position = 0
+
+    for match in CONVERSION.finditer(fmt):
+        result.append(fmt[position:match.start()])
+        position = match.end()
+
+        flags, width, precision, length, conversion = match.groups()
+
+        if conversion == '%':
+            result.append('%')
+            continue
+
+        if width == '*':
+            width = str(payload.zigzag())
+
+        if precision == '*':
+            precision = str(payload.zigzag())
+
+        bits = 64 if length in ('ll', 'j') else 32
+
+        if conversion in 'di':
+            value = payload.zigzag() & ((1 << bits) - 1)
+            value -= (value >> (bits - 1)) << bits
+            conversion = 'd'
+        elif conversion in 'ouxX':
+            value = payload.zigzag() & ((1 << bits) - 1)
+            conversion = 'd' if conversion == 'u' else conversion
+        elif conversion == 'c':
+            value = chr(payload.zigzag() & 0xff)
+        elif conversion == 'p':
+            value = '0x%x' % (payload.zigzag() & 0xffffffff)
+            conversion = 's'
+        elif conversion in 'eEfFgG':
+            value = payload.float()
+        else:
+            value = payload.bytes(payload.varint()).decode('utf-8', 'replace')
+
+        spec = '%' + flags + (width or '') + ('.' + precision if precision is not None else '') + conversion
+
+        result.append(spec % value)
+
+    result.append(fmt[position:])
+
+    return ''.join(result)
+
+
+class Decoder:
+    def __init__(self, tokens, output):
+        self.tokens = tokens
+        self.output = output
+        self.tick = None
+        self.tick_message = None
+        self.timestamp = TIMESTAMP_ABS
+        self.buffer = bytearray()
+
+    def feed(self, data):
+        self.buffer += data
+
+        while self.buffer:
+            header = self.buffer[0]
+
+            if header != RECORD_SYNC and (header & 0xf8) != RECORD_MESSAGE:
+                self.text(self.buffer[:1])
+                del self.buffer[0]
+                continue
+
+            if len(self.buffer) < 2 or len(self.buffer) < self.buffer[1] + 3:
+                return
+
+            length = self.buffer[1]
+            record = bytes(self.buffer[:length + 3])
+
+            # Byte which looks like a header can be a part of text
+            if crc8_maxim(record[1:-1]) != record[-1]:
+                self.text(self.buffer[:1])
+                del self.buffer[0]
+                continue
+
+            del self.buffer[:length + 3]
+
+            try:
+                self.record(header, Payload(record[2:-1]))
+            except (IndexError, KeyError, struct.error, TypeError, ValueError) as e:
+                self.output.write('# <!> Undecodable record %s (%s)\n' % (record.hex(), e))
+
+    def text(self, data):
+        if data != b'\r':
+            self.output.write(data.decode('latin-1'))
+
+    def record(self, header, payload):
+        if header == RECORD_SYNC:
+            self.tick = payload.varint()
+            self.timestamp = payload.bytes(1)[0]
+            return
+
+        level = header & 0x07
+        token = payload.varint()
+        delta = payload.varint()
+
+        if self.tick is not None:
+            self.tick += delta
+
+        prefix = self.prefix(LEVEL_ID[level])
+
+        self.output.write(prefix + format_message(self.tokens[token], payload) + '\n')
+
+        if level == LEVEL_DUMP:
+            self.dump(prefix, payload.bytes(payload.varint()))
+
+        self.output.flush()
+
+    def prefix(self, id):
+        if self.timestamp == TIMESTAMP_OFF:
+            return '# <%s> ' % id
+
+        if self.tick is None:
+            return '# ?.?? <%s> ' % id
+
+        if self.timestamp == TIMESTAMP_REL:
+            relative = (self.tick - (self.tick_message or 0)) // 10
+            self.tick_message = self.tick
+
+            return '# +%d.%02d <%s> ' % (relative // 100, relative % 100, id)
+
+        absolute = self.tick // 10
+
+        return '# %d.%02d <%s> ' % (absolute // 100, absolute % 100, id)
+
+    def dump(self, prefix, data):
+        for position in range(0, len(data), DUMP_WIDTH):
+            line = data[position:position + DUMP_WIDTH]
+            hex = ''
+            text = ''
+
+            for i in range(DUMP_WIDTH):
+                if i == DUMP_WIDTH // 2:
+                    hex += '| '
+
+                hex += '%02X ' % line[i] if i < len(line) else '   '
+                text += (chr(line[i]) if 32 <= line[i] <= 126 else '.') if i < len(line) else ' '
+
+            self.output.write('%s%3d: %s %s\n' % (prefix, position, hex, text))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode tokenized bc_log output to text log')
+    parser.add_argument('elf', help='firmware ELF file built with LOG_TOKENIZED=1')
+    parser.add_argument('input', nargs='?', help='captured log or serial port device (default: standard input)')
+    args = parser.parse_args()
+
+    decoder = Decoder(load_tokens(args.elf), sys.stdout)
+
+    stream = open(args.input, 'rb', buffering=0) if args.input else sys.stdin.buffer
+
+    try:
+        while True:
+            data = stream.read1(256) if hasattr(stream, 'read1') else stream.read(256)
+
+            if not data:
+                break
+
+            decoder.feed(data)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == '__main__':
+    main()